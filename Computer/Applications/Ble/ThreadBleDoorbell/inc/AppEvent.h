@@ -64,6 +64,17 @@ typedef enum
     kThreadEvent_Detached     = 1,  /**< Left / lost the Thread network */
     kThreadEvent_RingReceived = 2,  /**< Remote doorbell ring arrived over Thread mesh */
     kThreadEvent_Error        = 3,  /**< Generic Thread stack error */
+    kThreadEvent_TimeSync     = 4,  /**< Mesh time exchange due (MeshTimeSync timer) */
+    kThreadEvent_Coap         = 5,  /**< MeshCoap send due (timer / response) */
+    kThreadEvent_Sleepy       = 6,  /**< MeshSleepy fast-poll window over / power log due */
+    kThreadEvent_Diag         = 7,  /**< MeshDiag snapshot due (timer / topology change) */
+    kThreadEvent_Dataset      = 8,  /**< MeshDataset: written dataset ready to apply */
+    kThreadEvent_Groups       = 9,  /**< Groups characteristic written (3 bytes in Value) */
+    kThreadEvent_Channel      = 10,  /**< MeshChannel: survey sweep done / leader survey due (1 = start) */
+    kThreadEvent_Auth         = 11,  /**< MeshAuth: key write ready to apply */
+    kThreadEvent_TxPower      = 12,  /**< MeshTxPower: evaluation window over / topology change */
+    kThreadEvent_Recovery     = 13,  /**< MeshRecovery: attach restart due while detached */
+    kThreadEvent_Joiner       = 14,  /**< MeshJoiner: write / joiner result / retry due */
 } ThreadEventType_t;
 
 typedef struct
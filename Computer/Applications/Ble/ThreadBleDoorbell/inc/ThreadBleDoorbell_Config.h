@@ -59,6 +59,18 @@
  *    0x400B : Thread Status Characteristic Declaration
  *    0x400C : Thread Status Value             (Read / Notify, 1 byte)
  *    0x400D : Thread Status CCC               (Read / Write)
+ *    0x400E : Diagnostics Characteristic Declaration
+ *    0x400F : Diagnostics Value               (Read, MeshDiag snapshot frame)
+ *    0x4010 : Dataset Characteristic Declaration
+ *    0x4011 : Dataset Value                   (Write, long write, MeshCoP TLVs)
+ *    0x4012 : Groups Characteristic Declaration
+ *    0x4013 : Groups Value                    (Read / Write, zone and multicast groups)
+ *    0x4014 : Survey Characteristic Declaration
+ *    0x4015 : Survey Value                    (Read / Write, channel survey; 0x01 = start)
+ *    0x4016 : Auth Characteristic Declaration
+ *    0x4017 : Auth Value                      (Read / Write, event signing keys)
+ *    0x4018 : Joiner Characteristic Declaration
+ *    0x4019 : Joiner Value                    (Read / Write, MeshCoP joiner; 0x01 = start)
  */
 
 #ifndef _THREADBLEDOORBELL_CONFIG_H_
@@ -132,7 +144,20 @@ extern "C" {
 #define THREAD_STATUS_CH_HDL       0x400B
 #define THREAD_STATUS_HDL          0x400C   /**< R/Notify - 1 byte thread role */
 #define THREAD_STATUS_CCC_HDL      0x400D
-#define THREAD_CFG_SVC_HDL_MAX     (THREAD_STATUS_CCC_HDL + 1)
+
+#define THREAD_DIAG_CH_HDL         0x400E
+#define THREAD_DIAG_HDL            0x400F   /**< R    - diagnostics snapshot (MeshDiag.h) */
+#define THREAD_DATASET_CH_HDL      0x4010
+#define THREAD_DATASET_HDL         0x4011   /**< W    - Active Operational Dataset TLVs (MeshDataset.h) */
+#define THREAD_GROUPS_CH_HDL       0x4012
+#define THREAD_GROUPS_HDL          0x4013   /**< RW   - zone, target zone, listen flags (MeshGroup.h) */
+#define THREAD_SURVEY_CH_HDL       0x4014
+#define THREAD_SURVEY_HDL          0x4015   /**< RW   - energy survey of channels 11-26 (MeshChannel.h) */
+#define THREAD_AUTH_CH_HDL         0x4016
+#define THREAD_AUTH_HDL            0x4017   /**< RW   - event signing keys (MeshAuth.h) */
+#define THREAD_JOINER_CH_HDL       0x4018
+#define THREAD_JOINER_HDL          0x4019   /**< RW   - MeshCoP joiner start / progress (MeshJoiner.h) */
+#define THREAD_CFG_SVC_HDL_MAX     (THREAD_JOINER_HDL + 1)
 
 /** Thread status values (mirrors otDeviceRole) */
 #define THREAD_STATUS_DISABLED     0x00
@@ -140,6 +165,9 @@ extern "C" {
 #define THREAD_STATUS_CHILD        0x02
 #define THREAD_STATUS_ROUTER       0x03
 #define THREAD_STATUS_LEADER       0x04
+#define THREAD_STATUS_REJECTED     0x05     /**< written dataset refused (MeshDataset.h) */
+#define THREAD_STATUS_JOINING      0x06     /**< MeshCoP joiner running (MeshJoiner.h) */
+#define THREAD_STATUS_JOIN_FAILED  0x07     /**< joiner attempt failed, retry pending */
 
 /* -------------------------------------------------------------------------
  * GATT SC (Service Changed) handle - required by BleIf
@@ -152,6 +180,8 @@ extern "C" {
  * Individual characteristic UUIDs increment the last byte:
  *   Network Name : ...3401,  Network Key: ...3402,  Channel: ...3403
  *   PAN ID       : ...3404,  Join:        ...3405,  Status:  ...3406
+ *   Diagnostics  : ...3407,  Dataset:     ...3408,  Groups:  ...3409
+ *   Survey       : ...340A,  Auth:        ...340B,  Joiner:  ...340C
  * ------------------------------------------------------------------------- */
 
 /* Maximum sizes */
@@ -32,12 +32,13 @@
  *   2. FreeRTOS event queue
  *   3. AppTask FreeRTOS task (spawns Main loop)
  *   4. ButtonHandler (PB1 digital commissioning button)
- *   5. AppManager::Init()  → BLE stack init + GATT + advertising
+ *   5. AppManager::Init()  → GATT, LEDs, BLE stack reset (returns at once)
  *   6. DoorbellManager::Init()  → GPADC for GPIO 28 analog button
  *   7. DoorbellManager::StartPolling() → ADC polling FreeRTOS task
  *
- * The Thread stack is initialised inside AppManager::Init() via
- * Thread_Init(), which is called after the BLE stack is up.
+ * The Thread stack is initialised by Thread_Init() from the app task once
+ * the BLE stack reset completes (DM_RESET_CMPL_IND), then advertising
+ * starts; see App_InitContinue() in AppManager.cpp.
  */
 
 #include "hal.h"
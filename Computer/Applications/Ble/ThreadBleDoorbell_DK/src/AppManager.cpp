@@ -61,7 +61,7 @@
  *  PB1 long press   (>=5 s) : factory-reset Thread credentials and reboot
  *
  * ── Doorbell button (PB2 / GPIO 5, active low) ─────────────────────────────
- *  Press  → ring locally (BLUE LED, BLE notification 0x01, Thread UDP multicast)
+ *  Press  → ring locally (BLUE LED, BLE notification 0x01, Thread CoAP event)
  *  Release→ no action
  */
 
@@ -73,13 +73,27 @@
 #include "qPinCfg.h"
 #include "StatusLed.h"
 #include "BleIf.h"
+#include "MeshTimeSync.h"
+#include "MeshTlvNode.h"
+#include "MeshCoap.h"
+#include "MeshRole.h"
+#include "MeshRecovery.h"
+#include "MeshSleepy.h"
+#include "MeshAuth.h"
+#include "MeshTxPower.h"
+#include "MeshChannel.h"
+#include "MeshDataset.h"
+#include "MeshGroup.h"
+#include "MeshDiag.h"
+#include "MeshJoiner.h"
+#include "BootProfile.h"
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "timers.h"
 
 /* OpenThread headers */
 #include <openthread/thread.h>
-#include <openthread/udp.h>
 #include <openthread/instance.h>
 #include <openthread/ip6.h>
 
@@ -107,12 +121,11 @@ extern "C" void qorvoRadioInit(void);
 #define BTN_FACTORY_RESET_THRESHOLD 5  /**< seconds to hold PB1 for Thread factory reset */
 
 /* -------------------------------------------------------------------------
- * Thread ring multicast address (all Thread nodes in the local network)
- * ff03::1 = Thread realm-local all-nodes multicast
+ * Thread ring events: CoAP POST /e (MeshCoap.h), NON to ff03::1 for the
+ * speakers and confirmable to the gateway
  * ------------------------------------------------------------------------- */
-#define THREAD_RING_PORT        5683     /**< CoAP default port (reused for simplicity) */
-#define THREAD_RING_MCAST       "ff03::1"
-#define THREAD_MSG_TYPE_DOORBELL 0x02    /**< Message type identifier for gateway/Node-RED */
+#define THREAD_RING_CHIME        0       /**< Chime id for speakers (0 = ding-dong) */
+#define THREAD_RING_PLAY_LEAD_MS 150     /**< Play-at lead: worst-case mesh delivery + margin */
 
 /* LED indices (must match QPINCFG_STATUS_LED order in qPinCfg.h):
  *   0 = WHITE_COOL (BLE state)
@@ -133,13 +146,31 @@ static BleIf_Callbacks_t sAppCallbacks;
 
 /* Thread state */
 static bool           sThreadCredentialsAvailable = false;
+static bool           sJoinAfterSurvey            = false; /* Channel 0: join once the survey is done */
 static otInstance*    sThreadInstance             = nullptr;
-static otUdpSocket    sThreadUdpSocket;
-static bool           sThreadUdpSocketOpen        = false;
+
+/* Start-up: Thread is brought up once the BLE controller reset is done */
+#define APP_INIT_BLE_RESET_TIMEOUT_MS 3000   /**< go on without DM_RESET_CMPL_IND after this */
+
+typedef enum
+{
+    kAppInit_BleReset = 0,  /**< BleIf_Init() called, waiting for DM_RESET_CMPL_IND */
+    kAppInit_Thread,        /**< Thread_Init() running */
+    kAppInit_Done,          /**< Thread up, BLE advertising */
+} AppInitState_t;
+
+static volatile AppInitState_t sInitState = kAppInit_BleReset;
+static StaticTimer_t           sInitTimerBuffer;
+static TimerHandle_t           sInitTimer = nullptr;
 
 /* Ring counter for logging */
 static uint32_t sRingCount = 0;
 
+/* Ring pressed before Thread_Init(): sent once Thread is up */
+static bool sRingBeforeInit = false;
+/* First ring held by MeshCoap (detached): on the mesh at attach */
+static bool sFirstRingHeld = false;
+
 /* -------------------------------------------------------------------------
  * Forward declarations
  * ------------------------------------------------------------------------- */
@@ -154,9 +185,27 @@ static void BLE_CCCD_Callback(BleIf_AttsCccEvt_t* event);
 static void Thread_Init(void);
 static void Thread_StartJoin(void);
 static void Thread_SendRingMulticast(void);
-static void Thread_UdpReceiveCallback(void* aContext, otMessage* aMessage,
-                                      const otMessageInfo* aMessageInfo);
+static void Thread_EventReceived(const uint8_t* pFrame, uint16_t len,
+                                 const otMessageInfo* aMessageInfo);
 static void Thread_StateChangeCallback(uint32_t aFlags, void* aContext);
+static void Thread_TimeSyncNotify(void);
+static void Thread_CoapNotify(void);
+static void Thread_SleepyNotify(void);
+static void Thread_DiagNotify(void);
+static void Thread_DiagSnapshot(const uint8_t* pFrame, uint16_t len);
+static void Thread_DatasetNotify(void);
+static void Thread_DatasetResult(otError error, uint16_t len);
+static void Thread_ChannelNotify(void);
+static void Thread_ChannelSurvey(const uint8_t* pSurvey, uint16_t len);
+static void Thread_AuthNotify(void);
+static void Thread_AuthUpdate(void);
+static void Thread_JoinerNotify(void);
+static void Thread_JoinerState(MeshJoiner_State_t state, otError error);
+static void Thread_TxPowerNotify(void);
+static void Thread_RecoveryNotify(void);
+static void Thread_SetGroups(uint32_t packed);
+static void App_InitTimeout(TimerHandle_t xTimer);
+static void App_InitContinue(bool timedOut);
 
 /* -------------------------------------------------------------------------
  * Helper: accessor for config values defined in Config.c
@@ -167,6 +216,11 @@ extern "C" uint8_t  ThreadCfg_GetChannel(void);
 extern "C" uint16_t ThreadCfg_GetPanId(void);
 extern "C" void     ThreadCfg_SetStatus(uint8_t status);
 extern "C" uint8_t  ThreadCfg_GetStatus(void);
+extern "C" void     ThreadCfg_SetDiagnostics(const uint8_t* pData, uint16_t len);
+extern "C" void     ThreadCfg_SetSurvey(const uint8_t* pSurvey, uint16_t len);
+extern "C" void     ThreadCfg_SetAuth(const uint8_t* pInfo);
+extern "C" void     ThreadCfg_SetJoiner(const uint8_t* pInfo);
+extern "C" void     ThreadCfg_SetGroups(const uint8_t* pValue);
 
 /* =========================================================================
  *  AppManager::Init
@@ -178,7 +232,6 @@ void AppManager::Init()
     sAppCallbacks.chrReadCallback  = BLE_CharacteristicRead_Callback;
     sAppCallbacks.chrWriteCallback = BLE_CharacteristicWrite_Callback;
     sAppCallbacks.cccCallback      = BLE_CCCD_Callback;
-    BleIf_Init(&sAppCallbacks);
 
     /* --- LEDs ----------------------------------------------------------- */
     StatusLed_Init(StatusLedGpios, Q_ARRAY_SIZE(StatusLedGpios), true);
@@ -189,32 +242,18 @@ void AppManager::Init()
     /* --- Button --------------------------------------------------------- */
     GetAppButtons().RegisterMultiFunc(APP_MULTI_FUNC_BUTTON);
 
-    /* --- Wait for BLE stack reset to complete ----------------------------
+    /* --- BLE reset, then Thread ------------------------------------------
      * BleIf_Init() calls DmDevReset() which asynchronously resets the BLE
-     * radio controller.  Thread_Init() calls qorvoRadioInit() which also
-     * accesses the radio hardware.  Starting both at the same time causes
-     * a hard fault / watchdog reset on the shared radio, so we must wait
-     * for the BLE reset to finish (DM_RESET_CMPL_IND) before initialising
-     * the OpenThread radio. */
-    {
-        uint32_t waitMs = 0;
-        while(!BleIf_IsReady() && waitMs < 3000)
-        {
-            vTaskDelay(pdMS_TO_TICKS(10));
-            waitMs += 10;
-        }
-        if(waitMs >= 3000)
-        {
-            GP_LOG_SYSTEM_PRINTF("[BLE] WARNING: BLE stack reset did not complete in time", 0);
-        }
-        else
-        {
-            GP_LOG_SYSTEM_PRINTF("[BLE] Stack ready (%lu ms)", 0, waitMs);
-        }
-    }
-
-    /* --- Thread --------------------------------------------------------- */
-    Thread_Init();
+     * radio controller.  Thread_Init() also accesses the radio hardware, and
+     * starting both at the same time causes a hard fault / watchdog reset
+     * on the shared radio.  So Thread_Init() runs from App_InitContinue()
+     * when DM_RESET_CMPL_IND comes in, and this returns at once: the app
+     * task serves buttons and sensors while the controller resets. */
+    sInitTimer = xTimerCreateStatic("AppInit", pdMS_TO_TICKS(APP_INIT_BLE_RESET_TIMEOUT_MS), pdFALSE,
+                                    nullptr, App_InitTimeout, &sInitTimerBuffer);
+    xTimerStart(sInitTimer, 0);
+    BootProfile_Begin(BootProfile_BleReset);
+    BleIf_Init(&sAppCallbacks);
 
     /* --- Banner --------------------------------------------------------- */
     GP_LOG_SYSTEM_PRINTF("", 0);
@@ -235,7 +274,7 @@ void AppManager::Init()
     GP_LOG_SYSTEM_PRINTF("  1. Connect to 'QPG Thread Doorbell'", 0);
     GP_LOG_SYSTEM_PRINTF("  2. Write Thread Network Name (16 bytes)", 0);
     GP_LOG_SYSTEM_PRINTF("  3. Write Thread Network Key  (16 bytes)", 0);
-    GP_LOG_SYSTEM_PRINTF("  4. Write Channel  (1 byte, 11-26)", 0);
+    GP_LOG_SYSTEM_PRINTF("  4. Write Channel  (1 byte, 11-26, 0 = auto)", 0);
     GP_LOG_SYSTEM_PRINTF("  5. Write PAN ID   (2 bytes LE)", 0);
     GP_LOG_SYSTEM_PRINTF("  6. Write 0x01 to Join characteristic", 0);
     GP_LOG_SYSTEM_PRINTF("", 0);
@@ -243,16 +282,6 @@ void AppManager::Init()
     GP_LOG_SYSTEM_PRINTF("  Digital button PB2 (GPIO 5)", 0);
     GP_LOG_SYSTEM_PRINTF("  Hold PB1 5s = factory reset Thread creds", 0);
     GP_LOG_SYSTEM_PRINTF("", 0);
-
-    /* Start BLE advertising */
-    if(BleIf_StartAdvertising() == STATUS_NO_ERROR)
-    {
-        GP_LOG_SYSTEM_PRINTF("[BLE] Advertising started - scan for 'QPG Thread Doorbell'", 0);
-    }
-    else
-    {
-        GP_LOG_SYSTEM_PRINTF("[BLE] Advertising will start after stack reset...", 0);
-    }
 }
 
 /* =========================================================================
@@ -291,6 +320,10 @@ void AppManager::BleEventHandler(AppEvent* aEvent)
 {
     switch(aEvent->BleConnectionEvent.Event)
     {
+        case Ble_Event_t::kBleConnectionEvent_StackReady:
+            App_InitContinue(aEvent->BleConnectionEvent.Value != 0);
+            break;
+
         case Ble_Event_t::kBleConnectionEvent_Advertise_Start:
             GP_LOG_SYSTEM_PRINTF("[BLE] Advertising started", 0);
             StatusLed_BlinkLed(LED_BLE_STATE, ADV_BLINK_ON_MS, ADV_BLINK_OFF_MS);
@@ -304,6 +337,9 @@ void AppManager::BleEventHandler(AppEvent* aEvent)
         case Ble_Event_t::kBleConnectionEvent_Disconnected:
             GP_LOG_SYSTEM_PRINTF("[BLE] Phone disconnected", 0);
             StatusLed_SetLed(LED_BLE_STATE, false);
+            /* Keys written in this connection can no longer be changed over BLE */
+            MeshAuth_Lock();
+            Thread_AuthUpdate();
             break;
 
         case Ble_Event_t::kBleLedControlCharUpdate:
@@ -405,6 +441,25 @@ void AppManager::ThreadEventHandler(AppEvent* aEvent)
                 uint8_t status = ThreadCfg_GetStatus();
                 BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
             }
+            MeshTimeSync_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshChannel_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshRole_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshRecovery_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshSleepy_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            /* Send the events held while detached */
+            MeshCoap_Process();
+            /* Boot profile: first attach, and a first ring that waited for it */
+            {
+                bool ended = BootProfile_End(BootProfile_Attach);
+                if(sFirstRingHeld && BootProfile_End(BootProfile_FirstEvent))
+                {
+                    ended = true;
+                }
+                if(ended)
+                {
+                    BootProfile_Log();
+                }
+            }
             break;
 
         case kThreadEvent_Detached:
@@ -415,6 +470,10 @@ void AppManager::ThreadEventHandler(AppEvent* aEvent)
                 uint8_t status = THREAD_STATUS_DETACHED;
                 BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
             }
+            MeshTimeSync_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshRole_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshRecovery_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshSleepy_RoleChanged(OT_DEVICE_ROLE_DETACHED);
             break;
 
         case kThreadEvent_RingReceived:
@@ -422,6 +481,57 @@ void AppManager::ThreadEventHandler(AppEvent* aEvent)
             RingDoorbell(true /* fromThread */, false /* fromPhone */);
             break;
 
+        case kThreadEvent_TimeSync:
+            MeshTimeSync_Process();
+            break;
+
+        case kThreadEvent_Coap:
+            MeshCoap_Process();
+            break;
+
+        case kThreadEvent_Sleepy:
+            MeshSleepy_Process();
+            break;
+
+        case kThreadEvent_Diag:
+            MeshDiag_Process();
+            break;
+
+        case kThreadEvent_Dataset:
+            MeshDataset_Process();
+            break;
+
+        case kThreadEvent_Channel:
+            if(aEvent->ThreadEvent.Value == 1)
+            {
+                MeshChannel_StartSurvey();
+            }
+            else
+            {
+                MeshChannel_Process();
+            }
+            break;
+
+        case kThreadEvent_Auth:
+            Thread_AuthUpdate();
+            break;
+
+        case kThreadEvent_TxPower:
+            MeshTxPower_Process();
+            break;
+
+        case kThreadEvent_Recovery:
+            MeshRecovery_Process();
+            break;
+
+        case kThreadEvent_Joiner:
+            MeshJoiner_Process();
+            break;
+
+        case kThreadEvent_Groups:
+            Thread_SetGroups(aEvent->ThreadEvent.Value);
+            break;
+
         case kThreadEvent_Error:
             GP_LOG_SYSTEM_PRINTF("[Thread] Error: 0x%x", 0, aEvent->ThreadEvent.Value);
             break;
@@ -500,6 +610,61 @@ void AppManager::NotifyThreadEvent(ThreadEventType_t threadEvent, uint32_t value
     GetAppTask().PostEvent(&event);
 }
 
+/* =========================================================================
+ *  App_InitTimeout  - no DM_RESET_CMPL_IND in time: go on without it
+ * ========================================================================= */
+static void App_InitTimeout(TimerHandle_t /*xTimer*/)
+{
+    AppEvent event;
+    event.Type                     = AppEvent::kEventType_BleConnection;
+    event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_StackReady;
+    event.BleConnectionEvent.Value = 1; /* timed out */
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  App_InitContinue  - BLE reset done (or timed out): bring up Thread
+ *
+ *  kAppInit_BleReset -> kAppInit_Thread -> kAppInit_Done.  A reset complete
+ *  after the timeout, or a later controller reset, changes nothing.
+ * ========================================================================= */
+static void App_InitContinue(bool timedOut)
+{
+    if(sInitState != kAppInit_BleReset)
+    {
+        return;
+    }
+    xTimerStop(sInitTimer, 0);
+
+    if(timedOut)
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] WARNING: BLE stack reset did not complete in time", 0);
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] Stack ready (%lu ms)", 0, BootProfile_Duration(BootProfile_BleReset));
+    }
+
+    sInitState = kAppInit_Thread;
+    BootProfile_Begin(BootProfile_ThreadInit);
+    Thread_Init();
+    BootProfile_End(BootProfile_ThreadInit);
+
+    /* A ring pressed while the controller reset: MeshCoap holds it until attach */
+    if(sRingBeforeInit)
+    {
+        sRingBeforeInit = false;
+        Thread_SendRingMulticast();
+    }
+    sInitState = kAppInit_Done;
+
+    /* Start BLE advertising: after Thread_Init(), the radio is set up */
+    if(BleIf_StartAdvertising() == STATUS_NO_ERROR)
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] Advertising started - scan for 'QPG Thread Doorbell'", 0);
+    }
+}
+
 /* =========================================================================
  *  Thread_Init
  *
@@ -529,6 +694,63 @@ static void Thread_Init(void)
     /* Register state-change callback to track network attach/detach */
     otSetStateChangedCallback(sThreadInstance, Thread_StateChangeCallback, nullptr);
 
+    /* Mesh time base: the leader is the time master, everyone else tracks it.
+     * A sleepy node would only get the responses at its next poll, so it
+     * does not exchange and its events carry local time. */
+    MeshTimeSync_Init(sThreadInstance, MESH_SLEEPY ? nullptr : Thread_TimeSyncNotify);
+    MeshTlvNode_Init(sThreadInstance, MESH_TLV_DEVICE_DOORBELL);
+
+    /* Ring events: CoAP server on port 5683, confirmable delivery to the gateway */
+    MeshCoap_Init(sThreadInstance, Thread_EventReceived, Thread_CoapNotify);
+
+    /* Role policy of the device class (MESH_ROLE_POLICY), before the link mode */
+    MeshRole_Init(sThreadInstance, MESH_SLEEPY ? MeshRole_Sleepy : (MeshRole_Policy_t)MESH_ROLE_POLICY);
+
+    /* Link mode of the build profile (MESH_SLEEPY), set before Thread starts */
+    MeshSleepy_Init(sThreadInstance, Thread_SleepyNotify);
+    if(MeshSleepy_IsSleepy())
+    {
+        /* Let the MCU sleep between parent polls */
+        GetAppTask().EnableSleep(true);
+    }
+
+    /* Diagnostics snapshot: readable over BLE and pushed to the gateway (POST /d) */
+    MeshDiag_Init(sThreadInstance, Thread_DiagNotify, Thread_DiagSnapshot);
+
+    /* Single-write commissioning: Dataset characteristic */
+    MeshDataset_Init(sThreadInstance, Thread_DatasetNotify, Thread_DatasetResult);
+    MeshChannel_Init(sThreadInstance, Thread_ChannelNotify, Thread_ChannelSurvey);
+
+    /* Event signing keys (Auth characteristic) */
+    MeshAuth_Init(sThreadInstance, Thread_AuthNotify);
+    Thread_AuthUpdate();
+
+    /* MeshCoP joiner: credentials from a commissioner instead of BLE */
+    MeshJoiner_Init(sThreadInstance, "Doorbell DK", Thread_JoinerNotify, Thread_JoinerState);
+    {
+        uint8_t info[MESH_JOINER_INFO_LEN];
+        MeshJoiner_GetInfo(info);
+        ThreadCfg_SetJoiner(info);
+    }
+
+    /* Transmit power follows the link margin (starts at the BSP power) */
+    MeshTxPower_Init(sThreadInstance, Thread_TxPowerNotify);
+
+    /* Outage metrics, and attach restarts while detached */
+    MeshRecovery_Init(sThreadInstance, Thread_RecoveryNotify);
+
+    /* Zone / class multicast groups: rings go to the chime group of the
+     * target zone.  A sleepy doorbell listens to none by default, so other
+     * rings do not wake it (the Groups characteristic can change that). */
+    MeshGroup_Init(sThreadInstance, MeshGroup_Chime, MeshGroup_Chime,
+                   MeshSleepy_IsSleepy() ? 0 : MESH_GROUP_LISTEN_ALL);
+    MeshCoap_SetPeerGroup(MeshGroup_Target());
+    {
+        uint8_t groups[MESH_GROUP_CONFIG_LEN];
+        MeshGroup_Get(groups);
+        ThreadCfg_SetGroups(groups);
+    }
+
     /* Check if Thread dataset is already stored in NVM */
     otOperationalDataset dataset;
     if(otDatasetGetActive(sThreadInstance, &dataset) == OT_ERROR_NONE)
@@ -537,6 +759,11 @@ static void Thread_Init(void)
         sThreadCredentialsAvailable = true;
         Thread_StartJoin();
     }
+    else if(MESH_JOINER_AUTOSTART && MeshJoiner_HasPskd())
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] No credentials - starting the joiner", 0);
+        MeshJoiner_Start();
+    }
     else
     {
         GP_LOG_SYSTEM_PRINTF("[Thread] No credentials - waiting for BLE commissioning", 0);
@@ -568,6 +795,24 @@ static void Thread_StartJoin(void)
         uint8_t  ch    = ThreadCfg_GetChannel();
         uint16_t panId = ThreadCfg_GetPanId();
 
+        /* Channel 0: the quietest channel of an energy survey, run first if
+         * there is none yet; Thread_ChannelSurvey() calls back here. */
+        if(ch == MESH_CHANNEL_AUTO)
+        {
+            ch = MeshChannel_Best();
+            if(ch == 0)
+            {
+                err = MeshChannel_StartSurvey();
+                if(err == OT_ERROR_NONE || err == OT_ERROR_BUSY)
+                {
+                    sJoinAfterSurvey = true;
+                    return;
+                }
+                ch = MESH_CHANNEL_FALLBACK;
+            }
+            GP_LOG_SYSTEM_PRINTF("[Thread] Auto channel: %u", 0, ch);
+        }
+
         /* Build an operational dataset from the BLE-written values */
         otOperationalDataset dataset;
         memset(&dataset, 0, sizeof(dataset));
@@ -619,145 +864,295 @@ static void Thread_StartJoin(void)
         GP_LOG_SYSTEM_PRINTF("[Thread] SetEnabled failed: %d", 0, (int)err);
         return;
     }
+    BootProfile_Begin(BootProfile_Attach);
 
     /* Blink GREEN LED while joining */
     StatusLed_BlinkLed(LED_THREAD_STATE, THREAD_JOIN_BLINK_ON_MS, THREAD_JOIN_BLINK_OFF_MS);
     GP_LOG_SYSTEM_PRINTF("[Thread] Joining network...", 0);
-
-    /* Open a UDP socket for ring event multicast */
-    if(!sThreadUdpSocketOpen)
-    {
-        otSockAddr sockAddr;
-        memset(&sockAddr, 0, sizeof(sockAddr));
-        sockAddr.mPort = THREAD_RING_PORT;
-
-        err = otUdpOpen(sThreadInstance, &sThreadUdpSocket,
-                        Thread_UdpReceiveCallback, nullptr);
-        if(err == OT_ERROR_NONE)
-        {
-            err = otUdpBind(sThreadInstance, &sThreadUdpSocket, &sockAddr, OT_NETIF_THREAD_INTERNAL);
-            if(err == OT_ERROR_NONE)
-            {
-                sThreadUdpSocketOpen = true;
-                GP_LOG_SYSTEM_PRINTF("[Thread] UDP socket open on port %d", 0, THREAD_RING_PORT);
-            }
-            else
-            {
-                GP_LOG_SYSTEM_PRINTF("[Thread] UDP bind failed: %d", 0, (int)err);
-            }
-        }
-        else
-        {
-            GP_LOG_SYSTEM_PRINTF("[Thread] UDP open failed: %d", 0, (int)err);
-        }
-    }
 }
 
 /* =========================================================================
  *  Thread_SendRingMulticast
  *
- *  Sends a 4-byte UDP message to ff03::1 port THREAD_RING_PORT.
+ *  Publishes a TLV frame (MeshTlv.h) as a critical CoAP event (MeshCoap.h):
+ *
+ *    header     : doorbell, sentAt in the timestamp (mesh time once synced)
+ *    RING       : 0x01 = ringing, ring count, chime id (0 = ding-dong)
+ *    PLAY_AT    : sentAt + THREAD_RING_PLAY_LEAD_MS, only when synced
  *
- *  Payload:
- *    Byte 0 : 0x02 = doorbell event type
- *    Byte 1 : 0x01 = ringing
- *    Byte 2 : ring count high byte
- *    Byte 3 : ring count low byte
+ *  Speakers start the chime at playAt so every node rings together.  A
+ *  ring made while detached still reaches the gateway once reattached.
  * ========================================================================= */
 static void Thread_SendRingMulticast(void)
 {
-    if(sThreadInstance == nullptr || !sThreadUdpSocketOpen)
+    BootProfile_Begin(BootProfile_FirstEvent);
+    if(sThreadInstance == nullptr)
     {
+        sRingBeforeInit = true;
         return;
     }
 
-    otDeviceRole role = otThreadGetDeviceRole(sThreadInstance);
-    if(role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED)
-    {
-        GP_LOG_SYSTEM_PRINTF("[Thread] Not attached - ring not sent to mesh", 0);
-        return;
-    }
+    uint8_t          frame[MESH_TLV_MAX_FRAME];
+    MeshTlv_Writer_t writer;
+    MeshTlv_Header_t header;
+    MeshTlvNode_Begin(&writer, frame, sizeof(frame), &header);
 
-    otMessage* msg = otUdpNewMessage(sThreadInstance, nullptr);
-    if(msg == nullptr)
+    uint8_t* pRing = MeshTlv_Reserve(&writer, MESH_TLV_REC_RING, MESH_TLV_RING_LEN);
+    if(pRing != nullptr)
     {
-        GP_LOG_SYSTEM_PRINTF("[Thread] UDP alloc failed", 0);
-        return;
+        pRing[0] = DOORBELL_STATE_RINGING;
+        pRing[1] = (uint8_t)(sRingCount >> 8);
+        pRing[2] = (uint8_t)(sRingCount & 0xFF);
+        pRing[3] = THREAD_RING_CHIME;
     }
-
-    uint8_t payload[4] = {
-        THREAD_MSG_TYPE_DOORBELL,
-        DOORBELL_STATE_RINGING,
-        (uint8_t)(sRingCount >> 8),
-        (uint8_t)(sRingCount & 0xFF),
-    };
-
-    otError err = otMessageAppend(msg, payload, sizeof(payload));
-    if(err != OT_ERROR_NONE)
+    if(header.flags & MESH_TLV_FLAG_MESH_TIME)
     {
-        GP_LOG_SYSTEM_PRINTF("[Thread] Message append failed: %d", 0, (int)err);
-        otMessageFree(msg);
-        return;
+        MeshTlv_PutU32(&writer, MESH_TLV_REC_PLAY_AT,
+                       header.timestampUs + THREAD_RING_PLAY_LEAD_MS * 1000UL);
     }
 
-    otMessageInfo msgInfo;
-    memset(&msgInfo, 0, sizeof(msgInfo));
-    msgInfo.mPeerPort = THREAD_RING_PORT;
-    otIp6AddressFromString(THREAD_RING_MCAST, &msgInfo.mPeerAddr);
-
-    err = otUdpSend(sThreadInstance, &sThreadUdpSocket, msg, &msgInfo);
+    /* Poll fast for the gateway's ACK (sleepy profile only) */
+    MeshSleepy_Wake();
+    otError err = MeshCoap_Publish(frame, MeshTlvNode_Finish(&writer), MeshCoap_Critical, true);
     if(err == OT_ERROR_NONE)
     {
         GP_LOG_SYSTEM_PRINTF("[Thread] Ring multicast sent (ring #%lu)", 0, sRingCount);
+        if(BootProfile_End(BootProfile_FirstEvent))
+        {
+            BootProfile_Log();
+        }
     }
     else
     {
-        GP_LOG_SYSTEM_PRINTF("[Thread] Ring multicast send failed: %d", 0, (int)err);
-        otMessageFree(msg);
+        GP_LOG_SYSTEM_PRINTF("[Thread] Ring multicast deferred: %d", 0, (int)err);
+        sFirstRingHeld = true;
     }
 }
 
 /* =========================================================================
- *  Thread_UdpReceiveCallback
+ *  Thread_EventReceived
  *
- *  Called by OpenThread when a UDP message arrives on the doorbell port.
- *  Expects the 4-byte structured payload from Thread_SendRingMulticast.
- *  Also accepts the legacy 1-byte format for backwards compatibility.
+ *  Called by MeshCoap (OpenThread context) for every event POSTed to /e.
+ *  Expects a TLV frame with a RING record (the play-at time is only needed
+ *  by speakers).
  * ========================================================================= */
-static void Thread_UdpReceiveCallback(void* /*aContext*/, otMessage* aMessage,
-                                      const otMessageInfo* /*aMessageInfo*/)
+static void Thread_EventReceived(const uint8_t* pFrame, uint16_t len,
+                                 const otMessageInfo* /*aMessageInfo*/)
 {
-    uint16_t len = otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
-    if(len == 0)
+    MeshTlv_Reader_t reader;
+    MeshTlv_Record_t record;
+    if(MeshTlv_ReaderInit(&reader, pFrame, len, nullptr) == MeshTlv_Ok &&
+       MeshTlv_Find(&reader, MESH_TLV_REC_RING, &record) &&
+       MeshTlv_GetU8(&record, 0) == DOORBELL_STATE_RINGING)
     {
+        AppManager::NotifyThreadEvent(kThreadEvent_RingReceived, MeshTlv_GetU16(&record, 1));
+    }
+}
+
+/* =========================================================================
+ *  Thread_TimeSyncNotify  - MeshTimeSync timer task: exchange due
+ * ========================================================================= */
+static void Thread_TimeSyncNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_TimeSync, 0);
+}
+
+/* =========================================================================
+ *  Thread_CoapNotify  - MeshCoap: a held or gateway send is due
+ * ========================================================================= */
+static void Thread_CoapNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Coap, 0);
+}
+
+/* =========================================================================
+ *  Thread_SleepyNotify  - MeshSleepy: fast-poll window over or log due
+ * ========================================================================= */
+static void Thread_SleepyNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Sleepy, 0);
+}
+
+/* =========================================================================
+ *  Thread_DiagNotify  - MeshDiag: snapshot due (timer / topology change)
+ * ========================================================================= */
+static void Thread_DiagNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Diag, 0);
+}
+
+/* =========================================================================
+ *  Thread_DiagSnapshot  - MeshDiag: new snapshot for the Diagnostics characteristic
+ * ========================================================================= */
+static void Thread_DiagSnapshot(const uint8_t* pFrame, uint16_t len)
+{
+    ThreadCfg_SetDiagnostics(pFrame, len);
+}
+
+/* =========================================================================
+ *  Thread_DatasetNotify  - MeshDataset: written dataset ready to apply
+ * ========================================================================= */
+static void Thread_DatasetNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Dataset, 0);
+}
+
+/* =========================================================================
+ *  Thread_DatasetResult  - MeshDataset: dataset applied or refused
+ * ========================================================================= */
+static void Thread_DatasetResult(otError error, uint16_t len)
+{
+    if(error != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] Dataset rejected (%u bytes): %d", 0, len, (int)error);
+        ThreadCfg_SetStatus(THREAD_STATUS_REJECTED);
+        uint8_t status = THREAD_STATUS_REJECTED;
+        BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
         return;
     }
 
-    uint8_t payload[4] = {0};
-    otMessageRead(aMessage, otMessageGetOffset(aMessage), payload,
-                  len < sizeof(payload) ? len : sizeof(payload));
+    GP_LOG_SYSTEM_PRINTF("[Thread] Dataset applied (%u bytes) - starting Thread", 0, len);
+    /* The active dataset is in NVM now: start from it, not from the GATT values */
+    sThreadCredentialsAvailable = true;
+    Thread_StartJoin();
+}
+
+/* =========================================================================
+ *  Thread_SetGroups  - Groups characteristic written: zone and groups
+ * ========================================================================= */
+static void Thread_SetGroups(uint32_t packed)
+{
+    uint8_t groups[MESH_GROUP_CONFIG_LEN] = {(uint8_t)packed, (uint8_t)(packed >> 8), (uint8_t)(packed >> 16)};
 
-    /* 4-byte structured format: type=0x02, state, ringCount_hi, ringCount_lo */
-    if(len >= 4 && payload[0] == THREAD_MSG_TYPE_DOORBELL)
+    otError err = MeshGroup_Set(groups, sizeof(groups));
+    if(err != OT_ERROR_NONE)
     {
-        if(payload[1] == DOORBELL_STATE_RINGING)
-        {
-            uint16_t ringCount = ((uint16_t)payload[2] << 8) | payload[3];
-            AppManager::NotifyThreadEvent(kThreadEvent_RingReceived, ringCount);
-        }
+        GP_LOG_SYSTEM_PRINTF("[Group] Configuration not applied or not stored: %d", 0, (int)err);
     }
-    /* Legacy 1-byte format */
-    else if(len == 1 && payload[0] == DOORBELL_STATE_RINGING)
+    MeshCoap_SetPeerGroup(MeshGroup_Target());
+
+    /* The characteristic reads back what is in use */
+    MeshGroup_Get(groups);
+    ThreadCfg_SetGroups(groups);
+}
+
+/* =========================================================================
+ *  Thread_ChannelNotify  - MeshChannel: sweep done or leader survey due
+ * ========================================================================= */
+static void Thread_ChannelNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Channel, 0);
+}
+
+/* =========================================================================
+ *  Thread_ChannelSurvey  - MeshChannel: survey started or finished
+ * ========================================================================= */
+static void Thread_ChannelSurvey(const uint8_t* pSurvey, uint16_t len)
+{
+    ThreadCfg_SetSurvey(pSurvey, len);
+
+    if(sJoinAfterSurvey && pSurvey[0] != MeshChannel_Running)
     {
-        AppManager::NotifyThreadEvent(kThreadEvent_RingReceived, 0);
+        sJoinAfterSurvey = false;
+        Thread_StartJoin();
     }
 }
 
+/* =========================================================================
+ *  Thread_AuthNotify  - MeshAuth: key write ready to apply
+ * ========================================================================= */
+static void Thread_AuthNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Auth, 0);
+}
+
+/* =========================================================================
+ *  Thread_AuthUpdate  - apply the key write, refresh the Auth read-back
+ * ========================================================================= */
+static void Thread_AuthUpdate(void)
+{
+    uint8_t info[MESH_AUTH_INFO_LEN];
+
+    MeshAuth_Process();
+    MeshAuth_GetInfo(info);
+    ThreadCfg_SetAuth(info);
+}
+
+/* =========================================================================
+ *  Thread_JoinerNotify  - MeshJoiner: write, joiner result or retry due
+ * ========================================================================= */
+static void Thread_JoinerNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Joiner, 0);
+}
+
+/* =========================================================================
+ *  Thread_JoinerState  - MeshJoiner: report progress, start Thread on success
+ * ========================================================================= */
+static void Thread_JoinerState(MeshJoiner_State_t state, otError error)
+{
+    uint8_t info[MESH_JOINER_INFO_LEN];
+    uint8_t status;
+
+    MeshJoiner_GetInfo(info);
+    ThreadCfg_SetJoiner(info);
+
+    switch(state)
+    {
+        case MeshJoiner_Joining:
+            StatusLed_BlinkLed(LED_THREAD_STATE, THREAD_JOIN_BLINK_ON_MS, THREAD_JOIN_BLINK_OFF_MS);
+            status = THREAD_STATUS_JOINING;
+            break;
+
+        case MeshJoiner_Joined:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Joiner done - starting Thread", 0);
+            /* The joiner stored the active dataset: start from it */
+            sThreadCredentialsAvailable = true;
+            Thread_StartJoin();
+            return;
+
+        case MeshJoiner_Failed:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Joiner failed: %d", 0, (int)error);
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            status = THREAD_STATUS_JOIN_FAILED;
+            break;
+
+        default:
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            status = THREAD_STATUS_DISABLED;
+            break;
+    }
+
+    ThreadCfg_SetStatus(status);
+    BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+}
+
+/* =========================================================================
+ *  Thread_TxPowerNotify  - MeshTxPower: evaluation due
+ * ========================================================================= */
+static void Thread_TxPowerNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_TxPower, 0);
+}
+
+/* =========================================================================
+ *  Thread_RecoveryNotify  - MeshRecovery: attach restart due
+ * ========================================================================= */
+static void Thread_RecoveryNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Recovery, 0);
+}
+
 /* =========================================================================
  *  Thread_StateChangeCallback
  * ========================================================================= */
 static void Thread_StateChangeCallback(uint32_t aFlags, void* /*aContext*/)
 {
+    MeshDiag_StateChanged(aFlags);
+    MeshCoap_StateChanged(aFlags);
+    MeshTxPower_StateChanged(aFlags);
+    MeshRecovery_StateChanged(aFlags);
+
     if(aFlags & OT_CHANGED_THREAD_ROLE)
     {
         otDeviceRole role = otThreadGetDeviceRole(sThreadInstance);
@@ -789,6 +1184,11 @@ static void BLE_Stack_Callback(BleIf_MsgHdr_t* pMsg)
     {
         switch(pMsg->event)
         {
+            case BLEIF_DM_RESET_CMPL_IND:
+                BootProfile_End(BootProfile_BleReset);
+                event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_StackReady;
+                event.BleConnectionEvent.Value = 0;
+                break;
             case BLEIF_DM_ADV_START_IND:
                 event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_Advertise_Start;
                 break;
@@ -819,7 +1219,7 @@ static void BLE_CharacteristicRead_Callback(uint16_t /*connId*/, uint16_t /*hand
 }
 
 static void BLE_CharacteristicWrite_Callback(uint16_t /*connId*/, uint16_t handle,
-                                              uint8_t /*op*/, uint16_t /*offset*/,
+                                              uint8_t /*op*/, uint16_t offset,
                                               uint16_t len, uint8_t* pValue,
                                               BleIf_Attr_t* /*pAttr*/)
 {
@@ -843,6 +1243,49 @@ static void BLE_CharacteristicWrite_Callback(uint16_t /*connId*/, uint16_t handl
             Thread_StartJoin();
         }
     }
+    else if(handle == THREAD_DATASET_HDL)
+    {
+        /* One chunk of a (possibly long) write; applied once the writes settle */
+        MeshDataset_Write(offset, pValue, len);
+    }
+    else if(handle == THREAD_GROUPS_HDL)
+    {
+        /* Zone, target zone, listen flags: applied and stored by the app task */
+        if(len == MESH_GROUP_CONFIG_LEN)
+        {
+            AppManager::NotifyThreadEvent(kThreadEvent_Groups, (uint32_t)pValue[0] | ((uint32_t)pValue[1] << 8) |
+                                                                   ((uint32_t)pValue[2] << 16));
+        }
+    }
+    else if(handle == THREAD_SURVEY_HDL)
+    {
+        /* 0x01: start a survey, run by the app task */
+        if(len > 0 && pValue[0] == 0x01)
+        {
+            AppManager::NotifyThreadEvent(kThreadEvent_Channel, 1);
+        }
+    }
+    else if(handle == THREAD_AUTH_HDL)
+    {
+        uint8_t info[MESH_AUTH_INFO_LEN];
+
+        /* Keys: applied and stored by the app task, which also restores the read-back */
+        if(!MeshAuth_Write(pValue, len))
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Auth write refused (%u bytes)", 0, len);
+        }
+        /* Keys must not stay readable in the attribute: back to the read-back at once */
+        MeshAuth_GetInfo(info);
+        ThreadCfg_SetAuth(info);
+    }
+    else if(handle == THREAD_JOINER_HDL)
+    {
+        /* Start / stop: run by the app task, progress on Thread Status */
+        if(!MeshJoiner_Write(pValue, len))
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Joiner write refused (%u bytes)", 0, len);
+        }
+    }
     else if(handle == THREAD_NET_NAME_HDL   ||
             handle == THREAD_NET_KEY_HDL    ||
             handle == THREAD_CHANNEL_HDL    ||
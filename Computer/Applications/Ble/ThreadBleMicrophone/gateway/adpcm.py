@@ -0,0 +1,87 @@
+"""
+adpcm.py  –  IMA/DVI ADPCM decoder and stream packet parser
+==========================================================
+
+Mirrors ImaAdpcm.c / AudioStream.h in the ThreadBleMicrophone firmware.
+Pure Python (the stdlib audioop module is deprecated and uses the opposite
+nibble order), fast enough for one 7.8 kHz stream on a Raspberry Pi.
+"""
+
+import struct
+from dataclasses import dataclass
+
+MSG_TYPE_AUDIO = 0x04
+
+FLAG_START = 0x01
+FLAG_END = 0x02
+
+HEADER_LEN = 11
+SAMPLES_PER_PACKET = 96
+PACKET_LEN = HEADER_LEN + SAMPLES_PER_PACKET // 2
+SAMPLE_RATE_HZ = 7812  # 1 MHz PDM / 128, 7812.5 Hz rounded for WAV headers
+
+_STEP_TABLE = (
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+)
+_INDEX_TABLE = (-1, -1, -1, -1, 2, 4, 6, 8)
+
+
+@dataclass
+class AudioPacket:
+    flags: int
+    seq: int
+    timestamp: int      # capture sample index of the first sample
+    predictor: int
+    index: int
+    codes: bytes
+
+    @property
+    def is_start(self) -> bool:
+        return bool(self.flags & FLAG_START)
+
+    @property
+    def is_end(self) -> bool:
+        return bool(self.flags & FLAG_END)
+
+
+def parse_packet(data: bytes):
+    """Return an AudioPacket, or None if data is not an audio stream packet."""
+    if len(data) != PACKET_LEN or data[0] != MSG_TYPE_AUDIO:
+        return None
+    _, flags, seq, ts, pred, idx = struct.unpack(">BBHIhB", data[:HEADER_LEN])
+    if idx > len(_STEP_TABLE) - 1:
+        return None
+    return AudioPacket(flags, seq, ts, pred, idx, data[HEADER_LEN:])
+
+
+def decode(codes: bytes, predictor: int, index: int) -> list:
+    """Decode packed 4-bit codes (first sample in the low nibble)."""
+    out = []
+    for byte in codes:
+        for code in (byte & 0x0F, byte >> 4):
+            step = _STEP_TABLE[index]
+            diff = step >> 3
+            if code & 4:
+                diff += step
+            if code & 2:
+                diff += step >> 1
+            if code & 1:
+                diff += step >> 2
+            predictor += -diff if code & 8 else diff
+            predictor = max(-32768, min(32767, predictor))
+            index = max(0, min(88, index + _INDEX_TABLE[code & 7]))
+            out.append(predictor)
+    return out
+
+
+def decode_packet(pkt: AudioPacket) -> list:
+    return decode(pkt.codes, pkt.predictor, pkt.index)
+
@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+"""
+listen_in.py  –  QPG6200 Thread Microphone: Listen-in Receiver
+==============================================================
+
+Runs on the Raspberry Pi gateway (OpenThread Border Router).
+
+Purpose
+-------
+Asks a ThreadBleMicrophone node to stream live audio ("listen-in", e.g.
+after a doorbell ring) and turns the IMA-ADPCM packets back into PCM.
+The audio is written to a WAV file and/or raw to stdout for live playback.
+
+Data flow
+---------
+  this script  ── CoAP NON POST /listen [secs] ──►  mic node, port 5683
+  this script  ◄── 59-byte ADPCM packets ──  mic node (unicast, ~81 pkt/s)
+        │
+        └─► jitter buffer ─► ADPCM decode ─► WAV file / stdout (s16le)
+
+The request payload is one byte, the seconds to stream (0 = stop).  The
+stream goes to the address and port the request came from, so requests
+and stream share one socket.  The request is repeated every REFRESH_SEC so
+the node keeps streaming; the node stops by itself when requests stop
+arriving (MIC_STREAM_MAX_DURATION_S).
+
+Packet format (see AudioStream.h in the firmware)
+-------------------------------------------------
+  Byte 0     : 0x04 = audio stream
+  Byte 1     : flags (0x01 = start, 0x02 = end)
+  Byte 2-3   : sequence number (BE16)
+  Byte 4-7   : timestamp, capture sample index (BE32)
+  Byte 8-9   : ADPCM predictor (BE16 signed)
+  Byte 10    : ADPCM step index
+  Byte 11-58 : 96 ADPCM codes, low nibble first
+
+Jitter buffer
+-------------
+Packets are played out on a fixed 12.288 ms clock once --jitter-ms of audio
+is buffered.  Missing packets are concealed with silence, packets arriving
+after their slot was played are dropped ("late"), and an empty buffer
+triggers re-buffering ("underrun").
+
+Dependencies
+------------
+  Python 3.8+ standard library only (adpcm.py in this directory,
+  mesh_coap.py in shared/gateway).
+
+Usage
+-----
+  python3 listen_in.py --node <mic IPv6> [--seconds N] [--wav out.wav]
+                       [--stdout] [--jitter-ms MS] [--port PORT] [--debug]
+
+  Examples:
+    python3 listen_in.py --node fd11:22::1234 --seconds 20 --wav door.wav
+    python3 listen_in.py --node fd11:22::1234 --stdout | aplay -f S16_LE -r 7812 -c 1
+"""
+
+import argparse
+import logging
+import select
+import signal
+import socket
+import struct
+import sys
+import time
+import wave
+from pathlib import Path
+
+import adpcm
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[2] / "shared" / "gateway"))
+import mesh_coap  # noqa: E402
+
+# ---------------------------------------------------------------------------
+#  Logging (stderr, so stdout can carry audio)
+# ---------------------------------------------------------------------------
+
+logging.basicConfig(
+    level=logging.INFO,
+    format="%(asctime)s [%(levelname)s] %(name)s: %(message)s",
+    datefmt="%Y-%m-%d %H:%M:%S",
+    stream=sys.stderr,
+)
+log = logging.getLogger("listen_in")
+
+# ---------------------------------------------------------------------------
+#  Configuration defaults
+# ---------------------------------------------------------------------------
+
+NODE_PORT          = mesh_coap.PORT   # CoAP server of the mic node (MESH_COAP_PORT)
+LISTEN_URI         = "listen"         # THREAD_LISTEN_URI
+DEFAULT_LOCAL_PORT = 5690     # Port the stream is sent back to
+DEFAULT_JITTER_MS  = 60
+
+# Each request asks for REQUEST_SEC and is refreshed every REFRESH_SEC
+REQUEST_SEC        = 10
+REFRESH_SEC        = 4
+
+STATS_INTERVAL_SEC = 5
+
+PACKET_PERIOD_SEC  = adpcm.SAMPLES_PER_PACKET / 7812.5
+SILENCE            = [0] * adpcm.SAMPLES_PER_PACKET
+
+
+def listen_request(seconds: int) -> bytes:
+    """CoAP POST /listen with the seconds to stream (0 = stop)."""
+    return mesh_coap.encode(mesh_coap.post(LISTEN_URI, bytes((max(0, min(255, seconds)),))))
+
+
+# ---------------------------------------------------------------------------
+#  Jitter buffer
+# ---------------------------------------------------------------------------
+
+class JitterBuffer:
+    """Re-orders packets by sequence number and releases them on a clock."""
+
+    def __init__(self, target_packets: int):
+        self.target = max(1, target_packets)
+        self.packets = {}
+        self.next_seq = None
+        self.playing = False
+        self.ended = False
+        self.stats = dict(received=0, played=0, lost=0, late=0,
+                          duplicate=0, underruns=0)
+
+    def _offset(self, seq: int) -> int:
+        """Signed distance of seq from the next slot to play (16-bit wrap)."""
+        diff = (seq - self.next_seq) & 0xFFFF
+        return diff - 0x10000 if diff >= 0x8000 else diff
+
+    def push(self, pkt: adpcm.AudioPacket) -> None:
+        self.stats["received"] += 1
+
+        if pkt.is_start or self.next_seq is None:
+            if pkt.is_start and self.next_seq is not None:
+                log.info("Stream restarted by node")
+            self.packets.clear()
+            self.next_seq = pkt.seq
+            self.playing = False
+            self.ended = False
+
+        offset = self._offset(pkt.seq)
+        if offset < 0:
+            self.stats["late"] += 1
+            return
+        if pkt.seq in self.packets:
+            self.stats["duplicate"] += 1
+            return
+
+        self.packets[pkt.seq] = pkt
+        if pkt.is_end:
+            self.ended = True
+
+        if not self.playing and (len(self.packets) >= self.target or self.ended):
+            self.playing = True
+
+    def pop(self):
+        """Return one packet period of PCM, or None while (re)buffering."""
+        if not self.playing:
+            return None
+
+        if not self.packets:
+            if not self.ended:
+                self.stats["underruns"] += 1
+                self.playing = False
+            return None
+
+        pkt = self.packets.pop(self.next_seq, None)
+        self.next_seq = (self.next_seq + 1) & 0xFFFF
+
+        if pkt is None:
+            self.stats["lost"] += 1
+            return SILENCE
+
+        self.stats["played"] += 1
+        if pkt.is_end:
+            self.packets.clear()
+            self.playing = False
+        return adpcm.decode_packet(pkt)
+
+    @property
+    def depth(self) -> int:
+        return len(self.packets)
+
+
+# ---------------------------------------------------------------------------
+#  Output sinks
+# ---------------------------------------------------------------------------
+
+class PcmSink:
+    def __init__(self, wav_path, to_stdout: bool):
+        self.wav = None
+        self.stdout = sys.stdout.buffer if to_stdout else None
+        self.samples = 0
+        if wav_path:
+            self.wav = wave.open(wav_path, "wb")
+            self.wav.setnchannels(1)
+            self.wav.setsampwidth(2)
+            self.wav.setframerate(adpcm.SAMPLE_RATE_HZ)
+
+    def write(self, samples: list) -> None:
+        data = struct.pack("<%dh" % len(samples), *samples)
+        self.samples += len(samples)
+        if self.wav:
+            self.wav.writeframes(data)
+        if self.stdout:
+            self.stdout.write(data)
+            self.stdout.flush()
+
+    def close(self) -> None:
+        if self.wav:
+            self.wav.close()
+
+
+# ---------------------------------------------------------------------------
+#  Main loop
+# ---------------------------------------------------------------------------
+
+def _run(args) -> None:
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    sock.bind(("::", args.port))
+    node = (args.node, NODE_PORT)
+
+    jb = JitterBuffer(round(args.jitter_ms / (PACKET_PERIOD_SEC * 1000)))
+    sink = PcmSink(args.wav, args.stdout)
+
+    running = True
+
+    def _shutdown(sig, frame):
+        nonlocal running
+        running = False
+
+    signal.signal(signal.SIGINT, _shutdown)
+    signal.signal(signal.SIGTERM, _shutdown)
+
+    start = time.monotonic()
+    stop_at = start + args.seconds if args.seconds > 0 else None
+    next_request = start
+    next_play = None
+    next_stats = start + STATS_INTERVAL_SEC
+
+    try:
+        while running:
+            now = time.monotonic()
+
+            if stop_at is not None and now >= stop_at:
+                break
+
+            if now >= next_request:
+                sock.sendto(listen_request(REQUEST_SEC), node)
+                log.debug("Listen-in request sent to [%s]:%d", *node)
+                next_request = now + REFRESH_SEC
+
+            # Playout clock: runs only while the buffer is playing
+            if next_play is not None and now >= next_play:
+                pcm = jb.pop()
+                if pcm is None:
+                    next_play = None
+                else:
+                    sink.write(pcm)
+                    next_play += PACKET_PERIOD_SEC
+                    # Do not try to catch up after a stall (e.g. SD card write)
+                    if next_play < now - PACKET_PERIOD_SEC:
+                        next_play = now
+
+            if now >= next_stats:
+                s = jb.stats
+                log.info("rx %d played %d lost %d late %d dup %d underruns %d depth %d",
+                         s["received"], s["played"], s["lost"], s["late"],
+                         s["duplicate"], s["underruns"], jb.depth)
+                next_stats = now + STATS_INTERVAL_SEC
+
+            deadlines = [next_request, next_stats]
+            if next_play is not None:
+                deadlines.append(next_play)
+            if stop_at is not None:
+                deadlines.append(stop_at)
+            timeout = max(0.0, min(deadlines) - time.monotonic())
+
+            ready, _, _ = select.select([sock], [], [], timeout)
+            if ready:
+                data, addr = sock.recvfrom(256)
+                pkt = adpcm.parse_packet(data)
+                if pkt is None:
+                    log.debug("Ignoring %d-byte datagram from %s", len(data), addr[0])
+                    continue
+                jb.push(pkt)
+                if jb.playing and next_play is None:
+                    next_play = time.monotonic()
+    finally:
+        sock.sendto(listen_request(0), node)
+        sink.close()
+        sock.close()
+        s = jb.stats
+        log.info("Stopped: %.1f s of audio, rx %d lost %d late %d underruns %d",
+                 sink.samples / adpcm.SAMPLE_RATE_HZ, s["received"], s["lost"],
+                 s["late"], s["underruns"])
+
+
+def _parse_args():
+    parser = argparse.ArgumentParser(
+        description="Listen-in receiver for the QPG6200 Thread Microphone"
+    )
+    parser.add_argument("--node", required=True,
+                        help="IPv6 address of the microphone node")
+    parser.add_argument("--seconds", type=float, default=0,
+                        help="Stop after this many seconds (default: until Ctrl+C)")
+    parser.add_argument("--wav", default=None,
+                        help="Write decoded audio to this WAV file")
+    parser.add_argument("--stdout", action="store_true",
+                        help="Write raw s16le mono PCM to stdout (pipe into aplay)")
+    parser.add_argument("--jitter-ms", type=int, default=DEFAULT_JITTER_MS,
+                        help=f"Jitter buffer depth (default: {DEFAULT_JITTER_MS} ms)")
+    parser.add_argument("--port", type=int, default=DEFAULT_LOCAL_PORT,
+                        help=f"Local UDP port for the stream (default: {DEFAULT_LOCAL_PORT})")
+    parser.add_argument("--debug", action="store_true",
+                        help="Enable verbose DEBUG logging")
+    args = parser.parse_args()
+    if not args.wav and not args.stdout:
+        parser.error("choose at least one output: --wav and/or --stdout")
+    return args
+
+
+def main() -> None:
+    args = _parse_args()
+
+    if args.debug:
+        logging.getLogger().setLevel(logging.DEBUG)
+
+    log.info("Listening to [%s] (jitter buffer %d ms, local port %d)",
+             args.node, args.jitter_ms, args.port)
+    _run(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ */
+
+// File generated by image_generator.py, manual changes will be overwritten
+
+#ifndef _Q_INFO_PAGE_H_
+#define _Q_INFO_PAGE_H_
+
+typedef struct {
+    UInt8 prog_pin;
+    UInt8 prog_pin_delay;
+    UInt8 debug_diag_timeout;
+    UInt8 prog_mode_timeout;
+    UInt8 mode_ctrl;
+    UInt8 jtag_swd_config;
+    UInt8 reserved1;
+    UInt8 package_id;
+    UInt8 device_attestation;
+    UInt8 reserved2[3];
+    UInt8 mpw;
+    UInt8 reserved3;
+    UInt8 seuc_rram_size_indicator_control;
+    UInt8 seuc_rram_size_indicator;
+} bootloader_configuration_t;
+
+
+typedef struct {
+    UInt8 CP1_magic_words[16];
+    UInt8 CP2_magic_words[16];
+    UInt8 CP3_magic_words[16];
+    UInt8 reserved[80];
+} production_test_data_t;
+
+
+typedef struct {
+    UInt32 magic_word;
+    UInt32 CP1[3];
+    UInt32 CP2[3];
+    UInt32 CP3[3];
+    UInt32 FT[3];
+    UInt32 RETEST1[3];
+    UInt32 RETEST2[3];
+    UInt32 PROG[3];
+    UInt32 IRQA[3];
+    UInt32 RMA[3];
+    UInt32 die_tracking[4];
+} tracking_info_t;
+
+
+typedef struct {
+    UInt8 product_id[12];
+    UInt32 product_version;
+    UInt8 mac_802_15_4[8];
+    UInt8 ble_address[6];
+    UInt8 reserved;
+    UInt8 gp_source_id_count;
+    UInt8 gp_source_id[4];
+    UInt32 crc_address_info;
+    bootloader_configuration_t bootloader;
+    UInt16 product_license_control;
+    UInt16 product_license;
+    UInt32 version_test_program;
+    UInt32 rom_calibration_data[15];
+    UInt32 CRC0;
+} configuration_t;
+
+
+typedef struct {
+    UInt8 nvm_size;
+} license_t;
+
+
+typedef struct {
+    UInt8 error;
+    UInt8 last_chunk_processed;
+    UInt8 reserved[14];
+} provisioning_result_t;
+
+
+typedef struct {
+    UInt32 non_virgin_magic_word;
+    UInt32 rma_test_magic_word;
+    UInt32 retest_magic_word;
+    UInt32 pending_sefw_upgrade_magic_word;
+    UInt32 pending_sefw_upgrade_offset;
+    UInt32 mpw_enable_rom_bootloader_magic_word;
+    UInt32 virgin_mode_appuc_vector_table_offset;
+    UInt32 pending_appuc_upgrade_magic_word;
+    UInt32 pending_appuc_upgrade_offset;
+    UInt32 full_rma_test_magic_word;
+    UInt32 reserved1;
+    UInt32 copy_of_serial_number[4];
+    UInt32 reserved2[13];
+    provisioning_result_t provisioning_result;
+} magic_words_t;
+
+
+typedef struct {
+    UInt32 crc;
+    UInt32 reserved1;
+    UInt8 host_otp_read_lock[4];
+    UInt8 host_otp_write_lock[4];
+    UInt8 rram_read_lock[8];
+    UInt8 rram_write_lock[8];
+    UInt8 reserved2[96];
+} programmer_locks_t;
+
+
+typedef struct {
+    UInt8 data[1020];
+    UInt32 crc;
+} calibration_data_t;
+
+
+typedef struct {
+    UInt8 data[252];
+    UInt32 crc;
+} excess_calibration_data_t;
+
+
+typedef struct {
+    UInt32 crc;
+    UInt8 reserved1[12];
+    UInt8 mac_802_15_4[8];
+    UInt8 ble_address[8];
+    UInt8 gp_source_id[8];
+    UInt8 reserved2[88];
+} alt_addresses_t;
+
+
+typedef struct {
+    magic_words_t magic_words;
+    production_test_data_t production_test_data;
+    tracking_info_t tracking_info;
+    configuration_t configuration;
+    calibration_data_t calibration_data;
+    excess_calibration_data_t reserved;
+    programmer_locks_t programmer_locks;
+    alt_addresses_t alt_addresses;
+    UInt8 factory_data[2048];
+} info_page_t;
+
+
+
+#endif //_Q_INFO_PAGE_H_
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "AppEvent.h"
+ *
+ * Application event types for the QPG6200 Thread+BLE Microphone.
+ *
+ * Event sources:
+ *   - Buttons     : digital PB5 press/hold/release (commissioning)
+ *   - BleConn     : BLE stack events (advertising, connect, characteristic writes)
+ *   - Sound       : classified sound event from the MicManager capture task
+ *   - Stream      : listen-in request from the gateway / stream packets ready
+ *   - Power       : MicManager entered or left low-power listening
+ *   - Thread      : OpenThread network events (joined, detached, etc.)
+ */
+
+#ifndef _APPEVENT_H_
+#define _APPEVENT_H_
+
+#include "AppButtons.h"
+#include "BleIf.h"
+
+/* -------------------------------------------------------------------------
+ * Sound event (from SoundDetector via MicManager)
+ * ------------------------------------------------------------------------- */
+typedef struct
+{
+    uint8_t  ClassId;       /**< SOUND_CLASS_* (SoundDetector.h) */
+    int8_t   LevelDb;       /**< Peak level, dBFS */
+    uint32_t TimestampMs;   /**< Event onset, ms since boot */
+} SoundEvent_t;
+
+/* -------------------------------------------------------------------------
+ * Listen-in stream event
+ * ------------------------------------------------------------------------- */
+typedef enum
+{
+    kStreamAction_Request     = 0,  /**< Gateway asked to start/extend/stop streaming */
+    kStreamAction_PacketReady = 1,  /**< Capture task queued encoded packets */
+} StreamAction_t;
+
+typedef struct
+{
+    StreamAction_t Action;
+    uint8_t        DurationSec; /**< Request: seconds to stream, 0 = stop */
+    uint16_t       PeerPort;    /**< Request: UDP port to stream to */
+    uint8_t        PeerAddr[16];/**< Request: IPv6 address to stream to */
+} StreamEvent_t;
+
+/* -------------------------------------------------------------------------
+ * Power mode event (from MicManager)
+ * ------------------------------------------------------------------------- */
+typedef struct
+{
+    bool LowPower;      /**< true: low-power listening, false: full-rate capture */
+} PowerEvent_t;
+
+/* -------------------------------------------------------------------------
+ * Thread network event
+ * ------------------------------------------------------------------------- */
+typedef enum
+{
+    kThreadEvent_Joined       = 0,  /**< Successfully attached to a Thread network */
+    kThreadEvent_Detached     = 1,  /**< Left / lost the Thread network */
+    kThreadEvent_Error        = 3,  /**< Generic Thread stack error */
+    kThreadEvent_TimeSync     = 4,  /**< Mesh time exchange due (MeshTimeSync timer) */
+    kThreadEvent_Coap         = 5,  /**< MeshCoap send due (timer / response) */
+    kThreadEvent_Diag         = 6,  /**< MeshDiag snapshot due (timer / topology change) */
+    kThreadEvent_Dataset      = 7,  /**< MeshDataset: written dataset ready to apply */
+    kThreadEvent_Channel      = 8,  /**< MeshChannel: survey sweep done / leader survey due (1 = start) */
+    kThreadEvent_Auth         = 9,  /**< MeshAuth: key write ready to apply */
+    kThreadEvent_TxPower      = 10,  /**< MeshTxPower: evaluation window over / topology change */
+    kThreadEvent_Recovery     = 11,  /**< MeshRecovery: attach restart due while detached */
+    kThreadEvent_Joiner       = 12,  /**< MeshJoiner: write / joiner result / retry due */
+} ThreadEventType_t;
+
+typedef struct
+{
+    ThreadEventType_t Event;
+    uint32_t          Value;    /**< Event-specific data (e.g. error code) */
+} ThreadEvent_t;
+
+/* -------------------------------------------------------------------------
+ * Unified AppEvent
+ * ------------------------------------------------------------------------- */
+typedef enum { kActor_App = 0, kActor_Invalid = 255 } Actor_t;
+
+struct AppEvent;
+typedef void (*EventHandler)(AppEvent*);
+
+struct AppEvent
+{
+    enum AppEventTypes
+    {
+        kEventType_Buttons       = 0,
+        kEventType_BleConnection = 1,
+        kEventType_Sound         = 2,   /**< Classified sound event */
+        kEventType_Thread        = 3,   /**< OpenThread mesh event */
+        kEventType_Stream        = 4,   /**< Listen-in audio stream */
+        kEventType_Power         = 5,   /**< Microphone power mode change */
+        kEventType_Invalid       = 255
+    };
+
+    AppEventTypes Type;
+
+    union
+    {
+        /* Digital button event (PB5 commissioning button) */
+        ButtonEvent_t ButtonEvent;
+
+        /* BLE connection/advertising/characteristic event */
+        Ble_Event_t BleConnectionEvent;
+
+        /* Sound event */
+        SoundEvent_t SoundEvent;
+
+        /* Thread network event */
+        ThreadEvent_t ThreadEvent;
+
+        /* Listen-in stream event */
+        StreamEvent_t StreamEvent;
+
+        /* Power mode event */
+        PowerEvent_t PowerEvent;
+    };
+
+    EventHandler Handler;
+};
+
+#endif /* _APPEVENT_H_ */
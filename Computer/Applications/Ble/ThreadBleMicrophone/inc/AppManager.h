@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "AppManager.h"
+ *
+ * Application manager for the QPG6200 Thread+BLE Microphone.
+ *
+ * Responsibilities:
+ *   - BLE stack initialisation and event handling
+ *   - Thread network commissioning (credentials stored in NVM)
+ *   - Sound event reporting (LED + BLE notification + Thread multicast)
+ *   - Listen-in audio stream to the requesting gateway (Thread unicast)
+ *   - Sleep control for the microphone's low-power listening
+ *   - LED state machine
+ */
+
+#ifndef _APPMANAGER_H_
+#define _APPMANAGER_H_
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "AppEvent.h"
+#include "AppButtons.h"
+
+class AppManager
+{
+public:
+    void Init();
+    void EventHandler(AppEvent* aEvent);
+
+    /* Called by the MicManager capture task when a sound event is classified */
+    static void NotifySoundEvent(uint8_t classId, int8_t levelDb, uint32_t timestampMs);
+
+    /* Called by the MicManager capture task when stream packets are queued */
+    static void NotifyStreamPacket(void);
+
+    /* Called by the MicManager capture task when it changes power mode */
+    static void NotifyPowerMode(bool lowPower);
+
+    /* Called by Thread task when a network event occurs */
+    static void NotifyThreadEvent(ThreadEventType_t event, uint32_t value);
+
+private:
+    friend AppManager& GetAppMgr(void);
+
+    void BleEventHandler(AppEvent* aEvent);
+    void ButtonEventHandler(AppEvent* aEvent);
+    void SoundEventHandler(AppEvent* aEvent);
+    void ThreadEventHandler(AppEvent* aEvent);
+    void StreamEventHandler(AppEvent* aEvent);
+    void PowerEventHandler(AppEvent* aEvent);
+
+
+    static AppManager sAppMgr;
+};
+
+inline AppManager& GetAppMgr(void)
+{
+    return AppManager::sAppMgr;
+}
+
+#endif /* _APPMANAGER_H_ */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+/** @file "AudioStream.h"
+ *
+ * Packetiser for the "listen-in" audio stream.
+ *
+ * PCM from the capture task is IMA-ADPCM encoded into fixed-size packets
+ * that fit a single IEEE 802.15.4 frame after 6LoWPAN compression, so the
+ * mesh never has to fragment them:
+ *
+ *   127  PHY payload
+ *   - 15 MAC header, short addresses + FCS
+ *   - 10 MAC security (aux header 6 + MIC 4)
+ *   -  5 6LoWPAN mesh header (multi-hop)
+ *   - 31 IPHC with inline 128-bit destination + UDP NHC
+ *   = 66 bytes left for the application, packet below is 59 bytes.
+ *
+ * Packet layout (multi-byte fields big-endian, like the event messages):
+ *   Byte 0     : 0x04 = audio stream
+ *   Byte 1     : flags (AUDIO_STREAM_FLAG_*)
+ *   Byte 2-3   : sequence number, +1 per packet, wraps
+ *   Byte 4-7   : timestamp, capture sample index of the first sample
+ *   Byte 8-9   : ADPCM predictor before the first sample (int16)
+ *   Byte 10    : ADPCM step index before the first sample
+ *   Byte 11-58 : 96 ADPCM codes, first sample in the low nibble
+ *
+ * The producer (capture task) and the consumer (AppTask, which owns the
+ * OpenThread socket) hand packets over through a single-producer /
+ * single-consumer ring: only the producer moves head and only the consumer
+ * moves tail, so no lock is needed.  The consumer drains everything queued
+ * on each notification, so a lost event cannot strand a packet.
+ *
+ * This module has no SDK dependencies so it can be built and checked on a host.
+ */
+
+#ifndef _AUDIO_STREAM_H_
+#define _AUDIO_STREAM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ImaAdpcm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Message type of an audio packet on the Thread UDP port */
+#define AUDIO_STREAM_MSG_TYPE            0x04
+
+/** First packet of a stream: gateway resets its jitter buffer */
+#define AUDIO_STREAM_FLAG_START          0x01
+/** Last packet of a stream */
+#define AUDIO_STREAM_FLAG_END            0x02
+
+#define AUDIO_STREAM_HEADER_LEN          11
+#define AUDIO_STREAM_SAMPLES_PER_PACKET  96     /**< 12.3 ms at 7.8125 kHz */
+#define AUDIO_STREAM_PACKET_LEN          (AUDIO_STREAM_HEADER_LEN + AUDIO_STREAM_SAMPLES_PER_PACKET / 2)
+
+/** Packets that can wait for the AppTask (~49 ms of audio), power of two */
+#define AUDIO_STREAM_NUM_SLOTS           4
+
+typedef struct
+{
+    uint8_t          ring[AUDIO_STREAM_NUM_SLOTS][AUDIO_STREAM_PACKET_LEN];
+    uint8_t          spare[AUDIO_STREAM_PACKET_LEN]; /**< Absorbs audio while the ring is full */
+    volatile uint8_t head;          /**< Next slot to fill, producer only */
+    volatile uint8_t tail;          /**< Oldest queued slot, consumer only */
+    ImaAdpcm_State_t encoder;
+    uint16_t         sequence;
+    uint8_t          nextFlags;     /**< Flags for the packet being filled */
+    uint8_t          fill;          /**< Samples in the packet being filled */
+    bool             toSpare;       /**< Packet being filled will be dropped */
+    uint32_t         packets;       /**< Packets queued for the consumer */
+    uint32_t         dropped;       /**< Packets lost because the ring was full */
+} AudioStream_t;
+
+/** @brief Reset the stream state and release all slots. */
+void AudioStream_Init(AudioStream_t* pStream);
+
+/** @brief Start a new stream: sequence 0, fresh encoder, START flag, counters cleared. */
+void AudioStream_Begin(AudioStream_t* pStream);
+
+/** @brief Set or clear the END flag of the packet being filled. */
+void AudioStream_SetLast(AudioStream_t* pStream, bool last);
+
+/** @brief Encode PCM into the current packet (producer).
+ *
+ *  @param pStream      Stream state
+ *  @param pPcm         Input samples
+ *  @param numSamples   Number of samples; must divide AUDIO_STREAM_SAMPLES_PER_PACKET
+ *  @param sampleIndex  Capture sample index of pPcm[0]
+ *  @return true when this call completed a packet (queued or dropped)
+ */
+bool AudioStream_Write(AudioStream_t* pStream, const int16_t* pPcm, uint16_t numSamples,
+                       uint32_t sampleIndex);
+
+/** @brief Oldest queued packet (consumer).
+ *  @return AUDIO_STREAM_PACKET_LEN bytes, or NULL when the ring is empty.
+ */
+const uint8_t* AudioStream_Peek(const AudioStream_t* pStream);
+
+/** @brief Release the packet returned by AudioStream_Peek() (consumer). */
+void AudioStream_Pop(AudioStream_t* pStream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AUDIO_STREAM_H_ */
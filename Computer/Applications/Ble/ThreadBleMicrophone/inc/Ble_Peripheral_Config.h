@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * Shim header required by BleIf.c, which hard-codes the include name
+ * "Ble_Peripheral_Config.h".  Forward everything to the actual config
+ * header for this application.
+ */
+
+#ifndef _BLE_PERIPHERAL_CONFIG_H_
+#define _BLE_PERIPHERAL_CONFIG_H_
+
+#include "ThreadBleMicrophone_Config.h"
+
+#endif /* _BLE_PERIPHERAL_CONFIG_H_ */
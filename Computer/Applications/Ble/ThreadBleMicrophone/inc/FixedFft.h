@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "FixedFft.h"
+ *
+ * Small in-place radix-2 complex FFT on Q15 data.
+ *
+ * Each butterfly stage scales by 1/2, so an N-point transform returns X/N.
+ * For real input (or complex input below 1/sqrt(2) of full scale) no
+ * stage can overflow.  Full-scale complex input can: a rotated value
+ * reaches |x| * sqrt(2), so the butterfly outputs saturate to Q15 rather
+ * than wrap.  Twiddles come from a 65-entry quarter-wave sine table, which
+ * supports transforms up to 256 points.
+ *
+ * No SDK dependencies (host-buildable).
+ */
+
+#ifndef _FIXED_FFT_H_
+#define _FIXED_FFT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Largest supported transform: 2^8 = 256 points */
+#define FIXED_FFT_MAX_LOG2  8
+
+/** @brief sin(2 * pi * phase / 256) in Q15.
+ *  @param phase Angle in 1/256 turns (wraps naturally at 256)
+ */
+int16_t FixedFft_SinQ15(uint8_t phase);
+
+/** @brief In-place forward FFT, output scaled by 1/N.
+ *  @param pRe   Real parts, N entries
+ *  @param pIm   Imaginary parts, N entries (zero for real input)
+ *  @param log2N Transform size as a power of two (1..FIXED_FFT_MAX_LOG2)
+ */
+void FixedFft_Forward(int16_t* pRe, int16_t* pIm, uint8_t log2N);
+
+/** @brief |X|^2 of one bin (fits in 31 bits). */
+static inline uint32_t FixedFft_MagSq(int16_t re, int16_t im)
+{
+    return (uint32_t)((int32_t)re * re) + (uint32_t)((int32_t)im * im);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FIXED_FFT_H_ */
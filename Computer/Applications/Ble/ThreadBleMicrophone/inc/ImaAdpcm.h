@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+/** @file "ImaAdpcm.h"
+ *
+ * IMA/DVI ADPCM codec (4 bits per sample, 4:1 against 16-bit PCM).
+ *
+ * Used to stream microphone audio over Thread: 7.8 kHz PCM becomes
+ * 31.25 kbit/s instead of 125 kbit/s.  Encoding costs a handful of integer
+ * operations per sample (no multiplies, no tables beyond 89 step sizes).
+ *
+ * The state (predictor + step index) is carried in every stream packet so
+ * each packet decodes on its own and a lost packet does not corrupt the
+ * following ones.
+ *
+ * This module has no SDK dependencies so it can be built and checked on a host.
+ */
+
+#ifndef _IMA_ADPCM_H_
+#define _IMA_ADPCM_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Highest valid step index */
+#define IMA_ADPCM_MAX_INDEX  88
+
+typedef struct
+{
+    int16_t predictor;  /**< Last reconstructed sample */
+    uint8_t index;      /**< Step size index, 0..IMA_ADPCM_MAX_INDEX */
+} ImaAdpcm_State_t;
+
+/** @brief Reset the state to silence with the smallest step. */
+void ImaAdpcm_Init(ImaAdpcm_State_t* pState);
+
+/** @brief Encode PCM to packed 4-bit codes, first sample in the low nibble.
+ *
+ *  @param pState      Encoder state, updated
+ *  @param pPcm        Input samples
+ *  @param numSamples  Number of samples (must be even)
+ *  @param pOut        Output, numSamples / 2 bytes
+ */
+void ImaAdpcm_Encode(ImaAdpcm_State_t* pState, const int16_t* pPcm, uint16_t numSamples,
+                     uint8_t* pOut);
+
+/** @brief Decode packed 4-bit codes produced by ImaAdpcm_Encode().
+ *
+ *  @param pState      Decoder state, updated
+ *  @param pIn         Packed codes, numSamples / 2 bytes
+ *  @param numSamples  Number of samples (must be even)
+ *  @param pPcm        Output samples
+ */
+void ImaAdpcm_Decode(ImaAdpcm_State_t* pState, const uint8_t* pIn, uint16_t numSamples,
+                     int16_t* pPcm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IMA_ADPCM_H_ */
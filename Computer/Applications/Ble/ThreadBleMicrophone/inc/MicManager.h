@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MicManager.h"
+ *
+ * PDM microphone manager for the QPG6200 Thread+BLE Microphone.
+ *
+ * Hardware:
+ *   SPG08P4HM4H-1 PDM MEMS microphone on I2S_0 (see qPinCfg.h)
+ *
+ * Operation:
+ *   The manager runs a FreeRTOS capture task fed by PdmCapture (I2S DMA
+ *   ping-pong).  Each 512-byte DMA half is decimated to 32 PCM samples
+ *   (PdmDecimator); every 128 samples form one SoundDetector frame.
+ *
+ *   When the detector classifies an event it calls
+ *   AppManager::NotifySoundEvent() which posts a kEventType_Sound event to
+ *   the main AppTask queue.
+ *
+ *   Raw audio only leaves the device on request ("listen-in"): while a
+ *   stream is active the PCM is also IMA-ADPCM encoded by AudioStream and
+ *   AppManager::NotifyStreamPacket() tells the AppTask to send the queued
+ *   packets.  Detection keeps running while streaming.
+ *
+ *   Low-power listening: while the room is quiet the PDM clock is halved
+ *   and only VoiceActivity runs.  Mode changes are reported with
+ *   AppManager::NotifyPowerMode() so the AppTask can enable sleep.
+ */
+
+#ifndef _MIC_MANAGER_H_
+#define _MIC_MANAGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+
+/* --- Configurable timing ------------------------------------------------- */
+
+/** Interval between capture statistics log lines, in milliseconds (0 = off). */
+#ifndef MIC_STATS_INTERVAL_MS
+#define MIC_STATS_INTERVAL_MS   10000
+#endif
+
+/** Longest listen-in request accepted, seconds.  The gateway re-sends the
+ *  request to keep listening, so a lost stop command cannot leave the
+ *  stream running for long. */
+#ifndef MIC_STREAM_MAX_DURATION_S
+#define MIC_STREAM_MAX_DURATION_S 60
+#endif
+
+/** Low-power listening when quiet (0 = always capture at full rate). */
+#ifndef MIC_LOW_POWER_LISTEN
+#define MIC_LOW_POWER_LISTEN    1
+#endif
+
+/** Quiet time at full rate before returning to low-power listening, ms.
+ *  Covers the gaps of a knock-knock-knock or a conversation. */
+#ifndef MIC_ACTIVE_HOLD_MS
+#define MIC_ACTIVE_HOLD_MS      3000
+#endif
+
+/** Frame level above the detector background that counts as activity, dB */
+#ifndef MIC_ACTIVE_MARGIN_DB
+#define MIC_ACTIVE_MARGIN_DB    6
+#endif
+
+/* --- Public class -------------------------------------------------------- */
+
+class MicManager
+{
+public:
+    /**
+     * Configure the I2S pins and initialise DMA capture and the detector.
+     * Must be called once from AppTask::Init().
+     * @return true on success, false on driver error.
+     */
+    static bool Init(void);
+
+    /**
+     * Start the capture FreeRTOS task.
+     * Call after Init() and after the FreeRTOS scheduler has started.
+     */
+    static void StartCapture(void);
+
+    /** @return Number of frames processed by the detector since boot. */
+    static uint32_t GetFrameCount(void);
+
+    /** @return true while in low-power listening (reduced PDM clock, VAD only). */
+    static bool IsLowPower(void);
+
+    /**
+     * Start, extend or stop the listen-in stream (AppTask context).
+     * @param durationSec Seconds to stream from now, 0 stops after the
+     *                    current packet.  Clamped to MIC_STREAM_MAX_DURATION_S.
+     */
+    static void RequestStream(uint8_t durationSec);
+
+    /** @return Oldest encoded stream packet (AUDIO_STREAM_PACKET_LEN bytes) or nullptr. */
+    static const uint8_t* PeekStreamPacket(void);
+
+    /** Release the packet returned by PeekStreamPacket(). */
+    static void PopStreamPacket(void);
+
+private:
+    static void CaptureTask(void* pvParameters);
+    static void StreamBlock(const int16_t* pPcm, uint16_t numSamples);
+    static bool ProcessFullRate(const uint8_t* pBlock);
+    static void SetLowPower(bool lowPower);
+
+    static uint32_t sFrameCount;
+    static uint32_t sEventCount;
+    static uint32_t sSampleCount;
+    static uint32_t sWakeCount;
+    static bool     sLowPower;
+};
+
+#endif /* __cplusplus */
+
+#endif /* _MIC_MANAGER_H_ */
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "PdmDecimator.h"
+ *
+ * Fixed-point PDM to PCM conversion for the SPG08P4HM4H-1 microphone.
+ *
+ * Two decimation stages, both integer-only:
+ *   1. Order-1 CIC, R = 16 : popcount of each 16-bit I2S word (62.5 kHz, range -8..8)
+ *   2. Order-3 CIC, R = 8  : integrators at 62.5 kHz, combs at 7.8125 kHz
+ * followed by a one-pole DC blocker.  Output is signed 16-bit PCM.
+ *
+ * This module has no SDK dependencies so it can be built and checked on a host.
+ */
+
+#ifndef _PDM_DECIMATOR_H_
+#define _PDM_DECIMATOR_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** PDM bit clock produced by I2S_0 (prescaler 31) */
+#define PDM_DECIMATOR_PDM_CLOCK_HZ   1000000UL
+
+/** Second-stage decimation ratio (16-bit words per PCM sample) */
+#define PDM_DECIMATOR_WORDS_PER_PCM  8
+
+/** Output PCM rate: 1 MHz / 16 / 8 = 7812.5 Hz (rounded down) */
+#define PDM_DECIMATOR_PCM_RATE_HZ    (PDM_DECIMATOR_PDM_CLOCK_HZ / 16 / PDM_DECIMATOR_WORDS_PER_PCM)
+
+/** Number of CIC stages in the second decimator */
+#define PDM_DECIMATOR_CIC_ORDER      3
+
+typedef struct
+{
+    uint32_t integrator[PDM_DECIMATOR_CIC_ORDER];  /**< Unsigned: wraps by design */
+    uint32_t comb[PDM_DECIMATOR_CIC_ORDER];
+    uint8_t  phase;        /**< Words accumulated towards the next PCM sample */
+    int32_t  dcPrevIn;     /**< DC blocker state: previous input */
+    int32_t  dcPrevOut;    /**< DC blocker state: previous output */
+} PdmDecimator_t;
+
+/** @brief Reset all filter state. */
+void PdmDecimator_Init(PdmDecimator_t* pDec);
+
+/** @brief Convert a block of raw I2S bytes (16-bit little-endian words) to PCM.
+ *
+ *  @param pDec      Decimator state
+ *  @param pPdm      Raw PDM bytes as captured by the I2S DMA
+ *  @param numBytes  Number of bytes in pPdm (must be even)
+ *  @param pPcm      Output buffer, at least numBytes / 16 samples
+ *  @return Number of PCM samples written
+ */
+uint16_t PdmDecimator_Process(PdmDecimator_t* pDec, const uint8_t* pPdm, uint16_t numBytes,
+                              int16_t* pPcm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PDM_DECIMATOR_H_ */
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "SoundDetector.h"
+ *
+ * Low-cost acoustic event detector for the Thread+BLE microphone node.
+ *
+ * Works on 128-sample PCM frames (16.4 ms at 7.8125 kHz):
+ *   - frame RMS level in dBFS
+ *   - four band energies from a 128-point fixed-point FFT (Hann window)
+ *   - onset detection: frame level rising above a tracked background
+ *
+ * An event is classified at the latest SOUND_DETECTOR_DECISION_FRAMES after
+ * its onset (~82 ms), against an ordered table of class rules.  The first
+ * rule that matches wins.  Only the classification result is reported; the
+ * detector never needs raw audio to leave the node.
+ *
+ * No SDK dependencies (host-buildable).
+ */
+
+#ifndef _SOUND_DETECTOR_H_
+#define _SOUND_DETECTOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+ * Frame geometry
+ * ------------------------------------------------------------------------- */
+#define SOUND_DETECTOR_FFT_LOG2          7
+#define SOUND_DETECTOR_FRAME_LEN         (1U << SOUND_DETECTOR_FFT_LOG2)
+#define SOUND_DETECTOR_FRAME_US          16384   /**< 128 samples at 7812.5 Hz */
+
+/* -------------------------------------------------------------------------
+ * Bands (FFT bin spacing is 61 Hz)
+ *   LOW  :   61 -  488 Hz  (bins  1..8)   knocks, thumps, door slams
+ *   MID  :  549 - 1465 Hz  (bins  9..24)  voice, barking
+ *   HIGH : 1526 - 2991 Hz  (bins 25..49)  shatter, alarms
+ *   TOP  : 3052 - 3845 Hz  (bins 50..63)  glass break "tinkle"
+ * ------------------------------------------------------------------------- */
+#define SOUND_DETECTOR_NUM_BANDS         4
+#define SOUND_BAND_LOW                   0
+#define SOUND_BAND_MID                   1
+#define SOUND_BAND_HIGH                  2
+#define SOUND_BAND_TOP                   3
+
+#define SOUND_BAND_MASK(band)            ((uint8_t)(1U << (band)))
+#define SOUND_BAND_MASK_ANY              0x0F
+
+/* -------------------------------------------------------------------------
+ * Event classes (class id 0 is reserved for "no event")
+ * ------------------------------------------------------------------------- */
+#define SOUND_CLASS_NONE                 0x00
+#define SOUND_CLASS_KNOCK                0x01
+#define SOUND_CLASS_GLASS_BREAK          0x02
+#define SOUND_CLASS_LOUD_NOISE           0x03
+
+/* -------------------------------------------------------------------------
+ * Detector tuning
+ * ------------------------------------------------------------------------- */
+/** Minimum rise over background (dB) that starts an event */
+#ifndef SOUND_DETECTOR_ONSET_DB
+#define SOUND_DETECTOR_ONSET_DB          9
+#endif
+
+/** Frames after onset at which an ongoing event is classified (5 = 82 ms) */
+#ifndef SOUND_DETECTOR_DECISION_FRAMES
+#define SOUND_DETECTOR_DECISION_FRAMES   5
+#endif
+
+/** Minimum frames between two events (8 = 131 ms, allows knock-knock) */
+#ifndef SOUND_DETECTOR_REFRACTORY_FRAMES
+#define SOUND_DETECTOR_REFRACTORY_FRAMES 8
+#endif
+
+/** Level reported for digital silence */
+#define SOUND_DETECTOR_FLOOR_DB          (-100)
+
+/** One classification rule.  All conditions must hold for a match. */
+typedef struct
+{
+    uint8_t classId;    /**< SOUND_CLASS_* reported on match */
+    int8_t  minPeakDb;  /**< Peak frame level, dBFS */
+    uint8_t minRiseDb;  /**< Peak level above background, dB */
+    uint8_t bandMask;   /**< Allowed dominant bands (SOUND_BAND_MASK) */
+    uint8_t maxFrames;  /**< Event must end within this many frames; 0 = any */
+} SoundDetector_ClassRule_t;
+
+/** Per-frame features, kept for diagnostics */
+typedef struct
+{
+    int16_t rmsDbQ8;                               /**< Frame level, dBFS in Q8 */
+    int16_t bandDbQ8[SOUND_DETECTOR_NUM_BANDS];    /**< Band levels, dBFS in Q8 */
+    int16_t backgroundDbQ8;                        /**< Tracked background, dBFS in Q8 */
+    bool    onset;                                 /**< Event started on this frame */
+} SoundDetector_Features_t;
+
+/** Classified event */
+typedef struct
+{
+    uint8_t classId;        /**< SOUND_CLASS_* */
+    int8_t  levelDb;        /**< Peak frame level, dBFS */
+    uint8_t riseDb;         /**< Peak level above background, dB */
+    uint8_t dominantBand;   /**< SOUND_BAND_* with the highest peak energy */
+    uint8_t durationFrames; /**< Frames above the release threshold */
+    uint8_t latencyFrames;  /**< Frames between onset and classification */
+} SoundDetector_Event_t;
+
+/** Built-in rules: knock, glass break, loud noise (in that priority) */
+extern const SoundDetector_ClassRule_t SoundDetector_DefaultRules[];
+extern const uint8_t                   SoundDetector_NumDefaultRules;
+
+/** @brief Reset detector state and install a rule table.
+ *  @param pRules   Ordered rules (must stay valid while the detector runs)
+ *  @param numRules Number of entries in pRules
+ */
+void SoundDetector_Init(const SoundDetector_ClassRule_t* pRules, uint8_t numRules);
+
+/** @brief Analyse one frame of SOUND_DETECTOR_FRAME_LEN PCM samples.
+ *  @param pFrame PCM samples (not modified)
+ *  @param pEvent Filled in when an event is classified
+ *  @return true if pEvent holds a new event
+ */
+bool SoundDetector_ProcessFrame(const int16_t* pFrame, SoundDetector_Event_t* pEvent);
+
+/** @brief Features of the most recently processed frame. */
+const SoundDetector_Features_t* SoundDetector_GetFeatures(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SOUND_DETECTOR_H_ */
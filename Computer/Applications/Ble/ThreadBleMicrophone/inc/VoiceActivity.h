@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "VoiceActivity.h"
+ *
+ * Cheap activity detector that runs on the raw PDM stream while the node is
+ * idle, so the full decimator and SoundDetector only run when there is
+ * something to hear.
+ *
+ * Per DMA block:
+ *   - coarse PCM: popcount per 16-bit word, order-2 CIC over 4 words
+ *     (7.8 kHz at the 500 kHz idle clock), DC removed
+ *   - mean energy per sample and zero-crossing rate
+ *   - noise floor: follows quieter blocks quickly, louder ones slowly
+ *
+ * A block is active when its energy is VOICE_ACTIVITY_LOUD_SHIFT above the
+ * floor, or VOICE_ACTIVITY_ONSET_SHIFT above it with a zero-crossing rate in
+ * the voice / impact range for VOICE_ACTIVITY_TRIGGER_BLOCKS blocks in a row.
+ * Thresholds are energy ratios as shifts: 2 = x4 = +6 dB.
+ *
+ * No SDK dependencies (host-buildable).
+ */
+
+#ifndef _VOICE_ACTIVITY_H_
+#define _VOICE_ACTIVITY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+ * Tuning
+ * ------------------------------------------------------------------------- */
+/** Energy above the floor that, with a plausible zero-crossing rate, counts as activity */
+#ifndef VOICE_ACTIVITY_ONSET_SHIFT
+#define VOICE_ACTIVITY_ONSET_SHIFT      2
+#endif
+
+/** Energy above the floor that counts as activity on its own (+12 dB) */
+#ifndef VOICE_ACTIVITY_LOUD_SHIFT
+#define VOICE_ACTIVITY_LOUD_SHIFT       4
+#endif
+
+/** Consecutive onset blocks needed (loud blocks trigger at once) */
+#ifndef VOICE_ACTIVITY_TRIGGER_BLOCKS
+#define VOICE_ACTIVITY_TRIGGER_BLOCKS   2
+#endif
+
+/** Zero-crossing band, Hz: below is drift and rumble, above is hiss */
+#ifndef VOICE_ACTIVITY_ZC_MIN_HZ
+#define VOICE_ACTIVITY_ZC_MIN_HZ        60
+#endif
+#ifndef VOICE_ACTIVITY_ZC_MAX_HZ
+#define VOICE_ACTIVITY_ZC_MAX_HZ        1500
+#endif
+
+/** Blocks after Init that only train the floor (~260 ms at 500 kHz) */
+#define VOICE_ACTIVITY_WARMUP_BLOCKS    32
+
+/** Blocks after Rearm, enough for the DC tracker to settle (~33 ms) */
+#define VOICE_ACTIVITY_REARM_BLOCKS     4
+
+/** Energies are mean squares per coarse sample in Q4, so the slow floor
+ *  rise still has resolution at the lowest floor */
+#define VOICE_ACTIVITY_ENERGY_FRAC      4
+
+/** Lowest floor, about -48 dBFS */
+#define VOICE_ACTIVITY_MIN_FLOOR        2
+
+/** Coarse CIC: 16-bit words per coarse sample and order */
+#define VOICE_ACTIVITY_WORDS_PER_SAMPLE 4
+#define VOICE_ACTIVITY_CIC_ORDER        2
+
+typedef struct
+{
+    /* Coarse decimator */
+    uint32_t integrator[VOICE_ACTIVITY_CIC_ORDER];
+    uint32_t comb[VOICE_ACTIVITY_CIC_ORDER];
+    uint8_t  phase;
+    int32_t  dcQ8;              /**< Tracked DC of the coarse samples, Q8 */
+    bool     positive;          /**< Sign of the last sample outside the dead band */
+    int32_t  deadBand;          /**< Zero-crossing hysteresis, noise floor RMS */
+
+    /* Decision */
+    uint32_t sampleRateHz;      /**< Coarse sample rate */
+    uint32_t floor;             /**< Noise floor, mean energy per sample, Q4 */
+    uint32_t energy;            /**< Last block, mean energy per sample, Q4 */
+    uint16_t zeroCrossHz;       /**< Last block, zero crossings converted to Hz */
+    uint8_t  onsetRun;          /**< Consecutive onset blocks */
+    uint8_t  warmup;            /**< Floor training blocks left */
+    bool     active;            /**< Last block was active */
+
+    /* Statistics */
+    uint32_t blocks;
+    uint32_t triggers;          /**< Inactive to active transitions */
+} VoiceActivity_t;
+
+/** @brief Reset all state and start training the noise floor.
+ *  @param pdmClockHz PDM bit clock the stream is captured at
+ */
+void VoiceActivity_Init(VoiceActivity_t* pVad, uint32_t pdmClockHz);
+
+/** @brief Settle again after a gap in the stream (e.g. a clock change).
+ *  The noise floor is kept; only VOICE_ACTIVITY_REARM_BLOCKS are not judged. */
+void VoiceActivity_Rearm(VoiceActivity_t* pVad);
+
+/** @brief Analyse one block of raw I2S bytes (16-bit little-endian words).
+ *  @return true if the block is active
+ */
+bool VoiceActivity_Process(VoiceActivity_t* pVad, const uint8_t* pPdm, uint16_t numBytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VOICE_ACTIVITY_H_ */
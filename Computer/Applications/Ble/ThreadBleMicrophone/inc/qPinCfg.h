@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "qPinCfg.h"
+ *
+ * GPIO / Peripheral pin definitions for the QPG6200 Thread+BLE Microphone.
+ *
+ * Board: QPG6200L Development Kit (QPG6200L DK) + SPG08P4HM4H-1 PDM microphone.
+ *
+ * PDM microphone on I2S_0 (Master RX, configured by qDrvI2S_PinConfigSet()):
+ *   GPIO 3 - I2S SCK  -> mic CLK  (~1 MHz)
+ *   GPIO 5 - I2S SDI  <- mic DATA
+ *   GPIO 2 - I2S WS   -> mic L/R SELECT
+ *   PB1 (GPIO 3) and PB2 (GPIO 5) share these pins and cannot be used.
+ *
+ * Button (commissioning / factory-reset):
+ *   PB5  (GPIO 0) - Short press (<2 s): restart BLE advertising
+ *                   Long press (>=5 s): factory-reset Thread credentials
+ *
+ * LED assignments:
+ *   WHITE_COOL (GPIO 1)  - BLE status:    blinks=advertising, solid=connected
+ *   GREEN      (GPIO 11) - Thread status: blinks=joining,     solid=joined
+ *   BLUE       (GPIO 12) - Sound event:   rapid blinks on each detected event
+ */
+
+#ifndef _QPINCFG_H_
+#define _QPINCFG_H_
+
+/*****************************************************************************
+ *                    Common Inclusion
+ *****************************************************************************/
+#include "qPinCfg_Common.h"
+
+/*****************************************************************************
+ *                    Pin Definitions
+ *****************************************************************************/
+
+/* Multi-function commissioning button (short: restart adv, long: factory reset) */
+#define APP_MULTI_FUNC_BUTTON   PB5_BUTTON_GPIO_PIN   /* GPIO 0 */
+
+/* PDM microphone on I2S_0 - MicManager configures these as I2S alternate functions */
+#define APP_MIC_I2S_INSTANCE    0
+#define APP_MIC_SCK_GPIO        3                     /* -> mic CLK */
+#define APP_MIC_SDI_GPIO        5                     /* <- mic DATA */
+#define APP_MIC_WS_GPIO         2                     /* -> mic L/R select */
+
+/* BLE status LED: blinks=advertising, solid=connected */
+#define APP_BLE_STATE_LED       WHITE_COOL_LED_GPIO_PIN /* GPIO 1 */
+
+/* Thread status LED: blinks=joining, solid=joined network */
+#define APP_THREAD_STATE_LED    GREEN_LED_GPIO_PIN      /* GPIO 11 */
+
+/* Sound event LED: rapid blinks on each detected event */
+#define APP_SOUND_LED           BLUE_LED_GPIO_PIN       /* GPIO 12 */
+
+/*****************************************************************************
+ *                    Module Definitions
+ *****************************************************************************/
+
+/* Buttons registered with ButtonHandler (commissioning button PB5) */
+#define QPINCFG_BUTTONS    QPINCFG_GPIO_LIST(APP_MULTI_FUNC_BUTTON)
+
+/* LEDs managed by StatusLed (BLE state, Thread state, sound indicator) */
+#define QPINCFG_STATUS_LED QPINCFG_GPIO_LIST(APP_BLE_STATE_LED, APP_THREAD_STATE_LED, APP_SOUND_LED)
+
+/* Unused pins pulled low to minimise power.
+ * PB1 (GPIO 3) and PB2 (GPIO 5) are excluded - they carry the I2S microphone signals.
+ * GPIO 28 (ANIO0) and GPIO 29 (ANIO1) are excluded - analog pins unused on DK standalone. */
+#define QPINCFG_UNUSED                                                                       \
+    QPINCFG_GPIO_LIST(PB3_BUTTON_GPIO_PIN, PB4_BUTTON_GPIO_PIN, SW_BUTTON_GPIO_PIN,          \
+                      WHITE_WARM_LED_GPIO_PIN, RED_LED_GPIO_PIN,                             \
+                      EXT_32KXTAL_P, EXT_32KXTAL_N,                                         \
+                      DEBUG_SWJDP_SWDIO_TMS_GPIO, DEBUG_SWJDP_SWCLK_TCK_GPIO,               \
+                      BOARD_UNUSED_GPIO_PINS)
+
+#endif /* _QPINCFG_H_ */
@@ -0,0 +1,1374 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "AppManager.cpp"
+ *
+ * Application logic for the QPG6200 Thread+BLE Microphone.
+ *
+ * Board: QPG6200L Development Kit + SPG08P4HM4H-1 PDM microphone on I2S_0
+ *
+ * ── Behaviour ──────────────────────────────────────────────────────────────
+ *  Boot:
+ *    BLE advertising starts automatically ("QPG Thread Mic")
+ *    If Thread credentials are stored in NVM, Thread join is also attempted.
+ *
+ *  BLE connection state (WHITE_COOL LED):
+ *    Blinking  = advertising (waiting for phone)
+ *    Solid ON  = phone connected
+ *    OFF       = disconnected (press PB5 to restart advertising)
+ *
+ *  Thread network state (GREEN LED):
+ *    Blinking  = joining / attaching to Thread network
+ *    Solid ON  = attached (child, router, or leader)
+ *    OFF       = detached / disabled
+ *
+ *  Sound event (BLUE LED):
+ *    Rapid blink = sound event detected (knock, glass break, loud noise)
+ *
+ * ── Commissioning via BLE ──────────────────────────────────────────────────
+ *  1. Connect to "QPG Thread Mic" with nRF Connect or Qorvo Connect.
+ *  2. Write Thread Network Name  (e.g. "DoorbellNet").
+ *  3. Write Thread Network Key   (16-byte master key - write-only).
+ *  4. Optionally write Channel   (1 byte, 11-26, default 15).
+ *  5. Optionally write PAN ID    (2 bytes LE, default 0xABCD).
+ *  6. Write 0x01 to Join         → device attempts to join Thread network.
+ *  7. Subscribe to Thread Status  → watch device role changes (0=disabled … 4=leader).
+ *
+ * ── Buttons ────────────────────────────────────────────────────────────────
+ *  PB5 short press  (<2 s)  : restart BLE advertising
+ *  PB5 long press   (>=5 s) : factory-reset Thread credentials and reboot
+ *
+ * ── Sound events ───────────────────────────────────────────────────────────
+ *  MicManager classifies events on-device; only a compact report is sent:
+ *  BLUE LED blink, BLE Sound Event notification and a Thread CoAP event
+ *  (class, level, onset age), confirmable to the gateway.
+ *
+ * ── Listen-in stream ───────────────────────────────────────────────────────
+ *  Audio is only transmitted when a gateway asks for it: a CoAP POST to
+ *  /listen with a 1-byte payload [seconds] starts (or extends) an IMA-ADPCM
+ *  stream unicast back to the requester's address and port; 0 stops it.
+ *
+ * ── Power ──────────────────────────────────────────────────────────────────
+ *  While the room is quiet MicManager listens at a 500 kHz PDM clock with a
+ *  voice activity detector only, and sleep is enabled.  Activity or a
+ *  listen-in request brings back full-rate capture with sleep disabled.
+ */
+
+#include "AppManager.h"
+#include "AppButtons.h"
+#include "AppTask.h"
+#include "ThreadBleMicrophone_Config.h"
+#include "gpLog.h"
+#include "qPinCfg.h"
+#include "StatusLed.h"
+#include "BleIf.h"
+#include "MeshTimeSync.h"
+#include "MeshTlvNode.h"
+#include "MeshCoap.h"
+#include "MeshRole.h"
+#include "MeshRecovery.h"
+#include "MeshAuth.h"
+#include "MeshTxPower.h"
+#include "MeshChannel.h"
+#include "MeshDataset.h"
+#include "MeshDiag.h"
+#include "MeshJoiner.h"
+#include "BootProfile.h"
+#include "MicManager.h"
+#include "AudioStream.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* OpenThread headers */
+#include <openthread/thread.h>
+#include <openthread/udp.h>
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+
+/* Individual OT platform init functions (from qvOT glue library).
+ * Called separately instead of via otSysInit() to control init order. */
+extern "C" void qorvoAlarmInit(void);
+extern "C" void qorvoRadioInit(void);
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* -------------------------------------------------------------------------
+ * LED timing constants
+ * ------------------------------------------------------------------------- */
+#define ADV_BLINK_ON_MS         500
+#define ADV_BLINK_OFF_MS        500
+#define THREAD_JOIN_BLINK_ON_MS  200
+#define THREAD_JOIN_BLINK_OFF_MS 200
+#define SOUND_BLINK_ON_MS       100
+#define SOUND_BLINK_OFF_MS      100
+
+/* -------------------------------------------------------------------------
+ * Button thresholds (seconds held)
+ * ------------------------------------------------------------------------- */
+#define BTN_RESTART_ADV_THRESHOLD  2   /**< seconds to hold PB5 to restart BLE adv */
+#define BTN_FACTORY_RESET_THRESHOLD 5  /**< seconds to hold PB5 for Thread factory reset */
+
+/* -------------------------------------------------------------------------
+ * Thread sound events: CoAP POST /e (MeshCoap.h).  Listen-in requests are
+ * POSTed to THREAD_LISTEN_URI on the same CoAP server.
+ * ------------------------------------------------------------------------- */
+#define THREAD_LISTEN_URI       "listen"
+#define THREAD_STREAM_PORT      0        /**< Stream source port: ephemeral */
+
+/* LED indices (must match QPINCFG_STATUS_LED order in qPinCfg.h):
+ *   0 = WHITE_COOL (BLE state)
+ *   1 = GREEN      (Thread state)
+ *   2 = BLUE       (sound event indicator) */
+#define LED_BLE_STATE    0
+#define LED_THREAD_STATE 1
+#define LED_SOUND        2
+
+/* -------------------------------------------------------------------------
+ * Static members
+ * ------------------------------------------------------------------------- */
+AppManager AppManager::sAppMgr;
+
+static const uint8_t StatusLedGpios[] = QPINCFG_STATUS_LED;
+
+static BleIf_Callbacks_t sAppCallbacks;
+
+/* Thread state */
+static bool           sThreadCredentialsAvailable = false;
+static bool           sJoinAfterSurvey            = false; /* Channel 0: join once the survey is done */
+static otInstance*    sThreadInstance             = nullptr;
+
+/* Start-up: Thread is brought up once the BLE controller reset is done */
+#define APP_INIT_BLE_RESET_TIMEOUT_MS 3000   /**< go on without DM_RESET_CMPL_IND after this */
+
+typedef enum
+{
+    kAppInit_BleReset = 0,  /**< BleIf_Init() called, waiting for DM_RESET_CMPL_IND */
+    kAppInit_Thread,        /**< Thread_Init() running */
+    kAppInit_Done,          /**< Thread up, BLE advertising */
+} AppInitState_t;
+
+static volatile AppInitState_t sInitState = kAppInit_BleReset;
+static StaticTimer_t           sInitTimerBuffer;
+static TimerHandle_t           sInitTimer = nullptr;
+static otUdpSocket    sThreadUdpSocket;                  /**< Listen-in stream source */
+static bool           sThreadUdpSocketOpen        = false;
+static otCoapResource sListenResource;
+
+/* Sound event counter for logging */
+static uint32_t sSoundEventCount = 0;
+
+/* Listen-in stream destination (the gateway that requested it) */
+static otIp6Address     sStreamPeerAddr;
+static uint16_t         sStreamPeerPort      = 0;
+static uint32_t         sStreamSendErrors    = 0;
+
+/* -------------------------------------------------------------------------
+ * Forward declarations
+ * ------------------------------------------------------------------------- */
+static void BLE_Stack_Callback(BleIf_MsgHdr_t* pMsg);
+static void BLE_CharacteristicRead_Callback(uint16_t connId, uint16_t handle, uint8_t op,
+                                            uint16_t offset, BleIf_Attr_t* pAttr);
+static void BLE_CharacteristicWrite_Callback(uint16_t connId, uint16_t handle, uint8_t op,
+                                             uint16_t offset, uint16_t len, uint8_t* pValue,
+                                             BleIf_Attr_t* pAttr);
+static void BLE_CCCD_Callback(BleIf_AttsCccEvt_t* event);
+
+static void Thread_Init(void);
+static void Thread_StartJoin(void);
+static void Thread_SendSoundMulticast(const SoundEvent_t* pEvent);
+static void Thread_SendStreamPacket(const uint8_t* pPacket);
+static void Thread_UdpReceiveCallback(void* aContext, otMessage* aMessage,
+                                      const otMessageInfo* aMessageInfo);
+static void Thread_ListenRequestHandler(void* aContext, otMessage* aMessage,
+                                        const otMessageInfo* aMessageInfo);
+static void Thread_StateChangeCallback(uint32_t aFlags, void* aContext);
+static void Thread_TimeSyncNotify(void);
+static void Thread_CoapNotify(void);
+static void Thread_DiagNotify(void);
+static void Thread_DiagSnapshot(const uint8_t* pFrame, uint16_t len);
+static void Thread_DatasetNotify(void);
+static void Thread_DatasetResult(otError error, uint16_t len);
+static void Thread_ChannelNotify(void);
+static void Thread_ChannelSurvey(const uint8_t* pSurvey, uint16_t len);
+static void Thread_AuthNotify(void);
+static void Thread_AuthUpdate(void);
+static void Thread_JoinerNotify(void);
+static void Thread_JoinerState(MeshJoiner_State_t state, otError error);
+static void Thread_TxPowerNotify(void);
+static void Thread_RecoveryNotify(void);
+static void App_InitTimeout(TimerHandle_t xTimer);
+static void App_InitContinue(bool timedOut);
+
+/* -------------------------------------------------------------------------
+ * Helper: accessor for config values defined in Config.c
+ * ------------------------------------------------------------------------- */
+extern "C" uint8_t* ThreadCfg_GetNetworkName(uint16_t* pLen);
+extern "C" uint8_t* ThreadCfg_GetNetworkKey(void);
+extern "C" uint8_t  ThreadCfg_GetChannel(void);
+extern "C" uint16_t ThreadCfg_GetPanId(void);
+extern "C" void     ThreadCfg_SetStatus(uint8_t status);
+extern "C" uint8_t  ThreadCfg_GetStatus(void);
+extern "C" void     ThreadCfg_SetDiagnostics(const uint8_t* pData, uint16_t len);
+extern "C" void     ThreadCfg_SetSurvey(const uint8_t* pSurvey, uint16_t len);
+extern "C" void     ThreadCfg_SetAuth(const uint8_t* pInfo);
+extern "C" void     ThreadCfg_SetJoiner(const uint8_t* pInfo);
+extern "C" void     SoundCfg_SetEvent(const uint8_t* pValue);
+
+/* =========================================================================
+ *  AppManager::Init
+ * ========================================================================= */
+void AppManager::Init()
+{
+    /* --- BLE ------------------------------------------------------------ */
+    sAppCallbacks.stackCallback    = BLE_Stack_Callback;
+    sAppCallbacks.chrReadCallback  = BLE_CharacteristicRead_Callback;
+    sAppCallbacks.chrWriteCallback = BLE_CharacteristicWrite_Callback;
+    sAppCallbacks.cccCallback      = BLE_CCCD_Callback;
+
+    /* --- LEDs ----------------------------------------------------------- */
+    StatusLed_Init(StatusLedGpios, Q_ARRAY_SIZE(StatusLedGpios), true);
+    StatusLed_SetLed(LED_BLE_STATE,    false);
+    StatusLed_SetLed(LED_THREAD_STATE, false);
+    StatusLed_SetLed(LED_SOUND,        false);
+
+    /* --- Button --------------------------------------------------------- */
+    GetAppButtons().RegisterMultiFunc(APP_MULTI_FUNC_BUTTON);
+
+    /* --- BLE reset, then Thread ------------------------------------------
+     * BleIf_Init() calls DmDevReset() which asynchronously resets the BLE
+     * radio controller.  Thread_Init() also accesses the radio hardware, and
+     * starting both at the same time causes a hard fault / watchdog reset
+     * on the shared radio.  So Thread_Init() runs from App_InitContinue()
+     * when DM_RESET_CMPL_IND comes in, and this returns at once: the app
+     * task serves buttons and sensors while the controller resets. */
+    sInitTimer = xTimerCreateStatic("AppInit", pdMS_TO_TICKS(APP_INIT_BLE_RESET_TIMEOUT_MS), pdFALSE,
+                                    nullptr, App_InitTimeout, &sInitTimerBuffer);
+    xTimerStart(sInitTimer, 0);
+    BootProfile_Begin(BootProfile_BleReset);
+    BleIf_Init(&sAppCallbacks);
+
+    /* --- Banner --------------------------------------------------------- */
+    GP_LOG_SYSTEM_PRINTF("", 0);
+    GP_LOG_SYSTEM_PRINTF("============================================", 0);
+    GP_LOG_SYSTEM_PRINTF("  QPG6200 THREAD + BLE MICROPHONE", 0);
+    GP_LOG_SYSTEM_PRINTF("============================================", 0);
+    GP_LOG_SYSTEM_PRINTF("Board  : QPG6200L Development Kit", 0);
+    GP_LOG_SYSTEM_PRINTF("Mic    : PDM on I2S_0 (GPIO 2/3/5)", 0);
+    GP_LOG_SYSTEM_PRINTF("", 0);
+    GP_LOG_SYSTEM_PRINTF("--- LED Guide ---", 0);
+    GP_LOG_SYSTEM_PRINTF("  WHITE blinks  = BLE advertising", 0);
+    GP_LOG_SYSTEM_PRINTF("  WHITE solid   = BLE connected", 0);
+    GP_LOG_SYSTEM_PRINTF("  GREEN blinks  = Thread joining", 0);
+    GP_LOG_SYSTEM_PRINTF("  GREEN solid   = Thread attached", 0);
+    GP_LOG_SYSTEM_PRINTF("  BLUE blinks   = Sound event", 0);
+    GP_LOG_SYSTEM_PRINTF("", 0);
+    GP_LOG_SYSTEM_PRINTF("--- Thread Commissioning (via BLE) ---", 0);
+    GP_LOG_SYSTEM_PRINTF("  1. Connect to 'QPG Thread Mic'", 0);
+    GP_LOG_SYSTEM_PRINTF("  2. Write Thread Network Name (16 bytes)", 0);
+    GP_LOG_SYSTEM_PRINTF("  3. Write Thread Network Key  (16 bytes)", 0);
+    GP_LOG_SYSTEM_PRINTF("  4. Write Channel  (1 byte, 11-26, 0 = auto)", 0);
+    GP_LOG_SYSTEM_PRINTF("  5. Write PAN ID   (2 bytes LE)", 0);
+    GP_LOG_SYSTEM_PRINTF("  6. Write 0x01 to Join characteristic", 0);
+    GP_LOG_SYSTEM_PRINTF("", 0);
+    GP_LOG_SYSTEM_PRINTF("--- Sound detection ---", 0);
+    GP_LOG_SYSTEM_PRINTF("  Classes: knock, glass break, loud noise", 0);
+    GP_LOG_SYSTEM_PRINTF("  Listen-in: gateway POSTs [secs] to coap://[node]/%s", 0, THREAD_LISTEN_URI);
+    GP_LOG_SYSTEM_PRINTF("  Hold PB5 5s = factory reset Thread creds", 0);
+    GP_LOG_SYSTEM_PRINTF("", 0);
+}
+
+/* =========================================================================
+ *  AppManager::EventHandler  - dispatch to sub-handlers
+ * ========================================================================= */
+void AppManager::EventHandler(AppEvent* aEvent)
+{
+    if(aEvent == nullptr)
+    {
+        return;
+    }
+
+    switch(aEvent->Type)
+    {
+        case AppEvent::kEventType_Buttons:
+            ButtonEventHandler(aEvent);
+            break;
+        case AppEvent::kEventType_BleConnection:
+            BleEventHandler(aEvent);
+            break;
+        case AppEvent::kEventType_Sound:
+            SoundEventHandler(aEvent);
+            break;
+        case AppEvent::kEventType_Thread:
+            ThreadEventHandler(aEvent);
+            break;
+        case AppEvent::kEventType_Stream:
+            StreamEventHandler(aEvent);
+            break;
+        case AppEvent::kEventType_Power:
+            PowerEventHandler(aEvent);
+            break;
+        default:
+            break;
+    }
+}
+
+/* =========================================================================
+ *  BleEventHandler
+ * ========================================================================= */
+void AppManager::BleEventHandler(AppEvent* aEvent)
+{
+    switch(aEvent->BleConnectionEvent.Event)
+    {
+        case Ble_Event_t::kBleConnectionEvent_StackReady:
+            App_InitContinue(aEvent->BleConnectionEvent.Value != 0);
+            break;
+
+        case Ble_Event_t::kBleConnectionEvent_Advertise_Start:
+            GP_LOG_SYSTEM_PRINTF("[BLE] Advertising started", 0);
+            StatusLed_BlinkLed(LED_BLE_STATE, ADV_BLINK_ON_MS, ADV_BLINK_OFF_MS);
+            break;
+
+        case Ble_Event_t::kBleConnectionEvent_Connected:
+            GP_LOG_SYSTEM_PRINTF("[BLE] Phone connected", 0);
+            StatusLed_SetLed(LED_BLE_STATE, true);
+            break;
+
+        case Ble_Event_t::kBleConnectionEvent_Disconnected:
+            GP_LOG_SYSTEM_PRINTF("[BLE] Phone disconnected", 0);
+            StatusLed_SetLed(LED_BLE_STATE, false);
+            /* Keys written in this connection can no longer be changed over BLE */
+            MeshAuth_Lock();
+            Thread_AuthUpdate();
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* =========================================================================
+ *  ButtonEventHandler  - digital PB5
+ * ========================================================================= */
+void AppManager::ButtonEventHandler(AppEvent* aEvent)
+{
+    if(aEvent->ButtonEvent.Index != APP_MULTI_FUNC_BUTTON)
+    {
+        return;
+    }
+
+    if(aEvent->ButtonEvent.State == ButtonEvent_t::kButtonState_Pressed)
+    {
+        /* Short press: nothing on press, action on release */
+    }
+    else if(aEvent->ButtonEvent.State == ButtonEvent_t::kButtonState_Released)
+    {
+        uint8_t held = aEvent->ButtonEvent.HeldSec;
+
+        if(held >= BTN_FACTORY_RESET_THRESHOLD)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BTN] Factory reset - clearing Thread credentials", 0);
+            /* Clear Thread credentials from NVM and reboot */
+            if(sThreadInstance != nullptr)
+            {
+                otInstanceFactoryReset(sThreadInstance);
+            }
+            AppTask::ResetSystem();
+        }
+        else if(held >= BTN_RESTART_ADV_THRESHOLD)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BTN] Restarting BLE advertising", 0);
+            BleIf_StartAdvertising();
+        }
+    }
+    else if(aEvent->ButtonEvent.State == ButtonEvent_t::kButtonState_Held)
+    {
+        if(aEvent->ButtonEvent.HeldSec == BTN_RESTART_ADV_THRESHOLD)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BTN] Release now to restart BLE advertising", 0);
+        }
+        else if(aEvent->ButtonEvent.HeldSec == BTN_FACTORY_RESET_THRESHOLD)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BTN] Release now to factory-reset Thread credentials!", 0);
+        }
+    }
+}
+
+/* =========================================================================
+ *  ThreadEventHandler
+ * ========================================================================= */
+void AppManager::ThreadEventHandler(AppEvent* aEvent)
+{
+    switch(aEvent->ThreadEvent.Event)
+    {
+        case kThreadEvent_Joined:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Attached to network (role=%d)", 0,
+                                 aEvent->ThreadEvent.Value);
+            StatusLed_SetLed(LED_THREAD_STATE, true);
+            ThreadCfg_SetStatus((uint8_t)aEvent->ThreadEvent.Value);
+            /* Notify any connected BLE peer */
+            {
+                uint8_t status = ThreadCfg_GetStatus();
+                BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+            }
+            MeshTimeSync_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshChannel_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshRole_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshRecovery_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            /* Send the events held while detached */
+            MeshCoap_Process();
+            /* Boot profile: time to first attach */
+            if(BootProfile_End(BootProfile_Attach))
+            {
+                BootProfile_Log();
+            }
+            break;
+
+        case kThreadEvent_Detached:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Detached from network", 0);
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            ThreadCfg_SetStatus(THREAD_STATUS_DETACHED);
+            {
+                uint8_t status = THREAD_STATUS_DETACHED;
+                BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+            }
+            MeshTimeSync_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshRole_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshRecovery_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            break;
+
+        case kThreadEvent_TimeSync:
+            MeshTimeSync_Process();
+            break;
+
+        case kThreadEvent_Coap:
+            MeshCoap_Process();
+            break;
+
+        case kThreadEvent_Diag:
+            MeshDiag_Process();
+            break;
+
+        case kThreadEvent_Dataset:
+            MeshDataset_Process();
+            break;
+
+        case kThreadEvent_Channel:
+            if(aEvent->ThreadEvent.Value == 1)
+            {
+                MeshChannel_StartSurvey();
+            }
+            else
+            {
+                MeshChannel_Process();
+            }
+            break;
+
+        case kThreadEvent_Auth:
+            Thread_AuthUpdate();
+            break;
+
+        case kThreadEvent_TxPower:
+            MeshTxPower_Process();
+            break;
+
+        case kThreadEvent_Recovery:
+            MeshRecovery_Process();
+            break;
+
+        case kThreadEvent_Joiner:
+            MeshJoiner_Process();
+            break;
+
+        case kThreadEvent_Error:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Error: 0x%x", 0, aEvent->ThreadEvent.Value);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* =========================================================================
+ *  SoundEventHandler  - LED + BLE notification + Thread event
+ * ========================================================================= */
+void AppManager::SoundEventHandler(AppEvent* aEvent)
+{
+    static const char* const kClassNames[] = {"none", "knock", "glass break", "loud noise"};
+
+    const SoundEvent_t* pEvent = &aEvent->SoundEvent;
+    const char* pName = (pEvent->ClassId < Q_ARRAY_SIZE(kClassNames)) ? kClassNames[pEvent->ClassId] : "custom";
+
+    sSoundEventCount++;
+    GP_LOG_SYSTEM_PRINTF("[MIC] Event #%lu: %s (class %u), %d dBFS, t=%lu ms", 0,
+                         sSoundEventCount, pName, pEvent->ClassId, pEvent->LevelDb,
+                         pEvent->TimestampMs);
+
+    /* Blink BLUE sound LED */
+    StatusLed_BlinkLed(LED_SOUND, SOUND_BLINK_ON_MS, SOUND_BLINK_OFF_MS);
+
+    /* Update the Sound Event characteristic and notify a connected phone */
+    uint8_t value[SOUND_EVENT_LEN] = {
+        pEvent->ClassId,
+        (uint8_t)pEvent->LevelDb,
+        (uint8_t)(pEvent->TimestampMs & 0xFF),
+        (uint8_t)((pEvent->TimestampMs >> 8) & 0xFF),
+        (uint8_t)((pEvent->TimestampMs >> 16) & 0xFF),
+        (uint8_t)((pEvent->TimestampMs >> 24) & 0xFF),
+    };
+    SoundCfg_SetEvent(value);
+    BleIf_SendNotification(SOUND_EVENT_HDL, sizeof(value), value);
+
+    /* Report over the Thread mesh */
+    Thread_SendSoundMulticast(pEvent);
+}
+
+/* =========================================================================
+ *  StreamEventHandler  - listen-in requests and packet transmission
+ * ========================================================================= */
+void AppManager::StreamEventHandler(AppEvent* aEvent)
+{
+    const StreamEvent_t* pStream = &aEvent->StreamEvent;
+
+    if(pStream->Action == kStreamAction_Request)
+    {
+        if(pStream->DurationSec > 0)
+        {
+            char addrStr[OT_IP6_ADDRESS_STRING_SIZE];
+
+            memcpy(sStreamPeerAddr.mFields.m8, pStream->PeerAddr, sizeof(sStreamPeerAddr.mFields.m8));
+            sStreamPeerPort = pStream->PeerPort;
+            otIp6AddressToString(&sStreamPeerAddr, addrStr, sizeof(addrStr));
+            GP_LOG_SYSTEM_PRINTF("[STREAM] Listen-in for %u s to [%s]:%u", 0,
+                                 pStream->DurationSec, addrStr, sStreamPeerPort);
+        }
+        else
+        {
+            GP_LOG_SYSTEM_PRINTF("[STREAM] Stop requested", 0);
+        }
+        MicManager::RequestStream(pStream->DurationSec);
+        return;
+    }
+
+    /* kStreamAction_PacketReady: drain everything the capture task queued.
+     * One event per packet is posted, so if an event was lost the next one
+     * picks up its packet as well. */
+    const uint8_t* pPacket;
+    while((pPacket = MicManager::PeekStreamPacket()) != nullptr)
+    {
+        Thread_SendStreamPacket(pPacket);
+
+        if(pPacket[1] & AUDIO_STREAM_FLAG_END)
+        {
+            GP_LOG_SYSTEM_PRINTF("[STREAM] Ended, %lu send errors", 0, (unsigned long)sStreamSendErrors);
+            sStreamSendErrors = 0;
+        }
+        MicManager::PopStreamPacket();
+    }
+}
+
+/* =========================================================================
+ *  PowerEventHandler  - sleep only while the microphone listens at low power
+ *
+ *  At full rate the capture task runs every 4 ms and the sleep exit latency
+ *  would only add jitter; at 500 kHz it wakes every 8 ms for ~0.5 % CPU and
+ *  the MCU can sleep in between.
+ * ========================================================================= */
+void AppManager::PowerEventHandler(AppEvent* aEvent)
+{
+    bool lowPower = aEvent->PowerEvent.LowPower;
+
+    GetAppTask().EnableSleep(lowPower);
+    GP_LOG_SYSTEM_PRINTF("[MIC] Sleep %s", 0, lowPower ? "enabled" : "disabled");
+}
+
+/* =========================================================================
+ *  NotifySoundEvent  - called from the MicManager capture task
+ * ========================================================================= */
+void AppManager::NotifySoundEvent(uint8_t classId, int8_t levelDb, uint32_t timestampMs)
+{
+    AppEvent event;
+    event.Type                   = AppEvent::kEventType_Sound;
+    event.SoundEvent.ClassId     = classId;
+    event.SoundEvent.LevelDb     = levelDb;
+    event.SoundEvent.TimestampMs = timestampMs;
+    event.Handler                = nullptr;
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  NotifyStreamPacket  - called from the MicManager capture task
+ * ========================================================================= */
+void AppManager::NotifyStreamPacket(void)
+{
+    AppEvent event;
+    event.Type               = AppEvent::kEventType_Stream;
+    event.StreamEvent.Action = kStreamAction_PacketReady;
+    event.Handler            = nullptr;
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  NotifyPowerMode  - called from the MicManager capture task
+ * ========================================================================= */
+void AppManager::NotifyPowerMode(bool lowPower)
+{
+    AppEvent event;
+    event.Type                = AppEvent::kEventType_Power;
+    event.PowerEvent.LowPower = lowPower;
+    event.Handler             = nullptr;
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  NotifyThreadEvent  - called from Thread callbacks
+ * ========================================================================= */
+void AppManager::NotifyThreadEvent(ThreadEventType_t threadEvent, uint32_t value)
+{
+    AppEvent event;
+    event.Type               = AppEvent::kEventType_Thread;
+    event.ThreadEvent.Event  = threadEvent;
+    event.ThreadEvent.Value  = value;
+    event.Handler            = nullptr;
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  App_InitTimeout  - no DM_RESET_CMPL_IND in time: go on without it
+ * ========================================================================= */
+static void App_InitTimeout(TimerHandle_t /*xTimer*/)
+{
+    AppEvent event;
+    event.Type                     = AppEvent::kEventType_BleConnection;
+    event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_StackReady;
+    event.BleConnectionEvent.Value = 1; /* timed out */
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  App_InitContinue  - BLE reset done (or timed out): bring up Thread
+ *
+ *  kAppInit_BleReset -> kAppInit_Thread -> kAppInit_Done.  A reset complete
+ *  after the timeout, or a later controller reset, changes nothing.
+ * ========================================================================= */
+static void App_InitContinue(bool timedOut)
+{
+    if(sInitState != kAppInit_BleReset)
+    {
+        return;
+    }
+    xTimerStop(sInitTimer, 0);
+
+    if(timedOut)
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] WARNING: BLE stack reset did not complete in time", 0);
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] Stack ready (%lu ms)", 0, BootProfile_Duration(BootProfile_BleReset));
+    }
+
+    sInitState = kAppInit_Thread;
+    BootProfile_Begin(BootProfile_ThreadInit);
+    Thread_Init();
+    BootProfile_End(BootProfile_ThreadInit);
+    sInitState = kAppInit_Done;
+
+    /* Start BLE advertising: after Thread_Init(), the radio is set up */
+    if(BleIf_StartAdvertising() == STATUS_NO_ERROR)
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] Advertising started - scan for 'QPG Thread Mic'", 0);
+    }
+}
+
+/* =========================================================================
+ *  Thread_Init
+ *
+ *  Initialises the OpenThread instance.  If Thread credentials have been
+ *  stored in NVM (via a previous BLE commissioning session), Thread join
+ *  is started automatically.
+ * ========================================================================= */
+static void Thread_Init(void)
+{
+    /* Initialise alarm timers before creating the OT instance */
+    qorvoAlarmInit();
+
+    sThreadInstance = otInstanceInitSingle();
+    if(sThreadInstance == nullptr)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] otInstanceInitSingle failed!", 0);
+        return;
+    }
+
+    /* Register the OT radio stack with the MAC dispatcher AFTER the OT
+     * instance is created.  Calling this before otInstanceInitSingle()
+     * (via otSysInit) triggers a MAC reset that leaves the secure-element
+     * RNG in a bad state, causing mbedtls_ctr_drbg_seed() to fail and
+     * the watchdog to reset the device. */
+    qorvoRadioInit();
+
+    /* Register state-change callback to track network attach/detach */
+    otSetStateChangedCallback(sThreadInstance, Thread_StateChangeCallback, nullptr);
+
+    /* Mesh time base: the leader is the time master, everyone else tracks it */
+    MeshTimeSync_Init(sThreadInstance, Thread_TimeSyncNotify);
+    MeshTlvNode_Init(sThreadInstance, MESH_TLV_DEVICE_MICROPHONE);
+
+    /* Sound events out, listen-in requests in: CoAP server on port 5683.
+     * Events from other nodes are not used here, so there is no /e handler. */
+    MeshCoap_Init(sThreadInstance, nullptr, Thread_CoapNotify);
+    memset(&sListenResource, 0, sizeof(sListenResource));
+    sListenResource.mUriPath = THREAD_LISTEN_URI;
+    sListenResource.mHandler = Thread_ListenRequestHandler;
+    MeshCoap_AddResource(&sListenResource);
+
+    /* Role policy of the device class (MESH_ROLE_POLICY), set before Thread starts */
+    MeshRole_Init(sThreadInstance, (MeshRole_Policy_t)MESH_ROLE_POLICY);
+
+    /* Diagnostics snapshot: readable over BLE and pushed to the gateway (POST /d) */
+    MeshDiag_Init(sThreadInstance, Thread_DiagNotify, Thread_DiagSnapshot);
+
+    /* Single-write commissioning: Dataset characteristic */
+    MeshDataset_Init(sThreadInstance, Thread_DatasetNotify, Thread_DatasetResult);
+    MeshChannel_Init(sThreadInstance, Thread_ChannelNotify, Thread_ChannelSurvey);
+
+    /* Event signing keys (Auth characteristic) */
+    MeshAuth_Init(sThreadInstance, Thread_AuthNotify);
+    Thread_AuthUpdate();
+
+    /* MeshCoP joiner: credentials from a commissioner instead of BLE */
+    MeshJoiner_Init(sThreadInstance, "Microphone", Thread_JoinerNotify, Thread_JoinerState);
+    {
+        uint8_t info[MESH_JOINER_INFO_LEN];
+        MeshJoiner_GetInfo(info);
+        ThreadCfg_SetJoiner(info);
+    }
+
+    /* Transmit power follows the link margin (starts at the BSP power) */
+    MeshTxPower_Init(sThreadInstance, Thread_TxPowerNotify);
+
+    /* Outage metrics, and attach restarts while detached */
+    MeshRecovery_Init(sThreadInstance, Thread_RecoveryNotify);
+
+    /* Check if Thread dataset is already stored in NVM */
+    otOperationalDataset dataset;
+    if(otDatasetGetActive(sThreadInstance, &dataset) == OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] Credentials found in NVM - starting Thread", 0);
+        sThreadCredentialsAvailable = true;
+        Thread_StartJoin();
+    }
+    else if(MESH_JOINER_AUTOSTART && MeshJoiner_HasPskd())
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] No credentials - starting the joiner", 0);
+        MeshJoiner_Start();
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] No credentials - waiting for BLE commissioning", 0);
+    }
+}
+
+/* =========================================================================
+ *  Thread_StartJoin
+ *
+ *  Applies the current Thread config parameters (from BLE GATT or NVM),
+ *  enables the IPv6 interface, and starts the Thread stack.
+ * ========================================================================= */
+static void Thread_StartJoin(void)
+{
+    if(sThreadInstance == nullptr)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] Cannot join - not initialised", 0);
+        return;
+    }
+
+    otError err;
+
+    /* Apply BLE-written network parameters if not already stored in NVM */
+    if(!sThreadCredentialsAvailable)
+    {
+        uint16_t nameLen;
+        uint8_t* pName = ThreadCfg_GetNetworkName(&nameLen);
+        uint8_t* pKey  = ThreadCfg_GetNetworkKey();
+        uint8_t  ch    = ThreadCfg_GetChannel();
+        uint16_t panId = ThreadCfg_GetPanId();
+
+        /* Channel 0: the quietest channel of an energy survey, run first if
+         * there is none yet; Thread_ChannelSurvey() calls back here. */
+        if(ch == MESH_CHANNEL_AUTO)
+        {
+            ch = MeshChannel_Best();
+            if(ch == 0)
+            {
+                err = MeshChannel_StartSurvey();
+                if(err == OT_ERROR_NONE || err == OT_ERROR_BUSY)
+                {
+                    sJoinAfterSurvey = true;
+                    return;
+                }
+                ch = MESH_CHANNEL_FALLBACK;
+            }
+            GP_LOG_SYSTEM_PRINTF("[Thread] Auto channel: %u", 0, ch);
+        }
+
+        /* Build an operational dataset from the BLE-written values */
+        otOperationalDataset dataset;
+        memset(&dataset, 0, sizeof(dataset));
+
+        /* Network Name */
+        if(nameLen > OT_NETWORK_NAME_MAX_SIZE)
+        {
+            nameLen = OT_NETWORK_NAME_MAX_SIZE;
+        }
+        memcpy(dataset.mNetworkName.m8, pName, nameLen);
+        dataset.mComponents.mIsNetworkNamePresent = true;
+
+        /* Network Key */
+        memcpy(dataset.mNetworkKey.m8, pKey, OT_NETWORK_KEY_SIZE);
+        dataset.mComponents.mIsNetworkKeyPresent = true;
+
+        /* Channel */
+        dataset.mChannel = ch;
+        dataset.mComponents.mIsChannelPresent = true;
+
+        /* PAN ID */
+        dataset.mPanId = panId;
+        dataset.mComponents.mIsPanIdPresent = true;
+
+        /* Active Timestamp */
+        dataset.mActiveTimestamp.mSeconds = 1;
+        dataset.mComponents.mIsActiveTimestampPresent = true;
+
+        err = otDatasetSetActive(sThreadInstance, &dataset);
+        if(err != OT_ERROR_NONE)
+        {
+            GP_LOG_SYSTEM_PRINTF("[Thread] SetActiveDataset failed: %d", 0, (int)err);
+            return;
+        }
+    }
+
+    /* Enable IPv6 */
+    err = otIp6SetEnabled(sThreadInstance, true);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] IPv6 enable failed: %d", 0, (int)err);
+        return;
+    }
+
+    /* Start Thread */
+    err = otThreadSetEnabled(sThreadInstance, true);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] SetEnabled failed: %d", 0, (int)err);
+        return;
+    }
+    BootProfile_Begin(BootProfile_Attach);
+
+    /* Blink GREEN LED while joining */
+    StatusLed_BlinkLed(LED_THREAD_STATE, THREAD_JOIN_BLINK_ON_MS, THREAD_JOIN_BLINK_OFF_MS);
+    GP_LOG_SYSTEM_PRINTF("[Thread] Joining network...", 0);
+
+    /* Open the UDP socket the listen-in stream is sent from */
+    if(!sThreadUdpSocketOpen)
+    {
+        otSockAddr sockAddr;
+        memset(&sockAddr, 0, sizeof(sockAddr));
+        sockAddr.mPort = THREAD_STREAM_PORT;
+
+        err = otUdpOpen(sThreadInstance, &sThreadUdpSocket,
+                        Thread_UdpReceiveCallback, nullptr);
+        if(err == OT_ERROR_NONE)
+        {
+            err = otUdpBind(sThreadInstance, &sThreadUdpSocket, &sockAddr, OT_NETIF_THREAD_INTERNAL);
+            if(err == OT_ERROR_NONE)
+            {
+                sThreadUdpSocketOpen = true;
+                GP_LOG_SYSTEM_PRINTF("[Thread] Stream socket open on port %d", 0,
+                                     sThreadUdpSocket.mSockName.mPort);
+            }
+            else
+            {
+                GP_LOG_SYSTEM_PRINTF("[Thread] UDP bind failed: %d", 0, (int)err);
+            }
+        }
+        else
+        {
+            GP_LOG_SYSTEM_PRINTF("[Thread] UDP open failed: %d", 0, (int)err);
+        }
+    }
+}
+
+/* =========================================================================
+ *  Thread_SendSoundMulticast
+ *
+ *  Publishes a TLV frame (MeshTlv.h) as a critical CoAP event (MeshCoap.h)
+ *  with one SOUND record: class id (SOUND_CLASS_*), peak level (signed
+ *  dBFS) and the onset age in ms.  The onset time is the header timestamp
+ *  minus the age, so it is in mesh time once this node is synced.
+ * ========================================================================= */
+static void Thread_SendSoundMulticast(const SoundEvent_t* pEvent)
+{
+    if(sThreadInstance == nullptr)
+    {
+        return;
+    }
+
+    uint32_t ageMs = (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS) - pEvent->TimestampMs;
+
+    uint8_t          frame[MESH_TLV_MAX_FRAME];
+    MeshTlv_Writer_t writer;
+    MeshTlvNode_Begin(&writer, frame, sizeof(frame), nullptr);
+    uint8_t* pSound = MeshTlv_Reserve(&writer, MESH_TLV_REC_SOUND, MESH_TLV_SOUND_LEN);
+    if(pSound != nullptr)
+    {
+        if(ageMs > 0xFFFF)
+        {
+            ageMs = 0xFFFF;
+        }
+        pSound[0] = pEvent->ClassId;
+        pSound[1] = (uint8_t)pEvent->LevelDb;
+        pSound[2] = (uint8_t)(ageMs >> 8);
+        pSound[3] = (uint8_t)(ageMs & 0xFF);
+    }
+
+    otError err = MeshCoap_Publish(frame, MeshTlvNode_Finish(&writer), MeshCoap_Critical, false);
+    if(err == OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] Sound event sent (class %u)", 0, pEvent->ClassId);
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] Sound event deferred: %d", 0, (int)err);
+    }
+}
+
+/* =========================================================================
+ *  Thread_SendStreamPacket
+ *
+ *  Unicasts one AUDIO_STREAM_PACKET_LEN-byte packet (see AudioStream.h) to
+ *  the gateway that requested the stream.  Failures are counted rather than
+ *  logged: at ~81 packets/s a log line per error would swamp the UART.
+ * ========================================================================= */
+static void Thread_SendStreamPacket(const uint8_t* pPacket)
+{
+    if(sThreadInstance == nullptr || !sThreadUdpSocketOpen || sStreamPeerPort == 0)
+    {
+        sStreamSendErrors++;
+        return;
+    }
+
+    otMessage* msg = otUdpNewMessage(sThreadInstance, nullptr);
+    if(msg == nullptr)
+    {
+        sStreamSendErrors++;
+        return;
+    }
+
+    if(otMessageAppend(msg, pPacket, AUDIO_STREAM_PACKET_LEN) != OT_ERROR_NONE)
+    {
+        sStreamSendErrors++;
+        otMessageFree(msg);
+        return;
+    }
+
+    otMessageInfo msgInfo;
+    memset(&msgInfo, 0, sizeof(msgInfo));
+    msgInfo.mPeerAddr = sStreamPeerAddr;
+    msgInfo.mPeerPort = sStreamPeerPort;
+
+    if(otUdpSend(sThreadInstance, &sThreadUdpSocket, msg, &msgInfo) != OT_ERROR_NONE)
+    {
+        sStreamSendErrors++;
+        otMessageFree(msg);
+    }
+}
+
+/* =========================================================================
+ *  Thread_UdpReceiveCallback  - stream socket: nothing is expected here
+ * ========================================================================= */
+static void Thread_UdpReceiveCallback(void* /*aContext*/, otMessage* /*aMessage*/,
+                                      const otMessageInfo* /*aMessageInfo*/)
+{
+}
+
+/* =========================================================================
+ *  Thread_ListenRequestHandler
+ *
+ *  CoAP POST /listen, payload [seconds].  The stream goes back to the
+ *  requester's address and port.  The request is forwarded to the AppTask,
+ *  which owns the stream.
+ * ========================================================================= */
+static void Thread_ListenRequestHandler(void* /*aContext*/, otMessage* aMessage,
+                                        const otMessageInfo* aMessageInfo)
+{
+    uint8_t seconds;
+
+    if(otCoapMessageGetCode(aMessage) != OT_COAP_CODE_POST ||
+       otMessageRead(aMessage, otMessageGetOffset(aMessage), &seconds, sizeof(seconds)) != sizeof(seconds))
+    {
+        return;
+    }
+    MeshCoap_Acknowledge(aMessage, aMessageInfo);
+
+    AppEvent event;
+    event.Type                    = AppEvent::kEventType_Stream;
+    event.StreamEvent.Action      = kStreamAction_Request;
+    event.StreamEvent.DurationSec = seconds;
+    event.StreamEvent.PeerPort    = aMessageInfo->mPeerPort;
+    memcpy(event.StreamEvent.PeerAddr, aMessageInfo->mPeerAddr.mFields.m8, sizeof(event.StreamEvent.PeerAddr));
+    event.Handler                 = nullptr;
+    GetAppTask().PostEvent(&event);
+}
+
+/* =========================================================================
+ *  Thread_TimeSyncNotify  - MeshTimeSync timer task: exchange due
+ * ========================================================================= */
+static void Thread_TimeSyncNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_TimeSync, 0);
+}
+
+/* =========================================================================
+ *  Thread_CoapNotify  - MeshCoap: a held or gateway send is due
+ * ========================================================================= */
+static void Thread_CoapNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Coap, 0);
+}
+
+/* =========================================================================
+ *  Thread_DiagNotify  - MeshDiag: snapshot due (timer / topology change)
+ * ========================================================================= */
+static void Thread_DiagNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Diag, 0);
+}
+
+/* =========================================================================
+ *  Thread_DiagSnapshot  - MeshDiag: new snapshot for the Diagnostics characteristic
+ * ========================================================================= */
+static void Thread_DiagSnapshot(const uint8_t* pFrame, uint16_t len)
+{
+    ThreadCfg_SetDiagnostics(pFrame, len);
+}
+
+/* =========================================================================
+ *  Thread_DatasetNotify  - MeshDataset: written dataset ready to apply
+ * ========================================================================= */
+static void Thread_DatasetNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Dataset, 0);
+}
+
+/* =========================================================================
+ *  Thread_DatasetResult  - MeshDataset: dataset applied or refused
+ * ========================================================================= */
+static void Thread_DatasetResult(otError error, uint16_t len)
+{
+    if(error != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] Dataset rejected (%u bytes): %d", 0, len, (int)error);
+        ThreadCfg_SetStatus(THREAD_STATUS_REJECTED);
+        uint8_t status = THREAD_STATUS_REJECTED;
+        BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+        return;
+    }
+
+    GP_LOG_SYSTEM_PRINTF("[Thread] Dataset applied (%u bytes) - starting Thread", 0, len);
+    /* The active dataset is in NVM now: start from it, not from the GATT values */
+    sThreadCredentialsAvailable = true;
+    Thread_StartJoin();
+}
+
+/* =========================================================================
+ *  Thread_ChannelNotify  - MeshChannel: sweep done or leader survey due
+ * ========================================================================= */
+static void Thread_ChannelNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Channel, 0);
+}
+
+/* =========================================================================
+ *  Thread_ChannelSurvey  - MeshChannel: survey started or finished
+ * ========================================================================= */
+static void Thread_ChannelSurvey(const uint8_t* pSurvey, uint16_t len)
+{
+    ThreadCfg_SetSurvey(pSurvey, len);
+
+    if(sJoinAfterSurvey && pSurvey[0] != MeshChannel_Running)
+    {
+        sJoinAfterSurvey = false;
+        Thread_StartJoin();
+    }
+}
+
+/* =========================================================================
+ *  Thread_AuthNotify  - MeshAuth: key write ready to apply
+ * ========================================================================= */
+static void Thread_AuthNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Auth, 0);
+}
+
+/* =========================================================================
+ *  Thread_AuthUpdate  - apply the key write, refresh the Auth read-back
+ * ========================================================================= */
+static void Thread_AuthUpdate(void)
+{
+    uint8_t info[MESH_AUTH_INFO_LEN];
+
+    MeshAuth_Process();
+    MeshAuth_GetInfo(info);
+    ThreadCfg_SetAuth(info);
+}
+
+/* =========================================================================
+ *  Thread_JoinerNotify  - MeshJoiner: write, joiner result or retry due
+ * ========================================================================= */
+static void Thread_JoinerNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Joiner, 0);
+}
+
+/* =========================================================================
+ *  Thread_JoinerState  - MeshJoiner: report progress, start Thread on success
+ * ========================================================================= */
+static void Thread_JoinerState(MeshJoiner_State_t state, otError error)
+{
+    uint8_t info[MESH_JOINER_INFO_LEN];
+    uint8_t status;
+
+    MeshJoiner_GetInfo(info);
+    ThreadCfg_SetJoiner(info);
+
+    switch(state)
+    {
+        case MeshJoiner_Joining:
+            StatusLed_BlinkLed(LED_THREAD_STATE, THREAD_JOIN_BLINK_ON_MS, THREAD_JOIN_BLINK_OFF_MS);
+            status = THREAD_STATUS_JOINING;
+            break;
+
+        case MeshJoiner_Joined:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Joiner done - starting Thread", 0);
+            /* The joiner stored the active dataset: start from it */
+            sThreadCredentialsAvailable = true;
+            Thread_StartJoin();
+            return;
+
+        case MeshJoiner_Failed:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Joiner failed: %d", 0, (int)error);
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            status = THREAD_STATUS_JOIN_FAILED;
+            break;
+
+        default:
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            status = THREAD_STATUS_DISABLED;
+            break;
+    }
+
+    ThreadCfg_SetStatus(status);
+    BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+}
+
+/* =========================================================================
+ *  Thread_TxPowerNotify  - MeshTxPower: evaluation due
+ * ========================================================================= */
+static void Thread_TxPowerNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_TxPower, 0);
+}
+
+/* =========================================================================
+ *  Thread_RecoveryNotify  - MeshRecovery: attach restart due
+ * ========================================================================= */
+static void Thread_RecoveryNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Recovery, 0);
+}
+
+/* =========================================================================
+ *  Thread_StateChangeCallback
+ * ========================================================================= */
+static void Thread_StateChangeCallback(uint32_t aFlags, void* /*aContext*/)
+{
+    MeshDiag_StateChanged(aFlags);
+    MeshCoap_StateChanged(aFlags);
+    MeshTxPower_StateChanged(aFlags);
+    MeshRecovery_StateChanged(aFlags);
+
+    if(aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        otDeviceRole role = otThreadGetDeviceRole(sThreadInstance);
+        GP_LOG_SYSTEM_PRINTF("[Thread] Role changed: %d", 0, (int)role);
+
+        if(role == OT_DEVICE_ROLE_CHILD  ||
+           role == OT_DEVICE_ROLE_ROUTER ||
+           role == OT_DEVICE_ROLE_LEADER)
+        {
+            AppManager::NotifyThreadEvent(kThreadEvent_Joined, (uint32_t)role);
+        }
+        else if(role == OT_DEVICE_ROLE_DETACHED)
+        {
+            AppManager::NotifyThreadEvent(kThreadEvent_Detached, 0);
+        }
+    }
+}
+
+/* =========================================================================
+ *  BLE Callbacks
+ * ========================================================================= */
+
+static void BLE_Stack_Callback(BleIf_MsgHdr_t* pMsg)
+{
+    AppEvent event;
+    event.Type = AppEvent::kEventType_BleConnection;
+
+    if(pMsg->event >= BLEIF_DM_CBACK_START && pMsg->event <= BLEIF_DM_CBACK_END)
+    {
+        switch(pMsg->event)
+        {
+            case BLEIF_DM_RESET_CMPL_IND:
+                BootProfile_End(BootProfile_BleReset);
+                event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_StackReady;
+                event.BleConnectionEvent.Value = 0;
+                break;
+            case BLEIF_DM_ADV_START_IND:
+                event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_Advertise_Start;
+                break;
+            case BLEIF_DM_CONN_OPEN_IND:
+                event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_Connected;
+                break;
+            case BLEIF_DM_ADV_STOP_IND:
+            case BLEIF_DM_CONN_CLOSE_IND:
+                event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_Disconnected;
+                break;
+            default:
+                event.Type = AppEvent::kEventType_Invalid;
+                break;
+        }
+
+        if(event.Type != AppEvent::kEventType_Invalid)
+        {
+            GetAppTask().PostEvent(&event);
+        }
+    }
+}
+
+static void BLE_CharacteristicRead_Callback(uint16_t /*connId*/, uint16_t /*handle*/,
+                                             uint8_t /*op*/, uint16_t /*offset*/,
+                                             BleIf_Attr_t* /*pAttr*/)
+{
+    /* Static attribute values are returned automatically by BleIf */
+}
+
+static void BLE_CharacteristicWrite_Callback(uint16_t /*connId*/, uint16_t handle,
+                                              uint8_t /*op*/, uint16_t offset,
+                                              uint16_t len, uint8_t* pValue,
+                                              BleIf_Attr_t* /*pAttr*/)
+{
+    if(handle == THREAD_JOIN_HDL)
+    {
+        /* Phone triggered Thread join */
+        if(len > 0 && pValue[0] == 0x01)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Thread join command received", 0);
+            sThreadCredentialsAvailable = false; /* use BLE-written values */
+            Thread_StartJoin();
+        }
+    }
+    else if(handle == THREAD_DATASET_HDL)
+    {
+        /* One chunk of a (possibly long) write; applied once the writes settle */
+        MeshDataset_Write(offset, pValue, len);
+    }
+    else if(handle == THREAD_SURVEY_HDL)
+    {
+        /* 0x01: start a survey, run by the app task */
+        if(len > 0 && pValue[0] == 0x01)
+        {
+            AppManager::NotifyThreadEvent(kThreadEvent_Channel, 1);
+        }
+    }
+    else if(handle == THREAD_AUTH_HDL)
+    {
+        uint8_t info[MESH_AUTH_INFO_LEN];
+
+        /* Keys: applied and stored by the app task, which also restores the read-back */
+        if(!MeshAuth_Write(pValue, len))
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Auth write refused (%u bytes)", 0, len);
+        }
+        /* Keys must not stay readable in the attribute: back to the read-back at once */
+        MeshAuth_GetInfo(info);
+        ThreadCfg_SetAuth(info);
+    }
+    else if(handle == THREAD_JOINER_HDL)
+    {
+        /* Start / stop: run by the app task, progress on Thread Status */
+        if(!MeshJoiner_Write(pValue, len))
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Joiner write refused (%u bytes)", 0, len);
+        }
+    }
+    else if(handle == THREAD_NET_NAME_HDL   ||
+            handle == THREAD_NET_KEY_HDL    ||
+            handle == THREAD_CHANNEL_HDL    ||
+            handle == THREAD_PANID_HDL)
+    {
+        /* BleIf has already written the new value into the GATT attribute buffer.
+         * No explicit action needed here; Thread_StartJoin() reads the values
+         * from the GATT buffers via the ThreadCfg_Get*() accessors. */
+        GP_LOG_SYSTEM_PRINTF("[BLE] Thread config parameter updated (handle 0x%04X)", 0, handle);
+    }
+}
+
+static void BLE_CCCD_Callback(BleIf_AttsCccEvt_t* event)
+{
+    if(event->handle == SOUND_EVENT_CCC_HDL)
+    {
+        if(event->value & ATT_CLIENT_CFG_NOTIFY)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Sound Event notifications ENABLED", 0);
+        }
+        else
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Sound Event notifications disabled", 0);
+        }
+    }
+    else if(event->handle == THREAD_STATUS_CCC_HDL)
+    {
+        if(event->value & ATT_CLIENT_CFG_NOTIFY)
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Thread Status notifications ENABLED", 0);
+            /* Send current status immediately */
+            uint8_t status = ThreadCfg_GetStatus();
+            BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+/** @file "AudioStream.c"
+ *
+ * IMA-ADPCM packetiser for the listen-in stream.
+ *
+ * When the ring is full the packet is encoded into the spare buffer and
+ * discarded.  Encoding continues so the ADPCM state keeps tracking the
+ * signal, and the sequence number still advances so the gateway sees the
+ * gap and conceals it.
+ */
+
+#include "AudioStream.h"
+
+#include <string.h>
+
+#define AUDIO_STREAM_SLOT_MASK  (AUDIO_STREAM_NUM_SLOTS - 1)
+
+/* Packet contents must be in memory before head/tail publish them */
+#define AUDIO_STREAM_BARRIER()  __asm volatile("" ::: "memory")
+
+#if (AUDIO_STREAM_NUM_SLOTS & AUDIO_STREAM_SLOT_MASK) != 0
+#error "AUDIO_STREAM_NUM_SLOTS must be a power of two"
+#endif
+
+void AudioStream_Init(AudioStream_t* pStream)
+{
+    memset(pStream, 0, sizeof(*pStream));
+    ImaAdpcm_Init(&pStream->encoder);
+}
+
+void AudioStream_Begin(AudioStream_t* pStream)
+{
+    ImaAdpcm_Init(&pStream->encoder);
+    pStream->sequence  = 0;
+    pStream->fill      = 0;
+    pStream->nextFlags = AUDIO_STREAM_FLAG_START;
+    pStream->packets   = 0;
+    pStream->dropped   = 0;
+}
+
+void AudioStream_SetLast(AudioStream_t* pStream, bool last)
+{
+    if(last)
+    {
+        pStream->nextFlags |= AUDIO_STREAM_FLAG_END;
+    }
+    else
+    {
+        pStream->nextFlags &= (uint8_t)~AUDIO_STREAM_FLAG_END;
+    }
+}
+
+static inline uint8_t* AudioStream_CurrentBuffer(AudioStream_t* pStream)
+{
+    return pStream->toSpare ? pStream->spare : pStream->ring[pStream->head & AUDIO_STREAM_SLOT_MASK];
+}
+
+bool AudioStream_Write(AudioStream_t* pStream, const int16_t* pPcm, uint16_t numSamples,
+                       uint32_t sampleIndex)
+{
+    uint8_t* pData;
+
+    if(pStream->fill == 0)
+    {
+        pStream->toSpare = ((uint8_t)(pStream->head - pStream->tail) >= AUDIO_STREAM_NUM_SLOTS);
+        pData = AudioStream_CurrentBuffer(pStream);
+
+        pData[0]  = AUDIO_STREAM_MSG_TYPE;
+        pData[2]  = (uint8_t)(pStream->sequence >> 8);
+        pData[3]  = (uint8_t)(pStream->sequence & 0xFF);
+        pData[4]  = (uint8_t)(sampleIndex >> 24);
+        pData[5]  = (uint8_t)(sampleIndex >> 16);
+        pData[6]  = (uint8_t)(sampleIndex >> 8);
+        pData[7]  = (uint8_t)(sampleIndex & 0xFF);
+        pData[8]  = (uint8_t)((uint16_t)pStream->encoder.predictor >> 8);
+        pData[9]  = (uint8_t)((uint16_t)pStream->encoder.predictor & 0xFF);
+        pData[10] = pStream->encoder.index;
+    }
+    pData = AudioStream_CurrentBuffer(pStream);
+
+    ImaAdpcm_Encode(&pStream->encoder, pPcm, numSamples,
+                    &pData[AUDIO_STREAM_HEADER_LEN + pStream->fill / 2]);
+    pStream->fill = (uint8_t)(pStream->fill + numSamples);
+
+    if(pStream->fill < AUDIO_STREAM_SAMPLES_PER_PACKET)
+    {
+        return false;
+    }
+
+    /* Packet complete: flags are final only now (SetLast may come late) */
+    pData[1] = pStream->nextFlags;
+    pStream->nextFlags = 0;
+    pStream->fill = 0;
+    pStream->sequence++;
+
+    if(pStream->toSpare)
+    {
+        pStream->dropped++;
+    }
+    else
+    {
+        AUDIO_STREAM_BARRIER();
+        pStream->head = (uint8_t)(pStream->head + 1);
+        pStream->packets++;
+    }
+    return true;
+}
+
+const uint8_t* AudioStream_Peek(const AudioStream_t* pStream)
+{
+    uint8_t tail = pStream->tail;
+
+    if(tail == pStream->head)
+    {
+        return NULL;
+    }
+    AUDIO_STREAM_BARRIER();
+    return pStream->ring[tail & AUDIO_STREAM_SLOT_MASK];
+}
+
+void AudioStream_Pop(AudioStream_t* pStream)
+{
+    AUDIO_STREAM_BARRIER();
+    if(pStream->tail != pStream->head)
+    {
+        pStream->tail = (uint8_t)(pStream->tail + 1);
+    }
+}
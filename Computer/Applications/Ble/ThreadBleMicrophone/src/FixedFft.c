@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "FixedFft.c"
+ *
+ * Radix-2 decimation-in-time FFT on Q15 data.
+ *
+ * Per butterfly: 4 multiplies, 6 adds, 4 shifts, 4 saturations.  A 128-point transform
+ * is 448 butterflies plus the bit-reversal pass, roughly 10 k cycles on
+ * the Cortex-M4.
+ */
+
+#include "FixedFft.h"
+
+/* sin(2 * pi * k / 256) in Q15, k = 0..64 (one quadrant) */
+static const int16_t FixedFft_QuarterSine[65] = {
+        0,   804,  1608,  2411,  3212,  4011,  4808,  5602,
+     6393,  7180,  7962,  8740,  9512, 10279, 11039, 11793,
+    12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531,
+    18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595,
+    23170, 23732, 24279, 24812, 25330, 25833, 26320, 26791,
+    27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957,
+    30274, 30572, 30853, 31114, 31357, 31581, 31786, 31972,
+    32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758,
+    32767,
+};
+
+int16_t FixedFft_SinQ15(uint8_t phase)
+{
+    uint8_t quadrant = phase >> 6;
+    uint8_t index    = phase & 0x3F;
+
+    switch(quadrant)
+    {
+        case 0:
+            return FixedFft_QuarterSine[index];
+        case 1:
+            return FixedFft_QuarterSine[64 - index];
+        case 2:
+            return (int16_t)-FixedFft_QuarterSine[index];
+        default:
+            return (int16_t)-FixedFft_QuarterSine[64 - index];
+    }
+}
+
+/* Clamp a butterfly output to Q15: only full-scale complex input gets here */
+static inline int16_t FixedFft_Sat16(int32_t v)
+{
+    if(v > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if(v < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+static void FixedFft_BitReverse(int16_t* pRe, int16_t* pIm, uint16_t n)
+{
+    uint16_t j = 0;
+
+    for(uint16_t i = 0; i < n - 1; i++)
+    {
+        if(i < j)
+        {
+            int16_t t = pRe[i];
+            pRe[i]    = pRe[j];
+            pRe[j]    = t;
+            t         = pIm[i];
+            pIm[i]    = pIm[j];
+            pIm[j]    = t;
+        }
+
+        uint16_t bit = n >> 1;
+        while(j & bit)
+        {
+            j &= (uint16_t)~bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+void FixedFft_Forward(int16_t* pRe, int16_t* pIm, uint8_t log2N)
+{
+    uint16_t n = (uint16_t)(1U << log2N);
+
+    FixedFft_BitReverse(pRe, pIm, n);
+
+    for(uint8_t stage = 1; stage <= log2N; stage++)
+    {
+        uint16_t span = (uint16_t)(1U << stage);
+        uint16_t half = span >> 1;
+        /* Twiddle step in 1/256 turns: W_span^k = exp(-j 2 pi k / span) */
+        uint16_t step = (uint16_t)(256U >> stage);
+
+        for(uint16_t k = 0; k < half; k++)
+        {
+            uint8_t phase = (uint8_t)(k * step);
+            int32_t wr    = FixedFft_SinQ15((uint8_t)(phase + 64)); /* cos */
+            int32_t wi    = FixedFft_SinQ15(phase);                 /* sin */
+
+            for(uint16_t i = k; i < n; i += span)
+            {
+                uint16_t j = i + half;
+
+                /* t = x[j] * conj-rotated twiddle (cos - j sin) */
+                int32_t tr = (wr * pRe[j] + wi * pIm[j]) >> 15;
+                int32_t ti = (wr * pIm[j] - wi * pRe[j]) >> 15;
+
+                int32_t ur = pRe[i];
+                int32_t ui = pIm[i];
+
+                pRe[i] = FixedFft_Sat16((ur + tr) >> 1);
+                pIm[i] = FixedFft_Sat16((ui + ti) >> 1);
+                pRe[j] = FixedFft_Sat16((ur - tr) >> 1);
+                pIm[j] = FixedFft_Sat16((ui - ti) >> 1);
+            }
+        }
+    }
+}
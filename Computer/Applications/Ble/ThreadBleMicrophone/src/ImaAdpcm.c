@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+/** @file "ImaAdpcm.c"
+ *
+ * IMA/DVI ADPCM with the reference step/index tables and WAV (format 0x11)
+ * nibble order, so the gateway decoder (gateway/adpcm.py) and standard
+ * tools reconstruct exactly what the encoder tracked.
+ */
+
+#include "ImaAdpcm.h"
+
+static const int16_t ImaAdpcm_StepTable[IMA_ADPCM_MAX_INDEX + 1] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t ImaAdpcm_IndexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+void ImaAdpcm_Init(ImaAdpcm_State_t* pState)
+{
+    pState->predictor = 0;
+    pState->index     = 0;
+}
+
+/* Apply one 4-bit code to the state, returns the reconstructed sample */
+static inline int16_t ImaAdpcm_Step(ImaAdpcm_State_t* pState, uint8_t code)
+{
+    int32_t step = ImaAdpcm_StepTable[pState->index];
+    int32_t diff = step >> 3;
+
+    if(code & 4)
+    {
+        diff += step;
+    }
+    if(code & 2)
+    {
+        diff += step >> 1;
+    }
+    if(code & 1)
+    {
+        diff += step >> 2;
+    }
+
+    int32_t predictor = pState->predictor;
+    predictor += (code & 8) ? -diff : diff;
+    if(predictor > INT16_MAX)
+    {
+        predictor = INT16_MAX;
+    }
+    else if(predictor < INT16_MIN)
+    {
+        predictor = INT16_MIN;
+    }
+    pState->predictor = (int16_t)predictor;
+
+    int32_t index = (int32_t)pState->index + ImaAdpcm_IndexTable[code & 7];
+    if(index < 0)
+    {
+        index = 0;
+    }
+    else if(index > IMA_ADPCM_MAX_INDEX)
+    {
+        index = IMA_ADPCM_MAX_INDEX;
+    }
+    pState->index = (uint8_t)index;
+
+    return pState->predictor;
+}
+
+static inline uint8_t ImaAdpcm_EncodeSample(ImaAdpcm_State_t* pState, int16_t sample)
+{
+    int32_t step = ImaAdpcm_StepTable[pState->index];
+    int32_t diff = (int32_t)sample - pState->predictor;
+    uint8_t code = 0;
+
+    if(diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+    if(diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+    }
+    step >>= 1;
+    if(diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+    }
+    step >>= 1;
+    if(diff >= step)
+    {
+        code |= 1;
+    }
+
+    /* Track the decoder exactly so both sides stay in lock-step */
+    (void)ImaAdpcm_Step(pState, code);
+    return code;
+}
+
+void ImaAdpcm_Encode(ImaAdpcm_State_t* pState, const int16_t* pPcm, uint16_t numSamples,
+                     uint8_t* pOut)
+{
+    for(uint16_t i = 0; i + 1 < numSamples; i += 2)
+    {
+        uint8_t lo = ImaAdpcm_EncodeSample(pState, pPcm[i]);
+        uint8_t hi = ImaAdpcm_EncodeSample(pState, pPcm[i + 1]);
+        *pOut++ = (uint8_t)(lo | (hi << 4));
+    }
+}
+
+void ImaAdpcm_Decode(ImaAdpcm_State_t* pState, const uint8_t* pIn, uint16_t numSamples,
+                     int16_t* pPcm)
+{
+    for(uint16_t i = 0; i + 1 < numSamples; i += 2)
+    {
+        uint8_t byte = *pIn++;
+        pPcm[i]     = ImaAdpcm_Step(pState, byte & 0x0F);
+        pPcm[i + 1] = ImaAdpcm_Step(pState, byte >> 4);
+    }
+}
@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MicManager.cpp"
+ *
+ * PDM microphone capture and sound event detection.
+ *
+ * Data path (all in the capture task):
+ *
+ *   I2S DMA half (512 B, 4.1 ms)
+ *     -> PdmDecimator  : 32 PCM samples at 7.8125 kHz
+ *     -> frame buffer  : 128 samples (16.4 ms)
+ *     -> SoundDetector : level, band energies, onset, classification
+ *     -> AppManager::NotifySoundEvent(class, level, timestamp)
+ *
+ * While a listen-in stream is requested each decimated block is also fed
+ * to AudioStream (IMA-ADPCM, 96 samples per packet); completed packets are
+ * sent by the AppTask, which owns the OpenThread socket.
+ *
+ * Low-power listening (MIC_LOW_POWER_LISTEN): while nothing is heard the
+ * PDM clock runs at 500 kHz and only VoiceActivity looks at the raw blocks.
+ * Activity, or a listen-in request, switches to the full-rate path above;
+ * MIC_ACTIVE_HOLD_MS of quiet switches back.  Each switch restarts I2S at the
+ * new clock and asks the AppTask to change the sleep setting.
+ *
+ * CPU budget at 64 MHz: decimation ~2.5 %, detector ~1.3 %, ADPCM ~0.5 %;
+ * idle listening ~0.5 %.
+ */
+
+#include "MicManager.h"
+#include "AppManager.h"
+#include "gpLog.h"
+#include "qPinCfg.h"
+#include "qDrvI2S.h"
+
+#include "AudioStream.h"
+#include "PdmCapture.h"
+#include "PdmDecimator.h"
+#include "SoundDetector.h"
+#include "VoiceActivity.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* prescaler = (F_CLK / (2 * F_SCK)) - 1 = (64MHz / 2MHz) - 1 = 31 => F_SCK = 1 MHz */
+#define MIC_I2S_PRESCALER       31
+
+/* Idle: (64MHz / 1MHz) - 1 = 63 => F_SCK = 500 kHz, below the microphone's
+ * standard-mode clock range, so it drops to its low-power mode as well */
+#define MIC_IDLE_I2S_PRESCALER  63
+#define MIC_IDLE_PDM_CLOCK_HZ   500000UL
+
+/* PCM samples produced from one DMA half */
+#define MIC_PCM_PER_BLOCK       (PDM_CAPTURE_BLOCK_SIZE / (2 * PDM_DECIMATOR_WORDS_PER_PCM))
+
+/* Blocks must tile a detector frame exactly, otherwise sFrame overflows */
+static_assert((SOUND_DETECTOR_FRAME_LEN % MIC_PCM_PER_BLOCK) == 0, "frame must be a whole number of DMA blocks");
+/* Same for stream packets, AudioStream_Write() never splits a block */
+static_assert((AUDIO_STREAM_SAMPLES_PER_PACKET % MIC_PCM_PER_BLOCK) == 0, "packet must be a whole number of DMA blocks");
+
+/* -------------------------------------------------------------------------
+ * Static members
+ * ------------------------------------------------------------------------- */
+uint32_t MicManager::sFrameCount = 0;
+uint32_t MicManager::sEventCount = 0;
+uint32_t MicManager::sSampleCount = 0;
+uint32_t MicManager::sWakeCount = 0;
+bool     MicManager::sLowPower = false;
+
+/* FreeRTOS task storage */
+#define MIC_TASK_STACK_SIZE     (4 * configMINIMAL_STACK_SIZE)
+#define MIC_TASK_PRIORITY       (tskIDLE_PRIORITY + 2)
+
+static StaticTask_t sMicTask;
+static StackType_t  sMicStack[MIC_TASK_STACK_SIZE];
+
+static qDrvI2S_t sI2sDrv = Q_DRV_I2S_INSTANCE_DEFINE(APP_MIC_I2S_INSTANCE);
+
+static PdmDecimator_t sDecimator;
+static int16_t        sFrame[SOUND_DETECTOR_FRAME_LEN];
+static uint16_t       sFrameFill = 0;
+
+/* Listen-in stream.  The AppTask posts a request by writing the length and
+ * then bumping the id; only the capture task touches the encoder side. */
+static AudioStream_t     sStream;
+static volatile uint32_t sStreamRequestId      = 0;
+static volatile uint32_t sStreamRequestPackets = 0;
+static uint32_t          sStreamRequestSeen    = 0;
+static uint32_t          sStreamPacketsLeft    = 0;
+
+/* Low-power listening */
+static VoiceActivity_t sVad;
+static TickType_t      sLastActivity;
+
+/* -------------------------------------------------------------------------
+ * Init  - I2S pins, DMA capture, decimator and detector
+ * ------------------------------------------------------------------------- */
+bool MicManager::Init(void)
+{
+    qDrvI2S_PinConfig_t pinCfg = Q_DRV_I2S_MASTER_RX_PIN_CONFIG(APP_MIC_I2S_INSTANCE,
+                                                                APP_MIC_SDI_GPIO,
+                                                                APP_MIC_SCK_GPIO,
+                                                                APP_MIC_WS_GPIO);
+    qResult_t res = qDrvI2S_PinConfigSet(&pinCfg, qDrvI2S_ModeMasterRx);
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("[MIC] I2S pin config failed: %d", 0, res);
+        return false;
+    }
+
+    sLowPower = (MIC_LOW_POWER_LISTEN != 0);
+    res = PdmCapture_Init(&sI2sDrv, sLowPower ? MIC_IDLE_I2S_PRESCALER : MIC_I2S_PRESCALER);
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("[MIC] I2S DMA init failed: %d", 0, res);
+        return false;
+    }
+
+    PdmDecimator_Init(&sDecimator);
+    VoiceActivity_Init(&sVad, MIC_IDLE_PDM_CLOCK_HZ);
+    AudioStream_Init(&sStream);
+    SoundDetector_Init(SoundDetector_DefaultRules, SoundDetector_NumDefaultRules);
+
+    GP_LOG_SYSTEM_PRINTF("[MIC] PDM mic ready: SCK GPIO%d, SDI GPIO%d, WS GPIO%d", 0,
+                         APP_MIC_SCK_GPIO, APP_MIC_SDI_GPIO, APP_MIC_WS_GPIO);
+    GP_LOG_SYSTEM_PRINTF("[MIC] PCM %lu Hz, frame %u samples, %s", 0,
+                         (unsigned long)PDM_DECIMATOR_PCM_RATE_HZ, SOUND_DETECTOR_FRAME_LEN,
+                         sLowPower ? "low-power listening" : "always full rate");
+    return true;
+}
+
+/* -------------------------------------------------------------------------
+ * StartCapture  - creates the FreeRTOS capture task
+ * ------------------------------------------------------------------------- */
+void MicManager::StartCapture(void)
+{
+    TaskHandle_t handle =
+        xTaskCreateStatic(CaptureTask, "MicCapture", MIC_TASK_STACK_SIZE,
+                          nullptr, MIC_TASK_PRIORITY, sMicStack, &sMicTask);
+    Q_ASSERT(handle != nullptr);
+}
+
+/* -------------------------------------------------------------------------
+ * GetFrameCount
+ * ------------------------------------------------------------------------- */
+uint32_t MicManager::GetFrameCount(void)
+{
+    return sFrameCount;
+}
+
+/* -------------------------------------------------------------------------
+ * IsLowPower
+ * ------------------------------------------------------------------------- */
+bool MicManager::IsLowPower(void)
+{
+    return sLowPower;
+}
+
+/* -------------------------------------------------------------------------
+ * RequestStream  - AppTask context, picked up by the capture task
+ * ------------------------------------------------------------------------- */
+void MicManager::RequestStream(uint8_t durationSec)
+{
+    uint32_t seconds = (durationSec > MIC_STREAM_MAX_DURATION_S) ? MIC_STREAM_MAX_DURATION_S : durationSec;
+
+    sStreamRequestPackets = (seconds * PDM_DECIMATOR_PCM_RATE_HZ + AUDIO_STREAM_SAMPLES_PER_PACKET - 1) /
+                            AUDIO_STREAM_SAMPLES_PER_PACKET;
+    sStreamRequestId = sStreamRequestId + 1;
+}
+
+/* -------------------------------------------------------------------------
+ * PeekStreamPacket / PopStreamPacket  - AppTask context
+ * ------------------------------------------------------------------------- */
+const uint8_t* MicManager::PeekStreamPacket(void)
+{
+    return AudioStream_Peek(&sStream);
+}
+
+void MicManager::PopStreamPacket(void)
+{
+    AudioStream_Pop(&sStream);
+}
+
+/* -------------------------------------------------------------------------
+ * StreamBlock  - apply pending requests, encode one decimated block
+ * ------------------------------------------------------------------------- */
+void MicManager::StreamBlock(const int16_t* pPcm, uint16_t numSamples)
+{
+    uint32_t requestId = sStreamRequestId;
+
+    if(requestId != sStreamRequestSeen)
+    {
+        uint32_t packets = sStreamRequestPackets;
+        sStreamRequestSeen = requestId;
+
+        if(packets == 0)
+        {
+            /* Stop: finish the packet in progress and flag it as the last */
+            if(sStreamPacketsLeft > 1)
+            {
+                sStreamPacketsLeft = 1;
+            }
+        }
+        else
+        {
+            if(sStreamPacketsLeft == 0)
+            {
+                AudioStream_Begin(&sStream);
+                GP_LOG_SYSTEM_PRINTF("[MIC] Stream started (%lu packets)", 0, (unsigned long)packets);
+            }
+            sStreamPacketsLeft = packets;
+        }
+    }
+
+    if(sStreamPacketsLeft > 0)
+    {
+        AudioStream_SetLast(&sStream, sStreamPacketsLeft == 1);
+        if(AudioStream_Write(&sStream, pPcm, numSamples, sSampleCount))
+        {
+            AppManager::NotifyStreamPacket();
+            sStreamPacketsLeft--;
+            if(sStreamPacketsLeft == 0)
+            {
+                GP_LOG_SYSTEM_PRINTF("[MIC] Stream stopped: %lu packets queued, %lu dropped", 0,
+                                     (unsigned long)sStream.packets, (unsigned long)sStream.dropped);
+            }
+        }
+    }
+
+    sSampleCount += numSamples;
+}
+
+/* -------------------------------------------------------------------------
+ * SetLowPower  - capture task context: restart I2S at the mode's clock
+ * ------------------------------------------------------------------------- */
+void MicManager::SetLowPower(bool lowPower)
+{
+    qResult_t res = PdmCapture_Restart(lowPower ? MIC_IDLE_I2S_PRESCALER : MIC_I2S_PRESCALER);
+    if(res != Q_OK)
+    {
+        /* Capture stays stopped; the wait timeout retries at the new clock */
+        GP_LOG_SYSTEM_PRINTF("[MIC] Clock change failed: %d", 0, res);
+    }
+
+    sLowPower = lowPower;
+    if(lowPower)
+    {
+        VoiceActivity_Rearm(&sVad);
+        GP_LOG_SYSTEM_PRINTF("[MIC] Quiet for %u ms: low-power listening", 0, MIC_ACTIVE_HOLD_MS);
+    }
+    else
+    {
+        /* The decimator state belongs to the old clock; frames restart clean */
+        PdmDecimator_Init(&sDecimator);
+        sFrameFill    = 0;
+        sLastActivity = xTaskGetTickCount();
+        sWakeCount++;
+    }
+
+    AppManager::NotifyPowerMode(lowPower);
+}
+
+/* -------------------------------------------------------------------------
+ * ProcessFullRate  - decimate one DMA half, detector every frame
+ * @return true if something was heard (keeps the node at full rate)
+ * ------------------------------------------------------------------------- */
+bool MicManager::ProcessFullRate(const uint8_t* pBlock)
+{
+    uint16_t produced = PdmDecimator_Process(&sDecimator, pBlock, PDM_CAPTURE_BLOCK_SIZE,
+                                             &sFrame[sFrameFill]);
+    if(!PdmCapture_ReleaseBlock(pBlock))
+    {
+        /* Overwritten while decimated: drop it and restart the frame clean */
+        PdmDecimator_Init(&sDecimator);
+        sFrameFill = 0;
+        return false;
+    }
+
+    StreamBlock(&sFrame[sFrameFill], produced);
+    sFrameFill += produced;
+
+    if(sFrameFill < SOUND_DETECTOR_FRAME_LEN)
+    {
+        return false;
+    }
+    sFrameFill = 0;
+    sFrameCount++;
+
+    SoundDetector_Event_t event;
+    bool                  heard = SoundDetector_ProcessFrame(sFrame, &event);
+    if(heard)
+    {
+        /* Back-date the timestamp to the onset frame */
+        uint32_t nowMs   = (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+        uint32_t delayMs = ((uint32_t)event.latencyFrames * SOUND_DETECTOR_FRAME_US) / 1000;
+
+        sEventCount++;
+        AppManager::NotifySoundEvent(event.classId, event.levelDb, nowMs - delayMs);
+    }
+
+    const SoundDetector_Features_t* pFeat = SoundDetector_GetFeatures();
+    return heard || (pFeat->rmsDbQ8 > pFeat->backgroundDbQ8 + MIC_ACTIVE_MARGIN_DB * 256);
+}
+
+/* -------------------------------------------------------------------------
+ * CaptureTask  - low-power listening or full-rate detection per DMA half
+ * ------------------------------------------------------------------------- */
+void MicManager::CaptureTask(void* /*pvParameters*/)
+{
+    TickType_t lastStats = xTaskGetTickCount();
+
+    qResult_t res = PdmCapture_Start(xTaskGetCurrentTaskHandle());
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("[MIC] Capture start failed: %d", 0, res);
+        vTaskDelete(nullptr);
+        return;
+    }
+    AppManager::NotifyPowerMode(sLowPower);
+
+    while(true)
+    {
+        const UInt8* pBlock = PdmCapture_WaitBlock(pdMS_TO_TICKS(500));
+        if(pBlock == nullptr)
+        {
+            /* Also recovers capture stopped by a failed clock change */
+            GP_LOG_SYSTEM_PRINTF("[MIC] Capture timeout, restarting", 0);
+            PdmCapture_Restart(PdmCapture_GetPrescaler());
+            continue;
+        }
+
+        /* A listen-in request needs full-rate audio, whatever the level */
+        bool streaming = (sStreamPacketsLeft > 0) || (sStreamRequestId != sStreamRequestSeen);
+
+        if(sLowPower)
+        {
+            bool active = VoiceActivity_Process(&sVad, pBlock, PDM_CAPTURE_BLOCK_SIZE);
+            /* A block overwritten while it was read is no evidence of activity */
+            active = PdmCapture_ReleaseBlock(pBlock) && active;
+
+            if(active || streaming)
+            {
+                GP_LOG_SYSTEM_PRINTF("[MIC] %s (level %lu x floor): full-rate capture", 0,
+                                     active ? "Activity" : "Listen-in",
+                                     (unsigned long)(sVad.energy / sVad.floor));
+                SetLowPower(false);
+            }
+        }
+        else if(ProcessFullRate(pBlock) || streaming || !MIC_LOW_POWER_LISTEN)
+        {
+            sLastActivity = xTaskGetTickCount();
+        }
+        else if((xTaskGetTickCount() - sLastActivity) >= pdMS_TO_TICKS(MIC_ACTIVE_HOLD_MS))
+        {
+            SetLowPower(true);
+        }
+
+#if MIC_STATS_INTERVAL_MS > 0
+        if((xTaskGetTickCount() - lastStats) >= pdMS_TO_TICKS(MIC_STATS_INTERVAL_MS))
+        {
+            PdmCapture_Stats_t stats;
+            PdmCapture_GetStats(&stats);
+            const SoundDetector_Features_t* pFeat = SoundDetector_GetFeatures();
+
+            GP_LOG_SYSTEM_PRINTF("[MIC] frames:%lu events:%lu ovr:%lu level:%d dB bg:%d dB", 0,
+                                 (unsigned long)sFrameCount, (unsigned long)sEventCount,
+                                 (unsigned long)stats.overruns, pFeat->rmsDbQ8 / 256,
+                                 pFeat->backgroundDbQ8 / 256);
+            GP_LOG_SYSTEM_PRINTF("[MIC] %s wakes:%lu vad floor:%lu zc:%u Hz restarts:%lu", 0,
+                                 sLowPower ? "idle" : "active", (unsigned long)sWakeCount,
+                                 (unsigned long)sVad.floor, sVad.zeroCrossHz,
+                                 (unsigned long)stats.restarts);
+            lastStats = xTaskGetTickCount();
+        }
+#endif
+    }
+}
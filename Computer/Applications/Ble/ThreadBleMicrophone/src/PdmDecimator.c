@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "PdmDecimator.c"
+ *
+ * Fixed-point PDM to PCM conversion.
+ *
+ * Cost per 16-bit PDM word: one popcount, three integrator adds.  Per PCM
+ * sample (every 8 words): three comb subtractions plus the DC blocker.
+ * At 62.5 k words/s this is roughly 1.5 M cycles/s, about 2-3 % of the
+ * 64 MHz Cortex-M4.
+ *
+ * CIC gain is R^N = 8^3 = 512, so the -8..+8 stage-1 output reaches
+ * +-4096 and is shifted left by 3 to use the full 16-bit range.
+ * Integrators are unsigned and allowed to wrap: the combs undo the wrap
+ * as long as the final result fits in 32 bits, which it always does here.
+ */
+
+#include "PdmDecimator.h"
+
+#include <string.h>
+
+/* Stage-2 output scaling to full 16-bit range */
+#define PDM_DECIMATOR_OUTPUT_SHIFT 3
+
+/* DC blocker pole, 0.995 in Q15 (-3 dB at ~6 Hz for 7.8 kHz) */
+#define PDM_DECIMATOR_DC_POLE_Q15  32604
+
+void PdmDecimator_Init(PdmDecimator_t* pDec)
+{
+    memset(pDec, 0, sizeof(*pDec));
+}
+
+static inline int16_t PdmDecimator_Saturate(int32_t value)
+{
+    if(value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if(value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+
+uint16_t PdmDecimator_Process(PdmDecimator_t* pDec, const uint8_t* pPdm, uint16_t numBytes,
+                              int16_t* pPcm)
+{
+    uint16_t produced = 0;
+
+    for(uint16_t i = 0; i + 1 < numBytes; i += 2)
+    {
+        uint16_t word = (uint16_t)((uint16_t)pPdm[i] | ((uint16_t)pPdm[i + 1] << 8));
+
+        /* Stage 1: boxcar over 16 PDM bits, centred on zero */
+        int32_t x = (int32_t)__builtin_popcount(word) - 8;
+
+        /* Stage 2: integrators at the word rate */
+        pDec->integrator[0] += (uint32_t)x;
+        pDec->integrator[1] += pDec->integrator[0];
+        pDec->integrator[2] += pDec->integrator[1];
+
+        if(++pDec->phase < PDM_DECIMATOR_WORDS_PER_PCM)
+        {
+            continue;
+        }
+        pDec->phase = 0;
+
+        /* Stage 2: combs at the PCM rate */
+        uint32_t acc = pDec->integrator[2];
+        for(uint8_t s = 0; s < PDM_DECIMATOR_CIC_ORDER; s++)
+        {
+            uint32_t prev = pDec->comb[s];
+            pDec->comb[s] = acc;
+            acc           = acc - prev;
+        }
+        int32_t y = (int32_t)acc * (1 << PDM_DECIMATOR_OUTPUT_SHIFT);
+
+        /* DC blocker: out = in - prevIn + pole * prevOut */
+        int32_t out = y - pDec->dcPrevIn +
+                      (int32_t)(((int64_t)pDec->dcPrevOut * PDM_DECIMATOR_DC_POLE_Q15) >> 15);
+        pDec->dcPrevIn  = y;
+        pDec->dcPrevOut = out;
+
+        pPcm[produced++] = PdmDecimator_Saturate(out);
+    }
+
+    return produced;
+}
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "SoundDetector.c"
+ *
+ * Acoustic event detector: frame level, FFT band energies, onset tracking
+ * and rule-based classification.  Integer arithmetic only.
+ *
+ * Cost per 128-sample frame (61 frames/s), Cortex-M4 estimate:
+ *   level + window   :  ~1.5 k cycles
+ *   128-point FFT    :  ~10 k cycles
+ *   band energies    :  ~1 k cycles
+ *   => ~0.8 M cycles/s, about 1.3 % of the 64 MHz CPU.
+ *
+ * Detector states:
+ *   Idle   : background level tracked; onset when level > background + ONSET_DB
+ *   Active : peak level / band peaks accumulated until the level drops back
+ *            or DECISION_FRAMES have passed, then the rules are evaluated
+ *   Hold   : refractory period; also waits for a sustained sound to end so
+ *            it is reported once.  Background keeps adapting so a new steady
+ *            noise eventually becomes the new background.
+ */
+
+#include "SoundDetector.h"
+#include "FixedFft.h"
+
+#include <string.h>
+
+/* clang-format off */
+const SoundDetector_ClassRule_t SoundDetector_DefaultRules[] = {
+    /* classId                  minPeakDb minRiseDb bandMask                                                maxFrames */
+    { SOUND_CLASS_KNOCK,        -45,      15,       SOUND_BAND_MASK(SOUND_BAND_LOW) | SOUND_BAND_MASK(SOUND_BAND_MID),  4 },
+    { SOUND_CLASS_GLASS_BREAK,  -35,      18,       SOUND_BAND_MASK(SOUND_BAND_HIGH) | SOUND_BAND_MASK(SOUND_BAND_TOP), 0 },
+    { SOUND_CLASS_LOUD_NOISE,   -15,      SOUND_DETECTOR_ONSET_DB, SOUND_BAND_MASK_ANY,                                 0 },
+};
+/* clang-format on */
+const uint8_t SoundDetector_NumDefaultRules =
+    (uint8_t)(sizeof(SoundDetector_DefaultRules) / sizeof(SoundDetector_DefaultRules[0]));
+
+/* First and last FFT bin of each band */
+static const uint8_t SoundDetector_BandBins[SOUND_DETECTOR_NUM_BANDS][2] = {
+    {1, 8}, {9, 24}, {25, 49}, {50, 63},
+};
+
+/* Block floating point: scale the frame so its peak sits just below 2^14 */
+#define SOUND_DETECTOR_NORM_BITS 14
+
+/* 10 * log10(2) in Q8 */
+#define SOUND_DETECTOR_DB_PER_LOG2_Q8 771
+
+typedef enum
+{
+    kDetectorState_Idle = 0,
+    kDetectorState_Active,
+    kDetectorState_Hold,
+} DetectorState_t;
+
+static const SoundDetector_ClassRule_t* sRules;
+static uint8_t                          sNumRules;
+
+static DetectorState_t          sState;
+static bool                     sBackgroundValid;
+static SoundDetector_Features_t sFeatures;
+
+/* Active-event accumulators */
+static int16_t sPeakDbQ8;
+static int16_t sBandPeakDbQ8[SOUND_DETECTOR_NUM_BANDS];
+static uint8_t sEventFrames;
+static uint8_t sHoldFrames;
+
+/* FFT work buffers and window */
+static int16_t sFftRe[SOUND_DETECTOR_FRAME_LEN];
+static int16_t sFftIm[SOUND_DETECTOR_FRAME_LEN];
+static int16_t sHannQ15[SOUND_DETECTOR_FRAME_LEN];
+
+/* -------------------------------------------------------------------------
+ * Helpers
+ * ------------------------------------------------------------------------- */
+
+/* log2(x) in Q8, x > 0.  Mantissa uses log2(1+f) ~= f + 0.343 f (1-f),
+ * max error ~0.01 (0.03 dB). */
+static int32_t SoundDetector_Log2Q8(uint32_t x)
+{
+    int32_t  msb = 31 - __builtin_clz(x);
+    uint32_t f;
+
+    if(msb >= 8)
+    {
+        f = (x >> (msb - 8)) & 0xFF;
+    }
+    else
+    {
+        f = (x << (8 - msb)) & 0xFF;
+    }
+    f += (f * (256 - f) * 88) >> 16;
+
+    return msb * 256 + (int32_t)f;
+}
+
+/* 10*log10(power) relative to 2^refLog2, in Q8 */
+static int16_t SoundDetector_PowerDbQ8(uint32_t power, int32_t refLog2Q8)
+{
+    if(power == 0)
+    {
+        return (int16_t)(SOUND_DETECTOR_FLOOR_DB * 256);
+    }
+
+    int32_t db = ((SoundDetector_Log2Q8(power) - refLog2Q8) * SOUND_DETECTOR_DB_PER_LOG2_Q8) >> 8;
+    if(db < SOUND_DETECTOR_FLOOR_DB * 256)
+    {
+        db = SOUND_DETECTOR_FLOOR_DB * 256;
+    }
+    return (int16_t)db;
+}
+
+static void SoundDetector_UpdateBackground(int16_t levelDbQ8)
+{
+    int32_t bg = sFeatures.backgroundDbQ8;
+
+    if(!sBackgroundValid)
+    {
+        sFeatures.backgroundDbQ8 = levelDbQ8;
+        sBackgroundValid         = true;
+        return;
+    }
+
+    /* Follow quiet periods quickly, new loud steady noise slowly (~1 s) */
+    if(levelDbQ8 < bg)
+    {
+        bg += (levelDbQ8 - bg) / 4;
+    }
+    else
+    {
+        bg += (levelDbQ8 - bg) / 64;
+    }
+    sFeatures.backgroundDbQ8 = (int16_t)bg;
+}
+
+static bool SoundDetector_Classify(bool ended, SoundDetector_Event_t* pEvent)
+{
+    uint8_t dominant = 0;
+    for(uint8_t b = 1; b < SOUND_DETECTOR_NUM_BANDS; b++)
+    {
+        if(sBandPeakDbQ8[b] > sBandPeakDbQ8[dominant])
+        {
+            dominant = b;
+        }
+    }
+
+    int32_t rise = (sPeakDbQ8 - sFeatures.backgroundDbQ8) / 256;
+    if(rise < 0)
+    {
+        rise = 0;
+    }
+    int32_t peakDb = sPeakDbQ8 / 256;
+
+    for(uint8_t r = 0; r < sNumRules; r++)
+    {
+        const SoundDetector_ClassRule_t* pRule = &sRules[r];
+
+        if(peakDb < pRule->minPeakDb || rise < pRule->minRiseDb)
+        {
+            continue;
+        }
+        if((pRule->bandMask & SOUND_BAND_MASK(dominant)) == 0)
+        {
+            continue;
+        }
+        if(pRule->maxFrames != 0 && (!ended || sEventFrames > pRule->maxFrames))
+        {
+            continue;
+        }
+
+        pEvent->classId        = pRule->classId;
+        pEvent->levelDb        = (int8_t)peakDb;
+        pEvent->riseDb         = (uint8_t)(rise > 255 ? 255 : rise);
+        pEvent->dominantBand   = dominant;
+        pEvent->durationFrames = sEventFrames;
+        pEvent->latencyFrames  = ended ? (uint8_t)(sEventFrames + 1) : sEventFrames;
+        return true;
+    }
+
+    return false;
+}
+
+/* Level and band energies of one frame into sFeatures */
+static void SoundDetector_Analyse(const int16_t* pFrame)
+{
+    uint64_t sumSq = 0;
+    uint16_t peak  = 0;
+
+    for(uint16_t n = 0; n < SOUND_DETECTOR_FRAME_LEN; n++)
+    {
+        int32_t x = pFrame[n];
+        sumSq += (uint64_t)(x * x);
+        uint16_t mag = (uint16_t)(x < 0 ? -x : x);
+        if(mag > peak)
+        {
+            peak = mag;
+        }
+    }
+
+    /* 0 dBFS = full-scale square wave (mean square 2^30) */
+    sFeatures.rmsDbQ8 = SoundDetector_PowerDbQ8((uint32_t)(sumSq >> SOUND_DETECTOR_FFT_LOG2), 30 * 256);
+
+    /* Normalise, window, transform */
+    uint8_t shift = 0;
+    while(shift < SOUND_DETECTOR_NORM_BITS && ((uint32_t)peak << (shift + 1)) < (1U << SOUND_DETECTOR_NORM_BITS))
+    {
+        shift++;
+    }
+
+    for(uint16_t n = 0; n < SOUND_DETECTOR_FRAME_LEN; n++)
+    {
+        int32_t x = (int32_t)pFrame[n] * (1 << shift);
+        sFftRe[n] = (int16_t)((x * sHannQ15[n]) >> 15);
+        sFftIm[n] = 0;
+    }
+
+    FixedFft_Forward(sFftRe, sFftIm, SOUND_DETECTOR_FFT_LOG2);
+
+    /* Parseval: sum of |X/N|^2 over all bins = mean((x w)^2) < 2^28, so each
+     * band sum fits in 32 bits.  Band power in input units is
+     * 2 * energy / 2^(2 * shift) (x2 for the negative-frequency bins);
+     * against the 2^30 full-scale reference that is a 2^(2 * shift + 29)
+     * divisor.  Levels read ~4.3 dB below rmsDbQ8 due to the Hann window. */
+    for(uint8_t b = 0; b < SOUND_DETECTOR_NUM_BANDS; b++)
+    {
+        uint32_t energy = 0;
+        for(uint8_t k = SoundDetector_BandBins[b][0]; k <= SoundDetector_BandBins[b][1]; k++)
+        {
+            energy += FixedFft_MagSq(sFftRe[k], sFftIm[k]);
+        }
+        sFeatures.bandDbQ8[b] = SoundDetector_PowerDbQ8(energy, (2 * shift + 29) * 256);
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void SoundDetector_Init(const SoundDetector_ClassRule_t* pRules, uint8_t numRules)
+{
+    sRules    = pRules;
+    sNumRules = numRules;
+
+    sState           = kDetectorState_Idle;
+    sBackgroundValid = false;
+    sEventFrames     = 0;
+    sHoldFrames      = 0;
+    memset(&sFeatures, 0, sizeof(sFeatures));
+
+    /* Hann window: w[n] = sin^2(pi n / N), pi n / N = (n * 128 / N) / 256 turns */
+    for(uint16_t n = 0; n < SOUND_DETECTOR_FRAME_LEN; n++)
+    {
+        int32_t s   = FixedFft_SinQ15((uint8_t)(n * (128U / SOUND_DETECTOR_FRAME_LEN)));
+        sHannQ15[n] = (int16_t)((s * s) >> 15);
+    }
+}
+
+bool SoundDetector_ProcessFrame(const int16_t* pFrame, SoundDetector_Event_t* pEvent)
+{
+    bool reported = false;
+
+    SoundDetector_Analyse(pFrame);
+    sFeatures.onset = false;
+
+    int16_t level     = sFeatures.rmsDbQ8;
+    int16_t onsetAt   = (int16_t)(sFeatures.backgroundDbQ8 + SOUND_DETECTOR_ONSET_DB * 256);
+    int16_t releaseAt = (int16_t)(sFeatures.backgroundDbQ8 + SOUND_DETECTOR_ONSET_DB * 128);
+
+    switch(sState)
+    {
+        case kDetectorState_Idle:
+            if(sBackgroundValid && level >= onsetAt)
+            {
+                sFeatures.onset = true;
+                sState          = kDetectorState_Active;
+                sEventFrames    = 1;
+                sPeakDbQ8       = level;
+                memcpy(sBandPeakDbQ8, sFeatures.bandDbQ8, sizeof(sBandPeakDbQ8));
+            }
+            else
+            {
+                SoundDetector_UpdateBackground(level);
+            }
+            break;
+
+        case kDetectorState_Active:
+        {
+            bool ended = (level < releaseAt);
+
+            if(!ended)
+            {
+                sEventFrames++;
+                if(level > sPeakDbQ8)
+                {
+                    sPeakDbQ8 = level;
+                }
+                for(uint8_t b = 0; b < SOUND_DETECTOR_NUM_BANDS; b++)
+                {
+                    if(sFeatures.bandDbQ8[b] > sBandPeakDbQ8[b])
+                    {
+                        sBandPeakDbQ8[b] = sFeatures.bandDbQ8[b];
+                    }
+                }
+            }
+
+            if(ended || sEventFrames >= SOUND_DETECTOR_DECISION_FRAMES)
+            {
+                reported    = SoundDetector_Classify(ended, pEvent);
+                sState      = kDetectorState_Hold;
+                sHoldFrames = 0;
+            }
+            break;
+        }
+
+        case kDetectorState_Hold:
+        default:
+            SoundDetector_UpdateBackground(level);
+            if(sHoldFrames < SOUND_DETECTOR_REFRACTORY_FRAMES)
+            {
+                sHoldFrames++;
+            }
+            else if(level < releaseAt)
+            {
+                sState = kDetectorState_Idle;
+            }
+            break;
+    }
+
+    return reported;
+}
+
+const SoundDetector_Features_t* SoundDetector_GetFeatures(void)
+{
+    return &sFeatures;
+}
@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "ThreadBleMicrophone_Config.c"
+ *
+ * BLE GATT attribute table for the QPG6200 Thread+BLE Microphone.
+ *
+ * Three GATT services:
+ *
+ *  1. Battery Service  (0x180F)   - standard, visible in nRF Connect
+ *  2. Sound Event Service         - classified sound event notifications
+ *  3. Thread Config Service       - commission Thread network via BLE
+ *
+ * --- Thread Config Service workflow ---
+ *  a) Connect via nRF Connect / Qorvo Connect.
+ *  b) Write Thread Network Name characteristic (up to 16 bytes, e.g. "DoorbellNet").
+ *  c) Write Thread Network Key characteristic  (16-byte master key, write-only).
+ *  d) Optionally write Channel (1 byte, 11-26, or 0 for the quietest channel
+ *     of an energy survey, MeshChannel.h) and PAN ID (2 bytes LE).
+ *  e) Write 0x01 to the Join characteristic to start Thread network join.
+ *  f) Subscribe to Thread Status notifications to watch the device role.
+ *  Or, instead of b) to e): write a whole Active Operational Dataset
+ *  ("ot-ctl dataset active -x") to the Dataset characteristic; the device
+ *  applies it and joins, or reports THREAD_STATUS_REJECTED.
+ *  g) Optionally write 0x01 to the Survey characteristic to measure channels
+ *     11-26, then read it back for the ranking (MeshChannel.h).
+ *  h) Optionally write this node's event signing key (16 bytes) and the
+ *     keys of the senders it trusts (device id + key) to the Auth
+ *     characteristic (MeshAuth.h), all in one connection: the keys are
+ *     locked when it closes.  Reading it returns the device id.
+ *  i) Instead of a) - g), write 0x01 (or 0x01 + PSKd) to the Joiner
+ *     characteristic to get the credentials from a Thread commissioner
+ *     (MeshJoiner.h); progress is on the Thread Status characteristic.
+ *
+ * --- Sound Event Service workflow ---
+ *  a) Enable notifications on the Sound Event characteristic.
+ *  b) Knock / break glass / make a loud noise near the microphone.
+ *  c) Notification: class id, peak level (dBFS), timestamp (ms, LE).
+ */
+
+#include "BleIf.h"
+#include "bstream.h"
+#include "qReg.h"
+#include "ThreadBleMicrophone_Config.h"
+#include "MeshAuth.h"
+#include "MeshChannel.h"
+#include "MeshDataset.h"
+#include "MeshDiag.h"
+#include "MeshJoiner.h"
+
+#define BLE_CHARACTERISTIC_VALUE_UUID_OFFSET 3
+
+/* =========================================================================
+ *  UUID definitions
+ * ========================================================================= */
+
+/* Sound Event Service UUID (128-bit)  : 4D494300-0000-1000-8000-00805F9B3400 ("MIC") */
+#define SOUND_SERVICE_UUID_128 \
+    0x00, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x43, 0x49, 0x4D
+
+/* Sound Event Characteristic UUID     : 4D494300-0000-1000-8000-00805F9B3401 */
+#define SOUND_EVENT_CHAR_UUID_128 \
+    0x01, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x43, 0x49, 0x4D
+
+/* Thread Config Service UUID (128-bit) : D00RBELL-0002-1000-8000-00805F9B3400 */
+#define THREAD_CFG_SERVICE_UUID_128 \
+    0x00, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Network Name Characteristic : D00RBELL-0002-1000-8000-00805F9B3401 */
+#define THREAD_NET_NAME_CHAR_UUID_128 \
+    0x01, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Network Key Characteristic  : D00RBELL-0002-1000-8000-00805F9B3402 */
+#define THREAD_NET_KEY_CHAR_UUID_128 \
+    0x02, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Channel Characteristic      : D00RBELL-0002-1000-8000-00805F9B3403 */
+#define THREAD_CHANNEL_CHAR_UUID_128 \
+    0x03, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread PAN ID Characteristic       : D00RBELL-0002-1000-8000-00805F9B3404 */
+#define THREAD_PANID_CHAR_UUID_128 \
+    0x04, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Join Characteristic         : D00RBELL-0002-1000-8000-00805F9B3405 */
+#define THREAD_JOIN_CHAR_UUID_128 \
+    0x05, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Status Characteristic       : D00RBELL-0002-1000-8000-00805F9B3406 */
+#define THREAD_STATUS_CHAR_UUID_128 \
+    0x06, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Diagnostics Characteristic  : D00RBELL-0002-1000-8000-00805F9B3407 */
+#define THREAD_DIAG_CHAR_UUID_128 \
+    0x07, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Dataset Characteristic      : D00RBELL-0002-1000-8000-00805F9B3408 */
+#define THREAD_DATASET_CHAR_UUID_128 \
+    0x08, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Survey Characteristic       : D00RBELL-0002-1000-8000-00805F9B340A */
+#define THREAD_SURVEY_CHAR_UUID_128 \
+    0x0A, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Auth Characteristic         : D00RBELL-0002-1000-8000-00805F9B340B */
+#define THREAD_AUTH_CHAR_UUID_128 \
+    0x0B, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Joiner Characteristic       : D00RBELL-0002-1000-8000-00805F9B340C */
+#define THREAD_JOINER_CHAR_UUID_128 \
+    0x0C, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Standard GATT UUIDs */
+static const uint8_t attTypePrimSvcUuid[ATT_16_UUID_LEN]  = {UINT16_TO_BYTES(ATT_UUID_PRIMARY_SERVICE)};
+static const uint8_t attTypeCharUuid[ATT_16_UUID_LEN]     = {UINT16_TO_BYTES(ATT_UUID_CHARACTERISTIC)};
+static const uint8_t attTypeCliChCfgUuid[ATT_16_UUID_LEN] = {UINT16_TO_BYTES(ATT_UUID_CLIENT_CHAR_CONFIG)};
+
+/* =========================================================================
+ *  Battery Service
+ * ========================================================================= */
+
+static const uint8_t  batterySvcUuid[]   = {UINT16_TO_BYTES(ATT_UUID_BATTERY_SERVICE)};
+static const uint16_t batterySvcLen      = sizeof(batterySvcUuid);
+
+static const uint8_t  batteryCh[]        = {ATT_PROP_READ | ATT_PROP_NOTIFY,
+                                             UINT16_TO_BYTES(BATTERY_LEVEL_HDL),
+                                             UINT16_TO_BYTES(ATT_UUID_BATTERY_LEVEL)};
+static const uint16_t batteryChLen       = sizeof(batteryCh);
+
+static uint8_t        batteryChValue[1]  = {100};
+static const uint16_t batteryChValueLen  = sizeof(batteryChValue);
+
+static uint8_t        batteryLevelCcc[]  = {UINT16_TO_BYTES(0x0000)};
+static const uint16_t batteryLevelCccLen = sizeof(batteryLevelCcc);
+
+/* clang-format off */
+static const attsAttr_t Battery_GATT_List[] = {
+    { attTypePrimSvcUuid, (uint8_t*)batterySvcUuid,  (uint16_t*)&batterySvcLen,     sizeof(batterySvcUuid),    0,                    ATTS_PERMIT_READ },
+    { attTypeCharUuid,    (uint8_t*)batteryCh,        (uint16_t*)&batteryChLen,      sizeof(batteryCh),         0,                    ATTS_PERMIT_READ },
+    { &batteryCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], (uint8_t*)batteryChValue, (uint16_t*)&batteryChValueLen, sizeof(batteryChValue), ATTS_SET_READ_CBACK, ATTS_PERMIT_READ },
+    { attTypeCliChCfgUuid, batteryLevelCcc, (uint16_t*)&batteryLevelCccLen, sizeof(batteryLevelCcc), ATTS_SET_CCC, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+};
+/* clang-format on */
+
+/* =========================================================================
+ *  Sound Event Service
+ * ========================================================================= */
+
+static const uint8_t  soundSvcUuid[]        = {SOUND_SERVICE_UUID_128};
+static const uint16_t soundSvcLen           = sizeof(soundSvcUuid);
+
+static const uint8_t  soundEventCh[]        = {ATT_PROP_READ | ATT_PROP_NOTIFY,
+                                                UINT16_TO_BYTES(SOUND_EVENT_HDL),
+                                                SOUND_EVENT_CHAR_UUID_128};
+static const uint16_t soundEventChLen       = sizeof(soundEventCh);
+
+static uint8_t        soundEventValue[SOUND_EVENT_LEN] = {0};
+static const uint16_t soundEventValueLen    = sizeof(soundEventValue);
+
+static uint8_t        soundEventCcc[]       = {UINT16_TO_BYTES(0x0000)};
+static const uint16_t soundEventCccLen      = sizeof(soundEventCcc);
+
+/* clang-format off */
+static const attsAttr_t Sound_GATT_List[] = {
+    { attTypePrimSvcUuid, (uint8_t*)soundSvcUuid, (uint16_t*)&soundSvcLen, sizeof(soundSvcUuid), ATTS_SET_UUID_128, ATTS_PERMIT_READ },
+    { attTypeCharUuid,    (uint8_t*)soundEventCh, (uint16_t*)&soundEventChLen, sizeof(soundEventCh), 0, ATTS_PERMIT_READ },
+    { &soundEventCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], soundEventValue, (uint16_t*)&soundEventValueLen, sizeof(soundEventValue), ATTS_SET_UUID_128, ATTS_PERMIT_READ },
+    { attTypeCliChCfgUuid, soundEventCcc, (uint16_t*)&soundEventCccLen, sizeof(soundEventCcc), ATTS_SET_CCC, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+};
+/* clang-format on */
+
+/* =========================================================================
+ *  Thread Config Service
+ * ========================================================================= */
+
+/* Service declaration */
+static const uint8_t  threadCfgSvcUuid[]    = {THREAD_CFG_SERVICE_UUID_128};
+static const uint16_t threadCfgSvcLen       = sizeof(threadCfgSvcUuid);
+
+/* Network Name characteristic */
+static const uint8_t  threadNetNameCh[]     = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_NET_NAME_HDL),
+                                                THREAD_NET_NAME_CHAR_UUID_128};
+static const uint16_t threadNetNameChLen    = sizeof(threadNetNameCh);
+static uint8_t        threadNetNameValue[THREAD_NET_NAME_MAX_LEN] = "DoorbellNet";
+static uint16_t       threadNetNameValueLen = 11; /* strlen("DoorbellNet") */
+
+/* Network Key characteristic (write-only: ATT_PROP_WRITE, no ATT_PROP_READ) */
+static const uint8_t  threadNetKeyCh[]      = {ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_NET_KEY_HDL),
+                                                THREAD_NET_KEY_CHAR_UUID_128};
+static const uint16_t threadNetKeyChLen     = sizeof(threadNetKeyCh);
+static uint8_t        threadNetKeyValue[THREAD_NET_KEY_LEN] = {0};
+static uint16_t       threadNetKeyValueLen  = THREAD_NET_KEY_LEN;
+
+/* Channel characteristic */
+static const uint8_t  threadChannelCh[]     = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_CHANNEL_HDL),
+                                                THREAD_CHANNEL_CHAR_UUID_128};
+static const uint16_t threadChannelChLen    = sizeof(threadChannelCh);
+static uint8_t        threadChannelValue[1] = {15};  /* Default channel 15 */
+static uint16_t       threadChannelValueLen = 1;
+
+/* PAN ID characteristic */
+static const uint8_t  threadPanIdCh[]       = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_PANID_HDL),
+                                                THREAD_PANID_CHAR_UUID_128};
+static const uint16_t threadPanIdChLen      = sizeof(threadPanIdCh);
+static uint8_t        threadPanIdValue[2]   = {0xCD, 0xAB};  /* Default 0xABCD (LE) */
+static uint16_t       threadPanIdValueLen   = 2;
+
+/* Join characteristic (write-only) */
+static const uint8_t  threadJoinCh[]        = {ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_JOIN_HDL),
+                                                THREAD_JOIN_CHAR_UUID_128};
+static const uint16_t threadJoinChLen       = sizeof(threadJoinCh);
+static uint8_t        threadJoinValue[1]    = {0x00};
+static uint16_t       threadJoinValueLen    = 1;
+
+/* Thread Status characteristic (read + notify) */
+static const uint8_t  threadStatusCh[]      = {ATT_PROP_READ | ATT_PROP_NOTIFY,
+                                                UINT16_TO_BYTES(THREAD_STATUS_HDL),
+                                                THREAD_STATUS_CHAR_UUID_128};
+static const uint16_t threadStatusChLen     = sizeof(threadStatusCh);
+static uint8_t        threadStatusValue[1]  = {THREAD_STATUS_DISABLED};
+static uint16_t       threadStatusValueLen  = 1;
+static uint8_t        threadStatusCcc[]     = {UINT16_TO_BYTES(0x0000)};
+static const uint16_t threadStatusCccLen    = sizeof(threadStatusCcc);
+
+/* Thread Diagnostics characteristic (read): latest MeshDiag snapshot frame */
+static const uint8_t  threadDiagCh[]        = {ATT_PROP_READ,
+                                                UINT16_TO_BYTES(THREAD_DIAG_HDL),
+                                                THREAD_DIAG_CHAR_UUID_128};
+static const uint16_t threadDiagChLen       = sizeof(threadDiagCh);
+static uint8_t        threadDiagValue[MESH_DIAG_MAX_FRAME];
+static uint16_t       threadDiagValueLen    = 0;
+
+/* Thread Dataset characteristic (write-only): MeshCoP TLVs, assembled by MeshDataset */
+static const uint8_t  threadDatasetCh[]     = {ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_DATASET_HDL),
+                                                THREAD_DATASET_CHAR_UUID_128};
+static const uint16_t threadDatasetChLen    = sizeof(threadDatasetCh);
+static uint8_t        threadDatasetValue[MESH_DATASET_MAX_LEN];
+static uint16_t       threadDatasetValueLen = 0;
+
+/* Thread Survey characteristic (read + write): MeshChannel survey frame */
+static const uint8_t  threadSurveyCh[]      = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_SURVEY_HDL),
+                                                THREAD_SURVEY_CHAR_UUID_128};
+static const uint16_t threadSurveyChLen     = sizeof(threadSurveyCh);
+static uint8_t        threadSurveyValue[MESH_CHANNEL_SURVEY_LEN] = {MeshChannel_Idle};
+static uint16_t       threadSurveyValueLen  = 2;
+
+/* Thread Auth characteristic (read + write): keys in, device id out */
+static const uint8_t  threadAuthCh[]        = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_AUTH_HDL),
+                                                THREAD_AUTH_CHAR_UUID_128};
+static const uint16_t threadAuthChLen       = sizeof(threadAuthCh);
+static uint8_t        threadAuthValue[MESH_AUTH_WRITE_MAX] = {0};
+static uint16_t       threadAuthValueLen    = MESH_AUTH_INFO_LEN;
+
+/* Thread Joiner characteristic (read + write): start / PSKd in, progress out */
+static const uint8_t  threadJoinerCh[]      = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_JOINER_HDL),
+                                                THREAD_JOINER_CHAR_UUID_128};
+static const uint16_t threadJoinerChLen     = sizeof(threadJoinerCh);
+static uint8_t        threadJoinerValue[MESH_JOINER_WRITE_MAX] = {0};
+static uint16_t       threadJoinerValueLen  = MESH_JOINER_INFO_LEN;
+
+/* clang-format off */
+static const attsAttr_t ThreadCfg_GATT_List[] = {
+    /* Service declaration */
+    { attTypePrimSvcUuid, (uint8_t*)threadCfgSvcUuid, (uint16_t*)&threadCfgSvcLen, sizeof(threadCfgSvcUuid), ATTS_SET_UUID_128, ATTS_PERMIT_READ },
+
+    /* Network Name: read + write */
+    { attTypeCharUuid, (uint8_t*)threadNetNameCh, (uint16_t*)&threadNetNameChLen, sizeof(threadNetNameCh), 0, ATTS_PERMIT_READ },
+    { &threadNetNameCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadNetNameValue, &threadNetNameValueLen, THREAD_NET_NAME_MAX_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Network Key: write-only */
+    { attTypeCharUuid, (uint8_t*)threadNetKeyCh, (uint16_t*)&threadNetKeyChLen, sizeof(threadNetKeyCh), 0, ATTS_PERMIT_READ },
+    { &threadNetKeyCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadNetKeyValue, &threadNetKeyValueLen, THREAD_NET_KEY_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128, ATTS_PERMIT_WRITE },
+
+    /* Channel: read + write */
+    { attTypeCharUuid, (uint8_t*)threadChannelCh, (uint16_t*)&threadChannelChLen, sizeof(threadChannelCh), 0, ATTS_PERMIT_READ },
+    { &threadChannelCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadChannelValue, &threadChannelValueLen, THREAD_CHANNEL_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* PAN ID: read + write */
+    { attTypeCharUuid, (uint8_t*)threadPanIdCh, (uint16_t*)&threadPanIdChLen, sizeof(threadPanIdCh), 0, ATTS_PERMIT_READ },
+    { &threadPanIdCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadPanIdValue, &threadPanIdValueLen, THREAD_PANID_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Join: write-only */
+    { attTypeCharUuid, (uint8_t*)threadJoinCh, (uint16_t*)&threadJoinChLen, sizeof(threadJoinCh), 0, ATTS_PERMIT_READ },
+    { &threadJoinCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadJoinValue, &threadJoinValueLen, THREAD_JOIN_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128, ATTS_PERMIT_WRITE },
+
+    /* Thread Status: read + notify */
+    { attTypeCharUuid, (uint8_t*)threadStatusCh, (uint16_t*)&threadStatusChLen, sizeof(threadStatusCh), 0, ATTS_PERMIT_READ },
+    { &threadStatusCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadStatusValue, &threadStatusValueLen, THREAD_STATUS_LEN, ATTS_SET_UUID_128, ATTS_PERMIT_READ },
+    { attTypeCliChCfgUuid, threadStatusCcc, (uint16_t*)&threadStatusCccLen, sizeof(threadStatusCcc), ATTS_SET_CCC, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Diagnostics: read-only */
+    { attTypeCharUuid, (uint8_t*)threadDiagCh, (uint16_t*)&threadDiagChLen, sizeof(threadDiagCh), 0, ATTS_PERMIT_READ },
+    { &threadDiagCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadDiagValue, &threadDiagValueLen, MESH_DIAG_MAX_FRAME, ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ },
+
+    /* Dataset: write-only, long writes allowed */
+    { attTypeCharUuid, (uint8_t*)threadDatasetCh, (uint16_t*)&threadDatasetChLen, sizeof(threadDatasetCh), 0, ATTS_PERMIT_READ },
+    { &threadDatasetCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadDatasetValue, &threadDatasetValueLen, MESH_DATASET_MAX_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN | ATTS_SET_ALLOW_OFFSET, ATTS_PERMIT_WRITE },
+
+    /* Survey: read + write (0x01 starts a survey) */
+    { attTypeCharUuid, (uint8_t*)threadSurveyCh, (uint16_t*)&threadSurveyChLen, sizeof(threadSurveyCh), 0, ATTS_PERMIT_READ },
+    { &threadSurveyCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadSurveyValue, &threadSurveyValueLen, MESH_CHANNEL_SURVEY_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Auth: read + write */
+    { attTypeCharUuid, (uint8_t*)threadAuthCh, (uint16_t*)&threadAuthChLen, sizeof(threadAuthCh), 0, ATTS_PERMIT_READ },
+    { &threadAuthCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadAuthValue, &threadAuthValueLen, MESH_AUTH_WRITE_MAX, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Joiner: read + write */
+    { attTypeCharUuid, (uint8_t*)threadJoinerCh, (uint16_t*)&threadJoinerChLen, sizeof(threadJoinerCh), 0, ATTS_PERMIT_READ },
+    { &threadJoinerCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadJoinerValue, &threadJoinerValueLen, MESH_JOINER_WRITE_MAX, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+};
+/* clang-format on */
+
+/* =========================================================================
+ *  Global variables read by BleIf.c
+ * ========================================================================= */
+
+attsGroup_t svcGroups[BLE_CONFIG_SVC_GROUPS] = {
+    {NULL, (attsAttr_t*)Battery_GATT_List,   NULL, NULL, BATTERY_SVC_HDL,    BATTERY_LEVEL_HDL_MAX - 1  },
+    {NULL, (attsAttr_t*)Sound_GATT_List,     NULL, NULL, SOUND_SVC_HDL,      SOUND_SVC_HDL_MAX - 1      },
+    {NULL, (attsAttr_t*)ThreadCfg_GATT_List, NULL, NULL, THREAD_CFG_SVC_HDL, THREAD_CFG_SVC_HDL_MAX - 1 },
+};
+
+/* CCC descriptor table: GATT SC, Battery Level, Sound Event, Thread Status */
+attsCccSet_t BleIf_CccSet[NUM_CCC_IDX] = {
+    {GATT_SC_CH_CCC_HDL,       ATT_CLIENT_CFG_INDICATE, DM_SEC_LEVEL_NONE},
+    {BATTERY_LEVEL_CCC_HDL,    ATT_CLIENT_CFG_NOTIFY,   DM_SEC_LEVEL_NONE},
+    {SOUND_EVENT_CCC_HDL,      ATT_CLIENT_CFG_NOTIFY,   DM_SEC_LEVEL_NONE},
+    {THREAD_STATUS_CCC_HDL,    ATT_CLIENT_CFG_NOTIFY,   DM_SEC_LEVEL_NONE},
+};
+
+/* =========================================================================
+ *  Advertising data
+ * ========================================================================= */
+
+static const uint8_t DefaultAdvDataFrame[] = {
+    0x02,
+    BLEIF_ADV_DATA_TYPE_FLAGS,
+    0x06,                           /* General Discoverable + BLE only */
+    0x03,
+    BLEIF_ADV_DATA_TYPE_UUID16_COMPLETE,
+    batterySvcUuid[0], batterySvcUuid[1],
+};
+
+static const uint8_t ScanRespFrame[] = {
+    0x0F,                               /* length: 14 chars + type = 15 */
+    BLEIF_ADV_DATA_TYPE_NAME_COMPLETE,  /* type: Complete Local Name */
+    'Q', 'P', 'G', ' ', 'T', 'h', 'r', 'e', 'a', 'd',
+    ' ', 'M', 'i', 'c'
+};
+
+/* =========================================================================
+ *  Public functions called by BleIf
+ * ========================================================================= */
+
+uint8_t Ble_Peripheral_Config_Load_Advertise_Frame(uint8_t* buffer)
+{
+    Q_STATIC_ASSERT(BLEIF_ADV_DATASET_MAX_SIZE >= sizeof(DefaultAdvDataFrame));
+    memcpy(buffer, DefaultAdvDataFrame, sizeof(DefaultAdvDataFrame));
+    return sizeof(DefaultAdvDataFrame);
+}
+
+uint8_t Ble_Peripheral_Config_Load_Scan_Response_Frame(uint8_t* buffer)
+{
+    Q_STATIC_ASSERT(BLEIF_ADV_DATASET_MAX_SIZE >= sizeof(ScanRespFrame));
+    memcpy(buffer, ScanRespFrame, sizeof(ScanRespFrame));
+    return sizeof(ScanRespFrame);
+}
+
+/* =========================================================================
+ *  Accessor functions for AppManager (Thread characteristic values)
+ * ========================================================================= */
+
+uint8_t* ThreadCfg_GetNetworkName(uint16_t* pLen)
+{
+    *pLen = threadNetNameValueLen;
+    return threadNetNameValue;
+}
+
+uint8_t* ThreadCfg_GetNetworkKey(void)
+{
+    return threadNetKeyValue;
+}
+
+uint8_t ThreadCfg_GetChannel(void)
+{
+    return threadChannelValue[0];
+}
+
+uint16_t ThreadCfg_GetPanId(void)
+{
+    /* PAN ID stored little-endian */
+    return (uint16_t)((threadPanIdValue[1] << 8) | threadPanIdValue[0]);
+}
+
+void ThreadCfg_SetStatus(uint8_t status)
+{
+    threadStatusValue[0] = status;
+}
+
+uint8_t ThreadCfg_GetStatus(void)
+{
+    return threadStatusValue[0];
+}
+
+void ThreadCfg_SetDiagnostics(const uint8_t* pData, uint16_t len)
+{
+    if(len > MESH_DIAG_MAX_FRAME)
+    {
+        len = MESH_DIAG_MAX_FRAME;
+    }
+    memcpy(threadDiagValue, pData, len);
+    threadDiagValueLen = len;
+}
+
+void ThreadCfg_SetSurvey(const uint8_t* pSurvey, uint16_t len)
+{
+    if(len > MESH_CHANNEL_SURVEY_LEN)
+    {
+        len = MESH_CHANNEL_SURVEY_LEN;
+    }
+    memcpy(threadSurveyValue, pSurvey, len);
+    threadSurveyValueLen = len;
+}
+
+void ThreadCfg_SetAuth(const uint8_t* pInfo)
+{
+    memset(threadAuthValue, 0, sizeof(threadAuthValue));
+    memcpy(threadAuthValue, pInfo, MESH_AUTH_INFO_LEN);
+    threadAuthValueLen = MESH_AUTH_INFO_LEN;
+}
+
+void ThreadCfg_SetJoiner(const uint8_t* pInfo)
+{
+    memset(threadJoinerValue, 0, sizeof(threadJoinerValue));
+    memcpy(threadJoinerValue, pInfo, MESH_JOINER_INFO_LEN);
+    threadJoinerValueLen = MESH_JOINER_INFO_LEN;
+}
+
+/* =========================================================================
+ *  Accessor functions for AppManager (Sound Event characteristic value)
+ * ========================================================================= */
+
+void SoundCfg_SetEvent(const uint8_t* pValue)
+{
+    memcpy(soundEventValue, pValue, SOUND_EVENT_LEN);
+}
@@ -64,6 +64,16 @@ typedef enum
     kThreadEvent_Detached       = 1,  /**< Left / lost the Thread network */
     kThreadEvent_MotionReceived = 2,  /**< Remote motion event arrived over Thread mesh */
     kThreadEvent_Error          = 3,  /**< Generic Thread stack error */
+    kThreadEvent_TimeSync       = 4,  /**< Mesh time exchange due (MeshTimeSync timer) */
+    kThreadEvent_Coap           = 5,  /**< MeshCoap send due (timer / response) */
+    kThreadEvent_Sleepy         = 6,  /**< MeshSleepy fast-poll window over / power log due */
+    kThreadEvent_Diag           = 7,  /**< MeshDiag snapshot due (timer / topology change) */
+    kThreadEvent_Dataset        = 8,  /**< MeshDataset: written dataset ready to apply */
+    kThreadEvent_Channel        = 9,  /**< MeshChannel: survey sweep done / leader survey due (1 = start) */
+    kThreadEvent_Auth           = 10,  /**< MeshAuth: key write ready to apply */
+    kThreadEvent_TxPower        = 11,  /**< MeshTxPower: evaluation window over / topology change */
+    kThreadEvent_Recovery       = 12,  /**< MeshRecovery: attach restart due while detached */
+    kThreadEvent_Joiner         = 13,  /**< MeshJoiner: write / joiner result / retry due */
 } ThreadEventType_t;
 
 typedef struct
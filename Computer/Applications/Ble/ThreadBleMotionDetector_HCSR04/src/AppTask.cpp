@@ -36,8 +36,9 @@
  *   6. SensorManager::Init()  -> GPIO 28 (Trig) and GPIO 29 (Echo)
  *   7. SensorManager::StartSensing() -> distance measurement FreeRTOS task
  *
- * The Thread stack is initialised inside AppManager::Init() via
- * Thread_Init(), which is called after the BLE stack is up.
+ * The Thread stack is initialised by Thread_Init() from the app task once
+ * the BLE stack reset completes (DM_RESET_CMPL_IND), then advertising
+ * starts; see App_InitContinue() in AppManager.cpp.
  */
 
 #include "hal.h"
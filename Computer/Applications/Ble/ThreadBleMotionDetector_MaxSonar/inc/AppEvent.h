@@ -39,6 +39,16 @@ typedef enum
     kThreadEvent_Detached       = 1,
     kThreadEvent_MotionReceived = 2,
     kThreadEvent_Error          = 3,
+    kThreadEvent_TimeSync       = 4,
+    kThreadEvent_Coap           = 5,
+    kThreadEvent_Sleepy         = 6,
+    kThreadEvent_Diag           = 7,
+    kThreadEvent_Dataset        = 8,
+    kThreadEvent_Channel        = 9,
+    kThreadEvent_Auth           = 10,
+    kThreadEvent_TxPower        = 11,
+    kThreadEvent_Recovery       = 12,
+    kThreadEvent_Joiner         = 13,
 } ThreadEventType_t;
 
 typedef struct
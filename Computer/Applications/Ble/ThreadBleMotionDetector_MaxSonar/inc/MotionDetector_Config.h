@@ -40,6 +40,16 @@
  *    0x400B : Thread Status Char Declaration
  *    0x400C : Thread Status Value             (Read / Notify, 1 byte)
  *    0x400D : Thread Status CCC               (Read / Write)
+ *    0x400E : Diagnostics Characteristic Declaration
+ *    0x400F : Diagnostics Value               (Read, MeshDiag snapshot frame)
+ *    0x4010 : Dataset Characteristic Declaration
+ *    0x4011 : Dataset Value                   (Write, long write, MeshCoP TLVs)
+ *    0x4012 : Survey Characteristic Declaration
+ *    0x4013 : Survey Value                    (Read / Write, channel survey; 0x01 = start)
+ *    0x4014 : Auth Characteristic Declaration
+ *    0x4015 : Auth Value                      (Read / Write, event signing keys)
+ *    0x4016 : Joiner Characteristic Declaration
+ *    0x4017 : Joiner Value                    (Read / Write, MeshCoP joiner; 0x01 = start)
  */
 
 #ifndef _MOTIONDETECTOR_CONFIG_H_
@@ -103,13 +113,27 @@ extern "C" {
 #define THREAD_STATUS_CH_HDL       0x400B
 #define THREAD_STATUS_HDL          0x400C
 #define THREAD_STATUS_CCC_HDL      0x400D
-#define THREAD_CFG_SVC_HDL_MAX     (THREAD_STATUS_CCC_HDL + 1)
+
+#define THREAD_DIAG_CH_HDL         0x400E
+#define THREAD_DIAG_HDL            0x400F   /**< R    - diagnostics snapshot (MeshDiag.h) */
+#define THREAD_DATASET_CH_HDL      0x4010
+#define THREAD_DATASET_HDL         0x4011   /**< W    - Active Operational Dataset TLVs (MeshDataset.h) */
+#define THREAD_SURVEY_CH_HDL       0x4012
+#define THREAD_SURVEY_HDL          0x4013   /**< RW   - energy survey of channels 11-26 (MeshChannel.h) */
+#define THREAD_AUTH_CH_HDL         0x4014
+#define THREAD_AUTH_HDL            0x4015   /**< RW   - event signing keys (MeshAuth.h) */
+#define THREAD_JOINER_CH_HDL       0x4016
+#define THREAD_JOINER_HDL          0x4017   /**< RW   - MeshCoP joiner start / progress (MeshJoiner.h) */
+#define THREAD_CFG_SVC_HDL_MAX     (THREAD_JOINER_HDL + 1)
 
 #define THREAD_STATUS_DISABLED     0x00
 #define THREAD_STATUS_DETACHED     0x01
 #define THREAD_STATUS_CHILD        0x02
 #define THREAD_STATUS_ROUTER       0x03
 #define THREAD_STATUS_LEADER       0x04
+#define THREAD_STATUS_REJECTED     0x05     /**< written dataset refused (MeshDataset.h) */
+#define THREAD_STATUS_JOINING      0x06     /**< MeshCoP joiner running (MeshJoiner.h) */
+#define THREAD_STATUS_JOIN_FAILED  0x07     /**< joiner attempt failed, retry pending */
 
 #define GATT_SC_CH_CCC_HDL         0x0013
 
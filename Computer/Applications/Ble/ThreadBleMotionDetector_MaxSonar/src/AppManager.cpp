@@ -29,8 +29,9 @@
  *    Solid ON  = motion detected within 2 m
  *    OFF       = no motion / object beyond 2 m
  *
- * -- Thread Motion Payload (UDP, port 5683) ----------------------------------
- *  4 bytes: [0x01=type] [0x00/0x01=state] [dist_hi] [dist_lo]
+ * -- Thread Motion Payload (CoAP POST /e, port 5683) -------------------------
+ *  TLV frame (MeshTlv.h), MOTION record: [state] [dist_hi] [dist_lo]
+ *  Detections are also sent confirmable to the gateway (MeshCoap.h)
  *
  * -- BLE Commissioning -------------------------------------------------------
  *  1. Connect to "QPG MaxSonar Motion"
@@ -49,9 +50,24 @@
 #include "qPinCfg.h"
 #include "StatusLed.h"
 #include "BleIf.h"
+#include "MeshTimeSync.h"
+#include "MeshTlvNode.h"
+#include "MeshCoap.h"
+#include "MeshRole.h"
+#include "MeshRecovery.h"
+#include "MeshSleepy.h"
+#include "MeshAuth.h"
+#include "MeshTxPower.h"
+#include "MeshChannel.h"
+#include "MeshDataset.h"
+#include "MeshDiag.h"
+#include "MeshJoiner.h"
+#include "BootProfile.h"
+
+#include "FreeRTOS.h"
+#include "timers.h"
 
 #include <openthread/thread.h>
-#include <openthread/udp.h>
 #include <openthread/instance.h>
 #include <openthread/ip6.h>
 
@@ -67,11 +83,6 @@ extern "C" void otSysInit(int argc, char* argv[]);
 #define BTN_RESTART_ADV_THRESHOLD   2
 #define BTN_FACTORY_RESET_THRESHOLD 5
 
-#define THREAD_MOTION_PORT  5683
-#define THREAD_MOTION_MCAST "ff03::1"
-
-#define THREAD_MSG_TYPE_MOTION  0x01
-
 #define LED_BLE_STATE    0
 #define LED_THREAD_STATE 1
 #define LED_MOTION       2
@@ -82,9 +93,21 @@ static const uint8_t StatusLedGpios[] = QPINCFG_STATUS_LED;
 static BleIf_Callbacks_t sAppCallbacks;
 
 static bool         sThreadCredentialsAvailable = false;
+static bool         sJoinAfterSurvey            = false;
 static otInstance*  sThreadInstance             = nullptr;
-static otUdpSocket  sThreadUdpSocket;
-static bool         sThreadUdpSocketOpen        = false;
+
+#define APP_INIT_BLE_RESET_TIMEOUT_MS 3000
+
+typedef enum
+{
+    kAppInit_BleReset = 0,
+    kAppInit_Thread,
+    kAppInit_Done,
+} AppInitState_t;
+
+static volatile AppInitState_t sInitState = kAppInit_BleReset;
+static StaticTimer_t           sInitTimerBuffer;
+static TimerHandle_t           sInitTimer = nullptr;
 
 static void BLE_Stack_Callback(BleIf_MsgHdr_t* pMsg);
 static void BLE_CharacteristicRead_Callback(uint16_t connId, uint16_t handle, uint8_t op,
@@ -97,9 +120,26 @@ static void BLE_CCCD_Callback(BleIf_AttsCccEvt_t* event);
 static void Thread_Init(void);
 static void Thread_StartJoin(void);
 static void Thread_SendMotionPacket(bool detected, uint16_t distanceCm);
-static void Thread_UdpReceiveCallback(void* aContext, otMessage* aMessage,
-                                      const otMessageInfo* aMessageInfo);
+static void Thread_EventReceived(const uint8_t* pFrame, uint16_t len,
+                                 const otMessageInfo* aMessageInfo);
 static void Thread_StateChangeCallback(uint32_t aFlags, void* aContext);
+static void Thread_TimeSyncNotify(void);
+static void Thread_CoapNotify(void);
+static void Thread_SleepyNotify(void);
+static void Thread_DiagNotify(void);
+static void Thread_DiagSnapshot(const uint8_t* pFrame, uint16_t len);
+static void Thread_DatasetNotify(void);
+static void Thread_DatasetResult(otError error, uint16_t len);
+static void Thread_ChannelNotify(void);
+static void Thread_ChannelSurvey(const uint8_t* pSurvey, uint16_t len);
+static void Thread_AuthNotify(void);
+static void Thread_AuthUpdate(void);
+static void Thread_JoinerNotify(void);
+static void Thread_JoinerState(MeshJoiner_State_t state, otError error);
+static void Thread_TxPowerNotify(void);
+static void Thread_RecoveryNotify(void);
+static void App_InitTimeout(TimerHandle_t xTimer);
+static void App_InitContinue(bool timedOut);
 
 extern "C" uint8_t* ThreadCfg_GetNetworkName(uint16_t* pLen);
 extern "C" uint8_t* ThreadCfg_GetNetworkKey(void);
@@ -107,6 +147,10 @@ extern "C" uint8_t  ThreadCfg_GetChannel(void);
 extern "C" uint16_t ThreadCfg_GetPanId(void);
 extern "C" void     ThreadCfg_SetStatus(uint8_t status);
 extern "C" uint8_t  ThreadCfg_GetStatus(void);
+extern "C" void     ThreadCfg_SetDiagnostics(const uint8_t* pData, uint16_t len);
+extern "C" void     ThreadCfg_SetSurvey(const uint8_t* pSurvey, uint16_t len);
+extern "C" void     ThreadCfg_SetAuth(const uint8_t* pInfo);
+extern "C" void     ThreadCfg_SetJoiner(const uint8_t* pInfo);
 
 void AppManager::Init()
 {
@@ -114,7 +158,6 @@ void AppManager::Init()
     sAppCallbacks.chrReadCallback  = BLE_CharacteristicRead_Callback;
     sAppCallbacks.chrWriteCallback = BLE_CharacteristicWrite_Callback;
     sAppCallbacks.cccCallback      = BLE_CCCD_Callback;
-    BleIf_Init(&sAppCallbacks);
 
     StatusLed_Init(StatusLedGpios, Q_ARRAY_SIZE(StatusLedGpios), true);
     StatusLed_SetLed(LED_BLE_STATE,    false);
@@ -123,7 +166,11 @@ void AppManager::Init()
 
     GetAppButtons().RegisterMultiFunc(APP_MULTI_FUNC_BUTTON);
 
-    Thread_Init();
+    sInitTimer = xTimerCreateStatic("AppInit", pdMS_TO_TICKS(APP_INIT_BLE_RESET_TIMEOUT_MS), pdFALSE,
+                                    nullptr, App_InitTimeout, &sInitTimerBuffer);
+    xTimerStart(sInitTimer, 0);
+    BootProfile_Begin(BootProfile_BleReset);
+    BleIf_Init(&sAppCallbacks);
 
     GP_LOG_SYSTEM_PRINTF("", 0);
     GP_LOG_SYSTEM_PRINTF("============================================", 0);
@@ -140,11 +187,6 @@ void AppManager::Init()
     GP_LOG_SYSTEM_PRINTF("  BLUE  solid   = Motion detected", 0);
     GP_LOG_SYSTEM_PRINTF("  BLUE  off     = No motion", 0);
     GP_LOG_SYSTEM_PRINTF("", 0);
-
-    if(BleIf_StartAdvertising() == STATUS_NO_ERROR)
-    {
-        GP_LOG_SYSTEM_PRINTF("[BLE] Advertising - scan for 'QPG MaxSonar Motion'", 0);
-    }
 }
 
 void AppManager::EventHandler(AppEvent* aEvent)
@@ -177,6 +219,10 @@ void AppManager::BleEventHandler(AppEvent* aEvent)
 {
     switch(aEvent->BleConnectionEvent.Event)
     {
+        case Ble_Event_t::kBleConnectionEvent_StackReady:
+            App_InitContinue(aEvent->BleConnectionEvent.Value != 0);
+            break;
+
         case Ble_Event_t::kBleConnectionEvent_Advertise_Start:
             GP_LOG_SYSTEM_PRINTF("[BLE] Advertising started", 0);
             StatusLed_BlinkLed(LED_BLE_STATE, ADV_BLINK_ON_MS, ADV_BLINK_OFF_MS);
@@ -190,6 +236,9 @@ void AppManager::BleEventHandler(AppEvent* aEvent)
         case Ble_Event_t::kBleConnectionEvent_Disconnected:
             GP_LOG_SYSTEM_PRINTF("[BLE] Phone disconnected", 0);
             StatusLed_SetLed(LED_BLE_STATE, false);
+            /* Keys written in this connection can no longer be changed over BLE */
+            MeshAuth_Lock();
+            Thread_AuthUpdate();
             break;
 
         case Ble_Event_t::kBleLedControlCharUpdate:
@@ -273,6 +322,16 @@ void AppManager::ThreadEventHandler(AppEvent* aEvent)
                 uint8_t status = ThreadCfg_GetStatus();
                 BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
             }
+            MeshTimeSync_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshChannel_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshRole_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshRecovery_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshSleepy_RoleChanged((otDeviceRole)aEvent->ThreadEvent.Value);
+            MeshCoap_Process();
+            if(BootProfile_End(BootProfile_Attach))
+            {
+                BootProfile_Log();
+            }
             break;
 
         case kThreadEvent_Detached:
@@ -283,6 +342,10 @@ void AppManager::ThreadEventHandler(AppEvent* aEvent)
                 uint8_t status = THREAD_STATUS_DETACHED;
                 BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
             }
+            MeshTimeSync_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshRole_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshRecovery_RoleChanged(OT_DEVICE_ROLE_DETACHED);
+            MeshSleepy_RoleChanged(OT_DEVICE_ROLE_DETACHED);
             break;
 
         case kThreadEvent_MotionReceived:
@@ -295,6 +358,53 @@ void AppManager::ThreadEventHandler(AppEvent* aEvent)
             }
             break;
 
+        case kThreadEvent_TimeSync:
+            MeshTimeSync_Process();
+            break;
+
+        case kThreadEvent_Coap:
+            MeshCoap_Process();
+            break;
+
+        case kThreadEvent_Sleepy:
+            MeshSleepy_Process();
+            break;
+
+        case kThreadEvent_Diag:
+            MeshDiag_Process();
+            break;
+
+        case kThreadEvent_Dataset:
+            MeshDataset_Process();
+            break;
+
+        case kThreadEvent_Channel:
+            if(aEvent->ThreadEvent.Value == 1)
+            {
+                MeshChannel_StartSurvey();
+            }
+            else
+            {
+                MeshChannel_Process();
+            }
+            break;
+
+        case kThreadEvent_Auth:
+            Thread_AuthUpdate();
+            break;
+
+        case kThreadEvent_TxPower:
+            MeshTxPower_Process();
+            break;
+
+        case kThreadEvent_Recovery:
+            MeshRecovery_Process();
+            break;
+
+        case kThreadEvent_Joiner:
+            MeshJoiner_Process();
+            break;
+
         case kThreadEvent_Error:
             GP_LOG_SYSTEM_PRINTF("[Thread] Error: 0x%x", 0, aEvent->ThreadEvent.Value);
             break;
@@ -341,6 +451,44 @@ void AppManager::NotifyThreadEvent(ThreadEventType_t threadEvent, uint32_t value
     GetAppTask().PostEvent(&event);
 }
 
+static void App_InitTimeout(TimerHandle_t /*xTimer*/)
+{
+    AppEvent event;
+    event.Type                     = AppEvent::kEventType_BleConnection;
+    event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_StackReady;
+    event.BleConnectionEvent.Value = 1; /* timed out */
+    GetAppTask().PostEvent(&event);
+}
+
+static void App_InitContinue(bool timedOut)
+{
+    if(sInitState != kAppInit_BleReset)
+    {
+        return;
+    }
+    xTimerStop(sInitTimer, 0);
+
+    if(timedOut)
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] WARNING: BLE stack reset did not complete in time", 0);
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] Stack ready (%lu ms)", 0, BootProfile_Duration(BootProfile_BleReset));
+    }
+
+    sInitState = kAppInit_Thread;
+    BootProfile_Begin(BootProfile_ThreadInit);
+    Thread_Init();
+    BootProfile_End(BootProfile_ThreadInit);
+    sInitState = kAppInit_Done;
+
+    if(BleIf_StartAdvertising() == STATUS_NO_ERROR)
+    {
+        GP_LOG_SYSTEM_PRINTF("[BLE] Advertising - scan for 'QPG MaxSonar Motion'", 0);
+    }
+}
+
 static void Thread_Init(void)
 {
     otSysInit(0, nullptr);
@@ -354,6 +502,36 @@ static void Thread_Init(void)
 
     otSetStateChangedCallback(sThreadInstance, Thread_StateChangeCallback, nullptr);
 
+    /* Mesh time base: the leader is the time master, everyone else tracks it.
+     * A sleepy node would only get the responses at its next poll, so it
+     * does not exchange and its events carry local time. */
+    MeshTimeSync_Init(sThreadInstance, MESH_SLEEPY ? nullptr : Thread_TimeSyncNotify);
+    MeshTlvNode_Init(sThreadInstance, MESH_TLV_DEVICE_MOTION);
+    MeshCoap_Init(sThreadInstance, Thread_EventReceived, Thread_CoapNotify);
+
+    /* Link mode of the build profile (MESH_SLEEPY), set before Thread starts */
+    MeshRole_Init(sThreadInstance, MESH_SLEEPY ? MeshRole_Sleepy : (MeshRole_Policy_t)MESH_ROLE_POLICY);
+    MeshSleepy_Init(sThreadInstance, Thread_SleepyNotify);
+    if(MeshSleepy_IsSleepy())
+    {
+        /* Let the MCU sleep between parent polls */
+        GetAppTask().EnableSleep(true);
+    }
+
+    MeshDiag_Init(sThreadInstance, Thread_DiagNotify, Thread_DiagSnapshot);
+    MeshDataset_Init(sThreadInstance, Thread_DatasetNotify, Thread_DatasetResult);
+    MeshChannel_Init(sThreadInstance, Thread_ChannelNotify, Thread_ChannelSurvey);
+    MeshAuth_Init(sThreadInstance, Thread_AuthNotify);
+    Thread_AuthUpdate();
+    MeshJoiner_Init(sThreadInstance, "Motion MaxSonar", Thread_JoinerNotify, Thread_JoinerState);
+    {
+        uint8_t info[MESH_JOINER_INFO_LEN];
+        MeshJoiner_GetInfo(info);
+        ThreadCfg_SetJoiner(info);
+    }
+    MeshTxPower_Init(sThreadInstance, Thread_TxPowerNotify);
+    MeshRecovery_Init(sThreadInstance, Thread_RecoveryNotify);
+
     otOperationalDataset dataset;
     if(otDatasetGetActive(sThreadInstance, &dataset) == OT_ERROR_NONE)
     {
@@ -361,6 +539,11 @@ static void Thread_Init(void)
         sThreadCredentialsAvailable = true;
         Thread_StartJoin();
     }
+    else if(MESH_JOINER_AUTOSTART && MeshJoiner_HasPskd())
+    {
+        GP_LOG_SYSTEM_PRINTF("[Thread] No credentials - starting the joiner", 0);
+        MeshJoiner_Start();
+    }
     else
     {
         GP_LOG_SYSTEM_PRINTF("[Thread] No credentials - waiting for BLE commissioning", 0);
@@ -384,6 +567,22 @@ static void Thread_StartJoin(void)
         uint8_t  ch    = ThreadCfg_GetChannel();
         uint16_t panId = ThreadCfg_GetPanId();
 
+        if(ch == MESH_CHANNEL_AUTO)
+        {
+            ch = MeshChannel_Best();
+            if(ch == 0)
+            {
+                err = MeshChannel_StartSurvey();
+                if(err == OT_ERROR_NONE || err == OT_ERROR_BUSY)
+                {
+                    sJoinAfterSurvey = true;
+                    return;
+                }
+                ch = MESH_CHANNEL_FALLBACK;
+            }
+            GP_LOG_SYSTEM_PRINTF("[Thread] Auto channel: %u", 0, ch);
+        }
+
         otOperationalDataset dataset;
         memset(&dataset, 0, sizeof(dataset));
 
@@ -427,102 +626,191 @@ static void Thread_StartJoin(void)
         GP_LOG_SYSTEM_PRINTF("[Thread] SetEnabled failed: %d", 0, (int)err);
         return;
     }
+    BootProfile_Begin(BootProfile_Attach);
 
     StatusLed_BlinkLed(LED_THREAD_STATE, THREAD_JOIN_BLINK_ON_MS, THREAD_JOIN_BLINK_OFF_MS);
     GP_LOG_SYSTEM_PRINTF("[Thread] Joining network...", 0);
-
-    if(!sThreadUdpSocketOpen)
-    {
-        otSockAddr sockAddr;
-        memset(&sockAddr, 0, sizeof(sockAddr));
-        sockAddr.mPort = THREAD_MOTION_PORT;
-
-        err = otUdpOpen(sThreadInstance, &sThreadUdpSocket,
-                        Thread_UdpReceiveCallback, nullptr);
-        if(err == OT_ERROR_NONE)
-        {
-            err = otUdpBind(sThreadInstance, &sThreadUdpSocket, &sockAddr,
-                            OT_NETIF_THREAD_INTERNAL);
-            if(err == OT_ERROR_NONE)
-            {
-                sThreadUdpSocketOpen = true;
-                GP_LOG_SYSTEM_PRINTF("[Thread] UDP socket open on port %d", 0,
-                                     THREAD_MOTION_PORT);
-            }
-        }
-    }
 }
 
 static void Thread_SendMotionPacket(bool detected, uint16_t distanceCm)
 {
-    if(sThreadInstance == nullptr || !sThreadUdpSocketOpen)
+    if(sThreadInstance == nullptr)
     {
         return;
     }
 
-    otDeviceRole role = otThreadGetDeviceRole(sThreadInstance);
-    if(role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED)
+    uint8_t          frame[MESH_TLV_MAX_FRAME];
+    MeshTlv_Writer_t writer;
+    MeshTlvNode_Begin(&writer, frame, sizeof(frame), nullptr);
+    uint8_t* pMotion = MeshTlv_Reserve(&writer, MESH_TLV_REC_MOTION, MESH_TLV_MOTION_LEN);
+    if(pMotion != nullptr)
     {
-        return;
+        pMotion[0] = detected ? (uint8_t)0x01 : (uint8_t)0x00;
+        pMotion[1] = (uint8_t)(distanceCm >> 8);
+        pMotion[2] = (uint8_t)(distanceCm & 0xFF);
     }
 
-    otMessage* msg = otUdpNewMessage(sThreadInstance, nullptr);
-    if(msg == nullptr)
+    if(detected)
     {
-        return;
+        /* Poll fast for the gateway's ACK (sleepy profile only) */
+        MeshSleepy_Wake();
     }
 
-    uint8_t payload[4] = {
-        THREAD_MSG_TYPE_MOTION,
-        detected ? (uint8_t)0x01 : (uint8_t)0x00,
-        (uint8_t)(distanceCm >> 8),
-        (uint8_t)(distanceCm & 0xFF),
-    };
+    MeshCoap_Publish(frame, MeshTlvNode_Finish(&writer), detected ? MeshCoap_Critical : MeshCoap_Telemetry, false);
+}
 
-    otError err = otMessageAppend(msg, payload, sizeof(payload));
-    if(err != OT_ERROR_NONE)
+static void Thread_EventReceived(const uint8_t* pFrame, uint16_t len,
+                                 const otMessageInfo* /*aMessageInfo*/)
+{
+    MeshTlv_Reader_t reader;
+    MeshTlv_Record_t record;
+    if(MeshTlv_ReaderInit(&reader, pFrame, len, nullptr) != MeshTlv_Ok ||
+       !MeshTlv_Find(&reader, MESH_TLV_REC_MOTION, &record))
     {
-        otMessageFree(msg);
         return;
     }
+    bool     detected = (MeshTlv_GetU8(&record, 0) != 0);
+    uint16_t distCm   = MeshTlv_GetU16(&record, 1);
 
-    otMessageInfo msgInfo;
-    memset(&msgInfo, 0, sizeof(msgInfo));
-    msgInfo.mPeerPort = THREAD_MOTION_PORT;
-    otIp6AddressFromString(THREAD_MOTION_MCAST, &msgInfo.mPeerAddr);
+    uint32_t value    = ((uint32_t)distCm << 16) | (detected ? 1u : 0u);
+    AppManager::NotifyThreadEvent(kThreadEvent_MotionReceived, value);
+}
 
-    err = otUdpSend(sThreadInstance, &sThreadUdpSocket, msg, &msgInfo);
-    if(err != OT_ERROR_NONE)
+static void Thread_TimeSyncNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_TimeSync, 0);
+}
+
+static void Thread_CoapNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Coap, 0);
+}
+
+static void Thread_SleepyNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Sleepy, 0);
+}
+
+static void Thread_DiagNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Diag, 0);
+}
+
+static void Thread_DiagSnapshot(const uint8_t* pFrame, uint16_t len)
+{
+    ThreadCfg_SetDiagnostics(pFrame, len);
+}
+
+static void Thread_DatasetNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Dataset, 0);
+}
+
+static void Thread_DatasetResult(otError error, uint16_t len)
+{
+    if(error != OT_ERROR_NONE)
     {
-        otMessageFree(msg);
+        GP_LOG_SYSTEM_PRINTF("[Thread] Dataset rejected (%u bytes): %d", 0, len, (int)error);
+        ThreadCfg_SetStatus(THREAD_STATUS_REJECTED);
+        uint8_t status = THREAD_STATUS_REJECTED;
+        BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+        return;
     }
+
+    GP_LOG_SYSTEM_PRINTF("[Thread] Dataset applied (%u bytes) - starting Thread", 0, len);
+    sThreadCredentialsAvailable = true;
+    Thread_StartJoin();
+}
+
+static void Thread_ChannelNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Channel, 0);
 }
 
-static void Thread_UdpReceiveCallback(void* /*aContext*/, otMessage* aMessage,
-                                      const otMessageInfo* /*aMessageInfo*/)
+static void Thread_ChannelSurvey(const uint8_t* pSurvey, uint16_t len)
 {
-    uint16_t len = otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
-    if(len < 4)
+    ThreadCfg_SetSurvey(pSurvey, len);
+
+    if(sJoinAfterSurvey && pSurvey[0] != MeshChannel_Running)
     {
-        return;
+        sJoinAfterSurvey = false;
+        Thread_StartJoin();
     }
+}
+
+static void Thread_AuthNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Auth, 0);
+}
+
+static void Thread_AuthUpdate(void)
+{
+    uint8_t info[MESH_AUTH_INFO_LEN];
+
+    MeshAuth_Process();
+    MeshAuth_GetInfo(info);
+    ThreadCfg_SetAuth(info);
+}
+
+static void Thread_JoinerNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Joiner, 0);
+}
+
+static void Thread_JoinerState(MeshJoiner_State_t state, otError error)
+{
+    uint8_t info[MESH_JOINER_INFO_LEN];
+    uint8_t status;
 
-    uint8_t payload[4] = {0};
-    otMessageRead(aMessage, otMessageGetOffset(aMessage), payload, sizeof(payload));
+    MeshJoiner_GetInfo(info);
+    ThreadCfg_SetJoiner(info);
 
-    if(payload[0] != THREAD_MSG_TYPE_MOTION)
+    switch(state)
     {
-        return;
+        case MeshJoiner_Joining:
+            StatusLed_BlinkLed(LED_THREAD_STATE, THREAD_JOIN_BLINK_ON_MS, THREAD_JOIN_BLINK_OFF_MS);
+            status = THREAD_STATUS_JOINING;
+            break;
+
+        case MeshJoiner_Joined:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Joiner done - starting Thread", 0);
+            sThreadCredentialsAvailable = true;
+            Thread_StartJoin();
+            return;
+
+        case MeshJoiner_Failed:
+            GP_LOG_SYSTEM_PRINTF("[Thread] Joiner failed: %d", 0, (int)error);
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            status = THREAD_STATUS_JOIN_FAILED;
+            break;
+
+        default:
+            StatusLed_SetLed(LED_THREAD_STATE, false);
+            status = THREAD_STATUS_DISABLED;
+            break;
     }
 
-    bool     detected = (payload[1] != 0);
-    uint16_t distCm   = ((uint16_t)payload[2] << 8) | payload[3];
-    uint32_t value    = ((uint32_t)distCm << 16) | (detected ? 1u : 0u);
-    AppManager::NotifyThreadEvent(kThreadEvent_MotionReceived, value);
+    ThreadCfg_SetStatus(status);
+    BleIf_SendNotification(THREAD_STATUS_HDL, 1, &status);
+}
+
+static void Thread_TxPowerNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_TxPower, 0);
+}
+
+static void Thread_RecoveryNotify(void)
+{
+    AppManager::NotifyThreadEvent(kThreadEvent_Recovery, 0);
 }
 
 static void Thread_StateChangeCallback(uint32_t aFlags, void* /*aContext*/)
 {
+    MeshDiag_StateChanged(aFlags);
+    MeshCoap_StateChanged(aFlags);
+    MeshTxPower_StateChanged(aFlags);
+    MeshRecovery_StateChanged(aFlags);
+
     if(aFlags & OT_CHANGED_THREAD_ROLE)
     {
         otDeviceRole role = otThreadGetDeviceRole(sThreadInstance);
@@ -550,6 +838,11 @@ static void BLE_Stack_Callback(BleIf_MsgHdr_t* pMsg)
     {
         switch(pMsg->event)
         {
+            case BLEIF_DM_RESET_CMPL_IND:
+                BootProfile_End(BootProfile_BleReset);
+                event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_StackReady;
+                event.BleConnectionEvent.Value = 0;
+                break;
             case BLEIF_DM_ADV_START_IND:
                 event.BleConnectionEvent.Event = Ble_Event_t::kBleConnectionEvent_Advertise_Start;
                 break;
@@ -579,7 +872,7 @@ static void BLE_CharacteristicRead_Callback(uint16_t /*connId*/, uint16_t /*hand
 }
 
 static void BLE_CharacteristicWrite_Callback(uint16_t /*connId*/, uint16_t handle,
-                                              uint8_t /*op*/, uint16_t /*offset*/,
+                                              uint8_t /*op*/, uint16_t offset,
                                               uint16_t len, uint8_t* pValue,
                                               BleIf_Attr_t* /*pAttr*/)
 {
@@ -601,6 +894,36 @@ static void BLE_CharacteristicWrite_Callback(uint16_t /*connId*/, uint16_t handl
             Thread_StartJoin();
         }
     }
+    else if(handle == THREAD_DATASET_HDL)
+    {
+        MeshDataset_Write(offset, pValue, len);
+    }
+    else if(handle == THREAD_SURVEY_HDL)
+    {
+        if(len > 0 && pValue[0] == 0x01)
+        {
+            AppManager::NotifyThreadEvent(kThreadEvent_Channel, 1);
+        }
+    }
+    else if(handle == THREAD_AUTH_HDL)
+    {
+        uint8_t info[MESH_AUTH_INFO_LEN];
+
+        if(!MeshAuth_Write(pValue, len))
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Auth write refused (%u bytes)", 0, len);
+        }
+        /* Keys must not stay readable in the attribute: back to the read-back at once */
+        MeshAuth_GetInfo(info);
+        ThreadCfg_SetAuth(info);
+    }
+    else if(handle == THREAD_JOINER_HDL)
+    {
+        if(!MeshJoiner_Write(pValue, len))
+        {
+            GP_LOG_SYSTEM_PRINTF("[BLE] Joiner write refused (%u bytes)", 0, len);
+        }
+    }
     else if(handle == THREAD_NET_NAME_HDL ||
             handle == THREAD_NET_KEY_HDL  ||
             handle == THREAD_CHANNEL_HDL  ||
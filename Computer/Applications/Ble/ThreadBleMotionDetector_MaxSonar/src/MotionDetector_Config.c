@@ -37,9 +37,22 @@
  *  a) Connect via nRF Connect / Qorvo Connect.
  *  b) Write Thread Network Name characteristic (up to 16 bytes).
  *  c) Write Thread Network Key characteristic  (16-byte master key, write-only).
- *  d) Optionally write Channel (1 byte, 11-26) and PAN ID (2 bytes LE).
+ *  d) Optionally write Channel (1 byte, 11-26, or 0 for the quietest channel
+ *     of an energy survey, MeshChannel.h) and PAN ID (2 bytes LE).
  *  e) Write 0x01 to the Join characteristic to start Thread network join.
  *  f) Subscribe to Thread Status notifications to watch the device role.
+ *  Or, instead of b) to e): write a whole Active Operational Dataset
+ *  ("ot-ctl dataset active -x") to the Dataset characteristic; the device
+ *  applies it and joins, or reports THREAD_STATUS_REJECTED.
+ *  g) Optionally write 0x01 to the Survey characteristic to measure channels
+ *     11-26, then read it back for the ranking (MeshChannel.h).
+ *  h) Optionally write this node's event signing key (16 bytes) and the
+ *     keys of the senders it trusts (device id + key) to the Auth
+ *     characteristic (MeshAuth.h), all in one connection: the keys are
+ *     locked when it closes.  Reading it returns the device id.
+ *  i) Instead of a) - g), write 0x01 (or 0x01 + PSKd) to the Joiner
+ *     characteristic to get the credentials from a Thread commissioner
+ *     (MeshJoiner.h); progress is on the Thread Status characteristic.
  *
  * --- Motion Detection Service workflow ---
  *  a) Enable notifications on the Motion Status characteristic.
@@ -52,6 +65,11 @@
 #include "bstream.h"
 #include "qReg.h"
 #include "MotionDetector_Config.h"
+#include "MeshAuth.h"
+#include "MeshChannel.h"
+#include "MeshDataset.h"
+#include "MeshDiag.h"
+#include "MeshJoiner.h"
 
 #define BLE_CHARACTERISTIC_VALUE_UUID_OFFSET 3
 
@@ -109,6 +127,31 @@
     0x06, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
     0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
 
+/* Thread Diagnostics Characteristic  : D00RBELL-0002-1000-8000-00805F9B3407 */
+#define THREAD_DIAG_CHAR_UUID_128 \
+    0x07, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Dataset Characteristic      : D00RBELL-0002-1000-8000-00805F9B3408 */
+#define THREAD_DATASET_CHAR_UUID_128 \
+    0x08, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Survey Characteristic       : D00RBELL-0002-1000-8000-00805F9B340A */
+#define THREAD_SURVEY_CHAR_UUID_128 \
+    0x0A, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Auth Characteristic         : D00RBELL-0002-1000-8000-00805F9B340B */
+#define THREAD_AUTH_CHAR_UUID_128 \
+    0x0B, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
+/* Thread Joiner Characteristic       : D00RBELL-0002-1000-8000-00805F9B340C */
+#define THREAD_JOINER_CHAR_UUID_128 \
+    0x0C, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, \
+    0x02, 0x10, 0x00, 0x00, 0x11, 0xBE, 0x00, 0xD0
+
 /* Standard GATT UUIDs */
 static const uint8_t attTypePrimSvcUuid[ATT_16_UUID_LEN]  = {UINT16_TO_BYTES(ATT_UUID_PRIMARY_SERVICE)};
 static const uint8_t attTypeCharUuid[ATT_16_UUID_LEN]     = {UINT16_TO_BYTES(ATT_UUID_CHARACTERISTIC)};
@@ -236,6 +279,46 @@ static uint16_t       threadStatusValueLen  = 1;
 static uint8_t        threadStatusCcc[]     = {UINT16_TO_BYTES(0x0000)};
 static const uint16_t threadStatusCccLen    = sizeof(threadStatusCcc);
 
+/* Thread Diagnostics characteristic (read): latest MeshDiag snapshot frame */
+static const uint8_t  threadDiagCh[]        = {ATT_PROP_READ,
+                                                UINT16_TO_BYTES(THREAD_DIAG_HDL),
+                                                THREAD_DIAG_CHAR_UUID_128};
+static const uint16_t threadDiagChLen       = sizeof(threadDiagCh);
+static uint8_t        threadDiagValue[MESH_DIAG_MAX_FRAME];
+static uint16_t       threadDiagValueLen    = 0;
+
+/* Thread Dataset characteristic (write-only): MeshCoP TLVs, assembled by MeshDataset */
+static const uint8_t  threadDatasetCh[]     = {ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_DATASET_HDL),
+                                                THREAD_DATASET_CHAR_UUID_128};
+static const uint16_t threadDatasetChLen    = sizeof(threadDatasetCh);
+static uint8_t        threadDatasetValue[MESH_DATASET_MAX_LEN];
+static uint16_t       threadDatasetValueLen = 0;
+
+/* Thread Survey characteristic (read + write): MeshChannel survey frame */
+static const uint8_t  threadSurveyCh[]      = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_SURVEY_HDL),
+                                                THREAD_SURVEY_CHAR_UUID_128};
+static const uint16_t threadSurveyChLen     = sizeof(threadSurveyCh);
+static uint8_t        threadSurveyValue[MESH_CHANNEL_SURVEY_LEN] = {MeshChannel_Idle};
+static uint16_t       threadSurveyValueLen  = 2;
+
+/* Thread Auth characteristic (read + write): keys in, device id out */
+static const uint8_t  threadAuthCh[]        = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_AUTH_HDL),
+                                                THREAD_AUTH_CHAR_UUID_128};
+static const uint16_t threadAuthChLen       = sizeof(threadAuthCh);
+static uint8_t        threadAuthValue[MESH_AUTH_WRITE_MAX] = {0};
+static uint16_t       threadAuthValueLen    = MESH_AUTH_INFO_LEN;
+
+/* Thread Joiner characteristic (read + write): start / PSKd in, progress out */
+static const uint8_t  threadJoinerCh[]      = {ATT_PROP_READ | ATT_PROP_WRITE,
+                                                UINT16_TO_BYTES(THREAD_JOINER_HDL),
+                                                THREAD_JOINER_CHAR_UUID_128};
+static const uint16_t threadJoinerChLen     = sizeof(threadJoinerCh);
+static uint8_t        threadJoinerValue[MESH_JOINER_WRITE_MAX] = {0};
+static uint16_t       threadJoinerValueLen  = MESH_JOINER_INFO_LEN;
+
 /* clang-format off */
 static const attsAttr_t ThreadCfg_GATT_List[] = {
     { attTypePrimSvcUuid, (uint8_t*)threadCfgSvcUuid, (uint16_t*)&threadCfgSvcLen, sizeof(threadCfgSvcUuid), ATTS_SET_UUID_128, ATTS_PERMIT_READ },
@@ -258,6 +341,26 @@ static const attsAttr_t ThreadCfg_GATT_List[] = {
     { attTypeCharUuid, (uint8_t*)threadStatusCh, (uint16_t*)&threadStatusChLen, sizeof(threadStatusCh), 0, ATTS_PERMIT_READ },
     { &threadStatusCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadStatusValue, &threadStatusValueLen, THREAD_STATUS_LEN, ATTS_SET_UUID_128, ATTS_PERMIT_READ },
     { attTypeCliChCfgUuid, threadStatusCcc, (uint16_t*)&threadStatusCccLen, sizeof(threadStatusCcc), ATTS_SET_CCC, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Diagnostics: read-only */
+    { attTypeCharUuid, (uint8_t*)threadDiagCh, (uint16_t*)&threadDiagChLen, sizeof(threadDiagCh), 0, ATTS_PERMIT_READ },
+    { &threadDiagCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadDiagValue, &threadDiagValueLen, MESH_DIAG_MAX_FRAME, ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ },
+
+    /* Dataset: write-only, long writes allowed */
+    { attTypeCharUuid, (uint8_t*)threadDatasetCh, (uint16_t*)&threadDatasetChLen, sizeof(threadDatasetCh), 0, ATTS_PERMIT_READ },
+    { &threadDatasetCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadDatasetValue, &threadDatasetValueLen, MESH_DATASET_MAX_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN | ATTS_SET_ALLOW_OFFSET, ATTS_PERMIT_WRITE },
+
+    /* Survey: read + write (0x01 starts a survey) */
+    { attTypeCharUuid, (uint8_t*)threadSurveyCh, (uint16_t*)&threadSurveyChLen, sizeof(threadSurveyCh), 0, ATTS_PERMIT_READ },
+    { &threadSurveyCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadSurveyValue, &threadSurveyValueLen, MESH_CHANNEL_SURVEY_LEN, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Auth: read + write */
+    { attTypeCharUuid, (uint8_t*)threadAuthCh, (uint16_t*)&threadAuthChLen, sizeof(threadAuthCh), 0, ATTS_PERMIT_READ },
+    { &threadAuthCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadAuthValue, &threadAuthValueLen, MESH_AUTH_WRITE_MAX, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
+
+    /* Joiner: read + write */
+    { attTypeCharUuid, (uint8_t*)threadJoinerCh, (uint16_t*)&threadJoinerChLen, sizeof(threadJoinerCh), 0, ATTS_PERMIT_READ },
+    { &threadJoinerCh[BLE_CHARACTERISTIC_VALUE_UUID_OFFSET], threadJoinerValue, &threadJoinerValueLen, MESH_JOINER_WRITE_MAX, ATTS_SET_WRITE_CBACK | ATTS_SET_UUID_128 | ATTS_SET_VARIABLE_LEN, ATTS_PERMIT_READ | ATTS_PERMIT_WRITE },
 };
 /* clang-format on */
 
@@ -354,3 +457,37 @@ uint8_t ThreadCfg_GetStatus(void)
 {
     return threadStatusValue[0];
 }
+
+void ThreadCfg_SetDiagnostics(const uint8_t* pData, uint16_t len)
+{
+    if(len > MESH_DIAG_MAX_FRAME)
+    {
+        len = MESH_DIAG_MAX_FRAME;
+    }
+    memcpy(threadDiagValue, pData, len);
+    threadDiagValueLen = len;
+}
+
+void ThreadCfg_SetSurvey(const uint8_t* pSurvey, uint16_t len)
+{
+    if(len > MESH_CHANNEL_SURVEY_LEN)
+    {
+        len = MESH_CHANNEL_SURVEY_LEN;
+    }
+    memcpy(threadSurveyValue, pSurvey, len);
+    threadSurveyValueLen = len;
+}
+
+void ThreadCfg_SetAuth(const uint8_t* pInfo)
+{
+    memset(threadAuthValue, 0, sizeof(threadAuthValue));
+    memcpy(threadAuthValue, pInfo, MESH_AUTH_INFO_LEN);
+    threadAuthValueLen = MESH_AUTH_INFO_LEN;
+}
+
+void ThreadCfg_SetJoiner(const uint8_t* pInfo)
+{
+    memset(threadJoinerValue, 0, sizeof(threadJoinerValue));
+    memcpy(threadJoinerValue, pInfo, MESH_JOINER_INFO_LEN);
+    threadJoinerValueLen = MESH_JOINER_INFO_LEN;
+}
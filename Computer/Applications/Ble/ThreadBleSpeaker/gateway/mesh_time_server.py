@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+mesh_time_server.py  –  QPG6200 Thread Mesh Time: Master Responder
+===================================================================
+
+Runs on the Raspberry Pi gateway (OpenThread Border Router).
+
+Purpose
+-------
+Mesh time is the clock of the Thread leader.  When a QPG6200 node is leader
+its firmware answers time requests itself (shared/MeshTimeSync.c).  When the
+border router is leader, the requests arrive at the Pi instead, and this
+script answers them so speakers and doorbells can still agree on a time.
+
+Data flow
+---------
+  node  ── 14-byte request  [0x06, seq, t1, pad]      ──►  this script, UDP 5687
+  node  ◄── 14-byte response [0x07, seq, t1, t2, t3]  ──   this script
+
+Message format (see MeshTime.h in the firmware)
+-----------------------------------------------
+  Request   Byte 0     : 0x06
+            Byte 1     : sequence number
+            Byte 2-5   : t1, client send time (BE32, client clock)
+            Byte 6-13  : padding (same length as the response)
+  Response  Byte 0     : 0x07
+            Byte 1     : sequence number (echoed)
+            Byte 2-5   : t1 (echoed)
+            Byte 6-9   : t2, request receive time (BE32, mesh time)
+            Byte 10-13 : t3, response send time   (BE32, mesh time)
+
+Mesh time here is CLOCK_MONOTONIC in microseconds, truncated to 32 bits.
+Nodes only ever use differences, so the epoch does not matter.  Receive
+timestamps are taken in user space, so Linux scheduling jitter adds to the
+round trip; the nodes' minimum round-trip filter removes most of it.
+
+Dependencies
+------------
+  Python 3.8+ standard library only.
+
+Usage
+-----
+  python3 mesh_time_server.py [--port PORT] [--debug]
+"""
+
+import argparse
+import logging
+import signal
+import socket
+import struct
+import sys
+import time
+
+# ---------------------------------------------------------------------------
+#  Logging
+# ---------------------------------------------------------------------------
+
+logging.basicConfig(
+    level=logging.INFO,
+    format="%(asctime)s [%(levelname)s] %(name)s: %(message)s",
+    datefmt="%Y-%m-%d %H:%M:%S",
+    stream=sys.stderr,
+)
+log = logging.getLogger("mesh_time")
+
+# ---------------------------------------------------------------------------
+#  Configuration defaults
+# ---------------------------------------------------------------------------
+
+MESH_TIME_PORT   = 5687       # MESH_TIME_UDP_PORT in MeshTimeSync.h
+MSG_REQUEST      = 0x06
+MSG_RESPONSE     = 0x07
+MSG_LEN          = 14
+
+STATS_INTERVAL_SEC = 60
+
+
+def mesh_now_us() -> int:
+    """Mesh time: monotonic microseconds, wrapped to 32 bits like the nodes."""
+    return (time.monotonic_ns() // 1000) & 0xFFFFFFFF
+
+
+def build_response(request: bytes, t2: int, t3: int):
+    """Return the response for a valid request, or None."""
+    if len(request) != MSG_LEN or request[0] != MSG_REQUEST:
+        return None
+    return struct.pack(">BB4sII", MSG_RESPONSE, request[1], request[2:6], t2, t3)
+
+
+# ---------------------------------------------------------------------------
+#  Main loop
+# ---------------------------------------------------------------------------
+
+def _run(args) -> None:
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    sock.bind(("::", args.port))
+    sock.settimeout(1.0)
+
+    running = True
+
+    def _shutdown(sig, frame):
+        nonlocal running
+        running = False
+
+    signal.signal(signal.SIGINT, _shutdown)
+    signal.signal(signal.SIGTERM, _shutdown)
+
+    answered = 0
+    ignored = 0
+    peers = set()
+    next_stats = time.monotonic() + STATS_INTERVAL_SEC
+
+    try:
+        while running:
+            try:
+                data, addr = sock.recvfrom(64)
+            except socket.timeout:
+                data = None
+
+            if data is not None:
+                t2 = mesh_now_us()
+                rsp = build_response(data, t2, mesh_now_us())
+                if rsp is None:
+                    ignored += 1
+                    log.debug("Ignoring %d-byte datagram from %s", len(data), addr[0])
+                else:
+                    # Re-stamp t3 as late as possible before the send
+                    rsp = rsp[:10] + struct.pack(">I", mesh_now_us())
+                    sock.sendto(rsp, addr)
+                    answered += 1
+                    peers.add(addr[0])
+                    log.debug("seq %d from [%s] t2 %d", data[1], addr[0], t2)
+
+            if time.monotonic() >= next_stats:
+                log.info("answered %d ignored %d nodes %d", answered, ignored, len(peers))
+                next_stats = time.monotonic() + STATS_INTERVAL_SEC
+    finally:
+        sock.close()
+        log.info("Stopped: answered %d requests from %d nodes", answered, len(peers))
+
+
+def _parse_args():
+    parser = argparse.ArgumentParser(
+        description="Mesh time responder for QPG6200 Thread nodes (border router as leader)"
+    )
+    parser.add_argument("--port", type=int, default=MESH_TIME_PORT,
+                        help=f"UDP port to answer on (default: {MESH_TIME_PORT})")
+    parser.add_argument("--debug", action="store_true",
+                        help="Enable verbose DEBUG logging")
+    return parser.parse_args()
+
+
+def main() -> None:
+    args = _parse_args()
+
+    if args.debug:
+        logging.getLogger().setLevel(logging.DEBUG)
+
+    log.info("Answering mesh time requests on UDP port %d", args.port)
+    _run(args)
+
+
+if __name__ == "__main__":
+    main()
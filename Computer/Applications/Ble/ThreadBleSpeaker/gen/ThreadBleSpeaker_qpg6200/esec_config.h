@@ -0,0 +1,149 @@
+#define ESEC_ROM_SIZE 49152
+#define EXTDMA_AXI_ADDR_WIDTH 32
+#define DBG_GRANT_SIZE 1
+#define CHIF_ENABLED 1
+#define IKG_ENABLED 0
+#define AES_ENABLED 1
+#define AES_ECB_ENABLED 1
+#define AES_CBC_ENABLED 1
+#define AES_CTR_ENABLED 1
+#define AES_CFB_ENABLED 1
+#define AES_OFB_ENABLED 0
+#define AES_CCM_ENABLED 1
+#define AES_GCM_ENABLED 1
+#define AES_XTS_ENABLED 0
+#define AES_CMAC_ENABLED 1
+#define AES_CM_ENABLED 1
+#define AES_128_ENABLED 1
+#define AES_192_ENABLED 1
+#define AES_256_ENABLED 1
+#define DES_ENABLED 0
+#define HASH_ENABLED 1
+#define MD5_ENABLED 0
+#define SHA1_ENABLED 1
+#define SHA224_ENABLED 1
+#define SHA256_ENABLED 1
+#define SHA384_ENABLED 1
+#define SHA512_ENABLED 1
+#define SM3_ENABLED 0
+#define HASH_PADDING_ENABLED 1
+#define HMAC_ENABLED 1
+#define PK_MULTIPLIERS 4
+#define PK_MAX_OP_SIZE 521
+#define CHACHAPOLY_ENABLED 0
+#define SHA3_ENABLED 0
+#define SM4_ENABLED 0
+#define SM4_ECB_ENABLED 1
+#define SM4_CBC_ENABLED 1
+#define SM4_CTR_ENABLED 1
+#define SM4_CFB_ENABLED 1
+#define SM4_OFB_ENABLED 1
+#define SM4_GCM_ENABLED 1
+#define SM4_XTS_ENABLED 0
+#define SM4_CMAC_ENABLED 0
+#define ARIA_ENABLED 0
+#define ARIA_ECB_ENABLED 1
+#define ARIA_CBC_ENABLED 1
+#define ARIA_CTR_ENABLED 1
+#define ARIA_CFB_ENABLED 1
+#define ARIA_OFB_ENABLED 1
+#define ARIA_CCM_ENABLED 1
+#define ARIA_GCM_ENABLED 1
+#define ARIA_CMAC_ENABLED 1
+#define AIS31_ENABLED 1
+#define PK_CM_ENABLED 1
+#define DH_MODP_ENABLED 1
+#define SRP_ENABLED 0
+#define JPAKE_ENABLED 1
+#define ECC_BINARY_ENABLED 0
+#define ECC_MONTGOMERY_ENABLED 1
+#define PRIME_GEN_ENABLED 1
+#define RSA_ENABLED 0
+#define ALWAYSON_ENABLED 0
+#define DSA_ENABLED 0
+#define ECKCDSA_ENABLED 0
+#define AES_KEY_WRAP_ENABLED 1
+#define PUF_SAFE_ENABLED 0
+#define PUF_PLUS_ENABLED 0
+#define SECCFG_STOR SECCFG_STOR_OTP
+#define SRK_SRC otp
+#define EK_SRC EK_SRC_SECCFG
+#define SYM_MAX_KEY_SIZE 512
+#define DH_MAX_KEY_SIZE 512
+#define SRP_MAX_KEY_SIZE 512
+#define RSA_MAX_SIZE 512
+#define DSA_MAX_SIZE_P 384
+#define DSA_MAX_SIZE_Q 32
+#define PRIME_MAX_SIZE 256
+#define ECC_MAX_KEY_SIZE_BITS 571
+#define DERIV_MAX_SALT_SIZE 512
+#define DERIV_MAX_INFO_SIZE 512
+#define SEC_STOR_AUTH_SIZE 8
+#define VOLATILE_MAX_ID 2
+#define ARTABLE_SIZE 0
+#define RNG_CLKDIV 7
+#define RNG_OFF_TIMER_VAL 0
+#define RNG_FIFO_WAKEUP_LVL 0
+#define RNG_INIT_WAIT_VAL 512
+#define RNG_NB_128BIT_BLOCKS 8
+#define ESEC_HASH_DRBG_SEC_STRENGTH 128
+#define OTPHOST_SIZE 1024
+#define NR_PUBKEY_MAN 2
+#define NR_FRK 2
+#define OTP_NR_ESEC_VERSION 32
+#define OTP_NR_HOST_VERSION 32
+#define PK_CM_RAND_PROJ 1
+#define PK_CM_RAND_SCALAR 1
+#define PK_CM_RAND_MODULUS 1
+#define PK_CM_RAND_EXPONENT 1
+#define ESEC_BL_RAM_SIZE 2048
+#define ESEC_BL_STACK_SIZE 4000
+#define ESEC_FW_STACK_SIZE 6000
+#define WD_LVL1_TIMEOUT 1000000
+#define WD_LVL2_TIMEOUT 10000
+#define CFG_AUTH_ALGO AUTH_ALGO_ECDSA_P256
+#define PUBKEY_HASH_ALGO_SHA256 0
+#define PUBKEY_HASH_ALGO_SHA384 1
+#define PUBKEY_HASH_ALGO_SHA512 2
+#define PUBKEY_HASH_ALGO PUBKEY_HASH_ALGO_SHA256
+#define ESEC_ROOT_KEYS_SIZE 32
+#define ESEC_FREQ 250
+#define QSPI_ENABLED 0
+#define QSPI_FREQ_TARGET 104
+#define QSPI_INPUT_DELAY 4500
+#define QSPI_OUTPUT_DELAY 4500
+#define ADDR_FLASH_HOST 1879048192
+#define FLASH_SIZE 131072
+#define FLASH_OFFSET_FW_PTRS 0
+#define FLASH_OFFSET_SECCFG 253952
+#define ADDR_RAM_HOST 2752512000
+#define HOST_FW_RAM_SIZE 16384
+#define HOST_BOOT_ENABLED 1
+#define ED25519_ENABLED 1
+#define ED448_ENABLED 0
+#define ED25519_CM_ENABLED 1
+#define SM2_ENABLED 0
+#define BRAINPOOL_ENABLED 0
+#define APB_REGION_NR 0
+#define APB_REGION1_OFFSET 8388608
+#define APB_REGION1_SIZE 32
+#define APB_REGION1_SECURE_ACCESS 1
+#define APB_REGION1_PRIVILIGED_ACCESS 0
+#define APB_REGION1_USER_BITS 0
+#define APB_REGION2_OFFSET 8389632
+#define APB_REGION2_SIZE 64
+#define APB_REGION2_SECURE_ACCESS 1
+#define APB_REGION2_PRIVILIGED_ACCESS 1
+#define APB_REGION2_USER_BITS 33686018
+#define APB_REGION3_OFFSET 8390656
+#define APB_REGION3_SIZE 256
+#define APB_REGION3_SECURE_ACCESS 0
+#define APB_REGION3_PRIVILIGED_ACCESS 1
+#define APB_REGION3_USER_BITS 808464432
+#define APB_REGION4_OFFSET 8391680
+#define APB_REGION4_SIZE 1024
+#define APB_REGION4_SECURE_ACCESS 0
+#define APB_REGION4_PRIVILIGED_ACCESS 0
+#define APB_REGION4_USER_BITS 67372036
+#define VIRTUAL_TIME_CM_BIT_SIZE 0
+#define VIRTUAL_TIME_SM_BIT_SIZE 0
@@ -0,0 +1,40848 @@
+/*
+ * Copyright (c) 2015-2016, GreenPeak Technologies
+ * Copyright (c) 2017, Qorvo Inc
+ *
+ * !!! This is a generated file. !!!
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+#include "global.h"
+
+/*****************************************************************************
+ *                    Macro Definitions
+ *****************************************************************************/
+
+/*
+ * Defines the offset from the flash start to the start of the RT system.
+ * This should match rt_system_start_offset defined in the linkerscript.
+*/
+#define GP_HAL_FLASH_RT_OFFSET_FROM_START   0x1f800
+
+/*****************************************************************************
+ *                    Functional Macro Definitions
+ *****************************************************************************/
+
+/*
+ * Defines the addres offset to make RT relocatable.
+ */
+#define GP_HAL_FLASH_GET_RT_OFFSET()    ((GP_HAL_FLASH_RT_OFFSET_FROM_START % 0x20000)/2)
+
+/*****************************************************************************
+ *                    Data Definitions
+ *****************************************************************************/
+
+/*
+ * The actual RT system data.
+ */
+const ROM UInt16 gpHal_RtSystem_FlashData[] LINKER_SECTION(".rt_flash") = {
+    0x0000,
+    0x4204,
+    0xF881,
+    0x1001,
+    0xC365,
+    0x1002,
+    0xC377,
+    0x1002,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0xC377,
+    0x1002,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0xC377,
+    0x1002,
+    0xC377,
+    0x1002,
+    0xC389,
+    0x1002,
+    0x9CCD,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xD989,
+    0x1002,
+    0xA501,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xA451,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xA1CD,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xA27D,
+    0x1002,
+    0xC365,
+    0x1002,
+    0xC365,
+    0x1002,
+    0x2000,
+    0x2100,
+    0x2200,
+    0x2300,
+    0x2400,
+    0x2500,
+    0x2600,
+    0x2700,
+    0x4688,
+    0x4689,
+    0x468A,
+    0x468B,
+    0x468C,
+    0x468E,
+    0xF00E,
+    0xFAF8,
+    0xC0F0,
+    0x4641,
+    0x464A,
+    0x4653,
+    0x465C,
+    0x466D,
+    0x4676,
+    0xC07E,
+    0x3828,
+    0xC8F0,
+    0x2000,
+    0x4770,
+    0x3010,
+    0xC87C,
+    0x4690,
+    0x4699,
+    0x46A2,
+    0x46AB,
+    0x46B5,
+    0xC808,
+    0x3828,
+    0xC8F0,
+    0x0008,
+    0xD100,
+    0x2001,
+    0x4718,
+    0xB402,
+    0x4671,
+    0x0849,
+    0x0049,
+    0x5609,
+    0x0049,
+    0x448E,
+    0xBC02,
+    0x4770,
+    0x46C0,
+    0xB402,
+    0x4671,
+    0x0849,
+    0x0049,
+    0x5C09,
+    0x0049,
+    0x448E,
+    0xBC02,
+    0x4770,
+    0x46C0,
+    0xB403,
+    0x4671,
+    0x0849,
+    0x0040,
+    0x0049,
+    0x5E09,
+    0x0049,
+    0x448E,
+    0xBC03,
+    0x4770,
+    0xB403,
+    0x4671,
+    0x0849,
+    0x0040,
+    0x0049,
+    0x5A09,
+    0x0049,
+    0x448E,
+    0xBC03,
+    0x4770,
+    0x2200,
+    0x0843,
+    0x428B,
+    0xD374,
+    0x0903,
+    0x428B,
+    0xD35F,
+    0x0A03,
+    0x428B,
+    0xD344,
+    0x0B03,
+    0x428B,
+    0xD328,
+    0x0C03,
+    0x428B,
+    0xD30D,
+    0x22FF,
+    0x0209,
+    0xBA12,
+    0x0C03,
+    0x428B,
+    0xD302,
+    0x1212,
+    0x0209,
+    0xD065,
+    0x0B03,
+    0x428B,
+    0xD319,
+    0xE000,
+    0x0A09,
+    0x0BC3,
+    0x428B,
+    0xD301,
+    0x03CB,
+    0x1AC0,
+    0x4152,
+    0x0B83,
+    0x428B,
+    0xD301,
+    0x038B,
+    0x1AC0,
+    0x4152,
+    0x0B43,
+    0x428B,
+    0xD301,
+    0x034B,
+    0x1AC0,
+    0x4152,
+    0x0B03,
+    0x428B,
+    0xD301,
+    0x030B,
+    0x1AC0,
+    0x4152,
+    0x0AC3,
+    0x428B,
+    0xD301,
+    0x02CB,
+    0x1AC0,
+    0x4152,
+    0x0A83,
+    0x428B,
+    0xD301,
+    0x028B,
+    0x1AC0,
+    0x4152,
+    0x0A43,
+    0x428B,
+    0xD301,
+    0x024B,
+    0x1AC0,
+    0x4152,
+    0x0A03,
+    0x428B,
+    0xD301,
+    0x020B,
+    0x1AC0,
+    0x4152,
+    0xD2CD,
+    0x09C3,
+    0x428B,
+    0xD301,
+    0x01CB,
+    0x1AC0,
+    0x4152,
+    0x0983,
+    0x428B,
+    0xD301,
+    0x018B,
+    0x1AC0,
+    0x4152,
+    0x0943,
+    0x428B,
+    0xD301,
+    0x014B,
+    0x1AC0,
+    0x4152,
+    0x0903,
+    0x428B,
+    0xD301,
+    0x010B,
+    0x1AC0,
+    0x4152,
+    0x08C3,
+    0x428B,
+    0xD301,
+    0x00CB,
+    0x1AC0,
+    0x4152,
+    0x0883,
+    0x428B,
+    0xD301,
+    0x008B,
+    0x1AC0,
+    0x4152,
+    0x0843,
+    0x428B,
+    0xD301,
+    0x004B,
+    0x1AC0,
+    0x4152,
+    0x1A41,
+    0xD200,
+    0x4601,
+    0x4152,
+    0x4610,
+    0x4770,
+    0xE7FF,
+    0xB501,
+    0x2000,
+    0xF000,
+    0xF8F0,
+    0xBD02,
+    0x46C0,
+    0x2900,
+    0xD0F7,
+    0xE776,
+    0x4770,
+    0x4603,
+    0x430B,
+    0xD47F,
+    0x2200,
+    0x0843,
+    0x428B,
+    0xD374,
+    0x0903,
+    0x428B,
+    0xD35F,
+    0x0A03,
+    0x428B,
+    0xD344,
+    0x0B03,
+    0x428B,
+    0xD328,
+    0x0C03,
+    0x428B,
+    0xD30D,
+    0x22FF,
+    0x0209,
+    0xBA12,
+    0x0C03,
+    0x428B,
+    0xD302,
+    0x1212,
+    0x0209,
+    0xD065,
+    0x0B03,
+    0x428B,
+    0xD319,
+    0xE000,
+    0x0A09,
+    0x0BC3,
+    0x428B,
+    0xD301,
+    0x03CB,
+    0x1AC0,
+    0x4152,
+    0x0B83,
+    0x428B,
+    0xD301,
+    0x038B,
+    0x1AC0,
+    0x4152,
+    0x0B43,
+    0x428B,
+    0xD301,
+    0x034B,
+    0x1AC0,
+    0x4152,
+    0x0B03,
+    0x428B,
+    0xD301,
+    0x030B,
+    0x1AC0,
+    0x4152,
+    0x0AC3,
+    0x428B,
+    0xD301,
+    0x02CB,
+    0x1AC0,
+    0x4152,
+    0x0A83,
+    0x428B,
+    0xD301,
+    0x028B,
+    0x1AC0,
+    0x4152,
+    0x0A43,
+    0x428B,
+    0xD301,
+    0x024B,
+    0x1AC0,
+    0x4152,
+    0x0A03,
+    0x428B,
+    0xD301,
+    0x020B,
+    0x1AC0,
+    0x4152,
+    0xD2CD,
+    0x09C3,
+    0x428B,
+    0xD301,
+    0x01CB,
+    0x1AC0,
+    0x4152,
+    0x0983,
+    0x428B,
+    0xD301,
+    0x018B,
+    0x1AC0,
+    0x4152,
+    0x0943,
+    0x428B,
+    0xD301,
+    0x014B,
+    0x1AC0,
+    0x4152,
+    0x0903,
+    0x428B,
+    0xD301,
+    0x010B,
+    0x1AC0,
+    0x4152,
+    0x08C3,
+    0x428B,
+    0xD301,
+    0x00CB,
+    0x1AC0,
+    0x4152,
+    0x0883,
+    0x428B,
+    0xD301,
+    0x008B,
+    0x1AC0,
+    0x4152,
+    0x0843,
+    0x428B,
+    0xD301,
+    0x004B,
+    0x1AC0,
+    0x4152,
+    0x1A41,
+    0xD200,
+    0x4601,
+    0x4152,
+    0x4610,
+    0x4770,
+    0xE05D,
+    0x0FCA,
+    0xD000,
+    0x4249,
+    0x1003,
+    0xD300,
+    0x4240,
+    0x4053,
+    0x2200,
+    0x469C,
+    0x0903,
+    0x428B,
+    0xD32D,
+    0x0A03,
+    0x428B,
+    0xD312,
+    0x22FC,
+    0x0189,
+    0xBA12,
+    0x0A03,
+    0x428B,
+    0xD30C,
+    0x0189,
+    0x1192,
+    0x428B,
+    0xD308,
+    0x0189,
+    0x1192,
+    0x428B,
+    0xD304,
+    0x0189,
+    0xD03A,
+    0x1192,
+    0xE000,
+    0x0989,
+    0x09C3,
+    0x428B,
+    0xD301,
+    0x01CB,
+    0x1AC0,
+    0x4152,
+    0x0983,
+    0x428B,
+    0xD301,
+    0x018B,
+    0x1AC0,
+    0x4152,
+    0x0943,
+    0x428B,
+    0xD301,
+    0x014B,
+    0x1AC0,
+    0x4152,
+    0x0903,
+    0x428B,
+    0xD301,
+    0x010B,
+    0x1AC0,
+    0x4152,
+    0x08C3,
+    0x428B,
+    0xD301,
+    0x00CB,
+    0x1AC0,
+    0x4152,
+    0x0883,
+    0x428B,
+    0xD301,
+    0x008B,
+    0x1AC0,
+    0x4152,
+    0xD2D9,
+    0x0843,
+    0x428B,
+    0xD301,
+    0x004B,
+    0x1AC0,
+    0x4152,
+    0x1A41,
+    0xD200,
+    0x4601,
+    0x4663,
+    0x4152,
+    0x105B,
+    0x4610,
+    0xD301,
+    0x4240,
+    0x2B00,
+    0xD500,
+    0x4249,
+    0x4770,
+    0x4663,
+    0x105B,
+    0xD300,
+    0x4240,
+    0xB501,
+    0x2000,
+    0xF000,
+    0xF805,
+    0xBD02,
+    0x2900,
+    0xD0F8,
+    0xE716,
+    0x4770,
+    0x4770,
+    0x46C0,
+    0x2B00,
+    0xD111,
+    0x2A00,
+    0xD10F,
+    0x2900,
+    0xD100,
+    0x2800,
+    0xD002,
+    0x2100,
+    0x43C9,
+    0x0008,
+    0xB407,
+    0x4802,
+    0xA102,
+    0x1840,
+    0x9002,
+    0xBD03,
+    0x46C0,
+    0xFFD9,
+    0xFFFF,
+    0xB403,
+    0x4668,
+    0xB501,
+    0x9802,
+    0xF011,
+    0xFD6E,
+    0x9B01,
+    0x469E,
+    0xB002,
+    0xBC0C,
+    0x4770,
+    0x46C0,
+    0xB510,
+    0x2900,
+    0xD103,
+    0xF000,
+    0xF807,
+    0x3020,
+    0xE002,
+    0x0008,
+    0xF000,
+    0xF802,
+    0xBD10,
+    0x46C0,
+    0x211C,
+    0x2301,
+    0x041B,
+    0x4298,
+    0xD301,
+    0x0C00,
+    0x3910,
+    0x0A1B,
+    0x4298,
+    0xD301,
+    0x0A00,
+    0x3908,
+    0x091B,
+    0x4298,
+    0xD301,
+    0x0900,
+    0x3904,
+    0xA202,
+    0x5C10,
+    0x1840,
+    0x4770,
+    0x46C0,
+    0x0304,
+    0x0202,
+    0x0101,
+    0x0101,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0xB510,
+    0x4B14,
+    0x3901,
+    0x781C,
+    0x2334,
+    0x06A4,
+    0x0F64,
+    0x4363,
+    0x4C11,
+    0x03C9,
+    0x191B,
+    0x0C49,
+    0x2A00,
+    0xD017,
+    0x2205,
+    0x4C0F,
+    0x6018,
+    0x2003,
+    0x605C,
+    0x6099,
+    0x6999,
+    0x0092,
+    0x4381,
+    0x3802,
+    0x4301,
+    0x6199,
+    0x2100,
+    0x6219,
+    0x3104,
+    0x6259,
+    0x6298,
+    0x61D8,
+    0x6999,
+    0x303B,
+    0x4381,
+    0x430A,
+    0x619A,
+    0xBD10,
+    0x2204,
+    0x4C04,
+    0xE7E6,
+    0x46C0,
+    0x013B,
+    0x4203,
+    0x5000,
+    0x4201,
+    0xA03C,
+    0x4200,
+    0xD158,
+    0x4200,
+    0xB5F8,
+    0x0013,
+    0x7B82,
+    0x2A00,
+    0xD01F,
+    0x2201,
+    0x2707,
+    0x0358,
+    0x0E1C,
+    0x4B15,
+    0x084D,
+    0x6B5E,
+    0x4015,
+    0x4396,
+    0x432E,
+    0x635E,
+    0x6A5E,
+    0x0709,
+    0x43BE,
+    0x0F89,
+    0x4331,
+    0x6259,
+    0x0B40,
+    0x2108,
+    0x641A,
+    0x2D00,
+    0xD00A,
+    0x6B5D,
+    0x438D,
+    0x635D,
+    0x6B5D,
+    0x3902,
+    0x4329,
+    0x6359,
+    0xB2E1,
+    0xF7FF,
+    0xFFA9,
+    0xBDF8,
+    0x6B5A,
+    0x3C01,
+    0x4311,
+    0x6359,
+    0x2106,
+    0x6B5A,
+    0x0064,
+    0x438A,
+    0x400C,
+    0x4314,
+    0x635C,
+    0x63D8,
+    0xE7F1,
+    0x46C0,
+    0xA000,
+    0x4200,
+    0xB5F8,
+    0x0005,
+    0x2702,
+    0x4C31,
+    0x001E,
+    0x6820,
+    0x006B,
+    0x43B8,
+    0x403B,
+    0x4303,
+    0x6023,
+    0x4C2E,
+    0x2D00,
+    0xD052,
+    0x0350,
+    0x0E15,
+    0x6B62,
+    0x3F01,
+    0x084B,
+    0x403B,
+    0x43BA,
+    0x431A,
+    0x6362,
+    0x6A62,
+    0x3706,
+    0x0709,
+    0x43BA,
+    0x0F89,
+    0x4311,
+    0x2280,
+    0x6261,
+    0x6CE1,
+    0x00D2,
+    0x430A,
+    0x64E2,
+    0x2204,
+    0x0B40,
+    0x6622,
+    0x1892,
+    0x2B00,
+    0xD02A,
+    0x6B63,
+    0xB2E9,
+    0x4393,
+    0x6363,
+    0x2306,
+    0x6B62,
+    0x4313,
+    0x6363,
+    0x2200,
+    0xF7FF,
+    0xFF64,
+    0x2308,
+    0x2207,
+    0x2103,
+    0x6623,
+    0x4B18,
+    0x781B,
+    0x4013,
+    0x322D,
+    0x435A,
+    0x4B17,
+    0x18D2,
+    0x4B17,
+    0x6013,
+    0x9B06,
+    0x6053,
+    0x6096,
+    0x6993,
+    0x438B,
+    0x3902,
+    0x430B,
+    0x6193,
+    0x2304,
+    0x6211,
+    0x6253,
+    0x6291,
+    0x6991,
+    0x3338,
+    0x4399,
+    0x3B30,
+    0x430B,
+    0x6193,
+    0xBDF8,
+    0x6B63,
+    0x3D01,
+    0x431A,
+    0x6362,
+    0x2206,
+    0x6B63,
+    0x006D,
+    0x4393,
+    0x4015,
+    0x431D,
+    0x6365,
+    0x65E0,
+    0xE7D2,
+    0x6CE3,
+    0x4A06,
+    0x4013,
+    0x64E3,
+    0xE7EC,
+    0x6000,
+    0x4200,
+    0xD0FC,
+    0x4200,
+    0x013B,
+    0x4203,
+    0x5000,
+    0x4201,
+    0xD154,
+    0x4200,
+    0xFBFF,
+    0xFFFF,
+    0x2200,
+    0xB510,
+    0x0011,
+    0x0004,
+    0x0010,
+    0xF009,
+    0xFDE9,
+    0x4B07,
+    0x781B,
+    0x069B,
+    0xD506,
+    0x4B06,
+    0x699A,
+    0x7D93,
+    0x4259,
+    0x414B,
+    0xB2DB,
+    0x7593,
+    0x0020,
+    0xF00C,
+    0xFFEF,
+    0xBD10,
+    0x0113,
+    0x4203,
+    0xC800,
+    0x4203,
+    0xB570,
+    0x4B13,
+    0x781B,
+    0x2B00,
+    0xD003,
+    0x2001,
+    0xF7FF,
+    0xFFDE,
+    0xBD70,
+    0x2001,
+    0x4A0F,
+    0x6991,
+    0x7050,
+    0x7D4C,
+    0x7D4B,
+    0x08A4,
+    0xB2DB,
+    0x4204,
+    0xD00C,
+    0x08DB,
+    0x4203,
+    0xD009,
+    0x2520,
+    0x4B0A,
+    0x4C0A,
+    0x7818,
+    0x6FE0,
+    0x781B,
+    0x43A8,
+    0x402B,
+    0x4303,
+    0x67E3,
+    0x8908,
+    0x4B07,
+    0x6851,
+    0x18C0,
+    0xF011,
+    0xFD18,
+    0xE7E0,
+    0x46C0,
+    0x020A,
+    0x4203,
+    0xC800,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x8000,
+    0x4203,
+    0x4B16,
+    0xB570,
+    0x699C,
+    0x0001,
+    0x0020,
+    0x781A,
+    0x300C,
+    0x3201,
+    0xB2D2,
+    0x1880,
+    0x701A,
+    0x7805,
+    0xB2E8,
+    0x2DFF,
+    0xD103,
+    0x2001,
+    0xF7FF,
+    0xFFA2,
+    0xBD70,
+    0x2A02,
+    0xD8F9,
+    0x7518,
+    0x2900,
+    0xD003,
+    0x88A1,
+    0x685A,
+    0x1852,
+    0x605A,
+    0x4A09,
+    0x7812,
+    0x2A00,
+    0xD1EE,
+    0x689A,
+    0x685B,
+    0x1AD3,
+    0xD4EA,
+    0x2340,
+    0x4A06,
+    0x4303,
+    0x8413,
+    0xF00C,
+    0xF916,
+    0xF7FF,
+    0xFFA2,
+    0xE7E4,
+    0x46C0,
+    0xC800,
+    0x4203,
+    0x020A,
+    0x4203,
+    0x5000,
+    0x4200,
+    0xB5F7,
+    0x8943,
+    0x4AAC,
+    0x4DAD,
+    0x4EAD,
+    0x9000,
+    0xB29F,
+    0x189B,
+    0x8830,
+    0x61AB,
+    0x9B00,
+    0x2118,
+    0x1A18,
+    0x4BAA,
+    0x8834,
+    0x18C0,
+    0xF7FF,
+    0xFCD4,
+    0x220F,
+    0x2118,
+    0x4010,
+    0x4348,
+    0x4BA6,
+    0xB2A4,
+    0x18E4,
+    0x1900,
+    0x7803,
+    0x48A5,
+    0x181B,
+    0x009B,
+    0x681C,
+    0x48A4,
+    0x9401,
+    0x24FF,
+    0x702C,
+    0x8803,
+    0x9C01,
+    0x191B,
+    0x606B,
+    0x2300,
+    0x4CA0,
+    0x706B,
+    0x193F,
+    0x7839,
+    0x783A,
+    0x2703,
+    0x2401,
+    0x403A,
+    0x0889,
+    0x4F9D,
+    0x0018,
+    0x4021,
+    0xF009,
+    0xFD3A,
+    0x003A,
+    0x3288,
+    0x6813,
+    0x43A3,
+    0x6013,
+    0x69AB,
+    0x7998,
+    0x4B98,
+    0x681A,
+    0x4322,
+    0x601A,
+    0x68DA,
+    0x6819,
+    0x4002,
+    0x43A1,
+    0x6019,
+    0x4B94,
+    0x9901,
+    0x4353,
+    0x1859,
+    0x8830,
+    0x9101,
+    0x9900,
+    0x4B8A,
+    0x1A08,
+    0x18C0,
+    0x2118,
+    0xF7FF,
+    0xFC93,
+    0x220F,
+    0x2118,
+    0x4010,
+    0x8836,
+    0x4348,
+    0x4B85,
+    0xB2B6,
+    0x18F6,
+    0x1980,
+    0x7803,
+    0x4E84,
+    0x9901,
+    0x199B,
+    0x009B,
+    0x6019,
+    0x4E82,
+    0x9900,
+    0x8833,
+    0x684A,
+    0x9901,
+    0x189B,
+    0x185B,
+    0x60AB,
+    0x003B,
+    0x2603,
+    0x2280,
+    0x3394,
+    0x601E,
+    0x4B81,
+    0x0192,
+    0x63DC,
+    0x6959,
+    0x2000,
+    0x430A,
+    0x615A,
+    0x2228,
+    0x4B7E,
+    0x497E,
+    0x701A,
+    0x4B7E,
+    0x781A,
+    0x6A3A,
+    0x781B,
+    0x400A,
+    0x21E0,
+    0x021B,
+    0x00C9,
+    0x400B,
+    0x2107,
+    0x4313,
+    0x623B,
+    0x4B79,
+    0x4F7A,
+    0x695A,
+    0x438A,
+    0x0019,
+    0x4322,
+    0x615A,
+    0x4A78,
+    0x312A,
+    0x7812,
+    0xB2D2,
+    0x765A,
+    0x7008,
+    0x3A01,
+    0x4975,
+    0x00D2,
+    0x600A,
+    0x4A75,
+    0x7811,
+    0x7812,
+    0x4974,
+    0xB2D2,
+    0x630A,
+    0x4A74,
+    0x7811,
+    0x6A18,
+    0x7812,
+    0x4973,
+    0x1E56,
+    0x41B2,
+    0x26F0,
+    0x4008,
+    0x0412,
+    0x4302,
+    0x621A,
+    0x4A70,
+    0x7810,
+    0x69D8,
+    0x7812,
+    0x43B0,
+    0x0912,
+    0x0112,
+    0x4302,
+    0x61DA,
+    0x4A6C,
+    0x4E6D,
+    0x7812,
+    0xB2D2,
+    0x761A,
+    0x4A6C,
+    0x7812,
+    0x8838,
+    0x0412,
+    0x4302,
+    0x625A,
+    0x7832,
+    0x6A1A,
+    0x0020,
+    0x4011,
+    0x7832,
+    0x40E2,
+    0x4390,
+    0x0402,
+    0x430A,
+    0x621A,
+    0x6A1A,
+    0x4964,
+    0x2000,
+    0x400A,
+    0x621A,
+    0x69AA,
+    0x7D91,
+    0x6919,
+    0x7D92,
+    0x43A1,
+    0x4022,
+    0x430A,
+    0x611A,
+    0xF7FF,
+    0xFEF6,
+    0x69AB,
+    0x2200,
+    0x7D99,
+    0x0020,
+    0xB2C9,
+    0xF000,
+    0xFF71,
+    0x9000,
+    0xF00A,
+    0xFBD8,
+    0x9800,
+    0xF00B,
+    0xF84B,
+    0x4B58,
+    0x681A,
+    0x4B58,
+    0x619A,
+    0x4A58,
+    0x6810,
+    0x4A58,
+    0x0011,
+    0x31CC,
+    0x6008,
+    0x4957,
+    0x32D0,
+    0x6809,
+    0x6011,
+    0x494F,
+    0x780A,
+    0x883A,
+    0x780A,
+    0x8839,
+    0x2740,
+    0x0412,
+    0x430A,
+    0x4952,
+    0x605A,
+    0x780A,
+    0x43BA,
+    0x433A,
+    0x700A,
+    0x7832,
+    0x2280,
+    0x6919,
+    0x69A8,
+    0x4391,
+    0x7832,
+    0x0026,
+    0x4396,
+    0x01F2,
+    0x430A,
+    0x611A,
+    0x8902,
+    0x4928,
+    0x1852,
+    0x6811,
+    0x790E,
+    0x681A,
+    0x3106,
+    0x43A2,
+    0x601A,
+    0x8A03,
+    0x4A45,
+    0xB29B,
+    0x8013,
+    0x4845,
+    0x2206,
+    0xF011,
+    0xFA53,
+    0x2002,
+    0x4B43,
+    0xB2F6,
+    0x781A,
+    0x09B6,
+    0x43A2,
+    0x4026,
+    0x4316,
+    0x701E,
+    0x781A,
+    0x2604,
+    0x4382,
+    0x4302,
+    0x701A,
+    0x69AA,
+    0x7D11,
+    0x7D11,
+    0x781D,
+    0x40E1,
+    0x43B5,
+    0x4031,
+    0x4329,
+    0x2508,
+    0x7019,
+    0x7819,
+    0x361C,
+    0x43A9,
+    0x7019,
+    0x2110,
+    0x781D,
+    0x438D,
+    0x4329,
+    0x7019,
+    0x7D11,
+    0x7D11,
+    0x781D,
+    0x00C9,
+    0x43B5,
+    0x4031,
+    0x4329,
+    0x7019,
+    0x7D11,
+    0x7D11,
+    0x781D,
+    0x4081,
+    0x43BD,
+    0x4039,
+    0x4329,
+    0x7019,
+    0x8A53,
+    0x4A2C,
+    0xB29B,
+    0x8013,
+    0x4B2B,
+    0x22FF,
+    0x7018,
+    0x2000,
+    0x4B2A,
+    0x701C,
+    0x4B2A,
+    0x8018,
+    0x4B2A,
+    0x0020,
+    0x701A,
+    0xBDFE,
+    0x8000,
+    0x4203,
+    0xC800,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0x8015,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x7000,
+    0x4201,
+    0x0271,
+    0x0000,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0xF8FF,
+    0xFFFF,
+    0x012F,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x012C,
+    0x4203,
+    0x024D,
+    0x4203,
+    0xC900,
+    0x4203,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x012E,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x0120,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0124,
+    0x4203,
+    0xD000,
+    0x4200,
+    0x0128,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01D0,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x01D8,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x2200,
+    0xB570,
+    0x2520,
+    0x4B16,
+    0x4C16,
+    0x7859,
+    0x705A,
+    0x6FE2,
+    0x43AA,
+    0x67E2,
+    0x2800,
+    0xD11C,
+    0x699A,
+    0x8A14,
+    0x4A12,
+    0x2C00,
+    0xD012,
+    0x2900,
+    0xD019,
+    0x2180,
+    0x0049,
+    0x6011,
+    0x227F,
+    0x4D0F,
+    0x7D1C,
+    0x6929,
+    0x4014,
+    0x4391,
+    0x3A3F,
+    0x4322,
+    0x430A,
+    0x612A,
+    0x7718,
+    0xF00B,
+    0xFEC5,
+    0xBD70,
+    0x2900,
+    0xD006,
+    0x2380,
+    0x005B,
+    0x6013,
+    0x2001,
+    0xF7FF,
+    0xFDF0,
+    0xE7F5,
+    0x2380,
+    0x00DB,
+    0xE7F7,
+    0xC800,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x4000,
+    0x4201,
+    0x6000,
+    0x4200,
+    0x220F,
+    0xB510,
+    0x6843,
+    0x0001,
+    0x781B,
+    0x4013,
+    0x2B03,
+    0xD003,
+    0x2B05,
+    0xD009,
+    0x2000,
+    0xBD10,
+    0x2280,
+    0x4B07,
+    0x0092,
+    0x601A,
+    0x2201,
+    0x4B06,
+    0x771A,
+    0xE7F5,
+    0x2202,
+    0x4B04,
+    0x4804,
+    0x771A,
+    0xF000,
+    0xFF4C,
+    0x2001,
+    0xE7EE,
+    0x4000,
+    0x4201,
+    0xC800,
+    0x4203,
+    0x0238,
+    0x4203,
+    0xB5F8,
+    0x4B44,
+    0x7F1A,
+    0x2A01,
+    0xD006,
+    0x2A02,
+    0xD100,
+    0xE07C,
+    0x2001,
+    0xF7FF,
+    0xFDB7,
+    0xE077,
+    0x6999,
+    0x7D48,
+    0x7D4B,
+    0x0880,
+    0xB2DB,
+    0x4210,
+    0xD00C,
+    0x08DB,
+    0x4213,
+    0xD009,
+    0x2420,
+    0x4B3A,
+    0x483A,
+    0x781A,
+    0x6FC2,
+    0x781B,
+    0x43A2,
+    0x4023,
+    0x4313,
+    0x67C3,
+    0x4D37,
+    0x894C,
+    0x6BEF,
+    0x6C68,
+    0x4B36,
+    0x0540,
+    0x2200,
+    0x18E4,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FF,
+    0xFA91,
+    0x2403,
+    0x2826,
+    0x002A,
+    0x4B31,
+    0x881A,
+    0x4252,
+    0x23E3,
+    0x2601,
+    0x4930,
+    0x009B,
+    0x58CB,
+    0x482F,
+    0x6C69,
+    0x0B9B,
+    0x6800,
+    0x4033,
+    0x0AC9,
+    0x00DB,
+    0x4031,
+    0x19DB,
+    0x00C9,
+    0x0700,
+    0x1740,
+    0x1A5B,
+    0x1A1B,
+    0x189B,
+    0x6C6A,
+    0x0552,
+    0x0F52,
+    0x1E50,
+    0x2803,
+    0xD81F,
+    0xF7FF,
+    0xFA6F,
+    0x140A,
+    0x1C19,
+    0x4B24,
+    0xE7DD,
+    0x4B24,
+    0xE7DB,
+    0x4B24,
+    0xE7D9,
+    0x4B24,
+    0xE7D7,
+    0x4924,
+    0x7809,
+    0x00C9,
+    0x3128,
+    0x185B,
+    0x6C29,
+    0xB289,
+    0x4821,
+    0x5C80,
+    0xE00E,
+    0x491F,
+    0x7809,
+    0x00C9,
+    0x3118,
+    0xE7F4,
+    0x3391,
+    0x33FF,
+    0xE7F2,
+    0x337F,
+    0xE7FB,
+    0x6C29,
+    0x2000,
+    0xB289,
+    0x2A04,
+    0xD9ED,
+    0x6C6A,
+    0x2201,
+    0x4694,
+    0x4E18,
+    0x4341,
+    0x6937,
+    0x3396,
+    0x4397,
+    0x6C6A,
+    0x4665,
+    0x08D2,
+    0x402A,
+    0x433A,
+    0x0020,
+    0x6132,
+    0x18C9,
+    0xF011,
+    0xFA4A,
+    0xBDF8,
+    0x2000,
+    0xF7FF,
+    0xFCEE,
+    0xE7FA,
+    0x46C0,
+    0xC800,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x6000,
+    0x4200,
+    0x8000,
+    0x4203,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x1918,
+    0x1003,
+    0x5000,
+    0x4200,
+    0xB530,
+    0x8942,
+    0x4B0A,
+    0x6840,
+    0x18D3,
+    0x7819,
+    0x4B09,
+    0x4C0A,
+    0x18D3,
+    0x881D,
+    0x4B09,
+    0x18D3,
+    0x781B,
+    0x1912,
+    0x8814,
+    0x040A,
+    0x432A,
+    0x041B,
+    0x4323,
+    0x1A80,
+    0x4298,
+    0xD900,
+    0x0018,
+    0xBD30,
+    0x8002,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8006,
+    0x4203,
+    0x4B08,
+    0x2000,
+    0x781B,
+    0xB2D9,
+    0x2BFF,
+    0xD009,
+    0x4B06,
+    0x881A,
+    0x2318,
+    0x434B,
+    0x4905,
+    0x1852,
+    0x189B,
+    0x8818,
+    0x4B04,
+    0x18C0,
+    0x4770,
+    0x46C0,
+    0x011F,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F0,
+    0xB08B,
+    0x9309,
+    0x8943,
+    0x9208,
+    0xB29A,
+    0x9200,
+    0x4AEA,
+    0x9002,
+    0x189B,
+    0x781B,
+    0xB2DA,
+    0x9201,
+    0x2B00,
+    0xD100,
+    0xE28B,
+    0x9B00,
+    0x4AE6,
+    0x49E6,
+    0x189B,
+    0x781A,
+    0x9B00,
+    0x2080,
+    0x185B,
+    0x2103,
+    0x189B,
+    0x781B,
+    0x4AE3,
+    0xB2DB,
+    0x9305,
+    0x4BE2,
+    0x0180,
+    0x6019,
+    0x2301,
+    0x63D3,
+    0x6954,
+    0x4320,
+    0x6150,
+    0x2038,
+    0x4ADF,
+    0x7010,
+    0x9A00,
+    0x48DE,
+    0x1812,
+    0x7812,
+    0xB2D2,
+    0x9206,
+    0x9A01,
+    0x401A,
+    0x0015,
+    0x0014,
+    0x9203,
+    0x9204,
+    0x9A01,
+    0x421A,
+    0xD021,
+    0x4AD8,
+    0x48D9,
+    0x8812,
+    0x1812,
+    0x7812,
+    0x48D8,
+    0xB2D2,
+    0x9204,
+    0x9A00,
+    0x1810,
+    0x7802,
+    0x0892,
+    0x0015,
+    0x401D,
+    0x421A,
+    0xD006,
+    0x2500,
+    0x4BD3,
+    0x7FDB,
+    0x42AB,
+    0xD101,
+    0x7805,
+    0x400D,
+    0x9B00,
+    0x4AD0,
+    0x189A,
+    0x7813,
+    0x075B,
+    0x0FDC,
+    0x2B00,
+    0xDA02,
+    0x2303,
+    0x7814,
+    0x401C,
+    0x2302,
+    0x9A01,
+    0x49CB,
+    0x401A,
+    0x9207,
+    0x9A00,
+    0x9E04,
+    0x1857,
+    0x9A01,
+    0x421A,
+    0xD021,
+    0x4BC8,
+    0x4AC8,
+    0x881B,
+    0x189B,
+    0x781E,
+    0xB2F3,
+    0x9307,
+    0x9B04,
+    0x431E,
+    0xF00D,
+    0xFB40,
+    0x783B,
+    0x075B,
+    0xD506,
+    0x2203,
+    0x783B,
+    0x4013,
+    0x42AB,
+    0xD901,
+    0x783D,
+    0x4015,
+    0x4ABF,
+    0x9B00,
+    0x189B,
+    0x781A,
+    0x0752,
+    0xD506,
+    0x2103,
+    0x781A,
+    0x400A,
+    0x42A2,
+    0xD901,
+    0x781C,
+    0x400C,
+    0x783B,
+    0x2201,
+    0x075B,
+    0xD406,
+    0x9B00,
+    0x49B0,
+    0x185B,
+    0x781B,
+    0x089B,
+    0x4213,
+    0xD009,
+    0x002A,
+    0x2101,
+    0x2000,
+    0xF009,
+    0xF9ED,
+    0x2303,
+    0x4AB1,
+    0x6B11,
+    0x430B,
+    0x6313,
+    0x4AAE,
+    0x9B00,
+    0x189B,
+    0x781B,
+    0x2201,
+    0x075B,
+    0xD406,
+    0x9B00,
+    0x49A6,
+    0x185B,
+    0x781B,
+    0x089B,
+    0x4213,
+    0xD00A,
+    0x2201,
+    0x4BA9,
+    0x0064,
+    0x6819,
+    0x430A,
+    0x2106,
+    0x601A,
+    0x681A,
+    0x438A,
+    0x4314,
+    0x601C,
+    0x9B00,
+    0x4AA4,
+    0x9906,
+    0x189B,
+    0x781A,
+    0x0030,
+    0xB2D2,
+    0xF000,
+    0xFCA4,
+    0x0004,
+    0xF00A,
+    0xF90B,
+    0x0020,
+    0xF00A,
+    0xFD7E,
+    0x4B9E,
+    0x4D9F,
+    0x681B,
+    0x2140,
+    0x61AB,
+    0x4B9E,
+    0x2401,
+    0x681A,
+    0x4B9D,
+    0x2600,
+    0x601A,
+    0x4B9D,
+    0x4F9D,
+    0x681A,
+    0x4B9D,
+    0x601A,
+    0x4B9D,
+    0x4A9E,
+    0x469C,
+    0x781B,
+    0x8813,
+    0x4663,
+    0x781B,
+    0x8812,
+    0x041B,
+    0x4313,
+    0x4A9A,
+    0x606B,
+    0x7813,
+    0x438B,
+    0x430B,
+    0x7013,
+    0x237F,
+    0x692A,
+    0x9805,
+    0x439A,
+    0x4003,
+    0x430B,
+    0x4313,
+    0x4995,
+    0x612B,
+    0x780B,
+    0x2380,
+    0x0020,
+    0x692A,
+    0x439A,
+    0x780B,
+    0x4398,
+    0x01C3,
+    0x2007,
+    0x4313,
+    0x612B,
+    0x4B8F,
+    0x695A,
+    0x4382,
+    0x4322,
+    0x615A,
+    0x4A8E,
+    0x488E,
+    0x7812,
+    0xB2D2,
+    0x765A,
+    0x7006,
+    0x3A01,
+    0x488C,
+    0x00D2,
+    0x6002,
+    0x4A8C,
+    0x7810,
+    0x7812,
+    0x488B,
+    0xB2D2,
+    0x6302,
+    0x4A8B,
+    0x7810,
+    0x6A18,
+    0x7812,
+    0x4038,
+    0x1E57,
+    0x41BA,
+    0x27F0,
+    0x0412,
+    0x4302,
+    0x4887,
+    0x621A,
+    0x7802,
+    0x69DA,
+    0x7800,
+    0x43BA,
+    0x0900,
+    0x0100,
+    0x4310,
+    0x4A83,
+    0x61D8,
+    0x7812,
+    0x4877,
+    0xB2D2,
+    0x761A,
+    0x4662,
+    0x7812,
+    0x8800,
+    0x0412,
+    0x4302,
+    0x625A,
+    0x2240,
+    0x9805,
+    0x4F6E,
+    0x4302,
+    0x841A,
+    0x780A,
+    0x6A18,
+    0x780A,
+    0x0021,
+    0x40E2,
+    0x4391,
+    0x4038,
+    0x040A,
+    0x4302,
+    0x621A,
+    0x6A1A,
+    0x4976,
+    0x9805,
+    0x400A,
+    0x621A,
+    0x6919,
+    0x9A06,
+    0x43A1,
+    0x4022,
+    0x430A,
+    0x611A,
+    0xF00B,
+    0xFCD8,
+    0x21FF,
+    0x9B00,
+    0x4A70,
+    0x189B,
+    0x881B,
+    0x4A70,
+    0xB29B,
+    0x9305,
+    0x9B00,
+    0x189B,
+    0x881F,
+    0x682B,
+    0x4A6D,
+    0x43A3,
+    0x602B,
+    0x4B6D,
+    0x8016,
+    0x801E,
+    0x4B6C,
+    0xB2BF,
+    0x7019,
+    0x9B03,
+    0x42B3,
+    0xD054,
+    0x4B43,
+    0x486A,
+    0x18FB,
+    0x881B,
+    0xB29B,
+    0x8013,
+    0x2207,
+    0x4B68,
+    0x701A,
+    0x4B68,
+    0x3A01,
+    0x701E,
+    0x4B67,
+    0x18FE,
+    0x4B67,
+    0x7835,
+    0x18F9,
+    0xF010,
+    0xFF0F,
+    0x4B66,
+    0xB2ED,
+    0x781A,
+    0x4025,
+    0x43A2,
+    0x4315,
+    0x2202,
+    0x701D,
+    0x7819,
+    0x3403,
+    0x4391,
+    0x430A,
+    0x701A,
+    0x4A60,
+    0x18B9,
+    0x780A,
+    0x780A,
+    0x7818,
+    0x0892,
+    0x43A0,
+    0x4022,
+    0x4302,
+    0x701A,
+    0x7832,
+    0x7832,
+    0x7818,
+    0x3404,
+    0x0092,
+    0x43A0,
+    0x4022,
+    0x4302,
+    0x2010,
+    0x701A,
+    0x781A,
+    0x3418,
+    0x4382,
+    0x701A,
+    0x780A,
+    0x780A,
+    0x7818,
+    0x0092,
+    0x43A0,
+    0x4022,
+    0x4302,
+    0x2040,
+    0x701A,
+    0x780A,
+    0x780A,
+    0x7819,
+    0x0052,
+    0x4002,
+    0x4381,
+    0x430A,
+    0x701A,
+    0x4B4D,
+    0x4A4D,
+    0x18FF,
+    0x883B,
+    0xB29B,
+    0x8013,
+    0x2214,
+    0x4B4B,
+    0x701A,
+    0x9A04,
+    0x4B4B,
+    0x701A,
+    0x9B01,
+    0x2701,
+    0x079B,
+    0xD400,
+    0xE0CA,
+    0x9B05,
+    0x4A16,
+    0x2602,
+    0x189B,
+    0x881B,
+    0x4A39,
+    0xB29B,
+    0x8013,
+    0x2218,
+    0x4B44,
+    0x4844,
+    0x701E,
+    0x4B44,
+    0x701A,
+    0x9B05,
+    0x4A39,
+    0x189C,
+    0x4A39,
+    0x7825,
+    0x1899,
+    0x2206,
+    0xF010,
+    0xFEB1,
+    0x2104,
+    0x4B3F,
+    0xB2ED,
+    0x781A,
+    0x403D,
+    0x43BA,
+    0x4315,
+    0x701D,
+    0x781A,
+    0x2520,
+    0xE077,
+    0x800D,
+    0x4203,
+    0x8007,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x4094,
+    0x4200,
+    0x0108,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x0188,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8026,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x8025,
+    0x4203,
+    0x8028,
+    0x4203,
+    0x0178,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8027,
+    0x4203,
+    0x3000,
+    0x4201,
+    0x4088,
+    0x4200,
+    0x8015,
+    0x4203,
+    0x0120,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0124,
+    0x4203,
+    0xD0CC,
+    0x4200,
+    0x0128,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0xD0D0,
+    0x4200,
+    0x012E,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024D,
+    0x4203,
+    0x502A,
+    0x4200,
+    0xC900,
+    0x4203,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x8010,
+    0x4203,
+    0x800E,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x01D0,
+    0x4203,
+    0x01CC,
+    0x4203,
+    0x01CD,
+    0x4203,
+    0x801E,
+    0x4203,
+    0x8018,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x801F,
+    0x4203,
+    0x8016,
+    0x4203,
+    0x01D8,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01DC,
+    0x4203,
+    0x01E0,
+    0x4203,
+    0x01DD,
+    0x4203,
+    0x01E6,
+    0x4203,
+    0x43B2,
+    0x4316,
+    0x701E,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x7822,
+    0x7822,
+    0x7818,
+    0x1849,
+    0x0092,
+    0x4388,
+    0x400A,
+    0x4302,
+    0x2010,
+    0x701A,
+    0x781A,
+    0x4382,
+    0x701A,
+    0x7822,
+    0x7822,
+    0x7818,
+    0x0092,
+    0x43A8,
+    0x402A,
+    0x4302,
+    0x701A,
+    0x7822,
+    0x7822,
+    0x2440,
+    0x7818,
+    0x0092,
+    0x4022,
+    0x43A0,
+    0x4302,
+    0x701A,
+    0x4A13,
+    0x9B05,
+    0x4694,
+    0x4463,
+    0x881B,
+    0x4A12,
+    0xB29B,
+    0x8013,
+    0x4B11,
+    0x7019,
+    0x9A07,
+    0x4B11,
+    0x701A,
+    0x4911,
+    0x2401,
+    0x468C,
+    0x9A08,
+    0x9B00,
+    0x3A32,
+    0x4463,
+    0x601A,
+    0x2001,
+    0xF00B,
+    0xFA38,
+    0x4B0C,
+    0x9A09,
+    0x721C,
+    0x9B02,
+    0x685D,
+    0x0018,
+    0x605A,
+    0xF00B,
+    0xFF9F,
+    0x9B02,
+    0x9401,
+    0x605D,
+    0x9801,
+    0xB00B,
+    0xBDF0,
+    0x46C0,
+    0x8016,
+    0x4203,
+    0x01E8,
+    0x4203,
+    0x01FC,
+    0x4203,
+    0x01FD,
+    0x4203,
+    0x801C,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0xB5F8,
+    0x0005,
+    0x4B1A,
+    0x2118,
+    0x8818,
+    0x881F,
+    0x4B19,
+    0x1A28,
+    0x18C0,
+    0xF7FE,
+    0xFF43,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B16,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x4C15,
+    0x7803,
+    0x4A15,
+    0x6866,
+    0x189B,
+    0x009B,
+    0x601E,
+    0x0028,
+    0xF00B,
+    0xFF6F,
+    0x2100,
+    0x6822,
+    0x7221,
+    0x79D3,
+    0x3301,
+    0x2B02,
+    0xD805,
+    0x0010,
+    0x3008,
+    0x18C0,
+    0x7800,
+    0x28FF,
+    0xD100,
+    0x000B,
+    0xB2DB,
+    0x71D3,
+    0x4B0A,
+    0x781B,
+    0x069B,
+    0xD505,
+    0x6822,
+    0x7D13,
+    0x4259,
+    0x414B,
+    0xB2DB,
+    0x7513,
+    0xBDF8,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x0113,
+    0x4203,
+    0xB5F8,
+    0x4B11,
+    0x4D11,
+    0x781C,
+    0x2C00,
+    0xD11C,
+    0x2201,
+    0x701A,
+    0x4B0F,
+    0x2118,
+    0x6D9E,
+    0x4B0F,
+    0x881A,
+    0x881F,
+    0x4B0E,
+    0x1A80,
+    0x18C0,
+    0xF7FE,
+    0xFEF7,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B0B,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x7803,
+    0x4A09,
+    0x189B,
+    0x009B,
+    0x601E,
+    0x682B,
+    0x606E,
+    0x71DC,
+    0xBDF8,
+    0xC8C4,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB530,
+    0x4B0D,
+    0x781B,
+    0xB2DA,
+    0x2BFF,
+    0xD013,
+    0x2118,
+    0x4351,
+    0x2201,
+    0x0010,
+    0x4C09,
+    0x4D0A,
+    0x8823,
+    0x195B,
+    0x185B,
+    0x781B,
+    0x4098,
+    0x0003,
+    0x4807,
+    0x6543,
+    0x8823,
+    0x195B,
+    0x185B,
+    0x781B,
+    0x409A,
+    0x6402,
+    0xBD30,
+    0x46C0,
+    0x011F,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x2100,
+    0x4B02,
+    0x4A02,
+    0x7219,
+    0x7011,
+    0x4770,
+    0xC89C,
+    0x4203,
+    0xC8C4,
+    0x4203,
+    0x4B02,
+    0x7A18,
+    0x1E43,
+    0x4198,
+    0xB2C0,
+    0x4770,
+    0xC89C,
+    0x4203,
+    0x2000,
+    0x4B05,
+    0x7A1B,
+    0x4283,
+    0xD003,
+    0x4B04,
+    0x6F18,
+    0x0700,
+    0x0FC0,
+    0xB2C0,
+    0x4770,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xB5F8,
+    0x8945,
+    0x4B1E,
+    0x4E1F,
+    0xB2AF,
+    0x18ED,
+    0x0004,
+    0x6035,
+    0xF7FF,
+    0xFF7E,
+    0x4B1C,
+    0x18FA,
+    0x2300,
+    0x8013,
+    0x4A1B,
+    0x18BF,
+    0x703B,
+    0x7A33,
+    0x2B00,
+    0xD007,
+    0x0020,
+    0xF7FF,
+    0xFF2D,
+    0xF00C,
+    0xF815,
+    0xF7FF,
+    0xFF9F,
+    0xE021,
+    0x4B15,
+    0x2118,
+    0x8818,
+    0x881F,
+    0x4B14,
+    0x1A20,
+    0x18C0,
+    0xF7FE,
+    0xFE6D,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B11,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x7803,
+    0x4A0F,
+    0x0020,
+    0x189B,
+    0x009B,
+    0x681F,
+    0xF7FF,
+    0xFC29,
+    0x003A,
+    0x0003,
+    0x0029,
+    0x0020,
+    0x6077,
+    0xF7FF,
+    0xFC5C,
+    0x2800,
+    0xD1DA,
+    0x2001,
+    0xBDF8,
+    0x8000,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x8018,
+    0x4203,
+    0x801A,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB5F7,
+    0x8943,
+    0x4A31,
+    0x4C32,
+    0x189F,
+    0x4A32,
+    0x6027,
+    0x189B,
+    0x781B,
+    0x0005,
+    0x2B00,
+    0xD102,
+    0x2400,
+    0x0020,
+    0xBDFE,
+    0x0023,
+    0x3328,
+    0x781B,
+    0x2B00,
+    0xD0F7,
+    0xF7FF,
+    0xFF22,
+    0x7A23,
+    0x2B00,
+    0xD0F2,
+    0x4B29,
+    0x0028,
+    0x6D9E,
+    0xF7FF,
+    0xFBF0,
+    0x896A,
+    0x4B27,
+    0x4927,
+    0x18D3,
+    0x781B,
+    0x1852,
+    0x8812,
+    0x041B,
+    0x4313,
+    0x4298,
+    0xD808,
+    0xF00D,
+    0xF895,
+    0x0028,
+    0xF7FF,
+    0xFEC6,
+    0x2400,
+    0xF7FF,
+    0xFF39,
+    0xE02F,
+    0x6864,
+    0x1B32,
+    0xD4F3,
+    0x686A,
+    0x1BA4,
+    0x18A4,
+    0xD4EF,
+    0x1AC0,
+    0x4284,
+    0xD900,
+    0x0004,
+    0xF00D,
+    0xF881,
+    0x2C63,
+    0xD9E9,
+    0x4B18,
+    0x2118,
+    0x8818,
+    0x881B,
+    0x1A28,
+    0xB29B,
+    0x9301,
+    0x4B15,
+    0x18C0,
+    0xF7FE,
+    0xFDF6,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4A13,
+    0x4358,
+    0x4694,
+    0x9B01,
+    0x4A12,
+    0x4463,
+    0x18C0,
+    0x7803,
+    0x0039,
+    0x189B,
+    0x009B,
+    0x601E,
+    0x0032,
+    0x0023,
+    0x0028,
+    0xF7FF,
+    0xFBE8,
+    0x1E04,
+    0xD1CC,
+    0xF00D,
+    0xF864,
+    0xE7A7,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x800D,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x801A,
+    0x4203,
+    0x8018,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x8943,
+    0x4A0F,
+    0xB570,
+    0x4D0F,
+    0xB29E,
+    0x189B,
+    0x602B,
+    0x0004,
+    0xF7FF,
+    0xFEB4,
+    0x7A2B,
+    0x2B00,
+    0xD006,
+    0x0020,
+    0xF7FF,
+    0xFE6A,
+    0xF7FF,
+    0xFEDE,
+    0x2000,
+    0xBD70,
+    0x4A07,
+    0x18B2,
+    0x8013,
+    0x4A07,
+    0x18B6,
+    0x7033,
+    0x4B06,
+    0x6D9B,
+    0x606B,
+    0x2301,
+    0x722B,
+    0xE7F1,
+    0x8000,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x8018,
+    0x4203,
+    0x801A,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x4B10,
+    0xB510,
+    0x6D99,
+    0x4B10,
+    0x681A,
+    0x69D0,
+    0x7E93,
+    0x8B14,
+    0x041B,
+    0x1A09,
+    0x4323,
+    0x185B,
+    0xB299,
+    0x0C1B,
+    0xB2DB,
+    0x8311,
+    0x2000,
+    0x7693,
+    0xF00B,
+    0xF858,
+    0x2000,
+    0xF00C,
+    0xF825,
+    0x2200,
+    0x0011,
+    0x0010,
+    0xF008,
+    0xFE0C,
+    0x2101,
+    0x4A04,
+    0x6813,
+    0x438B,
+    0x6013,
+    0xBD10,
+    0x9000,
+    0x4201,
+    0xC89C,
+    0x4203,
+    0x4088,
+    0x4200,
+    0xB510,
+    0x4B0F,
+    0x7A18,
+    0x2805,
+    0xD814,
+    0xF7FE,
+    0xFD51,
+    0x0909,
+    0x0306,
+    0x100D,
+    0xF001,
+    0xFD94,
+    0xBD10,
+    0xF004,
+    0xFB59,
+    0xE7FB,
+    0x2001,
+    0xF001,
+    0xFD21,
+    0xE7F7,
+    0xF005,
+    0xFE88,
+    0xE7F4,
+    0xF005,
+    0xFF59,
+    0xE7F1,
+    0x2000,
+    0x4903,
+    0x4A03,
+    0xF008,
+    0xFFD9,
+    0xE7EB,
+    0xC89C,
+    0x4203,
+    0x191D,
+    0x1003,
+    0x026E,
+    0x0000,
+    0xB510,
+    0xF7FF,
+    0xFFD7,
+    0xBD10,
+    0xB5F7,
+    0x0002,
+    0x3223,
+    0x6843,
+    0x0005,
+    0x7810,
+    0x220F,
+    0x781B,
+    0x2602,
+    0x4013,
+    0x3A0E,
+    0x0017,
+    0xB2C1,
+    0x409F,
+    0x4230,
+    0xD022,
+    0x4C2D,
+    0x6823,
+    0x8A18,
+    0x4B2D,
+    0x18C0,
+    0xF001,
+    0xFD1B,
+    0x23C0,
+    0x005B,
+    0x421F,
+    0xD011,
+    0x2208,
+    0x3B7D,
+    0x3BFF,
+    0x7223,
+    0x4B28,
+    0x0028,
+    0x701A,
+    0xF005,
+    0xFE38,
+    0x0004,
+    0x4B26,
+    0x6B1B,
+    0x071B,
+    0xD401,
+    0xF00C,
+    0xF8F9,
+    0x0020,
+    0xBDFE,
+    0x2303,
+    0x0028,
+    0x7223,
+    0xF010,
+    0xFD04,
+    0xE7F0,
+    0x000C,
+    0x4014,
+    0x4211,
+    0xD0ED,
+    0x4C1A,
+    0x491A,
+    0x6823,
+    0x89D8,
+    0xB283,
+    0x9301,
+    0x23C0,
+    0x005B,
+    0x1840,
+    0x7A21,
+    0x421F,
+    0xD01D,
+    0x2905,
+    0xD014,
+    0x4B17,
+    0x9901,
+    0x4E13,
+    0x18C9,
+    0x8809,
+    0x4B15,
+    0x1989,
+    0x9E01,
+    0x18F3,
+    0x781E,
+    0x08B6,
+    0x4216,
+    0xD102,
+    0x781B,
+    0x099B,
+    0x401A,
+    0xB2D2,
+    0xF001,
+    0xFC78,
+    0x2305,
+    0x7223,
+    0x2207,
+    0x4B0A,
+    0x0028,
+    0x701A,
+    0xF005,
+    0xFE1A,
+    0xE7C2,
+    0x2902,
+    0xD002,
+    0xF004,
+    0xFA9F,
+    0x7226,
+    0x21FF,
+    0x0028,
+    0xF004,
+    0xFBD8,
+    0xE7B8,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0165,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x800C,
+    0x4203,
+    0x801F,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFABD,
+    0x2800,
+    0xD003,
+    0x2202,
+    0x7B43,
+    0x4393,
+    0x7343,
+    0xBD10,
+    0xB510,
+    0x4B0F,
+    0x7A1B,
+    0x2B03,
+    0xD00F,
+    0xD807,
+    0x2B02,
+    0xD014,
+    0x2000,
+    0x490C,
+    0x4A0C,
+    0xF008,
+    0xFF3F,
+    0xE00D,
+    0x3B04,
+    0x2B01,
+    0xD8F6,
+    0xB2C0,
+    0xF007,
+    0xF998,
+    0xE006,
+    0xB2C0,
+    0xF001,
+    0xFCBC,
+    0x2800,
+    0xD001,
+    0xF7FF,
+    0xFFDA,
+    0xBD10,
+    0xF004,
+    0xFA75,
+    0xE7FB,
+    0xC89C,
+    0x4203,
+    0x191D,
+    0x1003,
+    0x024F,
+    0x0000,
+    0xB510,
+    0xF7FF,
+    0xFA8D,
+    0x0003,
+    0x2000,
+    0x4283,
+    0xD002,
+    0x7B58,
+    0x0780,
+    0x0FC0,
+    0xBD10,
+    0x0000,
+    0xB5F0,
+    0x2701,
+    0x0006,
+    0x2404,
+    0x4D16,
+    0x403E,
+    0x4004,
+    0x2A00,
+    0xD007,
+    0x782B,
+    0x091B,
+    0x423B,
+    0xD003,
+    0x202E,
+    0x2C00,
+    0xD00A,
+    0xBDF0,
+    0x2E00,
+    0xD10C,
+    0x231C,
+    0x0780,
+    0xD40D,
+    0x3B04,
+    0x2C00,
+    0xD00A,
+    0x3308,
+    0xE008,
+    0x2028,
+    0x2E00,
+    0xD1F1,
+    0x3810,
+    0xE7EF,
+    0x2318,
+    0x2C00,
+    0xD000,
+    0x330C,
+    0x782A,
+    0x2401,
+    0x0692,
+    0xD504,
+    0x782A,
+    0x2003,
+    0x0992,
+    0x4222,
+    0xD100,
+    0x0008,
+    0x1818,
+    0xB2C0,
+    0xE7DE,
+    0x46C0,
+    0x0113,
+    0x4203,
+    0x2102,
+    0x4B09,
+    0x699A,
+    0xB2D2,
+    0x2A00,
+    0xD102,
+    0x695A,
+    0x420A,
+    0xD0F8,
+    0x695A,
+    0x20FF,
+    0x0752,
+    0xD502,
+    0x6958,
+    0x0600,
+    0x0EC0,
+    0x2204,
+    0x611A,
+    0x4770,
+    0x46C0,
+    0x6000,
+    0x4201,
+    0xB5F8,
+    0x0004,
+    0xA806,
+    0x7807,
+    0x481B,
+    0x7806,
+    0x7845,
+    0x7880,
+    0x2A00,
+    0xD007,
+    0x78CA,
+    0x4056,
+    0x790A,
+    0x4055,
+    0x794A,
+    0x213F,
+    0x400A,
+    0x4050,
+    0x4A15,
+    0x7016,
+    0x7055,
+    0x7090,
+    0x2F00,
+    0xD01F,
+    0x4A13,
+    0x4914,
+    0x7812,
+    0x8809,
+    0x0412,
+    0x430A,
+    0x4912,
+    0x4D13,
+    0x1852,
+    0x189B,
+    0x602B,
+    0x2601,
+    0x2300,
+    0x606B,
+    0x612E,
+    0xF7FF,
+    0xFFC1,
+    0x696B,
+    0x40F3,
+    0x4233,
+    0xD104,
+    0x2203,
+    0x0020,
+    0x490C,
+    0xF010,
+    0xFAA4,
+    0x2203,
+    0x4905,
+    0x1CE0,
+    0xF010,
+    0xFA9F,
+    0xBDF8,
+    0x4A08,
+    0x4909,
+    0x7812,
+    0xE7DE,
+    0x0138,
+    0x4203,
+    0x6008,
+    0x4201,
+    0x01F6,
+    0x4203,
+    0x01F4,
+    0x4203,
+    0x3800,
+    0x0420,
+    0x6000,
+    0x4201,
+    0x601C,
+    0x4201,
+    0x0136,
+    0x4203,
+    0x0134,
+    0x4203,
+    0xB5F0,
+    0x4C2A,
+    0x0002,
+    0x6C63,
+    0xB299,
+    0x0C1B,
+    0xB2DB,
+    0x8181,
+    0x7383,
+    0x6CA3,
+    0x6103,
+    0x6CE3,
+    0xB299,
+    0x0C1B,
+    0xB2DB,
+    0x8281,
+    0x7583,
+    0x6BE7,
+    0x6C60,
+    0x2300,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FE,
+    0xFBC8,
+    0x3303,
+    0x3735,
+    0x0039,
+    0x4B1D,
+    0x881B,
+    0x425B,
+    0x21E3,
+    0x2601,
+    0x481B,
+    0x0089,
+    0x5841,
+    0x4D1B,
+    0x6C60,
+    0x0B89,
+    0x682D,
+    0x4031,
+    0x0AC0,
+    0x4030,
+    0x00C9,
+    0x19C9,
+    0x00C0,
+    0x072D,
+    0x176D,
+    0x1A09,
+    0x1B49,
+    0x18CB,
+    0x6013,
+    0x6C23,
+    0x6C23,
+    0x2008,
+    0xB29B,
+    0x8113,
+    0x4B11,
+    0x7819,
+    0x781B,
+    0x211F,
+    0xB2DB,
+    0x75D3,
+    0x2303,
+    0x7293,
+    0x7AD3,
+    0x438B,
+    0x72D3,
+    0x6C63,
+    0x6C63,
+    0x7B11,
+    0x4003,
+    0x4381,
+    0x430B,
+    0x7313,
+    0xBDF0,
+    0x4B09,
+    0xE7CE,
+    0x4B09,
+    0xE7CC,
+    0x4B09,
+    0xE7CA,
+    0x4B09,
+    0xE7C8,
+    0x46C0,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0209,
+    0x4203,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0xB570,
+    0x0005,
+    0x000C,
+    0x0008,
+    0xF7FF,
+    0xFF92,
+    0x0028,
+    0x0021,
+    0xF00C,
+    0xFCB6,
+    0xBD70,
+    0x0000,
+    0xB510,
+    0x4B04,
+    0x781A,
+    0x781B,
+    0xB2DB,
+    0x748B,
+    0xF00C,
+    0xFCAC,
+    0xBD10,
+    0x46C0,
+    0x0209,
+    0x4203,
+    0x1A08,
+    0xB280,
+    0x4770,
+    0x1A08,
+    0x43C0,
+    0xB280,
+    0x0BC0,
+    0x4770,
+    0x4B02,
+    0x8818,
+    0x4B02,
+    0x18C0,
+    0x4770,
+    0x46C0,
+    0x0114,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0003,
+    0xB510,
+    0x000C,
+    0x2204,
+    0x6808,
+    0x0019,
+    0xF010,
+    0xF9EE,
+    0x6823,
+    0x3304,
+    0x6023,
+    0xBD10,
+    0xB5F7,
+    0x001E,
+    0x230F,
+    0x0014,
+    0x2503,
+    0x469C,
+    0x4F26,
+    0x4048,
+    0x4663,
+    0x4003,
+    0x5CFA,
+    0x0B03,
+    0x5CFB,
+    0x0112,
+    0x021B,
+    0x431A,
+    0x9201,
+    0x4662,
+    0x0903,
+    0x4013,
+    0x5CFB,
+    0x9A01,
+    0x0A00,
+    0x4313,
+    0x4662,
+    0x4010,
+    0x5C3A,
+    0x3D01,
+    0x0312,
+    0x4313,
+    0x2211,
+    0x4353,
+    0xB2ED,
+    0x18CB,
+    0xB298,
+    0x2D00,
+    0xD1E2,
+    0x4041,
+    0x000F,
+    0x8070,
+    0x8031,
+    0x0038,
+    0x2125,
+    0xF7FE,
+    0xFBBB,
+    0xB2C9,
+    0x0908,
+    0x0043,
+    0x191B,
+    0x7131,
+    0x881A,
+    0x2310,
+    0x425B,
+    0x4343,
+    0x18CB,
+    0xB2DB,
+    0x411A,
+    0x07D2,
+    0xD50D,
+    0x79B3,
+    0x2B00,
+    0xD009,
+    0x3408,
+    0x7823,
+    0x3401,
+    0x4299,
+    0xD003,
+    0x3501,
+    0xB2ED,
+    0x2D25,
+    0xD1F7,
+    0x7175,
+    0xBDF7,
+    0x0023,
+    0x332D,
+    0x781B,
+    0x3408,
+    0x437B,
+    0x0C18,
+    0x7170,
+    0x1824,
+    0x7823,
+    0x7133,
+    0xE7F3,
+    0x192B,
+    0x1003,
+    0x0002,
+    0xB570,
+    0x3226,
+    0x7813,
+    0x78C0,
+    0x000C,
+    0x18C0,
+    0x2824,
+    0xD900,
+    0x3825,
+    0xB2C3,
+    0x091D,
+    0x7013,
+    0x006A,
+    0x1912,
+    0x8811,
+    0x2210,
+    0x4252,
+    0x436A,
+    0x189A,
+    0xB2D2,
+    0x4111,
+    0x07C9,
+    0xD40C,
+    0x0023,
+    0x332D,
+    0x781B,
+    0xB2D9,
+    0x2B00,
+    0xD002,
+    0xF7FE,
+    0xFB72,
+    0xB2C9,
+    0x3408,
+    0x1864,
+    0x7823,
+    0xB2DB,
+    0x0018,
+    0xBD70,
+    0xB513,
+    0x2300,
+    0x466C,
+    0x71A3,
+    0x466B,
+    0xF7FF,
+    0xFF7C,
+    0x7920,
+    0xBD16,
+    0xB5F0,
+    0x0C14,
+    0x4054,
+    0xB085,
+    0x001E,
+    0xB2A3,
+    0x9300,
+    0x424B,
+    0x414B,
+    0xAA02,
+    0x000D,
+    0x7193,
+    0x9900,
+    0x0013,
+    0x0032,
+    0x9F0A,
+    0xF7FF,
+    0xFF68,
+    0x2D00,
+    0xD10B,
+    0x2F00,
+    0xD005,
+    0xAB02,
+    0x885B,
+    0x813B,
+    0xAB02,
+    0x795B,
+    0x72BB,
+    0xAB02,
+    0x7918,
+    0xB005,
+    0xBDF0,
+    0x0033,
+    0x332D,
+    0x781B,
+    0xB2D9,
+    0x2B07,
+    0xD806,
+    0x1F4B,
+    0x000A,
+    0x3A0A,
+    0x0FD5,
+    0x18AD,
+    0x106D,
+    0xE003,
+    0x2303,
+    0x250B,
+    0x291F,
+    0xD9F5,
+    0x429D,
+    0xDA00,
+    0x001D,
+    0x2D00,
+    0xDC00,
+    0x2501,
+    0x893B,
+    0x200F,
+    0x001C,
+    0x4A19,
+    0x4004,
+    0x5D14,
+    0x3608,
+    0x0124,
+    0x0020,
+    0x0B1C,
+    0x5D14,
+    0x0224,
+    0x46A4,
+    0x0004,
+    0x4660,
+    0x4304,
+    0x0918,
+    0x9401,
+    0x0004,
+    0x200F,
+    0x4004,
+    0x5D10,
+    0x9C01,
+    0x0A1B,
+    0x4304,
+    0x200F,
+    0x4003,
+    0x5CD2,
+    0x2311,
+    0x0312,
+    0x4322,
+    0x4353,
+    0x9A00,
+    0x0014,
+    0x18D3,
+    0xB29B,
+    0x813B,
+    0x405C,
+    0x006B,
+    0x1ACB,
+    0x3301,
+    0x435C,
+    0x7AB8,
+    0x0C24,
+    0x1940,
+    0x1900,
+    0xF7FE,
+    0xFBE5,
+    0xB2CB,
+    0x72BB,
+    0x1871,
+    0x7808,
+    0xB2C0,
+    0xE7B0,
+    0x46C0,
+    0x192B,
+    0x1003,
+    0xB5F7,
+    0x2518,
+    0x9200,
+    0x001E,
+    0xB2CA,
+    0xB2CB,
+    0x4355,
+    0x9301,
+    0x4B22,
+    0x0004,
+    0x881B,
+    0x000F,
+    0x18ED,
+    0xF00C,
+    0xFCDB,
+    0x4B20,
+    0x18ED,
+    0x9B00,
+    0x2B00,
+    0xD02F,
+    0x6D62,
+    0x682B,
+    0x189B,
+    0x6563,
+    0x8CA3,
+    0xB2F8,
+    0xB29D,
+    0x3301,
+    0xB29B,
+    0x84A3,
+    0x0029,
+    0xF002,
+    0xFF73,
+    0xF00C,
+    0xFCCF,
+    0x0023,
+    0x2202,
+    0x3351,
+    0x701A,
+    0x3B19,
+    0x781B,
+    0x2B00,
+    0xD008,
+    0x8EE3,
+    0x429D,
+    0xD105,
+    0x2301,
+    0x40BB,
+    0x2600,
+    0x4A10,
+    0xB29B,
+    0x8093,
+    0x4B0F,
+    0x781B,
+    0x065B,
+    0xD509,
+    0x4B0E,
+    0x6C5A,
+    0x2201,
+    0x6C5B,
+    0x08DB,
+    0x4013,
+    0x4A0C,
+    0x6952,
+    0x3268,
+    0x7013,
+    0x0030,
+    0xBDFE,
+    0x4909,
+    0x682A,
+    0x6A88,
+    0x6A4B,
+    0x65A0,
+    0x6AC9,
+    0x1A9A,
+    0x65E1,
+    0xE7C9,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x4000,
+    0x4201,
+    0x0113,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xC820,
+    0x4203,
+    0x8882,
+    0x4B09,
+    0xB510,
+    0x18D2,
+    0x2900,
+    0xD008,
+    0x68C1,
+    0x8C80,
+    0x0C0B,
+    0x4059,
+    0xB280,
+    0xB289,
+    0xF7FF,
+    0xFF1F,
+    0xBD10,
+    0x0011,
+    0xF7FF,
+    0xFEF4,
+    0xE7FA,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x2200,
+    0x4B02,
+    0x635A,
+    0x725A,
+    0x4770,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0xB5F8,
+    0x2303,
+    0x2607,
+    0x4D35,
+    0x4C35,
+    0x696A,
+    0x7991,
+    0x4019,
+    0x6963,
+    0x1C48,
+    0x43B3,
+    0x4303,
+    0x6163,
+    0x2802,
+    0xD058,
+    0x1E8B,
+    0x2B01,
+    0xD853,
+    0x4B2F,
+    0x2700,
+    0x781B,
+    0xB2DB,
+    0xB2DE,
+    0x7666,
+    0x4E2D,
+    0x7037,
+    0x4F2D,
+    0x4E2E,
+    0x5C3F,
+    0x1BDB,
+    0x4F2D,
+    0x5C3F,
+    0x437B,
+    0x6033,
+    0x2801,
+    0xD145,
+    0x4B2B,
+    0x7818,
+    0x781B,
+    0x482B,
+    0xB2DB,
+    0x6303,
+    0x4B2A,
+    0x4E2B,
+    0x7818,
+    0x6A20,
+    0x781B,
+    0x4030,
+    0x1E5F,
+    0x41BB,
+    0x27F0,
+    0x041B,
+    0x4303,
+    0x6223,
+    0x4B26,
+    0x7818,
+    0x69E0,
+    0x781B,
+    0x43B8,
+    0x091B,
+    0x011B,
+    0x4303,
+    0x61E3,
+    0x68D0,
+    0xF00A,
+    0xFE1C,
+    0x696B,
+    0x7620,
+    0x7E9A,
+    0x8B19,
+    0x0412,
+    0x430A,
+    0x6262,
+    0x2240,
+    0x7929,
+    0x3368,
+    0x430A,
+    0x8422,
+    0x4A1B,
+    0x7811,
+    0x2101,
+    0x000D,
+    0x6A20,
+    0x7812,
+    0x4030,
+    0x0852,
+    0x4395,
+    0x042A,
+    0x4302,
+    0x6222,
+    0x6A22,
+    0x4816,
+    0x4002,
+    0x6222,
+    0x781A,
+    0x6922,
+    0x781B,
+    0x438A,
+    0x400B,
+    0x4313,
+    0x6123,
+    0xBDF8,
+    0x4B11,
+    0xE7AA,
+    0x4B11,
+    0xE7A8,
+    0x2802,
+    0xD1BD,
+    0x4B10,
+    0xE7B6,
+    0xC820,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x1945,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x1940,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0xB5F7,
+    0x2601,
+    0x0030,
+    0x4D30,
+    0x277F,
+    0x696A,
+    0x7993,
+    0x3268,
+    0x071B,
+    0x0F9B,
+    0x4098,
+    0x7811,
+    0xB2C0,
+    0x2200,
+    0xB2C9,
+    0xF7FF,
+    0xFCBB,
+    0x0004,
+    0xF009,
+    0xF922,
+    0x0020,
+    0xF009,
+    0xFD95,
+    0x696C,
+    0x4B26,
+    0x68E2,
+    0x619A,
+    0x4A26,
+    0x6920,
+    0x0011,
+    0x31CC,
+    0x6008,
+    0x6961,
+    0x32D0,
+    0x6011,
+    0x7EA2,
+    0x8B22,
+    0x7EA2,
+    0x8B21,
+    0x0412,
+    0x430A,
+    0x605A,
+    0x2240,
+    0x481F,
+    0x7801,
+    0x4391,
+    0x7001,
+    0x7928,
+    0x6919,
+    0x4038,
+    0x4302,
+    0x2080,
+    0x43B9,
+    0x430A,
+    0x611A,
+    0x4A1A,
+    0x3538,
+    0x7811,
+    0x6919,
+    0x7812,
+    0x4381,
+    0x0030,
+    0x4390,
+    0x01C2,
+    0x430A,
+    0x611A,
+    0x681A,
+    0x4316,
+    0x601E,
+    0x2300,
+    0x4A13,
+    0x8013,
+    0x4A13,
+    0x8013,
+    0x22FF,
+    0x4B13,
+    0x701A,
+    0x19E3,
+    0x7818,
+    0x3B07,
+    0xB2C0,
+    0x7028,
+    0x0025,
+    0x7819,
+    0x357E,
+    0x3302,
+    0x6F22,
+    0x881B,
+    0x347C,
+    0x782D,
+    0x8826,
+    0x042C,
+    0x4334,
+    0xB2C9,
+    0xB29B,
+    0x9400,
+    0xF7FE,
+    0xFB2A,
+    0xBDF7,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xD000,
+    0x4200,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x4B0B,
+    0x4A0C,
+    0x881B,
+    0xB570,
+    0xB29C,
+    0x189B,
+    0x681D,
+    0x4B0A,
+    0x0028,
+    0x6959,
+    0x2204,
+    0x310C,
+    0xF00F,
+    0xFF6A,
+    0x2301,
+    0x712B,
+    0x2300,
+    0x716B,
+    0x4B05,
+    0x18E4,
+    0x2306,
+    0x8023,
+    0xBD70,
+    0x46C0,
+    0x0114,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xC820,
+    0x4203,
+    0x8008,
+    0x4203,
+    0xB510,
+    0x4C07,
+    0x6960,
+    0x8D82,
+    0xB293,
+    0x2A00,
+    0xD104,
+    0xF007,
+    0xF969,
+    0x0003,
+    0x6962,
+    0x8590,
+    0x4A02,
+    0x1898,
+    0xBD10,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB570,
+    0x4A15,
+    0x4C15,
+    0x7813,
+    0x6960,
+    0x3301,
+    0x7013,
+    0x4A14,
+    0x8D83,
+    0x8812,
+    0xB29D,
+    0x429A,
+    0xD11B,
+    0xF007,
+    0xF931,
+    0x6961,
+    0x4243,
+    0x4158,
+    0x4B0F,
+    0xB2C0,
+    0x18ED,
+    0x000B,
+    0x7160,
+    0x3328,
+    0x682A,
+    0x781B,
+    0x0100,
+    0x009B,
+    0x4303,
+    0x201C,
+    0x3127,
+    0x780C,
+    0xB2DB,
+    0x7911,
+    0x00E4,
+    0x4323,
+    0x4003,
+    0x4381,
+    0x430B,
+    0x7113,
+    0xBD70,
+    0xF007,
+    0xF91F,
+    0xE7E2,
+    0xC854,
+    0x4203,
+    0xC820,
+    0x4203,
+    0x0114,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0003,
+    0xB570,
+    0x3380,
+    0x000D,
+    0x7819,
+    0x0004,
+    0xB2C9,
+    0xF7FF,
+    0xFE6D,
+    0x2301,
+    0x0029,
+    0x001A,
+    0x0020,
+    0xF7FF,
+    0xFE0D,
+    0xBD70,
+    0xB570,
+    0x4D3E,
+    0x696C,
+    0x0023,
+    0x3360,
+    0x781B,
+    0xB2DE,
+    0x2B00,
+    0xD002,
+    0x002B,
+    0x3336,
+    0x781E,
+    0x0023,
+    0x3361,
+    0x781B,
+    0x2B00,
+    0xD004,
+    0x002B,
+    0x3335,
+    0x781B,
+    0x18F6,
+    0xB2F6,
+    0x0023,
+    0x3362,
+    0x781A,
+    0x002B,
+    0x3337,
+    0x781B,
+    0x2A00,
+    0xD049,
+    0x18F6,
+    0xB2F6,
+    0x002B,
+    0x2080,
+    0x3334,
+    0x7819,
+    0x0200,
+    0x2900,
+    0xD003,
+    0xF7FE,
+    0xF8D9,
+    0x4370,
+    0xB280,
+    0x0023,
+    0x0021,
+    0x336A,
+    0x881E,
+    0x3166,
+    0x7809,
+    0xB2B2,
+    0x42B0,
+    0xD33B,
+    0x1A80,
+    0x4108,
+    0xB280,
+    0x2800,
+    0xD134,
+    0x3201,
+    0xB292,
+    0x801A,
+    0x4B21,
+    0x781B,
+    0x069B,
+    0xD526,
+    0x0021,
+    0x316E,
+    0x7808,
+    0xB2C3,
+    0x2800,
+    0xD132,
+    0x346C,
+    0x8023,
+    0x696B,
+    0x0019,
+    0x3164,
+    0x8809,
+    0x428A,
+    0xD918,
+    0x0019,
+    0x316C,
+    0x8809,
+    0x428A,
+    0xD913,
+    0x3368,
+    0x7819,
+    0x7819,
+    0x4248,
+    0x4141,
+    0xB2C9,
+    0x7019,
+    0x696B,
+    0x0019,
+    0x316C,
+    0x800A,
+    0x001A,
+    0x2100,
+    0x326A,
+    0x8011,
+    0x3A03,
+    0x7812,
+    0x336E,
+    0xB2D2,
+    0x701A,
+    0xBD70,
+    0x0029,
+    0x3134,
+    0x780A,
+    0x1AD3,
+    0x700B,
+    0xE7B1,
+    0x1882,
+    0xE7C9,
+    0x1A10,
+    0x4108,
+    0xB280,
+    0x2800,
+    0xD101,
+    0x3A01,
+    0xE7C2,
+    0x1A12,
+    0xE7C0,
+    0x3B01,
+    0xB2DB,
+    0x700B,
+    0xE7CA,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xB570,
+    0x4B09,
+    0x0005,
+    0x781B,
+    0x065B,
+    0xD401,
+    0xF7FF,
+    0xFF76,
+    0x4B06,
+    0x4C07,
+    0x7819,
+    0x2200,
+    0x002B,
+    0xB2C9,
+    0x6960,
+    0xF7FF,
+    0xFD79,
+    0xF00B,
+    0xFA81,
+    0xBD70,
+    0x0113,
+    0x4203,
+    0x0209,
+    0x4203,
+    0xC820,
+    0x4203,
+    0x2300,
+    0xB510,
+    0x4C14,
+    0x2201,
+    0x60E3,
+    0x4B14,
+    0x6C5B,
+    0x06DB,
+    0xD51C,
+    0x6843,
+    0x6960,
+    0x781B,
+    0x0919,
+    0x4011,
+    0x71A1,
+    0x0001,
+    0x3127,
+    0x7809,
+    0x089B,
+    0x4013,
+    0x428B,
+    0xD00D,
+    0x490C,
+    0x8D82,
+    0x8809,
+    0xB293,
+    0x4291,
+    0xD004,
+    0x4A0A,
+    0x189B,
+    0x60E3,
+    0xF007,
+    0xF871,
+    0x2200,
+    0x6963,
+    0x859A,
+    0x2001,
+    0xBD10,
+    0x7C20,
+    0x71A2,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0xE7F8,
+    0xC820,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0114,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F8,
+    0xF7FF,
+    0xFED5,
+    0x4D36,
+    0x0004,
+    0x6BEF,
+    0x6C68,
+    0x2200,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FD,
+    0xFF7C,
+    0x2403,
+    0x2826,
+    0x002A,
+    0x4B30,
+    0x881A,
+    0x4252,
+    0x23E3,
+    0x2601,
+    0x492E,
+    0x009B,
+    0x58CB,
+    0x482E,
+    0x6C69,
+    0x0B9B,
+    0x6800,
+    0x4033,
+    0x0AC9,
+    0x00DB,
+    0x4031,
+    0x19DB,
+    0x00C9,
+    0x0700,
+    0x1740,
+    0x1A5B,
+    0x1A1B,
+    0x189B,
+    0x6C6A,
+    0x0552,
+    0x0F52,
+    0x1E50,
+    0x2803,
+    0xD81F,
+    0xF7FD,
+    0xFF5A,
+    0x140A,
+    0x1C19,
+    0x4B22,
+    0xE7DD,
+    0x4B22,
+    0xE7DB,
+    0x4B22,
+    0xE7D9,
+    0x4B22,
+    0xE7D7,
+    0x4922,
+    0x7809,
+    0x00C9,
+    0x3128,
+    0x185B,
+    0x6C29,
+    0xB289,
+    0x4820,
+    0x5C80,
+    0xE00E,
+    0x491D,
+    0x7809,
+    0x00C9,
+    0x3118,
+    0xE7F4,
+    0x3391,
+    0x33FF,
+    0xE7F2,
+    0x337F,
+    0xE7FB,
+    0x6C29,
+    0x2000,
+    0xB289,
+    0x2A04,
+    0xD9ED,
+    0x6C6A,
+    0x2201,
+    0x4694,
+    0x4E16,
+    0x4341,
+    0x6937,
+    0x3396,
+    0x4397,
+    0x6C6A,
+    0x4665,
+    0x08D2,
+    0x402A,
+    0x433A,
+    0x6132,
+    0x0020,
+    0x18C9,
+    0xF00F,
+    0xFF35,
+    0x4B10,
+    0x0020,
+    0x695B,
+    0x001A,
+    0x3279,
+    0x7811,
+    0x6F5A,
+    0xB2C9,
+    0xF7FE,
+    0xF92B,
+    0xBDF8,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x193B,
+    0x1003,
+    0x5000,
+    0x4200,
+    0xC820,
+    0x4203,
+    0xB5F7,
+    0x4D72,
+    0x0001,
+    0x6C6B,
+    0x4C71,
+    0x06DB,
+    0xD400,
+    0xE0B3,
+    0x6842,
+    0x7813,
+    0xB2D8,
+    0x9000,
+    0x2001,
+    0x08DB,
+    0x4003,
+    0x6960,
+    0x9301,
+    0x0003,
+    0x3329,
+    0x781B,
+    0x9F01,
+    0x429F,
+    0xD037,
+    0x2703,
+    0x7813,
+    0x403B,
+    0x2B01,
+    0xD10A,
+    0x7853,
+    0x2B00,
+    0xD107,
+    0x9B00,
+    0x069B,
+    0xD52C,
+    0x0023,
+    0x3338,
+    0x781B,
+    0x2B00,
+    0xD027,
+    0x8C83,
+    0x0008,
+    0xB29B,
+    0x848B,
+    0x2200,
+    0x0023,
+    0x3022,
+    0x840A,
+    0x3338,
+    0x7002,
+    0x781B,
+    0x4293,
+    0xD013,
+    0x9B00,
+    0x069B,
+    0xD510,
+    0x6963,
+    0x001F,
+    0x337C,
+    0x377E,
+    0x783E,
+    0x881E,
+    0x783F,
+    0x881B,
+    0x840B,
+    0x7007,
+    0x6963,
+    0x337F,
+    0x701A,
+    0x682B,
+    0x3202,
+    0x4393,
+    0x602B,
+    0x4850,
+    0xF7FF,
+    0xFB3D,
+    0x2300,
+    0x7223,
+    0xF00A,
+    0xF81F,
+    0x2101,
+    0x6963,
+    0x9A01,
+    0x3329,
+    0x701A,
+    0x9B00,
+    0x6962,
+    0x109B,
+    0x322A,
+    0x400B,
+    0x7013,
+    0x6962,
+    0x3227,
+    0x7817,
+    0xB2F8,
+    0x42BB,
+    0xD027,
+    0x1843,
+    0x400B,
+    0x7013,
+    0x71E1,
+    0x68E1,
+    0x2900,
+    0xD002,
+    0x4842,
+    0xF7FF,
+    0xFB2A,
+    0x6963,
+    0x001A,
+    0x3239,
+    0x7812,
+    0x2A00,
+    0xD10B,
+    0x001A,
+    0x3329,
+    0x3228,
+    0x7811,
+    0x7818,
+    0xB2C3,
+    0x4288,
+    0xD103,
+    0x2101,
+    0x3301,
+    0x400B,
+    0x7013,
+    0x6BEF,
+    0x6C68,
+    0x2300,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD80D,
+    0xF7FD,
+    0xFE7D,
+    0x2F09,
+    0x3331,
+    0x0035,
+    0x0022,
+    0x3235,
+    0x7813,
+    0x3301,
+    0x7013,
+    0xE7DB,
+    0x4B2F,
+    0x881B,
+    0x425B,
+    0x22E3,
+    0x2601,
+    0x492E,
+    0x0092,
+    0x588A,
+    0x482D,
+    0x6C69,
+    0x0B92,
+    0x6800,
+    0x4032,
+    0x0AC9,
+    0x00D2,
+    0x4031,
+    0x19D2,
+    0x00C9,
+    0x0700,
+    0x1A52,
+    0x1740,
+    0x1A12,
+    0x18D2,
+    0x2300,
+    0x62A2,
+    0x7423,
+    0x6BE9,
+    0x6C68,
+    0x2300,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD818,
+    0xF7FD,
+    0xFE51,
+    0x2D14,
+    0x312F,
+    0x0033,
+    0x4B1F,
+    0xE7D8,
+    0x4B1F,
+    0xE7D6,
+    0x4B1F,
+    0xE7D4,
+    0x4B1F,
+    0xE7D2,
+    0x0022,
+    0x7C23,
+    0x3236,
+    0x3301,
+    0x7423,
+    0x7813,
+    0x3301,
+    0x7013,
+    0xE7E2,
+    0x4B14,
+    0x881B,
+    0x425B,
+    0x22E3,
+    0x2601,
+    0x4812,
+    0x0092,
+    0x5882,
+    0x6C68,
+    0x4D11,
+    0x0B92,
+    0x682D,
+    0x4032,
+    0x0AC0,
+    0x4030,
+    0x00D2,
+    0x1852,
+    0x00C0,
+    0x072D,
+    0x176D,
+    0x1A12,
+    0x1B52,
+    0x18D3,
+    0x62E3,
+    0xBDF7,
+    0x4B0A,
+    0xE7E5,
+    0x4B0A,
+    0xE7E3,
+    0x4B0A,
+    0xE7E1,
+    0x4B0A,
+    0xE7DF,
+    0x6000,
+    0x4200,
+    0xC820,
+    0x4203,
+    0x0234,
+    0x4203,
+    0x023C,
+    0x4203,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x2200,
+    0xB510,
+    0x0011,
+    0x0004,
+    0x0010,
+    0xF007,
+    0xFEA7,
+    0x2203,
+    0x4B03,
+    0x0020,
+    0x695B,
+    0x3351,
+    0x701A,
+    0xF7FF,
+    0xFE1F,
+    0xBD10,
+    0xC820,
+    0x4203,
+    0x8943,
+    0x4A0A,
+    0xB510,
+    0xB29C,
+    0x189B,
+    0x2203,
+    0x701A,
+    0x4B08,
+    0x2118,
+    0x881B,
+    0x1AC0,
+    0x4B07,
+    0x18C0,
+    0xF7FD,
+    0xFE03,
+    0x210F,
+    0x4B05,
+    0x4001,
+    0x18E0,
+    0xF7FF,
+    0xFD75,
+    0xBD10,
+    0x8051,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8000,
+    0x4203,
+    0x4A0F,
+    0xB570,
+    0x6950,
+    0x2401,
+    0x0003,
+    0x3350,
+    0x7819,
+    0x781B,
+    0xB2DB,
+    0x0749,
+    0xD50C,
+    0x08DB,
+    0x4223,
+    0xD009,
+    0x2520,
+    0x4B09,
+    0x4C09,
+    0x7819,
+    0x6FE1,
+    0x781B,
+    0x43A9,
+    0x402B,
+    0x430B,
+    0x67E3,
+    0x4B06,
+    0x8D80,
+    0x6991,
+    0x18C0,
+    0xF00F,
+    0xFDC8,
+    0xBD70,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x8000,
+    0x4203,
+    0xB5F8,
+    0x4A3E,
+    0x4C3E,
+    0x8943,
+    0x493E,
+    0x0005,
+    0x6020,
+    0x1898,
+    0x6160,
+    0x185B,
+    0x7819,
+    0x2601,
+    0xB2C9,
+    0xF7FF,
+    0xFBAB,
+    0x7120,
+    0x2003,
+    0x6963,
+    0x4F38,
+    0x3350,
+    0x7819,
+    0x781A,
+    0x0889,
+    0x4031,
+    0x4002,
+    0x2000,
+    0xF007,
+    0xFE3A,
+    0x003A,
+    0x3288,
+    0x6813,
+    0x43B3,
+    0x6013,
+    0xF7FF,
+    0xFBAD,
+    0xF7FF,
+    0xFBB3,
+    0xF7FF,
+    0xFC41,
+    0xF7FF,
+    0xFCB3,
+    0xF7FF,
+    0xFCD1,
+    0x003B,
+    0x2003,
+    0x2280,
+    0x3394,
+    0x6018,
+    0x4B2A,
+    0x0192,
+    0x63DE,
+    0x6959,
+    0x430A,
+    0x615A,
+    0x2228,
+    0x4B28,
+    0x4928,
+    0x701A,
+    0x4B28,
+    0x781A,
+    0x6A3A,
+    0x781B,
+    0x400A,
+    0x21E0,
+    0x021B,
+    0x00C9,
+    0x400B,
+    0x4313,
+    0x623B,
+    0x7920,
+    0xF00A,
+    0xF9AA,
+    0x4B22,
+    0x4923,
+    0x8818,
+    0x881F,
+    0x1A28,
+    0x1840,
+    0x2118,
+    0xF7FD,
+    0xFD7B,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x491E,
+    0xB2BF,
+    0x187F,
+    0x19C0,
+    0x7803,
+    0x491C,
+    0x185B,
+    0x009B,
+    0x681A,
+    0x4B1B,
+    0x881B,
+    0x189B,
+    0x61A3,
+    0x6963,
+    0x001A,
+    0x3279,
+    0x8D98,
+    0x7811,
+    0x6F5A,
+    0x4B0A,
+    0xB2C9,
+    0x18C0,
+    0xF7FD,
+    0xFF51,
+    0xF7FF,
+    0xFCA1,
+    0x2300,
+    0x7423,
+    0x6963,
+    0x6D9A,
+    0x62A2,
+    0x6DDB,
+    0x62E3,
+    0x686A,
+    0x69A3,
+    0x189B,
+    0x6263,
+    0xF7FF,
+    0xFF5C,
+    0x0030,
+    0xBDF8,
+    0x8000,
+    0x4203,
+    0xC820,
+    0x4203,
+    0x8080,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0xF8FF,
+    0xFFFF,
+    0x012F,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0x2120,
+    0x4A11,
+    0xB510,
+    0x6FD3,
+    0x438B,
+    0x67D3,
+    0x2800,
+    0xD116,
+    0x4C0E,
+    0x61E0,
+    0xF00A,
+    0xF8DA,
+    0x2102,
+    0x6963,
+    0x4A0C,
+    0x8D9B,
+    0x3434,
+    0x189A,
+    0x7011,
+    0x4A0B,
+    0x6991,
+    0x4A0B,
+    0x7812,
+    0x1852,
+    0x490A,
+    0x185B,
+    0x601A,
+    0x7823,
+    0x3301,
+    0x7023,
+    0xBD10,
+    0x2001,
+    0xF7FF,
+    0xFEEE,
+    0xE7FA,
+    0x46C0,
+    0x4004,
+    0x4200,
+    0xC820,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x0262,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xB570,
+    0x4C2C,
+    0x69E0,
+    0x2800,
+    0xD04E,
+    0xF7FF,
+    0xFD21,
+    0x7260,
+    0x2800,
+    0xD043,
+    0x6862,
+    0x4B28,
+    0x421A,
+    0xD03F,
+    0x4B27,
+    0x781B,
+    0x2B00,
+    0xD13B,
+    0x6963,
+    0x4A26,
+    0x7899,
+    0x8818,
+    0x6D95,
+    0x6A62,
+    0x0409,
+    0x1B52,
+    0x4301,
+    0x1A52,
+    0xD430,
+    0x001A,
+    0x326F,
+    0x7812,
+    0x2A00,
+    0xD12B,
+    0x3350,
+    0x781A,
+    0x781B,
+    0x2101,
+    0xB2DB,
+    0x0752,
+    0xD50C,
+    0x08DB,
+    0x420B,
+    0xD009,
+    0x2020,
+    0x4B1A,
+    0x491A,
+    0x781A,
+    0x6FCA,
+    0x781B,
+    0x4382,
+    0x4003,
+    0x4313,
+    0x67CB,
+    0xF7FF,
+    0xFD24,
+    0x69E0,
+    0xF7FF,
+    0xFDA9,
+    0x6963,
+    0x0019,
+    0x8C9A,
+    0x3184,
+    0xB292,
+    0x800A,
+    0x6822,
+    0x338C,
+    0x6851,
+    0x6A62,
+    0x1A52,
+    0x601A,
+    0x7A63,
+    0x2B00,
+    0xD106,
+    0x2001,
+    0xF7FF,
+    0xFE93,
+    0xE004,
+    0x2300,
+    0x7263,
+    0xE7E6,
+    0xF7FF,
+    0xFBF5,
+    0xBD70,
+    0x3437,
+    0x7823,
+    0x3301,
+    0x7023,
+    0xE7F0,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0xFF00,
+    0x00FF,
+    0x020A,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x4B01,
+    0x61D8,
+    0x2000,
+    0x4770,
+    0xC820,
+    0x4203,
+    0xB5F8,
+    0x0005,
+    0x2018,
+    0x4F22,
+    0x4348,
+    0x883C,
+    0x0016,
+    0x4B21,
+    0x1824,
+    0x18E3,
+    0x6819,
+    0x6D6B,
+    0x4351,
+    0x18CB,
+    0x656B,
+    0x883B,
+    0x4A1D,
+    0x189B,
+    0x181B,
+    0x781B,
+    0x4A1C,
+    0x189B,
+    0x009B,
+    0x681A,
+    0x883B,
+    0x4F19,
+    0x188A,
+    0x19DB,
+    0x181B,
+    0x781B,
+    0x4817,
+    0x181B,
+    0x009B,
+    0x601A,
+    0x4B16,
+    0x18E0,
+    0xF006,
+    0xFD84,
+    0x8CAA,
+    0xB2B3,
+    0x189A,
+    0xB292,
+    0x84AA,
+    0x8DEA,
+    0x2125,
+    0x189A,
+    0xB292,
+    0x85EA,
+    0x4A10,
+    0x18A4,
+    0x8822,
+    0x189B,
+    0xB29B,
+    0x8023,
+    0x002C,
+    0x3426,
+    0x7820,
+    0x78EB,
+    0x435E,
+    0x1980,
+    0xB200,
+    0xF7FD,
+    0xFDC9,
+    0x2900,
+    0xDB03,
+    0xB209,
+    0xB2C9,
+    0x7021,
+    0xBDF8,
+    0x3125,
+    0xE7F9,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x8000,
+    0x4203,
+    0x8002,
+    0x4203,
+    0xB570,
+    0x0006,
+    0x2303,
+    0x3651,
+    0x7033,
+    0x4B09,
+    0x0004,
+    0x881B,
+    0x0015,
+    0x1AC9,
+    0x4B07,
+    0x18C8,
+    0x2118,
+    0xF7FD,
+    0xFC35,
+    0x210F,
+    0x002A,
+    0x4001,
+    0x0020,
+    0xF7FF,
+    0xFF97,
+    0x2302,
+    0x7033,
+    0xBD70,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0xB510,
+    0x0004,
+    0x342B,
+    0x7822,
+    0x2300,
+    0x07D2,
+    0xD511,
+    0x8DC2,
+    0x8C41,
+    0x4291,
+    0xD90D,
+    0x0002,
+    0x3238,
+    0x7812,
+    0x429A,
+    0xD003,
+    0x8EC2,
+    0x8C81,
+    0x4291,
+    0xD004,
+    0xF006,
+    0xFC96,
+    0x0003,
+    0x1E5A,
+    0x4193,
+    0x2208,
+    0x7821,
+    0x4391,
+    0x00DA,
+    0x430A,
+    0x2110,
+    0x7022,
+    0x7822,
+    0x438A,
+    0x7022,
+    0x2B00,
+    0xD102,
+    0x7823,
+    0x079B,
+    0x0FDB,
+    0xB2D8,
+    0xBD10,
+    0xB5F8,
+    0x000E,
+    0x362B,
+    0x7833,
+    0x0007,
+    0x000D,
+    0x2201,
+    0x075B,
+    0xD532,
+    0x7833,
+    0x08DB,
+    0x4213,
+    0xD02E,
+    0x2410,
+    0x7833,
+    0x0008,
+    0x43A3,
+    0x4323,
+    0x7033,
+    0xF006,
+    0xFC6D,
+    0x2800,
+    0xD02A,
+    0x8C6C,
+    0x8DEB,
+    0x1AE4,
+    0x002B,
+    0x3338,
+    0x781B,
+    0xB224,
+    0x2B00,
+    0xD00B,
+    0x8EEB,
+    0x8CAA,
+    0x3B01,
+    0x1A9B,
+    0xB21B,
+    0x42A3,
+    0xDA04,
+    0x8EEC,
+    0x8CAB,
+    0x3C01,
+    0x1AE4,
+    0xB224,
+    0x2C00,
+    0xDD0E,
+    0x4B0B,
+    0x2118,
+    0x8818,
+    0x4B0B,
+    0x1A38,
+    0x18C0,
+    0xF7FD,
+    0xFBC8,
+    0x210F,
+    0x0022,
+    0x4001,
+    0x0028,
+    0xF7FF,
+    0xFF2A,
+    0xBDF8,
+    0x2210,
+    0x7833,
+    0x4393,
+    0x7033,
+    0xE7F9,
+    0x7833,
+    0x43A3,
+    0xE7FA,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x6843,
+    0x4A12,
+    0x895B,
+    0xB570,
+    0x189A,
+    0x6811,
+    0x0004,
+    0x6880,
+    0x1809,
+    0x6011,
+    0x4A0E,
+    0x189B,
+    0x2220,
+    0x601A,
+    0x4B0D,
+    0x000A,
+    0x8818,
+    0x2318,
+    0x7825,
+    0x3A10,
+    0x436B,
+    0x4D0B,
+    0x1940,
+    0x181B,
+    0x781B,
+    0x480A,
+    0x181B,
+    0x009B,
+    0x601A,
+    0x68E0,
+    0xF00B,
+    0xFD10,
+    0x0001,
+    0x6860,
+    0xF006,
+    0xFCA2,
+    0xBD70,
+    0x46C0,
+    0x8054,
+    0x4203,
+    0x801C,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB57F,
+    0x4C15,
+    0x2118,
+    0x8823,
+    0x250F,
+    0x1AC0,
+    0x4B13,
+    0x18C0,
+    0xF7FD,
+    0xFB7A,
+    0x4005,
+    0x2200,
+    0x0029,
+    0x4668,
+    0xF00A,
+    0xFB44,
+    0x2800,
+    0xD017,
+    0x4668,
+    0xF7FF,
+    0xFFBB,
+    0x2018,
+    0x4368,
+    0x8823,
+    0x4D0B,
+    0x4E0C,
+    0x195B,
+    0x181B,
+    0x781B,
+    0x199B,
+    0x009B,
+    0x681A,
+    0x4B09,
+    0x881B,
+    0x8821,
+    0x1AD2,
+    0x1949,
+    0x1809,
+    0x780B,
+    0x199B,
+    0x009B,
+    0x601A,
+    0xBD7F,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0xB5F7,
+    0x2200,
+    0x0005,
+    0x0011,
+    0x0010,
+    0xF007,
+    0xFBD1,
+    0x2103,
+    0x4B43,
+    0x695A,
+    0x3251,
+    0x7011,
+    0x6A1A,
+    0x2A00,
+    0xD100,
+    0xE070,
+    0x695E,
+    0x4840,
+    0x61F2,
+    0x4A40,
+    0x69F7,
+    0x8814,
+    0x681A,
+    0x8801,
+    0x6A5B,
+    0x9101,
+    0x6851,
+    0x1B1C,
+    0x4B3C,
+    0x1A64,
+    0x087F,
+    0x1BE4,
+    0x8807,
+    0x18D0,
+    0x9B01,
+    0x2118,
+    0x1AC0,
+    0xF7FD,
+    0xFB27,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B36,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x7803,
+    0x4A34,
+    0x189B,
+    0x009B,
+    0x601C,
+    0x2300,
+    0x85F3,
+    0x8633,
+    0x23FF,
+    0x2180,
+    0x4C2B,
+    0x0449,
+    0x6960,
+    0x6862,
+    0x302B,
+    0x439A,
+    0x2300,
+    0x428A,
+    0xD103,
+    0x7A23,
+    0x3B01,
+    0x425A,
+    0x4153,
+    0x2101,
+    0x7802,
+    0x438A,
+    0x4313,
+    0x7003,
+    0x6960,
+    0x0003,
+    0x332B,
+    0x781B,
+    0x089B,
+    0x420B,
+    0xD012,
+    0x8C83,
+    0xB29E,
+    0x185B,
+    0xB29B,
+    0x8483,
+    0xF7FF,
+    0xFECD,
+    0x6961,
+    0x848E,
+    0x2800,
+    0xD007,
+    0x6A63,
+    0x6820,
+    0x654B,
+    0xF7FF,
+    0xFEEE,
+    0x6963,
+    0x6D5B,
+    0x6263,
+    0x0028,
+    0xF7FF,
+    0xFAF0,
+    0x6A23,
+    0x2B00,
+    0xD014,
+    0x6963,
+    0x2230,
+    0x5EA6,
+    0x338C,
+    0x681D,
+    0x4B10,
+    0x4A12,
+    0x6820,
+    0x881B,
+    0x1880,
+    0x2118,
+    0x1AC0,
+    0xF7FD,
+    0xFAD5,
+    0x210F,
+    0x0033,
+    0x4001,
+    0x002A,
+    0x2000,
+    0xF001,
+    0xFD10,
+    0xBDF7,
+    0x6959,
+    0x6818,
+    0x8DCA,
+    0x3201,
+    0xB292,
+    0x85CA,
+    0x8E0A,
+    0x3201,
+    0xB292,
+    0x860A,
+    0x6841,
+    0xF006,
+    0xFBD2,
+    0xE7A7,
+    0x46C0,
+    0xC820,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x8943,
+    0x4A16,
+    0xB570,
+    0x189D,
+    0x4A15,
+    0xB29E,
+    0x189B,
+    0x2203,
+    0x0004,
+    0x701A,
+    0xF7FF,
+    0xFF22,
+    0x0020,
+    0x6861,
+    0xF006,
+    0xFBB4,
+    0x2102,
+    0x4B10,
+    0x0020,
+    0x18F2,
+    0x7813,
+    0x438B,
+    0x7013,
+    0x4B0E,
+    0x0029,
+    0x18F6,
+    0x8833,
+    0x3301,
+    0xB29B,
+    0x8033,
+    0xF7FF,
+    0xFE94,
+    0x4B0A,
+    0x2118,
+    0x8818,
+    0x4B0A,
+    0x1A20,
+    0x18C0,
+    0xF7FD,
+    0xFA8A,
+    0x210F,
+    0x4001,
+    0x0028,
+    0xF7FF,
+    0xF9FD,
+    0xBD70,
+    0x8000,
+    0x4203,
+    0x8051,
+    0x4203,
+    0x802B,
+    0x4203,
+    0x802E,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0xB510,
+    0x4B10,
+    0x781B,
+    0xB2DA,
+    0x2B00,
+    0xD003,
+    0x2001,
+    0xF7FF,
+    0xFF21,
+    0xBD10,
+    0x490C,
+    0x694C,
+    0x61CA,
+    0x79A3,
+    0x6988,
+    0x071B,
+    0x0F9B,
+    0x2B03,
+    0xD001,
+    0x4A09,
+    0x5CD2,
+    0x69E1,
+    0x1841,
+    0x1889,
+    0xF009,
+    0xFC86,
+    0x2302,
+    0x4906,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0xE7E7,
+    0x46C0,
+    0x020A,
+    0x4203,
+    0xC820,
+    0x4203,
+    0x194A,
+    0x1003,
+    0x0107,
+    0x4203,
+    0xB5F8,
+    0x0005,
+    0x8943,
+    0x4A43,
+    0x4C43,
+    0x1898,
+    0x4A43,
+    0x6160,
+    0x189B,
+    0x6025,
+    0x7819,
+    0xB2C9,
+    0xF7FF,
+    0xF82E,
+    0x2300,
+    0x4A40,
+    0x7163,
+    0x71A3,
+    0x6963,
+    0x7120,
+    0x8D99,
+    0x8816,
+    0xB288,
+    0x2201,
+    0x428E,
+    0xD001,
+    0x4242,
+    0x4142,
+    0x71E2,
+    0x001A,
+    0x2601,
+    0x322B,
+    0x7812,
+    0x3350,
+    0x4032,
+    0x7222,
+    0x2200,
+    0x7422,
+    0x7819,
+    0x781A,
+    0x2303,
+    0x0889,
+    0x4031,
+    0x2000,
+    0x401A,
+    0xF007,
+    0xFAA9,
+    0x4A31,
+    0x4F31,
+    0x6813,
+    0x43B3,
+    0x6013,
+    0xF7FF,
+    0xF81C,
+    0xF7FF,
+    0xF8B2,
+    0x2103,
+    0x2280,
+    0x4B2D,
+    0x0192,
+    0x6019,
+    0x4B2D,
+    0x63DE,
+    0x6959,
+    0x430A,
+    0x615A,
+    0x2228,
+    0x4B2B,
+    0x492B,
+    0x701A,
+    0x4B2B,
+    0x781A,
+    0x6A3A,
+    0x781B,
+    0x400A,
+    0x21E0,
+    0x021B,
+    0x00C9,
+    0x400B,
+    0x4313,
+    0x623B,
+    0x7920,
+    0xF009,
+    0xFE20,
+    0x0028,
+    0xF7FF,
+    0xFE73,
+    0x4B24,
+    0x2118,
+    0x8818,
+    0x881F,
+    0x4B23,
+    0x1A28,
+    0x18C0,
+    0xF7FD,
+    0xF9EE,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B1F,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x7803,
+    0x491E,
+    0x185B,
+    0x009B,
+    0x681A,
+    0x4B1D,
+    0x881B,
+    0x189B,
+    0x61A3,
+    0xF7FE,
+    0xFFE7,
+    0xF7FF,
+    0xF8E9,
+    0x0023,
+    0x3334,
+    0x001A,
+    0x781B,
+    0x199B,
+    0x7013,
+    0x6963,
+    0x6D9A,
+    0x62A2,
+    0x6DDA,
+    0x62E2,
+    0x6D5A,
+    0x686B,
+    0x189B,
+    0x2200,
+    0x6263,
+    0x6222,
+    0xF7FF,
+    0xFF4E,
+    0x0030,
+    0xBDF8,
+    0x8000,
+    0x4203,
+    0xC820,
+    0x4203,
+    0x8080,
+    0x4203,
+    0x0114,
+    0x4203,
+    0x4088,
+    0x4200,
+    0x4000,
+    0x4200,
+    0x4094,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0xF8FF,
+    0xFFFF,
+    0x012F,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0x2120,
+    0x4A20,
+    0xB570,
+    0x6FD3,
+    0x438B,
+    0x67D3,
+    0x2800,
+    0xD12D,
+    0x2301,
+    0x4C1D,
+    0x491D,
+    0x7223,
+    0x6963,
+    0x8D9A,
+    0x8809,
+    0xB293,
+    0x4291,
+    0xD000,
+    0x71E0,
+    0x2102,
+    0x4A19,
+    0x189A,
+    0x7011,
+    0x4A19,
+    0x6991,
+    0x4A19,
+    0x7812,
+    0x1852,
+    0x4918,
+    0x185B,
+    0x601A,
+    0x6862,
+    0x4B17,
+    0x421A,
+    0xD012,
+    0x4B17,
+    0x781B,
+    0xB2D9,
+    0x2B00,
+    0xD10D,
+    0x6963,
+    0x789A,
+    0x881D,
+    0x4B14,
+    0x0412,
+    0x6D98,
+    0x6A63,
+    0x432A,
+    0x1A1B,
+    0x6A20,
+    0x0840,
+    0x1A1B,
+    0x1A9B,
+    0xD503,
+    0x2001,
+    0xF7FF,
+    0xFE1D,
+    0xBD70,
+    0x61E1,
+    0x3434,
+    0xF009,
+    0xFD18,
+    0x7823,
+    0x3301,
+    0x7023,
+    0xE7F6,
+    0x4004,
+    0x4200,
+    0xC820,
+    0x4203,
+    0x0114,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x0262,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xFF00,
+    0x00FF,
+    0x020A,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x4B04,
+    0xB510,
+    0x61D8,
+    0x6A1B,
+    0x2B00,
+    0xD101,
+    0xF009,
+    0xFBB2,
+    0x2000,
+    0xBD10,
+    0xC820,
+    0x4203,
+    0xB570,
+    0x4C42,
+    0x69E0,
+    0x2800,
+    0xD100,
+    0xE07A,
+    0xF7FF,
+    0xF95E,
+    0x7260,
+    0x2800,
+    0xD016,
+    0x6963,
+    0x2101,
+    0x3350,
+    0x781A,
+    0x781B,
+    0xB2DB,
+    0x0752,
+    0xD50C,
+    0x08DB,
+    0x420B,
+    0xD009,
+    0x2020,
+    0x4B38,
+    0x4938,
+    0x781A,
+    0x6FCA,
+    0x781B,
+    0x4382,
+    0x4003,
+    0x4313,
+    0x67CB,
+    0xF7FF,
+    0xF978,
+    0x6A22,
+    0x2A00,
+    0xD144,
+    0x4933,
+    0x6BCD,
+    0x6C48,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FD,
+    0xF8F6,
+    0x4603,
+    0x4A48,
+    0x004C,
+    0x4B2E,
+    0x881A,
+    0x4252,
+    0x23E3,
+    0x2601,
+    0x482C,
+    0x009B,
+    0x58C3,
+    0x6C49,
+    0x482B,
+    0x0B9B,
+    0x6800,
+    0x4033,
+    0x0AC9,
+    0x4031,
+    0x00DB,
+    0x195B,
+    0x00C9,
+    0x0700,
+    0x1A5B,
+    0x1740,
+    0x1A1B,
+    0x189B,
+    0x6962,
+    0x4E25,
+    0x8C90,
+    0x6D51,
+    0x0035,
+    0xB280,
+    0x1A59,
+    0x42B1,
+    0xDB04,
+    0x2580,
+    0x022D,
+    0x42A9,
+    0xDA26,
+    0xB20D,
+    0x8625,
+    0x0015,
+    0x3584,
+    0x8829,
+    0x328C,
+    0x1A41,
+    0x8661,
+    0x8028,
+    0x6820,
+    0x6013,
+    0x6842,
+    0x189B,
+    0x6263,
+    0x2201,
+    0x6841,
+    0xF006,
+    0xF9B1,
+    0x3010,
+    0x0040,
+    0x6220,
+    0x69E0,
+    0xF7FF,
+    0xF9B5,
+    0x7A63,
+    0x2B00,
+    0xD10D,
+    0x2001,
+    0xF7FF,
+    0xFD81,
+    0xE00B,
+    0x4B10,
+    0xE7BB,
+    0x4B10,
+    0xE7B9,
+    0x4B10,
+    0xE7B7,
+    0x4B10,
+    0xE7B5,
+    0x4D10,
+    0xE7D7,
+    0xF7FF,
+    0xF806,
+    0xBD70,
+    0x3437,
+    0x7822,
+    0x3201,
+    0x7022,
+    0xE7E9,
+    0xC820,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x8000,
+    0xFFFF,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x7FFF,
+    0x0000,
+    0xB5F8,
+    0x2418,
+    0x7803,
+    0x4E0D,
+    0x4363,
+    0x8832,
+    0x4F0C,
+    0x0005,
+    0x19D2,
+    0x189B,
+    0x781A,
+    0x2301,
+    0x4093,
+    0x4A0A,
+    0x6453,
+    0xF7FF,
+    0xFCDD,
+    0x7828,
+    0x8833,
+    0x4344,
+    0x19DB,
+    0x18E4,
+    0x7823,
+    0x4A06,
+    0x189B,
+    0x009B,
+    0x6819,
+    0xF00B,
+    0xFA57,
+    0xBDF8,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x6400,
+    0x1080,
+    0xB510,
+    0x2400,
+    0x4B04,
+    0x761C,
+    0x6158,
+    0x60D9,
+    0x42A2,
+    0xD001,
+    0x680A,
+    0x611A,
+    0xBD10,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x3810,
+    0xB510,
+    0x280C,
+    0xD80B,
+    0xF7FD,
+    0xF84A,
+    0x0A07,
+    0x0B0A,
+    0x170F,
+    0x221E,
+    0x1B0A,
+    0x0A13,
+    0x0017,
+    0x0008,
+    0xF7FD,
+    0xFD28,
+    0xBD10,
+    0x0008,
+    0xF7FF,
+    0xFB26,
+    0xE7FA,
+    0x0008,
+    0xF7FF,
+    0xFEB2,
+    0xE7F6,
+    0xB2C8,
+    0xF005,
+    0xFD34,
+    0xE7F2,
+    0x0008,
+    0xF7FE,
+    0xFB84,
+    0xE7EE,
+    0xF006,
+    0xF877,
+    0xE7EB,
+    0x0008,
+    0xF001,
+    0xFC5D,
+    0xE7E7,
+    0x0008,
+    0xF000,
+    0xFC8B,
+    0xE7E3,
+    0xB510,
+    0x4A12,
+    0x0003,
+    0x7810,
+    0x3810,
+    0x280C,
+    0xD80B,
+    0xF7FD,
+    0xF81B,
+    0x0A07,
+    0x0B0A,
+    0x160F,
+    0x0A0A,
+    0x1A0A,
+    0x0A13,
+    0x0016,
+    0x0018,
+    0xF7FD,
+    0xFAC9,
+    0xBD10,
+    0x0018,
+    0xF7FF,
+    0xFA07,
+    0xE7FA,
+    0x0018,
+    0xF7FF,
+    0xFCD9,
+    0xE7F6,
+    0xF005,
+    0xFCF8,
+    0xE7F3,
+    0x0018,
+    0xF7FE,
+    0xFA82,
+    0xE7EF,
+    0xF006,
+    0xF831,
+    0xE7EC,
+    0x0200,
+    0x4203,
+    0x2200,
+    0xB510,
+    0x4B04,
+    0x8981,
+    0x771A,
+    0x4B04,
+    0x3201,
+    0x18C9,
+    0xF7FF,
+    0xFF94,
+    0xBD10,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x2300,
+    0x4298,
+    0xD108,
+    0x4B05,
+    0x699A,
+    0x4B05,
+    0x781B,
+    0x189B,
+    0x4A04,
+    0x68D2,
+    0x6053,
+    0x2301,
+    0x0018,
+    0x4770,
+    0x4000,
+    0x4200,
+    0x0262,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x2200,
+    0xB510,
+    0x0011,
+    0x0004,
+    0x0010,
+    0xF007,
+    0xF879,
+    0x2120,
+    0x4A09,
+    0x0020,
+    0x6FD3,
+    0x438B,
+    0x67D3,
+    0xF7FF,
+    0xFFDD,
+    0x0004,
+    0x2001,
+    0x2C00,
+    0xD004,
+    0x2280,
+    0x2000,
+    0x4B04,
+    0x0152,
+    0x601A,
+    0xF7FF,
+    0xFF9A,
+    0x0020,
+    0xBD10,
+    0x4004,
+    0x4200,
+    0x4000,
+    0x4201,
+    0xB5F0,
+    0x4E95,
+    0xB087,
+    0x7F30,
+    0x6975,
+    0x2800,
+    0xD100,
+    0xE11A,
+    0x2000,
+    0x002F,
+    0x2303,
+    0x2401,
+    0x7730,
+    0x3726,
+    0x7839,
+    0x783A,
+    0x0889,
+    0x401A,
+    0x4021,
+    0xF007,
+    0xF84B,
+    0x6973,
+    0x3326,
+    0x781A,
+    0x783B,
+    0x0892,
+    0xB2DB,
+    0x4222,
+    0xD00C,
+    0x08DB,
+    0x4223,
+    0xD009,
+    0x2020,
+    0x4B86,
+    0x4986,
+    0x781A,
+    0x6FCA,
+    0x781B,
+    0x4382,
+    0x4003,
+    0x4313,
+    0x67CB,
+    0x89AA,
+    0x4B83,
+    0x4C83,
+    0x18D2,
+    0x6BE3,
+    0x6C60,
+    0x2100,
+    0x0540,
+    0x9300,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FC,
+    0xFF80,
+    0x2603,
+    0x2A28,
+    0x002C,
+    0x497D,
+    0x8809,
+    0x4249,
+    0x20E3,
+    0x4E7C,
+    0x0080,
+    0x5837,
+    0x6C60,
+    0x0BBB,
+    0x2701,
+    0x403B,
+    0x00DB,
+    0x469C,
+    0x4E78,
+    0x9B00,
+    0x6836,
+    0x0AC0,
+    0x4038,
+    0x00C0,
+    0x4463,
+    0x0736,
+    0x1A1B,
+    0x1776,
+    0x1B9B,
+    0x6C66,
+    0x185B,
+    0x0576,
+    0x0F76,
+    0x1E70,
+    0x2803,
+    0xD81F,
+    0xF7FC,
+    0xFF5C,
+    0x140A,
+    0x1C19,
+    0x496E,
+    0xE7DB,
+    0x496E,
+    0xE7D9,
+    0x496E,
+    0xE7D7,
+    0x496E,
+    0xE7D5,
+    0x496E,
+    0x7809,
+    0x00C9,
+    0x3128,
+    0x185B,
+    0x6C21,
+    0xB289,
+    0x486C,
+    0x5D80,
+    0xE00E,
+    0x4969,
+    0x7809,
+    0x00C9,
+    0x3118,
+    0xE7F4,
+    0x3391,
+    0x33FF,
+    0xE7F2,
+    0x337F,
+    0xE7FB,
+    0x6C21,
+    0x2000,
+    0xB289,
+    0x2E04,
+    0xD9ED,
+    0x4341,
+    0x2001,
+    0x4F63,
+    0x3396,
+    0x18CB,
+    0x9302,
+    0x6C63,
+    0x6939,
+    0x6C63,
+    0x4381,
+    0x08DB,
+    0x4003,
+    0x430B,
+    0x0010,
+    0x9902,
+    0x613B,
+    0xF00E,
+    0xFF37,
+    0x6C64,
+    0x0564,
+    0x0F64,
+    0x2C02,
+    0xD100,
+    0xE07F,
+    0xD803,
+    0x2C01,
+    0xD008,
+    0xB007,
+    0xBDF0,
+    0x1EE3,
+    0x2B01,
+    0xD8FA,
+    0x4B55,
+    0x4A55,
+    0x881B,
+    0xE076,
+    0x2301,
+    0x7FE8,
+    0x425B,
+    0xB2C0,
+    0x9300,
+    0x4B41,
+    0x691D,
+    0x9303,
+    0x280F,
+    0xD8EC,
+    0x2618,
+    0x4B4F,
+    0x4346,
+    0x881B,
+    0x4940,
+    0x199A,
+    0x1851,
+    0x9201,
+    0xF00B,
+    0xF8B7,
+    0x6838,
+    0x68FA,
+    0x0021,
+    0x0592,
+    0x0D92,
+    0xB280,
+    0xF009,
+    0xFA91,
+    0x4B47,
+    0x4947,
+    0x881B,
+    0x9004,
+    0x185B,
+    0x199B,
+    0x781B,
+    0x4945,
+    0x4846,
+    0x185B,
+    0x009B,
+    0x681F,
+    0x4945,
+    0x9B01,
+    0x185B,
+    0x681E,
+    0x7E6B,
+    0x4358,
+    0x0843,
+    0x9305,
+    0x9B03,
+    0x7F5B,
+    0x2C02,
+    0xD047,
+    0x2B07,
+    0xD045,
+    0x2301,
+    0x2200,
+    0x1EE1,
+    0xB2C9,
+    0x428B,
+    0x4152,
+    0x493C,
+    0x4253,
+    0x400B,
+    0x4938,
+    0x185B,
+    0x9A05,
+    0x9902,
+    0x1850,
+    0x9A04,
+    0x1A38,
+    0x1A80,
+    0x1AC0,
+    0x2800,
+    0xDB33,
+    0xF002,
+    0xFC05,
+    0x4A35,
+    0xB2C3,
+    0x4694,
+    0x76AB,
+    0xB280,
+    0x9B01,
+    0x0A00,
+    0x76E8,
+    0x4463,
+    0x881B,
+    0x4A31,
+    0x189B,
+    0x601F,
+    0x2C01,
+    0xD09B,
+    0x9B00,
+    0x0030,
+    0x885C,
+    0x889F,
+    0xF002,
+    0xFBF0,
+    0xB2A4,
+    0xB2C3,
+    0xB280,
+    0x772B,
+    0x0A00,
+    0xB2E3,
+    0x7768,
+    0x77AB,
+    0x002B,
+    0xB2BF,
+    0x0A24,
+    0x77EC,
+    0xB2FA,
+    0x3320,
+    0x3521,
+    0x0A3F,
+    0x701A,
+    0x702F,
+    0xE782,
+    0x4B19,
+    0x4A0C,
+    0x881B,
+    0x189B,
+    0x9300,
+    0x7818,
+    0xB2C0,
+    0xE788,
+    0x4B1C,
+    0xE7C2,
+    0x1830,
+    0xE7C7,
+    0x0002,
+    0x0001,
+    0xF006,
+    0xFF39,
+    0x2001,
+    0xF7FF,
+    0xFE6A,
+    0xE76E,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x8000,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x194D,
+    0x1003,
+    0x5000,
+    0x4200,
+    0x0178,
+    0x4203,
+    0x8006,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x04E2,
+    0x0000,
+    0x8004,
+    0x4203,
+    0x09C4,
+    0x0000,
+    0x800A,
+    0x4203,
+    0x8054,
+    0x4203,
+    0xB5F0,
+    0x3820,
+    0x2302,
+    0xB085,
+    0x2806,
+    0xD875,
+    0xF7FC,
+    0xFE52,
+    0x6A04,
+    0x8B82,
+    0xBAAF,
+    0x00C9,
+    0x4B68,
+    0x2418,
+    0x781E,
+    0xF00B,
+    0xF8E5,
+    0x2101,
+    0x000F,
+    0xB2F6,
+    0x4D65,
+    0x4374,
+    0x882B,
+    0x4865,
+    0x4E65,
+    0x181B,
+    0x191B,
+    0x781A,
+    0x6CB3,
+    0x4097,
+    0x403B,
+    0xB25B,
+    0x2B00,
+    0xD013,
+    0x000A,
+    0x882B,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x409A,
+    0x4B5E,
+    0x6472,
+    0x6D9B,
+    0x882A,
+    0xB29B,
+    0x1812,
+    0x1912,
+    0x7812,
+    0x40D3,
+    0x001A,
+    0x400A,
+    0x9203,
+    0x420B,
+    0xD002,
+    0xF00B,
+    0xF8C6,
+    0xE036,
+    0xF00B,
+    0xF8C3,
+    0x882B,
+    0x4A55,
+    0x191B,
+    0x189A,
+    0x9201,
+    0x4A54,
+    0x9801,
+    0x189A,
+    0x8812,
+    0xB292,
+    0x9202,
+    0x4A52,
+    0x189B,
+    0x681F,
+    0x9A03,
+    0x0039,
+    0xF005,
+    0xFF01,
+    0x0001,
+    0x882B,
+    0x4A49,
+    0x1A79,
+    0x189B,
+    0x191B,
+    0x781B,
+    0x4A4C,
+    0x189B,
+    0x009B,
+    0x6818,
+    0x6DB3,
+    0x1AC0,
+    0xF7FC,
+    0xFEA6,
+    0xB203,
+    0x2B00,
+    0xDD08,
+    0x4B44,
+    0x4240,
+    0x469C,
+    0xB202,
+    0x9802,
+    0x9901,
+    0x4460,
+    0xF7FF,
+    0xF9CC,
+    0x882B,
+    0x4A3C,
+    0x189B,
+    0x191B,
+    0x781A,
+    0x2301,
+    0x4093,
+    0x6433,
+    0x2300,
+    0xE009,
+    0xF00B,
+    0xF882,
+    0x2019,
+    0xF00A,
+    0xFC07,
+    0x2800,
+    0xD105,
+    0xF00B,
+    0xF883,
+    0x2301,
+    0x0018,
+    0xB005,
+    0xBDF0,
+    0x4B2F,
+    0x8818,
+    0x4B33,
+    0x18C0,
+    0xF005,
+    0xFCC3,
+    0x2800,
+    0xD1AE,
+    0xF00A,
+    0xFBDD,
+    0xE7EE,
+    0xF00B,
+    0xF86A,
+    0x4B31,
+    0x781B,
+    0x2B19,
+    0xD1A5,
+    0xF00A,
+    0xF894,
+    0xE7A2,
+    0xF00B,
+    0xF861,
+    0xF005,
+    0xF81B,
+    0x0004,
+    0x28FF,
+    0xD0DE,
+    0x4B21,
+    0x4E2B,
+    0x4D2B,
+    0x781A,
+    0x8831,
+    0x782B,
+    0xB2D2,
+    0x4343,
+    0x185B,
+    0x4922,
+    0x185B,
+    0x701A,
+    0xF005,
+    0xF896,
+    0x2800,
+    0xD000,
+    0xE78A,
+    0x8830,
+    0x782B,
+    0x4924,
+    0x4363,
+    0x780A,
+    0x181B,
+    0x4823,
+    0xB2D2,
+    0x181B,
+    0x701A,
+    0x700C,
+    0xE7C1,
+    0xF00B,
+    0xF83D,
+    0x2201,
+    0x4B11,
+    0x491F,
+    0x7818,
+    0x880B,
+    0x4082,
+    0x4393,
+    0x800B,
+    0xE773,
+    0xF00B,
+    0xF832,
+    0x4B0C,
+    0x8818,
+    0x4B1A,
+    0x8819,
+    0x4B0F,
+    0x18C9,
+    0x18C0,
+    0xF001,
+    0xF9D5,
+    0x2800,
+    0xD000,
+    0xE765,
+    0xE7A7,
+    0xF00B,
+    0xF823,
+    0x4B05,
+    0x8818,
+    0x4B13,
+    0x8819,
+    0x4B08,
+    0x18C9,
+    0x18C0,
+    0xF001,
+    0xFA74,
+    0xE7EF,
+    0x46C0,
+    0x8224,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x1000,
+    0x4200,
+    0x8000,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x0200,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x0164,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x016E,
+    0x4203,
+    0x8226,
+    0x4203,
+    0xB5F8,
+    0x4B1F,
+    0x2001,
+    0x685B,
+    0x7A1A,
+    0x7A59,
+    0x0209,
+    0x4311,
+    0x7A9A,
+    0x0412,
+    0x430A,
+    0x7AD9,
+    0x0609,
+    0x4311,
+    0x000C,
+    0x7B1A,
+    0x7B59,
+    0x0209,
+    0x4311,
+    0x7B9A,
+    0x0412,
+    0x430A,
+    0x7BD9,
+    0x0609,
+    0x4311,
+    0x000D,
+    0x2100,
+    0x1900,
+    0x4169,
+    0x22FF,
+    0x0004,
+    0x4014,
+    0x7A1D,
+    0x721C,
+    0x0A04,
+    0x4014,
+    0x7A5D,
+    0x725C,
+    0x0C04,
+    0x4014,
+    0x7A9D,
+    0x0E00,
+    0x729C,
+    0x7ADC,
+    0x72D8,
+    0x0008,
+    0x4010,
+    0x7B1C,
+    0x7318,
+    0x0A08,
+    0x4010,
+    0x7B5C,
+    0x7358,
+    0x0C08,
+    0x4002,
+    0x7B98,
+    0x739A,
+    0x0E0A,
+    0x2001,
+    0x7BD9,
+    0x73DA,
+    0xF009,
+    0xFFD9,
+    0xBDF8,
+    0xC860,
+    0x4203,
+    0x4B07,
+    0x0080,
+    0x6859,
+    0x790A,
+    0x794B,
+    0x021B,
+    0x4313,
+    0x798A,
+    0x0412,
+    0x431A,
+    0x79CB,
+    0x061B,
+    0x4313,
+    0x18C0,
+    0x6800,
+    0x4770,
+    0xC860,
+    0x4203,
+    0xB570,
+    0x23FF,
+    0x2400,
+    0x4D09,
+    0x6068,
+    0x702C,
+    0x70AB,
+    0x7CC3,
+    0x706B,
+    0x686B,
+    0x785B,
+    0x42A3,
+    0xD800,
+    0xBD70,
+    0x0020,
+    0xF7FF,
+    0xFFDD,
+    0x3401,
+    0xF000,
+    0xF9C8,
+    0xB2E4,
+    0xE7F2,
+    0xC860,
+    0x4203,
+    0xB510,
+    0x4A05,
+    0x2000,
+    0x7813,
+    0x6852,
+    0x7852,
+    0x4293,
+    0xD002,
+    0x0018,
+    0xF7FF,
+    0xFFCB,
+    0xBD10,
+    0xC860,
+    0x4203,
+    0x8940,
+    0x4B01,
+    0x18C0,
+    0x4770,
+    0x8000,
+    0x4203,
+    0xB570,
+    0x4D10,
+    0x686B,
+    0x7F9B,
+    0x2B00,
+    0xD113,
+    0xF7FF,
+    0xFFE4,
+    0x1E04,
+    0xD00C,
+    0x0020,
+    0xF000,
+    0xF9F9,
+    0x2800,
+    0xD108,
+    0x782B,
+    0x686A,
+    0x3301,
+    0xB2DB,
+    0x702B,
+    0x7852,
+    0x4293,
+    0xD1EE,
+    0x2400,
+    0x0020,
+    0xBD70,
+    0xF7FF,
+    0xFFD0,
+    0x0004,
+    0xF000,
+    0xF9E7,
+    0x2800,
+    0xD1F6,
+    0xE7F4,
+    0xC860,
+    0x4203,
+    0xB510,
+    0x4C0F,
+    0x6863,
+    0x781B,
+    0x071B,
+    0xD402,
+    0x68E0,
+    0xF000,
+    0xFB65,
+    0x6862,
+    0x7F93,
+    0x2B01,
+    0xD108,
+    0x7823,
+    0x3301,
+    0xB2DB,
+    0x7023,
+    0x7852,
+    0x4293,
+    0xD101,
+    0x2300,
+    0x7023,
+    0x68E0,
+    0xF000,
+    0xFA29,
+    0x2800,
+    0xD102,
+    0x68E0,
+    0xF000,
+    0xFA42,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFFB7,
+    0x2800,
+    0xD104,
+    0x4B05,
+    0x7C1A,
+    0x2302,
+    0x2A00,
+    0xD002,
+    0xF000,
+    0xFB32,
+    0x0003,
+    0x0018,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0xB570,
+    0x2400,
+    0xF7FF,
+    0xFF9E,
+    0xF7FF,
+    0xFF76,
+    0x4D0F,
+    0x822C,
+    0x686B,
+    0x785B,
+    0x429C,
+    0xD311,
+    0x2203,
+    0x2401,
+    0x4B0C,
+    0x601A,
+    0x2280,
+    0x4B0C,
+    0x0192,
+    0x63DC,
+    0x6959,
+    0x430A,
+    0x615A,
+    0x2230,
+    0x4B09,
+    0x701A,
+    0xF7FF,
+    0xFFD2,
+    0x0020,
+    0xBD70,
+    0x0020,
+    0xF7FF,
+    0xFF49,
+    0x3401,
+    0xF000,
+    0xFAF2,
+    0xB2E4,
+    0xE7E1,
+    0xC860,
+    0x4203,
+    0x4094,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0x2001,
+    0x4770,
+    0xB510,
+    0x4B03,
+    0x6158,
+    0xF008,
+    0xFED9,
+    0x2000,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFF8F,
+    0x4B06,
+    0x68DB,
+    0x2B00,
+    0xD102,
+    0xF7FF,
+    0xFEE5,
+    0xBD10,
+    0xF7FF,
+    0xFFA8,
+    0x2802,
+    0xD1FA,
+    0xE7F7,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0xB510,
+    0x2000,
+    0xF009,
+    0xFEF0,
+    0xBD10,
+    0x0000,
+    0xB510,
+    0xF7FF,
+    0xFF53,
+    0x1E04,
+    0xD108,
+    0x4B08,
+    0x4A08,
+    0x689B,
+    0x2002,
+    0x4293,
+    0xD102,
+    0xBD10,
+    0xF7FF,
+    0xFF6C,
+    0x0020,
+    0xF000,
+    0xFB69,
+    0x2801,
+    0xD0F8,
+    0x2000,
+    0xE7F5,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB570,
+    0xF7FF,
+    0xFF33,
+    0x1D83,
+    0x7FDB,
+    0x0004,
+    0x2B00,
+    0xD03B,
+    0x0003,
+    0x0002,
+    0x3330,
+    0x3231,
+    0x781B,
+    0x7812,
+    0x0212,
+    0x431A,
+    0x0003,
+    0x3332,
+    0x781B,
+    0x041B,
+    0x4313,
+    0x0002,
+    0x3233,
+    0x7810,
+    0x3202,
+    0x0600,
+    0x4318,
+    0x0023,
+    0x3334,
+    0x781B,
+    0x7812,
+    0x0212,
+    0x431A,
+    0x0023,
+    0x3336,
+    0x781B,
+    0x041B,
+    0x4313,
+    0x0022,
+    0x3237,
+    0x7812,
+    0x0612,
+    0x431A,
+    0x7A23,
+    0x7A61,
+    0x0209,
+    0x4319,
+    0x7AA3,
+    0x041B,
+    0x430B,
+    0x7AE1,
+    0x7B25,
+    0x0609,
+    0x4319,
+    0x7B63,
+    0x021B,
+    0x432B,
+    0x7BA5,
+    0x042D,
+    0x431D,
+    0x7BE3,
+    0x061B,
+    0x432B,
+    0x429A,
+    0xD802,
+    0xD12D,
+    0x4288,
+    0xD92B,
+    0x0020,
+    0xF7FF,
+    0xFEC9,
+    0x0023,
+    0x332E,
+    0x781A,
+    0x3301,
+    0x781B,
+    0x4912,
+    0x021B,
+    0x4313,
+    0x4A12,
+    0x185B,
+    0x6093,
+    0x7823,
+    0x06DB,
+    0xD508,
+    0x7853,
+    0x3301,
+    0xB2DB,
+    0x7053,
+    0x2210,
+    0x74E3,
+    0x7823,
+    0x4393,
+    0x7023,
+    0x2203,
+    0x2401,
+    0x4B0A,
+    0x601A,
+    0x2280,
+    0x4B0A,
+    0x0192,
+    0x63DC,
+    0x6959,
+    0x430A,
+    0x615A,
+    0x2208,
+    0x4B07,
+    0x701A,
+    0xF7FF,
+    0xFF78,
+    0x0020,
+    0xBD70,
+    0x2000,
+    0xE7FC,
+    0x8000,
+    0x4203,
+    0xC860,
+    0x4203,
+    0x4094,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0x2001,
+    0x4770,
+    0xB510,
+    0xF7FF,
+    0xFEDF,
+    0x4C08,
+    0x68E0,
+    0x2800,
+    0xD102,
+    0xF7FF,
+    0xFE35,
+    0xBD10,
+    0xF000,
+    0xFAB0,
+    0x68E3,
+    0x2B00,
+    0xD0F7,
+    0xF7FF,
+    0xFF57,
+    0x2802,
+    0xD1F5,
+    0xE7F2,
+    0xC860,
+    0x4203,
+    0xB510,
+    0x2000,
+    0xF009,
+    0xFE3C,
+    0xBD10,
+    0x0000,
+    0x4B23,
+    0xB510,
+    0x685B,
+    0x0001,
+    0x001A,
+    0x3238,
+    0x7814,
+    0x4A21,
+    0x8810,
+    0x2218,
+    0x4362,
+    0x4C20,
+    0x1900,
+    0x1812,
+    0x7812,
+    0x481F,
+    0x1812,
+    0x481F,
+    0x0092,
+    0x6812,
+    0x8800,
+    0x1880,
+    0x2900,
+    0xD11B,
+    0x7F9A,
+    0x2A00,
+    0xD10D,
+    0x7859,
+    0x7E1A,
+    0x7E5C,
+    0x0224,
+    0x4314,
+    0x7E9A,
+    0x7EDB,
+    0x0412,
+    0x4322,
+    0x061B,
+    0x4313,
+    0x434B,
+    0x1818,
+    0xBD10,
+    0x1D5A,
+    0x7FD1,
+    0x7D1A,
+    0x7D5C,
+    0x0224,
+    0x4314,
+    0x7D9A,
+    0x7DDB,
+    0x0412,
+    0x4322,
+    0xE7EF,
+    0x001A,
+    0x001C,
+    0x3228,
+    0x3429,
+    0x7812,
+    0x7824,
+    0x0224,
+    0x4314,
+    0x001A,
+    0x322A,
+    0x7812,
+    0x332B,
+    0x781B,
+    0x0412,
+    0x4322,
+    0x061B,
+    0x4313,
+    0x688A,
+    0x1A9B,
+    0xE7DE,
+    0xC860,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0xB570,
+    0x2500,
+    0x7305,
+    0x0004,
+    0xF7FF,
+    0xFFA8,
+    0x2202,
+    0x6120,
+    0x7665,
+    0x7E23,
+    0x4393,
+    0x7623,
+    0xBD70,
+    0x0000,
+    0xB5F0,
+    0x4F21,
+    0xB085,
+    0x687E,
+    0x0005,
+    0x0033,
+    0x332C,
+    0x9302,
+    0x3301,
+    0x1E0C,
+    0x60F9,
+    0x9303,
+    0xD124,
+    0x333B,
+    0x6003,
+    0x8201,
+    0x0008,
+    0xF7FF,
+    0xFF8D,
+    0x9B02,
+    0x6068,
+    0x60AC,
+    0x781A,
+    0x9B03,
+    0x781B,
+    0x021B,
+    0x4313,
+    0x4A15,
+    0x189B,
+    0x7A32,
+    0x7C69,
+    0x4694,
+    0x7A70,
+    0x7AB2,
+    0x7AF2,
+    0x7B32,
+    0x7B72,
+    0x7BB2,
+    0x7BF2,
+    0x682A,
+    0x4665,
+    0x9400,
+    0x0200,
+    0x6812,
+    0x4328,
+    0xF7FE,
+    0xF831,
+    0x70B8,
+    0xB005,
+    0xBDF0,
+    0x7DCB,
+    0x340C,
+    0x3301,
+    0x7403,
+    0x7B0B,
+    0x7443,
+    0x690B,
+    0x6081,
+    0x6043,
+    0x9B02,
+    0x781A,
+    0x9B03,
+    0x781B,
+    0x021B,
+    0x4313,
+    0x4A02,
+    0x189B,
+    0xE7D8,
+    0xC860,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x7E02,
+    0x2300,
+    0x07D2,
+    0xD504,
+    0x7E02,
+    0x3301,
+    0x0792,
+    0x0FD2,
+    0x1A9B,
+    0xB2D8,
+    0x4770,
+    0x0000,
+    0xB5F7,
+    0x4B28,
+    0x0005,
+    0x6859,
+    0x1C8B,
+    0x7FDC,
+    0x1D0B,
+    0x7FDB,
+    0xB2E4,
+    0xB2DB,
+    0x9300,
+    0x1CCB,
+    0x7FDB,
+    0xB2DB,
+    0x9301,
+    0x7A0B,
+    0x7A4A,
+    0x0212,
+    0x431A,
+    0x7A8B,
+    0x041B,
+    0x4313,
+    0x7ACA,
+    0x7B08,
+    0x0612,
+    0x431A,
+    0x7B4B,
+    0x021B,
+    0x4303,
+    0x7B88,
+    0x0400,
+    0x4318,
+    0x7BCB,
+    0x2100,
+    0x061B,
+    0x4303,
+    0x0020,
+    0xF00E,
+    0xF991,
+    0x0006,
+    0x7B28,
+    0x000F,
+    0xB2C0,
+    0x0021,
+    0xF7FC,
+    0xFB40,
+    0x2300,
+    0xB2CA,
+    0x18B6,
+    0x415F,
+    0x9B00,
+    0x7B2A,
+    0x4363,
+    0x429A,
+    0xDB12,
+    0x9B01,
+    0x2B00,
+    0xD013,
+    0x7B28,
+    0x0021,
+    0xB2C0,
+    0xF7FC,
+    0xFAA9,
+    0x9B00,
+    0xB2C0,
+    0x18C0,
+    0x9B01,
+    0x3801,
+    0x4343,
+    0x435C,
+    0x0022,
+    0x17E3,
+    0x18B6,
+    0x415F,
+    0x0030,
+    0x0039,
+    0xB003,
+    0xBDF0,
+    0x2601,
+    0x4276,
+    0x17F7,
+    0xE7F7,
+    0xC860,
+    0x4203,
+    0x1E03,
+    0xD018,
+    0x7B02,
+    0x3201,
+    0xB2D2,
+    0x7302,
+    0x4A0A,
+    0x6852,
+    0x7D10,
+    0x7D51,
+    0x3205,
+    0x0209,
+    0x4301,
+    0x7C50,
+    0x0400,
+    0x4308,
+    0x7C91,
+    0x0609,
+    0x4301,
+    0x6918,
+    0x1841,
+    0x6119,
+    0x7B18,
+    0x7FD3,
+    0x4298,
+    0x4180,
+    0x4240,
+    0x4770,
+    0xC860,
+    0x4203,
+    0xB530,
+    0x2800,
+    0xD01B,
+    0x4B0E,
+    0x685A,
+    0x7C13,
+    0x7C51,
+    0x3202,
+    0x0209,
+    0x4319,
+    0x7C13,
+    0x041B,
+    0x430B,
+    0x69C1,
+    0x185B,
+    0x61C3,
+    0x7FD1,
+    0x6803,
+    0x000A,
+    0x001C,
+    0x6843,
+    0x001D,
+    0x2300,
+    0x1912,
+    0x416B,
+    0x6002,
+    0x6043,
+    0x2302,
+    0x7E02,
+    0x4313,
+    0x7603,
+    0xBD30,
+    0xC860,
+    0x4203,
+    0xB510,
+    0x2900,
+    0xD001,
+    0x6A0B,
+    0x6003,
+    0xF7FF,
+    0xFF11,
+    0x4B02,
+    0x4A02,
+    0x615A,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F8,
+    0x2401,
+    0x0007,
+    0x0020,
+    0x4D26,
+    0x2200,
+    0x686B,
+    0x0011,
+    0x3301,
+    0x7FDB,
+    0x4098,
+    0xB2C0,
+    0xF7FD,
+    0xFD9E,
+    0x0006,
+    0xF007,
+    0xFA05,
+    0x0030,
+    0xF007,
+    0xFE78,
+    0x6839,
+    0x4B1F,
+    0x680A,
+    0x619A,
+    0x4A1E,
+    0x684E,
+    0x0010,
+    0x30CC,
+    0x6006,
+    0x6889,
+    0x32D0,
+    0x6011,
+    0x686A,
+    0x267F,
+    0x0011,
+    0x323B,
+    0x313A,
+    0x7808,
+    0x7810,
+    0x7809,
+    0x7812,
+    0x4817,
+    0x0212,
+    0x430A,
+    0x605A,
+    0x2240,
+    0x7801,
+    0x4391,
+    0x7001,
+    0x78A8,
+    0x6919,
+    0x4030,
+    0x4302,
+    0x2080,
+    0x43B1,
+    0x430A,
+    0x611A,
+    0x4A10,
+    0x7811,
+    0x6919,
+    0x7812,
+    0x4381,
+    0x0020,
+    0x4390,
+    0x01C2,
+    0x430A,
+    0x611A,
+    0x681A,
+    0x4314,
+    0x601C,
+    0x2300,
+    0x4A0A,
+    0x8013,
+    0x4A0A,
+    0x8013,
+    0x22FF,
+    0x4B09,
+    0x701A,
+    0x78A8,
+    0xF008,
+    0xFE19,
+    0xBDF8,
+    0xC860,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xD000,
+    0x4200,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x6841,
+    0xB510,
+    0x0008,
+    0x4B0B,
+    0x3864,
+    0x685B,
+    0x3301,
+    0x7FDA,
+    0x2300,
+    0xB2D4,
+    0x2A02,
+    0xD801,
+    0x4B07,
+    0x5D1B,
+    0x3164,
+    0x18C9,
+    0xF008,
+    0xFBF8,
+    0x2302,
+    0x4905,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0x1952,
+    0x1003,
+    0x0107,
+    0x4203,
+    0xB510,
+    0x000C,
+    0x0008,
+    0xF7FF,
+    0xFF79,
+    0x0020,
+    0xF7FF,
+    0xFFD8,
+    0xBD10,
+    0x0000,
+    0xB570,
+    0x6843,
+    0x4E12,
+    0x781C,
+    0x68F3,
+    0x0005,
+    0xB2E4,
+    0x2B00,
+    0xD110,
+    0xF7FD,
+    0xFDAD,
+    0x6873,
+    0x4A0E,
+    0x0019,
+    0x18AD,
+    0x312E,
+    0xB2AA,
+    0xB2ED,
+    0x7808,
+    0x332F,
+    0x700D,
+    0x0A12,
+    0x7819,
+    0x701A,
+    0xF008,
+    0xFAEC,
+    0x06A3,
+    0xD509,
+    0x6873,
+    0x06E4,
+    0x7CDA,
+    0x0F64,
+    0x4294,
+    0xD003,
+    0x2201,
+    0xB2E4,
+    0x7432,
+    0x74DC,
+    0xBD70,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0xB510,
+    0x6A01,
+    0x7B8B,
+    0x7BCA,
+    0x0212,
+    0x431A,
+    0x4B06,
+    0x18D2,
+    0x2300,
+    0x001C,
+    0x7B08,
+    0x4298,
+    0xD800,
+    0xBD10,
+    0x0058,
+    0x3301,
+    0x5284,
+    0xB2DB,
+    0xE7F6,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xB086,
+    0x0001,
+    0xA801,
+    0xF7FF,
+    0xFF1B,
+    0x0020,
+    0xA901,
+    0xF7FF,
+    0xFFA9,
+    0x2000,
+    0xB006,
+    0xBD10,
+    0x4B04,
+    0xB510,
+    0x6958,
+    0x4B04,
+    0x4298,
+    0xD001,
+    0xF7FF,
+    0xFFA8,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x2800,
+    0xD019,
+    0x4B0E,
+    0x685B,
+    0x7A19,
+    0x7A5A,
+    0x0212,
+    0x430A,
+    0x7A99,
+    0x0409,
+    0x4311,
+    0x7ADA,
+    0x0612,
+    0x430A,
+    0x7B19,
+    0x7B58,
+    0x0200,
+    0x4308,
+    0x7B99,
+    0x7BDB,
+    0x0409,
+    0x4301,
+    0x061B,
+    0x430B,
+    0x431A,
+    0xD001,
+    0xF7FD,
+    0xFDC5,
+    0x2001,
+    0xBD10,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0xB5F7,
+    0x0005,
+    0xF7FF,
+    0xFE4C,
+    0x6A2B,
+    0x9001,
+    0x7A1A,
+    0x7A5B,
+    0x000F,
+    0x2400,
+    0x429A,
+    0xD104,
+    0xF7FD,
+    0xFDB2,
+    0xBDFE,
+    0x3401,
+    0xB2E4,
+    0x6A28,
+    0x7903,
+    0x42A3,
+    0xD9F6,
+    0x0021,
+    0x3004,
+    0xF001,
+    0xFE23,
+    0x4B0F,
+    0x0006,
+    0x685B,
+    0x0039,
+    0x3302,
+    0x7FDA,
+    0x9801,
+    0x2300,
+    0xB2D2,
+    0xF7FC,
+    0xFA8A,
+    0x4B0A,
+    0x429E,
+    0xD0E7,
+    0x7E6B,
+    0x40D3,
+    0x2201,
+    0x4213,
+    0xD1DF,
+    0x6832,
+    0x6873,
+    0x9901,
+    0x4291,
+    0xD1DD,
+    0x429F,
+    0xD1DB,
+    0x8970,
+    0x4B02,
+    0x18C0,
+    0xE7D6,
+    0x46C0,
+    0xC860,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F8,
+    0x0005,
+    0x2604,
+    0x6A03,
+    0x7A1C,
+    0xB2E4,
+    0x6A28,
+    0x7A43,
+    0x42A3,
+    0xD00C,
+    0x0021,
+    0x3004,
+    0xF001,
+    0xFDF2,
+    0x6802,
+    0x6843,
+    0x682F,
+    0x6869,
+    0x4299,
+    0xD805,
+    0xD101,
+    0x4297,
+    0xD802,
+    0x6A2B,
+    0x721C,
+    0xBDF8,
+    0x7A03,
+    0x3401,
+    0x43B3,
+    0x4333,
+    0x7203,
+    0x6A2B,
+    0xB2E4,
+    0x791B,
+    0x429C,
+    0xD1E1,
+    0x2400,
+    0xE7DF,
+    0xB5F0,
+    0xB095,
+    0x0006,
+    0xAC08,
+    0x2800,
+    0xD143,
+    0x4BD0,
+    0x689B,
+    0x60E3,
+    0x0031,
+    0x0020,
+    0xF7FF,
+    0xFD8D,
+    0x0030,
+    0x68E1,
+    0xF7FF,
+    0xFF6B,
+    0x2301,
+    0x2800,
+    0xD100,
+    0xE161,
+    0x4DC9,
+    0x686B,
+    0x781B,
+    0x069B,
+    0xD516,
+    0x2E00,
+    0xD114,
+    0x68E6,
+    0xF7FD,
+    0xFD3F,
+    0x6807,
+    0x6833,
+    0x2213,
+    0x9301,
+    0x6803,
+    0x0031,
+    0x9302,
+    0x60E0,
+    0xF00D,
+    0xFF35,
+    0x8932,
+    0x9901,
+    0x9802,
+    0xB292,
+    0xF00D,
+    0xFF2F,
+    0x68E3,
+    0x601F,
+    0x2007,
+    0x686A,
+    0x4EBB,
+    0x3201,
+    0x7FD3,
+    0x6971,
+    0x7FD3,
+    0x4381,
+    0x3301,
+    0x4003,
+    0x430B,
+    0x6173,
+    0x7FD0,
+    0x2300,
+    0x3001,
+    0xB2C0,
+    0x2804,
+    0xD80F,
+    0xF7FC,
+    0xF887,
+    0x000B,
+    0x0135,
+    0x0137,
+    0x0139,
+    0x0139,
+    0xF7FF,
+    0xFF52,
+    0x6A33,
+    0x60E0,
+    0x9308,
+    0xE7B8,
+    0x4BAD,
+    0x781B,
+    0xB2DB,
+    0x2000,
+    0xB2D9,
+    0x7671,
+    0x49AB,
+    0x7008,
+    0x7FD1,
+    0x3101,
+    0xB2C9,
+    0x2904,
+    0xD801,
+    0x48A9,
+    0x5C40,
+    0x1A18,
+    0x7FD3,
+    0x2100,
+    0x3301,
+    0xB2DB,
+    0x2B04,
+    0xD801,
+    0x49A5,
+    0x5CC9,
+    0x4341,
+    0x4BA5,
+    0x6019,
+    0x7FD3,
+    0x2B00,
+    0xD105,
+    0x4BA3,
+    0x7819,
+    0x781B,
+    0x49A3,
+    0xB2DB,
+    0x630B,
+    0x7FD3,
+    0x2B01,
+    0xD105,
+    0x4BA1,
+    0x7819,
+    0x781B,
+    0x499E,
+    0xB2DB,
+    0x630B,
+    0x7FD3,
+    0x489E,
+    0x499F,
+    0xB2DF,
+    0x2BFF,
+    0xD000,
+    0xE0FB,
+    0x6A33,
+    0x4003,
+    0x6233,
+    0x780B,
+    0x23F0,
+    0x69F0,
+    0x4398,
+    0x780B,
+    0x011B,
+    0x403B,
+    0x4303,
+    0x61F3,
+    0x7FD1,
+    0x9B08,
+    0xB2C9,
+    0x6818,
+    0xF008,
+    0xFCAA,
+    0x686B,
+    0x7630,
+    0x001A,
+    0x333B,
+    0x323A,
+    0x7812,
+    0x781B,
+    0x021B,
+    0x4313,
+    0x7C22,
+    0x021B,
+    0x4313,
+    0x6273,
+    0x2340,
+    0x2201,
+    0x78A8,
+    0x4303,
+    0x8433,
+    0x6933,
+    0x4393,
+    0x6133,
+    0xF008,
+    0xFC4F,
+    0x9B08,
+    0x68E7,
+    0x681B,
+    0xAE0D,
+    0x9306,
+    0x683B,
+    0x0031,
+    0xA806,
+    0x930D,
+    0xF7FD,
+    0xFCB0,
+    0xF7FD,
+    0xFCA4,
+    0x9A0D,
+    0x4287,
+    0xD000,
+    0xE0D3,
+    0x68EB,
+    0x2B00,
+    0xD100,
+    0xE0CF,
+    0x686B,
+    0x7FDB,
+    0x1E59,
+    0x418B,
+    0x2106,
+    0x3301,
+    0x8139,
+    0x4F6F,
+    0x7879,
+    0x68B8,
+    0x0089,
+    0x430B,
+    0x4978,
+    0x687D,
+    0x4288,
+    0xD016,
+    0x0029,
+    0x3168,
+    0x7808,
+    0x3101,
+    0x7809,
+    0x0209,
+    0x4301,
+    0x0028,
+    0x306A,
+    0x7800,
+    0x0400,
+    0x4308,
+    0x0029,
+    0x316B,
+    0x7809,
+    0x0609,
+    0x4301,
+    0x9806,
+    0x4281,
+    0xD002,
+    0x2120,
+    0x438B,
+    0x430B,
+    0x68F9,
+    0x68E4,
+    0x8013,
+    0x2900,
+    0xD000,
+    0xE0A6,
+    0x782B,
+    0x069B,
+    0xD400,
+    0xE07E,
+    0x2704,
+    0x2301,
+    0x70B7,
+    0x8033,
+    0x8923,
+    0x0028,
+    0x3B06,
+    0xB2DB,
+    0x70F3,
+    0x6822,
+    0x3058,
+    0x19D2,
+    0x6072,
+    0x002A,
+    0x3248,
+    0x60B2,
+    0x6822,
+    0x9001,
+    0x3206,
+    0x189B,
+    0x60F3,
+    0x9B08,
+    0x6132,
+    0x6172,
+    0x61B0,
+    0x9303,
+    0x7A2B,
+    0x7A6A,
+    0x0212,
+    0x431A,
+    0x7AAB,
+    0x041B,
+    0x4313,
+    0x7AEA,
+    0x0612,
+    0x431A,
+    0x7B2B,
+    0x7B68,
+    0x0200,
+    0x4318,
+    0x7BAB,
+    0x041B,
+    0x4303,
+    0x7BE8,
+    0x0600,
+    0x4303,
+    0x1CA8,
+    0x7FC0,
+    0xB2C0,
+    0xF00D,
+    0xFE80,
+    0x002B,
+    0x9006,
+    0x9107,
+    0x3340,
+    0x781A,
+    0x3301,
+    0x781B,
+    0x9102,
+    0x021B,
+    0x4313,
+    0x002A,
+    0x3242,
+    0x7812,
+    0xA906,
+    0x0412,
+    0x431A,
+    0x002B,
+    0x3343,
+    0x781B,
+    0x9801,
+    0x061B,
+    0x4313,
+    0x9A03,
+    0x6812,
+    0x4053,
+    0x2205,
+    0x9305,
+    0xF00D,
+    0xFE1B,
+    0x2380,
+    0x002A,
+    0x0028,
+    0x9902,
+    0x425B,
+    0x430B,
+    0x325C,
+    0x7013,
+    0xA905,
+    0x003A,
+    0x305D,
+    0xF00D,
+    0xFE0E,
+    0x0028,
+    0x0029,
+    0x003A,
+    0x3144,
+    0x3061,
+    0xF00D,
+    0xFE07,
+    0x213C,
+    0x6822,
+    0x0030,
+    0x8893,
+    0xB29C,
+    0x438B,
+    0x8093,
+    0xF00A,
+    0xF9C4,
+    0x4A30,
+    0x6B53,
+    0x423B,
+    0xD0FC,
+    0x0A23,
+    0x9A0B,
+    0x3304,
+    0xB2E1,
+    0x021B,
+    0x6810,
+    0x430B,
+    0xB29B,
+    0x8083,
+    0x8913,
+    0x8913,
+    0x3304,
+    0xB29B,
+    0x8113,
+    0x9909,
+    0x980B,
+    0xF00D,
+    0xFF52,
+    0x2300,
+    0x0018,
+    0xB015,
+    0xBDF0,
+    0x4B24,
+    0xE6D4,
+    0x4B24,
+    0xE6D2,
+    0x4B24,
+    0xE6D0,
+    0x4B24,
+    0x781F,
+    0x6A37,
+    0x781B,
+    0x4038,
+    0x1E5F,
+    0x41BB,
+    0x041B,
+    0x4303,
+    0x6233,
+    0x780B,
+    0x23F0,
+    0x69F0,
+    0x4398,
+    0x780B,
+    0x091B,
+    0x011B,
+    0xE6FB,
+    0x21FC,
+    0x8813,
+    0x438B,
+    0xE732,
+    0x3502,
+    0x7B0A,
+    0x7FEB,
+    0x429A,
+    0xD2D6,
+    0xF7FD,
+    0xFBC1,
+    0x42A0,
+    0xD1D2,
+    0x2101,
+    0x68FA,
+    0x7B10,
+    0x7E53,
+    0x4081,
+    0x430B,
+    0xB2DB,
+    0x7653,
+    0xE7C9,
+    0xC860,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024C,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x195A,
+    0x1003,
+    0x1955,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x0133,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0000,
+    0x4201,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x024F,
+    0x4203,
+    0x025C,
+    0x4203,
+    0x8843,
+    0x0049,
+    0x18C9,
+    0x4B02,
+    0x18C9,
+    0x8808,
+    0x18C0,
+    0x4770,
+    0x8000,
+    0x4203,
+    0x8843,
+    0x0052,
+    0x4803,
+    0x18D2,
+    0x4B03,
+    0x1809,
+    0xB289,
+    0x18D2,
+    0x8011,
+    0x4770,
+    0x8000,
+    0xFFFF,
+    0x8000,
+    0x4203,
+    0x4B05,
+    0x4A06,
+    0x881B,
+    0x0040,
+    0x189B,
+    0x881B,
+    0x18C0,
+    0x4B04,
+    0x18C0,
+    0x8800,
+    0x18C0,
+    0x4770,
+    0x010A,
+    0x4203,
+    0x8002,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x4B06,
+    0x4A07,
+    0x881B,
+    0x189B,
+    0x881A,
+    0x4B06,
+    0x7B5B,
+    0x005B,
+    0x189B,
+    0x4A05,
+    0x189B,
+    0x8818,
+    0x1880,
+    0x4770,
+    0x010A,
+    0x4203,
+    0x8002,
+    0x4203,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F7,
+    0x2218,
+    0x8906,
+    0x4F18,
+    0xB2B3,
+    0x9301,
+    0x4B17,
+    0x0005,
+    0x18F6,
+    0x7834,
+    0x883B,
+    0x4354,
+    0x18E4,
+    0x4B15,
+    0x18E3,
+    0x6019,
+    0x6C43,
+    0x001A,
+    0x9300,
+    0xF000,
+    0xFF87,
+    0x4912,
+    0x9B01,
+    0x468C,
+    0x4A11,
+    0x4463,
+    0x6819,
+    0x696B,
+    0x8815,
+    0x4A10,
+    0x18A4,
+    0x6822,
+    0x9C00,
+    0x191B,
+    0x1B5B,
+    0x1A5B,
+    0x1A9B,
+    0x1A1B,
+    0x2018,
+    0x7832,
+    0x8839,
+    0x4342,
+    0x480A,
+    0x1809,
+    0x1852,
+    0x7812,
+    0x4909,
+    0x1852,
+    0x0092,
+    0x6013,
+    0xBDF7,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8007,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB570,
+    0x6F8D,
+    0x694B,
+    0x68C1,
+    0x0004,
+    0x1A51,
+    0x79C0,
+    0x1949,
+    0x18C9,
+    0xB2C0,
+    0xF00A,
+    0xF84C,
+    0x2304,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0xBD70,
+    0xB5F7,
+    0x4D32,
+    0x0006,
+    0x7B6B,
+    0x9301,
+    0x7BAF,
+    0x2F00,
+    0xD12E,
+    0xF7FF,
+    0xFF8A,
+    0x0004,
+    0x2E00,
+    0xD00C,
+    0x0003,
+    0x332C,
+    0x781B,
+    0x7C82,
+    0x3301,
+    0x4293,
+    0xDA05,
+    0x9B01,
+    0x736B,
+    0xE01D,
+    0xF7FF,
+    0xFF7B,
+    0x0004,
+    0x4B26,
+    0x429C,
+    0xD014,
+    0x0020,
+    0xF000,
+    0xFFB6,
+    0x2800,
+    0xD004,
+    0x2E00,
+    0xD010,
+    0x2F00,
+    0xD1ED,
+    0x0037,
+    0x7B6B,
+    0x4A20,
+    0x3301,
+    0xB2DB,
+    0x736B,
+    0x8812,
+    0x491F,
+    0x1852,
+    0x7812,
+    0x4293,
+    0xD1E4,
+    0x4C1A,
+    0x2E00,
+    0xD1DE,
+    0x0020,
+    0xBDFE,
+    0x4B19,
+    0x4A19,
+    0x881B,
+    0x189B,
+    0x781F,
+    0xB2FF,
+    0x2800,
+    0xD002,
+    0x9B01,
+    0x3301,
+    0x736B,
+    0x7B6B,
+    0x42BB,
+    0xD101,
+    0x2300,
+    0x736B,
+    0xF7FF,
+    0xFF4B,
+    0x2300,
+    0x0004,
+    0x9300,
+    0x9B00,
+    0x42BB,
+    0xD0E2,
+    0x7B6B,
+    0x42BB,
+    0xD0DF,
+    0x0020,
+    0xF000,
+    0xFF81,
+    0x2800,
+    0xD1DB,
+    0x7B6B,
+    0x3301,
+    0xB2DB,
+    0x42BB,
+    0xD100,
+    0x0003,
+    0x736B,
+    0x9B00,
+    0x3301,
+    0xB2DB,
+    0x9300,
+    0xF7FF,
+    0xFF30,
+    0x0004,
+    0xE7E5,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x010A,
+    0x4203,
+    0x8001,
+    0x4203,
+    0xB510,
+    0x4B0B,
+    0x4A0B,
+    0x881B,
+    0x189B,
+    0x781B,
+    0x2B00,
+    0xD00D,
+    0x2000,
+    0xF7FF,
+    0xFF09,
+    0x4B08,
+    0x8902,
+    0x18D3,
+    0x6819,
+    0x6943,
+    0x6C40,
+    0x181B,
+    0x1A5B,
+    0x4905,
+    0x1852,
+    0x6013,
+    0xBD10,
+    0x46C0,
+    0x010A,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8010,
+    0x4203,
+    0xB570,
+    0x0005,
+    0x2400,
+    0x4B08,
+    0x4A08,
+    0x881B,
+    0x189B,
+    0x781B,
+    0x429C,
+    0xD300,
+    0xBD70,
+    0x0020,
+    0xF7FF,
+    0xFEE6,
+    0x3401,
+    0x0029,
+    0xF001,
+    0xFACA,
+    0xB2E4,
+    0xE7EE,
+    0x010A,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x4B05,
+    0xB510,
+    0x881C,
+    0x2318,
+    0x4358,
+    0x4B04,
+    0x18E4,
+    0x1900,
+    0xF008,
+    0xFD88,
+    0xBD10,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F7,
+    0x0006,
+    0x000F,
+    0x2500,
+    0x9200,
+    0x9301,
+    0x4B16,
+    0x4A17,
+    0x881C,
+    0x4B17,
+    0x1964,
+    0x18E3,
+    0x18A2,
+    0x881B,
+    0x7812,
+    0xB29B,
+    0x2AFF,
+    0xD01A,
+    0x4A13,
+    0x18A2,
+    0x7812,
+    0x2A16,
+    0xD115,
+    0x4A12,
+    0x1898,
+    0x4286,
+    0xD011,
+    0x4A11,
+    0x189B,
+    0x781B,
+    0x2B00,
+    0xD00C,
+    0x2100,
+    0xF7FF,
+    0xFE91,
+    0x3026,
+    0x7803,
+    0x429F,
+    0xD105,
+    0x4B0A,
+    0x9A01,
+    0x9900,
+    0x18E0,
+    0xF008,
+    0xFD55,
+    0x23C0,
+    0x3518,
+    0x005B,
+    0x429D,
+    0xD1D3,
+    0xBDF7,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8001,
+    0x4203,
+    0xB5F0,
+    0x0004,
+    0x4D36,
+    0x4B37,
+    0x8828,
+    0xB087,
+    0x1A20,
+    0x18C0,
+    0x2118,
+    0xF7FB,
+    0xFD73,
+    0x210F,
+    0x2200,
+    0x4001,
+    0xA802,
+    0xF008,
+    0xFD3D,
+    0xAB02,
+    0x7819,
+    0x2318,
+    0x434B,
+    0x882A,
+    0x492E,
+    0x4D2F,
+    0x1852,
+    0x189B,
+    0x781B,
+    0x4A2E,
+    0x4E2E,
+    0x189B,
+    0x4A2E,
+    0x009B,
+    0x681B,
+    0x8812,
+    0x9001,
+    0x18D3,
+    0x9300,
+    0x8963,
+    0x602C,
+    0x2400,
+    0x4A2A,
+    0x736C,
+    0x606E,
+    0x189A,
+    0x7812,
+    0x746C,
+    0x73AA,
+    0x4A28,
+    0x61AC,
+    0x7812,
+    0x4827,
+    0x4F28,
+    0x73EA,
+    0x1819,
+    0x883A,
+    0x7809,
+    0x1812,
+    0xB2C9,
+    0x7011,
+    0x883A,
+    0x4924,
+    0x1852,
+    0x185B,
+    0x8810,
+    0x8819,
+    0x4A20,
+    0x883B,
+    0x1980,
+    0x189B,
+    0x781A,
+    0x1989,
+    0x0052,
+    0xF00D,
+    0xFBBC,
+    0x9B05,
+    0x616B,
+    0x883B,
+    0x4A1A,
+    0x189B,
+    0x781B,
+    0x429C,
+    0xD30B,
+    0x2000,
+    0xF7FF,
+    0xFEB5,
+    0x2300,
+    0x42B0,
+    0xD002,
+    0xF000,
+    0xFF9A,
+    0x2301,
+    0x0018,
+    0xB007,
+    0xBDF0,
+    0x0020,
+    0xF7FF,
+    0xFE2B,
+    0x9B01,
+    0x0005,
+    0x2B00,
+    0xD002,
+    0x9904,
+    0xF001,
+    0xFA0C,
+    0x0028,
+    0x9900,
+    0x3401,
+    0xF000,
+    0xFE39,
+    0xB2E4,
+    0xE7DC,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0xC878,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x8000,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x0109,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x010A,
+    0x4203,
+    0x8002,
+    0x4203,
+    0xB5F0,
+    0x2708,
+    0x2400,
+    0x8943,
+    0xB087,
+    0xB29A,
+    0x9200,
+    0x4A20,
+    0xA802,
+    0x189E,
+    0x7832,
+    0x0025,
+    0x43BA,
+    0x433A,
+    0x7032,
+    0x4A1D,
+    0x189B,
+    0x7819,
+    0x2200,
+    0xB2C9,
+    0xF008,
+    0xFCB0,
+    0x9001,
+    0x9B00,
+    0x4A19,
+    0x189B,
+    0x781B,
+    0x429D,
+    0xD313,
+    0x2208,
+    0x7833,
+    0x4393,
+    0x7033,
+    0x2C00,
+    0xD008,
+    0x0020,
+    0xF000,
+    0xFE41,
+    0x2800,
+    0xD103,
+    0x0020,
+    0x9905,
+    0xF7FF,
+    0xFE00,
+    0xF7FF,
+    0xFEC2,
+    0x2001,
+    0xB007,
+    0xBDF0,
+    0x0029,
+    0x0030,
+    0xF7FF,
+    0xFDB7,
+    0x9B01,
+    0x0004,
+    0x2B00,
+    0xD002,
+    0x9904,
+    0xF001,
+    0xF9B0,
+    0x0023,
+    0x3324,
+    0x781B,
+    0x423B,
+    0xD002,
+    0x0020,
+    0xF001,
+    0xF98C,
+    0x3501,
+    0xB2ED,
+    0xE7CF,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x8007,
+    0x4203,
+    0x8001,
+    0x4203,
+    0xB5F0,
+    0x0004,
+    0x2500,
+    0x2618,
+    0x6843,
+    0x4A20,
+    0x895B,
+    0xB085,
+    0x189A,
+    0x9203,
+    0x4A1E,
+    0x189B,
+    0x781B,
+    0xB2DB,
+    0x9302,
+    0x9B02,
+    0x429D,
+    0xD101,
+    0xB005,
+    0xBDF0,
+    0x0029,
+    0x9803,
+    0xF7FF,
+    0xFD86,
+    0x68A1,
+    0x9001,
+    0xF001,
+    0xF982,
+    0x2D00,
+    0xD123,
+    0x7823,
+    0x4F15,
+    0x4373,
+    0x883A,
+    0x4914,
+    0x9801,
+    0x1852,
+    0x189B,
+    0x2201,
+    0x781B,
+    0x409A,
+    0x4B12,
+    0x645A,
+    0x68E1,
+    0xF7FF,
+    0xFDB0,
+    0x0033,
+    0x7820,
+    0x883A,
+    0x4343,
+    0x490C,
+    0x1852,
+    0x189B,
+    0x781B,
+    0x4A0C,
+    0x189B,
+    0x4A0C,
+    0x009B,
+    0x681B,
+    0x8811,
+    0x6862,
+    0x6852,
+    0x1889,
+    0x18C9,
+    0xF009,
+    0xFE38,
+    0x3501,
+    0xB2ED,
+    0xE7C9,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0xB510,
+    0x4B03,
+    0x6098,
+    0xF007,
+    0xFEBB,
+    0x2000,
+    0xBD10,
+    0x46C0,
+    0xC878,
+    0x4203,
+    0xB510,
+    0x4B03,
+    0x7BDA,
+    0x4B03,
+    0x701A,
+    0xF008,
+    0xFEE1,
+    0xBD10,
+    0xC878,
+    0x4203,
+    0x0109,
+    0x4203,
+    0xB570,
+    0x000E,
+    0x0005,
+    0xF7FF,
+    0xFD59,
+    0x0031,
+    0x0004,
+    0x47A8,
+    0x2800,
+    0xD03D,
+    0x0020,
+    0xF001,
+    0xF81F,
+    0x0023,
+    0x3324,
+    0x781B,
+    0x065B,
+    0xD502,
+    0x0020,
+    0xF001,
+    0xF8B3,
+    0x4D1D,
+    0x7BAB,
+    0x2B01,
+    0xD102,
+    0x7B6B,
+    0x3301,
+    0x736B,
+    0x2000,
+    0xF7FF,
+    0xFDAB,
+    0x4B19,
+    0x4298,
+    0xD122,
+    0x0020,
+    0xF000,
+    0xFD8A,
+    0x2800,
+    0xD117,
+    0x0020,
+    0x6969,
+    0xF7FF,
+    0xFD49,
+    0x7C6B,
+    0x2B00,
+    0xD010,
+    0x0023,
+    0x3326,
+    0x781E,
+    0x69AA,
+    0xB2F6,
+    0x0030,
+    0x6969,
+    0xF7FF,
+    0xFE39,
+    0x4B0D,
+    0x8920,
+    0x0031,
+    0x18C0,
+    0x696A,
+    0x69AB,
+    0xF7FF,
+    0xFE41,
+    0xF7FF,
+    0xFDF7,
+    0x2001,
+    0xF7FF,
+    0xFFB0,
+    0xE001,
+    0xF000,
+    0xFE6D,
+    0xBD70,
+    0x2001,
+    0xF7FF,
+    0xFD7F,
+    0x0001,
+    0x0020,
+    0xF000,
+    0xFF5D,
+    0xE7F6,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x4B03,
+    0x0001,
+    0x0018,
+    0xF7FF,
+    0xFFA6,
+    0xBD10,
+    0x46C0,
+    0x4E6D,
+    0x1002,
+    0xB510,
+    0x4B03,
+    0x0001,
+    0x0018,
+    0xF7FF,
+    0xFF9C,
+    0xBD10,
+    0x46C0,
+    0x4EA1,
+    0x1002,
+    0xB5F0,
+    0x0004,
+    0x2000,
+    0x784A,
+    0xB085,
+    0xB2D3,
+    0x9301,
+    0x4B4C,
+    0x000D,
+    0x881B,
+    0x494B,
+    0x0006,
+    0x185B,
+    0x781B,
+    0x429A,
+    0xD10B,
+    0xB005,
+    0xBDF0,
+    0x0031,
+    0x0028,
+    0xF7FF,
+    0xFCB6,
+    0x6962,
+    0x6943,
+    0x429A,
+    0xD85F,
+    0x3601,
+    0xB2F6,
+    0x9B01,
+    0x42B3,
+    0xD1F2,
+    0x0032,
+    0x0021,
+    0x0028,
+    0xF7FF,
+    0xFCB2,
+    0x0029,
+    0x0020,
+    0xF000,
+    0xFCA0,
+    0x9B01,
+    0x3301,
+    0xB2DB,
+    0x706B,
+    0x0023,
+    0x3326,
+    0x7819,
+    0x4B3A,
+    0x881A,
+    0x2318,
+    0x434B,
+    0x189B,
+    0x4A38,
+    0x9301,
+    0x189B,
+    0x881B,
+    0xB29A,
+    0x9203,
+    0x0022,
+    0x327C,
+    0x8812,
+    0xB292,
+    0x9202,
+    0x4A34,
+    0x9902,
+    0x189B,
+    0x881F,
+    0xB2BF,
+    0x0038,
+    0xF7FD,
+    0xF812,
+    0x1E06,
+    0xD11E,
+    0x0039,
+    0x9802,
+    0xF7FD,
+    0xF809,
+    0x4A2E,
+    0x9B03,
+    0x4694,
+    0x4A2D,
+    0x4463,
+    0x4694,
+    0x681F,
+    0x9B01,
+    0x0021,
+    0x4463,
+    0x681B,
+    0x3124,
+    0x4343,
+    0x1AFF,
+    0x2304,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0x782B,
+    0x075B,
+    0xD418,
+    0x003A,
+    0x0021,
+    0x0028,
+    0xF7FF,
+    0xFCE8,
+    0x2001,
+    0xE7A5,
+    0x1E7B,
+    0xB2DB,
+    0x0019,
+    0x0028,
+    0x9302,
+    0xF7FF,
+    0xFC5B,
+    0x003A,
+    0x0001,
+    0x0028,
+    0xF7FF,
+    0xFC60,
+    0x9F02,
+    0x42BE,
+    0xD3F0,
+    0xE7A4,
+    0x9F01,
+    0xE7FA,
+    0x786B,
+    0xB2DA,
+    0x9201,
+    0x2B01,
+    0xD912,
+    0x0031,
+    0x0028,
+    0xF7FF,
+    0xFC47,
+    0x4284,
+    0xD011,
+    0x6C45,
+    0x6942,
+    0x6963,
+    0x18AD,
+    0x1AED,
+    0x0020,
+    0xF000,
+    0xFC9D,
+    0x6465,
+    0x0020,
+    0x6325,
+    0xF000,
+    0xFC9C,
+    0x0039,
+    0x0020,
+    0xF001,
+    0xF826,
+    0xE7CE,
+    0x3601,
+    0x9B01,
+    0xB2F6,
+    0x42B3,
+    0xD1E2,
+    0xE7F4,
+    0x46C0,
+    0x010A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8024,
+    0x4203,
+    0x8054,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xB5F0,
+    0x2400,
+    0x784B,
+    0xB085,
+    0x000D,
+    0x9002,
+    0xB2DF,
+    0x42A3,
+    0xD102,
+    0x2000,
+    0xB005,
+    0xBDF0,
+    0x0021,
+    0x0028,
+    0xF7FF,
+    0xFC0E,
+    0x9B02,
+    0x4298,
+    0xD004,
+    0x3401,
+    0xB2E4,
+    0x42BC,
+    0xD1F4,
+    0xE7F0,
+    0x42A7,
+    0xD0EE,
+    0x1C63,
+    0xB2DB,
+    0x001E,
+    0x9301,
+    0x1E73,
+    0xB2DB,
+    0x9303,
+    0x42BE,
+    0xD31D,
+    0x9B01,
+    0x1E7E,
+    0x2200,
+    0xB2F6,
+    0x42BB,
+    0xD800,
+    0x1B32,
+    0x18A2,
+    0x0028,
+    0x4910,
+    0xB2D2,
+    0xF7FF,
+    0xFBF8,
+    0x2102,
+    0x9B02,
+    0x706E,
+    0x3324,
+    0x781A,
+    0x2001,
+    0x438A,
+    0x701A,
+    0x781A,
+    0x3106,
+    0x438A,
+    0x701A,
+    0x781A,
+    0x3904,
+    0x438A,
+    0x701A,
+    0xE7C8,
+    0x0031,
+    0x0028,
+    0xF7FF,
+    0xFBD9,
+    0x3601,
+    0x0001,
+    0x9A03,
+    0x0028,
+    0xF7FF,
+    0xFBDD,
+    0xB2F6,
+    0xE7D0,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0xB5F0,
+    0x2400,
+    0x2704,
+    0xB085,
+    0x9001,
+    0x9102,
+    0x9203,
+    0x4A15,
+    0x4915,
+    0x8813,
+    0x185B,
+    0x781B,
+    0x429C,
+    0xD301,
+    0xB005,
+    0xBDF0,
+    0x8813,
+    0x4A12,
+    0x9901,
+    0x189B,
+    0x881A,
+    0x0063,
+    0x189B,
+    0x4A10,
+    0x189B,
+    0x881D,
+    0xB2AE,
+    0x18AD,
+    0x0028,
+    0x9A02,
+    0xF000,
+    0xFBB8,
+    0x2800,
+    0xD00B,
+    0x4B08,
+    0x4A0A,
+    0x18F6,
+    0x8830,
+    0x1880,
+    0x7803,
+    0x423B,
+    0xD103,
+    0x0029,
+    0x9A03,
+    0xF7FF,
+    0xFC24,
+    0x3401,
+    0xB2E4,
+    0xE7D5,
+    0x46C0,
+    0x010A,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x4B05,
+    0xB510,
+    0x699A,
+    0x6158,
+    0x1852,
+    0x619A,
+    0x2201,
+    0x0008,
+    0x745A,
+    0xF7FF,
+    0xFCAD,
+    0xBD10,
+    0xC878,
+    0x4203,
+    0xB570,
+    0x0004,
+    0x34A0,
+    0x2900,
+    0xD001,
+    0x3080,
+    0x0004,
+    0x6820,
+    0x6861,
+    0x7D22,
+    0x2300,
+    0xB2D2,
+    0xF7FB,
+    0xFBF8,
+    0x7D65,
+    0x3D01,
+    0x002A,
+    0x17EB,
+    0x1812,
+    0x414B,
+    0x60A2,
+    0x60E3,
+    0xBD70,
+    0x0002,
+    0xB570,
+    0x32A0,
+    0x2900,
+    0xD000,
+    0x3A20,
+    0x0015,
+    0x7C13,
+    0x3510,
+    0xB2D9,
+    0x2BFF,
+    0xD020,
+    0x0003,
+    0x332C,
+    0x781E,
+    0x7C84,
+    0x23FF,
+    0x3C01,
+    0x42A6,
+    0xD006,
+    0x7C93,
+    0x18CB,
+    0x7C81,
+    0xB2DB,
+    0x428B,
+    0xD300,
+    0x23FF,
+    0x0010,
+    0x702B,
+    0x7DD3,
+    0x3017,
+    0x3B01,
+    0xB2DB,
+    0x2B00,
+    0xD108,
+    0x7D91,
+    0xB2CB,
+    0x2900,
+    0xD004,
+    0x3B01,
+    0xB2DB,
+    0x7593,
+    0x7D13,
+    0xB2DB,
+    0x7003,
+    0xBD70,
+    0x0003,
+    0xB5F0,
+    0x3324,
+    0x781A,
+    0x0004,
+    0x2101,
+    0xB085,
+    0x0792,
+    0xD529,
+    0x781A,
+    0x0892,
+    0x0010,
+    0x4008,
+    0x9000,
+    0x420A,
+    0xD022,
+    0x781A,
+    0x08D2,
+    0x420A,
+    0xD10A,
+    0x0021,
+    0x317E,
+    0x8808,
+    0xB282,
+    0x2800,
+    0xD115,
+    0x2208,
+    0x7819,
+    0x4391,
+    0x430A,
+    0x701A,
+    0x2180,
+    0x781A,
+    0x0026,
+    0x438A,
+    0x701A,
+    0x0023,
+    0x2200,
+    0x332C,
+    0x701A,
+    0x36B4,
+    0x7833,
+    0x4293,
+    0xD037,
+    0x0025,
+    0x9201,
+    0x35A0,
+    0xE00B,
+    0x3A01,
+    0xB293,
+    0x800B,
+    0x2300,
+    0x9300,
+    0x9800,
+    0xB005,
+    0xBDF0,
+    0x0025,
+    0x9B00,
+    0x3580,
+    0x9301,
+    0x7C6B,
+    0x6828,
+    0x6869,
+    0x7832,
+    0xB2DB,
+    0x9302,
+    0xB2D2,
+    0x2300,
+    0xF7FB,
+    0xFB7B,
+    0x7CAB,
+    0xB2D7,
+    0x435A,
+    0x9B02,
+    0x189A,
+    0xB2D2,
+    0x742A,
+    0x6822,
+    0x6863,
+    0x6828,
+    0x6869,
+    0x9202,
+    0x9303,
+    0x7832,
+    0x2300,
+    0xB2D2,
+    0xF7FB,
+    0xFB69,
+    0x9B02,
+    0x1A18,
+    0xB2C0,
+    0x75A8,
+    0x2F00,
+    0xD101,
+    0x7837,
+    0xB2FF,
+    0x9B01,
+    0x75EF,
+    0x2B01,
+    0xD0D0,
+    0x0026,
+    0x3694,
+    0x7833,
+    0x2B00,
+    0xD0CB,
+    0xE7CD,
+    0x0003,
+    0xB510,
+    0x339C,
+    0x7819,
+    0x3098,
+    0xB2C9,
+    0xF000,
+    0xFEDD,
+    0xBD10,
+    0xB5F7,
+    0x0004,
+    0x0023,
+    0x000E,
+    0x4D08,
+    0x334A,
+    0x6068,
+    0x4F08,
+    0x6841,
+    0x6800,
+    0x69A2,
+    0x881B,
+    0x342C,
+    0x0031,
+    0x19DB,
+    0x9400,
+    0xB280,
+    0xF7FC,
+    0xFEE9,
+    0x7328,
+    0xBDF7,
+    0x46C0,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F8,
+    0x0003,
+    0x2501,
+    0x332A,
+    0x781B,
+    0x4A31,
+    0xB2DB,
+    0x7013,
+    0x0004,
+    0x7A83,
+    0x0028,
+    0x071B,
+    0x0F9B,
+    0x4098,
+    0x2200,
+    0xB2C0,
+    0x0011,
+    0xF7FC,
+    0xFD13,
+    0x0006,
+    0xF006,
+    0xF97A,
+    0x0030,
+    0xF006,
+    0xFDED,
+    0x69A2,
+    0x4B27,
+    0x4F28,
+    0x619A,
+    0x4A28,
+    0x69E0,
+    0x0011,
+    0x31CC,
+    0x6008,
+    0x6A21,
+    0x32D0,
+    0x6011,
+    0x2118,
+    0x3426,
+    0x7822,
+    0x4823,
+    0x434A,
+    0x8806,
+    0x19F6,
+    0x1992,
+    0x8812,
+    0x4E21,
+    0x1996,
+    0x7836,
+    0x4E21,
+    0x1992,
+    0x8812,
+    0x7824,
+    0x8802,
+    0x4361,
+    0x19D2,
+    0x1852,
+    0x8811,
+    0x4E1B,
+    0x247F,
+    0x198A,
+    0x4E1B,
+    0x7812,
+    0x1989,
+    0x8809,
+    0x0412,
+    0x430A,
+    0x605A,
+    0x2240,
+    0x4818,
+    0x7801,
+    0x4391,
+    0x7001,
+    0x4817,
+    0x6919,
+    0x7B00,
+    0x43A1,
+    0x4020,
+    0x4302,
+    0x2080,
+    0x430A,
+    0x611A,
+    0x4A13,
+    0x7811,
+    0x6919,
+    0x7812,
+    0x4381,
+    0x0028,
+    0x4390,
+    0x01C2,
+    0x430A,
+    0x611A,
+    0x681A,
+    0x4315,
+    0x601D,
+    0x2300,
+    0x4A0D,
+    0x8013,
+    0x4A0D,
+    0x8013,
+    0x22FF,
+    0x4B0D,
+    0x701A,
+    0xBDF8,
+    0x0109,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x800A,
+    0x4203,
+    0xD000,
+    0x4200,
+    0x021C,
+    0x4203,
+    0x801A,
+    0x4203,
+    0x8018,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0xC878,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0xB570,
+    0x2303,
+    0x7A81,
+    0x0005,
+    0x2007,
+    0x4C31,
+    0x4019,
+    0x6963,
+    0x1C4A,
+    0x4383,
+    0x4313,
+    0x6163,
+    0x2A02,
+    0xD052,
+    0x1E8B,
+    0x2B01,
+    0xD84D,
+    0x4B2C,
+    0x2600,
+    0x781B,
+    0xB2DB,
+    0xB2D8,
+    0x7660,
+    0x482A,
+    0x7006,
+    0x482A,
+    0x4E2A,
+    0x5C80,
+    0x1A1B,
+    0x482A,
+    0x5C80,
+    0x4343,
+    0x6033,
+    0x2A01,
+    0xD13F,
+    0x4B28,
+    0x781A,
+    0x781B,
+    0x4A27,
+    0xB2DB,
+    0x6313,
+    0x4B27,
+    0x4827,
+    0x781A,
+    0x6A22,
+    0x781B,
+    0x4002,
+    0x1E58,
+    0x4183,
+    0x20F0,
+    0x041B,
+    0x4313,
+    0x6223,
+    0x4B23,
+    0x781A,
+    0x69E2,
+    0x781B,
+    0x4382,
+    0x091B,
+    0x011B,
+    0x4313,
+    0x61E3,
+    0x69A8,
+    0xF007,
+    0xFD65,
+    0x4B1E,
+    0x7620,
+    0x3526,
+    0x7829,
+    0x881A,
+    0x2318,
+    0x434B,
+    0x491B,
+    0x1852,
+    0x189B,
+    0x881A,
+    0x4B1A,
+    0x491B,
+    0x18D3,
+    0x781B,
+    0x1852,
+    0x8812,
+    0x041B,
+    0x4313,
+    0x6263,
+    0x4B18,
+    0x7B1A,
+    0x2340,
+    0x4313,
+    0x2201,
+    0x8423,
+    0x6923,
+    0x4393,
+    0x6123,
+    0xBD70,
+    0x4B14,
+    0xE7B0,
+    0x4B14,
+    0xE7AE,
+    0x2A02,
+    0xD1C3,
+    0x4B13,
+    0xE7BC,
+    0x46C0,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x1971,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x196C,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x801A,
+    0x4203,
+    0x8018,
+    0x4203,
+    0xC878,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x0003,
+    0xB510,
+    0x3324,
+    0x781B,
+    0x0004,
+    0x079B,
+    0xD50A,
+    0xF7FF,
+    0xFEC4,
+    0x2304,
+    0x7A02,
+    0x439A,
+    0x4313,
+    0x7203,
+    0x0020,
+    0x3098,
+    0xF000,
+    0xFDAE,
+    0xBD10,
+    0x0000,
+    0x0003,
+    0x0002,
+    0xB5F0,
+    0x339C,
+    0xB085,
+    0x329D,
+    0x9301,
+    0x9200,
+    0x781B,
+    0x7812,
+    0x0004,
+    0x429A,
+    0xD107,
+    0x4D21,
+    0x4B21,
+    0x3448,
+    0x18ED,
+    0xB2AD,
+    0x8025,
+    0xB005,
+    0xBDF0,
+    0x0003,
+    0x3380,
+    0x681E,
+    0x685F,
+    0xF7FF,
+    0xFE9E,
+    0x6822,
+    0x6863,
+    0x9202,
+    0x9303,
+    0x0023,
+    0x3394,
+    0x781A,
+    0x0005,
+    0xB2D3,
+    0x469C,
+    0x9A02,
+    0x9B03,
+    0x2001,
+    0x2100,
+    0x1880,
+    0x4159,
+    0x4662,
+    0x2300,
+    0xF00C,
+    0xFF3B,
+    0x42B0,
+    0xD101,
+    0x42B9,
+    0xD0D9,
+    0x682A,
+    0x686B,
+    0x42BB,
+    0xD8D5,
+    0xD101,
+    0x42B2,
+    0xD8D2,
+    0x682A,
+    0x686B,
+    0x429F,
+    0xD802,
+    0xD1CE,
+    0x4296,
+    0xD9CC,
+    0x0020,
+    0xF7FF,
+    0xFFA8,
+    0x9B01,
+    0x9A00,
+    0x781B,
+    0x7812,
+    0x429A,
+    0xD0C2,
+    0x0020,
+    0xF7FF,
+    0xFE6C,
+    0x0005,
+    0xE7EA,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0xB570,
+    0x0004,
+    0x2900,
+    0xD001,
+    0xF7FF,
+    0xFF92,
+    0x0025,
+    0x2001,
+    0x2100,
+    0x3580,
+    0x682A,
+    0x686B,
+    0x1812,
+    0x414B,
+    0x0020,
+    0x602A,
+    0x606B,
+    0x2101,
+    0xF7FF,
+    0xFDB9,
+    0x0022,
+    0x2001,
+    0x3227,
+    0x7813,
+    0x7813,
+    0x7811,
+    0x3301,
+    0x4381,
+    0x4003,
+    0x430B,
+    0x0020,
+    0x7013,
+    0xF7FF,
+    0xFF8A,
+    0xBD70,
+    0x0000,
+    0xB5F0,
+    0x2518,
+    0x4E3E,
+    0x4A3F,
+    0x8833,
+    0xB087,
+    0x189B,
+    0x781A,
+    0x000F,
+    0xB2D3,
+    0x493C,
+    0x9300,
+    0x8833,
+    0x4355,
+    0x185B,
+    0x881B,
+    0x18ED,
+    0x4B3A,
+    0x18EC,
+    0x7822,
+    0x2301,
+    0x0011,
+    0x4019,
+    0x9101,
+    0x421A,
+    0xD15D,
+    0x4B36,
+    0x0002,
+    0x469C,
+    0x6B03,
+    0x32B6,
+    0x9302,
+    0x0003,
+    0x332C,
+    0x781B,
+    0x44AC,
+    0x9303,
+    0x68C3,
+    0x7812,
+    0x8901,
+    0x9204,
+    0x4A2D,
+    0x188A,
+    0x7812,
+    0x9205,
+    0x4A2E,
+    0x1889,
+    0x9A03,
+    0x8809,
+    0x4353,
+    0x9A02,
+    0x1AD3,
+    0x9A05,
+    0x0412,
+    0x430A,
+    0x9904,
+    0x434A,
+    0x1A9B,
+    0x4A28,
+    0x18AA,
+    0x6013,
+    0x4B28,
+    0x4A28,
+    0x18C3,
+    0xB29B,
+    0x18AA,
+    0x8013,
+    0x30A0,
+    0x6802,
+    0x6843,
+    0x2001,
+    0x4240,
+    0x17C1,
+    0x1812,
+    0x414B,
+    0x4661,
+    0x600A,
+    0x604B,
+    0x4921,
+    0x8832,
+    0x9B00,
+    0x1852,
+    0x3301,
+    0x7812,
+    0xB2DB,
+    0x4293,
+    0xD100,
+    0x9B01,
+    0x8832,
+    0x4914,
+    0x1852,
+    0x7013,
+    0x4A15,
+    0x4594,
+    0xD018,
+    0x4B17,
+    0x4919,
+    0x18FB,
+    0xB29B,
+    0x186D,
+    0x802B,
+    0x2302,
+    0x4297,
+    0xD011,
+    0x7822,
+    0x0038,
+    0x439A,
+    0x7022,
+    0xF7FC,
+    0xFBB4,
+    0xF007,
+    0xF900,
+    0x2301,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x2208,
+    0x7023,
+    0x4B0F,
+    0x601A,
+    0xB007,
+    0xBDF0,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0xE7F0,
+    0x46C0,
+    0x010A,
+    0x4203,
+    0x800D,
+    0x4203,
+    0x8006,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0x8012,
+    0x4203,
+    0x8005,
+    0x4203,
+    0x8010,
+    0x4203,
+    0x4000,
+    0x4201,
+    0xB570,
+    0x0005,
+    0x0004,
+    0x2100,
+    0x2001,
+    0x35A0,
+    0x682A,
+    0x686B,
+    0x1812,
+    0x414B,
+    0x0020,
+    0x602A,
+    0x606B,
+    0x2100,
+    0xF7FF,
+    0xFD01,
+    0x2102,
+    0x3427,
+    0x7823,
+    0x7823,
+    0x7822,
+    0x079B,
+    0x0FDB,
+    0x3301,
+    0x005B,
+    0x400B,
+    0x438A,
+    0x4313,
+    0x7023,
+    0xBD70,
+    0x3048,
+    0x8802,
+    0xB510,
+    0xB293,
+    0x2A00,
+    0xD102,
+    0xF7FC,
+    0xFBEC,
+    0xBD10,
+    0x4A03,
+    0x189B,
+    0x8818,
+    0x4B02,
+    0x18C0,
+    0xE7F8,
+    0x46C0,
+    0x800A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB570,
+    0x000D,
+    0x0004,
+    0x0028,
+    0x225A,
+    0x1E43,
+    0x4198,
+    0x32FF,
+    0x490D,
+    0xB2C0,
+    0xF005,
+    0xF9CE,
+    0x68E3,
+    0x7CA2,
+    0x2A02,
+    0xD80A,
+    0x8922,
+    0x4B0A,
+    0x490A,
+    0x18D3,
+    0x781B,
+    0x1852,
+    0x8812,
+    0x041B,
+    0x4313,
+    0x085B,
+    0x3B96,
+    0x6829,
+    0x2200,
+    0x4299,
+    0xD901,
+    0x602B,
+    0x3201,
+    0x3425,
+    0x7022,
+    0xBD70,
+    0x195F,
+    0x1003,
+    0x8006,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xB513,
+    0x0004,
+    0x0008,
+    0x0011,
+    0xF009,
+    0xF8A4,
+    0x0023,
+    0x0001,
+    0x2018,
+    0x3326,
+    0x781B,
+    0x4A08,
+    0x4358,
+    0x8812,
+    0x4B07,
+    0x18D2,
+    0x1880,
+    0x2201,
+    0xF003,
+    0xFFF0,
+    0x3010,
+    0x9001,
+    0xA901,
+    0x0020,
+    0xF7FF,
+    0xFFBC,
+    0x9801,
+    0xBD16,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x4B05,
+    0x18C9,
+    0x2302,
+    0xB289,
+    0x8101,
+    0x3024,
+    0x7802,
+    0x439A,
+    0x4313,
+    0x7003,
+    0x4770,
+    0x46C0,
+    0x8000,
+    0xFFFF,
+    0xB5F8,
+    0x0004,
+    0x2301,
+    0x3424,
+    0x000F,
+    0x0011,
+    0x7822,
+    0x421A,
+    0xD102,
+    0x2500,
+    0x0028,
+    0xBDF8,
+    0x7826,
+    0x0876,
+    0x0035,
+    0x401D,
+    0x421E,
+    0xD0F6,
+    0x7822,
+    0x08D2,
+    0x421A,
+    0xD1F2,
+    0x0003,
+    0x3326,
+    0x781B,
+    0x429F,
+    0xD1ED,
+    0x307C,
+    0x8800,
+    0xB280,
+    0xF7FC,
+    0xFB63,
+    0x2800,
+    0xD0E6,
+    0x2304,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0xE7E1,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xFC89,
+    0x2800,
+    0xD01B,
+    0x6C63,
+    0x0020,
+    0x6323,
+    0xF7FF,
+    0xFE33,
+    0x2203,
+    0x4B0B,
+    0x601A,
+    0x4B0B,
+    0x3A02,
+    0x63DA,
+    0x2280,
+    0x6959,
+    0x0192,
+    0x430A,
+    0x615A,
+    0x2238,
+    0x4B08,
+    0x701A,
+    0x4B08,
+    0x4A08,
+    0x685B,
+    0x4293,
+    0xD103,
+    0x2100,
+    0x0020,
+    0xF7FF,
+    0xFCDE,
+    0xBD10,
+    0x46C0,
+    0x4094,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x2301,
+    0x3028,
+    0x7003,
+    0x4770,
+    0x0003,
+    0x2201,
+    0x3329,
+    0x701A,
+    0x2300,
+    0x3028,
+    0x7003,
+    0x4770,
+    0x3024,
+    0x7802,
+    0x2101,
+    0x2300,
+    0x0792,
+    0xD506,
+    0x7802,
+    0x08D2,
+    0x420A,
+    0xD002,
+    0x7803,
+    0x09DB,
+    0x1ACB,
+    0xB2D8,
+    0x4770,
+    0x3024,
+    0x7800,
+    0x0680,
+    0x0FC0,
+    0x4770,
+    0x0003,
+    0xB5F0,
+    0x0007,
+    0x3348,
+    0x881B,
+    0xB085,
+    0xB29B,
+    0x9302,
+    0xF7FF,
+    0xFF14,
+    0x0039,
+    0x6804,
+    0x2204,
+    0x9001,
+    0x3118,
+    0x0020,
+    0xF00C,
+    0xFD00,
+    0xF7FC,
+    0xFAFE,
+    0x9B01,
+    0x4283,
+    0xD105,
+    0x2300,
+    0x9A01,
+    0x7123,
+    0x7163,
+    0x3306,
+    0x8113,
+    0x0038,
+    0xF7FF,
+    0xFEFE,
+    0x003B,
+    0x3327,
+    0x6806,
+    0x9303,
+    0x781C,
+    0x2304,
+    0x0064,
+    0x401C,
+    0x0005,
+    0xF7FC,
+    0xFAE7,
+    0x2340,
+    0x4285,
+    0xD004,
+    0x2208,
+    0x9B03,
+    0x781B,
+    0x00DB,
+    0x4013,
+    0x224C,
+    0x431C,
+    0x7933,
+    0x0038,
+    0x4393,
+    0x431C,
+    0x7134,
+    0xF7FF,
+    0xFFBF,
+    0x1E02,
+    0xD01B,
+    0x6B39,
+    0x9801,
+    0xF00C,
+    0xFE3A,
+    0x9B02,
+    0x2B00,
+    0xD012,
+    0x4A38,
+    0x4694,
+    0x4463,
+    0x781B,
+    0x079B,
+    0xD502,
+    0x6EBB,
+    0x3301,
+    0x66BB,
+    0x003B,
+    0x332C,
+    0x781A,
+    0x7CBB,
+    0x3B01,
+    0x429A,
+    0xD102,
+    0x6E7B,
+    0x3301,
+    0x667B,
+    0xB005,
+    0xBDF0,
+    0x4C2E,
+    0x6BE5,
+    0x6C63,
+    0x055B,
+    0x0F58,
+    0x2804,
+    0xD807,
+    0xF7FA,
+    0xFE09,
+    0x2403,
+    0x2826,
+    0x002A,
+    0x4B29,
+    0x881A,
+    0x4252,
+    0x23E3,
+    0x2601,
+    0x4928,
+    0x009B,
+    0x58CB,
+    0x4827,
+    0x6C61,
+    0x0B9B,
+    0x6800,
+    0x4033,
+    0x0AC9,
+    0x00DB,
+    0x4031,
+    0x195B,
+    0x00C9,
+    0x0700,
+    0x1740,
+    0x1A5B,
+    0x1A1B,
+    0x189B,
+    0x6C62,
+    0x0552,
+    0x0F52,
+    0x1E50,
+    0x2803,
+    0xD81F,
+    0xF7FA,
+    0xFDE7,
+    0x140A,
+    0x1C19,
+    0x4B1C,
+    0xE7DD,
+    0x4B1C,
+    0xE7DB,
+    0x4B1C,
+    0xE7D9,
+    0x4B1C,
+    0xE7D7,
+    0x491C,
+    0x7809,
+    0x00C9,
+    0x3128,
+    0x185B,
+    0x6C21,
+    0xB289,
+    0x4819,
+    0x5C80,
+    0xE00E,
+    0x4917,
+    0x7809,
+    0x00C9,
+    0x3118,
+    0xE7F4,
+    0x3391,
+    0x33FF,
+    0xE7F2,
+    0x337F,
+    0xE7FB,
+    0x6C21,
+    0x2000,
+    0xB289,
+    0x2A04,
+    0xD9ED,
+    0x2601,
+    0x4D11,
+    0x6C62,
+    0x692A,
+    0x6C64,
+    0x4341,
+    0x08E4,
+    0x43B2,
+    0x4034,
+    0x4314,
+    0x3396,
+    0x612C,
+    0x18C9,
+    0xE788,
+    0x8008,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x1967,
+    0x1003,
+    0x5000,
+    0x4200,
+    0xB5F8,
+    0x4F14,
+    0x4B14,
+    0x0005,
+    0x60BB,
+    0x2301,
+    0x743B,
+    0xF7FF,
+    0xFF24,
+    0x1E04,
+    0xD002,
+    0xF007,
+    0xF961,
+    0xBDF8,
+    0x6B2E,
+    0x6979,
+    0x0032,
+    0x0028,
+    0xF7FF,
+    0xFE7A,
+    0x0001,
+    0x7AAB,
+    0x1A30,
+    0x071B,
+    0x0049,
+    0x0F9B,
+    0x2B03,
+    0xD001,
+    0x4A08,
+    0x5CD4,
+    0x1841,
+    0x1909,
+    0xF006,
+    0xFFC2,
+    0x2302,
+    0x4906,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0xE7E3,
+    0x46C0,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x1964,
+    0x1003,
+    0x0107,
+    0x4203,
+    0xB570,
+    0x4D14,
+    0x4B14,
+    0x686A,
+    0x0004,
+    0x429A,
+    0xD105,
+    0x0003,
+    0x332C,
+    0x7819,
+    0xB2C9,
+    0xF7FF,
+    0xFBA5,
+    0x0020,
+    0xF7FF,
+    0xFEEB,
+    0x2800,
+    0xD00C,
+    0x0020,
+    0xF7FF,
+    0xFC39,
+    0x0020,
+    0xF7FF,
+    0xFEE8,
+    0x0020,
+    0xF7FF,
+    0xFBB1,
+    0x7B28,
+    0xF007,
+    0xF992,
+    0xBD70,
+    0x0020,
+    0xF7FF,
+    0xFBAA,
+    0x0020,
+    0xF7FF,
+    0xFFA9,
+    0x0020,
+    0xF7FF,
+    0xFC26,
+    0xE7F1,
+    0x46C0,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0003,
+    0x3348,
+    0xB510,
+    0x881C,
+    0x2301,
+    0xB2A4,
+    0x2900,
+    0xD10D,
+    0xF7FF,
+    0xFEC3,
+    0x2C00,
+    0xD006,
+    0x4B05,
+    0x18E4,
+    0x2302,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0x4243,
+    0x4158,
+    0xB2C3,
+    0x0018,
+    0xBD10,
+    0x8008,
+    0x4203,
+    0xB5F0,
+    0x4B4C,
+    0x0004,
+    0x689F,
+    0x4B4B,
+    0xB085,
+    0x429F,
+    0xD100,
+    0xE083,
+    0x494A,
+    0x2300,
+    0x6BCD,
+    0x6C48,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FA,
+    0xFD11,
+    0x5903,
+    0x5D5B,
+    0x005F,
+    0x4B44,
+    0x881B,
+    0x425B,
+    0x22E3,
+    0x4843,
+    0x0092,
+    0x5886,
+    0x4843,
+    0x6C4A,
+    0x6800,
+    0x0BB6,
+    0x4684,
+    0x2001,
+    0x4006,
+    0x00F6,
+    0x1976,
+    0x0AD5,
+    0x4662,
+    0x4005,
+    0x00ED,
+    0x0712,
+    0x1B75,
+    0x1752,
+    0x1AAD,
+    0x18ED,
+    0x63A5,
+    0x6C4B,
+    0x4E34,
+    0x091B,
+    0x4203,
+    0xD05F,
+    0x687B,
+    0x9301,
+    0x781B,
+    0xB2DF,
+    0x06DB,
+    0xD506,
+    0x0021,
+    0x2340,
+    0x3124,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0x0023,
+    0x3327,
+    0x781A,
+    0x9302,
+    0x10BB,
+    0x4053,
+    0x2201,
+    0x4213,
+    0xD016,
+    0x0020,
+    0xF7FF,
+    0xFD88,
+    0x9003,
+    0xF7FC,
+    0xF979,
+    0x9B03,
+    0x4283,
+    0xD00D,
+    0x0023,
+    0x3348,
+    0x881B,
+    0x4A27,
+    0x189B,
+    0x2201,
+    0x781B,
+    0x085B,
+    0x4213,
+    0xD003,
+    0x0011,
+    0x0020,
+    0xF7FF,
+    0xFC9A,
+    0x067B,
+    0xD50F,
+    0x9B01,
+    0x785B,
+    0x63E5,
+    0x2B00,
+    0xD115,
+    0x4B19,
+    0x60B3,
+    0xE012,
+    0x4B1D,
+    0xE7A8,
+    0x4B1D,
+    0xE7A6,
+    0x4B1D,
+    0xE7A4,
+    0x4B1D,
+    0xE7A2,
+    0x9B02,
+    0x781A,
+    0x10FB,
+    0x0852,
+    0x4053,
+    0x07DB,
+    0xD414,
+    0x0020,
+    0xF7FF,
+    0xFD3A,
+    0x63E5,
+    0x2300,
+    0x0020,
+    0x7433,
+    0xF7FF,
+    0xFE2F,
+    0x2800,
+    0xD007,
+    0x68B1,
+    0x4B0A,
+    0x4299,
+    0xD002,
+    0x0020,
+    0xF7FF,
+    0xFC93,
+    0x2001,
+    0xB005,
+    0xBDF0,
+    0x6F63,
+    0x3301,
+    0x6763,
+    0x63E5,
+    0xE7D3,
+    0x6EE3,
+    0x3301,
+    0x66E3,
+    0xE7CF,
+    0x46C0,
+    0xC878,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x8008,
+    0x4203,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0xB5F0,
+    0xB085,
+    0x0005,
+    0x000E,
+    0xF7FF,
+    0xFDFD,
+    0x4F32,
+    0x2800,
+    0xD011,
+    0x0028,
+    0xF7FF,
+    0xFECA,
+    0x42BE,
+    0xD00A,
+    0x0033,
+    0x332C,
+    0x7819,
+    0xB2C9,
+    0x42B5,
+    0xD101,
+    0x3101,
+    0xB2C9,
+    0x0030,
+    0xF7FF,
+    0xFAA1,
+    0xB005,
+    0xBDF0,
+    0x0028,
+    0xF7FF,
+    0xFDEA,
+    0x4C27,
+    0x68A1,
+    0x42B9,
+    0xD002,
+    0x0028,
+    0xF7FF,
+    0xFC4B,
+    0x7C24,
+    0x2C00,
+    0xD1E3,
+    0x4B23,
+    0x6BDA,
+    0x6C58,
+    0x9200,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FA,
+    0xFC42,
+    0x3103,
+    0x3533,
+    0x0037,
+    0x4A1E,
+    0x8814,
+    0x4264,
+    0x22E3,
+    0x491D,
+    0x0092,
+    0x588A,
+    0x6C5B,
+    0x0028,
+    0x9302,
+    0x4B1B,
+    0x9201,
+    0x681B,
+    0x9303,
+    0xF7FF,
+    0xFDBE,
+    0x2800,
+    0xD1C4,
+    0x2201,
+    0x9B01,
+    0x0B98,
+    0x4010,
+    0x9B00,
+    0x00C0,
+    0x18C0,
+    0x9B02,
+    0x0ADB,
+    0x4013,
+    0x00DB,
+    0x1AC0,
+    0x9B03,
+    0x071B,
+    0x175B,
+    0x1AC0,
+    0x002B,
+    0x332C,
+    0x781A,
+    0x68E9,
+    0x6C6B,
+    0x4351,
+    0x1900,
+    0x18C9,
+    0x1A41,
+    0xF7FF,
+    0xF992,
+    0xE7A8,
+    0x4A0A,
+    0xE7D0,
+    0x4A0A,
+    0xE7CE,
+    0x4A0A,
+    0xE7CC,
+    0x4A0A,
+    0xE7CA,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0xC878,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0xB5F8,
+    0x0005,
+    0x0003,
+    0x352C,
+    0x3394,
+    0x782E,
+    0x781B,
+    0x0004,
+    0xB2F6,
+    0x2B00,
+    0xD02E,
+    0x6841,
+    0x6800,
+    0x0023,
+    0x3388,
+    0x681A,
+    0x685B,
+    0x4290,
+    0xD126,
+    0x4299,
+    0xD124,
+    0x0023,
+    0x3390,
+    0x782A,
+    0x781B,
+    0x429A,
+    0xD11E,
+    0x0023,
+    0x2100,
+    0x3348,
+    0x881B,
+    0x4A3B,
+    0xB29F,
+    0x189A,
+    0x428B,
+    0xD012,
+    0x6810,
+    0x6851,
+    0x0023,
+    0x3380,
+    0x681A,
+    0x685B,
+    0x4290,
+    0xD156,
+    0x4299,
+    0xD154,
+    0x4B34,
+    0x18FF,
+    0x783B,
+    0x079B,
+    0xD54B,
+    0x6DE3,
+    0x3301,
+    0x65E3,
+    0x2101,
+    0x0020,
+    0xF7FF,
+    0xFB92,
+    0x0023,
+    0x33B4,
+    0x781B,
+    0x2B00,
+    0xD019,
+    0x6820,
+    0x6861,
+    0x0023,
+    0x33A8,
+    0x681A,
+    0x685B,
+    0x4290,
+    0xD111,
+    0x4299,
+    0xD10F,
+    0x0023,
+    0x33B0,
+    0x782A,
+    0x781B,
+    0x429A,
+    0xD109,
+    0x0020,
+    0xF7FF,
+    0xFC36,
+    0x0020,
+    0x4921,
+    0xF7FF,
+    0xFB9A,
+    0x6F23,
+    0x3301,
+    0x6723,
+    0x782A,
+    0x7CA3,
+    0x3B01,
+    0x429A,
+    0xD106,
+    0x0021,
+    0x2340,
+    0x3124,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0x8923,
+    0x4A17,
+    0x189B,
+    0x781B,
+    0x2201,
+    0x071B,
+    0xD420,
+    0x0023,
+    0x3324,
+    0x781B,
+    0x0020,
+    0x099B,
+    0x4213,
+    0xD011,
+    0x4B13,
+    0x685B,
+    0x429C,
+    0xD10D,
+    0xF7FF,
+    0xFD0A,
+    0x22FF,
+    0x4B0F,
+    0x731A,
+    0x4A0C,
+    0x605A,
+    0xE00D,
+    0x6E23,
+    0x3301,
+    0x6623,
+    0xE7B2,
+    0x2100,
+    0xE7B1,
+    0xF7FF,
+    0xFCFC,
+    0x2800,
+    0xD103,
+    0x4B08,
+    0x7C1B,
+    0x2B00,
+    0xD1EB,
+    0x6B22,
+    0x68E3,
+    0x3601,
+    0xB2F6,
+    0x189B,
+    0x6323,
+    0x702E,
+    0xBDF8,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x8008,
+    0x4203,
+    0xC878,
+    0x4203,
+    0xB570,
+    0x0004,
+    0xF7FF,
+    0xFCD4,
+    0x2800,
+    0xD040,
+    0x0023,
+    0x332C,
+    0x781D,
+    0x7CA3,
+    0xB2ED,
+    0x429D,
+    0xD33A,
+    0x2100,
+    0x0020,
+    0xF7FF,
+    0xF8D5,
+    0x2101,
+    0x0020,
+    0xF7FF,
+    0xF8D1,
+    0x0023,
+    0x0025,
+    0x3358,
+    0x781B,
+    0x3524,
+    0x2B00,
+    0xD00C,
+    0x6D20,
+    0x6D61,
+    0x6822,
+    0x6863,
+    0x4290,
+    0xD106,
+    0x4299,
+    0xD104,
+    0x2310,
+    0x782A,
+    0x439A,
+    0x4313,
+    0x702B,
+    0x2380,
+    0x782A,
+    0x2001,
+    0x439A,
+    0x4313,
+    0x2240,
+    0x702B,
+    0x782B,
+    0x2100,
+    0x4393,
+    0x702B,
+    0x0023,
+    0x3A3F,
+    0x3328,
+    0x701A,
+    0x6822,
+    0x6863,
+    0x1812,
+    0x414B,
+    0x6022,
+    0x6063,
+    0x4A07,
+    0x6C63,
+    0x6812,
+    0x0020,
+    0x6852,
+    0x189B,
+    0x6463,
+    0xF7FF,
+    0xFC89,
+    0xBD70,
+    0x0020,
+    0xF7FF,
+    0xFF19,
+    0x3501,
+    0xE7BB,
+    0x46C0,
+    0xC878,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xF8D7,
+    0x2800,
+    0xD005,
+    0x0020,
+    0xF7FF,
+    0xFA83,
+    0x0020,
+    0xF7FF,
+    0xFFA4,
+    0xBD10,
+    0x0000,
+    0xB510,
+    0x0004,
+    0x4A04,
+    0x6C63,
+    0x6D92,
+    0x1A9B,
+    0xD400,
+    0xBD10,
+    0x0020,
+    0xF7FF,
+    0xFFE7,
+    0xE7F5,
+    0x9000,
+    0x4201,
+    0x0003,
+    0x2201,
+    0x3328,
+    0xB510,
+    0x701A,
+    0x6C43,
+    0x18CB,
+    0x6443,
+    0x6B03,
+    0x18C9,
+    0x6301,
+    0xF7FF,
+    0xFC57,
+    0xBD10,
+    0x7882,
+    0x78C3,
+    0x0049,
+    0x021B,
+    0x4313,
+    0x4A03,
+    0x189B,
+    0x18C9,
+    0x8808,
+    0x1880,
+    0x4770,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x7903,
+    0x3301,
+    0xB2DB,
+    0x7103,
+    0x7902,
+    0x7803,
+    0x429A,
+    0xD101,
+    0x2300,
+    0x7103,
+    0x4770,
+    0x0000,
+    0x4A0D,
+    0x0C01,
+    0x0013,
+    0xB280,
+    0x4343,
+    0x434A,
+    0x0C1B,
+    0x189B,
+    0x4A0A,
+    0xB510,
+    0x4351,
+    0x4342,
+    0xB29C,
+    0x1912,
+    0x0C1B,
+    0x185B,
+    0x0C12,
+    0x189B,
+    0x0C1A,
+    0x0418,
+    0x0E80,
+    0x0193,
+    0x4318,
+    0x1292,
+    0x0412,
+    0xB280,
+    0x4310,
+    0xBD10,
+    0x1759,
+    0x0000,
+    0xD1B7,
+    0x0000,
+    0x4A04,
+    0x7813,
+    0x069B,
+    0xD404,
+    0x231F,
+    0x4018,
+    0x3301,
+    0x4303,
+    0x7013,
+    0x4770,
+    0x01C8,
+    0x4203,
+    0x2202,
+    0xB510,
+    0x4B08,
+    0x631A,
+    0x4B08,
+    0x781A,
+    0x2303,
+    0x401A,
+    0x3331,
+    0x4353,
+    0x4A06,
+    0x189B,
+    0x2204,
+    0x625A,
+    0xF7FF,
+    0xFFE4,
+    0xF007,
+    0xFE7C,
+    0xBD10,
+    0x46C0,
+    0x6000,
+    0x4200,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0xB510,
+    0x4B12,
+    0x781A,
+    0x2301,
+    0xB2D2,
+    0x2907,
+    0xD902,
+    0x4A10,
+    0x6313,
+    0xE00E,
+    0x0014,
+    0x410C,
+    0x421C,
+    0xD015,
+    0x4A0C,
+    0x2901,
+    0xD008,
+    0x2902,
+    0xD00B,
+    0x2900,
+    0xD1F2,
+    0x490A,
+    0x3002,
+    0x700B,
+    0x6590,
+    0xBD10,
+    0x2102,
+    0x4B07,
+    0x1840,
+    0x7019,
+    0xE7F8,
+    0x2104,
+    0x4B04,
+    0x3803,
+    0x7019,
+    0xE7F3,
+    0x3101,
+    0xE7DE,
+    0x01C7,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x01C0,
+    0x4203,
+    0xB573,
+    0x0004,
+    0x000D,
+    0x0016,
+    0x4668,
+    0x2207,
+    0x490F,
+    0xF00C,
+    0xF8EF,
+    0x2000,
+    0x42A5,
+    0xD218,
+    0x002B,
+    0x1E5A,
+    0x4193,
+    0x2101,
+    0x0002,
+    0xB2DB,
+    0x0030,
+    0x40D0,
+    0x4208,
+    0xD003,
+    0x4668,
+    0x5C80,
+    0x181B,
+    0xB2DB,
+    0x3201,
+    0x2A07,
+    0xD1F4,
+    0x2000,
+    0x42AB,
+    0xD803,
+    0x3301,
+    0xB2DB,
+    0x429C,
+    0x4140,
+    0xB2C0,
+    0xBD76,
+    0x1976,
+    0x1003,
+    0x2200,
+    0xB510,
+    0x4B05,
+    0x8981,
+    0x775A,
+    0x77DA,
+    0x7FC2,
+    0x4B04,
+    0x0752,
+    0x0FD2,
+    0x18C9,
+    0xF7FD,
+    0xF9BF,
+    0xBD10,
+    0xC89C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB570,
+    0x4C0F,
+    0x2501,
+    0x6963,
+    0x2000,
+    0x3325,
+    0x7819,
+    0x781A,
+    0x2303,
+    0x0889,
+    0x4029,
+    0x401A,
+    0xF004,
+    0xFAB2,
+    0x2120,
+    0x4A09,
+    0x6FD3,
+    0x438B,
+    0x67D3,
+    0x2280,
+    0x4B07,
+    0x0112,
+    0x7625,
+    0x601A,
+    0x2210,
+    0x4B06,
+    0x801A,
+    0x2300,
+    0x77A3,
+    0xF006,
+    0xFDC9,
+    0xBD70,
+    0xC89C,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x4000,
+    0x4201,
+    0x01CA,
+    0x4203,
+    0xB5F8,
+    0x4C69,
+    0x7F20,
+    0x2800,
+    0xD100,
+    0xE084,
+    0x2000,
+    0x6963,
+    0x7720,
+    0x3324,
+    0x7819,
+    0x2501,
+    0x781A,
+    0x2303,
+    0x0889,
+    0x401A,
+    0x4029,
+    0xF004,
+    0xFA85,
+    0x6963,
+    0x3324,
+    0x781A,
+    0x781B,
+    0x0892,
+    0xB2DB,
+    0x422A,
+    0xD00C,
+    0x08DB,
+    0x422B,
+    0xD009,
+    0x2020,
+    0x4B5B,
+    0x495B,
+    0x781A,
+    0x6FCA,
+    0x781B,
+    0x4382,
+    0x4003,
+    0x4313,
+    0x67CB,
+    0x68E2,
+    0x4C58,
+    0x2300,
+    0x6BE7,
+    0x6C60,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7FA,
+    0xF9BD,
+    0x2403,
+    0x2826,
+    0x002A,
+    0x4B52,
+    0x881B,
+    0x425B,
+    0x21E3,
+    0x2601,
+    0x4851,
+    0x0089,
+    0x5841,
+    0x6C60,
+    0x4D50,
+    0x0B89,
+    0x0AC0,
+    0x682D,
+    0x4031,
+    0x4030,
+    0x6C66,
+    0x00C9,
+    0x00C0,
+    0x19C9,
+    0x072D,
+    0x0576,
+    0x1A09,
+    0x176D,
+    0x0F76,
+    0x1B49,
+    0x1E70,
+    0x18C9,
+    0x2803,
+    0xD81F,
+    0xF7FA,
+    0xF99B,
+    0x140A,
+    0x1C19,
+    0x4B45,
+    0xE7DD,
+    0x4B45,
+    0xE7DB,
+    0x4B45,
+    0xE7D9,
+    0x4B45,
+    0xE7D7,
+    0x4B45,
+    0x781B,
+    0x00DB,
+    0x3328,
+    0x18C9,
+    0x6C23,
+    0xB29B,
+    0x4842,
+    0x5D85,
+    0xE00E,
+    0x4B40,
+    0x781B,
+    0x00DB,
+    0x3318,
+    0xE7F4,
+    0x3191,
+    0x31FF,
+    0xE7F2,
+    0x317F,
+    0xE7FB,
+    0x6C23,
+    0x2500,
+    0xB29B,
+    0x2E04,
+    0xD9ED,
+    0x6C60,
+    0x2001,
+    0x4684,
+    0x4E39,
+    0x436B,
+    0x6937,
+    0x3196,
+    0x4387,
+    0x6C60,
+    0x4664,
+    0x08C0,
+    0x4020,
+    0x4338,
+    0x6130,
+    0x18C9,
+    0x0010,
+    0xF00C,
+    0xF976,
+    0xBDF8,
+    0x7E23,
+    0x2B00,
+    0xD026,
+    0x7FA1,
+    0x6963,
+    0x7620,
+    0x2900,
+    0xD02A,
+    0x3323,
+    0x7018,
+    0x6963,
+    0x001A,
+    0x3222,
+    0x7811,
+    0x2201,
+    0x2900,
+    0xD004,
+    0x3321,
+    0x781A,
+    0x0852,
+    0x701A,
+    0x0002,
+    0x6963,
+    0xB2D2,
+    0x3322,
+    0x701A,
+    0x6962,
+    0x2401,
+    0x0013,
+    0x3321,
+    0x7818,
+    0x4B22,
+    0x3220,
+    0x6819,
+    0x4321,
+    0x6019,
+    0x68D9,
+    0x4001,
+    0x6818,
+    0x43A0,
+    0x6018,
+    0x7011,
+    0x2200,
+    0x0010,
+    0x0011,
+    0xF004,
+    0xF9DE,
+    0x2001,
+    0xF7FD,
+    0xF90F,
+    0xE7CB,
+    0x3322,
+    0x7019,
+    0x6962,
+    0x0013,
+    0x3323,
+    0x7818,
+    0x2301,
+    0x2800,
+    0xD006,
+    0x3221,
+    0x7813,
+    0x005B,
+    0x3301,
+    0xB2DB,
+    0x7013,
+    0x000B,
+    0x6962,
+    0xB2DB,
+    0x3223,
+    0x7013,
+    0xE7D1,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x6000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x1989,
+    0x1003,
+    0x5000,
+    0x4200,
+    0x7000,
+    0x4201,
+    0x4B05,
+    0x4A06,
+    0x881B,
+    0x7812,
+    0x4350,
+    0x18C0,
+    0x4B04,
+    0x18C0,
+    0x7800,
+    0x0700,
+    0x0FC0,
+    0x4770,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xB5F0,
+    0x6843,
+    0xB089,
+    0x781D,
+    0x9302,
+    0xB2EB,
+    0x9307,
+    0x230F,
+    0x401D,
+    0x4B84,
+    0x9003,
+    0x781B,
+    0x000F,
+    0xB2DA,
+    0x0001,
+    0x9205,
+    0x2BFE,
+    0xD015,
+    0x2D07,
+    0xD13B,
+    0x4B7F,
+    0x4A80,
+    0x881B,
+    0x7814,
+    0x437C,
+    0x18E4,
+    0x4B7E,
+    0x18E3,
+    0x7818,
+    0xB2C0,
+    0xF7FF,
+    0xFFCE,
+    0x2800,
+    0xD10F,
+    0x4B7B,
+    0x7E1A,
+    0x2A00,
+    0xD000,
+    0xE077,
+    0x9903,
+    0x4879,
+    0xF7FB,
+    0xFD47,
+    0x4B77,
+    0x7F1B,
+    0x2B00,
+    0xD100,
+    0xE0DC,
+    0x2001,
+    0xE01B,
+    0x9B02,
+    0x789E,
+    0x09B6,
+    0x2E02,
+    0xD1EA,
+    0x4B73,
+    0x18E4,
+    0x7823,
+    0x43B3,
+    0x4333,
+    0x7023,
+    0x4B71,
+    0x781B,
+    0x2B00,
+    0xD01F,
+    0x220A,
+    0x0039,
+    0x9803,
+    0xF002,
+    0xF910,
+    0x7823,
+    0x2000,
+    0x43B3,
+    0x431E,
+    0x23FF,
+    0x4A63,
+    0x7026,
+    0x7013,
+    0xB009,
+    0xBDF0,
+    0x4B64,
+    0x695B,
+    0x7FDB,
+    0x075B,
+    0xD403,
+    0x2D04,
+    0xD0CA,
+    0x23FF,
+    0xE09E,
+    0x2D00,
+    0xD001,
+    0x2D06,
+    0xD1F7,
+    0x4B61,
+    0x781B,
+    0x2B00,
+    0xD1F5,
+    0x4C5C,
+    0x6963,
+    0x001A,
+    0x3220,
+    0x9304,
+    0x7813,
+    0xB2DE,
+    0x2B00,
+    0xD000,
+    0xE09C,
+    0x9B04,
+    0x0030,
+    0x3325,
+    0x7819,
+    0x781A,
+    0x2303,
+    0x0889,
+    0x401A,
+    0x3B02,
+    0x4019,
+    0x6927,
+    0xF004,
+    0xF91C,
+    0x2301,
+    0x77E3,
+    0x7723,
+    0x2D07,
+    0xD124,
+    0xF006,
+    0xFAF7,
+    0xF006,
+    0xFB8F,
+    0xF00C,
+    0xF859,
+    0x9B02,
+    0x3304,
+    0x9306,
+    0x9B02,
+    0x78DA,
+    0x2302,
+    0x0016,
+    0x401E,
+    0x0031,
+    0x421A,
+    0xD01C,
+    0x230E,
+    0x9A02,
+    0x1F11,
+    0x18C9,
+    0x2300,
+    0x7812,
+    0x09D2,
+    0x429A,
+    0xD005,
+    0x223F,
+    0x794B,
+    0x4393,
+    0x3B40,
+    0x425A,
+    0x4153,
+    0xB2DE,
+    0xE00B,
+    0x2201,
+    0x779A,
+    0xE784,
+    0xF7FF,
+    0xFE58,
+    0x9B02,
+    0x0031,
+    0x3302,
+    0x9306,
+    0x230C,
+    0x2D01,
+    0xD0E3,
+    0x9B04,
+    0x9C04,
+    0x7F9B,
+    0x2201,
+    0xB2DB,
+    0x469C,
+    0x9B04,
+    0x3418,
+    0x7F9B,
+    0x1DB8,
+    0x079B,
+    0xD50F,
+    0x9B05,
+    0x2BFF,
+    0xD00C,
+    0x4B33,
+    0x4D34,
+    0x881B,
+    0x195B,
+    0x9D05,
+    0x00ED,
+    0x195B,
+    0x781B,
+    0x08DB,
+    0x001D,
+    0x4015,
+    0x4213,
+    0xD033,
+    0x4662,
+    0x0196,
+    0x2240,
+    0x793B,
+    0x4016,
+    0x4393,
+    0x431E,
+    0x0021,
+    0x713E,
+    0x3A3A,
+    0xF00B,
+    0xFEBF,
+    0x2400,
+    0x2180,
+    0x0038,
+    0x9B07,
+    0x793A,
+    0x005B,
+    0x438A,
+    0x400B,
+    0x4313,
+    0x713B,
+    0x2206,
+    0x9906,
+    0x300C,
+    0xF00B,
+    0xFEB0,
+    0x9B05,
+    0x9A07,
+    0x431C,
+    0x2300,
+    0x0652,
+    0xD509,
+    0x213F,
+    0x9A06,
+    0x7952,
+    0x438A,
+    0x2A40,
+    0xD103,
+    0x9B05,
+    0x3BFF,
+    0x1E5A,
+    0x4193,
+    0x029B,
+    0x431C,
+    0x4B12,
+    0x68DB,
+    0x835C,
+    0x230A,
+    0x9A03,
+    0x7753,
+    0xE72B,
+    0x2340,
+    0x2480,
+    0x793A,
+    0x00A4,
+    0x439A,
+    0x4313,
+    0x713B,
+    0x0032,
+    0x9B05,
+    0x9500,
+    0xF7FB,
+    0xFBB5,
+    0xE7CB,
+    0x7813,
+    0x3B01,
+    0xB2DB,
+    0x7013,
+    0xE719,
+    0x23FF,
+    0x4A01,
+    0x7013,
+    0xE71E,
+    0x46C0,
+    0x01C9,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8003,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x0236,
+    0x4203,
+    0x8015,
+    0x4203,
+    0x020A,
+    0x4203,
+    0x01F0,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x4B03,
+    0x6859,
+    0x6918,
+    0xF00B,
+    0xFFD0,
+    0xBD10,
+    0x46C0,
+    0xC8C8,
+    0x4203,
+    0xB5F0,
+    0x4C38,
+    0xB087,
+    0x7823,
+    0x68E2,
+    0x3301,
+    0xB2DB,
+    0x68A5,
+    0x1D11,
+    0x7023,
+    0x18C9,
+    0x780F,
+    0x8AA9,
+    0xB2FE,
+    0xB289,
+    0x2FFF,
+    0xD005,
+    0x2B04,
+    0xD803,
+    0x4F30,
+    0x783F,
+    0x2F00,
+    0xD003,
+    0xF002,
+    0xFC95,
+    0xB007,
+    0xBDF0,
+    0x2800,
+    0xD030,
+    0x8955,
+    0x482B,
+    0x182D,
+    0x2B00,
+    0xD03D,
+    0x8C93,
+    0xB298,
+    0x9003,
+    0x2096,
+    0xB2DB,
+    0x0040,
+    0x4358,
+    0x6863,
+    0x181B,
+    0x6063,
+    0x05C9,
+    0xD531,
+    0x27F8,
+    0x6829,
+    0x8BD3,
+    0x017F,
+    0x1858,
+    0x469C,
+    0x5C5B,
+    0x9302,
+    0x7882,
+    0x0213,
+    0x401F,
+    0x7843,
+    0x433B,
+    0x9301,
+    0x466B,
+    0x7B1F,
+    0x4663,
+    0x565B,
+    0x469C,
+    0xAB04,
+    0x1D99,
+    0x4663,
+    0x2B00,
+    0xDA24,
+    0x9B01,
+    0x1BDB,
+    0x4F17,
+    0xB29B,
+    0x42BB,
+    0xD903,
+    0x800B,
+    0xE008,
+    0x89ED,
+    0xE7CD,
+    0x270A,
+    0x437B,
+    0x800B,
+    0x237F,
+    0x9F02,
+    0x401F,
+    0x7007,
+    0x880B,
+    0x0952,
+    0x0352,
+    0x431A,
+    0x800A,
+    0x3001,
+    0x2202,
+    0xF00B,
+    0xFE02,
+    0x2340,
+    0x4A0C,
+    0x4333,
+    0x8413,
+    0x0030,
+    0x6125,
+    0xF006,
+    0xFB98,
+    0xF7FF,
+    0xFF8C,
+    0xE7AD,
+    0x230A,
+    0x425B,
+    0x435F,
+    0x9B01,
+    0x19DB,
+    0xE7DA,
+    0x46C0,
+    0xC8C8,
+    0x4203,
+    0x020A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0332,
+    0x0000,
+    0x5000,
+    0x4200,
+    0xB5F8,
+    0x0003,
+    0x2403,
+    0x0008,
+    0x789A,
+    0x4D52,
+    0xB2D1,
+    0x4022,
+    0x4C51,
+    0x4E52,
+    0x60A3,
+    0x78DB,
+    0x882D,
+    0x7836,
+    0x7520,
+    0x4373,
+    0x195B,
+    0x4D4F,
+    0x4E4F,
+    0x195D,
+    0x60E5,
+    0x4D4F,
+    0x782F,
+    0x4D4F,
+    0x882D,
+    0x19AD,
+    0x2618,
+    0x437E,
+    0x19AD,
+    0x782D,
+    0x4E4C,
+    0x2704,
+    0x19AD,
+    0x00AD,
+    0x682E,
+    0x25FF,
+    0x7025,
+    0x2500,
+    0x7565,
+    0x4D49,
+    0x195B,
+    0x781D,
+    0x43BD,
+    0x701D,
+    0x4B47,
+    0x4F48,
+    0x881B,
+    0x199B,
+    0x6063,
+    0x4B47,
+    0x781D,
+    0x4D47,
+    0x6A2E,
+    0x781B,
+    0x403E,
+    0x27E0,
+    0x021B,
+    0x00FF,
+    0x403B,
+    0x2707,
+    0x4333,
+    0x622B,
+    0x4B42,
+    0x1C55,
+    0x695E,
+    0x43BE,
+    0x432E,
+    0x615E,
+    0x2D02,
+    0xD05A,
+    0x3A02,
+    0x2A01,
+    0xD855,
+    0x4A3E,
+    0x2700,
+    0x7812,
+    0xB2D2,
+    0xB2D6,
+    0x765E,
+    0x4E3C,
+    0x7037,
+    0x4F3C,
+    0x4E3C,
+    0x5D7F,
+    0x1BD2,
+    0x4F3C,
+    0x5D7F,
+    0x437A,
+    0x6032,
+    0x2D01,
+    0xD147,
+    0x4A3A,
+    0x7815,
+    0x7812,
+    0x4D39,
+    0xB2D2,
+    0x632A,
+    0x4A39,
+    0x7815,
+    0x6A1E,
+    0x7812,
+    0x4D38,
+    0x1E57,
+    0x41BA,
+    0x27F0,
+    0x402E,
+    0x0412,
+    0x4332,
+    0x621A,
+    0x4A35,
+    0x7816,
+    0x69DE,
+    0x7812,
+    0x43BE,
+    0x0912,
+    0x0112,
+    0x4332,
+    0x61DA,
+    0x0789,
+    0xD42E,
+    0x4A30,
+    0x7812,
+    0x4930,
+    0xB2D2,
+    0x761A,
+    0x4A30,
+    0x7812,
+    0x8809,
+    0x0412,
+    0x430A,
+    0x625A,
+    0x4A2E,
+    0x7811,
+    0x6A19,
+    0x7812,
+    0x4029,
+    0x2501,
+    0x002E,
+    0x0852,
+    0x4396,
+    0x0432,
+    0x430A,
+    0x621A,
+    0x6A1A,
+    0x4928,
+    0x400A,
+    0x621A,
+    0x68A2,
+    0x7D11,
+    0x6919,
+    0x7D12,
+    0x43A9,
+    0x402A,
+    0x430A,
+    0x611A,
+    0xF7FF,
+    0xFEE7,
+    0x2000,
+    0xBDF8,
+    0x4A22,
+    0xE7A8,
+    0x4A22,
+    0xE7A6,
+    0x2D02,
+    0xD1BB,
+    0x4A21,
+    0xE7B4,
+    0x4A21,
+    0xE7CF,
+    0x46C0,
+    0x0174,
+    0x4203,
+    0xC8C8,
+    0x4203,
+    0x017E,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x8026,
+    0x4203,
+    0x020E,
+    0x4203,
+    0xF8FF,
+    0xFFFF,
+    0x012F,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x1998,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x1993,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x012E,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x011E,
+    0x4203,
+    0xB510,
+    0x2100,
+    0xF7FF,
+    0xFF10,
+    0xBD10,
+    0x0000,
+    0xB5F7,
+    0x2101,
+    0x0004,
+    0xF7FF,
+    0xFF09,
+    0x0006,
+    0xF002,
+    0xFD16,
+    0x2800,
+    0xD100,
+    0xE07C,
+    0x7D21,
+    0x78A2,
+    0x2401,
+    0x0952,
+    0x4022,
+    0x4021,
+    0x0020,
+    0xF7FB,
+    0xF9C0,
+    0x0005,
+    0xF004,
+    0xFE27,
+    0x0028,
+    0xF005,
+    0xFA9A,
+    0x4B37,
+    0x2540,
+    0x681A,
+    0x4B37,
+    0x4F37,
+    0x619A,
+    0x4A37,
+    0x6811,
+    0x4A37,
+    0x6011,
+    0x4A37,
+    0x6811,
+    0x4A37,
+    0x6011,
+    0x4A37,
+    0x7811,
+    0x4937,
+    0x8808,
+    0x2080,
+    0x7812,
+    0x8809,
+    0x0412,
+    0x430A,
+    0x4935,
+    0x605A,
+    0x780A,
+    0x43AA,
+    0x432A,
+    0x700A,
+    0x4A33,
+    0x7811,
+    0x6919,
+    0x7812,
+    0x4381,
+    0x0020,
+    0x4390,
+    0x01C2,
+    0x430A,
+    0x68F8,
+    0x611A,
+    0x8942,
+    0x492E,
+    0x1852,
+    0x6811,
+    0x790A,
+    0x3106,
+    0xB2D2,
+    0x9201,
+    0x681A,
+    0x43A2,
+    0x601A,
+    0x8C03,
+    0x4A29,
+    0xB29B,
+    0x8013,
+    0x4829,
+    0x2206,
+    0xF00B,
+    0xFC9F,
+    0x4B28,
+    0x9A01,
+    0x7819,
+    0x0992,
+    0x43A1,
+    0x4022,
+    0x430A,
+    0x2102,
+    0x2004,
+    0x701A,
+    0x781A,
+    0x438A,
+    0x430A,
+    0x701A,
+    0x781A,
+    0x4382,
+    0x701A,
+    0x781A,
+    0x1800,
+    0x4382,
+    0x701A,
+    0x2210,
+    0x7818,
+    0x4390,
+    0x4302,
+    0x701A,
+    0x2220,
+    0x7818,
+    0x4390,
+    0x4302,
+    0x701A,
+    0x781A,
+    0x43AA,
+    0x4315,
+    0x701D,
+    0x68FB,
+    0x4A17,
+    0x8C5B,
+    0xB29B,
+    0x8013,
+    0x4B16,
+    0x4A16,
+    0x7019,
+    0x4B16,
+    0x31FD,
+    0x701C,
+    0x2300,
+    0x8013,
+    0x4A15,
+    0x7011,
+    0x75FB,
+    0x0030,
+    0xBDFE,
+    0x0120,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xC8C8,
+    0x4203,
+    0x0124,
+    0x4203,
+    0xD0CC,
+    0x4200,
+    0x0128,
+    0x4203,
+    0xD0D0,
+    0x4200,
+    0x012E,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01D0,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x01D8,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x4B05,
+    0xB510,
+    0x781B,
+    0x2B03,
+    0xD803,
+    0x2000,
+    0xF7FF,
+    0xFDD8,
+    0xBD10,
+    0xF002,
+    0xFA83,
+    0xE7FB,
+    0xC8C8,
+    0x4203,
+    0xB510,
+    0x4B16,
+    0x2800,
+    0xD120,
+    0x68DA,
+    0x7D58,
+    0x8C14,
+    0x4914,
+    0x2C00,
+    0xD015,
+    0x2800,
+    0xD115,
+    0x3001,
+    0x781B,
+    0x30FF,
+    0x6008,
+    0x3204,
+    0x4810,
+    0x189B,
+    0x247F,
+    0x781A,
+    0x6902,
+    0x7819,
+    0x2340,
+    0x4021,
+    0x43A2,
+    0x430B,
+    0x4313,
+    0x6103,
+    0xF006,
+    0xF93F,
+    0xBD10,
+    0x2800,
+    0xD008,
+    0x2280,
+    0x00D2,
+    0x600A,
+    0x2200,
+    0x2001,
+    0x755A,
+    0xF7FF,
+    0xFDA8,
+    0xE7F3,
+    0x2280,
+    0x0052,
+    0xE7F5,
+    0xC8C8,
+    0x4203,
+    0x4000,
+    0x4201,
+    0x6000,
+    0x4200,
+    0x220F,
+    0xB510,
+    0x6843,
+    0x0001,
+    0x781B,
+    0x4013,
+    0x2B03,
+    0xD007,
+    0x2000,
+    0x2B05,
+    0xD10F,
+    0x4808,
+    0xF7FB,
+    0xF9D2,
+    0x2302,
+    0xE007,
+    0x2280,
+    0x4B06,
+    0x0092,
+    0x601A,
+    0x4805,
+    0xF7FB,
+    0xF9C9,
+    0x2301,
+    0x2001,
+    0x4A04,
+    0x75D3,
+    0xBD10,
+    0x0238,
+    0x4203,
+    0x4000,
+    0x4201,
+    0x0236,
+    0x4203,
+    0xC8C8,
+    0x4203,
+    0xB5F7,
+    0x4C3C,
+    0x7DE3,
+    0x2B01,
+    0xD006,
+    0x2B02,
+    0xD100,
+    0xE06D,
+    0x2001,
+    0xF7FF,
+    0xFD6F,
+    0xE068,
+    0x68A3,
+    0x4F37,
+    0x89DE,
+    0x4B37,
+    0x2200,
+    0x18F6,
+    0x6BFB,
+    0x6C78,
+    0x9301,
+    0x0540,
+    0x0F40,
+    0x2804,
+    0xD807,
+    0xF7F9,
+    0xFD1B,
+    0x2603,
+    0x2A28,
+    0x002C,
+    0x4A30,
+    0x8812,
+    0x4252,
+    0x21E3,
+    0x482F,
+    0x0089,
+    0x5845,
+    0x6C79,
+    0x0BAB,
+    0x2501,
+    0x402B,
+    0x00DB,
+    0x469C,
+    0x482C,
+    0x9B01,
+    0x6800,
+    0x0AC9,
+    0x4029,
+    0x4463,
+    0x00C9,
+    0x0700,
+    0x1740,
+    0x1A5B,
+    0x1A1B,
+    0x189B,
+    0x6C7A,
+    0x0552,
+    0x0F52,
+    0x1E50,
+    0x2803,
+    0xD81F,
+    0xF7F9,
+    0xFCF7,
+    0x140A,
+    0x1C19,
+    0x4A22,
+    0xE7DB,
+    0x4A22,
+    0xE7D9,
+    0x4A22,
+    0xE7D7,
+    0x4A22,
+    0xE7D5,
+    0x4922,
+    0x7809,
+    0x00C9,
+    0x3128,
+    0x185B,
+    0x6C39,
+    0xB289,
+    0x481F,
+    0x5C80,
+    0xE00E,
+    0x491D,
+    0x7809,
+    0x00C9,
+    0x3118,
+    0xE7F4,
+    0x3391,
+    0x33FF,
+    0xE7F2,
+    0x337F,
+    0xE7FB,
+    0x6C39,
+    0x2000,
+    0xB289,
+    0x2A04,
+    0xD9ED,
+    0x6C7A,
+    0x4A17,
+    0x2501,
+    0x4694,
+    0x6912,
+    0x6C7F,
+    0x43AA,
+    0x08FF,
+    0x402F,
+    0x433A,
+    0x4667,
+    0x4341,
+    0x3396,
+    0x0030,
+    0x613A,
+    0x18C9,
+    0xF00B,
+    0xFCD2,
+    0x7565,
+    0xBDF7,
+    0x2000,
+    0xF006,
+    0xFF79,
+    0xE7FA,
+    0xC8C8,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x8000,
+    0x4203,
+    0x0252,
+    0x4203,
+    0xD000,
+    0x4200,
+    0xD0D4,
+    0x4200,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x198E,
+    0x1003,
+    0x5000,
+    0x4200,
+    0x0001,
+    0xB5F8,
+    0x4B49,
+    0x78C0,
+    0x881A,
+    0x4B49,
+    0x2401,
+    0x781B,
+    0x7D0D,
+    0xB2C0,
+    0xB292,
+    0xB2DB,
+    0x066D,
+    0xD508,
+    0x4343,
+    0x189B,
+    0x4A44,
+    0x2002,
+    0x189B,
+    0x781B,
+    0x089B,
+    0x4223,
+    0xD072,
+    0x2303,
+    0x2707,
+    0x788A,
+    0x7848,
+    0xB2D4,
+    0x401A,
+    0x4B3F,
+    0x1C55,
+    0x695E,
+    0xB2C0,
+    0x43BE,
+    0x432E,
+    0x615E,
+    0x2D02,
+    0xD066,
+    0x3A02,
+    0x2A01,
+    0xD861,
+    0x4A3A,
+    0x2700,
+    0x7812,
+    0xB2D2,
+    0xB2D6,
+    0x765E,
+    0x4E38,
+    0x7037,
+    0x4F38,
+    0x4E38,
+    0x5D7F,
+    0x1BD2,
+    0x4F38,
+    0x5D7F,
+    0x437A,
+    0x6032,
+    0x2D01,
+    0xD153,
+    0x4A36,
+    0x7815,
+    0x7812,
+    0x4D35,
+    0xB2D2,
+    0x632A,
+    0x4A35,
+    0x7815,
+    0x6A1E,
+    0x7812,
+    0x4D34,
+    0x1E57,
+    0x41BA,
+    0x27F0,
+    0x402E,
+    0x0412,
+    0x4332,
+    0x621A,
+    0x4A31,
+    0x7816,
+    0x69DE,
+    0x7812,
+    0x43BE,
+    0x0912,
+    0x0112,
+    0x4332,
+    0x61DA,
+    0x07A4,
+    0xD43A,
+    0x4A2C,
+    0x7812,
+    0x4C2C,
+    0xB2D2,
+    0x761A,
+    0x4A2C,
+    0x7812,
+    0x8824,
+    0x0412,
+    0x4322,
+    0x625A,
+    0x2240,
+    0x4302,
+    0x841A,
+    0x4A28,
+    0x7814,
+    0x6A1C,
+    0x7812,
+    0x402C,
+    0x2501,
+    0x002E,
+    0x0852,
+    0x4396,
+    0x0432,
+    0x4322,
+    0x621A,
+    0x6A1A,
+    0x4C23,
+    0x4022,
+    0x621A,
+    0x7D0A,
+    0x691C,
+    0x7D0A,
+    0x43AC,
+    0x402A,
+    0x4322,
+    0x611A,
+    0x684A,
+    0x4B1E,
+    0x6099,
+    0x605A,
+    0x89CA,
+    0x491D,
+    0x1852,
+    0x611A,
+    0xF006,
+    0xF85F,
+    0xF7FF,
+    0xFC53,
+    0x2000,
+    0xBDF8,
+    0x4A1A,
+    0xE79C,
+    0x4A1A,
+    0xE79A,
+    0x2D02,
+    0xD1AF,
+    0x4A19,
+    0xE7A8,
+    0x4A19,
+    0xE7C3,
+    0x46C0,
+    0x0174,
+    0x4203,
+    0x017E,
+    0x4203,
+    0x8026,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x1998,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x1993,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x012E,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0xC8C8,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x011E,
+    0x4203,
+    0xB570,
+    0x490E,
+    0x4A0E,
+    0x78C3,
+    0x8812,
+    0x780C,
+    0x490D,
+    0x4363,
+    0x189B,
+    0x4A0D,
+    0x8809,
+    0x189A,
+    0x7814,
+    0x4A0C,
+    0x4D0C,
+    0x7812,
+    0x195B,
+    0x4362,
+    0x681B,
+    0x1852,
+    0x490A,
+    0x8A00,
+    0x1852,
+    0x0C19,
+    0x4059,
+    0xB289,
+    0xB280,
+    0xF7FB,
+    0xF8F6,
+    0xBD70,
+    0x0180,
+    0x4203,
+    0x0182,
+    0x4203,
+    0x0186,
+    0x4203,
+    0x800B,
+    0x4203,
+    0x0181,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x2303,
+    0xB5F7,
+    0x7882,
+    0x0005,
+    0x401A,
+    0x9200,
+    0x2900,
+    0xD100,
+    0xE089,
+    0xF7FF,
+    0xFFC9,
+    0x0007,
+    0x2107,
+    0x78EB,
+    0x4C47,
+    0xB2DB,
+    0x469C,
+    0x4B47,
+    0x881B,
+    0xB29B,
+    0x9301,
+    0x4B46,
+    0x781E,
+    0x9B00,
+    0xB2F6,
+    0x1C5A,
+    0x6963,
+    0x438B,
+    0x4313,
+    0x6163,
+    0x2A02,
+    0xD100,
+    0xE076,
+    0x9B00,
+    0x3B02,
+    0x2B01,
+    0xD900,
+    0xE06F,
+    0x4B3E,
+    0x2000,
+    0x781B,
+    0xB2DB,
+    0xB2D9,
+    0x7661,
+    0x493C,
+    0x7008,
+    0x483C,
+    0x493D,
+    0x5C80,
+    0x1A1B,
+    0x483C,
+    0x5C80,
+    0x4358,
+    0x6008,
+    0x2A01,
+    0xD161,
+    0x4B3A,
+    0x781A,
+    0x781B,
+    0x4A3A,
+    0xB2DB,
+    0x6313,
+    0x4B39,
+    0x493A,
+    0x781A,
+    0x6A22,
+    0x781B,
+    0x400A,
+    0x1E59,
+    0x418B,
+    0x21F0,
+    0x041B,
+    0x4313,
+    0x4A36,
+    0x6223,
+    0x7813,
+    0x69E3,
+    0x438B,
+    0x0019,
+    0x7813,
+    0x091B,
+    0x011B,
+    0x430B,
+    0x61E3,
+    0x4663,
+    0x435E,
+    0x9B01,
+    0x9900,
+    0x18F6,
+    0x4B2F,
+    0x18F3,
+    0x6818,
+    0xF005,
+    0xFFD8,
+    0x4B2D,
+    0x4A2E,
+    0x7620,
+    0x18F3,
+    0x781B,
+    0x18B6,
+    0x8832,
+    0x041B,
+    0x4313,
+    0x6263,
+    0x2340,
+    0x433B,
+    0xB2DB,
+    0x8423,
+    0x4B28,
+    0x4923,
+    0x781A,
+    0x6A22,
+    0x781B,
+    0x400A,
+    0x2101,
+    0x0008,
+    0x085B,
+    0x4398,
+    0x0403,
+    0x4313,
+    0x6223,
+    0x6A23,
+    0x4A22,
+    0x0038,
+    0x4013,
+    0x6223,
+    0x7D2B,
+    0x6922,
+    0x7D2B,
+    0x438A,
+    0x400B,
+    0x4313,
+    0x6123,
+    0x686A,
+    0x4B1D,
+    0x491E,
+    0x605A,
+    0x89EA,
+    0x609D,
+    0x1852,
+    0x611A,
+    0xF005,
+    0xFF63,
+    0xF7FF,
+    0xFB57,
+    0x2000,
+    0xBDFE,
+    0x7847,
+    0xB2FF,
+    0xE775,
+    0x4B17,
+    0xE78E,
+    0x4B17,
+    0xE78C,
+    0x2A02,
+    0xD1A1,
+    0x4B16,
+    0xE79A,
+    0x5000,
+    0x4200,
+    0x0182,
+    0x4203,
+    0x0180,
+    0x4203,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x1998,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x1993,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0xC8C8,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0xB510,
+    0x2101,
+    0xF7FF,
+    0xFF30,
+    0xBD10,
+    0xB510,
+    0x2100,
+    0xF7FF,
+    0xFF2B,
+    0xBD10,
+    0xB5F0,
+    0x4B98,
+    0xB085,
+    0x9103,
+    0x78C1,
+    0x881A,
+    0x4B96,
+    0x2607,
+    0x781B,
+    0x0004,
+    0x434B,
+    0x189B,
+    0x9300,
+    0x9A00,
+    0x4993,
+    0x4B94,
+    0x1852,
+    0x6098,
+    0x60DA,
+    0x2303,
+    0x7882,
+    0xB2D1,
+    0x401A,
+    0x7883,
+    0xB2DB,
+    0x9302,
+    0x7843,
+    0x1C50,
+    0xB2DB,
+    0x9301,
+    0x4B8D,
+    0x695D,
+    0x43B5,
+    0x4305,
+    0x615D,
+    0x2802,
+    0xD100,
+    0xE102,
+    0x3A02,
+    0x2A01,
+    0xD900,
+    0xE0FC,
+    0x4A88,
+    0x2600,
+    0x7812,
+    0xB2D2,
+    0xB2D5,
+    0x765D,
+    0x4D86,
+    0x702E,
+    0x4E86,
+    0x4D87,
+    0x5C36,
+    0x1B92,
+    0x4E86,
+    0x5C36,
+    0x4356,
+    0x602E,
+    0x2801,
+    0xD000,
+    0xE0ED,
+    0x4A84,
+    0x7810,
+    0x7812,
+    0x4883,
+    0xB2D2,
+    0x6302,
+    0x4A83,
+    0x7810,
+    0x6A1D,
+    0x7812,
+    0x4882,
+    0x1E56,
+    0x41B2,
+    0x26F0,
+    0x4005,
+    0x0412,
+    0x432A,
+    0x4D7F,
+    0x621A,
+    0x782A,
+    0x69DA,
+    0x43B2,
+    0x0016,
+    0x782A,
+    0x0912,
+    0x0112,
+    0x4332,
+    0x61DA,
+    0x0789,
+    0xD500,
+    0xE0D3,
+    0x4A79,
+    0x2640,
+    0x7812,
+    0x4979,
+    0xB2D2,
+    0x761A,
+    0x4D78,
+    0x780A,
+    0x8829,
+    0x0412,
+    0x430A,
+    0x625A,
+    0x9A01,
+    0x4D76,
+    0x4332,
+    0x841A,
+    0x782A,
+    0x6A19,
+    0x782A,
+    0x2501,
+    0x002F,
+    0x0852,
+    0x4397,
+    0x4001,
+    0x043A,
+    0x430A,
+    0x621A,
+    0x6A1A,
+    0x496F,
+    0x4F5F,
+    0x400A,
+    0x621A,
+    0x7D22,
+    0x6919,
+    0x7D22,
+    0x43A9,
+    0x402A,
+    0x430A,
+    0x611A,
+    0x6863,
+    0x4A6A,
+    0x607B,
+    0x9B00,
+    0x9801,
+    0x189B,
+    0x881B,
+    0x4A55,
+    0x189B,
+    0x613B,
+    0xF005,
+    0xFE8D,
+    0x002A,
+    0x9B02,
+    0x7D21,
+    0x071B,
+    0x0F9B,
+    0x409A,
+    0xB2D3,
+    0x78A2,
+    0x4029,
+    0x0952,
+    0x402A,
+    0x0018,
+    0x9302,
+    0xF7FA,
+    0xFDC0,
+    0x0004,
+    0xF004,
+    0xFA27,
+    0x0020,
+    0xF004,
+    0xFE9A,
+    0x4B5B,
+    0x4A5C,
+    0x681B,
+    0x4C56,
+    0x6193,
+    0x4B5B,
+    0x4855,
+    0x6819,
+    0x4B5A,
+    0x6019,
+    0x4B5A,
+    0x6819,
+    0x4B5A,
+    0x6019,
+    0x494F,
+    0x780B,
+    0x8823,
+    0x780B,
+    0x8821,
+    0x041B,
+    0x430B,
+    0x4957,
+    0x6053,
+    0x780B,
+    0x43B3,
+    0x4333,
+    0x700B,
+    0x237F,
+    0x9C01,
+    0x6911,
+    0x401C,
+    0x4399,
+    0x0023,
+    0x4333,
+    0x430B,
+    0x6113,
+    0x7803,
+    0x2380,
+    0x6911,
+    0x4399,
+    0x7803,
+    0x0028,
+    0x4398,
+    0x01C3,
+    0x430B,
+    0x6113,
+    0x68BB,
+    0x2700,
+    0x89DB,
+    0x4930,
+    0x4849,
+    0x185B,
+    0x6819,
+    0x790C,
+    0x6813,
+    0x3108,
+    0x43AB,
+    0x6013,
+    0x9B00,
+    0x4A46,
+    0xB2E4,
+    0x189B,
+    0x881B,
+    0x4A45,
+    0xB29B,
+    0x8013,
+    0x9A03,
+    0x4B44,
+    0x09A4,
+    0x701A,
+    0x4B43,
+    0x2206,
+    0x701F,
+    0xF00B,
+    0xF88F,
+    0x2102,
+    0x2004,
+    0x4B41,
+    0x402C,
+    0x781A,
+    0x43AA,
+    0x4314,
+    0x701C,
+    0x781A,
+    0x438A,
+    0x430A,
+    0x701A,
+    0x781A,
+    0x4382,
+    0x701A,
+    0x781A,
+    0x1800,
+    0x4382,
+    0x701A,
+    0x2210,
+    0x7818,
+    0x4390,
+    0x4302,
+    0x701A,
+    0x2220,
+    0x7818,
+    0x4390,
+    0x4302,
+    0x701A,
+    0x781A,
+    0x43B2,
+    0x4316,
+    0x4A33,
+    0x701E,
+    0x4694,
+    0x9B00,
+    0x4A32,
+    0x4463,
+    0x881B,
+    0xB29B,
+    0x8013,
+    0x4B30,
+    0x7019,
+    0x9A02,
+    0x4B30,
+    0x701A,
+    0x22FF,
+    0x4B2F,
+    0x801F,
+    0x4B2F,
+    0x701A,
+    0xF7FF,
+    0xF9EE,
+    0x0038,
+    0xB005,
+    0xBDF0,
+    0x4A2D,
+    0xE701,
+    0x4A2D,
+    0xE6FF,
+    0x2802,
+    0xD000,
+    0xE714,
+    0x4A2B,
+    0xE70D,
+    0x4A2B,
+    0xE72A,
+    0x0174,
+    0x4203,
+    0x017E,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xC8C8,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x1998,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x1993,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0x012E,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x800A,
+    0x4203,
+    0x0120,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0124,
+    0x4203,
+    0xD0CC,
+    0x4200,
+    0x0128,
+    0x4203,
+    0xD0D0,
+    0x4200,
+    0x01EA,
+    0x4203,
+    0x01D0,
+    0x4203,
+    0x8020,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01CC,
+    0x4203,
+    0x01CD,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x8022,
+    0x4203,
+    0x01D8,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x011E,
+    0x4203,
+    0xB510,
+    0x2102,
+    0xF7FF,
+    0xFE72,
+    0xBD10,
+    0xB510,
+    0x2104,
+    0xF7FF,
+    0xFE6D,
+    0xBD10,
+    0xB510,
+    0x4B05,
+    0x7D5B,
+    0x2B00,
+    0xD102,
+    0xF005,
+    0xFD0D,
+    0xBD10,
+    0xF001,
+    0xFE2C,
+    0xE7FB,
+    0x46C0,
+    0xC8C8,
+    0x4203,
+    0xB5F0,
+    0x4B47,
+    0x0005,
+    0x0010,
+    0x4A46,
+    0x881B,
+    0x7812,
+    0x686E,
+    0x4351,
+    0x220F,
+    0x18CB,
+    0xB087,
+    0x9304,
+    0x7833,
+    0xB2DC,
+    0x4013,
+    0x2800,
+    0xD100,
+    0xE06D,
+    0x2000,
+    0x2B05,
+    0xD14B,
+    0x4B3E,
+    0x09A4,
+    0x689B,
+    0x4F3E,
+    0x89DB,
+    0xB29A,
+    0x9205,
+    0x4A3D,
+    0x189B,
+    0x1CB2,
+    0x9203,
+    0x2201,
+    0x681B,
+    0x4214,
+    0xD03E,
+    0x0018,
+    0x213F,
+    0x79F6,
+    0x300E,
+    0x438E,
+    0x2E40,
+    0xD137,
+    0x783F,
+    0xB2FE,
+    0x2FFF,
+    0xD138,
+    0x2780,
+    0x791A,
+    0x9903,
+    0x43BA,
+    0x0017,
+    0x01E2,
+    0xB2D2,
+    0x433A,
+    0x711A,
+    0x2206,
+    0xF00A,
+    0xFFA0,
+    0x2300,
+    0x492E,
+    0x9A05,
+    0x468C,
+    0x4333,
+    0x4462,
+    0x8013,
+    0x2201,
+    0x4B27,
+    0x9C04,
+    0x759A,
+    0x4B2A,
+    0x482A,
+    0x469C,
+    0x4464,
+    0x7823,
+    0xB2DB,
+    0x772B,
+    0x0029,
+    0xF7FA,
+    0xFD6B,
+    0x4A27,
+    0x4927,
+    0x7823,
+    0x8812,
+    0x7809,
+    0x2001,
+    0x434B,
+    0x189B,
+    0x4A25,
+    0x189B,
+    0x2204,
+    0x7819,
+    0x4391,
+    0x430A,
+    0x701A,
+    0x4B19,
+    0x7558,
+    0xB007,
+    0xBDF0,
+    0x0018,
+    0x783E,
+    0x300E,
+    0xB2F6,
+    0xE7C6,
+    0x4F1E,
+    0x4916,
+    0x883F,
+    0x187F,
+    0x00F1,
+    0x468C,
+    0x4467,
+    0x783F,
+    0x093F,
+    0x4217,
+    0xD1BB,
+    0x2480,
+    0x791F,
+    0x9903,
+    0x43A7,
+    0x433C,
+    0x711C,
+    0x0033,
+    0x9200,
+    0xF7FA,
+    0xFC88,
+    0x2380,
+    0x00DB,
+    0xE7BB,
+    0x2B03,
+    0xD1DE,
+    0x2201,
+    0x4B07,
+    0x9C04,
+    0x759A,
+    0x4B0A,
+    0x480F,
+    0x469C,
+    0x4464,
+    0x7823,
+    0xB2DB,
+    0x772B,
+    0xE7BE,
+    0x46C0,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0xC8C8,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x801A,
+    0x4203,
+    0x8003,
+    0x4203,
+    0x0238,
+    0x4203,
+    0x0174,
+    0x4203,
+    0x017E,
+    0x4203,
+    0x8026,
+    0x4203,
+    0x01F0,
+    0x4203,
+    0x0236,
+    0x4203,
+    0x4B06,
+    0x4A07,
+    0x881B,
+    0x7812,
+    0x4350,
+    0x2201,
+    0x18C0,
+    0x4B05,
+    0x18C0,
+    0x7803,
+    0x4393,
+    0x7003,
+    0x4770,
+    0x46C0,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xB570,
+    0x000B,
+    0x2601,
+    0x2406,
+    0x4033,
+    0x425B,
+    0x401C,
+    0x2306,
+    0x078D,
+    0x0889,
+    0x4031,
+    0x17ED,
+    0x1864,
+    0x402B,
+    0x191B,
+    0x1818,
+    0x7A03,
+    0x7A41,
+    0x4D0B,
+    0x4C0C,
+    0x0209,
+    0x8828,
+    0x4319,
+    0x7823,
+    0x4353,
+    0x181B,
+    0x4809,
+    0x181B,
+    0x2004,
+    0x781E,
+    0x4386,
+    0x4330,
+    0x7018,
+    0x882B,
+    0x7820,
+    0x4342,
+    0x18D2,
+    0x4B05,
+    0x18D2,
+    0x8011,
+    0xBD70,
+    0x46C0,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8006,
+    0x4203,
+    0x4B07,
+    0x4A08,
+    0x881B,
+    0x7812,
+    0x00C0,
+    0x4351,
+    0x2208,
+    0x18C9,
+    0x4B05,
+    0x4010,
+    0x18C9,
+    0x780B,
+    0x4393,
+    0x4318,
+    0x7008,
+    0x4770,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xB5F0,
+    0xB089,
+    0x0004,
+    0x000D,
+    0xF001,
+    0xFA82,
+    0x9002,
+    0x28FF,
+    0xD100,
+    0xE107,
+    0xF001,
+    0xF9DA,
+    0x9003,
+    0x9007,
+    0x28FF,
+    0xD100,
+    0xE100,
+    0x4B87,
+    0x8819,
+    0x4B87,
+    0xB289,
+    0x781B,
+    0x6866,
+    0xB2DB,
+    0x78B2,
+    0x0692,
+    0xD100,
+    0xE0CE,
+    0x78F4,
+    0x2701,
+    0x0022,
+    0xB2E0,
+    0x403A,
+    0x423C,
+    0xD000,
+    0x2206,
+    0x2402,
+    0x0007,
+    0x4027,
+    0x4220,
+    0xD000,
+    0x2706,
+    0x2403,
+    0x0880,
+    0x4020,
+    0x19D2,
+    0x1812,
+    0x3E04,
+    0x1996,
+    0x7A30,
+    0x7A72,
+    0x7AB6,
+    0x0212,
+    0x0436,
+    0x4332,
+    0x4302,
+    0x4F75,
+    0x0656,
+    0x17F6,
+    0x403E,
+    0x46B4,
+    0x26FA,
+    0x0076,
+    0x44B4,
+    0xB256,
+    0x43F6,
+    0x17F6,
+    0x9604,
+    0x9F04,
+    0x4E70,
+    0x203F,
+    0x403E,
+    0x362D,
+    0x36FF,
+    0x9604,
+    0x9E03,
+    0x4010,
+    0x4373,
+    0x185B,
+    0x21F8,
+    0x9301,
+    0x0C13,
+    0x021E,
+    0x0149,
+    0x0412,
+    0x4031,
+    0x0E12,
+    0x430A,
+    0x9904,
+    0x4E67,
+    0x4351,
+    0x9A01,
+    0x9105,
+    0x4966,
+    0x270C,
+    0x1851,
+    0x2200,
+    0x800A,
+    0x9A01,
+    0x095B,
+    0x1992,
+    0x7015,
+    0x9A01,
+    0x4D62,
+    0x4E62,
+    0x1952,
+    0x2501,
+    0x7010,
+    0x68B2,
+    0x68B2,
+    0x7808,
+    0x0852,
+    0x43A8,
+    0x402A,
+    0x4302,
+    0x700A,
+    0x485D,
+    0x9A01,
+    0x1812,
+    0x7815,
+    0x0098,
+    0x43BD,
+    0x4038,
+    0x4328,
+    0x7010,
+    0x7810,
+    0x4023,
+    0x43A0,
+    0x4303,
+    0x7013,
+    0x2302,
+    0x7808,
+    0x4C56,
+    0x4398,
+    0x4318,
+    0x7008,
+    0x2110,
+    0x7810,
+    0x3F05,
+    0x4388,
+    0x4301,
+    0x7011,
+    0x6C62,
+    0x6C61,
+    0x9A01,
+    0x0A09,
+    0x4039,
+    0x428B,
+    0x419B,
+    0x2104,
+    0x484E,
+    0x425B,
+    0x1815,
+    0x782A,
+    0x009B,
+    0x438A,
+    0x4313,
+    0x702B,
+    0x4B4B,
+    0x3139,
+    0x781B,
+    0xB2DB,
+    0x9306,
+    0x4B4A,
+    0x8818,
+    0x4460,
+    0x0140,
+    0xF7F9,
+    0xF82F,
+    0x0040,
+    0x9905,
+    0xB280,
+    0xF002,
+    0xF863,
+    0x6BE2,
+    0x0001,
+    0x6C60,
+    0x0A00,
+    0x4038,
+    0x2700,
+    0x2804,
+    0xD807,
+    0xF7F8,
+    0xFF78,
+    0x5F03,
+    0x6361,
+    0x0065,
+    0x4B3F,
+    0x881F,
+    0x427F,
+    0x23E3,
+    0x009B,
+    0x58F0,
+    0x6C63,
+    0x2601,
+    0x469C,
+    0x9B06,
+    0x4C3B,
+    0x1AD2,
+    0x4663,
+    0x0B80,
+    0x6824,
+    0x4030,
+    0x0ADB,
+    0x00C0,
+    0x4033,
+    0x1882,
+    0x00DB,
+    0x0724,
+    0x1AD3,
+    0x1764,
+    0x9A05,
+    0x1B1B,
+    0x1A5B,
+    0x189B,
+    0x4833,
+    0x9A01,
+    0x19DB,
+    0x1812,
+    0x6013,
+    0x9B06,
+    0x185A,
+    0x40B2,
+    0x4930,
+    0x9B04,
+    0x468C,
+    0x18D2,
+    0x9B01,
+    0x4463,
+    0x601A,
+    0x2302,
+    0x782A,
+    0x439A,
+    0x4313,
+    0x702B,
+    0x4D2B,
+    0x4C2B,
+    0x882A,
+    0x9902,
+    0x7823,
+    0x0008,
+    0x434B,
+    0x189B,
+    0x4A1A,
+    0x189B,
+    0x9A03,
+    0x701A,
+    0xF001,
+    0xFA1B,
+    0x2800,
+    0xD118,
+    0x8828,
+    0x7823,
+    0x9C02,
+    0x4923,
+    0x4363,
+    0x780A,
+    0x181B,
+    0x4814,
+    0xB2D2,
+    0x181B,
+    0x701A,
+    0x700C,
+    0xF007,
+    0xF9C3,
+    0x2201,
+    0x9803,
+    0x491E,
+    0x4082,
+    0x880B,
+    0x4393,
+    0x800B,
+    0xF007,
+    0xF9C2,
+    0x23FF,
+    0x9307,
+    0x9807,
+    0xB009,
+    0xBDF0,
+    0x4B19,
+    0xE7A2,
+    0x4B19,
+    0xE7A0,
+    0x4B19,
+    0xE79E,
+    0x4B19,
+    0xE79C,
+    0x46C0,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0xFE3E,
+    0xFFFF,
+    0xFEF2,
+    0xFFFF,
+    0x8000,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x8001,
+    0x4203,
+    0xD000,
+    0x4200,
+    0x8002,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x8015,
+    0x4203,
+    0x0112,
+    0x4203,
+    0x010E,
+    0x4203,
+    0x0252,
+    0x4203,
+    0xD0D4,
+    0x4200,
+    0x8004,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x0164,
+    0x4203,
+    0x016E,
+    0x4203,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x025A,
+    0x4203,
+    0xB537,
+    0x0004,
+    0xAD01,
+    0x0028,
+    0x2203,
+    0x4902,
+    0xF00A,
+    0xFD7C,
+    0x5D28,
+    0xBD3E,
+    0x199D,
+    0x1003,
+    0xB510,
+    0x0004,
+    0x6840,
+    0x7883,
+    0x069B,
+    0xD00F,
+    0x78C3,
+    0x06DB,
+    0xD50C,
+    0x3804,
+    0xF001,
+    0xFAFA,
+    0x2800,
+    0xD007,
+    0xF007,
+    0xF95E,
+    0x2109,
+    0x0020,
+    0xF7FF,
+    0xFE8E,
+    0xF007,
+    0xF960,
+    0x2000,
+    0xBD10,
+    0xB510,
+    0x2001,
+    0xF7FB,
+    0xFE92,
+    0xBD10,
+    0x0000,
+    0xB5F0,
+    0x6847,
+    0x0005,
+    0x78BB,
+    0xB085,
+    0x069B,
+    0xD00C,
+    0x2000,
+    0x2201,
+    0x78FB,
+    0xB2DB,
+    0x9301,
+    0x4B52,
+    0x7819,
+    0xB2CB,
+    0x9300,
+    0x9B00,
+    0xB2C6,
+    0x42B3,
+    0xD802,
+    0x2000,
+    0xB005,
+    0xBDF0,
+    0x4B4E,
+    0x881C,
+    0x4B4E,
+    0x781B,
+    0x9002,
+    0x4343,
+    0x484D,
+    0x191B,
+    0x181C,
+    0x7820,
+    0x4684,
+    0x4661,
+    0x4010,
+    0x9003,
+    0x9802,
+    0x3001,
+    0x4211,
+    0xD1E6,
+    0x4948,
+    0x7022,
+    0x185B,
+    0x21FF,
+    0x7019,
+    0x78BB,
+    0x4946,
+    0x099B,
+    0x6949,
+    0x9300,
+    0x4B45,
+    0x6C5B,
+    0x7FC8,
+    0x055B,
+    0x0880,
+    0x0F5B,
+    0x4210,
+    0xD108,
+    0x7FCA,
+    0x2000,
+    0x0652,
+    0xD507,
+    0x3002,
+    0x4298,
+    0x4180,
+    0x4240,
+    0xE002,
+    0x0018,
+    0x2B01,
+    0xD1F3,
+    0x0031,
+    0xB2C0,
+    0xF7FF,
+    0xFE23,
+    0x9B01,
+    0x3F04,
+    0x06DB,
+    0xD559,
+    0x0038,
+    0xF001,
+    0xFA96,
+    0x2800,
+    0xD02A,
+    0xF007,
+    0xF8FA,
+    0x210A,
+    0x0028,
+    0xF7FF,
+    0xFE2A,
+    0x0004,
+    0xF007,
+    0xF8FB,
+    0x2CFF,
+    0xD04D,
+    0x4B30,
+    0x4A30,
+    0x881B,
+    0x7812,
+    0x2110,
+    0x4354,
+    0x18E4,
+    0x4B2E,
+    0x9A00,
+    0x18E3,
+    0x701E,
+    0x4B2D,
+    0x18E3,
+    0x2A02,
+    0xD130,
+    0x781A,
+    0x438A,
+    0x430A,
+    0x701A,
+    0x2120,
+    0x781A,
+    0x438A,
+    0x9903,
+    0x430A,
+    0x701A,
+    0x4B27,
+    0x18E4,
+    0x2302,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0x9B01,
+    0x071B,
+    0xD504,
+    0x0032,
+    0x0038,
+    0x9901,
+    0xF7FF,
+    0xFDB5,
+    0x4B16,
+    0x9C02,
+    0x8818,
+    0x4B15,
+    0x491F,
+    0x781B,
+    0x780A,
+    0x435C,
+    0x1823,
+    0x4814,
+    0xB2D2,
+    0x181B,
+    0x701A,
+    0x23FF,
+    0x700B,
+    0x3BF8,
+    0x481A,
+    0x772E,
+    0x0029,
+    0x776B,
+    0xF7FA,
+    0xFA9D,
+    0x2001,
+    0xE775,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x9A00,
+    0x3A01,
+    0x4251,
+    0x414A,
+    0x0152,
+    0x9203,
+    0xE7C8,
+    0x9B00,
+    0x3B01,
+    0x2B01,
+    0xD8D1,
+    0x0030,
+    0xF7FF,
+    0xFD78,
+    0xE762,
+    0x46C0,
+    0x017A,
+    0x4203,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8005,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8003,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x8015,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x0236,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFF29,
+    0xBD10,
+    0xB5F0,
+    0x4BBC,
+    0xB089,
+    0x9102,
+    0x78C1,
+    0x881A,
+    0x4BBA,
+    0x2701,
+    0x781B,
+    0x0005,
+    0x434B,
+    0x2100,
+    0x189B,
+    0x4AB8,
+    0x9304,
+    0x189B,
+    0x781B,
+    0x4AB7,
+    0x085B,
+    0x6011,
+    0x001A,
+    0x403A,
+    0x9205,
+    0x423B,
+    0xD009,
+    0x2305,
+    0x7303,
+    0x7D02,
+    0x3303,
+    0x439A,
+    0x4313,
+    0x7503,
+    0x2002,
+    0xB009,
+    0xBDF0,
+    0x7843,
+    0x4EAE,
+    0xB2DB,
+    0x9301,
+    0x7D03,
+    0xB2DB,
+    0x9307,
+    0x7883,
+    0x7881,
+    0x089B,
+    0xB2CA,
+    0x9206,
+    0x2203,
+    0x4011,
+    0x4013,
+    0x003A,
+    0x409A,
+    0x9103,
+    0xB2D3,
+    0x7D01,
+    0x7882,
+    0x4039,
+    0x0952,
+    0x0018,
+    0x403A,
+    0x9300,
+    0xF7FA,
+    0xF929,
+    0x0004,
+    0xF003,
+    0xFD90,
+    0x0020,
+    0xF004,
+    0xFA03,
+    0x4B9F,
+    0x499F,
+    0x681B,
+    0x4C9F,
+    0x61B3,
+    0x4B9F,
+    0x681A,
+    0x4B9F,
+    0x601A,
+    0x4B9F,
+    0x681A,
+    0x4B9F,
+    0x601A,
+    0x4A9F,
+    0x7813,
+    0x880B,
+    0x7813,
+    0x880A,
+    0x2140,
+    0x041B,
+    0x4313,
+    0x4A9C,
+    0x6073,
+    0x7813,
+    0x438B,
+    0x430B,
+    0x7013,
+    0x237F,
+    0x6932,
+    0x9801,
+    0x439A,
+    0x4003,
+    0x430B,
+    0x4897,
+    0x4313,
+    0x6133,
+    0x7803,
+    0x2380,
+    0x6932,
+    0x439A,
+    0x7803,
+    0x0038,
+    0x4398,
+    0x01C3,
+    0x4313,
+    0x9801,
+    0x6133,
+    0xF005,
+    0xF9B0,
+    0x6833,
+    0x9802,
+    0x43BB,
+    0x6033,
+    0x2380,
+    0x4A8E,
+    0x8013,
+    0x2800,
+    0xD100,
+    0xE092,
+    0x4B8C,
+    0x2108,
+    0x701F,
+    0x9A05,
+    0x4B8B,
+    0x701A,
+    0x2202,
+    0x7823,
+    0x4393,
+    0x7023,
+    0x7823,
+    0x1892,
+    0x4393,
+    0x4313,
+    0x7023,
+    0x7823,
+    0x438B,
+    0x7023,
+    0x7823,
+    0x1849,
+    0x438B,
+    0x7023,
+    0x2320,
+    0x7821,
+    0x4399,
+    0x430B,
+    0x2140,
+    0x7023,
+    0x7823,
+    0x438B,
+    0x430B,
+    0x7023,
+    0x4B7E,
+    0x701A,
+    0x9A00,
+    0x4B7E,
+    0x701A,
+    0x9A05,
+    0x4B7D,
+    0x801A,
+    0x23FF,
+    0x2007,
+    0x4A7C,
+    0x7013,
+    0x9B03,
+    0x1C59,
+    0x4B7B,
+    0x695A,
+    0x4382,
+    0x430A,
+    0x615A,
+    0x2902,
+    0xD100,
+    0xE0B9,
+    0x9A03,
+    0x3A02,
+    0x2A01,
+    0xD900,
+    0xE0B2,
+    0x4A76,
+    0x2400,
+    0x7812,
+    0xB2D2,
+    0xB2D0,
+    0x7658,
+    0x4874,
+    0x7004,
+    0x4C74,
+    0x4874,
+    0x5C64,
+    0x1B12,
+    0x4C74,
+    0x5C64,
+    0x4362,
+    0x6002,
+    0x2901,
+    0xD000,
+    0xE0A3,
+    0x4A71,
+    0x7811,
+    0x7812,
+    0x4971,
+    0xB2D2,
+    0x630A,
+    0x4A70,
+    0x7811,
+    0x6A18,
+    0x7812,
+    0x496F,
+    0x1E54,
+    0x41A2,
+    0x24F0,
+    0x4008,
+    0x0412,
+    0x4302,
+    0x621A,
+    0x4A6C,
+    0x7810,
+    0x69D8,
+    0x7812,
+    0x43A0,
+    0x0912,
+    0x0112,
+    0x4302,
+    0x61DA,
+    0x9A06,
+    0x0792,
+    0xD500,
+    0xE089,
+    0x4A67,
+    0x7812,
+    0x484B,
+    0xB2D2,
+    0x761A,
+    0x4A4F,
+    0x7812,
+    0x8800,
+    0x0412,
+    0x4302,
+    0x625A,
+    0x2240,
+    0x9801,
+    0x4302,
+    0x484D,
+    0x841A,
+    0x7802,
+    0x6A1A,
+    0x4011,
+    0x7802,
+    0x2001,
+    0x0004,
+    0x0852,
+    0x4394,
+    0x0422,
+    0x430A,
+    0x621A,
+    0x6A1A,
+    0x495A,
+    0x400A,
+    0x621A,
+    0x6919,
+    0x9A07,
+    0x4381,
+    0x4002,
+    0x430A,
+    0x611A,
+    0xE70D,
+    0x0028,
+    0xF001,
+    0xFB24,
+    0x003B,
+    0x4083,
+    0x4A40,
+    0xB2DB,
+    0x7013,
+    0x9A02,
+    0x4B3F,
+    0x4E51,
+    0x701A,
+    0x6971,
+    0x2206,
+    0x7F8D,
+    0x484F,
+    0x3118,
+    0xF00A,
+    0xFB62,
+    0x7823,
+    0xB2ED,
+    0x43BB,
+    0x403D,
+    0x431D,
+    0x2302,
+    0x2004,
+    0x7025,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0x6973,
+    0x7FDA,
+    0x7FDA,
+    0x7821,
+    0x0892,
+    0x4381,
+    0x4002,
+    0x430A,
+    0x7022,
+    0x7F9A,
+    0x7F9A,
+    0x7821,
+    0x1800,
+    0x0092,
+    0x4381,
+    0x4002,
+    0x430A,
+    0x2110,
+    0x7022,
+    0x7822,
+    0x3018,
+    0x438A,
+    0x7022,
+    0x7FDA,
+    0x7FDA,
+    0x7821,
+    0x0092,
+    0x4381,
+    0x4002,
+    0x430A,
+    0x7022,
+    0x7FDA,
+    0x7FDA,
+    0x7821,
+    0x3020,
+    0x0052,
+    0x4002,
+    0x4381,
+    0x430A,
+    0x7022,
+    0x8ADB,
+    0x4A34,
+    0xB29B,
+    0x8013,
+    0x2314,
+    0x4A1F,
+    0x7013,
+    0x9A00,
+    0x4B1E,
+    0x701A,
+    0x9A02,
+    0x4B1E,
+    0x801A,
+    0x4A2F,
+    0x9B04,
+    0x4694,
+    0x4463,
+    0x781B,
+    0xB2DB,
+    0xE73A,
+    0x4A2C,
+    0xE74B,
+    0x4A2C,
+    0xE749,
+    0x2902,
+    0xD000,
+    0xE75E,
+    0x4A2B,
+    0xE757,
+    0x4A2B,
+    0xE774,
+    0x46C0,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0xC8E0,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0120,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x0124,
+    0x4203,
+    0xD0CC,
+    0x4200,
+    0x0128,
+    0x4203,
+    0xD0D0,
+    0x4200,
+    0x012E,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01CC,
+    0x4203,
+    0x01CD,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x19A9,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x19A4,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0xC89C,
+    0x4203,
+    0x01D0,
+    0x4203,
+    0x01D8,
+    0x4203,
+    0x8005,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x011E,
+    0x4203,
+    0xB570,
+    0x4B17,
+    0x0004,
+    0x4817,
+    0x881B,
+    0x7800,
+    0x2501,
+    0x4342,
+    0x18D2,
+    0x4B15,
+    0x18D3,
+    0x781B,
+    0x089B,
+    0x0018,
+    0x4028,
+    0x422B,
+    0xD01C,
+    0x08CB,
+    0x422B,
+    0xD018,
+    0x000B,
+    0x2006,
+    0x402B,
+    0x425B,
+    0x4018,
+    0x2306,
+    0x078E,
+    0x0889,
+    0x4029,
+    0x17F6,
+    0x1840,
+    0x4033,
+    0x181B,
+    0x191B,
+    0x7A19,
+    0x7A58,
+    0x4B08,
+    0x0200,
+    0x18D2,
+    0x8813,
+    0x4308,
+    0x1AC0,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0xBD70,
+    0x0028,
+    0xE7FC,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8006,
+    0x4203,
+    0xB570,
+    0x2502,
+    0x780B,
+    0x70CA,
+    0x7D4C,
+    0xB2DB,
+    0x43AC,
+    0x754C,
+    0x7743,
+    0x3B0C,
+    0x7702,
+    0x2B01,
+    0xD802,
+    0x8A0B,
+    0xB29B,
+    0x8483,
+    0x0001,
+    0x4802,
+    0xF7FA,
+    0xF84C,
+    0xBD70,
+    0x46C0,
+    0x0236,
+    0x4203,
+    0x2308,
+    0x7301,
+    0x7D02,
+    0x439A,
+    0x4313,
+    0x7503,
+    0x4770,
+    0x0000,
+    0xB510,
+    0x0002,
+    0x4B1A,
+    0x481B,
+    0x881B,
+    0x7800,
+    0x4341,
+    0x18C9,
+    0x4B19,
+    0x18C8,
+    0x4B19,
+    0x18C9,
+    0x780B,
+    0xB2DB,
+    0x2A0B,
+    0xD814,
+    0x2100,
+    0x2A09,
+    0xD915,
+    0x4A16,
+    0x8811,
+    0x4A16,
+    0x7812,
+    0x4353,
+    0x4A15,
+    0x185B,
+    0x189B,
+    0x781B,
+    0x079B,
+    0x0FD9,
+    0x2B00,
+    0xDA08,
+    0x2105,
+    0xF7FF,
+    0xFFD5,
+    0x2101,
+    0xE003,
+    0x3A0C,
+    0x2100,
+    0x2A01,
+    0xD901,
+    0x0008,
+    0xBD10,
+    0x4A0D,
+    0x490D,
+    0x8812,
+    0x7809,
+    0x434B,
+    0x189B,
+    0x4A0C,
+    0x189B,
+    0x781B,
+    0xB2D9,
+    0x2B00,
+    0xD0F1,
+    0xE7E7,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8003,
+    0x4203,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x0184,
+    0x4203,
+    0x017B,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x0003,
+    0xB510,
+    0x6840,
+    0x6899,
+    0x789B,
+    0x2200,
+    0x071B,
+    0x0F9B,
+    0x1809,
+    0x2B03,
+    0xD001,
+    0x4A03,
+    0x5CD2,
+    0x1889,
+    0xF004,
+    0xFDA4,
+    0xBD10,
+    0x46C0,
+    0x19A1,
+    0x1003,
+    0xB5F0,
+    0xB085,
+    0x0005,
+    0xF7F9,
+    0xFECF,
+    0x2402,
+    0x2800,
+    0xD100,
+    0xE107,
+    0x2200,
+    0x4B8A,
+    0x2601,
+    0x761A,
+    0x621A,
+    0x78AB,
+    0x78AC,
+    0x089B,
+    0xB2E2,
+    0x9203,
+    0x2203,
+    0x4013,
+    0x4014,
+    0x0032,
+    0x409A,
+    0x786F,
+    0xB2D3,
+    0xB2F9,
+    0x9100,
+    0x7D29,
+    0x78AA,
+    0x4031,
+    0x0952,
+    0x4032,
+    0x0018,
+    0x9102,
+    0x9301,
+    0xF7F9,
+    0xFEBA,
+    0x0005,
+    0xF003,
+    0xFB21,
+    0x0028,
+    0xF003,
+    0xFF94,
+    0x4B7A,
+    0x4D7B,
+    0x681B,
+    0x497B,
+    0x61AB,
+    0x4B7B,
+    0x681A,
+    0x4B7B,
+    0x601A,
+    0x4B7B,
+    0x681A,
+    0x4B7B,
+    0x601A,
+    0x4A7B,
+    0x7813,
+    0x880B,
+    0x7813,
+    0x880A,
+    0x041B,
+    0x4313,
+    0x606B,
+    0x2340,
+    0x4977,
+    0x780A,
+    0x439A,
+    0x431A,
+    0x700A,
+    0x217F,
+    0x692A,
+    0x9800,
+    0x438A,
+    0x4001,
+    0x430B,
+    0x4313,
+    0x2280,
+    0x4972,
+    0x612B,
+    0x780B,
+    0x692B,
+    0x1C60,
+    0x4393,
+    0x780A,
+    0x4396,
+    0x01F6,
+    0x431E,
+    0x612E,
+    0x2607,
+    0x4B6D,
+    0x695A,
+    0x43B2,
+    0x4302,
+    0x615A,
+    0x2802,
+    0xD100,
+    0xE0B2,
+    0x1EA2,
+    0x2A01,
+    0xD900,
+    0xE0AC,
+    0x4A68,
+    0x2700,
+    0x7812,
+    0xB2D2,
+    0xB2D6,
+    0x765E,
+    0x4E66,
+    0x7037,
+    0x4F66,
+    0x4E66,
+    0x5C3F,
+    0x1BD2,
+    0x4F66,
+    0x5C38,
+    0x4350,
+    0x6030,
+    0x2C00,
+    0xD000,
+    0xE09D,
+    0x4A63,
+    0x7810,
+    0x7812,
+    0x4863,
+    0xB2D2,
+    0x6302,
+    0x4A62,
+    0x7810,
+    0x6A1C,
+    0x7812,
+    0x4861,
+    0x1E56,
+    0x41B2,
+    0x26F0,
+    0x4004,
+    0x0412,
+    0x4322,
+    0x4C5F,
+    0x621A,
+    0x7822,
+    0x69DA,
+    0x7824,
+    0x43B2,
+    0x0924,
+    0x0124,
+    0x4314,
+    0x9A03,
+    0x61DC,
+    0x0792,
+    0xD500,
+    0xE083,
+    0x4A59,
+    0x7812,
+    0x2640,
+    0xB2D2,
+    0x761A,
+    0x4A48,
+    0x4C43,
+    0x7812,
+    0x8824,
+    0x0412,
+    0x4322,
+    0x2401,
+    0x625A,
+    0x9A00,
+    0x4332,
+    0x841A,
+    0x780A,
+    0x6A1A,
+    0x4010,
+    0x780A,
+    0x0021,
+    0x0852,
+    0x4391,
+    0x040A,
+    0x4302,
+    0x621A,
+    0x6A1A,
+    0x494C,
+    0x9800,
+    0x400A,
+    0x621A,
+    0x691A,
+    0x9902,
+    0x43A2,
+    0x4311,
+    0x6119,
+    0xF004,
+    0xFEDF,
+    0x682B,
+    0x2180,
+    0x43A3,
+    0x602B,
+    0x2300,
+    0x2502,
+    0x4A45,
+    0x4F2C,
+    0x8013,
+    0x4A44,
+    0x4845,
+    0x8011,
+    0x4A45,
+    0x7015,
+    0x4A45,
+    0x7013,
+    0x6979,
+    0x2206,
+    0x7F8B,
+    0x3118,
+    0xB2DB,
+    0x9300,
+    0xF00A,
+    0xF929,
+    0x4B41,
+    0x9A00,
+    0x7819,
+    0x4022,
+    0x43A1,
+    0x430A,
+    0x2104,
+    0x2008,
+    0x701A,
+    0x781A,
+    0x43AA,
+    0x4315,
+    0x701D,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x697A,
+    0x2720,
+    0x7F91,
+    0x7F91,
+    0x781D,
+    0x0089,
+    0x4385,
+    0x4001,
+    0x4329,
+    0x2510,
+    0x7019,
+    0x7819,
+    0x43A9,
+    0x7019,
+    0x7F91,
+    0x7F91,
+    0x781D,
+    0x0089,
+    0x43BD,
+    0x4039,
+    0x4329,
+    0x7019,
+    0x7F91,
+    0x7F91,
+    0x781D,
+    0x0089,
+    0x4031,
+    0x43B5,
+    0x4329,
+    0x7019,
+    0x8AD3,
+    0x4A2A,
+    0xB29B,
+    0x8013,
+    0x4B2A,
+    0x7018,
+    0x9A01,
+    0x4B29,
+    0x701A,
+    0x22FF,
+    0x4B29,
+    0x701A,
+    0x0020,
+    0xB005,
+    0xBDF0,
+    0x4A27,
+    0xE751,
+    0x4A27,
+    0xE74F,
+    0x2C01,
+    0xD000,
+    0xE764,
+    0x4A26,
+    0xE75D,
+    0x4A26,
+    0xE77A,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x0120,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x012C,
+    0x4203,
+    0x0124,
+    0x4203,
+    0xD0CC,
+    0x4200,
+    0x0128,
+    0x4203,
+    0xD0D0,
+    0x4200,
+    0x012E,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x19A9,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x19A4,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x011D,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01E0,
+    0x4203,
+    0x01DC,
+    0x4203,
+    0x01DD,
+    0x4203,
+    0x01E6,
+    0x4203,
+    0x01E8,
+    0x4203,
+    0x01FC,
+    0x4203,
+    0x01FD,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x011E,
+    0x4203,
+    0xB510,
+    0x4B0A,
+    0x4A0A,
+    0x490B,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x434B,
+    0x4909,
+    0x189B,
+    0x185B,
+    0x7818,
+    0x4A08,
+    0x4B09,
+    0x881B,
+    0x7812,
+    0x4350,
+    0x18C0,
+    0x1840,
+    0xF7FF,
+    0xFE6B,
+    0xBD10,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x016A,
+    0x4203,
+    0xB5F7,
+    0x4B48,
+    0x9001,
+    0x7E1A,
+    0x2A00,
+    0xD000,
+    0x6218,
+    0x2207,
+    0x4B45,
+    0x4C46,
+    0x6C58,
+    0x6963,
+    0x0A00,
+    0x4010,
+    0x4393,
+    0x4303,
+    0x4F43,
+    0x4944,
+    0x4E44,
+    0x4A45,
+    0x6163,
+    0x2804,
+    0xD837,
+    0xF7F8,
+    0xF9B3,
+    0x1003,
+    0x2920,
+    0x0029,
+    0x2500,
+    0x4B41,
+    0x781B,
+    0xB2DB,
+    0x7663,
+    0x3B08,
+    0x703D,
+    0x015B,
+    0x600B,
+    0x2802,
+    0xD13D,
+    0x4B3D,
+    0xE009,
+    0x2500,
+    0x4B3C,
+    0x781B,
+    0xB2DB,
+    0x7663,
+    0x3B01,
+    0x00DB,
+    0x703D,
+    0x600B,
+    0x4B39,
+    0x7819,
+    0x781B,
+    0x4939,
+    0xB2DB,
+    0x630B,
+    0xE019,
+    0x2500,
+    0x4B37,
+    0x781B,
+    0xB2DB,
+    0x7663,
+    0x3B02,
+    0x703D,
+    0x009B,
+    0xE7E1,
+    0x2500,
+    0x4B34,
+    0x781B,
+    0xB2DB,
+    0x7663,
+    0x703D,
+    0x4F32,
+    0x5C3F,
+    0x1BDF,
+    0x4B32,
+    0x5C1B,
+    0x437B,
+    0xE7D4,
+    0x2300,
+    0x7663,
+    0x703B,
+    0x600B,
+    0x4B2F,
+    0x7819,
+    0x6A21,
+    0x781B,
+    0x4031,
+    0x1E5F,
+    0x41BB,
+    0x041B,
+    0x430B,
+    0x6223,
+    0x7813,
+    0x23F0,
+    0x69E1,
+    0x4399,
+    0x7813,
+    0x091B,
+    0x011B,
+    0xE00C,
+    0x2800,
+    0xD1EB,
+    0x6A23,
+    0x4033,
+    0x6223,
+    0x7813,
+    0x23F0,
+    0x69E1,
+    0x4399,
+    0x7813,
+    0x22FF,
+    0x011B,
+    0x4013,
+    0x430B,
+    0x61E3,
+    0xF004,
+    0xFDF0,
+    0x2801,
+    0xD816,
+    0x4B1D,
+    0x781B,
+    0x9801,
+    0xB2DB,
+    0x7623,
+    0x4B1C,
+    0x781A,
+    0x6A22,
+    0x7819,
+    0x2301,
+    0x0849,
+    0x438B,
+    0x4032,
+    0x041B,
+    0x4313,
+    0x6223,
+    0x6A23,
+    0x4A17,
+    0x4013,
+    0x6223,
+    0xF00A,
+    0xF946,
+    0xBDFE,
+    0x4B15,
+    0xE7E7,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x5000,
+    0x4200,
+    0x502A,
+    0x4200,
+    0xC900,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x024C,
+    0x4203,
+    0x0133,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x024E,
+    0x4203,
+    0x024F,
+    0x4203,
+    0x19A9,
+    0x1003,
+    0x19A4,
+    0x1003,
+    0x025C,
+    0x4203,
+    0x011D,
+    0x4203,
+    0x0113,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x011E,
+    0x4203,
+    0xB510,
+    0x4B10,
+    0x7E1A,
+    0x2A00,
+    0xD019,
+    0x2400,
+    0x6A19,
+    0x761C,
+    0x42A1,
+    0xD010,
+    0x220F,
+    0x684B,
+    0x781B,
+    0x4013,
+    0x2B08,
+    0xD109,
+    0x4809,
+    0xF7F9,
+    0xFD83,
+    0xF004,
+    0xFA67,
+    0x0020,
+    0xF7FB,
+    0xF8D4,
+    0xF7F9,
+    0xFC40,
+    0xBD10,
+    0x0008,
+    0xF7FB,
+    0xF8CE,
+    0xE7FA,
+    0xF7FB,
+    0xF937,
+    0xE7F7,
+    0xC89C,
+    0x4203,
+    0x023A,
+    0x4203,
+    0xB510,
+    0xF7FB,
+    0xF8FB,
+    0x2800,
+    0xD01D,
+    0x2201,
+    0x4B0E,
+    0x2080,
+    0x761A,
+    0x2300,
+    0x490D,
+    0x0040,
+    0x800B,
+    0x490D,
+    0x8008,
+    0x490D,
+    0x700A,
+    0x4A0D,
+    0x490D,
+    0x7013,
+    0x780A,
+    0x3302,
+    0x439A,
+    0x4313,
+    0x700B,
+    0x4B0B,
+    0x4A0B,
+    0x881B,
+    0x189B,
+    0x781B,
+    0x4A0A,
+    0xB2DB,
+    0x7013,
+    0xF004,
+    0xFC97,
+    0xBD10,
+    0xC89C,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01DC,
+    0x4203,
+    0x01DD,
+    0x4203,
+    0x01E6,
+    0x4203,
+    0x0178,
+    0x4203,
+    0x800D,
+    0x4203,
+    0x01FD,
+    0x4203,
+    0xB510,
+    0x2100,
+    0xF7FF,
+    0xFACE,
+    0xBD10,
+    0xB510,
+    0x2101,
+    0xF7FF,
+    0xFAC9,
+    0xBD10,
+    0xB5F7,
+    0x4B58,
+    0x4A58,
+    0x78C6,
+    0x881B,
+    0x7812,
+    0x7885,
+    0x4356,
+    0x2200,
+    0x18F6,
+    0x4B55,
+    0x0004,
+    0xB2ED,
+    0x601A,
+    0x290C,
+    0xD000,
+    0xE09A,
+    0x4B53,
+    0x881A,
+    0x4B53,
+    0x18F3,
+    0x781B,
+    0x469C,
+    0x4B52,
+    0x781F,
+    0x4B52,
+    0x18F3,
+    0x6819,
+    0x681B,
+    0x0C09,
+    0x9301,
+    0x4663,
+    0x435F,
+    0x4B4F,
+    0x19D2,
+    0xB292,
+    0x18D2,
+    0x9B01,
+    0x8A00,
+    0x4059,
+    0xB280,
+    0xB289,
+    0xF7F9,
+    0xFDB7,
+    0x0007,
+    0x7D21,
+    0x78A2,
+    0x2401,
+    0x0020,
+    0x072D,
+    0x0FAD,
+    0x40A8,
+    0x0952,
+    0x4022,
+    0x4021,
+    0xB2C0,
+    0xF7F9,
+    0xFBF6,
+    0x0005,
+    0xF003,
+    0xF85D,
+    0x0028,
+    0xF003,
+    0xFCD0,
+    0x4B3E,
+    0x4D40,
+    0x18F3,
+    0x681B,
+    0x0020,
+    0x61AB,
+    0x4B3E,
+    0x2180,
+    0x18F3,
+    0x681A,
+    0x4B3D,
+    0x601A,
+    0x4B3D,
+    0x18F3,
+    0x681A,
+    0x4B3D,
+    0x601A,
+    0x4B3D,
+    0x18F3,
+    0x781A,
+    0x4A3C,
+    0x18B6,
+    0x8832,
+    0x781B,
+    0x8832,
+    0x2640,
+    0x041B,
+    0x4313,
+    0x4A39,
+    0x606B,
+    0x7813,
+    0x43B3,
+    0x4333,
+    0x7013,
+    0x237F,
+    0x692A,
+    0x439A,
+    0x403B,
+    0x4333,
+    0x4313,
+    0x612B,
+    0x4B34,
+    0x781A,
+    0x692A,
+    0x781B,
+    0x438A,
+    0x4398,
+    0x01C3,
+    0x4313,
+    0x612B,
+    0x0038,
+    0xF004,
+    0xFC79,
+    0x2180,
+    0x682B,
+    0x2002,
+    0x43A3,
+    0x602B,
+    0x4B2C,
+    0x8019,
+    0x2100,
+    0x4B2C,
+    0x701C,
+    0x4B2C,
+    0x7019,
+    0x4B2C,
+    0x781A,
+    0x4382,
+    0x701A,
+    0x2204,
+    0x7818,
+    0x4390,
+    0x4302,
+    0x2008,
+    0x701A,
+    0x781A,
+    0x4382,
+    0x701A,
+    0x781A,
+    0x1800,
+    0x4382,
+    0x701A,
+    0x2220,
+    0x781D,
+    0x4395,
+    0x432A,
+    0x701A,
+    0x781A,
+    0x43B2,
+    0x4316,
+    0x701E,
+    0x4B20,
+    0x4A20,
+    0x7018,
+    0x4B20,
+    0x0020,
+    0x881B,
+    0x189B,
+    0x781B,
+    0x4A1F,
+    0xB2DB,
+    0x7013,
+    0x22FF,
+    0x4B1E,
+    0x8019,
+    0x4B1E,
+    0x701A,
+    0xBDFE,
+    0x2002,
+    0x290D,
+    0xD1FB,
+    0x7867,
+    0xB2FF,
+    0xE77A,
+    0x0184,
+    0x4203,
+    0x017B,
+    0x4203,
+    0xC8E0,
+    0x4203,
+    0x0186,
+    0x4203,
+    0x8007,
+    0x4203,
+    0x0181,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x800C,
+    0x4203,
+    0xD0CC,
+    0x4200,
+    0x8010,
+    0x4203,
+    0xD0D0,
+    0x4200,
+    0x8006,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x0113,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01CC,
+    0x4203,
+    0x01CD,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x0188,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0xB510,
+    0x210C,
+    0xF7FF,
+    0xFF14,
+    0xBD10,
+    0xB510,
+    0x210D,
+    0xF7FF,
+    0xFF0F,
+    0xBD10,
+    0xB570,
+    0x0016,
+    0x0004,
+    0x000D,
+    0xF006,
+    0xFA4E,
+    0x0031,
+    0x0020,
+    0xF7FE,
+    0xFF7E,
+    0x0004,
+    0xF006,
+    0xFA4F,
+    0x2006,
+    0x2CFF,
+    0xD009,
+    0x2000,
+    0x4B05,
+    0x4A05,
+    0x881B,
+    0x7812,
+    0x4354,
+    0x18E4,
+    0x4B04,
+    0x18E4,
+    0x7025,
+    0xBD70,
+    0x46C0,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8003,
+    0x4203,
+    0xB5F0,
+    0x0016,
+    0x4B29,
+    0x4A2A,
+    0x881B,
+    0x7814,
+    0xB085,
+    0x434C,
+    0x18E4,
+    0x4B28,
+    0x0005,
+    0x18E3,
+    0x781B,
+    0xB2DB,
+    0x9301,
+    0x4B26,
+    0x6018,
+    0x0030,
+    0xF7FF,
+    0xFBC8,
+    0x2800,
+    0xD125,
+    0x4B23,
+    0x18E3,
+    0x9303,
+    0x686B,
+    0x1F1A,
+    0x9202,
+    0x789A,
+    0x0692,
+    0xD106,
+    0x0028,
+    0x9A01,
+    0x9903,
+    0xF7FF,
+    0xFB98,
+    0x2001,
+    0xE016,
+    0x78DF,
+    0xB2FF,
+    0x2E0D,
+    0xD014,
+    0x0039,
+    0x9A01,
+    0x9802,
+    0xF7FF,
+    0xFB55,
+    0x2800,
+    0xD10D,
+    0x2201,
+    0x4B16,
+    0x18E3,
+    0x701A,
+    0x4B16,
+    0x18E4,
+    0x2308,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0x2000,
+    0xB005,
+    0xBDF0,
+    0x06FF,
+    0xD5DD,
+    0x9802,
+    0xF000,
+    0xFB86,
+    0x2800,
+    0xD0D8,
+    0x0033,
+    0x3B0C,
+    0x2B01,
+    0xD900,
+    0x260B,
+    0x0032,
+    0x0028,
+    0x9901,
+    0xF7FF,
+    0xFF8E,
+    0x2800,
+    0xD0CC,
+    0x4B06,
+    0x18E3,
+    0x7018,
+    0xE7DE,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8003,
+    0x4203,
+    0xC8E0,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x4B25,
+    0xB5F7,
+    0x6018,
+    0x4B25,
+    0x0004,
+    0x881A,
+    0x4B24,
+    0x000F,
+    0x781B,
+    0x434B,
+    0x189B,
+    0x9301,
+    0x9A01,
+    0x4B22,
+    0x4694,
+    0x4463,
+    0x781E,
+    0x9300,
+    0x6840,
+    0x4B20,
+    0x78C1,
+    0x7E1D,
+    0xB2F6,
+    0xB2C9,
+    0x2D00,
+    0xD015,
+    0x0709,
+    0xD40B,
+    0x2104,
+    0x4B1C,
+    0x881A,
+    0x4B1C,
+    0x781B,
+    0x4373,
+    0x189B,
+    0x4A1B,
+    0x189B,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x220A,
+    0x0039,
+    0x0020,
+    0xF7FF,
+    0xFF6F,
+    0x0005,
+    0x0028,
+    0xBDFE,
+    0x233E,
+    0x7726,
+    0x7882,
+    0x421A,
+    0xD0F8,
+    0x0032,
+    0x3804,
+    0xF7FF,
+    0xFAE7,
+    0x2800,
+    0xD0F2,
+    0x4A10,
+    0x2102,
+    0x4694,
+    0x9B01,
+    0x0020,
+    0x4463,
+    0x781A,
+    0x2501,
+    0x438A,
+    0x701A,
+    0x0039,
+    0xF7FD,
+    0xFDFE,
+    0x9B00,
+    0x701E,
+    0xE7E2,
+    0x46C0,
+    0xC8E0,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8003,
+    0x4203,
+    0xC89C,
+    0x4203,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8015,
+    0x4203,
+    0x2201,
+    0x2180,
+    0x4B0F,
+    0xB510,
+    0x761A,
+    0x4B0F,
+    0x2002,
+    0x8019,
+    0x4B0E,
+    0x490F,
+    0x701A,
+    0x2200,
+    0x4B0E,
+    0x701A,
+    0x780B,
+    0x4383,
+    0x700B,
+    0x2104,
+    0x4B0C,
+    0x7019,
+    0x4B0C,
+    0x490D,
+    0x881B,
+    0x185B,
+    0x781B,
+    0x490C,
+    0xB2DB,
+    0x700B,
+    0x4B0B,
+    0x801A,
+    0xF004,
+    0xFA84,
+    0xBD10,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01CC,
+    0x4203,
+    0x01D6,
+    0x4203,
+    0x01CD,
+    0x4203,
+    0x01FA,
+    0x4203,
+    0x0188,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0xB510,
+    0x4B06,
+    0x4A06,
+    0x881B,
+    0x7812,
+    0x4350,
+    0x18C0,
+    0x4B05,
+    0x18C0,
+    0x7001,
+    0x2001,
+    0xF7FA,
+    0xFE6D,
+    0xBD10,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x4B07,
+    0x4A07,
+    0x881B,
+    0x7812,
+    0x4350,
+    0x18C0,
+    0x4B06,
+    0x18C0,
+    0x230C,
+    0x7003,
+    0x2001,
+    0xF7FA,
+    0xFE58,
+    0xBD10,
+    0x46C0,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x4C0B,
+    0x4A0B,
+    0x7E21,
+    0x6813,
+    0x2900,
+    0xD00C,
+    0x2100,
+    0x7621,
+    0x428B,
+    0xD004,
+    0x6011,
+    0x310A,
+    0xF7FF,
+    0xFFC7,
+    0xBD10,
+    0x0018,
+    0xF7FA,
+    0xFE3D,
+    0xE7FA,
+    0xF7FD,
+    0xFC6E,
+    0xE7F7,
+    0x46C0,
+    0xC89C,
+    0x4203,
+    0xC8E0,
+    0x4203,
+    0x2300,
+    0x4288,
+    0xD205,
+    0x30F5,
+    0x30FF,
+    0x4288,
+    0x415B,
+    0xB2D8,
+    0x4770,
+    0x31F5,
+    0x31FF,
+    0x4281,
+    0x415B,
+    0xE7F8,
+    0xB5F8,
+    0x4E0E,
+    0x27FF,
+    0x8830,
+    0x43C0,
+    0xB280,
+    0xF006,
+    0xF8F2,
+    0x4B0B,
+    0xB2C5,
+    0x781B,
+    0x0004,
+    0x429D,
+    0xD20C,
+    0xF006,
+    0xF8D6,
+    0x2201,
+    0x403C,
+    0x40A2,
+    0x8833,
+    0x4313,
+    0xB29B,
+    0x8033,
+    0xF006,
+    0xF8D5,
+    0x0028,
+    0xBDF8,
+    0x003D,
+    0xE7FB,
+    0x46C0,
+    0x016E,
+    0x4203,
+    0x0170,
+    0x4203,
+    0xB510,
+    0x4B11,
+    0x4C11,
+    0x881A,
+    0x4B11,
+    0x781B,
+    0x4343,
+    0x189B,
+    0x4A10,
+    0x189B,
+    0x2204,
+    0x7819,
+    0x4391,
+    0x430A,
+    0x701A,
+    0x4B0E,
+    0x490E,
+    0x881A,
+    0x780B,
+    0x1912,
+    0x18D2,
+    0x7010,
+    0x4A0C,
+    0x3301,
+    0x7812,
+    0xB2DB,
+    0x4293,
+    0xD900,
+    0x2300,
+    0x2280,
+    0x700B,
+    0x4B09,
+    0x0192,
+    0x601A,
+    0xBD10,
+    0x46C0,
+    0x016A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x016C,
+    0x4203,
+    0x0172,
+    0x4203,
+    0x0171,
+    0x4203,
+    0x4000,
+    0x4201,
+    0xB5F8,
+    0x4B1A,
+    0x781C,
+    0xB2E4,
+    0x2CFF,
+    0xD100,
+    0xBDF8,
+    0x4F18,
+    0x4E18,
+    0x883B,
+    0x7835,
+    0x4A18,
+    0x4365,
+    0x18ED,
+    0x4B17,
+    0x4918,
+    0x18EB,
+    0x781B,
+    0x8812,
+    0x7809,
+    0xB2D8,
+    0x434B,
+    0x2101,
+    0x189B,
+    0x4A14,
+    0x189A,
+    0x7011,
+    0x4A14,
+    0x3107,
+    0x189B,
+    0x781A,
+    0x438A,
+    0x430A,
+    0x701A,
+    0xF7FF,
+    0xFFA8,
+    0x8838,
+    0x7833,
+    0x490F,
+    0x4363,
+    0x780A,
+    0x181B,
+    0x480E,
+    0xB2D2,
+    0x181B,
+    0x701A,
+    0x4B0D,
+    0x700C,
+    0x18ED,
+    0x782C,
+    0x4B01,
+    0xB2E4,
+    0x701C,
+    0xE7CD,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x0164,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x8002,
+    0x4203,
+    0x4A08,
+    0x7813,
+    0xB2D8,
+    0x2BFF,
+    0xD00A,
+    0x4B07,
+    0x8819,
+    0x4B07,
+    0x781B,
+    0x4343,
+    0x185B,
+    0x4906,
+    0x185B,
+    0x781B,
+    0xB2DB,
+    0x7013,
+    0x4770,
+    0x46C0,
+    0x0164,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8001,
+    0x4203,
+    0xB5F8,
+    0x4E2D,
+    0x4B2D,
+    0x4D2E,
+    0x781C,
+    0x8833,
+    0x782A,
+    0xB2E7,
+    0x4354,
+    0x4A2C,
+    0x18E4,
+    0x18A3,
+    0x7818,
+    0xB2C0,
+    0xF7FF,
+    0xFF56,
+    0x8831,
+    0x782B,
+    0x4E28,
+    0x437B,
+    0x7832,
+    0x185B,
+    0x4927,
+    0xB2D2,
+    0x185B,
+    0x701A,
+    0x4A26,
+    0x7037,
+    0x18A4,
+    0x7824,
+    0x4B1F,
+    0xB2E4,
+    0x701C,
+    0x2CFF,
+    0xD100,
+    0xBDF8,
+    0x4B1B,
+    0x4A1E,
+    0x881F,
+    0x782B,
+    0x4920,
+    0x4363,
+    0x19DF,
+    0x18BB,
+    0x781B,
+    0x880A,
+    0xB2D8,
+    0x4694,
+    0x4A1D,
+    0x7812,
+    0x4353,
+    0x4A1D,
+    0x4463,
+    0x189B,
+    0x2202,
+    0x781B,
+    0x4213,
+    0xD1E8,
+    0x4B18,
+    0x8809,
+    0x781B,
+    0x4343,
+    0x185B,
+    0x4918,
+    0x185A,
+    0x2101,
+    0x7011,
+    0x4A15,
+    0x189B,
+    0x2208,
+    0x7819,
+    0x4391,
+    0x430A,
+    0x701A,
+    0xF7FF,
+    0xFF1A,
+    0x4B07,
+    0x8819,
+    0x782B,
+    0x7832,
+    0x4363,
+    0x185B,
+    0x4909,
+    0xB2D2,
+    0x185B,
+    0x701A,
+    0x4B08,
+    0x7034,
+    0x18FB,
+    0x781C,
+    0xE7C2,
+    0x46C0,
+    0x0168,
+    0x4203,
+    0x0137,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0164,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x8002,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x800C,
+    0x4203,
+    0xB5F0,
+    0x4B83,
+    0x0004,
+    0x781B,
+    0xB087,
+    0xB2DA,
+    0x2BFF,
+    0xD138,
+    0x2418,
+    0x2501,
+    0x4B7E,
+    0x4E7F,
+    0x7018,
+    0x4B7F,
+    0x4F7F,
+    0x8819,
+    0x4B7F,
+    0x781B,
+    0x4343,
+    0x185B,
+    0x497E,
+    0x185B,
+    0x701A,
+    0x4B7E,
+    0x781B,
+    0x8830,
+    0x435C,
+    0x4B7D,
+    0x18C0,
+    0x1900,
+    0xF004,
+    0xFD58,
+    0x002A,
+    0x8833,
+    0x0029,
+    0x19DB,
+    0x191B,
+    0x781B,
+    0x409A,
+    0x0013,
+    0x4A77,
+    0x6553,
+    0x8833,
+    0x19DB,
+    0x191B,
+    0x781B,
+    0x4099,
+    0x6411,
+    0xF005,
+    0xFF86,
+    0x4973,
+    0x698B,
+    0x8832,
+    0xB29B,
+    0x19D2,
+    0x1912,
+    0x7812,
+    0x4095,
+    0x432B,
+    0x618B,
+    0xF005,
+    0xFF82,
+    0x2001,
+    0xB007,
+    0xBDF0,
+    0x4B65,
+    0x4F69,
+    0x8819,
+    0x4B65,
+    0x4D6B,
+    0x781B,
+    0x4E6B,
+    0x4343,
+    0x185B,
+    0x19DB,
+    0x781B,
+    0x8828,
+    0x7831,
+    0x4359,
+    0x1809,
+    0x4867,
+    0x1809,
+    0x6809,
+    0x8828,
+    0x9100,
+    0x7831,
+    0x4359,
+    0x1809,
+    0x4864,
+    0x1809,
+    0x7809,
+    0xB2C9,
+    0x9103,
+    0x8829,
+    0x7830,
+    0x4343,
+    0x185B,
+    0x2100,
+    0x19DB,
+    0x781B,
+    0x9101,
+    0x3B08,
+    0xB2DB,
+    0x9305,
+    0x4B51,
+    0x8819,
+    0x4B52,
+    0x781B,
+    0x4353,
+    0x4A54,
+    0x185B,
+    0x189F,
+    0x9302,
+    0x783B,
+    0x9901,
+    0xB2DA,
+    0x9701,
+    0x9204,
+    0x8828,
+    0x7832,
+    0x4353,
+    0x4A53,
+    0x181B,
+    0x189B,
+    0x6818,
+    0x9B00,
+    0x1A1B,
+    0xD42F,
+    0x9B05,
+    0x2B03,
+    0xD811,
+    0x882B,
+    0x9A04,
+    0x7831,
+    0x434A,
+    0x18D2,
+    0x4B4C,
+    0x18D2,
+    0x7813,
+    0x9A03,
+    0x429A,
+    0xD10B,
+    0x9900,
+    0xF7FF,
+    0xFE33,
+    0x2800,
+    0xD006,
+    0x2000,
+    0xE7A9,
+    0x4B41,
+    0x9A00,
+    0x6D9B,
+    0x1AD3,
+    0xD4F8,
+    0x4A3B,
+    0x9B02,
+    0x4694,
+    0x4463,
+    0x781B,
+    0xB2DA,
+    0x2BFF,
+    0xD1C5,
+    0x0039,
+    0x4B34,
+    0x8818,
+    0x4B35,
+    0x781B,
+    0x788A,
+    0x4363,
+    0x181B,
+    0x4833,
+    0xB2D2,
+    0x181B,
+    0x701A,
+    0x708C,
+    0xE78D,
+    0x2900,
+    0xD1F0,
+    0x2518,
+    0x4B30,
+    0x4E2A,
+    0x781A,
+    0x492B,
+    0x4355,
+    0x2201,
+    0x0010,
+    0x8833,
+    0x4F2E,
+    0x185B,
+    0x195B,
+    0x781B,
+    0x4098,
+    0x6478,
+    0x8830,
+    0x8833,
+    0x1940,
+    0x185B,
+    0x195B,
+    0x781B,
+    0x492E,
+    0x185B,
+    0x492E,
+    0x009B,
+    0x1841,
+    0x681B,
+    0x7809,
+    0x4211,
+    0xD003,
+    0x4A2B,
+    0x1882,
+    0x8812,
+    0x189B,
+    0x6DBA,
+    0x1A9B,
+    0x2B32,
+    0xD4BA,
+    0x4B19,
+    0x4A17,
+    0x8819,
+    0x4B1A,
+    0x781B,
+    0x7812,
+    0x4363,
+    0x185B,
+    0x4918,
+    0xB2D2,
+    0x185B,
+    0x701A,
+    0x4A11,
+    0x4B18,
+    0x7014,
+    0x2401,
+    0x18C0,
+    0xF004,
+    0xFC8D,
+    0x0021,
+    0x8833,
+    0x4A10,
+    0x189B,
+    0x195B,
+    0x781B,
+    0x4099,
+    0x6579,
+    0x0021,
+    0x8833,
+    0x189B,
+    0x195B,
+    0x781B,
+    0x4099,
+    0x6439,
+    0xF005,
+    0xFEBC,
+    0x490E,
+    0x4808,
+    0x698B,
+    0x8832,
+    0xB29B,
+    0x1812,
+    0x1952,
+    0x7812,
+    0x4094,
+    0x4323,
+    0xE733,
+    0x46C0,
+    0x0137,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8002,
+    0x4203,
+    0x0166,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x1000,
+    0x4200,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x800C,
+    0x4203,
+    0x800E,
+    0x4203,
+    0x4B08,
+    0x781B,
+    0x4298,
+    0xD206,
+    0x4B07,
+    0x881B,
+    0x40C3,
+    0x0018,
+    0x2301,
+    0x4018,
+    0x4770,
+    0x4B05,
+    0x781B,
+    0x4298,
+    0x4180,
+    0x4240,
+    0xE7F8,
+    0x46C0,
+    0x0170,
+    0x4203,
+    0x016E,
+    0x4203,
+    0x0171,
+    0x4203,
+    0xB510,
+    0x4B05,
+    0x781B,
+    0x3B07,
+    0x2B06,
+    0xD802,
+    0xF7FF,
+    0xF9E4,
+    0xBD10,
+    0xF7FD,
+    0xFC09,
+    0xE7FB,
+    0x0165,
+    0x4203,
+    0xB510,
+    0x79C1,
+    0x2401,
+    0x000B,
+    0xB2CA,
+    0x4023,
+    0x4221,
+    0xD000,
+    0x2306,
+    0x2402,
+    0x0011,
+    0x4021,
+    0x4222,
+    0xD000,
+    0x2106,
+    0x0712,
+    0x0F92,
+    0x185B,
+    0x189B,
+    0x4912,
+    0x1818,
+    0x7A03,
+    0x7A43,
+    0x7A82,
+    0x8809,
+    0x4810,
+    0x0412,
+    0x1809,
+    0x20F8,
+    0x021B,
+    0x4313,
+    0x0C1A,
+    0x780C,
+    0x041B,
+    0x0211,
+    0x0140,
+    0x4001,
+    0x0E1B,
+    0x430B,
+    0x2100,
+    0xB2E4,
+    0x428B,
+    0xD009,
+    0x0952,
+    0xB2D0,
+    0x2802,
+    0xD805,
+    0xF7FE,
+    0xFCBD,
+    0x4004,
+    0x0021,
+    0x1E4B,
+    0x4199,
+    0xB2C8,
+    0xBD10,
+    0x46C0,
+    0x0188,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x2300,
+    0xB500,
+    0x280D,
+    0xD810,
+    0xF7F7,
+    0xFB8A,
+    0x0707,
+    0x0707,
+    0x1107,
+    0x1511,
+    0x1515,
+    0x1515,
+    0x1919,
+    0x4B0C,
+    0x881A,
+    0x4B0C,
+    0x781B,
+    0x434B,
+    0x189B,
+    0x4A0B,
+    0x189B,
+    0x0018,
+    0xBD00,
+    0x4B0A,
+    0x881A,
+    0x4B0A,
+    0xE7F4,
+    0x4B0A,
+    0x881A,
+    0x4B0A,
+    0xE7F0,
+    0x4B0A,
+    0x4A0A,
+    0x881B,
+    0x7812,
+    0x4351,
+    0x18CB,
+    0xE7EC,
+    0x0174,
+    0x4203,
+    0x017E,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0182,
+    0x4203,
+    0x0180,
+    0x4203,
+    0x0176,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x0184,
+    0x4203,
+    0x017B,
+    0x4203,
+    0xB510,
+    0x4B14,
+    0x4A14,
+    0x4915,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x4C14,
+    0x434B,
+    0x189B,
+    0x4913,
+    0x4A14,
+    0x191B,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x434B,
+    0x189B,
+    0x191A,
+    0x7810,
+    0x4A10,
+    0xB2C0,
+    0x189B,
+    0x7819,
+    0xB2C9,
+    0xF7FF,
+    0xFFAD,
+    0x4B0E,
+    0x7819,
+    0x4B0E,
+    0x881A,
+    0x2318,
+    0x434B,
+    0x490D,
+    0x1852,
+    0x189B,
+    0x8819,
+    0x2204,
+    0x1909,
+    0xF009,
+    0xF9D5,
+    0xBD10,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x8003,
+    0x4203,
+    0x0166,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x800A,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFFBF,
+    0x22FF,
+    0x4B02,
+    0x701A,
+    0xF7FF,
+    0xFD84,
+    0xBD10,
+    0x46C0,
+    0x0165,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFFF1,
+    0x4B04,
+    0x7818,
+    0x38FF,
+    0x1E43,
+    0x4198,
+    0xB2C0,
+    0xF004,
+    0xFDBF,
+    0xBD10,
+    0x0137,
+    0x4203,
+    0xB510,
+    0x4A11,
+    0x0003,
+    0x7812,
+    0xB2D0,
+    0x2A0A,
+    0xD809,
+    0xF7F7,
+    0xFAF7,
+    0x0609,
+    0x0D0D,
+    0x1010,
+    0x0810,
+    0x1308,
+    0x0017,
+    0xF7FD,
+    0xFD53,
+    0xBD10,
+    0x0018,
+    0xF7FD,
+    0xFD5D,
+    0xE7FA,
+    0xF7FE,
+    0xF9A4,
+    0xE7F7,
+    0xF7FF,
+    0xFFD7,
+    0xE7F4,
+    0x0018,
+    0xF7FF,
+    0xF9F7,
+    0xE7F0,
+    0xF7FF,
+    0xFC0A,
+    0xE7ED,
+    0x46C0,
+    0x0165,
+    0x4203,
+    0xB5F8,
+    0x4A65,
+    0x4B65,
+    0x4966,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x4C65,
+    0x434B,
+    0x189B,
+    0x191B,
+    0x781D,
+    0x4F63,
+    0xB2ED,
+    0x0028,
+    0xF7FF,
+    0xFED7,
+    0x2276,
+    0x4961,
+    0x32FF,
+    0xF001,
+    0xFD64,
+    0x4A60,
+    0x883B,
+    0x7812,
+    0x4960,
+    0x436A,
+    0x18D2,
+    0x1913,
+    0x1851,
+    0x6809,
+    0x7818,
+    0xB2C4,
+    0x0026,
+    0x4C5C,
+    0x3807,
+    0x46A4,
+    0x4C5C,
+    0x1914,
+    0x2806,
+    0xD813,
+    0x485B,
+    0x7800,
+    0x0006,
+    0x4660,
+    0x6D80,
+    0x1A30,
+    0x42C8,
+    0xD511,
+    0x4B58,
+    0x2500,
+    0x18D2,
+    0x2301,
+    0x7013,
+    0x7822,
+    0x3307,
+    0x439A,
+    0x4313,
+    0x7023,
+    0x0028,
+    0xBDF8,
+    0x4660,
+    0x6D80,
+    0x1A09,
+    0xD4EF,
+    0x2E0E,
+    0xD8ED,
+    0x484A,
+    0x8839,
+    0x7800,
+    0x4345,
+    0x186D,
+    0x494A,
+    0x2001,
+    0x186D,
+    0x7829,
+    0x0849,
+    0x000D,
+    0x4005,
+    0x4201,
+    0xD0DF,
+    0x2608,
+    0x2703,
+    0x7821,
+    0x43B1,
+    0x7021,
+    0x7819,
+    0x4E46,
+    0xB2C9,
+    0x7031,
+    0x4945,
+    0x600F,
+    0x4945,
+    0x63C8,
+    0x2080,
+    0x694F,
+    0x0180,
+    0x4338,
+    0x6148,
+    0x2028,
+    0x4942,
+    0x7008,
+    0x7831,
+    0xB2C8,
+    0x290E,
+    0xD856,
+    0xF7F7,
+    0xFA6E,
+    0x2125,
+    0x2D29,
+    0x3531,
+    0x5539,
+    0x1D55,
+    0x0819,
+    0x413D,
+    0x0045,
+    0x0018,
+    0xF7FF,
+    0xF9B4,
+    0x2308,
+    0x7822,
+    0x0005,
+    0x439A,
+    0x2801,
+    0xD948,
+    0x4313,
+    0x7023,
+    0x2300,
+    0x2201,
+    0x42AA,
+    0x415B,
+    0xB2DD,
+    0xE7B5,
+    0x0018,
+    0xF7FF,
+    0xF99E,
+    0xE7ED,
+    0x0018,
+    0xF7FE,
+    0xFEF4,
+    0xE7E9,
+    0x0018,
+    0xF7FD,
+    0xFBF6,
+    0xE7E5,
+    0x0018,
+    0xF7FD,
+    0xFBF8,
+    0xE7E1,
+    0x0018,
+    0xF7FE,
+    0xF8F4,
+    0xE7DD,
+    0x0018,
+    0xF7FE,
+    0xF8F5,
+    0xE7D9,
+    0x0018,
+    0xF7FD,
+    0xFD98,
+    0xE7D5,
+    0x0018,
+    0xF7FD,
+    0xFF54,
+    0xE7D1,
+    0x0018,
+    0xF7FD,
+    0xFF55,
+    0xE7CD,
+    0x0018,
+    0xF7FF,
+    0xFA6C,
+    0xE7C9,
+    0x0018,
+    0xF7FF,
+    0xFA6D,
+    0xE7C5,
+    0x2007,
+    0x4B1C,
+    0x18D2,
+    0x7811,
+    0x4B1C,
+    0x08CA,
+    0x4001,
+    0x3806,
+    0x4088,
+    0x18D2,
+    0x7813,
+    0x4043,
+    0xB2DB,
+    0x7013,
+    0xF7FF,
+    0xFF0B,
+    0x2208,
+    0x7823,
+    0x4393,
+    0x7023,
+    0xE774,
+    0x7022,
+    0x2801,
+    0xD1B5,
+    0xF7FF,
+    0xFE35,
+    0xE7B2,
+    0x0168,
+    0x4203,
+    0x0137,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x19AE,
+    0x1003,
+    0x017C,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x8014,
+    0x4203,
+    0x0112,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x0165,
+    0x4203,
+    0x4094,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0x8001,
+    0x4203,
+    0x780C,
+    0x4201,
+    0xB570,
+    0x4A17,
+    0x4D17,
+    0x4918,
+    0x782B,
+    0x8812,
+    0x7809,
+    0x434B,
+    0x189B,
+    0x4A16,
+    0x189B,
+    0x781C,
+    0xB2E4,
+    0x0020,
+    0xF7FF,
+    0xFDE8,
+    0x22B3,
+    0x4913,
+    0x0052,
+    0xF001,
+    0xFC75,
+    0x4B12,
+    0x4A12,
+    0x881B,
+    0x7812,
+    0x4354,
+    0x2202,
+    0x18E4,
+    0x4B10,
+    0x18E3,
+    0x701A,
+    0x4B10,
+    0x18E4,
+    0x2308,
+    0x7822,
+    0x439A,
+    0x4313,
+    0x7023,
+    0xF7FF,
+    0xFE6A,
+    0xF7FF,
+    0xFC32,
+    0x7828,
+    0x38FF,
+    0x1E43,
+    0x4198,
+    0xB2C0,
+    0xBD70,
+    0x0168,
+    0x4203,
+    0x0137,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x19AE,
+    0x1003,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x7D03,
+    0x7D02,
+    0x08D8,
+    0x2302,
+    0x4018,
+    0x0693,
+    0x0FDB,
+    0x4318,
+    0x4770,
+    0x0000,
+    0xB570,
+    0x4B2C,
+    0x4A2C,
+    0x492D,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x0004,
+    0x434B,
+    0x189B,
+    0x4A2A,
+    0x189B,
+    0x781D,
+    0xB2ED,
+    0x0028,
+    0xF7FF,
+    0xFD9B,
+    0x4928,
+    0x4A28,
+    0xF001,
+    0xFC29,
+    0x4928,
+    0x4A28,
+    0x8808,
+    0x7813,
+    0x436B,
+    0x181B,
+    0x4827,
+    0x181B,
+    0x781B,
+    0x079B,
+    0xD50E,
+    0x4B25,
+    0x7818,
+    0xB2C0,
+    0x7760,
+    0x280D,
+    0xD808,
+    0xF7F7,
+    0xF976,
+    0x0709,
+    0x130D,
+    0x0707,
+    0x0707,
+    0x1507,
+    0x2919,
+    0x2F2F,
+    0x2000,
+    0xBD70,
+    0x0020,
+    0xF7FD,
+    0xFC10,
+    0xE7FA,
+    0x2201,
+    0x0029,
+    0x0020,
+    0xF7FE,
+    0xF82E,
+    0xE7F4,
+    0x2200,
+    0xE7F8,
+    0x0020,
+    0xF7FE,
+    0xFF92,
+    0xE7EE,
+    0x880B,
+    0x7810,
+    0x4368,
+    0x18C0,
+    0x4B0D,
+    0x18C0,
+    0xF7FF,
+    0xFFAD,
+    0x220A,
+    0x2800,
+    0xD005,
+    0x0029,
+    0x0020,
+    0xF7FF,
+    0xFA1C,
+    0xE7DE,
+    0x220B,
+    0x0029,
+    0x0020,
+    0xF7FF,
+    0xF9B2,
+    0xE7D8,
+    0x220D,
+    0xE7F8,
+    0x46C0,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x19AE,
+    0x1003,
+    0x024E,
+    0x0000,
+    0x016A,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x0165,
+    0x4203,
+    0x2201,
+    0x2300,
+    0x4282,
+    0x415B,
+    0xB2D8,
+    0x4770,
+    0xB570,
+    0x4C09,
+    0x4D09,
+    0x6863,
+    0x6821,
+    0x8B58,
+    0x1940,
+    0xF009,
+    0xF931,
+    0x6863,
+    0x001A,
+    0x3221,
+    0x8B58,
+    0x7811,
+    0x1940,
+    0x6A5A,
+    0xB2C9,
+    0xF7F7,
+    0xFB27,
+    0xBD70,
+    0xC8E4,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F0,
+    0x2403,
+    0x2101,
+    0x2680,
+    0x4B80,
+    0x4D81,
+    0x01B6,
+    0x6068,
+    0x601C,
+    0x4B80,
+    0x0002,
+    0x63D9,
+    0x695F,
+    0x487F,
+    0x433E,
+    0x615E,
+    0x2608,
+    0x4B7E,
+    0x4F7E,
+    0x701E,
+    0x4B7E,
+    0xB085,
+    0x781E,
+    0x6A06,
+    0x781B,
+    0x403E,
+    0x27E0,
+    0x021B,
+    0x00FF,
+    0x403B,
+    0x4333,
+    0x6203,
+    0x7813,
+    0x089B,
+    0x420B,
+    0xD100,
+    0xE06C,
+    0x0013,
+    0x332E,
+    0x781B,
+    0xB2D8,
+    0x2B00,
+    0xD103,
+    0x7813,
+    0x4023,
+    0x4099,
+    0xB2C8,
+    0x7811,
+    0x2201,
+    0x06C9,
+    0x0F89,
+    0xF7F8,
+    0xFC63,
+    0x0004,
+    0xF002,
+    0xF8CA,
+    0x0020,
+    0xF002,
+    0xFD3D,
+    0x2140,
+    0x4E65,
+    0x4D6B,
+    0x6874,
+    0x27FF,
+    0x6863,
+    0x61AB,
+    0x68A2,
+    0x4B69,
+    0x601A,
+    0x68E2,
+    0x4B68,
+    0x601A,
+    0x7CA3,
+    0x8A23,
+    0x7CA3,
+    0x8A22,
+    0x041B,
+    0x4313,
+    0x4A65,
+    0x606B,
+    0x7813,
+    0x438B,
+    0x7013,
+    0x7CE3,
+    0x692A,
+    0x7CE3,
+    0x313F,
+    0x438A,
+    0x400B,
+    0x4313,
+    0x612B,
+    0x7823,
+    0x2380,
+    0x692A,
+    0x439A,
+    0x7823,
+    0x095B,
+    0x01DB,
+    0x403B,
+    0x4313,
+    0x612B,
+    0x0023,
+    0x3320,
+    0x7818,
+    0xB2C0,
+    0x7230,
+    0x7859,
+    0x6A62,
+    0x8DA3,
+    0xB2C9,
+    0xB29B,
+    0x9303,
+    0x232A,
+    0x469C,
+    0x44A4,
+    0x4663,
+    0x781B,
+    0x8D24,
+    0x041B,
+    0x431C,
+    0x9400,
+    0x2401,
+    0x9B03,
+    0xF7F7,
+    0xFADB,
+    0x682B,
+    0x4A4E,
+    0x4323,
+    0x602B,
+    0x2300,
+    0x8013,
+    0x4A4D,
+    0x8013,
+    0x4B4D,
+    0x701F,
+    0x6873,
+    0x7D18,
+    0xB2C0,
+    0xF003,
+    0xFCCA,
+    0x0020,
+    0xF003,
+    0xFB6F,
+    0x2001,
+    0xB005,
+    0xBDF0,
+    0x2607,
+    0x7811,
+    0x4021,
+    0x4C46,
+    0x1C48,
+    0x6963,
+    0x43B3,
+    0x4303,
+    0x6163,
+    0x2802,
+    0xD062,
+    0x1E8B,
+    0x2B01,
+    0xD85D,
+    0x4B41,
+    0x2700,
+    0x781B,
+    0xB2DB,
+    0xB2DE,
+    0x7666,
+    0x4E3F,
+    0x7037,
+    0x4F3F,
+    0x4E40,
+    0x5C3F,
+    0x1BDB,
+    0x4F3F,
+    0x5C3F,
+    0x437B,
+    0x6033,
+    0x2801,
+    0xD14F,
+    0x4B3D,
+    0x7818,
+    0x781B,
+    0x483D,
+    0xB2DB,
+    0x6303,
+    0x4B3C,
+    0x4E3D,
+    0x7818,
+    0x6A20,
+    0x781B,
+    0x4030,
+    0x1E5F,
+    0x41BB,
+    0x27F0,
+    0x041B,
+    0x4303,
+    0x6223,
+    0x4B38,
+    0x7818,
+    0x69E0,
+    0x781B,
+    0x43B8,
+    0x091B,
+    0x011B,
+    0x4303,
+    0x61E3,
+    0x6850,
+    0xF003,
+    0xFCCA,
+    0x686B,
+    0x7620,
+    0x7C9A,
+    0x8A19,
+    0x0412,
+    0x430A,
+    0x2101,
+    0x6262,
+    0x7CDA,
+    0x7CDA,
+    0xB2D2,
+    0x8422,
+    0x781A,
+    0x6A20,
+    0x781A,
+    0x4030,
+    0x0952,
+    0x400A,
+    0x0412,
+    0x4302,
+    0x6222,
+    0x6A22,
+    0x4828,
+    0x4002,
+    0x6222,
+    0x781A,
+    0x6920,
+    0x781A,
+    0x4388,
+    0x08D2,
+    0x400A,
+    0x4302,
+    0x6122,
+    0x4A24,
+    0x6D91,
+    0x4A24,
+    0x8812,
+    0x1852,
+    0x602A,
+    0x7D18,
+    0xB2C0,
+    0xF003,
+    0xFC5B,
+    0xF7FF,
+    0xFEEB,
+    0xE790,
+    0x4B1F,
+    0xE7A0,
+    0x4B1F,
+    0xE79E,
+    0x2802,
+    0xD1B3,
+    0x4B1E,
+    0xE7AC,
+    0x4094,
+    0x4200,
+    0xC8E4,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x4000,
+    0x4200,
+    0x0108,
+    0x4203,
+    0xF8FF,
+    0xFFFF,
+    0x012F,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xD0CC,
+    0x4200,
+    0xD0D0,
+    0x4200,
+    0x01EA,
+    0x4203,
+    0x01CA,
+    0x4203,
+    0x01DA,
+    0x4203,
+    0x01C9,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x024F,
+    0x4203,
+    0x502A,
+    0x4200,
+    0x19C2,
+    0x1003,
+    0xC900,
+    0x4203,
+    0x19BD,
+    0x1003,
+    0x0132,
+    0x4203,
+    0xA000,
+    0x4200,
+    0x025C,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x9000,
+    0x4201,
+    0x020E,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x0133,
+    0x4203,
+    0xB510,
+    0x4B09,
+    0x685B,
+    0x781B,
+    0x075B,
+    0xD502,
+    0x2000,
+    0xF003,
+    0xFAB1,
+    0x4B06,
+    0x781B,
+    0x2B02,
+    0xD001,
+    0xF004,
+    0xF987,
+    0xF003,
+    0xFA93,
+    0xF004,
+    0xFDC7,
+    0xBD10,
+    0xC8E4,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x490B,
+    0xB510,
+    0x684A,
+    0x4C0B,
+    0x8B10,
+    0xB283,
+    0x42A0,
+    0xD106,
+    0x8AD2,
+    0x680B,
+    0x189B,
+    0x600B,
+    0xF7FF,
+    0xFE7E,
+    0xBD10,
+    0x3B01,
+    0xB29B,
+    0x8313,
+    0x2B00,
+    0xD1F3,
+    0xF7FF,
+    0xFFD2,
+    0xE7F6,
+    0x46C0,
+    0xC8E4,
+    0x4203,
+    0xFFFF,
+    0x0000,
+    0x4B18,
+    0xB510,
+    0x6C5A,
+    0x0001,
+    0x2401,
+    0x06D2,
+    0xD402,
+    0x2400,
+    0x0020,
+    0xBD10,
+    0x6C5A,
+    0x4814,
+    0x08D2,
+    0x6843,
+    0x4222,
+    0xD01B,
+    0x8BDA,
+    0x3201,
+    0xB292,
+    0x83DA,
+    0x7A02,
+    0x2A00,
+    0xD00A,
+    0x4A0F,
+    0x7812,
+    0x0792,
+    0xD506,
+    0x2200,
+    0x3320,
+    0x701A,
+    0x2280,
+    0x4B0C,
+    0x0092,
+    0x601A,
+    0x6843,
+    0x781B,
+    0x065B,
+    0x0FDC,
+    0x2B00,
+    0xDADE,
+    0x4808,
+    0xF7F8,
+    0xFBF5,
+    0xE7DB,
+    0x8B9A,
+    0x3201,
+    0xB292,
+    0x839A,
+    0xE7E2,
+    0x46C0,
+    0x6000,
+    0x4200,
+    0xC8E4,
+    0x4203,
+    0x01C4,
+    0x4203,
+    0x4000,
+    0x4201,
+    0x0234,
+    0x4203,
+    0x0003,
+    0x333B,
+    0x303A,
+    0x781B,
+    0x7800,
+    0x1AC0,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0x4770,
+    0x0003,
+    0xB510,
+    0x333B,
+    0x303A,
+    0x781A,
+    0x7801,
+    0xB2D3,
+    0x2001,
+    0xB2CC,
+    0x4291,
+    0xD005,
+    0x2207,
+    0x181B,
+    0x4013,
+    0x1B18,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0xBD10,
+    0x0000,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xFFDE,
+    0x2800,
+    0xD003,
+    0x4B05,
+    0x8818,
+    0xB280,
+    0xBD10,
+    0x0023,
+    0x333B,
+    0x781B,
+    0x3440,
+    0x005B,
+    0x191C,
+    0x8820,
+    0xE7F5,
+    0x0114,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xFFCA,
+    0x2800,
+    0xD105,
+    0x2207,
+    0x343B,
+    0x7823,
+    0x3301,
+    0x4013,
+    0x7023,
+    0xBD10,
+    0x0003,
+    0x2000,
+    0x4283,
+    0xD00D,
+    0xB288,
+    0x4358,
+    0x0C0A,
+    0x435A,
+    0x434B,
+    0x0C00,
+    0x1880,
+    0x0C00,
+    0x0400,
+    0x0C1B,
+    0x18C0,
+    0x0900,
+    0xD100,
+    0x3001,
+    0x4770,
+    0xB5F8,
+    0x8943,
+    0x0007,
+    0x000E,
+    0x0014,
+    0xB29B,
+    0x2A00,
+    0xD107,
+    0x4A14,
+    0x4915,
+    0x1898,
+    0x1859,
+    0x8802,
+    0x880D,
+    0x4295,
+    0xD90A,
+    0x2400,
+    0x4A12,
+    0x189B,
+    0x881D,
+    0xB2AD,
+    0x0031,
+    0x0028,
+    0xF7FF,
+    0xFFD4,
+    0x1820,
+    0xBDF8,
+    0x4A0E,
+    0x189A,
+    0x8815,
+    0x8800,
+    0x8809,
+    0xB2AD,
+    0x4281,
+    0xD1F1,
+    0x8810,
+    0x4A08,
+    0x4C0A,
+    0x189A,
+    0x8812,
+    0x191B,
+    0x6879,
+    0x881B,
+    0x1A80,
+    0x4359,
+    0xB280,
+    0xF7FF,
+    0xFFBD,
+    0x0004,
+    0xE7E2,
+    0x8030,
+    0x4203,
+    0x8034,
+    0x4203,
+    0x8020,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x802E,
+    0x4203,
+    0x17CB,
+    0xB5F7,
+    0x0005,
+    0x000E,
+    0x4059,
+    0x2200,
+    0x1AC9,
+    0xF7FF,
+    0xFFBB,
+    0x4F1F,
+    0x896B,
+    0x0004,
+    0xB29B,
+    0x8838,
+    0x9301,
+    0x4B1D,
+    0x1A28,
+    0x18C0,
+    0x2118,
+    0xF7F6,
+    0xFED9,
+    0x230F,
+    0x4018,
+    0x4B1A,
+    0x9A01,
+    0x469C,
+    0x4462,
+    0x2E00,
+    0xDA06,
+    0x0023,
+    0x6811,
+    0x330D,
+    0x005B,
+    0x428B,
+    0xD223,
+    0x4264,
+    0x4914,
+    0x686B,
+    0x8809,
+    0x085B,
+    0x1A5B,
+    0x2100,
+    0x429C,
+    0xD301,
+    0x001C,
+    0x3101,
+    0x3532,
+    0x7029,
+    0x2118,
+    0x4348,
+    0x883B,
+    0x4D0E,
+    0x4E0E,
+    0x195B,
+    0x181B,
+    0x781B,
+    0x199B,
+    0x009B,
+    0x6819,
+    0x883B,
+    0x1B09,
+    0x195B,
+    0x181B,
+    0x781B,
+    0x0064,
+    0x199B,
+    0x009B,
+    0x6019,
+    0x6813,
+    0x18E4,
+    0x6014,
+    0xBDF7,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x801C,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB510,
+    0x2800,
+    0xDB04,
+    0x2900,
+    0xDD04,
+    0xF7F6,
+    0xFF1D,
+    0xBD10,
+    0x2900,
+    0xDBFA,
+    0xF7F6,
+    0xFFFE,
+    0x1E4B,
+    0x4199,
+    0x1A40,
+    0xE7F6,
+    0xB510,
+    0x0FCB,
+    0x185B,
+    0x105B,
+    0x1818,
+    0xF7FF,
+    0xFFE9,
+    0xBD10,
+    0xB5F7,
+    0x0002,
+    0x4B3A,
+    0x681C,
+    0x2300,
+    0x3231,
+    0xDB07,
+    0x210A,
+    0x3028,
+    0xF7F6,
+    0xFF01,
+    0x0003,
+    0x2810,
+    0xDD00,
+    0x2310,
+    0x4A35,
+    0x189B,
+    0x7819,
+    0x7922,
+    0x7963,
+    0x0609,
+    0x021B,
+    0x4313,
+    0x79A2,
+    0x1609,
+    0x0412,
+    0x431A,
+    0x79E3,
+    0x061B,
+    0x4313,
+    0x4A2E,
+    0x4293,
+    0xD94B,
+    0x0023,
+    0x33AC,
+    0x781A,
+    0x3301,
+    0x781B,
+    0x021B,
+    0x4313,
+    0x0022,
+    0x32AE,
+    0x7812,
+    0x0412,
+    0x431A,
+    0x0023,
+    0x33AF,
+    0x781B,
+    0x061B,
+    0x4313,
+    0x0027,
+    0x0026,
+    0x0025,
+    0x0020,
+    0x3794,
+    0x3695,
+    0x783A,
+    0x4359,
+    0x7833,
+    0x3596,
+    0x021B,
+    0x4313,
+    0x782A,
+    0x3097,
+    0x0412,
+    0x431A,
+    0x7803,
+    0x061B,
+    0x4313,
+    0x140A,
+    0x213F,
+    0x468C,
+    0x9201,
+    0x4A1A,
+    0x400B,
+    0x68D4,
+    0x438C,
+    0x9901,
+    0x185B,
+    0x4563,
+    0xDD1E,
+    0x4663,
+    0x4323,
+    0x60D3,
+    0x783C,
+    0x7833,
+    0x9901,
+    0x021B,
+    0x4323,
+    0x782C,
+    0x0424,
+    0x431C,
+    0x7803,
+    0x68D0,
+    0x061B,
+    0x4323,
+    0x4C0F,
+    0x099B,
+    0x4020,
+    0x243F,
+    0x4023,
+    0x185B,
+    0x42A3,
+    0xDD0B,
+    0x0023,
+    0x019B,
+    0x4303,
+    0x60D3,
+    0xBDF7,
+    0x2380,
+    0x025B,
+    0xE7C1,
+    0x43D9,
+    0x17C9,
+    0x400B,
+    0xE7DD,
+    0x43D9,
+    0x17C9,
+    0x400B,
+    0xE7F0,
+    0x0010,
+    0x4000,
+    0x0028,
+    0x4000,
+    0x0806,
+    0x2024,
+    0xF000,
+    0x4101,
+    0xF03F,
+    0xFFFF,
+    0x4B1D,
+    0xB510,
+    0x681A,
+    0x0013,
+    0x0011,
+    0x33D1,
+    0x31D2,
+    0x33FF,
+    0x31FF,
+    0x781B,
+    0x7809,
+    0x0209,
+    0x4319,
+    0x0013,
+    0x33D3,
+    0x33FF,
+    0x781B,
+    0x32D4,
+    0x041B,
+    0x430B,
+    0x32FF,
+    0x035B,
+    0x7812,
+    0x0F1B,
+    0x2868,
+    0xDD18,
+    0x2205,
+    0x3B02,
+    0x43D9,
+    0x17C9,
+    0x400B,
+    0x480F,
+    0x4C0F,
+    0x6801,
+    0x03DB,
+    0x4021,
+    0x430B,
+    0x6003,
+    0x200F,
+    0x490D,
+    0x69CB,
+    0x4383,
+    0x4313,
+    0x61CB,
+    0x69CB,
+    0x30E1,
+    0x4383,
+    0x0112,
+    0x431A,
+    0x61CA,
+    0xBD10,
+    0x2207,
+    0x2854,
+    0xDDE8,
+    0x3B01,
+    0x3A01,
+    0x2863,
+    0xDDE1,
+    0x3A01,
+    0xE7DF,
+    0x0010,
+    0x4000,
+    0xC0F4,
+    0x4200,
+    0x7FFF,
+    0xFFF8,
+    0xB000,
+    0x4200,
+    0x4B23,
+    0xB570,
+    0x681B,
+    0x0006,
+    0x0018,
+    0x30D1,
+    0x30FF,
+    0x7802,
+    0x0019,
+    0x001A,
+    0x31D2,
+    0x32D3,
+    0x33D4,
+    0x31FF,
+    0x32FF,
+    0x33FF,
+    0x780C,
+    0x7815,
+    0x781D,
+    0x7800,
+    0x780D,
+    0x2105,
+    0x022D,
+    0x4305,
+    0x0030,
+    0x3819,
+    0x7812,
+    0x781B,
+    0xF7F6,
+    0xFE28,
+    0x05ED,
+    0x0664,
+    0x0DED,
+    0x0EA4,
+    0x1943,
+    0x2E68,
+    0xDD13,
+    0x3B07,
+    0x3408,
+    0x4A11,
+    0x4811,
+    0x6811,
+    0x0264,
+    0x4001,
+    0x20FC,
+    0x01C0,
+    0x4004,
+    0x430C,
+    0x6014,
+    0x6811,
+    0x05DB,
+    0x0A49,
+    0x0249,
+    0x0DDB,
+    0x430B,
+    0x6013,
+    0xBD70,
+    0x2E54,
+    0xDD02,
+    0x3B05,
+    0x3406,
+    0xE7E8,
+    0x2E40,
+    0xDD02,
+    0x3B03,
+    0x3404,
+    0xE7E3,
+    0x2E2C,
+    0xDDE1,
+    0x3B02,
+    0x3402,
+    0xE7DE,
+    0x0010,
+    0x4000,
+    0xC0F4,
+    0x4200,
+    0x81FF,
+    0xFFFF,
+    0x2380,
+    0xB5F0,
+    0x4CA1,
+    0x041B,
+    0x6BA2,
+    0x00C0,
+    0x4313,
+    0x63A3,
+    0x2380,
+    0x69A2,
+    0x029B,
+    0x4313,
+    0x61A3,
+    0x4B9D,
+    0xB08F,
+    0x58C5,
+    0x1819,
+    0x2301,
+    0x001F,
+    0x794A,
+    0x7909,
+    0x682E,
+    0x408F,
+    0x0039,
+    0x001F,
+    0x4097,
+    0x3901,
+    0x4091,
+    0x003A,
+    0x4072,
+    0x400A,
+    0x4072,
+    0x001E,
+    0x4994,
+    0x602A,
+    0x180A,
+    0x7955,
+    0x7912,
+    0x001F,
+    0x4096,
+    0x0032,
+    0x3A01,
+    0x40AA,
+    0x9209,
+    0x5842,
+    0x6811,
+    0x4694,
+    0x001A,
+    0x40AA,
+    0x9D09,
+    0x404A,
+    0x402A,
+    0x404A,
+    0x4661,
+    0x600A,
+    0x498A,
+    0x180E,
+    0x7972,
+    0x7936,
+    0x5841,
+    0x40B7,
+    0x003E,
+    0x001F,
+    0x4097,
+    0x3E01,
+    0x4096,
+    0x003A,
+    0x680D,
+    0x001F,
+    0x406A,
+    0x4032,
+    0x001E,
+    0x406A,
+    0x4D82,
+    0x600A,
+    0x1829,
+    0x794A,
+    0x7909,
+    0x408E,
+    0x0031,
+    0x3901,
+    0x4091,
+    0x9108,
+    0x5941,
+    0x001D,
+    0x4095,
+    0x002A,
+    0x9104,
+    0x6809,
+    0x9D08,
+    0x404A,
+    0x402A,
+    0x404A,
+    0x9904,
+    0x600A,
+    0x4978,
+    0x5846,
+    0x1809,
+    0x790A,
+    0x7949,
+    0x4097,
+    0x003A,
+    0x3A01,
+    0x408A,
+    0x001F,
+    0x6835,
+    0x4973,
+    0x4395,
+    0x6035,
+    0x5846,
+    0x1809,
+    0x790A,
+    0x7949,
+    0x4097,
+    0x003A,
+    0x3A01,
+    0x408A,
+    0x6835,
+    0x496E,
+    0x4395,
+    0x6035,
+    0x001E,
+    0x180D,
+    0x796A,
+    0x792D,
+    0x5841,
+    0x40AE,
+    0x0035,
+    0x3D01,
+    0x4095,
+    0x9507,
+    0x001D,
+    0x4095,
+    0x002A,
+    0x9103,
+    0x6809,
+    0x9D07,
+    0x404A,
+    0x402A,
+    0x404A,
+    0x9903,
+    0x600A,
+    0x4963,
+    0x180A,
+    0x7915,
+    0x7957,
+    0x40AB,
+    0x3B01,
+    0x40BB,
+    0x5841,
+    0x9302,
+    0x9701,
+    0x680B,
+    0x9F02,
+    0x88D2,
+    0x403B,
+    0x9F01,
+    0x40FB,
+    0x2A01,
+    0xD103,
+    0x321F,
+    0x1B52,
+    0x4093,
+    0x4113,
+    0x3306,
+    0x2B1F,
+    0xDD43,
+    0x231F,
+    0x001A,
+    0x9F01,
+    0x680D,
+    0x40BA,
+    0x9F02,
+    0x406A,
+    0x403A,
+    0x4F54,
+    0x406A,
+    0x600A,
+    0x183A,
+    0x7915,
+    0x5838,
+    0x9505,
+    0x7955,
+    0x9E05,
+    0x9506,
+    0x2501,
+    0x40B5,
+    0x9E06,
+    0x3D01,
+    0x40B5,
+    0x950A,
+    0x2520,
+    0x900B,
+    0x270A,
+    0x2000,
+    0x88D2,
+    0x920C,
+    0x9A05,
+    0x1AAD,
+    0x9A0B,
+    0x9E0A,
+    0x6812,
+    0x4032,
+    0x9E06,
+    0x40F2,
+    0x9E0C,
+    0x2E01,
+    0xD101,
+    0x40AA,
+    0x412A,
+    0x2601,
+    0x3F01,
+    0x4032,
+    0x1880,
+    0x2F00,
+    0xD1EE,
+    0x0032,
+    0x2804,
+    0xD901,
+    0x2201,
+    0x4252,
+    0x920D,
+    0x2220,
+    0x0005,
+    0x9E05,
+    0x1B92,
+    0x9205,
+    0x2804,
+    0xD82B,
+    0x2D04,
+    0xD831,
+    0x2B1E,
+    0xDD07,
+    0x1F9A,
+    0xE030,
+    0x001A,
+    0x3220,
+    0xDAB9,
+    0x2320,
+    0x425B,
+    0xE7B6,
+    0x9A0D,
+    0x9E01,
+    0x189B,
+    0x001A,
+    0x40B2,
+    0x680D,
+    0x9E02,
+    0x406A,
+    0x4032,
+    0x406A,
+    0x270A,
+    0x2500,
+    0x600A,
+    0x9A0B,
+    0x9E0A,
+    0x6812,
+    0x4032,
+    0x9E06,
+    0x40F2,
+    0x9E0C,
+    0x2E01,
+    0xD102,
+    0x9E05,
+    0x40B2,
+    0x4132,
+    0x2601,
+    0x3F01,
+    0x4032,
+    0x18AD,
+    0x2F00,
+    0xD1ED,
+    0xE7D1,
+    0x2D04,
+    0xD904,
+    0x001A,
+    0x321F,
+    0xDADA,
+    0x3301,
+    0xE7D0,
+    0x3301,
+    0x1FDA,
+    0x2B05,
+    0xD8CC,
+    0x0013,
+    0x6808,
+    0x2A1F,
+    0xDD20,
+    0x231F,
+    0x9A01,
+    0x4093,
+    0x9A02,
+    0x4043,
+    0x401A,
+    0x0013,
+    0x4043,
+    0x600B,
+    0x9B03,
+    0x9A07,
+    0x681B,
+    0x4393,
+    0x9A03,
+    0x6013,
+    0x9B04,
+    0x9A08,
+    0x681B,
+    0x4393,
+    0x9A04,
+    0x6013,
+    0x4663,
+    0x9A09,
+    0x681B,
+    0x4393,
+    0x4662,
+    0x6013,
+    0x69A3,
+    0x4A0E,
+    0x4013,
+    0x61A3,
+    0xB00F,
+    0xBDF0,
+    0x3220,
+    0xDADD,
+    0x2320,
+    0x425B,
+    0xE7DA,
+    0x9000,
+    0x4200,
+    0x1A48,
+    0x1003,
+    0x1A38,
+    0x1003,
+    0x1A28,
+    0x1003,
+    0x1A18,
+    0x1003,
+    0x1A08,
+    0x1003,
+    0x19F8,
+    0x1003,
+    0x19E8,
+    0x1003,
+    0x19D8,
+    0x1003,
+    0x19C8,
+    0x1003,
+    0xFFFF,
+    0xFFFD,
+    0x23B0,
+    0xB5F0,
+    0x4D5C,
+    0x005B,
+    0x65EB,
+    0x2380,
+    0x4C5B,
+    0x04DB,
+    0x6822,
+    0xB085,
+    0x4313,
+    0x2200,
+    0x6023,
+    0x4B59,
+    0x601A,
+    0x2302,
+    0x4A58,
+    0x6811,
+    0x430B,
+    0x6013,
+    0x2340,
+    0x672B,
+    0x4B56,
+    0x4A57,
+    0x66EB,
+    0x3BFA,
+    0x3BFF,
+    0x676B,
+    0x3302,
+    0x6013,
+    0x2380,
+    0x6822,
+    0x045B,
+    0x4313,
+    0x6023,
+    0x6823,
+    0x4A51,
+    0x4013,
+    0x6023,
+    0x2320,
+    0x656B,
+    0x2380,
+    0x055B,
+    0x6D2A,
+    0x421A,
+    0xD0FC,
+    0x4B4D,
+    0x4A4E,
+    0x681B,
+    0x435A,
+    0x0013,
+    0x9202,
+    0x4A4C,
+    0x189F,
+    0x230A,
+    0x9300,
+    0x2F00,
+    0xDC01,
+    0x3B08,
+    0x9300,
+    0x9B00,
+    0x4A44,
+    0x676B,
+    0x2308,
+    0x6013,
+    0x2380,
+    0x6822,
+    0x045B,
+    0x4313,
+    0x6023,
+    0x6823,
+    0x4A40,
+    0x4013,
+    0x6023,
+    0x2320,
+    0x656B,
+    0x2380,
+    0x055B,
+    0x6D2A,
+    0x421A,
+    0xD0FC,
+    0x4B3C,
+    0x681E,
+    0x4B3C,
+    0x435E,
+    0x4B3C,
+    0x18F3,
+    0x9303,
+    0x9B02,
+    0x1AF0,
+    0x9B00,
+    0x2B06,
+    0xDD01,
+    0x9B02,
+    0x1B98,
+    0x2104,
+    0xF7FF,
+    0xFD26,
+    0x17FB,
+    0x18FA,
+    0x405A,
+    0x9B03,
+    0x9001,
+    0x17D9,
+    0x185B,
+    0x404B,
+    0x429A,
+    0xDA3E,
+    0x0001,
+    0x0038,
+    0xF7FF,
+    0xFD18,
+    0x2306,
+    0x1D87,
+    0x9802,
+    0x9300,
+    0x2F0F,
+    0xDD3C,
+    0x270F,
+    0x2308,
+    0x4A26,
+    0x676F,
+    0x6013,
+    0x2380,
+    0x6822,
+    0x045B,
+    0x4313,
+    0x6023,
+    0x6823,
+    0x4A23,
+    0x4013,
+    0x6023,
+    0x2320,
+    0x656B,
+    0x2380,
+    0x055B,
+    0x6D2A,
+    0x421A,
+    0xD0FC,
+    0x4B1F,
+    0x4A1F,
+    0x681B,
+    0x4353,
+    0x4A1F,
+    0x189E,
+    0x9A00,
+    0x42BA,
+    0xD004,
+    0x1AC0,
+    0x1AB9,
+    0xF7FF,
+    0xFCF0,
+    0x9001,
+    0x0030,
+    0x9901,
+    0xF7FF,
+    0xFCEB,
+    0x19C0,
+    0x280F,
+    0xDD16,
+    0x200F,
+    0x4B17,
+    0x6768,
+    0xB2C0,
+    0x7518,
+    0x6823,
+    0x4A15,
+    0x4013,
+    0x6023,
+    0xB005,
+    0xBDF0,
+    0x9901,
+    0x9803,
+    0xF7FF,
+    0xFCD9,
+    0x9B00,
+    0x18C7,
+    0x0030,
+    0xE7C0,
+    0x43FB,
+    0x17DB,
+    0x401F,
+    0xE7BF,
+    0x43C3,
+    0x17DB,
+    0x4018,
+    0xE7E5,
+    0x46C0,
+    0xC000,
+    0x4200,
+    0xC0E4,
+    0x4200,
+    0xC0F0,
+    0x4200,
+    0xC0E8,
+    0x4200,
+    0x01FF,
+    0x0000,
+    0xC0B8,
+    0x4200,
+    0xFFFF,
+    0xFEFF,
+    0xC0B4,
+    0x4200,
+    0xE848,
+    0x0001,
+    0x8E00,
+    0x6E90,
+    0x0000,
+    0x4203,
+    0xFFFF,
+    0xFBFF,
+    0xB570,
+    0x001C,
+    0x000D,
+    0x9B04,
+    0x1B45,
+    0x1B18,
+    0x4368,
+    0x1A51,
+    0xF7FF,
+    0xFCAA,
+    0x1900,
+    0xBD70,
+    0xB510,
+    0x491C,
+    0x0002,
+    0x7D0B,
+    0x6D48,
+    0xB2DB,
+    0x0500,
+    0x0D00,
+    0x4290,
+    0xD915,
+    0x2002,
+    0x2B0D,
+    0xD911,
+    0x6D88,
+    0x0100,
+    0x0D00,
+    0x4282,
+    0xD824,
+    0x6D48,
+    0x0100,
+    0x0D00,
+    0x4290,
+    0xD915,
+    0x2001,
+    0x2B0E,
+    0xD904,
+    0x6D8B,
+    0x051B,
+    0x0D1B,
+    0x4293,
+    0x4180,
+    0xBD10,
+    0x6D88,
+    0x0100,
+    0x0D00,
+    0x4290,
+    0xD2EC,
+    0x2B01,
+    0xD80F,
+    0x6D4C,
+    0x2001,
+    0x0124,
+    0x0D24,
+    0x42A2,
+    0xD3F1,
+    0x6D89,
+    0x2000,
+    0x0509,
+    0x0D09,
+    0x4291,
+    0xD2EB,
+    0x1E5A,
+    0x4193,
+    0x4258,
+    0xE7E7,
+    0x2002,
+    0x4240,
+    0xE7E4,
+    0x0000,
+    0x4203,
+    0xB537,
+    0x4B0C,
+    0x4D0C,
+    0x781C,
+    0x4B0C,
+    0x3C05,
+    0x18CB,
+    0x009B,
+    0x6819,
+    0x695A,
+    0x4B0A,
+    0x40A0,
+    0x781B,
+    0x782D,
+    0xB2DB,
+    0x9500,
+    0xF7FF,
+    0xFFA6,
+    0x287F,
+    0xDD01,
+    0x207F,
+    0xBD3E,
+    0x43C3,
+    0x17DB,
+    0x4018,
+    0xE7FA,
+    0x001A,
+    0x4203,
+    0x0019,
+    0x4203,
+    0xC009,
+    0x1080,
+    0x0018,
+    0x4203,
+    0x2120,
+    0xB5F0,
+    0x4CA7,
+    0x48A8,
+    0x6DE3,
+    0x4DA8,
+    0x430B,
+    0x65E3,
+    0x2340,
+    0x6DE2,
+    0x4EA6,
+    0x4313,
+    0x65E3,
+    0x2380,
+    0x6DE2,
+    0x005B,
+    0x4313,
+    0x65E3,
+    0x2302,
+    0x6802,
+    0xB087,
+    0x4313,
+    0x6003,
+    0x4BA1,
+    0x4AA1,
+    0x66E3,
+    0x2300,
+    0x6013,
+    0x2280,
+    0x6828,
+    0x04D2,
+    0x4302,
+    0x602A,
+    0x2280,
+    0x0552,
+    0x4694,
+    0x7D32,
+    0x7D32,
+    0x489B,
+    0x3A02,
+    0x18D2,
+    0x6762,
+    0x7802,
+    0x7802,
+    0x4899,
+    0xB2D2,
+    0x6722,
+    0x4A99,
+    0x7812,
+    0xB2D2,
+    0x6002,
+    0x2080,
+    0x682A,
+    0x0440,
+    0x4302,
+    0x602A,
+    0x682A,
+    0x4895,
+    0x4002,
+    0x602A,
+    0x6561,
+    0x4660,
+    0x6D22,
+    0x4202,
+    0xD0FB,
+    0x4A92,
+    0x4892,
+    0x6817,
+    0x009A,
+    0x1810,
+    0x6007,
+    0x4F91,
+    0x7838,
+    0x7838,
+    0x4F8A,
+    0xB2C0,
+    0x6720,
+    0x488A,
+    0x7800,
+    0xB2C0,
+    0x6038,
+    0x2780,
+    0x6828,
+    0x047F,
+    0x4338,
+    0x6028,
+    0x6828,
+    0x4F86,
+    0x4038,
+    0x6028,
+    0x6561,
+    0x4667,
+    0x6D20,
+    0x4238,
+    0xD0FB,
+    0x4883,
+    0x4F85,
+    0x6800,
+    0x19D2,
+    0x3301,
+    0x6010,
+    0x2B05,
+    0xD1BC,
+    0x4B7B,
+    0x7819,
+    0x4B80,
+    0xB2C9,
+    0x781A,
+    0x6AB3,
+    0x6BF0,
+    0xB2D2,
+    0x9000,
+    0x2061,
+    0xF7FF,
+    0xFF23,
+    0x4B75,
+    0x0007,
+    0x7819,
+    0x4B79,
+    0xB2C9,
+    0x781A,
+    0x6A73,
+    0x6BB0,
+    0xB2D2,
+    0x9000,
+    0x2061,
+    0xF7FF,
+    0xFF16,
+    0x4B6E,
+    0x9003,
+    0x7819,
+    0x4B73,
+    0xB2C9,
+    0x781A,
+    0x6A73,
+    0x6BB0,
+    0xB2D2,
+    0x9000,
+    0x201E,
+    0xF7FF,
+    0xFF09,
+    0x4B68,
+    0x9004,
+    0x7819,
+    0x4B6C,
+    0xB2C9,
+    0x781A,
+    0x6A33,
+    0x6B70,
+    0xB2D2,
+    0x9000,
+    0x201E,
+    0xF7FF,
+    0xFEFC,
+    0x2201,
+    0x4B63,
+    0x9005,
+    0x781B,
+    0x0038,
+    0x3B05,
+    0x409A,
+    0x0011,
+    0x9202,
+    0xF7FF,
+    0xFBA5,
+    0x4F64,
+    0x42B8,
+    0xDD00,
+    0x0038,
+    0x2396,
+    0x011B,
+    0x4298,
+    0xDA00,
+    0x0018,
+    0x4B60,
+    0xB280,
+    0x8018,
+    0x9902,
+    0x9803,
+    0xF7FF,
+    0xFB95,
+    0x42B8,
+    0xDD00,
+    0x485B,
+    0x2396,
+    0x011B,
+    0x4298,
+    0xDA00,
+    0x0018,
+    0x4B5A,
+    0xB280,
+    0x8018,
+    0x9902,
+    0x9804,
+    0xF7FF,
+    0xFB86,
+    0x239B,
+    0x011B,
+    0x4298,
+    0xDD00,
+    0x0018,
+    0x42B8,
+    0xDA00,
+    0x4851,
+    0x4B53,
+    0xB280,
+    0x8018,
+    0x9902,
+    0x9805,
+    0xF7FF,
+    0xFB77,
+    0x239B,
+    0x011B,
+    0x4298,
+    0xDD00,
+    0x0018,
+    0x42B8,
+    0xDA00,
+    0x4849,
+    0x4B4D,
+    0xB280,
+    0x8018,
+    0x4B4C,
+    0x9302,
+    0x9B02,
+    0x881F,
+    0xB2BF,
+    0x0038,
+    0xF7FF,
+    0xFEBC,
+    0x7D33,
+    0x7D33,
+    0x0001,
+    0x181B,
+    0x6763,
+    0x0038,
+    0xF7FF,
+    0xFEF0,
+    0x6720,
+    0x6CB3,
+    0x6CB3,
+    0x4A44,
+    0x059B,
+    0x0D9B,
+    0x66E3,
+    0x7813,
+    0x4934,
+    0xB2DB,
+    0x600B,
+    0x2180,
+    0x682B,
+    0x0449,
+    0x430B,
+    0x602B,
+    0x682B,
+    0x4932,
+    0x400B,
+    0x602B,
+    0x2320,
+    0x6563,
+    0x2380,
+    0x055B,
+    0x6D21,
+    0x4219,
+    0xD0FC,
+    0x4B2E,
+    0x482A,
+    0x6819,
+    0x6CB3,
+    0x6CB3,
+    0x019B,
+    0x0D9B,
+    0x66E3,
+    0x7813,
+    0xB2DB,
+    0x6003,
+    0x2080,
+    0x682B,
+    0x0440,
+    0x4303,
+    0x602B,
+    0x682B,
+    0x4824,
+    0x4003,
+    0x602B,
+    0x2320,
+    0x6563,
+    0x2380,
+    0x055B,
+    0x6D20,
+    0x4218,
+    0xD0FC,
+    0x4B20,
+    0x681F,
+    0x6CB0,
+    0x6CB3,
+    0x0180,
+    0x7812,
+    0x059B,
+    0x0D9B,
+    0x0D80,
+    0x1AC0,
+    0x3A05,
+    0x4090,
+    0x1BC9,
+    0xF7FF,
+    0xFB17,
+    0x9B02,
+    0xB280,
+    0x8098,
+    0x9A02,
+    0x4B22,
+    0x429A,
+    0xD1A4,
+    0x682B,
+    0x4A21,
+    0x490B,
+    0x4013,
+    0x2220,
+    0x602B,
+    0x6DE3,
+    0x4393,
+    0x65E3,
+    0x6DE3,
+    0x1892,
+    0x4393,
+    0x65E3,
+    0x6DE3,
+    0x4A1B,
+    0x4013,
+    0x65E3,
+    0x680B,
+    0x3204,
+    0x32FF,
+    0x4393,
+    0x600B,
+    0xB007,
+    0xBDF0,
+    0xC000,
+    0x4200,
+    0xC0E8,
+    0x4200,
+    0xC0E4,
+    0x4200,
+    0x0000,
+    0x4203,
+    0x01FF,
+    0x0000,
+    0xC0F0,
+    0x4200,
+    0x0018,
+    0x4203,
+    0xC0B8,
+    0x4200,
+    0x001A,
+    0x4203,
+    0xFFFF,
+    0xFEFF,
+    0xC0B4,
+    0x4200,
+    0x001C,
+    0x4203,
+    0x0019,
+    0x4203,
+    0x0030,
+    0x4203,
+    0x0988,
+    0x0000,
+    0x0054,
+    0x4203,
+    0x0056,
+    0x4203,
+    0x0058,
+    0x4203,
+    0x005A,
+    0x4203,
+    0x004C,
+    0x4203,
+    0x0044,
+    0x4203,
+    0x004E,
+    0x4203,
+    0xFFFF,
+    0xFBFF,
+    0xFEFF,
+    0xFFFF,
+    0xB513,
+    0x4C0D,
+    0x6CE1,
+    0x6CE2,
+    0x6D23,
+    0x6D24,
+    0x05DB,
+    0x01E4,
+    0x0112,
+    0x0509,
+    0x0DE4,
+    0x0DDB,
+    0x0D12,
+    0x0D09,
+    0x9400,
+    0xF7FF,
+    0xFE03,
+    0x2380,
+    0x009B,
+    0x4298,
+    0xDB01,
+    0x4804,
+    0xBD16,
+    0x43C3,
+    0x17DB,
+    0x4018,
+    0xE7FA,
+    0x46C0,
+    0x0000,
+    0x4203,
+    0x01FF,
+    0x0000,
+    0x4B11,
+    0x4912,
+    0x6A1A,
+    0xB510,
+    0x400A,
+    0x2100,
+    0x621A,
+    0x4A10,
+    0x2401,
+    0x63D1,
+    0x6A1A,
+    0x490F,
+    0x0020,
+    0x400A,
+    0x621A,
+    0x2280,
+    0x6A19,
+    0x0212,
+    0x430A,
+    0x621A,
+    0x4B0B,
+    0x601C,
+    0xF002,
+    0xF9F2,
+    0x4A0A,
+    0x6813,
+    0x4223,
+    0xD0FC,
+    0x4B09,
+    0x695A,
+    0x2201,
+    0x6959,
+    0x4211,
+    0xD1FC,
+    0xBD10,
+    0x46C0,
+    0x4000,
+    0x4200,
+    0xFFFF,
+    0xFFBF,
+    0x1000,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x4094,
+    0x4200,
+    0x4090,
+    0x4200,
+    0x8000,
+    0x4200,
+    0xB510,
+    0x2401,
+    0x4B04,
+    0x2000,
+    0x601C,
+    0xF002,
+    0xF9D1,
+    0x4A03,
+    0x6813,
+    0x4223,
+    0xD0FC,
+    0xBD10,
+    0x4094,
+    0x4200,
+    0x4090,
+    0x4200,
+    0xB510,
+    0xF004,
+    0xFB6B,
+    0xF7FF,
+    0xFFB9,
+    0xF7FF,
+    0xFCD7,
+    0xF7FF,
+    0xFE13,
+    0xF7FF,
+    0xFFE5,
+    0x2200,
+    0x2102,
+    0x4B05,
+    0x65DA,
+    0x3201,
+    0x655A,
+    0x33E8,
+    0x681A,
+    0x438A,
+    0x601A,
+    0xF004,
+    0xFB5F,
+    0xBD10,
+    0xC000,
+    0x4200,
+    0x2225,
+    0x4B0B,
+    0xB510,
+    0x601A,
+    0x4B0A,
+    0x689C,
+    0x0020,
+    0xF7FF,
+    0xFA4B,
+    0x2000,
+    0xF7FF,
+    0xFB5C,
+    0x2001,
+    0xF7FF,
+    0xFB59,
+    0x0020,
+    0xF7FF,
+    0xFAC4,
+    0x0020,
+    0xF7FF,
+    0xFB05,
+    0xF7FF,
+    0xFFCF,
+    0xBD10,
+    0x0000,
+    0x4203,
+    0x0010,
+    0x4000,
+    0xB5F7,
+    0x2514,
+    0x0007,
+    0x4345,
+    0x200F,
+    0x4288,
+    0x4180,
+    0x4B3B,
+    0x000E,
+    0x18ED,
+    0x4240,
+    0x290F,
+    0xD964,
+    0x4B39,
+    0x18CB,
+    0x005B,
+    0x2201,
+    0x40BA,
+    0x40B8,
+    0x4937,
+    0x4C37,
+    0x9300,
+    0x624E,
+    0x628A,
+    0x6F63,
+    0x4393,
+    0x4303,
+    0xB2DB,
+    0x6763,
+    0x2300,
+    0x602B,
+    0x686B,
+    0x4832,
+    0x4003,
+    0x606B,
+    0x4B32,
+    0x624E,
+    0x628A,
+    0x685A,
+    0x2A00,
+    0xD100,
+    0x4A30,
+    0x230C,
+    0x4373,
+    0x189B,
+    0x681F,
+    0x685B,
+    0x9800,
+    0x9301,
+    0x4B2B,
+    0x7D1C,
+    0xF7FF,
+    0xFD53,
+    0x686B,
+    0x4A2A,
+    0xB2E4,
+    0x4013,
+    0x22F0,
+    0x1824,
+    0x0412,
+    0x0524,
+    0x4014,
+    0x431C,
+    0x0001,
+    0x606C,
+    0x9800,
+    0xF7FF,
+    0xFD80,
+    0x4A24,
+    0x0243,
+    0x4017,
+    0x3802,
+    0x431F,
+    0x287F,
+    0xDD2B,
+    0x207F,
+    0x9B01,
+    0x0244,
+    0x4013,
+    0x9800,
+    0x431C,
+    0xF7FF,
+    0xFF15,
+    0xB280,
+    0x80A8,
+    0x2E0F,
+    0xD923,
+    0x4B1C,
+    0x6FDB,
+    0x065B,
+    0x0F9B,
+    0x2B03,
+    0xD100,
+    0x3B01,
+    0x4A19,
+    0x189B,
+    0x781A,
+    0xB2D2,
+    0x0793,
+    0xD409,
+    0x21FE,
+    0x0263,
+    0x165B,
+    0x3301,
+    0x03C9,
+    0x041B,
+    0x400B,
+    0x4914,
+    0x400C,
+    0x431C,
+    0x60AF,
+    0x60EC,
+    0x612A,
+    0xBDF7,
+    0x2305,
+    0x434B,
+    0x4A10,
+    0x189B,
+    0xE798,
+    0x43C3,
+    0x17DB,
+    0x4018,
+    0xE7D0,
+    0x4B06,
+    0x7C1A,
+    0xE7E2,
+    0x808C,
+    0x4200,
+    0x04A1,
+    0x0000,
+    0x8000,
+    0x4200,
+    0x4000,
+    0x4200,
+    0xFFFF,
+    0xFFF0,
+    0x0000,
+    0x4203,
+    0x1A58,
+    0x1003,
+    0xFFFF,
+    0xFF0F,
+    0x01FF,
+    0x07FF,
+    0x8004,
+    0x4200,
+    0x0011,
+    0x4203,
+    0xFFFF,
+    0x0780,
+    0x0965,
+    0x0000,
+    0xB510,
+    0x2809,
+    0xD003,
+    0x280A,
+    0xD005,
+    0x2002,
+    0xBD10,
+    0xF7FF,
+    0xFF43,
+    0x2000,
+    0xE7FA,
+    0x4B04,
+    0x6858,
+    0x0A01,
+    0xB2C9,
+    0xB2C0,
+    0xF7FF,
+    0xFF56,
+    0xE7F5,
+    0x46C0,
+    0x8220,
+    0x4203,
+    0x2201,
+    0x4B1F,
+    0xB530,
+    0x6CD9,
+    0x4211,
+    0xD101,
+    0x491D,
+    0x63CA,
+    0x6CDA,
+    0x0792,
+    0xD402,
+    0x2102,
+    0x4A1A,
+    0x63D1,
+    0x6CDA,
+    0x0752,
+    0xD402,
+    0x2104,
+    0x4A17,
+    0x63D1,
+    0x6CDA,
+    0x0712,
+    0xD402,
+    0x2108,
+    0x4A14,
+    0x63D1,
+    0x2101,
+    0x2402,
+    0x4A13,
+    0x6CD8,
+    0x7812,
+    0x4388,
+    0x4011,
+    0x4301,
+    0x64D9,
+    0x6CD8,
+    0x0051,
+    0x43A0,
+    0x4021,
+    0x4301,
+    0x64D9,
+    0x490E,
+    0x2004,
+    0x7809,
+    0x6CDC,
+    0x430A,
+    0x1E55,
+    0x41AA,
+    0x2508,
+    0x4384,
+    0x0092,
+    0x4314,
+    0x64DC,
+    0x6CDC,
+    0x00C9,
+    0x43AC,
+    0x4029,
+    0x4321,
+    0x64D9,
+    0x6959,
+    0x4381,
+    0x430A,
+    0x615A,
+    0xBD30,
+    0x1000,
+    0x4200,
+    0x3000,
+    0x4201,
+    0xC8F1,
+    0x4203,
+    0xC8F0,
+    0x4203,
+    0x2300,
+    0xB530,
+    0x2204,
+    0x0018,
+    0x2501,
+    0x4913,
+    0x784C,
+    0x2C00,
+    0xD006,
+    0x780C,
+    0x1C20,
+    0x429C,
+    0xD200,
+    0x1C18,
+    0xB2C3,
+    0x0028,
+    0x3A01,
+    0xB2D2,
+    0x3102,
+    0x2A00,
+    0xD1F0,
+    0x4A0C,
+    0x2800,
+    0xD011,
+    0x2018,
+    0x6B11,
+    0x00DB,
+    0x4381,
+    0x4003,
+    0x430B,
+    0x6313,
+    0x2303,
+    0x6B11,
+    0x4399,
+    0x3B01,
+    0x430B,
+    0x6313,
+    0x2304,
+    0x6B11,
+    0x430B,
+    0x6313,
+    0xBD30,
+    0x6310,
+    0xE7FC,
+    0xC8F6,
+    0x4203,
+    0x3000,
+    0x4201,
+    0x4B09,
+    0x781B,
+    0x2B00,
+    0xD002,
+    0x2B01,
+    0xD106,
+    0x3001,
+    0x7803,
+    0x2BFF,
+    0xD001,
+    0x3301,
+    0x7003,
+    0x4770,
+    0x2B02,
+    0xD101,
+    0x3002,
+    0xE7F5,
+    0x3003,
+    0xE7F3,
+    0x46C0,
+    0xC8F5,
+    0x4203,
+    0xB510,
+    0x4B02,
+    0x7018,
+    0xF7FF,
+    0xFF6D,
+    0xBD10,
+    0xC8F1,
+    0x4203,
+    0xB510,
+    0x2803,
+    0xD806,
+    0x4B04,
+    0x0040,
+    0x181C,
+    0x7061,
+    0x54C2,
+    0xF7FF,
+    0xFFA8,
+    0xBD10,
+    0x46C0,
+    0xC8F6,
+    0x4203,
+    0x4B04,
+    0xB510,
+    0x7018,
+    0x1E42,
+    0x4190,
+    0x4B03,
+    0x7018,
+    0xF7FF,
+    0xFF53,
+    0xBD10,
+    0xC8F2,
+    0x4203,
+    0xC8F0,
+    0x4203,
+    0xB5F8,
+    0x2401,
+    0x4B1C,
+    0x781B,
+    0x4223,
+    0xD033,
+    0x4A1B,
+    0x69D3,
+    0x08DB,
+    0x4223,
+    0xD02E,
+    0x69D3,
+    0x091B,
+    0x4223,
+    0xD02A,
+    0xF004,
+    0xF9C7,
+    0x4B17,
+    0x0025,
+    0x7819,
+    0x2318,
+    0x4816,
+    0x434B,
+    0x8802,
+    0x4E15,
+    0x8801,
+    0x4F15,
+    0x1989,
+    0x18C9,
+    0x7809,
+    0x408D,
+    0x4914,
+    0x644D,
+    0x4D14,
+    0x1952,
+    0x18D2,
+    0x7815,
+    0x43A5,
+    0x7015,
+    0x6D8D,
+    0x8802,
+    0x1992,
+    0x18D2,
+    0x7812,
+    0x19D2,
+    0x0092,
+    0x6015,
+    0x8802,
+    0x2000,
+    0x1992,
+    0x18D3,
+    0x781B,
+    0x409C,
+    0x640C,
+    0xF7FF,
+    0xFFBA,
+    0xF004,
+    0xF9A6,
+    0xBDF8,
+    0x46C0,
+    0xC8F2,
+    0x4203,
+    0x3000,
+    0x4201,
+    0x0210,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x9000,
+    0x4201,
+    0x800C,
+    0x4203,
+    0x4B04,
+    0x781B,
+    0x2B00,
+    0xD003,
+    0x4242,
+    0x4150,
+    0x4B02,
+    0x7018,
+    0x4770,
+    0x46C0,
+    0xC8F2,
+    0x4203,
+    0xC8F0,
+    0x4203,
+    0xB5F8,
+    0x0004,
+    0xF004,
+    0xF97A,
+    0x2200,
+    0x4B19,
+    0x71DA,
+    0x719A,
+    0xF7FF,
+    0xFF32,
+    0x2C00,
+    0xD00B,
+    0x4A16,
+    0x7813,
+    0x2BFF,
+    0xD007,
+    0x4B15,
+    0x781B,
+    0x2BFF,
+    0xD003,
+    0x7813,
+    0x3301,
+    0xB2DB,
+    0x7013,
+    0x2401,
+    0x2518,
+    0x4B11,
+    0x4E12,
+    0x781A,
+    0x4F12,
+    0x4355,
+    0x0022,
+    0x8833,
+    0x19DB,
+    0x195B,
+    0x781B,
+    0x409A,
+    0x4B0F,
+    0x645A,
+    0xF004,
+    0xF955,
+    0x490E,
+    0x698B,
+    0x8832,
+    0x19D2,
+    0x1952,
+    0x7812,
+    0x4094,
+    0x43A3,
+    0xB29B,
+    0x618B,
+    0xF004,
+    0xF951,
+    0xF004,
+    0xF94F,
+    0xBDF8,
+    0xC8F6,
+    0x4203,
+    0x0276,
+    0x4203,
+    0x0277,
+    0x4203,
+    0x0278,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x1000,
+    0x4200,
+    0xB5F7,
+    0x4C3A,
+    0x7823,
+    0x2B0F,
+    0xD85D,
+    0x4D39,
+    0x2601,
+    0x782B,
+    0x075B,
+    0xD558,
+    0x2800,
+    0xD157,
+    0xF7FF,
+    0xFFAA,
+    0x782B,
+    0x099B,
+    0x4233,
+    0xD050,
+    0x4A33,
+    0x7813,
+    0x2BFF,
+    0xD15A,
+    0x7823,
+    0x2418,
+    0x4E31,
+    0x435C,
+    0x8832,
+    0x4F31,
+    0xB292,
+    0x9201,
+    0xF004,
+    0xF916,
+    0x2201,
+    0x8833,
+    0x482E,
+    0x2101,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x409A,
+    0x647A,
+    0x4A2C,
+    0x9B01,
+    0x4694,
+    0x4463,
+    0x191B,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x4A29,
+    0x6DBB,
+    0x7811,
+    0x22FA,
+    0x0092,
+    0x434A,
+    0x18D2,
+    0x8833,
+    0x4926,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x185B,
+    0x009B,
+    0x601A,
+    0xF004,
+    0xF8F4,
+    0x4922,
+    0x481E,
+    0x698B,
+    0x8832,
+    0xB29B,
+    0x1812,
+    0x2001,
+    0x1912,
+    0x7812,
+    0x4090,
+    0x4303,
+    0x618B,
+    0xF004,
+    0xF8EE,
+    0x2201,
+    0x8833,
+    0x4816,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x409A,
+    0x643A,
+    0xF004,
+    0xF8E4,
+    0x2101,
+    0x4A17,
+    0x782B,
+    0x71D1,
+    0x3102,
+    0x400B,
+    0x7193,
+    0xF7FF,
+    0xFE91,
+    0xBDF7,
+    0x2808,
+    0xD004,
+    0x280F,
+    0xD005,
+    0x782B,
+    0x091B,
+    0xE7A4,
+    0x782B,
+    0x095B,
+    0xE7A1,
+    0x782B,
+    0x08DB,
+    0xE79E,
+    0x7813,
+    0x3301,
+    0xB2DB,
+    0x7013,
+    0xE79F,
+    0x0278,
+    0x4203,
+    0x0273,
+    0x4203,
+    0x0277,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x8008,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x0274,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x1000,
+    0x4200,
+    0xC8F6,
+    0x4203,
+    0x2301,
+    0xB5F7,
+    0x4D3A,
+    0x682A,
+    0x421A,
+    0xD025,
+    0x4E39,
+    0x63F3,
+    0x69F2,
+    0x69F4,
+    0x6829,
+    0x4219,
+    0xD1F9,
+    0x4F37,
+    0x0964,
+    0x4054,
+    0x7839,
+    0x401C,
+    0x0022,
+    0x42A1,
+    0xD101,
+    0x4063,
+    0x001A,
+    0x4B33,
+    0x703A,
+    0x9301,
+    0x2A00,
+    0xD048,
+    0x69F3,
+    0x4A31,
+    0x075B,
+    0x0F9B,
+    0x4830,
+    0x7013,
+    0xF7FF,
+    0xFE74,
+    0x69F3,
+    0x9A01,
+    0x071B,
+    0x0FDB,
+    0x7013,
+    0x783B,
+    0x42A3,
+    0xD136,
+    0x682B,
+    0x079B,
+    0xD502,
+    0x2202,
+    0x4B24,
+    0x63DA,
+    0x682B,
+    0x2201,
+    0x075B,
+    0xD51F,
+    0x2304,
+    0x4C21,
+    0x63E3,
+    0x4B25,
+    0x781B,
+    0x2B00,
+    0xD005,
+    0x69E3,
+    0x08DB,
+    0x4213,
+    0xD02B,
+    0x4B1E,
+    0x701A,
+    0x4B21,
+    0x781B,
+    0x2B00,
+    0xD00E,
+    0xF7FF,
+    0xFE89,
+    0x4B1F,
+    0x781B,
+    0x079B,
+    0xD508,
+    0x69E3,
+    0x071B,
+    0x0FD8,
+    0x2B00,
+    0xDB03,
+    0xF7FF,
+    0xFE70,
+    0xF005,
+    0xFDCA,
+    0x682B,
+    0x071B,
+    0xD508,
+    0x2208,
+    0x4B0F,
+    0x63DA,
+    0x4B14,
+    0x781B,
+    0x2B00,
+    0xD001,
+    0xF7FF,
+    0xFE70,
+    0xBDF7,
+    0x0022,
+    0xE7B1,
+    0x9B01,
+    0x781B,
+    0x2B00,
+    0xD1BF,
+    0x4810,
+    0xF7FF,
+    0xFE2C,
+    0xE7BB,
+    0x69E1,
+    0x69E3,
+    0x095B,
+    0x404B,
+    0x4213,
+    0xD0CF,
+    0x480C,
+    0xF7FF,
+    0xFE22,
+    0xE7CB,
+    0x46C0,
+    0x108C,
+    0x4200,
+    0x3000,
+    0x4201,
+    0xC8F3,
+    0x4203,
+    0xC8F4,
+    0x4203,
+    0xC8F5,
+    0x4203,
+    0x027C,
+    0x4203,
+    0xC8F1,
+    0x4203,
+    0xC8F0,
+    0x4203,
+    0xC8F2,
+    0x4203,
+    0x0280,
+    0x4203,
+    0x0284,
+    0x4203,
+    0x2302,
+    0xB510,
+    0x2840,
+    0xD105,
+    0x4B03,
+    0x7818,
+    0xB2C0,
+    0xF7FF,
+    0xFE17,
+    0x2300,
+    0x0018,
+    0xBD10,
+    0x8224,
+    0x4203,
+    0x4B05,
+    0x6A9A,
+    0x0692,
+    0xD405,
+    0x4A04,
+    0x7010,
+    0x4A04,
+    0x7011,
+    0x2220,
+    0x601A,
+    0x4770,
+    0x46C0,
+    0x4000,
+    0x4201,
+    0x8200,
+    0x4203,
+    0x8201,
+    0x4203,
+    0xB570,
+    0x0004,
+    0x000D,
+    0x0016,
+    0x2800,
+    0xD10A,
+    0x4805,
+    0xF003,
+    0xFE23,
+    0x0031,
+    0x0028,
+    0xF003,
+    0xFE51,
+    0x0021,
+    0x2005,
+    0xF7FF,
+    0xFFDD,
+    0xBD70,
+    0x1CF8,
+    0x1003,
+    0x2202,
+    0xB5F8,
+    0x24C1,
+    0x4B3B,
+    0x00A4,
+    0x801A,
+    0x4B3A,
+    0x4D3B,
+    0x5919,
+    0x27FF,
+    0x4029,
+    0x5119,
+    0x21C2,
+    0x0089,
+    0x5858,
+    0x4E38,
+    0x43B8,
+    0x5058,
+    0x5858,
+    0x4028,
+    0x25C3,
+    0x5058,
+    0x2080,
+    0x00AD,
+    0x5959,
+    0x01C0,
+    0x4031,
+    0x4301,
+    0x5159,
+    0x2580,
+    0x5919,
+    0x022D,
+    0x4031,
+    0x4329,
+    0x5119,
+    0x3C04,
+    0x5919,
+    0x43B9,
+    0x3F7F,
+    0x4339,
+    0x5119,
+    0x5919,
+    0x46BC,
+    0x4031,
+    0x430D,
+    0x511D,
+    0x2580,
+    0x2140,
+    0x006D,
+    0x1964,
+    0x2680,
+    0x6019,
+    0x601D,
+    0x601C,
+    0x2420,
+    0x01B6,
+    0x601E,
+    0x601C,
+    0x3C1F,
+    0x601C,
+    0x601A,
+    0xB662,
+    0x4B21,
+    0x6A5F,
+    0x4327,
+    0x625F,
+    0x695F,
+    0x0038,
+    0x2780,
+    0x00BF,
+    0x4307,
+    0x2080,
+    0x615F,
+    0x6A5F,
+    0x01C0,
+    0x4317,
+    0x625F,
+    0x695F,
+    0x433E,
+    0x615E,
+    0x695E,
+    0x4335,
+    0x615D,
+    0x695D,
+    0x4328,
+    0x6158,
+    0x2010,
+    0x6C5D,
+    0x4328,
+    0x6458,
+    0x6B18,
+    0x4D14,
+    0x4320,
+    0x6318,
+    0x6B18,
+    0x4302,
+    0x631A,
+    0x2204,
+    0x6B18,
+    0x4302,
+    0x4660,
+    0x631A,
+    0x6B1A,
+    0x430A,
+    0x631A,
+    0x6B1A,
+    0x4302,
+    0x631A,
+    0x695A,
+    0x4311,
+    0x6159,
+    0x782B,
+    0x2B00,
+    0xD106,
+    0xF002,
+    0xFBFC,
+    0xF002,
+    0xFA4A,
+    0xF002,
+    0xFA9A,
+    0x702C,
+    0xBDF8,
+    0x6056,
+    0x4200,
+    0xE100,
+    0xE000,
+    0xFFFF,
+    0xFF00,
+    0x00FF,
+    0xFFFF,
+    0x1000,
+    0x4200,
+    0xC8FF,
+    0x4203,
+    0xB510,
+    0x4B21,
+    0x781B,
+    0x2B01,
+    0xD135,
+    0x4C20,
+    0xF003,
+    0xFF5A,
+    0x481F,
+    0xF003,
+    0xF877,
+    0x7823,
+    0xB2DA,
+    0x2B01,
+    0xD119,
+    0x2800,
+    0xD01B,
+    0x2340,
+    0x7023,
+    0xF7FF,
+    0xFBF9,
+    0x2400,
+    0x0021,
+    0x2003,
+    0xF7FF,
+    0xFC10,
+    0x0020,
+    0x3401,
+    0x2101,
+    0xB2E4,
+    0xF001,
+    0xFDDC,
+    0x2C38,
+    0xD1F3,
+    0xF002,
+    0xF9FE,
+    0xF002,
+    0xF94C,
+    0xF002,
+    0xFE66,
+    0xE00F,
+    0x2A15,
+    0xD1E5,
+    0x2800,
+    0xD10E,
+    0x4A0E,
+    0x6813,
+    0x2B00,
+    0xD007,
+    0x4B0D,
+    0x681B,
+    0x6811,
+    0x4A0C,
+    0x185B,
+    0x6D92,
+    0x1A9B,
+    0xD4D7,
+    0xF003,
+    0xFF2F,
+    0xBD10,
+    0xF002,
+    0xF804,
+    0xF7F6,
+    0xFF54,
+    0xF002,
+    0xF924,
+    0xE7CD,
+    0x46C0,
+    0x028C,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x0884,
+    0x0000,
+    0x0294,
+    0x4203,
+    0x0290,
+    0x4203,
+    0x9000,
+    0x4201,
+    0xB5F0,
+    0x4E45,
+    0xB085,
+    0xF003,
+    0xFF0D,
+    0x7834,
+    0xF003,
+    0xFB32,
+    0x4D42,
+    0xB2E4,
+    0x2800,
+    0xD100,
+    0xE079,
+    0x4F41,
+    0x783B,
+    0x2B00,
+    0xD000,
+    0xE074,
+    0x4B3F,
+    0x781B,
+    0xB2D9,
+    0x2B00,
+    0xD000,
+    0xE06E,
+    0x2C00,
+    0xD139,
+    0xF003,
+    0xFAEE,
+    0x2800,
+    0xD044,
+    0x2301,
+    0x2118,
+    0x703B,
+    0x4B39,
+    0x781A,
+    0x882B,
+    0x4351,
+    0x468C,
+    0xB2D4,
+    0x4A37,
+    0x4463,
+    0x189A,
+    0x8812,
+    0x4936,
+    0x9201,
+    0x4A36,
+    0x6D97,
+    0x882A,
+    0x1852,
+    0x4462,
+    0x7812,
+    0x4934,
+    0x1852,
+    0x0092,
+    0x6017,
+    0x9901,
+    0x4A32,
+    0x1889,
+    0x6809,
+    0x189A,
+    0x6011,
+    0x7902,
+    0x4930,
+    0xB2D2,
+    0x1859,
+    0x700A,
+    0x88C2,
+    0x492F,
+    0xB292,
+    0x185B,
+    0x801A,
+    0xF003,
+    0xFA99,
+    0xAB02,
+    0x1DD9,
+    0x2300,
+    0x0020,
+    0x700B,
+    0xF002,
+    0xFA2C,
+    0x0020,
+    0xF003,
+    0xF849,
+    0xE00E,
+    0x2C15,
+    0xD12D,
+    0xF002,
+    0xF9F0,
+    0x1E01,
+    0xD1BF,
+    0x4B1C,
+    0x7818,
+    0xB2C0,
+    0xF002,
+    0xFFE1,
+    0x2800,
+    0xD1B8,
+    0xF7FF,
+    0xFF4D,
+    0x7833,
+    0x2B01,
+    0xD801,
+    0xF003,
+    0xF99A,
+    0x2220,
+    0x2400,
+    0x2618,
+    0x2702,
+    0x4B1B,
+    0x67DA,
+    0x882A,
+    0x4B1B,
+    0x18D2,
+    0x0033,
+    0x4363,
+    0x189B,
+    0x781B,
+    0x423B,
+    0xD002,
+    0xB2E0,
+    0xF002,
+    0xFC38,
+    0x3401,
+    0x2C10,
+    0xD1F0,
+    0x2220,
+    0x4B14,
+    0x601A,
+    0xF003,
+    0xFE98,
+    0xB005,
+    0xBDF0,
+    0x2C01,
+    0xD1DC,
+    0xE7D2,
+    0x2C01,
+    0xD9D7,
+    0x2C15,
+    0xD1D7,
+    0xE7D4,
+    0x0200,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x0212,
+    0x4203,
+    0x0213,
+    0x4203,
+    0x0210,
+    0x4203,
+    0x8006,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x6400,
+    0x1080,
+    0x8000,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x800A,
+    0x4203,
+    0xE104,
+    0xE000,
+    0x800C,
+    0x4203,
+    0xE100,
+    0xE000,
+    0xB5F8,
+    0xF000,
+    0xFB67,
+    0x2401,
+    0xF7FF,
+    0xFE7A,
+    0x2500,
+    0x4F16,
+    0x4B16,
+    0x60BC,
+    0x781B,
+    0x4E16,
+    0x2B00,
+    0xD011,
+    0xF003,
+    0xFE58,
+    0x4B14,
+    0x781B,
+    0x2B01,
+    0xD809,
+    0xF002,
+    0xF856,
+    0x4B0F,
+    0x701D,
+    0x7034,
+    0xF003,
+    0xFE55,
+    0x68FB,
+    0x4323,
+    0x60FB,
+    0xF003,
+    0xFE50,
+    0x7833,
+    0x2B00,
+    0xD006,
+    0xF003,
+    0xFE43,
+    0x7035,
+    0xF002,
+    0xF850,
+    0xF003,
+    0xFE46,
+    0x2784,
+    0x4E08,
+    0x05FF,
+    0xF7FF,
+    0xFF27,
+    0x51BC,
+    0xF003,
+    0xFE58,
+    0x51BD,
+    0xE7D2,
+    0x2000,
+    0x4200,
+    0x0208,
+    0x4203,
+    0xC8FE,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x0814,
+    0x0000,
+    0xB570,
+    0x2480,
+    0x2501,
+    0x01A4,
+    0x4E25,
+    0x6933,
+    0x001A,
+    0x4022,
+    0x4223,
+    0xD102,
+    0x4B23,
+    0x609A,
+    0xBD70,
+    0x6FF3,
+    0x422B,
+    0xD01C,
+    0x4B21,
+    0x601D,
+    0x4B21,
+    0x781B,
+    0xB2D8,
+    0x2B02,
+    0xD02F,
+    0x3810,
+    0xB2C3,
+    0x2B16,
+    0xD811,
+    0x2816,
+    0xD80F,
+    0xF7F5,
+    0xFB6F,
+    0x0E25,
+    0x250E,
+    0x2525,
+    0x2525,
+    0x2525,
+    0x0E25,
+    0x0E25,
+    0x0E0E,
+    0x1F22,
+    0x1F1F,
+    0x0C0E,
+    0x001F,
+    0xF005,
+    0xF951,
+    0x2302,
+    0x6FF2,
+    0x421A,
+    0xD0D2,
+    0x4A11,
+    0x6013,
+    0x4B11,
+    0x781A,
+    0xB2D3,
+    0x2A23,
+    0xD811,
+    0x2B20,
+    0xD812,
+    0xD1C8,
+    0xF005,
+    0xFB09,
+    0xE7C5,
+    0xF004,
+    0xFE12,
+    0xE7EB,
+    0xF006,
+    0xF9C7,
+    0xE7E8,
+    0xF007,
+    0xFB38,
+    0xE7E5,
+    0xF002,
+    0xFD0D,
+    0xE7E2,
+    0x3B25,
+    0x2B01,
+    0xD8B6,
+    0xF004,
+    0xFAD7,
+    0xE7B3,
+    0x1000,
+    0x4200,
+    0x2000,
+    0x4200,
+    0x4094,
+    0x4200,
+    0x0200,
+    0x4203,
+    0xB5F7,
+    0x2601,
+    0x4B61,
+    0x6D98,
+    0xB280,
+    0xF003,
+    0xFDDF,
+    0xB2C0,
+    0x280F,
+    0xD903,
+    0x2200,
+    0x4B5E,
+    0x609A,
+    0xBDF7,
+    0xF002,
+    0xF8B8,
+    0x9000,
+    0x28FF,
+    0xD0EE,
+    0x2418,
+    0xF003,
+    0xFDBC,
+    0x0030,
+    0x9900,
+    0x4D58,
+    0x4A56,
+    0x434C,
+    0x6993,
+    0x4957,
+    0x882A,
+    0x000F,
+    0x1852,
+    0x1912,
+    0x7812,
+    0x4090,
+    0x4A51,
+    0x4383,
+    0xB29B,
+    0x6193,
+    0xF003,
+    0xFDB1,
+    0x0032,
+    0x882B,
+    0x9900,
+    0x19DB,
+    0x191B,
+    0x781B,
+    0x409A,
+    0x0013,
+    0x4A4E,
+    0x6553,
+    0x882B,
+    0x191B,
+    0x9301,
+    0x4B4C,
+    0x781B,
+    0x4299,
+    0xD103,
+    0x2001,
+    0xF7FF,
+    0xFC17,
+    0xE7C3,
+    0x4949,
+    0x9B01,
+    0x468C,
+    0x4463,
+    0x001F,
+    0x781B,
+    0x2B03,
+    0xD12F,
+    0x4F46,
+    0x882B,
+    0x46BC,
+    0x4841,
+    0x4945,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x4F43,
+    0x185B,
+    0x9901,
+    0x009B,
+    0x4461,
+    0x681B,
+    0x6809,
+    0x18C9,
+    0x882B,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x19DB,
+    0x009B,
+    0x6019,
+    0x0031,
+    0x882B,
+    0x0007,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x4099,
+    0x6411,
+    0xF003,
+    0xFD6B,
+    0x0031,
+    0x4A2E,
+    0x6993,
+    0x882A,
+    0xB29B,
+    0x19D2,
+    0x1912,
+    0x7812,
+    0x4091,
+    0x4A2A,
+    0x430B,
+    0x6193,
+    0xF003,
+    0xFD65,
+    0xE78B,
+    0x882B,
+    0x492A,
+    0x185B,
+    0x191B,
+    0x7819,
+    0x6CD3,
+    0xB29B,
+    0x410B,
+    0x4233,
+    0xD002,
+    0x9800,
+    0xF002,
+    0xFA4D,
+    0x783B,
+    0x2B1A,
+    0xD123,
+    0x4B28,
+    0x4A29,
+    0x4929,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x4828,
+    0x434B,
+    0x4928,
+    0x189B,
+    0x4A28,
+    0x181B,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x4F27,
+    0x434B,
+    0x189B,
+    0x181A,
+    0x7810,
+    0x4A25,
+    0xB2C0,
+    0x189B,
+    0x7819,
+    0xB2C9,
+    0xF7FD,
+    0xFF05,
+    0x9A01,
+    0x0001,
+    0x19D3,
+    0x8818,
+    0x4B1C,
+    0x2204,
+    0x18C0,
+    0xF007,
+    0xF932,
+    0x4A1E,
+    0x9B01,
+    0x4694,
+    0x4463,
+    0x781B,
+    0x9800,
+    0x4233,
+    0xD110,
+    0xF002,
+    0xFEA8,
+    0xF003,
+    0xFD1C,
+    0x4807,
+    0x490A,
+    0x6983,
+    0x882A,
+    0xB29B,
+    0x1852,
+    0x0031,
+    0x1912,
+    0x7812,
+    0x4091,
+    0x430B,
+    0x6183,
+    0xE7AF,
+    0xF002,
+    0xFB9F,
+    0xE7ED,
+    0x1000,
+    0x4200,
+    0x2000,
+    0x4200,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0278,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8003,
+    0x4203,
+    0x800C,
+    0x4203,
+    0xB570,
+    0x4C23,
+    0x6F23,
+    0x069B,
+    0xD502,
+    0x2220,
+    0x4B21,
+    0x625A,
+    0x2501,
+    0x6F22,
+    0x2300,
+    0x422A,
+    0xD005,
+    0x4B1E,
+    0x481E,
+    0x625D,
+    0xF003,
+    0xFB06,
+    0x002B,
+    0x6F22,
+    0x0792,
+    0xD506,
+    0x2202,
+    0x4B19,
+    0x481A,
+    0x625A,
+    0xF003,
+    0xFAFC,
+    0x2301,
+    0x6F22,
+    0x0752,
+    0xD506,
+    0x2204,
+    0x4B14,
+    0x4816,
+    0x625A,
+    0xF003,
+    0xFAF2,
+    0x2301,
+    0x6F22,
+    0x2501,
+    0x0652,
+    0xD512,
+    0x2240,
+    0x4B0E,
+    0x4812,
+    0x625A,
+    0xF003,
+    0xFAE7,
+    0x6F23,
+    0x09DB,
+    0x422B,
+    0xD005,
+    0x2280,
+    0x4B09,
+    0x480E,
+    0x625A,
+    0xF003,
+    0xFADD,
+    0xF001,
+    0xFF71,
+    0xE005,
+    0x6F22,
+    0x09D2,
+    0x422A,
+    0xD1F2,
+    0x2B00,
+    0xD1F6,
+    0x2200,
+    0x4B08,
+    0x609A,
+    0xBD70,
+    0x1000,
+    0x4200,
+    0xC000,
+    0x4200,
+    0x1D0A,
+    0x1003,
+    0x1D11,
+    0x1003,
+    0x1D18,
+    0x1003,
+    0x1D1F,
+    0x1003,
+    0x1D2D,
+    0x1003,
+    0x2000,
+    0x4200,
+    0x2101,
+    0xB570,
+    0x4E5E,
+    0x6E73,
+    0x420B,
+    0xD018,
+    0x2308,
+    0x4C5D,
+    0x6323,
+    0x4B5D,
+    0x881A,
+    0x2362,
+    0x6E25,
+    0xB290,
+    0x08AD,
+    0x400D,
+    0x425B,
+    0x2A00,
+    0xD02B,
+    0x2D00,
+    0xD129,
+    0x6C62,
+    0x4C57,
+    0x0552,
+    0x0F52,
+    0x4113,
+    0x1900,
+    0x420B,
+    0xD01E,
+    0xF007,
+    0xF9D5,
+    0x6E73,
+    0x2101,
+    0x079B,
+    0xD574,
+    0x4C4F,
+    0x6C63,
+    0x099B,
+    0x420B,
+    0xD039,
+    0x6C63,
+    0x055B,
+    0x0F5B,
+    0xD102,
+    0x200F,
+    0xF7FF,
+    0xFB2B,
+    0xF002,
+    0xFDB9,
+    0x4B4B,
+    0x781A,
+    0x2303,
+    0x401A,
+    0x3331,
+    0x4353,
+    0x4A49,
+    0x189B,
+    0x2204,
+    0x625A,
+    0xE053,
+    0xF006,
+    0xFB8A,
+    0xE7DF,
+    0x6C62,
+    0x200C,
+    0x0552,
+    0x0F52,
+    0x4113,
+    0x07DB,
+    0xD518,
+    0xF7FA,
+    0xFF08,
+    0x2240,
+    0x4B41,
+    0x629A,
+    0x2302,
+    0x6323,
+    0x2D00,
+    0xD002,
+    0x330E,
+    0x6323,
+    0x6AE3,
+    0x4B3A,
+    0x781A,
+    0x2303,
+    0x401A,
+    0x3331,
+    0x4353,
+    0x4A38,
+    0x189B,
+    0x2204,
+    0x625A,
+    0xF002,
+    0xFD8C,
+    0xE7BF,
+    0xF006,
+    0xF96D,
+    0xE7E5,
+    0x2262,
+    0x4B30,
+    0x4252,
+    0x881D,
+    0x4B2F,
+    0x18ED,
+    0x6C63,
+    0x0028,
+    0x055B,
+    0x0F5B,
+    0x411A,
+    0x420A,
+    0xD016,
+    0xF007,
+    0xF96B,
+    0x2800,
+    0xD0BB,
+    0x4B2D,
+    0x7818,
+    0x3810,
+    0x2816,
+    0xD8B8,
+    0xF7F5,
+    0xF970,
+    0xB726,
+    0x2EB7,
+    0x2A32,
+    0xB73E,
+    0x3A42,
+    0xB736,
+    0xB72A,
+    0xB7B7,
+    0x0F22,
+    0x0F0F,
+    0x0FB7,
+    0x000F,
+    0xF006,
+    0xFEE8,
+    0xE7E7,
+    0x0028,
+    0xF004,
+    0xFC88,
+    0x2800,
+    0xD0A2,
+    0xF001,
+    0xFAD0,
+    0x6AA3,
+    0xB29B,
+    0x2B00,
+    0xD001,
+    0x2300,
+    0x62A3,
+    0x2304,
+    0x6323,
+    0x2200,
+    0x4B1B,
+    0x609A,
+    0xBD70,
+    0x0028,
+    0xF005,
+    0xF90F,
+    0xE7EB,
+    0x0028,
+    0xF7F5,
+    0xFE71,
+    0xE7E7,
+    0x0028,
+    0xF7F6,
+    0xFC1F,
+    0xE7E3,
+    0x0028,
+    0xF7F7,
+    0xFCC9,
+    0xE7DF,
+    0x0028,
+    0xF7F8,
+    0xF815,
+    0xE7DB,
+    0x0028,
+    0xF7FD,
+    0xFFA3,
+    0xE7D7,
+    0x0028,
+    0xF7FE,
+    0xF9A3,
+    0xE7D3,
+    0x0028,
+    0xF7F9,
+    0xFD03,
+    0xE7CF,
+    0x0028,
+    0xF7F8,
+    0xFCE1,
+    0xE7CB,
+    0x1000,
+    0x4200,
+    0x6000,
+    0x4200,
+    0x0244,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0x8000,
+    0x4200,
+    0x0200,
+    0x4203,
+    0x2000,
+    0x4200,
+    0x2284,
+    0x2380,
+    0x2001,
+    0x05D2,
+    0x011B,
+    0x58D3,
+    0x4398,
+    0x4770,
+    0x20FF,
+    0x2303,
+    0x4A51,
+    0x0080,
+    0xB5F0,
+    0x8390,
+    0x83D3,
+    0x2380,
+    0x494F,
+    0x051B,
+    0x6BCC,
+    0x2544,
+    0x431C,
+    0x63CC,
+    0x69CC,
+    0x35FF,
+    0x4323,
+    0x61CB,
+    0x2380,
+    0x6C0C,
+    0x011B,
+    0x431C,
+    0x640C,
+    0x6A0C,
+    0x26E9,
+    0x4323,
+    0x620B,
+    0x4C47,
+    0x4B47,
+    0x00B6,
+    0x531D,
+    0x2402,
+    0x581D,
+    0x4F46,
+    0x432C,
+    0x501C,
+    0x2408,
+    0x581D,
+    0x432C,
+    0x25A7,
+    0x501C,
+    0x2040,
+    0x00ED,
+    0x595C,
+    0x4320,
+    0x5158,
+    0x2001,
+    0x599C,
+    0x4304,
+    0x519C,
+    0x2483,
+    0x3610,
+    0x00E4,
+    0x539C,
+    0x4E3C,
+    0x539C,
+    0x3602,
+    0x539C,
+    0x4E3B,
+    0x539C,
+    0x3E22,
+    0x599C,
+    0x403C,
+    0x519C,
+    0x249E,
+    0x2750,
+    0x34FF,
+    0x551F,
+    0x6914,
+    0x3730,
+    0x43BC,
+    0x6114,
+    0x6914,
+    0x3F50,
+    0x43BC,
+    0x46A4,
+    0x2410,
+    0x4667,
+    0x433C,
+    0x6114,
+    0x2467,
+    0x270F,
+    0x46A4,
+    0x7114,
+    0x68D4,
+    0x43BC,
+    0x3F08,
+    0x433C,
+    0x60D4,
+    0x4664,
+    0x7154,
+    0x68D4,
+    0x37E9,
+    0x46BC,
+    0x43BC,
+    0x3FA0,
+    0x4327,
+    0x60D7,
+    0x6A4C,
+    0x4304,
+    0x624C,
+    0x6C4C,
+    0x4304,
+    0x644C,
+    0x2480,
+    0x6A0F,
+    0x03A4,
+    0x4327,
+    0x620F,
+    0x6C0F,
+    0x433C,
+    0x640C,
+    0x2100,
+    0x2720,
+    0x4C20,
+    0x7210,
+    0x7251,
+    0x6B21,
+    0x32E4,
+    0x43B9,
+    0x6321,
+    0x2180,
+    0x6814,
+    0x01C9,
+    0x4321,
+    0x2407,
+    0x6011,
+    0x4A1B,
+    0x3F11,
+    0x69D1,
+    0x43B9,
+    0x4321,
+    0x61D1,
+    0x4661,
+    0x69D4,
+    0x438C,
+    0x3980,
+    0x4321,
+    0x61D1,
+    0x2280,
+    0x5999,
+    0x0552,
+    0x430A,
+    0x519A,
+    0x21CB,
+    0x22F7,
+    0x0089,
+    0x0092,
+    0x5299,
+    0x3194,
+    0x585A,
+    0x43BA,
+    0x4310,
+    0x22F4,
+    0x5058,
+    0x2118,
+    0x0092,
+    0x5499,
+    0x3204,
+    0x3906,
+    0x5499,
+    0x595A,
+    0x390E,
+    0x438A,
+    0x515A,
+    0xBDF0,
+    0xC000,
+    0x4200,
+    0x9000,
+    0x4200,
+    0x03DE,
+    0x0000,
+    0xD000,
+    0x4200,
+    0xFFFF,
+    0x9FFF,
+    0x03B6,
+    0x0000,
+    0x03BA,
+    0x0000,
+    0x1000,
+    0x4200,
+    0xB000,
+    0x4200,
+    0x4770,
+    0x0000,
+    0x4B1A,
+    0xB510,
+    0x681C,
+    0x4B1A,
+    0x429C,
+    0xD104,
+    0x228B,
+    0x2000,
+    0x4918,
+    0xF7FF,
+    0xFAF5,
+    0x1D63,
+    0x33FF,
+    0x6819,
+    0x4A16,
+    0x6011,
+    0x685A,
+    0x4B16,
+    0x4916,
+    0x601A,
+    0x0023,
+    0x33FC,
+    0x691A,
+    0x4B15,
+    0x601A,
+    0x4B15,
+    0x4815,
+    0x18E2,
+    0x1812,
+    0x6812,
+    0xC304,
+    0x428B,
+    0xD1F8,
+    0x0023,
+    0x33D1,
+    0x33FF,
+    0x6819,
+    0x4A11,
+    0x6011,
+    0x685A,
+    0x4B10,
+    0x601A,
+    0x23EC,
+    0x005B,
+    0x58E2,
+    0x4B0F,
+    0x601A,
+    0x23EE,
+    0x005B,
+    0x58E2,
+    0x4B0D,
+    0x601A,
+    0xBD10,
+    0x46C0,
+    0x0010,
+    0x4000,
+    0xFF00,
+    0xFFFF,
+    0x1D39,
+    0x1003,
+    0xD540,
+    0x4200,
+    0xD544,
+    0x4200,
+    0xD608,
+    0x4200,
+    0xD52C,
+    0x4200,
+    0xD548,
+    0x4200,
+    0x2BC8,
+    0xBDFF,
+    0xC0F4,
+    0x4200,
+    0xC0F8,
+    0x4200,
+    0xB02C,
+    0x4200,
+    0xA070,
+    0x4200,
+    0xB5F0,
+    0x2817,
+    0xD807,
+    0x2803,
+    0xD904,
+    0x4BB7,
+    0x40C3,
+    0x07DB,
+    0xD500,
+    0xE2C0,
+    0xBDF0,
+    0x3818,
+    0xB2C3,
+    0x2B22,
+    0xD8FA,
+    0x2822,
+    0xD8F8,
+    0xF7F5,
+    0xF807,
+    0x0023,
+    0x0023,
+    0x0023,
+    0x0023,
+    0x0084,
+    0x0084,
+    0x0084,
+    0x0084,
+    0x0102,
+    0x0102,
+    0x0102,
+    0x0102,
+    0x0185,
+    0x0185,
+    0x0185,
+    0x0185,
+    0x01D3,
+    0x01D3,
+    0x01D3,
+    0x034D,
+    0x034D,
+    0x034D,
+    0x023F,
+    0x023F,
+    0x023F,
+    0x03CA,
+    0x03CA,
+    0x03CA,
+    0xFFF7,
+    0xFFF7,
+    0xFFF7,
+    0xFFF7,
+    0x02B8,
+    0x02B8,
+    0x02B8,
+    0x2160,
+    0x2001,
+    0x4A9E,
+    0x2409,
+    0x6FD3,
+    0x4E9E,
+    0x438B,
+    0x67D3,
+    0x4B9D,
+    0x3131,
+    0x68DA,
+    0x31FF,
+    0x4302,
+    0x60DA,
+    0x2220,
+    0x505A,
+    0x499A,
+    0x700C,
+    0x499A,
+    0x680C,
+    0x4314,
+    0x600C,
+    0x2440,
+    0x680D,
+    0x4325,
+    0x600D,
+    0x4997,
+    0x585D,
+    0x4315,
+    0x505D,
+    0x599D,
+    0x4325,
+    0x519D,
+    0x25FF,
+    0x4E94,
+    0x6035,
+    0x4E94,
+    0x6035,
+    0x4E94,
+    0x6035,
+    0x258A,
+    0x00ED,
+    0x595E,
+    0x4332,
+    0x515A,
+    0x3DB8,
+    0x595A,
+    0x4082,
+    0x40C2,
+    0x515A,
+    0x22CA,
+    0x0052,
+    0x589D,
+    0x4328,
+    0x5098,
+    0x2002,
+    0x589D,
+    0x4328,
+    0x5098,
+    0x2030,
+    0x585A,
+    0x43A2,
+    0x505A,
+    0x310C,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x4987,
+    0x4887,
+    0x680A,
+    0x4002,
+    0x600A,
+    0x21E3,
+    0x2280,
+    0x0089,
+    0x5858,
+    0x01D2,
+    0x4302,
+    0x505A,
+    0x4983,
+    0x4883,
+    0x585A,
+    0x4002,
+    0x505A,
+    0x22F0,
+    0x4982,
+    0x5858,
+    0x4302,
+    0x505A,
+    0x220E,
+    0x4980,
+    0x6808,
+    0x4302,
+    0x600A,
+    0x2296,
+    0x619A,
+    0xE772,
+    0x2260,
+    0x2402,
+    0x496E,
+    0x2040,
+    0x6FCB,
+    0x2603,
+    0x4393,
+    0x3A40,
+    0x4313,
+    0x67CB,
+    0x4B6C,
+    0x4F78,
+    0x68D9,
+    0x4321,
+    0x60D9,
+    0x21C8,
+    0x0049,
+    0x5058,
+    0x219D,
+    0x00C9,
+    0x585D,
+    0x43B5,
+    0x26E5,
+    0x4325,
+    0x505D,
+    0x00B6,
+    0x599D,
+    0x403D,
+    0x519D,
+    0x259F,
+    0x270F,
+    0x00ED,
+    0x595E,
+    0x43BE,
+    0x515E,
+    0x595E,
+    0x4386,
+    0x515E,
+    0x585D,
+    0x2630,
+    0x4395,
+    0x505D,
+    0x585D,
+    0x4385,
+    0x505D,
+    0x258C,
+    0x00ED,
+    0x5959,
+    0x43B1,
+    0x5159,
+    0x4D5F,
+    0x4E5F,
+    0x6829,
+    0x4031,
+    0x6029,
+    0x4957,
+    0x680D,
+    0x4315,
+    0x600D,
+    0x680D,
+    0x4305,
+    0x600D,
+    0x218A,
+    0x00C9,
+    0x585D,
+    0x432A,
+    0x505A,
+    0x22FF,
+    0x4953,
+    0x259A,
+    0x600A,
+    0x4952,
+    0x00ED,
+    0x600A,
+    0x4952,
+    0x600A,
+    0x21E6,
+    0x0089,
+    0x585A,
+    0x0052,
+    0x0852,
+    0x505A,
+    0x2101,
+    0x595A,
+    0x438A,
+    0x515A,
+    0x22CA,
+    0x0052,
+    0x589D,
+    0x4329,
+    0x5099,
+    0x5899,
+    0x430C,
+    0x4945,
+    0x509C,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x2280,
+    0x39C8,
+    0x5858,
+    0x01D2,
+    0x4302,
+    0x4846,
+    0x505A,
+    0x5819,
+    0x4A46,
+    0x4011,
+    0x2280,
+    0x0152,
+    0x430A,
+    0x501A,
+    0x22F0,
+    0x4843,
+    0x5819,
+    0x4391,
+    0x3A20,
+    0x430A,
+    0x501A,
+    0x200E,
+    0x4941,
+    0x680A,
+    0x4382,
+    0x600A,
+    0x22CB,
+    0xE77F,
+    0x2160,
+    0x2015,
+    0x4A2F,
+    0x4C32,
+    0x6FD3,
+    0x438B,
+    0x3920,
+    0x430B,
+    0x67D3,
+    0x4A2E,
+    0x4B2D,
+    0x7010,
+    0x2201,
+    0x68D8,
+    0x4390,
+    0x60D8,
+    0x2020,
+    0x6825,
+    0x4305,
+    0x6025,
+    0x6825,
+    0x430D,
+    0x6025,
+    0x2480,
+    0x4D2D,
+    0x02A4,
+    0x682E,
+    0x4334,
+    0x602C,
+    0x2480,
+    0x4D26,
+    0x595E,
+    0x4334,
+    0x515C,
+    0x4C25,
+    0x260F,
+    0x6022,
+    0x4C24,
+    0x6022,
+    0x4C24,
+    0x6022,
+    0x248C,
+    0x00E4,
+    0x591F,
+    0x43B7,
+    0x3E06,
+    0x433E,
+    0x511E,
+    0x595E,
+    0x4331,
+    0x5159,
+    0x2130,
+    0x591D,
+    0x4329,
+    0x5119,
+    0x21CA,
+    0x0049,
+    0x585C,
+    0x4394,
+    0x505C,
+    0x2402,
+    0x585A,
+    0x43A2,
+    0x505A,
+    0x228A,
+    0x00D2,
+    0x5899,
+    0x4308,
+    0x2100,
+    0x5098,
+    0x3218,
+    0x5099,
+    0x21E6,
+    0x0089,
+    0x585A,
+    0x0052,
+    0x0852,
+    0x505A,
+    0x390C,
+    0x585A,
+    0x4818,
+    0x4002,
+    0x505A,
+    0x4911,
+    0x4812,
+    0x585A,
+    0x4002,
+    0x505A,
+    0x22F0,
+    0x4910,
+    0x5858,
+    0x4302,
+    0x505A,
+    0xE79A,
+    0x46C0,
+    0xF0F0,
+    0x00F0,
+    0x8004,
+    0x4200,
+    0x045C,
+    0x0000,
+    0xD000,
+    0x4200,
+    0xD029,
+    0x4200,
+    0xD0B0,
+    0x4200,
+    0x0454,
+    0x0000,
+    0xD088,
+    0x4200,
+    0xD08C,
+    0x4200,
+    0xD094,
+    0x4200,
+    0xD0A0,
+    0x4200,
+    0xFFFF,
+    0xFFFD,
+    0x043C,
+    0x0000,
+    0x0FFF,
+    0xFFFF,
+    0x04F4,
+    0x0000,
+    0xD0D4,
+    0x4200,
+    0xFFFF,
+    0xFFFE,
+    0xBFFF,
+    0xFFFF,
+    0x2360,
+    0x4ACB,
+    0x2520,
+    0x6FD1,
+    0x2080,
+    0x430B,
+    0x2115,
+    0x67D3,
+    0x4AC8,
+    0x4BC9,
+    0x7011,
+    0x68DA,
+    0x3914,
+    0x430A,
+    0x60DA,
+    0x22C8,
+    0x0052,
+    0x509D,
+    0x4AC5,
+    0x589C,
+    0x4320,
+    0x5098,
+    0x5898,
+    0x2426,
+    0x4328,
+    0x5098,
+    0x208D,
+    0x00C0,
+    0x501C,
+    0x3808,
+    0x581E,
+    0x3C17,
+    0x43A6,
+    0x3C06,
+    0x4334,
+    0x501C,
+    0x2440,
+    0x589E,
+    0x4326,
+    0x509E,
+    0x268A,
+    0x00F6,
+    0x599A,
+    0x43AA,
+    0x4DB9,
+    0x519A,
+    0x6FEA,
+    0x4EB9,
+    0x4032,
+    0x67EA,
+    0x4AB8,
+    0x589D,
+    0x432C,
+    0x509C,
+    0x2230,
+    0x581C,
+    0x4322,
+    0x501A,
+    0x48B5,
+    0x4CB6,
+    0x6802,
+    0x4022,
+    0x6002,
+    0x22FF,
+    0x48B4,
+    0x6002,
+    0x48B4,
+    0x6002,
+    0x48B4,
+    0x6002,
+    0x3295,
+    0x5898,
+    0x4301,
+    0x5099,
+    0x2102,
+    0x5898,
+    0x4301,
+    0xE775,
+    0x2160,
+    0x4AA4,
+    0x48AF,
+    0x6FD3,
+    0x2409,
+    0x438B,
+    0x67D3,
+    0x4AAE,
+    0x4BA2,
+    0x6851,
+    0x4001,
+    0x6051,
+    0x6851,
+    0x48AC,
+    0x4001,
+    0x2001,
+    0x6051,
+    0x68D9,
+    0x4301,
+    0x60D9,
+    0x499B,
+    0x700C,
+    0x24E6,
+    0x2180,
+    0x00A4,
+    0x591D,
+    0x0609,
+    0x4329,
+    0x258A,
+    0x5119,
+    0x2420,
+    0x00ED,
+    0x5959,
+    0x4321,
+    0x5159,
+    0x21CA,
+    0x0049,
+    0x585D,
+    0x4328,
+    0x5058,
+    0x2002,
+    0x585D,
+    0x4328,
+    0x5058,
+    0x4991,
+    0x5858,
+    0x43A0,
+    0x5058,
+    0x5858,
+    0x1924,
+    0x43A0,
+    0x5058,
+    0x4890,
+    0x5819,
+    0x43A1,
+    0x5019,
+    0x2180,
+    0x6850,
+    0x05C9,
+    0x4301,
+    0x6051,
+    0x218C,
+    0x2030,
+    0x00C9,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x498A,
+    0x488A,
+    0x680A,
+    0x4002,
+    0x600A,
+    0x22FF,
+    0x4989,
+    0x600A,
+    0x4989,
+    0x600A,
+    0x4989,
+    0x600A,
+    0x4981,
+    0x3201,
+    0x6FC8,
+    0x4302,
+    0x67CA,
+    0x22E3,
+    0x0092,
+    0x5899,
+    0x4888,
+    0x4C88,
+    0x4001,
+    0x4888,
+    0x5099,
+    0x5819,
+    0x4021,
+    0x5019,
+    0x21F0,
+    0x4886,
+    0x581C,
+    0x4321,
+    0x240E,
+    0x5019,
+    0x4885,
+    0x6801,
+    0x43A1,
+    0x6001,
+    0x2128,
+    0x5499,
+    0xE6C0,
+    0x2360,
+    0x4A6E,
+    0x2415,
+    0x6FD1,
+    0x4D74,
+    0x430B,
+    0x2180,
+    0x67D3,
+    0x4A77,
+    0x0589,
+    0x6850,
+    0x4B6B,
+    0x4301,
+    0x6051,
+    0x2180,
+    0x6850,
+    0x02C9,
+    0x4301,
+    0x6051,
+    0x2101,
+    0x68D8,
+    0x4308,
+    0x60D8,
+    0x4864,
+    0x7004,
+    0x6850,
+    0x4C75,
+    0x4020,
+    0x6050,
+    0x20E6,
+    0x2280,
+    0x0080,
+    0x581C,
+    0x0612,
+    0x4322,
+    0x248A,
+    0x501A,
+    0x2020,
+    0x00E4,
+    0x591A,
+    0x4302,
+    0x511A,
+    0x22CA,
+    0x0052,
+    0x589C,
+    0x4321,
+    0x5099,
+    0x2102,
+    0x589C,
+    0x4321,
+    0x5099,
+    0x4A58,
+    0x2440,
+    0x5899,
+    0x4381,
+    0x5099,
+    0x218D,
+    0x2000,
+    0x00C9,
+    0x5058,
+    0x5899,
+    0x4856,
+    0x43A1,
+    0x5099,
+    0x5819,
+    0x43A1,
+    0x5019,
+    0x218C,
+    0x00C9,
+    0x5858,
+    0x3C10,
+    0x43A0,
+    0x4C51,
+    0x5058,
+    0x6820,
+    0x4028,
+    0x6020,
+    0x20FF,
+    0x4C50,
+    0x6020,
+    0x4C50,
+    0x6020,
+    0x4C50,
+    0x6020,
+    0x2480,
+    0x5898,
+    0x43A0,
+    0x5098,
+    0x200F,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x2280,
+    0x4944,
+    0x0052,
+    0x6FC8,
+    0x4C4E,
+    0x4302,
+    0x67CA,
+    0x22E3,
+    0x0092,
+    0x5899,
+    0x484A,
+    0x4001,
+    0x484B,
+    0x5099,
+    0x5819,
+    0x4021,
+    0x5019,
+    0x21F0,
+    0x4849,
+    0x581C,
+    0x4321,
+    0x240E,
+    0x5019,
+    0x4848,
+    0x6801,
+    0x43A1,
+    0x6001,
+    0x2114,
+    0xE784,
+    0x2160,
+    0x4A31,
+    0x4C46,
+    0x6FD3,
+    0x250F,
+    0x438B,
+    0x3940,
+    0x430B,
+    0x67D3,
+    0x2202,
+    0x6820,
+    0x2603,
+    0x4310,
+    0x6020,
+    0x249F,
+    0x4B2C,
+    0x00E4,
+    0x68D8,
+    0x4390,
+    0x60D8,
+    0x5918,
+    0x43A8,
+    0x3D0E,
+    0x4328,
+    0x5118,
+    0x3C10,
+    0x5918,
+    0x43B0,
+    0x26E5,
+    0x5118,
+    0x2080,
+    0x00B6,
+    0x599F,
+    0x0240,
+    0x4338,
+    0x5198,
+    0x209A,
+    0x00C0,
+    0x581E,
+    0x4335,
+    0x501D,
+    0x2040,
+    0x591D,
+    0x26A1,
+    0x4305,
+    0x511D,
+    0x253F,
+    0x4C30,
+    0x00F6,
+    0x8025,
+    0x241F,
+    0x599D,
+    0x43A5,
+    0x3C0F,
+    0x432C,
+    0x519C,
+    0x4C2D,
+    0x6825,
+    0x438D,
+    0x6025,
+    0x6825,
+    0x4385,
+    0x6025,
+    0x248A,
+    0x00E4,
+    0x591D,
+    0x4329,
+    0x5119,
+    0x21CA,
+    0x0049,
+    0x585C,
+    0x4322,
+    0x505A,
+    0x4910,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x4911,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x3104,
+    0x585A,
+    0x3810,
+    0x4382,
+    0x505A,
+    0x490E,
+    0x480E,
+    0x680A,
+    0x4002,
+    0x600A,
+    0x2280,
+    0x4908,
+    0x0052,
+    0x6FC8,
+    0x4302,
+    0x67CA,
+    0x21E3,
+    0x0089,
+    0xE634,
+    0x46C0,
+    0x8004,
+    0x4200,
+    0xD029,
+    0x4200,
+    0xD000,
+    0x4200,
+    0x0454,
+    0x0000,
+    0xD004,
+    0x4200,
+    0x87FF,
+    0xFFFF,
+    0x045C,
+    0x0000,
+    0xD0A0,
+    0x4200,
+    0xFFFF,
+    0xFFFD,
+    0xD088,
+    0x4200,
+    0xD08C,
+    0x4200,
+    0xD094,
+    0x4200,
+    0xFFFF,
+    0xDFFF,
+    0xD0FC,
+    0x4200,
+    0xFFFF,
+    0xFFFB,
+    0xBFFF,
+    0xFFFF,
+    0x0FFF,
+    0xFFFF,
+    0x043C,
+    0x0000,
+    0x04F4,
+    0x0000,
+    0xD0D4,
+    0x4200,
+    0xFFFF,
+    0xBFFF,
+    0xD0B4,
+    0x4200,
+    0xD0CC,
+    0x4200,
+    0xD0B0,
+    0x4200,
+    0x2160,
+    0x4A7D,
+    0x4C7D,
+    0x6FD3,
+    0x259F,
+    0x438B,
+    0x21E6,
+    0x67D3,
+    0x2280,
+    0x4B7B,
+    0x0089,
+    0x5858,
+    0x0612,
+    0x4302,
+    0x505A,
+    0x2101,
+    0x68DA,
+    0x260F,
+    0x430A,
+    0x60DA,
+    0x4A76,
+    0x00ED,
+    0x6850,
+    0x4020,
+    0x2409,
+    0x6050,
+    0x4874,
+    0x7004,
+    0x6850,
+    0x4C74,
+    0x4020,
+    0x2402,
+    0x6050,
+    0x68D8,
+    0x43A0,
+    0x60D8,
+    0x5958,
+    0x43B0,
+    0x4308,
+    0x5158,
+    0x3D10,
+    0x5958,
+    0x3E0C,
+    0x43B0,
+    0x26E5,
+    0x5158,
+    0x2080,
+    0x00B6,
+    0x599F,
+    0x0240,
+    0x4338,
+    0x5198,
+    0x363D,
+    0x36FF,
+    0x5998,
+    0x27A1,
+    0x4308,
+    0x5198,
+    0x2040,
+    0x595E,
+    0x00FF,
+    0x4306,
+    0x515E,
+    0x263F,
+    0x4D63,
+    0x802E,
+    0x251F,
+    0x59DE,
+    0x43AE,
+    0x3D15,
+    0x4335,
+    0x2620,
+    0x51DD,
+    0x4D60,
+    0x682F,
+    0x43B7,
+    0x602F,
+    0x682F,
+    0x4387,
+    0x602F,
+    0x278A,
+    0x00FF,
+    0x59DD,
+    0x4335,
+    0x51DD,
+    0x25CA,
+    0x006D,
+    0x595F,
+    0x4339,
+    0x5159,
+    0x5959,
+    0x430C,
+    0x4957,
+    0x515C,
+    0x585C,
+    0x43B4,
+    0x505C,
+    0x585C,
+    0x4384,
+    0x505C,
+    0x4C54,
+    0x5919,
+    0x4381,
+    0x5119,
+    0x2180,
+    0x6850,
+    0x05C9,
+    0x4301,
+    0x6051,
+    0x218C,
+    0x2030,
+    0x00C9,
+    0x585A,
+    0x4382,
+    0x505A,
+    0x494E,
+    0x484E,
+    0x680A,
+    0x4002,
+    0x600A,
+    0x2280,
+    0x494D,
+    0x0052,
+    0x6FC8,
+    0xE65A,
+    0x2360,
+    0x4A3E,
+    0x259F,
+    0x6FD1,
+    0x2603,
+    0x430B,
+    0x21E6,
+    0x67D3,
+    0x2280,
+    0x4B3C,
+    0x0089,
+    0x5858,
+    0x0612,
+    0x4302,
+    0x505A,
+    0x2201,
+    0x2080,
+    0x68D9,
+    0x0580,
+    0x4311,
+    0x60D9,
+    0x4937,
+    0x00ED,
+    0x684C,
+    0x4320,
+    0x2415,
+    0x6048,
+    0x4835,
+    0x7004,
+    0x2080,
+    0x684C,
+    0x02C0,
+    0x4320,
+    0x2402,
+    0x6048,
+    0x200F,
+    0x68D9,
+    0x43A1,
+    0x60D9,
+    0x5959,
+    0x4381,
+    0x4311,
+    0x5159,
+    0x3D10,
+    0x5959,
+    0x43B1,
+    0x26E5,
+    0x5159,
+    0x2180,
+    0x00B6,
+    0x599F,
+    0x0249,
+    0x4339,
+    0x5199,
+    0x363D,
+    0x36FF,
+    0x5999,
+    0x27A1,
+    0x4311,
+    0x5199,
+    0x2140,
+    0x595E,
+    0x00FF,
+    0x430E,
+    0x515E,
+    0x263F,
+    0x4D24,
+    0x802E,
+    0x251F,
+    0x59DE,
+    0x43AE,
+    0x3D15,
+    0x4335,
+    0x2620,
+    0x51DD,
+    0x4D20,
+    0x682F,
+    0x43B7,
+    0x602F,
+    0x682F,
+    0x438F,
+    0x602F,
+    0x278A,
+    0x00FF,
+    0x59DD,
+    0x4335,
+    0x51DD,
+    0x25CA,
+    0x006D,
+    0x595F,
+    0x433A,
+    0x515A,
+    0x595A,
+    0x4314,
+    0x4A18,
+    0x515C,
+    0x589C,
+    0x2500,
+    0x43B4,
+    0x509C,
+    0x248D,
+    0x00E4,
+    0x511D,
+    0x589C,
+    0x4D14,
+    0x438C,
+    0x509C,
+    0x595C,
+    0x4E14,
+    0x438C,
+    0x218C,
+    0x515C,
+    0x2530,
+    0x00C9,
+    0x585C,
+    0x43AC,
+    0x4D0F,
+    0x505C,
+    0x682C,
+    0x4034,
+    0x602C,
+    0x2580,
+    0x589C,
+    0x43AC,
+    0x509C,
+    0x585A,
+    0xE64F,
+    0x8004,
+    0x4200,
+    0xFFFF,
+    0xDFFF,
+    0xD000,
+    0x4200,
+    0xD0FC,
+    0x4200,
+    0xD029,
+    0x4200,
+    0xFFFF,
+    0xFFFB,
+    0xD0CC,
+    0x4200,
+    0xD0B0,
+    0x4200,
+    0x0454,
+    0x0000,
+    0x045C,
+    0x0000,
+    0xD0A0,
+    0x4200,
+    0xFFFF,
+    0xFFFD,
+    0xD004,
+    0x4200,
+    0xB5F7,
+    0x4BD5,
+    0x9001,
+    0x2827,
+    0xD800,
+    0xE0AE,
+    0x9A01,
+    0x2A35,
+    0xD800,
+    0xE096,
+    0x2A37,
+    0xD100,
+    0xE239,
+    0x2A3B,
+    0xD100,
+    0xE0D6,
+    0x2A36,
+    0xD000,
+    0xE09D,
+    0x2101,
+    0x2402,
+    0x260F,
+    0x689A,
+    0x27F0,
+    0x438A,
+    0x609A,
+    0x689A,
+    0x3109,
+    0x43A2,
+    0x609A,
+    0x4AC7,
+    0x4DC8,
+    0x69D0,
+    0x43B0,
+    0x4301,
+    0x61D1,
+    0x21A0,
+    0x69D0,
+    0x43B8,
+    0x4301,
+    0x61D1,
+    0x69D0,
+    0x49C3,
+    0x3F30,
+    0x4008,
+    0x21A0,
+    0x0209,
+    0x4301,
+    0x61D1,
+    0x21A0,
+    0x69D0,
+    0x0309,
+    0x4028,
+    0x4301,
+    0x61D1,
+    0x69D0,
+    0x49BD,
+    0x250C,
+    0x4008,
+    0x21A0,
+    0x0409,
+    0x4301,
+    0x2040,
+    0x61D1,
+    0x6899,
+    0x4684,
+    0x4381,
+    0x6099,
+    0x49B8,
+    0x5858,
+    0x4328,
+    0x5058,
+    0x5858,
+    0x4338,
+    0x5058,
+    0x48B6,
+    0x3FBD,
+    0x6846,
+    0x43BE,
+    0x4334,
+    0x6044,
+    0x2408,
+    0x6846,
+    0x4FB3,
+    0x43AE,
+    0x4326,
+    0x6046,
+    0x6846,
+    0x403E,
+    0x6046,
+    0x200F,
+    0x27F0,
+    0x69D6,
+    0x4386,
+    0x380B,
+    0x4306,
+    0x61D6,
+    0x69D6,
+    0x43BE,
+    0x4667,
+    0x433E,
+    0x61D6,
+    0x69D7,
+    0x4EA5,
+    0x4037,
+    0x2680,
+    0x01F6,
+    0x433E,
+    0x61D6,
+    0x69D7,
+    0x4EA0,
+    0x4037,
+    0x2680,
+    0x02F6,
+    0x433E,
+    0x61D6,
+    0x69D7,
+    0x4E9F,
+    0x4037,
+    0x2680,
+    0x03F6,
+    0x433E,
+    0x61D6,
+    0x26E6,
+    0x2280,
+    0x00B6,
+    0x599F,
+    0x0312,
+    0x433A,
+    0x27C0,
+    0x519A,
+    0x4666,
+    0x585A,
+    0x43AA,
+    0x4302,
+    0x505A,
+    0x585A,
+    0x3D0B,
+    0x43BA,
+    0x4332,
+    0x505A,
+    0x22E8,
+    0x0092,
+    0x5899,
+    0x4329,
+    0x5099,
+    0x5899,
+    0x3505,
+    0x43A9,
+    0x4308,
+    0x5098,
+    0x2018,
+    0x5899,
+    0x4381,
+    0x430C,
+    0x509C,
+    0x5899,
+    0x3008,
+    0x4381,
+    0x5099,
+    0xE085,
+    0x2201,
+    0x9901,
+    0x3928,
+    0xB2C9,
+    0x408A,
+    0x498A,
+    0x420A,
+    0xD000,
+    0xE086,
+    0x4989,
+    0x420A,
+    0xD139,
+    0x4989,
+    0x420A,
+    0xD000,
+    0xE761,
+    0x2208,
+    0x6899,
+    0x430A,
+    0xE079,
+    0x9A01,
+    0x1E50,
+    0x2826,
+    0xD82D,
+    0x2601,
+    0x4A79,
+    0x4D7B,
+    0x497C,
+    0x4C7D,
+    0xF7F4,
+    0xFAE4,
+    0x0071,
+    0xFF53,
+    0x0187,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x0187,
+    0x008B,
+    0x00CD,
+    0x0104,
+    0x01C6,
+    0x008B,
+    0x00CD,
+    0x0104,
+    0x01C6,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x0187,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x0187,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x014D,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x014D,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x014D,
+    0x0027,
+    0x0071,
+    0xFF53,
+    0x014D,
+    0x2101,
+    0x689A,
+    0x438A,
+    0x609A,
+    0x689A,
+    0x1849,
+    0x438A,
+    0x609A,
+    0x4A5F,
+    0x310D,
+    0x69D0,
+    0x4388,
+    0x390A,
+    0x4301,
+    0x61D1,
+    0x21F0,
+    0x69D0,
+    0x4388,
+    0x39A0,
+    0x4301,
+    0x61D1,
+    0x69D0,
+    0x495A,
+    0x4008,
+    0x21A0,
+    0x01C9,
+    0x4301,
+    0x61D1,
+    0x69D0,
+    0x4955,
+    0x4008,
+    0x21A0,
+    0x02C9,
+    0x4301,
+    0x61D1,
+    0x69D0,
+    0x4954,
+    0x4008,
+    0x21C0,
+    0x03C9,
+    0x4301,
+    0x61D1,
+    0x2140,
+    0x200C,
+    0x689A,
+    0x438A,
+    0x609A,
+    0x4A4F,
+    0x589C,
+    0x4384,
+    0x3808,
+    0x4320,
+    0x24C0,
+    0x5098,
+    0x5898,
+    0x43A0,
+    0x4301,
+    0x5099,
+    0x2280,
+    0x494A,
+    0x0092,
+    0x6848,
+    0x4302,
+    0x604A,
+    0x2204,
+    0x9901,
+    0x4391,
+    0x2923,
+    0xD184,
+    0x2108,
+    0x689A,
+    0x438A,
+    0x609A,
+    0xBDF7,
+    0x2201,
+    0x6899,
+    0x430A,
+    0x609A,
+    0x2202,
+    0x6899,
+    0x430A,
+    0x210F,
+    0x609A,
+    0x4A39,
+    0x69D0,
+    0x4388,
+    0x3909,
+    0x4301,
+    0x61D1,
+    0x21F0,
+    0x69D0,
+    0x4388,
+    0x3990,
+    0x4301,
+    0x61D1,
+    0x69D0,
+    0x4935,
+    0x4008,
+    0x21C0,
+    0xE7B4,
+    0x6898,
+    0x43B0,
+    0x2602,
+    0x6098,
+    0x6898,
+    0x43B0,
+    0x6098,
+    0x200F,
+    0x69D6,
+    0x4386,
+    0x380A,
+    0x4330,
+    0x61D0,
+    0x20F0,
+    0x69D6,
+    0x4386,
+    0x38A0,
+    0x4330,
+    0x61D0,
+    0x69D6,
+    0x4831,
+    0x4006,
+    0x20A0,
+    0x00C0,
+    0x4330,
+    0x61D0,
+    0x69D0,
+    0x4005,
+    0x2080,
+    0x0200,
+    0x4328,
+    0x61D0,
+    0x69D5,
+    0x4821,
+    0x4005,
+    0x20A0,
+    0x02C0,
+    0x4328,
+    0x61D0,
+    0x69D5,
+    0x4820,
+    0x4005,
+    0x20C0,
+    0x03C0,
+    0x4328,
+    0x61D0,
+    0x2240,
+    0x6898,
+    0x4390,
+    0x6098,
+    0x200C,
+    0x585D,
+    0x4385,
+    0x3808,
+    0x4328,
+    0x25C0,
+    0x5058,
+    0x5858,
+    0x43A8,
+    0x4302,
+    0x505A,
+    0x2280,
+    0x6861,
+    0x0092,
+    0x430A,
+    0xE07D,
+    0x6898,
+    0x4330,
+    0x6098,
+    0x2002,
+    0x689E,
+    0x4330,
+    0x6098,
+    0x200F,
+    0x69D6,
+    0x4386,
+    0x3809,
+    0x4330,
+    0x61D0,
+    0x20F0,
+    0x69D6,
+    0x4386,
+    0x3890,
+    0x4330,
+    0x61D0,
+    0x69D6,
+    0x4810,
+    0x4006,
+    0x20C0,
+    0x00C0,
+    0x4330,
+    0x61D0,
+    0x69D0,
+    0x4005,
+    0x2090,
+    0xE7BC,
+    0x46C0,
+    0xD000,
+    0x4200,
+    0x8000,
+    0x4200,
+    0xFFFF,
+    0xFFF0,
+    0x0FFF,
+    0xFFFF,
+    0xFFFF,
+    0xFF0F,
+    0x0444,
+    0x0000,
+    0x9000,
+    0x4200,
+    0xFDFF,
+    0xFFFF,
+    0x2492,
+    0x0000,
+    0x1249,
+    0x0000,
+    0x0924,
+    0x0000,
+    0xF0FF,
+    0xFFFF,
+    0x6898,
+    0x43B0,
+    0x6098,
+    0x2002,
+    0x689E,
+    0x4386,
+    0x609E,
+    0x260F,
+    0x69D7,
+    0x43B7,
+    0x3E05,
+    0x433E,
+    0x61D6,
+    0x26F0,
+    0x69D7,
+    0x43B7,
+    0x3E50,
+    0x433E,
+    0x61D6,
+    0x69D6,
+    0x4F75,
+    0x4037,
+    0x26A0,
+    0x0136,
+    0x433E,
+    0x61D6,
+    0x69D6,
+    0x402E,
+    0x25B0,
+    0x022D,
+    0x4335,
+    0x61D5,
+    0x69D6,
+    0x4D70,
+    0x402E,
+    0x25A0,
+    0x032D,
+    0x4335,
+    0x61D5,
+    0x69D6,
+    0x4D6D,
+    0x402E,
+    0x25A0,
+    0x042D,
+    0x4335,
+    0x61D5,
+    0x2540,
+    0x689A,
+    0x43AA,
+    0x609A,
+    0x585A,
+    0x3D34,
+    0x432A,
+    0x505A,
+    0x22C0,
+    0x585E,
+    0x4332,
+    0x505A,
+    0x2103,
+    0x6862,
+    0x438A,
+    0x4310,
+    0x2208,
+    0x6060,
+    0x6861,
+    0x43A9,
+    0x430A,
+    0x6062,
+    0x6862,
+    0x4960,
+    0x400A,
+    0x6062,
+    0xE6A3,
+    0x6898,
+    0x2704,
+    0x43B0,
+    0x2602,
+    0x6098,
+    0x6898,
+    0x43B0,
+    0x6098,
+    0x69D0,
+    0x360D,
+    0x43B0,
+    0x4338,
+    0x61D0,
+    0x20F0,
+    0x69D6,
+    0x4386,
+    0x38B0,
+    0x4306,
+    0x61D6,
+    0x69D6,
+    0x402E,
+    0x2580,
+    0x01ED,
+    0x4335,
+    0x61D5,
+    0x69D6,
+    0x4D4F,
+    0x402E,
+    0x2580,
+    0x02ED,
+    0x4335,
+    0x61D5,
+    0x69D6,
+    0x4D4C,
+    0x402E,
+    0x2580,
+    0x03ED,
+    0x4335,
+    0x61D5,
+    0x250C,
+    0x689A,
+    0x4302,
+    0x609A,
+    0x585A,
+    0x43AA,
+    0x4317,
+    0x505F,
+    0x585A,
+    0x35B4,
+    0x43AA,
+    0x4310,
+    0x2280,
+    0x5058,
+    0x6861,
+    0x0092,
+    0x430A,
+    0x6062,
+    0xE6DF,
+    0x2101,
+    0x200F,
+    0x2404,
+    0x689A,
+    0x438A,
+    0x609A,
+    0x689A,
+    0x1849,
+    0x438A,
+    0x609A,
+    0x4A3D,
+    0x69D1,
+    0x4381,
+    0x4321,
+    0x61D1,
+    0x21F0,
+    0x69D0,
+    0x4388,
+    0x39B0,
+    0x4308,
+    0x61D0,
+    0x69D5,
+    0x4838,
+    0x4005,
+    0x2080,
+    0x01C0,
+    0x4328,
+    0x61D0,
+    0x69D5,
+    0x4830,
+    0x4005,
+    0x2080,
+    0x02C0,
+    0x4328,
+    0x61D0,
+    0x69D5,
+    0x482E,
+    0x4005,
+    0x2080,
+    0x03C0,
+    0x4328,
+    0x250C,
+    0x61D0,
+    0x689A,
+    0x430A,
+    0x609A,
+    0x4A2D,
+    0x5898,
+    0x43A8,
+    0x4304,
+    0x509C,
+    0x24C0,
+    0x5898,
+    0x43A0,
+    0x4301,
+    0x5099,
+    0x2280,
+    0x4928,
+    0x0092,
+    0x6848,
+    0x4302,
+    0x604A,
+    0xE62A,
+    0x6898,
+    0x43B0,
+    0x2602,
+    0x6098,
+    0x6898,
+    0x43B0,
+    0x6098,
+    0x69D0,
+    0x360D,
+    0x43B0,
+    0x3E0B,
+    0x4330,
+    0x61D0,
+    0x20F0,
+    0x69D7,
+    0x4387,
+    0x38B0,
+    0x4307,
+    0x61D7,
+    0x69D6,
+    0x4F14,
+    0x403E,
+    0x2780,
+    0x00FF,
+    0x4337,
+    0x61D7,
+    0x69D7,
+    0x2604,
+    0x402F,
+    0x25E0,
+    0x01ED,
+    0x433D,
+    0x61D5,
+    0x69D7,
+    0x4D0E,
+    0x402F,
+    0x2580,
+    0x02ED,
+    0x433D,
+    0x61D5,
+    0x69D7,
+    0x4D0C,
+    0x402F,
+    0x2580,
+    0x03ED,
+    0x433D,
+    0x61D5,
+    0x250C,
+    0x689A,
+    0x4302,
+    0x609A,
+    0x585A,
+    0x43AA,
+    0x4316,
+    0x505E,
+    0x585A,
+    0x35B4,
+    0x43AA,
+    0x4310,
+    0x5058,
+    0xE6C4,
+    0x46C0,
+    0xF0FF,
+    0xFFFF,
+    0xFFFF,
+    0xFFF0,
+    0xFFFF,
+    0xFF0F,
+    0xFDFF,
+    0xFFFF,
+    0x8000,
+    0x4200,
+    0x0FFF,
+    0xFFFF,
+    0x0444,
+    0x0000,
+    0x9000,
+    0x4200,
+    0x230F,
+    0x880A,
+    0xB5F0,
+    0x469C,
+    0x401A,
+    0x4F69,
+    0x4B69,
+    0x4E6A,
+    0x4D6A,
+    0x2801,
+    0xD000,
+    0xE065,
+    0x4664,
+    0x6A98,
+    0x43A0,
+    0x4310,
+    0x22F0,
+    0x6298,
+    0x6A98,
+    0x34F0,
+    0x4390,
+    0x884A,
+    0x0112,
+    0x4022,
+    0x4302,
+    0x629A,
+    0x6A98,
+    0x888A,
+    0x4038,
+    0x27F0,
+    0x0212,
+    0x013F,
+    0x403A,
+    0x4302,
+    0x629A,
+    0x6A98,
+    0x88CA,
+    0x4030,
+    0x26F0,
+    0x0712,
+    0x0C12,
+    0x4302,
+    0x629A,
+    0x6A98,
+    0x4A59,
+    0x0336,
+    0x4010,
+    0x890A,
+    0x24FE,
+    0x0412,
+    0x4032,
+    0x26FC,
+    0x4302,
+    0x629A,
+    0x6A98,
+    0x4A55,
+    0x04B6,
+    0x4010,
+    0x894A,
+    0x04A4,
+    0x0512,
+    0x4032,
+    0x263F,
+    0x4302,
+    0x629A,
+    0x6A98,
+    0x898A,
+    0x0180,
+    0x0980,
+    0x0692,
+    0x4302,
+    0x629A,
+    0x6AD8,
+    0x89CA,
+    0x43B0,
+    0x4032,
+    0x26FC,
+    0x4302,
+    0x62DA,
+    0x6AD8,
+    0x4A49,
+    0x0136,
+    0x4010,
+    0x8A0A,
+    0x0192,
+    0x4032,
+    0x4302,
+    0x62DA,
+    0x6AD8,
+    0x8A4A,
+    0x4028,
+    0x25FE,
+    0x0312,
+    0x02ED,
+    0x402A,
+    0x4302,
+    0x62DA,
+    0x6AD8,
+    0x4A41,
+    0x4010,
+    0x8A8A,
+    0x04D2,
+    0x4022,
+    0x4302,
+    0x62DA,
+    0x7D88,
+    0x4A3E,
+    0x7010,
+    0x7E08,
+    0x4A3E,
+    0x7010,
+    0x8B4A,
+    0x865A,
+    0xBDF0,
+    0x4664,
+    0x6B58,
+    0x43A0,
+    0x4310,
+    0x22F0,
+    0x24FF,
+    0x6358,
+    0x6B58,
+    0x4390,
+    0x884A,
+    0x0112,
+    0x4022,
+    0x4302,
+    0x635A,
+    0x6B58,
+    0x888A,
+    0x4038,
+    0x27F0,
+    0x0212,
+    0x013F,
+    0x403A,
+    0x4302,
+    0x635A,
+    0x6B58,
+    0x88CA,
+    0x4030,
+    0x26F0,
+    0x0712,
+    0x0C12,
+    0x4302,
+    0x635A,
+    0x6B58,
+    0x4A26,
+    0x0336,
+    0x4010,
+    0x890A,
+    0x24FE,
+    0x0412,
+    0x4032,
+    0x26FC,
+    0x4302,
+    0x635A,
+    0x6B58,
+    0x4A22,
+    0x04B6,
+    0x4010,
+    0x894A,
+    0x04A4,
+    0x0512,
+    0x4032,
+    0x263F,
+    0x4302,
+    0x635A,
+    0x6B58,
+    0x898A,
+    0x0180,
+    0x0980,
+    0x0692,
+    0x4302,
+    0x635A,
+    0x6B98,
+    0x89CA,
+    0x43B0,
+    0x4032,
+    0x26FC,
+    0x4302,
+    0x639A,
+    0x6B98,
+    0x4A16,
+    0x0136,
+    0x4010,
+    0x8A0A,
+    0x0192,
+    0x4032,
+    0x4302,
+    0x639A,
+    0x6B98,
+    0x8A4A,
+    0x4028,
+    0x25FE,
+    0x0312,
+    0x02ED,
+    0x402A,
+    0x4302,
+    0x639A,
+    0x6B98,
+    0x4A0E,
+    0x4010,
+    0x8A8A,
+    0x04D2,
+    0x4022,
+    0x4302,
+    0x639A,
+    0x7D88,
+    0x4A0D,
+    0x7010,
+    0x7E08,
+    0x4A0D,
+    0x7010,
+    0x8B4A,
+    0x87DA,
+    0xE798,
+    0xF0FF,
+    0xFFFF,
+    0xC000,
+    0x4200,
+    0x0FFF,
+    0xFFFF,
+    0x0FFF,
+    0xFFF8,
+    0xFFFF,
+    0xFFF0,
+    0xFFFF,
+    0xFC0F,
+    0xF03F,
+    0xFFFF,
+    0xFFFF,
+    0xFC07,
+    0xC030,
+    0x4200,
+    0xC031,
+    0x4200,
+    0xC03C,
+    0x4200,
+    0xC03D,
+    0x4200,
+    0xB510,
+    0x0004,
+    0xF7FE,
+    0xFEB0,
+    0x2800,
+    0xD016,
+    0x2C00,
+    0xD104,
+    0x490E,
+    0x2000,
+    0xF7FF,
+    0xFF04,
+    0xBD10,
+    0x490D,
+    0x2C0D,
+    0xD9F8,
+    0x490C,
+    0x2C0E,
+    0xD0F5,
+    0x2C0F,
+    0xD101,
+    0x490B,
+    0xE7F1,
+    0x490A,
+    0x2C36,
+    0xD800,
+    0x4907,
+    0x2001,
+    0xE7EC,
+    0x2C0D,
+    0xD801,
+    0x4907,
+    0xE7E8,
+    0x2C0E,
+    0xD0E4,
+    0x2C0F,
+    0xD1F4,
+    0xE7EE,
+    0x1D7C,
+    0x1003,
+    0x1D98,
+    0x1003,
+    0x1D60,
+    0x1003,
+    0x1D44,
+    0x1003,
+    0x1DB4,
+    0x1003,
+    0xB510,
+    0x2803,
+    0xD909,
+    0x3805,
+    0x2802,
+    0xD90F,
+    0x2000,
+    0x22F4,
+    0x490C,
+    0xF7FE,
+    0xFA3B,
+    0x2000,
+    0xE007,
+    0x2001,
+    0x088B,
+    0x4098,
+    0x2303,
+    0x3801,
+    0x0080,
+    0x400B,
+    0x18C0,
+    0xBD10,
+    0x2301,
+    0x088A,
+    0x4093,
+    0x0FD8,
+    0x18C0,
+    0x2303,
+    0x1040,
+    0x0080,
+    0x4019,
+    0x1840,
+    0xE7F3,
+    0x46C0,
+    0x1D39,
+    0x1003,
+    0xB510,
+    0x0004,
+    0x2803,
+    0xD913,
+    0x1F43,
+    0x2B02,
+    0xD92F,
+    0x228D,
+    0x2000,
+    0x492D,
+    0x0052,
+    0x3C01,
+    0xF7FE,
+    0xFA14,
+    0x2310,
+    0x2C06,
+    0xD932,
+    0x229F,
+    0x2000,
+    0x4928,
+    0x0052,
+    0xF7FE,
+    0xFA0B,
+    0xE044,
+    0x2200,
+    0x4B26,
+    0x609A,
+    0x60DA,
+    0x233F,
+    0x4A25,
+    0x6850,
+    0x4398,
+    0x400B,
+    0x4303,
+    0x6053,
+    0x6853,
+    0x4822,
+    0x0209,
+    0x4003,
+    0x20FC,
+    0x0180,
+    0x4001,
+    0x4319,
+    0x6051,
+    0x2C00,
+    0xD110,
+    0x2180,
+    0x6853,
+    0x438B,
+    0x6053,
+    0x6853,
+    0x491C,
+    0x400B,
+    0x6053,
+    0xE025,
+    0xF7FF,
+    0xFFA3,
+    0x2201,
+    0x4B15,
+    0x6298,
+    0x62D8,
+    0x609A,
+    0x60DA,
+    0x2301,
+    0x2244,
+    0x40A3,
+    0x4213,
+    0xD119,
+    0x2222,
+    0x4213,
+    0xD10C,
+    0x3266,
+    0x4213,
+    0xD0C6,
+    0x4B0E,
+    0x3A08,
+    0x6859,
+    0x430A,
+    0x605A,
+    0x2280,
+    0x6859,
+    0x0212,
+    0x430A,
+    0xE007,
+    0x2280,
+    0x4B09,
+    0x6859,
+    0x430A,
+    0x605A,
+    0x685A,
+    0x4908,
+    0x400A,
+    0x605A,
+    0xBD10,
+    0x2180,
+    0x4B04,
+    0x685A,
+    0x438A,
+    0xE7EA,
+    0x46C0,
+    0x1D39,
+    0x1003,
+    0x9000,
+    0x4200,
+    0x5000,
+    0x4200,
+    0xC0FF,
+    0xFFFF,
+    0x7FFF,
+    0xFFFF,
+    0x3801,
+    0xB2C3,
+    0x2000,
+    0x2B05,
+    0xD801,
+    0x4A01,
+    0x5CD0,
+    0x4770,
+    0x1D3E,
+    0x1003,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xFFF2,
+    0x4B03,
+    0x1C5A,
+    0x62D8,
+    0x77D4,
+    0x2201,
+    0x61DA,
+    0xBD10,
+    0x46C0,
+    0x4000,
+    0x4200,
+    0x4B12,
+    0xB570,
+    0x881A,
+    0x0004,
+    0x000D,
+    0xB293,
+    0x2A00,
+    0xD00F,
+    0x2014,
+    0x4A0F,
+    0x4348,
+    0x189B,
+    0x4A0E,
+    0x1880,
+    0x2211,
+    0x2903,
+    0xD107,
+    0x490D,
+    0x1864,
+    0x7821,
+    0x4351,
+    0x1859,
+    0xF005,
+    0xFD8A,
+    0xBD70,
+    0x0011,
+    0x4361,
+    0x1859,
+    0xF005,
+    0xFD84,
+    0x4B07,
+    0x4A08,
+    0x625C,
+    0x2301,
+    0x40AB,
+    0xB2DB,
+    0x7013,
+    0xE7F1,
+    0x0288,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x808C,
+    0x4200,
+    0x013C,
+    0x4203,
+    0x8000,
+    0x4200,
+    0x8028,
+    0x4200,
+    0x4B05,
+    0x4A06,
+    0x881B,
+    0xB510,
+    0x189B,
+    0x2211,
+    0x4350,
+    0x4904,
+    0x1818,
+    0xF005,
+    0xFD65,
+    0xBD10,
+    0x0288,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x80C8,
+    0x4200,
+    0x4B0D,
+    0x4A0E,
+    0x881B,
+    0x189B,
+    0x4A0D,
+    0x7812,
+    0x0052,
+    0x18D2,
+    0x4293,
+    0xD303,
+    0x2000,
+    0x4B0B,
+    0x8018,
+    0xE009,
+    0x8819,
+    0xB288,
+    0x2900,
+    0xD006,
+    0x4A07,
+    0x8010,
+    0x2200,
+    0x801A,
+    0x4B03,
+    0x18C0,
+    0x4770,
+    0x3302,
+    0xE7EC,
+    0x46C0,
+    0x023E,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0240,
+    0x4203,
+    0x0244,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFFD9,
+    0x4B15,
+    0x2103,
+    0x781A,
+    0x2334,
+    0x400A,
+    0x4353,
+    0x4A13,
+    0x189B,
+    0x699A,
+    0x2800,
+    0xD018,
+    0x243C,
+    0x43A2,
+    0x619A,
+    0x4A10,
+    0x601A,
+    0x6842,
+    0x6842,
+    0x605A,
+    0x4A0E,
+    0x8812,
+    0xB292,
+    0x609A,
+    0x2201,
+    0x621A,
+    0x699A,
+    0x438A,
+    0x619A,
+    0x2204,
+    0x625A,
+    0x6999,
+    0x3218,
+    0x43A1,
+    0x430A,
+    0x619A,
+    0xBD10,
+    0x213C,
+    0x438A,
+    0x619A,
+    0x2201,
+    0x4B05,
+    0x60DA,
+    0xE7F7,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0x602C,
+    0x4200,
+    0x0242,
+    0x4203,
+    0x4000,
+    0x4201,
+    0xB5F7,
+    0x0002,
+    0x6900,
+    0x8A93,
+    0x89D5,
+    0x8912,
+    0x2434,
+    0x9201,
+    0x4A19,
+    0xB299,
+    0x7816,
+    0x2203,
+    0x0936,
+    0x4016,
+    0x4374,
+    0x4E17,
+    0x4A17,
+    0x19A4,
+    0x263C,
+    0x69A7,
+    0x3B01,
+    0x43B7,
+    0x61A7,
+    0x2701,
+    0x6317,
+    0x6020,
+    0x4813,
+    0x2203,
+    0x6060,
+    0x2000,
+    0x60A3,
+    0x6220,
+    0x69A3,
+    0xB2AD,
+    0x4393,
+    0x61A3,
+    0x2304,
+    0x6263,
+    0x3B02,
+    0x6125,
+    0x6160,
+    0x6263,
+    0x9B01,
+    0x18E8,
+    0xF7F3,
+    0xFFBC,
+    0x6121,
+    0xB289,
+    0x42A9,
+    0x4189,
+    0x2318,
+    0x4249,
+    0x6161,
+    0x6267,
+    0x69A2,
+    0x43B2,
+    0x4313,
+    0x61A3,
+    0xBDF7,
+    0x46C0,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0x5000,
+    0x4200,
+    0x502C,
+    0x4200,
+    0x213F,
+    0xB510,
+    0x4001,
+    0x0980,
+    0xF7FF,
+    0xFE90,
+    0xBD10,
+    0x0000,
+    0x2280,
+    0x4B1D,
+    0xB570,
+    0x6299,
+    0x6A19,
+    0x0112,
+    0x430A,
+    0x621A,
+    0x6A1A,
+    0x491A,
+    0x0004,
+    0x400A,
+    0x621A,
+    0x2207,
+    0x2601,
+    0x7EC3,
+    0x4D17,
+    0x4013,
+    0x4A17,
+    0x189B,
+    0x7818,
+    0xB2C0,
+    0xF7FF,
+    0xFE22,
+    0x8923,
+    0x8923,
+    0xB29B,
+    0x602B,
+    0x7B23,
+    0xB2DB,
+    0x60AB,
+    0x7B63,
+    0x692A,
+    0x7B63,
+    0x43B2,
+    0x4033,
+    0x4313,
+    0x612B,
+    0x7AE0,
+    0xB2C0,
+    0xF7FF,
+    0xFFCE,
+    0x0023,
+    0x3324,
+    0x781A,
+    0x2303,
+    0x4232,
+    0xD100,
+    0x0033,
+    0x2118,
+    0x696A,
+    0x00DB,
+    0x438A,
+    0x4313,
+    0x616B,
+    0x0020,
+    0xF7FF,
+    0xFF7A,
+    0xBD70,
+    0x46C0,
+    0x4000,
+    0x4200,
+    0xFFFF,
+    0xFF7F,
+    0x5000,
+    0x4200,
+    0x803C,
+    0x4200,
+    0xB510,
+    0xF7FF,
+    0xFFB9,
+    0x2102,
+    0x4B04,
+    0x781A,
+    0x4B04,
+    0xB2D2,
+    0x62DA,
+    0x1C5A,
+    0x77D1,
+    0x2201,
+    0x61DA,
+    0xBD10,
+    0x0262,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xB5F0,
+    0x2680,
+    0x4C1A,
+    0x0136,
+    0x7823,
+    0x4F1A,
+    0x1AC0,
+    0x4B1A,
+    0x6298,
+    0x6A1A,
+    0x4819,
+    0x4332,
+    0x621A,
+    0x6A1A,
+    0x4002,
+    0x4818,
+    0x621A,
+    0x7802,
+    0x6A1D,
+    0x7802,
+    0x403D,
+    0x0912,
+    0x07D2,
+    0x0C12,
+    0x432A,
+    0x621A,
+    0x7822,
+    0x2401,
+    0xB2D2,
+    0x62DA,
+    0x2203,
+    0x1C5D,
+    0x77EA,
+    0x61DC,
+    0x6299,
+    0x6A1A,
+    0x4316,
+    0x621E,
+    0x7802,
+    0x6A19,
+    0x7802,
+    0x4039,
+    0x0952,
+    0x07D2,
+    0x0C12,
+    0x430A,
+    0x621A,
+    0x4A09,
+    0x7812,
+    0xB2D2,
+    0x62DA,
+    0x2206,
+    0x77EA,
+    0x61DC,
+    0xBDF0,
+    0x46C0,
+    0x0261,
+    0x4203,
+    0x7FFF,
+    0xFFFF,
+    0x4000,
+    0x4200,
+    0xFFFF,
+    0xFF7F,
+    0x0108,
+    0x4203,
+    0x0263,
+    0x4203,
+    0xB570,
+    0x2401,
+    0x2507,
+    0x491A,
+    0x4B1A,
+    0x6FC8,
+    0x6FCA,
+    0x4020,
+    0x4322,
+    0x67CA,
+    0x681A,
+    0x402A,
+    0x2A03,
+    0xD122,
+    0x4A16,
+    0x3D03,
+    0x6015,
+    0x6A1A,
+    0x4D15,
+    0x4E16,
+    0x402A,
+    0x621A,
+    0x6A1A,
+    0x4D15,
+    0x402A,
+    0x621A,
+    0x4A14,
+    0x7815,
+    0x6A1D,
+    0x7812,
+    0x4035,
+    0x0952,
+    0x07D2,
+    0x0C12,
+    0x432A,
+    0x2506,
+    0x621A,
+    0x4A10,
+    0x7812,
+    0xB2D2,
+    0x62DA,
+    0x4A0F,
+    0x77D5,
+    0x4A0F,
+    0x61DC,
+    0x7813,
+    0x1924,
+    0x43A3,
+    0x7013,
+    0x2201,
+    0x6FCB,
+    0x4393,
+    0x4303,
+    0x67CB,
+    0xBD70,
+    0x46C0,
+    0x4004,
+    0x4200,
+    0x4000,
+    0x4200,
+    0x408C,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x7FFF,
+    0xFFFF,
+    0xFFFF,
+    0xFF7F,
+    0x0108,
+    0x4203,
+    0x0263,
+    0x4203,
+    0x4001,
+    0x4200,
+    0x0107,
+    0x4203,
+    0x4B07,
+    0x4908,
+    0x6A1A,
+    0x400A,
+    0x621A,
+    0x6A1A,
+    0x4906,
+    0x400A,
+    0x621A,
+    0x2200,
+    0x1C59,
+    0x62DA,
+    0x77CA,
+    0x3201,
+    0x61DA,
+    0x4770,
+    0x4000,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x7FFF,
+    0xFFFF,
+    0xB530,
+    0x4B15,
+    0x4C15,
+    0x4A16,
+    0x2800,
+    0xD01A,
+    0x2102,
+    0x4D15,
+    0x7828,
+    0x4388,
+    0x4301,
+    0x7029,
+    0x2108,
+    0x6F18,
+    0x4301,
+    0x2001,
+    0x6719,
+    0x7821,
+    0x0004,
+    0x408C,
+    0x7911,
+    0x4321,
+    0x7111,
+    0x6A1A,
+    0x490D,
+    0x400A,
+    0x621A,
+    0x2200,
+    0x490C,
+    0x62DA,
+    0x77CA,
+    0x61D8,
+    0xBD30,
+    0x2008,
+    0x6F19,
+    0x4381,
+    0x6719,
+    0x2101,
+    0x7823,
+    0x4099,
+    0x7913,
+    0x438B,
+    0x7113,
+    0xE7F3,
+    0x4000,
+    0x4200,
+    0x012F,
+    0x4203,
+    0xC900,
+    0x4203,
+    0x0107,
+    0x4203,
+    0xF7FF,
+    0xFFFF,
+    0x4001,
+    0x4200,
+    0x2201,
+    0x4B02,
+    0x601A,
+    0x601A,
+    0x601A,
+    0x4770,
+    0x4094,
+    0x4200,
+    0xB510,
+    0xF7FF,
+    0xFF5B,
+    0x2302,
+    0x4A09,
+    0x6313,
+    0x4B09,
+    0x7819,
+    0x2303,
+    0x4019,
+    0x3331,
+    0x434B,
+    0x4907,
+    0x185B,
+    0x2104,
+    0x6259,
+    0x2308,
+    0x6313,
+    0x6311,
+    0x2201,
+    0x4B04,
+    0x601A,
+    0xBD10,
+    0x46C0,
+    0x6000,
+    0x4200,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0x4094,
+    0x4200,
+    0xB5F8,
+    0x4C13,
+    0x2204,
+    0x0023,
+    0x338C,
+    0x601A,
+    0x6A23,
+    0x4A11,
+    0x2601,
+    0x4013,
+    0x2206,
+    0x2708,
+    0x2510,
+    0x6223,
+    0x4B0E,
+    0x781B,
+    0xB2DB,
+    0x62E3,
+    0x1C63,
+    0x77DA,
+    0x3404,
+    0x61A6,
+    0x6FE3,
+    0x43BB,
+    0x67E3,
+    0x6FE3,
+    0x43AB,
+    0x67E3,
+    0xF7FF,
+    0xFFBA,
+    0x4B07,
+    0x631E,
+    0x6FE3,
+    0x431F,
+    0x67E7,
+    0x6FE3,
+    0x431D,
+    0x67E5,
+    0xBDF8,
+    0x46C0,
+    0x4000,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x0263,
+    0x4203,
+    0x5000,
+    0x4200,
+    0xB510,
+    0xF001,
+    0xFF1D,
+    0xF7FF,
+    0xFFCB,
+    0xF7FF,
+    0xFFA9,
+    0x4B08,
+    0x2204,
+    0x0019,
+    0x318C,
+    0x600A,
+    0x2103,
+    0x3394,
+    0x6019,
+    0x4B05,
+    0x3105,
+    0x6319,
+    0x631A,
+    0x320C,
+    0x631A,
+    0xF001,
+    0xFF11,
+    0xBD10,
+    0x4000,
+    0x4200,
+    0x6000,
+    0x4200,
+    0xB510,
+    0x2300,
+    0x0004,
+    0x0008,
+    0x2904,
+    0xD809,
+    0xF7F3,
+    0xFC60,
+    0x0A03,
+    0x1711,
+    0x0020,
+    0x4B12,
+    0x781B,
+    0x3304,
+    0x191B,
+    0x015B,
+    0x0018,
+    0xBD10,
+    0x4B0F,
+    0x781B,
+    0x3303,
+    0x191B,
+    0x00DB,
+    0x189B,
+    0xE7F6,
+    0x4B0D,
+    0x781B,
+    0x3303,
+    0x191B,
+    0x009B,
+    0xE7F7,
+    0x4B0B,
+    0x3C01,
+    0x781B,
+    0x01A4,
+    0x00DB,
+    0x3341,
+    0x33FF,
+    0x191B,
+    0xE7E7,
+    0x4B06,
+    0x3C01,
+    0x781B,
+    0x0124,
+    0x00DB,
+    0x332F,
+    0x33FF,
+    0xE7F5,
+    0x024C,
+    0x4203,
+    0x024D,
+    0x4203,
+    0x024E,
+    0x4203,
+    0x024F,
+    0x4203,
+    0x2203,
+    0xB510,
+    0x4B0E,
+    0x490F,
+    0x6918,
+    0x4B0F,
+    0x308E,
+    0x781B,
+    0xB25B,
+    0x18C0,
+    0x6FCB,
+    0x095B,
+    0x4013,
+    0x4293,
+    0xD00E,
+    0x6FCB,
+    0x095B,
+    0x4013,
+    0x2200,
+    0x2B03,
+    0xD001,
+    0x4A08,
+    0x5CD2,
+    0x4B08,
+    0x7819,
+    0x1809,
+    0x1889,
+    0xF7FF,
+    0xFE59,
+    0xBD10,
+    0x2302,
+    0xE7F4,
+    0x4000,
+    0x4200,
+    0x8004,
+    0x4200,
+    0x0110,
+    0x4203,
+    0x1DD4,
+    0x1003,
+    0x0111,
+    0x4203,
+    0x3801,
+    0xB2C3,
+    0x20FF,
+    0x2B03,
+    0xD801,
+    0x4A01,
+    0x5CD0,
+    0x4770,
+    0x1DD0,
+    0x1003,
+    0x4B0A,
+    0x6F5B,
+    0xB2DB,
+    0x40C3,
+    0x07DB,
+    0xD50B,
+    0x4B08,
+    0x6FDB,
+    0x065B,
+    0x0F9B,
+    0x2B03,
+    0xD100,
+    0x3B01,
+    0x4A06,
+    0x189B,
+    0x7818,
+    0xB2C0,
+    0x4770,
+    0x4B04,
+    0x7C18,
+    0xE7FA,
+    0x46C0,
+    0x4000,
+    0x4200,
+    0x8004,
+    0x4200,
+    0x0011,
+    0x4203,
+    0x0000,
+    0x4203,
+    0xB510,
+    0x4B0D,
+    0x781C,
+    0xB2E4,
+    0x0020,
+    0xF7FF,
+    0xFFDB,
+    0x2214,
+    0x4362,
+    0x4B0A,
+    0x18D2,
+    0x68D1,
+    0x0783,
+    0xD509,
+    0x24FE,
+    0x024B,
+    0x165B,
+    0x3B01,
+    0x03E4,
+    0x041B,
+    0x4023,
+    0x4C05,
+    0x4021,
+    0x4319,
+    0x6110,
+    0x60D1,
+    0xBD10,
+    0x46C0,
+    0x012F,
+    0x4203,
+    0x808C,
+    0x4200,
+    0xFFFF,
+    0x0780,
+    0xB5F7,
+    0x4B1A,
+    0x18C4,
+    0x4B1A,
+    0x7826,
+    0x781B,
+    0xB2F5,
+    0xB2DA,
+    0x9201,
+    0x4A18,
+    0x0436,
+    0x6A17,
+    0x021B,
+    0x46BC,
+    0x4661,
+    0x4F16,
+    0xB2C0,
+    0x400F,
+    0x21FC,
+    0x0389,
+    0x400E,
+    0x433E,
+    0x6216,
+    0x6A16,
+    0x4F12,
+    0x9901,
+    0x403E,
+    0x27E0,
+    0x00FF,
+    0x403B,
+    0x4333,
+    0x6213,
+    0x4B0F,
+    0x6FDE,
+    0x0676,
+    0x0FB6,
+    0x0032,
+    0xF7FF,
+    0xFC99,
+    0x2E00,
+    0xD001,
+    0xF7FF,
+    0xFFB3,
+    0x7820,
+    0xB2C0,
+    0xF7FF,
+    0xFBB7,
+    0x2208,
+    0x4B08,
+    0x625D,
+    0x629A,
+    0x2200,
+    0x625A,
+    0xBDF7,
+    0x013C,
+    0x4203,
+    0x012F,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xFFFF,
+    0xFFC0,
+    0xF8FF,
+    0xFFFF,
+    0x8004,
+    0x4200,
+    0x8000,
+    0x4200,
+    0x2901,
+    0xD903,
+    0x4B04,
+    0x7818,
+    0xB2C0,
+    0x4770,
+    0x07C0,
+    0xD501,
+    0x4B02,
+    0xE7F8,
+    0x4B02,
+    0xE7F6,
+    0x011E,
+    0x4203,
+    0x011C,
+    0x4203,
+    0x011D,
+    0x4203,
+    0x3801,
+    0xB2C0,
+    0x2803,
+    0xD900,
+    0x20FF,
+    0x4770,
+    0x4B03,
+    0x4A04,
+    0x6F19,
+    0x7111,
+    0x2200,
+    0x671A,
+    0x4770,
+    0x46C0,
+    0x4000,
+    0x4200,
+    0xC900,
+    0x4203,
+    0xB570,
+    0x2400,
+    0x2601,
+    0x4D0D,
+    0x792B,
+    0x40E3,
+    0x4233,
+    0xD00D,
+    0x0031,
+    0x40A1,
+    0x4B0A,
+    0x4A0B,
+    0x18E3,
+    0x7818,
+    0x7813,
+    0xB2C0,
+    0x438B,
+    0x7013,
+    0xB2E1,
+    0x2200,
+    0xF7FF,
+    0xFC42,
+    0x3401,
+    0x2C08,
+    0xD1E9,
+    0x792A,
+    0x4B04,
+    0x671A,
+    0xBD70,
+    0x46C0,
+    0xC900,
+    0x4203,
+    0x0220,
+    0x4203,
+    0x4070,
+    0x4200,
+    0x4000,
+    0x4200,
+    0xB570,
+    0x2401,
+    0x4B0B,
+    0x0002,
+    0x781D,
+    0x0023,
+    0x40AB,
+    0x490A,
+    0xB2DB,
+    0x439A,
+    0x710A,
+    0x4A09,
+    0x6F12,
+    0xB2D2,
+    0x40EA,
+    0x4222,
+    0xD001,
+    0x4303,
+    0x710B,
+    0xF000,
+    0xF86B,
+    0x2800,
+    0xD101,
+    0xF7FF,
+    0xFFC1,
+    0xBD70,
+    0x012F,
+    0x4203,
+    0xC900,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xB570,
+    0x4D19,
+    0x0004,
+    0x6AAB,
+    0x0008,
+    0x069B,
+    0x0FD9,
+    0x2B00,
+    0xDB28,
+    0x4B16,
+    0x7018,
+    0x4B16,
+    0x4816,
+    0x701A,
+    0xF001,
+    0xFBFC,
+    0x4815,
+    0x6821,
+    0xF001,
+    0xFBF8,
+    0x4814,
+    0x6861,
+    0xF001,
+    0xFBF4,
+    0x4813,
+    0x68A1,
+    0xF001,
+    0xFBF0,
+    0x4812,
+    0x68E1,
+    0xF001,
+    0xFBEC,
+    0x4811,
+    0x6921,
+    0xF001,
+    0xFBE8,
+    0x4810,
+    0x6961,
+    0xF001,
+    0xFBE4,
+    0x480F,
+    0x69A1,
+    0xF001,
+    0xFBE0,
+    0x480E,
+    0x69E1,
+    0xF001,
+    0xFBDC,
+    0x2320,
+    0x602B,
+    0xBD70,
+    0x46C0,
+    0x4000,
+    0x4201,
+    0x8200,
+    0x4203,
+    0x8201,
+    0x4203,
+    0x1DD7,
+    0x1003,
+    0x1DE2,
+    0x1003,
+    0x1DE5,
+    0x1003,
+    0x1DE8,
+    0x1003,
+    0x1DEB,
+    0x1003,
+    0x1DEE,
+    0x1003,
+    0x1DF2,
+    0x1003,
+    0x1DF5,
+    0x1003,
+    0x1DF8,
+    0x1003,
+    0xB510,
+    0xF3EF,
+    0x8008,
+    0x2200,
+    0x2103,
+    0x3008,
+    0xF7FF,
+    0xFFAC,
+    0xE7FE,
+    0xB510,
+    0xF3EF,
+    0x8008,
+    0x2200,
+    0x2104,
+    0x3008,
+    0xF7FF,
+    0xFFA3,
+    0xE7FE,
+    0x4770,
+    0x0000,
+    0x4B03,
+    0x7818,
+    0x3801,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0x4770,
+    0x46C0,
+    0x028C,
+    0x4203,
+    0x2203,
+    0x4B01,
+    0x701A,
+    0x4770,
+    0x028C,
+    0x4203,
+    0x4B05,
+    0x781A,
+    0x2A01,
+    0xD005,
+    0x4A04,
+    0x6D91,
+    0x4A04,
+    0x6011,
+    0x2201,
+    0x701A,
+    0x4770,
+    0x46C0,
+    0x028C,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0290,
+    0x4203,
+    0x2200,
+    0x4B01,
+    0x801A,
+    0x4770,
+    0xC908,
+    0x4203,
+    0x200F,
+    0x2201,
+    0xB510,
+    0x4906,
+    0x880B,
+    0x001C,
+    0x40C4,
+    0x4214,
+    0xD001,
+    0x3801,
+    0xE7F9,
+    0x4082,
+    0x4313,
+    0xB2C0,
+    0x800B,
+    0xBD10,
+    0xC908,
+    0x4203,
+    0x220F,
+    0x2300,
+    0x4282,
+    0x415B,
+    0xB2D8,
+    0x4770,
+    0xB530,
+    0x28FF,
+    0xD00C,
+    0x2300,
+    0x2518,
+    0x4C08,
+    0x8821,
+    0x4A08,
+    0x1889,
+    0x002A,
+    0x435A,
+    0x1852,
+    0x7812,
+    0x4290,
+    0xD101,
+    0xB2D8,
+    0xBD30,
+    0x3301,
+    0x2B10,
+    0xD1F1,
+    0x20FF,
+    0xE7F9,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x0003,
+    0x2810,
+    0xD00F,
+    0x2018,
+    0x2101,
+    0x4A07,
+    0x4358,
+    0x8812,
+    0x4B06,
+    0x18D2,
+    0x1880,
+    0x7802,
+    0x4B05,
+    0x4091,
+    0x881A,
+    0x438A,
+    0x801A,
+    0x23FF,
+    0x7003,
+    0x4770,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0xC908,
+    0x4203,
+    0x2200,
+    0x4B03,
+    0x801A,
+    0x4B03,
+    0x32FF,
+    0x701A,
+    0x4770,
+    0x46C0,
+    0xC90C,
+    0x4203,
+    0xC90A,
+    0x4203,
+    0x4B02,
+    0x8818,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0x4770,
+    0xC90C,
+    0x4203,
+    0xB5F7,
+    0x23FF,
+    0x2400,
+    0x4E10,
+    0xAD01,
+    0x70AC,
+    0x802C,
+    0x7033,
+    0x4B0E,
+    0x2201,
+    0x881B,
+    0x40E3,
+    0x4213,
+    0xD011,
+    0xB2E7,
+    0x0039,
+    0x6828,
+    0xF001,
+    0xF801,
+    0x2800,
+    0xD10A,
+    0x4B09,
+    0x3018,
+    0x4360,
+    0x881B,
+    0x4A08,
+    0x189B,
+    0x18C0,
+    0xF000,
+    0xFFE6,
+    0x7037,
+    0x6028,
+    0x3401,
+    0x2C10,
+    0xD1E4,
+    0xBDF7,
+    0xC90A,
+    0x4203,
+    0xC90C,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F7,
+    0x000D,
+    0x2100,
+    0x0004,
+    0x7029,
+    0x0008,
+    0x2C0F,
+    0xD81A,
+    0x4E10,
+    0x2201,
+    0x8833,
+    0x001F,
+    0x40E7,
+    0x4217,
+    0xD113,
+    0x40A2,
+    0x4313,
+    0x8033,
+    0x4B0C,
+    0x8818,
+    0x4B0C,
+    0x18C0,
+    0x2318,
+    0x4363,
+    0x18C0,
+    0xF000,
+    0xFFBD,
+    0x4E0A,
+    0x7831,
+    0x29FF,
+    0xD104,
+    0x2301,
+    0x7034,
+    0x702B,
+    0x2001,
+    0xBDFE,
+    0xF000,
+    0xFFC2,
+    0x2800,
+    0xD1F6,
+    0xE7F8,
+    0x46C0,
+    0xC90C,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xC90A,
+    0x4203,
+    0xB573,
+    0x4C14,
+    0x0003,
+    0x8822,
+    0x1E10,
+    0xD021,
+    0x2000,
+    0x2B0F,
+    0xD81E,
+    0x2101,
+    0x4099,
+    0x438A,
+    0x8022,
+    0x2418,
+    0x4D0E,
+    0x4363,
+    0x882A,
+    0x4E0E,
+    0x1992,
+    0x1898,
+    0xF000,
+    0xFF90,
+    0x4A0C,
+    0x9000,
+    0x7812,
+    0x882B,
+    0x4354,
+    0x199B,
+    0x18E0,
+    0xF000,
+    0xFF87,
+    0x466B,
+    0x0C00,
+    0x789B,
+    0xB2C0,
+    0x4298,
+    0xD101,
+    0xF7FF,
+    0xFF7B,
+    0x2001,
+    0xBD76,
+    0x46C0,
+    0xC90C,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xC90A,
+    0x4203,
+    0xB510,
+    0x4A0C,
+    0x0003,
+    0x7814,
+    0x2001,
+    0x2CFF,
+    0xD010,
+    0x4A0A,
+    0x480A,
+    0x8811,
+    0x2218,
+    0x4362,
+    0x1809,
+    0x1852,
+    0x7812,
+    0x4908,
+    0x1852,
+    0x4908,
+    0x0092,
+    0x6812,
+    0x6D88,
+    0x1818,
+    0x1A80,
+    0x0FC0,
+    0xBD10,
+    0x46C0,
+    0xC90A,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x9000,
+    0x4201,
+    0x4B02,
+    0x781A,
+    0x4B02,
+    0x701A,
+    0x4770,
+    0x46C0,
+    0xC90A,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x4B01,
+    0x7818,
+    0x4770,
+    0x46C0,
+    0xC90A,
+    0x4203,
+    0xB510,
+    0x894B,
+    0x7849,
+    0x0004,
+    0x2201,
+    0x0008,
+    0xB29B,
+    0x4010,
+    0x4211,
+    0xD103,
+    0x2C14,
+    0xD002,
+    0x2C1A,
+    0xD005,
+    0xBD10,
+    0x4A0E,
+    0x1898,
+    0xF7F5,
+    0xFD45,
+    0xE7F9,
+    0x4B0C,
+    0x490D,
+    0x480D,
+    0x781B,
+    0x8809,
+    0x7800,
+    0x4343,
+    0x185B,
+    0x4907,
+    0x480B,
+    0x185B,
+    0x490B,
+    0x781B,
+    0x8809,
+    0x7800,
+    0x4343,
+    0x185B,
+    0x4909,
+    0x185B,
+    0x781B,
+    0x085B,
+    0x439A,
+    0x0010,
+    0xE7E1,
+    0x8000,
+    0x4203,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x8014,
+    0x4203,
+    0x8853,
+    0x3810,
+    0x3301,
+    0xB29B,
+    0xB510,
+    0x000C,
+    0x8053,
+    0x2815,
+    0xD835,
+    0xF7F3,
+    0xF91D,
+    0x343B,
+    0x0B34,
+    0x1C14,
+    0x2420,
+    0x3428,
+    0x3418,
+    0x3434,
+    0x3434,
+    0x342C,
+    0x3434,
+    0x3034,
+    0x0010,
+    0xF7F5,
+    0xFB1B,
+    0x2301,
+    0x40A3,
+    0x4A16,
+    0xB29B,
+    0x80D3,
+    0xBD10,
+    0x0010,
+    0xF7F5,
+    0xFE72,
+    0xE7F5,
+    0x0010,
+    0xF7FB,
+    0xFF18,
+    0xE7F1,
+    0x0010,
+    0xF7F4,
+    0xFB54,
+    0xE7ED,
+    0x0010,
+    0xF7F7,
+    0xFC22,
+    0xE7E9,
+    0x0010,
+    0xF7F6,
+    0xFD5A,
+    0xE7E5,
+    0x0010,
+    0xF7F6,
+    0xFC9C,
+    0xE7E1,
+    0x0010,
+    0xF003,
+    0xFFAC,
+    0xE7DD,
+    0x0010,
+    0xF002,
+    0xFEDE,
+    0xE7D9,
+    0x2000,
+    0x22DF,
+    0x4904,
+    0xF7FD,
+    0xFB84,
+    0x2000,
+    0xE7D2,
+    0x2001,
+    0xE7D0,
+    0x4000,
+    0x4201,
+    0x1DFC,
+    0x1003,
+    0x2200,
+    0x4B01,
+    0x701A,
+    0x4770,
+    0xC90E,
+    0x4203,
+    0xB510,
+    0xF001,
+    0xFB6F,
+    0x2201,
+    0x4B2D,
+    0x492E,
+    0x701A,
+    0x7809,
+    0xB2C8,
+    0x2914,
+    0xD01C,
+    0x2814,
+    0xD806,
+    0x4290,
+    0xD015,
+    0x2810,
+    0xD035,
+    0xF001,
+    0xFB67,
+    0xBD10,
+    0x2821,
+    0xD00E,
+    0xD80A,
+    0x2815,
+    0xD001,
+    0x281C,
+    0xD1F5,
+    0x4A24,
+    0x7812,
+    0xB2D1,
+    0x2A00,
+    0xD107,
+    0x7019,
+    0xE7EE,
+    0x2823,
+    0xD0F6,
+    0xE7EB,
+    0xF7FF,
+    0xFF3D,
+    0xE7E8,
+    0x4B1E,
+    0x2201,
+    0x781B,
+    0x079B,
+    0xD5E3,
+    0x2107,
+    0x4C1C,
+    0x6FE3,
+    0x4313,
+    0x67E3,
+    0x4B1B,
+    0x681B,
+    0x400B,
+    0x2B03,
+    0xD106,
+    0xF7FF,
+    0xFB27,
+    0x2201,
+    0x6FE3,
+    0x4393,
+    0x67E3,
+    0xE7D2,
+    0x2104,
+    0x4B16,
+    0x6019,
+    0x6FE3,
+    0x4393,
+    0x67E3,
+    0xF005,
+    0xF888,
+    0xE7F1,
+    0x4B13,
+    0x785B,
+    0x2B00,
+    0xD0C5,
+    0x2107,
+    0x4C0D,
+    0x6FE3,
+    0x4313,
+    0x67E3,
+    0x4B0C,
+    0x681B,
+    0x400B,
+    0x2B06,
+    0xD1E3,
+    0x4B0B,
+    0x3903,
+    0x6019,
+    0x6FE3,
+    0x3902,
+    0x4393,
+    0x67E3,
+    0xF7F6,
+    0xF828,
+    0xE7D9,
+    0x46C0,
+    0x020A,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x0208,
+    0x4203,
+    0x0107,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x4000,
+    0x4200,
+    0x408C,
+    0x4200,
+    0xC800,
+    0x4203,
+    0xB5F7,
+    0x2518,
+    0x4F17,
+    0x4345,
+    0x883C,
+    0xF001,
+    0xFAFB,
+    0x4B16,
+    0x1964,
+    0x18E3,
+    0x781E,
+    0x4B15,
+    0x4A15,
+    0x6D9B,
+    0xB2F6,
+    0x9301,
+    0x883B,
+    0x189B,
+    0x195B,
+    0x781B,
+    0x4A12,
+    0x189B,
+    0x009B,
+    0x681D,
+    0x4B11,
+    0x18E4,
+    0x7824,
+    0xF001,
+    0xFAED,
+    0x4A10,
+    0x2301,
+    0x6A91,
+    0xB2E4,
+    0x0609,
+    0xD40D,
+    0x490E,
+    0x700B,
+    0x490E,
+    0x43B3,
+    0x700B,
+    0x4B0D,
+    0x490E,
+    0x701C,
+    0x9B01,
+    0x1B5B,
+    0xB29B,
+    0x800B,
+    0x2380,
+    0x6013,
+    0xBDF7,
+    0x021C,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x8009,
+    0x4203,
+    0x4000,
+    0x4201,
+    0x8204,
+    0x4203,
+    0x8206,
+    0x4203,
+    0x8207,
+    0x4203,
+    0x8208,
+    0x4203,
+    0x6141,
+    0x8A03,
+    0x189B,
+    0xB29B,
+    0x8203,
+    0x2302,
+    0x7B02,
+    0x439A,
+    0x4313,
+    0x7303,
+    0x4770,
+    0x0000,
+    0xB5F7,
+    0x2618,
+    0x0004,
+    0x4F21,
+    0x7001,
+    0x4371,
+    0x883B,
+    0x9201,
+    0x4A1F,
+    0x2501,
+    0x189B,
+    0x185B,
+    0x6043,
+    0xF001,
+    0xFA9F,
+    0x6863,
+    0x695A,
+    0x60E2,
+    0x9A01,
+    0x2A00,
+    0xD107,
+    0x7B1B,
+    0x40EB,
+    0x422B,
+    0xD11D,
+    0xF001,
+    0xFA9B,
+    0x2000,
+    0xBDFE,
+    0x7B1A,
+    0x422A,
+    0xD0F8,
+    0x7B1B,
+    0x085B,
+    0x422B,
+    0xD0F4,
+    0x7823,
+    0x9301,
+    0xF001,
+    0xFA86,
+    0x9801,
+    0x4A10,
+    0x4346,
+    0x6993,
+    0x480F,
+    0x8839,
+    0x1809,
+    0x1876,
+    0x7831,
+    0x408D,
+    0x43AB,
+    0xB29B,
+    0x6193,
+    0xF001,
+    0xFA7F,
+    0x6863,
+    0x2102,
+    0x8A1A,
+    0xB212,
+    0x60A2,
+    0x2200,
+    0x821A,
+    0x7B1A,
+    0x438A,
+    0x731A,
+    0xF001,
+    0xFA73,
+    0x2001,
+    0xE7D6,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x8008,
+    0x4203,
+    0xB51F,
+    0x0001,
+    0x2201,
+    0x4668,
+    0xF7FF,
+    0xFFAC,
+    0x2800,
+    0xD00F,
+    0x9B01,
+    0x7A5B,
+    0xB2DA,
+    0x2B14,
+    0xD007,
+    0x2A16,
+    0xD00A,
+    0x22F3,
+    0x2000,
+    0x4906,
+    0xF7FD,
+    0xFA50,
+    0xE002,
+    0x4668,
+    0xF7F5,
+    0xFF28,
+    0xB005,
+    0xBD00,
+    0x4668,
+    0xF7F7,
+    0xFB1D,
+    0xE7F9,
+    0x1DFC,
+    0x1003,
+    0xB5F7,
+    0x2200,
+    0x7A43,
+    0x0004,
+    0x9201,
+    0x2B15,
+    0xD003,
+    0x4B54,
+    0x881B,
+    0xB29B,
+    0x9301,
+    0x9B01,
+    0x2718,
+    0x81E3,
+    0x2301,
+    0x7B22,
+    0x4D50,
+    0x439A,
+    0x9B01,
+    0x1E59,
+    0x418B,
+    0x4313,
+    0x7323,
+    0x4B4E,
+    0x4A4E,
+    0x781E,
+    0x882B,
+    0x437E,
+    0x189B,
+    0x199B,
+    0x429C,
+    0xD13B,
+    0xF000,
+    0xFE62,
+    0x4F4A,
+    0x2800,
+    0xD034,
+    0x6801,
+    0x88C3,
+    0x9A01,
+    0x469C,
+    0x4B48,
+    0x881B,
+    0x189B,
+    0x1AC9,
+    0x4A47,
+    0x882B,
+    0x189B,
+    0x199B,
+    0x781B,
+    0x4A45,
+    0x189B,
+    0x009B,
+    0x6019,
+    0x4B3F,
+    0x001A,
+    0x4462,
+    0x6813,
+    0x6023,
+    0x7903,
+    0xB2DB,
+    0x7263,
+    0x88C3,
+    0xB29B,
+    0x8163,
+    0xF000,
+    0xFDCD,
+    0x2101,
+    0x4B3D,
+    0x7019,
+    0x2300,
+    0x703B,
+    0xF001,
+    0xF9F6,
+    0x493B,
+    0x4838,
+    0x698B,
+    0x882A,
+    0xB29B,
+    0x1812,
+    0x2001,
+    0x1992,
+    0x7812,
+    0x4090,
+    0x4303,
+    0x618B,
+    0xF001,
+    0xF9F0,
+    0x2001,
+    0xBDFE,
+    0x7038,
+    0xE7FC,
+    0x7A63,
+    0x2B1A,
+    0xD130,
+    0x4B32,
+    0x781A,
+    0xB2D3,
+    0x2AFF,
+    0xD0F3,
+    0x4A30,
+    0x4931,
+    0x8812,
+    0x7809,
+    0x434B,
+    0x189B,
+    0x4A25,
+    0x492F,
+    0x189B,
+    0x4A2F,
+    0x781B,
+    0x8812,
+    0x7809,
+    0x434B,
+    0x189B,
+    0x4A2D,
+    0x0039,
+    0x189B,
+    0x681E,
+    0x4B21,
+    0x881B,
+    0x8828,
+    0x1AF6,
+    0x9B01,
+    0x1A20,
+    0x1AF6,
+    0x4B28,
+    0x882D,
+    0x18C0,
+    0xF7F2,
+    0xFF3F,
+    0x230F,
+    0x4018,
+    0x4378,
+    0x4B1A,
+    0xB2AD,
+    0x18ED,
+    0x1940,
+    0x7803,
+    0x4A19,
+    0x189B,
+    0x009B,
+    0x601E,
+    0xE7C7,
+    0x8828,
+    0x4B1F,
+    0x1A20,
+    0x0039,
+    0x18C0,
+    0xF7F2,
+    0xFF2B,
+    0x230F,
+    0x4018,
+    0x882E,
+    0x4378,
+    0x4910,
+    0xB2B6,
+    0x1876,
+    0x1836,
+    0x7833,
+    0x4E0E,
+    0x199B,
+    0x009B,
+    0x681B,
+    0x6862,
+    0x18D2,
+    0x9B01,
+    0x1AD2,
+    0x882B,
+    0x185B,
+    0x181B,
+    0x781B,
+    0x199B,
+    0x009B,
+    0x601A,
+    0xE7A7,
+    0x020C,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x0210,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0212,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x0213,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0xB5F0,
+    0x2518,
+    0x4E3A,
+    0x4345,
+    0x8833,
+    0x4A3A,
+    0x195B,
+    0xB087,
+    0x189A,
+    0x9201,
+    0x0004,
+    0x8832,
+    0x4837,
+    0x4F38,
+    0x1812,
+    0x1952,
+    0x7812,
+    0x4937,
+    0x19D2,
+    0x1859,
+    0x0092,
+    0x6812,
+    0x8809,
+    0x1889,
+    0x8832,
+    0x1812,
+    0x1952,
+    0x7812,
+    0x19D2,
+    0x2701,
+    0x0092,
+    0x6011,
+    0x4A30,
+    0x1899,
+    0x780A,
+    0x43BA,
+    0x700A,
+    0x4A2F,
+    0x9901,
+    0x189B,
+    0x781B,
+    0xB2DB,
+    0x0018,
+    0x9302,
+    0xF7FF,
+    0xFD42,
+    0x9003,
+    0x2800,
+    0xD015,
+    0x0021,
+    0x9A01,
+    0x9802,
+    0xF7FF,
+    0xFD74,
+    0x2800,
+    0xD00C,
+    0x9801,
+    0xF7FF,
+    0xFEF3,
+    0x2800,
+    0xD007,
+    0x8833,
+    0x4A1E,
+    0x189B,
+    0x195B,
+    0x781B,
+    0x409F,
+    0x4B21,
+    0x641F,
+    0xB007,
+    0xBDF0,
+    0x8833,
+    0x4A19,
+    0x9801,
+    0x189B,
+    0x003A,
+    0x195B,
+    0x781B,
+    0x409A,
+    0x4B1B,
+    0x641A,
+    0xF000,
+    0xFC5D,
+    0x9005,
+    0xF001,
+    0xF918,
+    0xAB04,
+    0x9A03,
+    0x1CD9,
+    0x0020,
+    0x70DA,
+    0xF7FF,
+    0xFC7B,
+    0x4A15,
+    0x4B15,
+    0x7811,
+    0x2900,
+    0xD104,
+    0x7017,
+    0x701C,
+    0xF001,
+    0xF910,
+    0xE7DD,
+    0x781A,
+    0x4294,
+    0xD0F9,
+    0xAA04,
+    0x78D2,
+    0x2A00,
+    0xD0F5,
+    0x7819,
+    0x9805,
+    0xB2C9,
+    0xF000,
+    0xFC4D,
+    0x2800,
+    0xD0EE,
+    0xF7FF,
+    0xFD85,
+    0xE7EB,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x800E,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0200,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x4B04,
+    0x781A,
+    0x4B04,
+    0x2AFF,
+    0xD102,
+    0x2200,
+    0x701A,
+    0x4770,
+    0x2201,
+    0xE7FB,
+    0x0209,
+    0x4203,
+    0x0200,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFCC3,
+    0xF7FF,
+    0xFFED,
+    0xBD10,
+    0xB570,
+    0x4B18,
+    0x0004,
+    0x781B,
+    0x000D,
+    0x4283,
+    0xD108,
+    0x4B16,
+    0x781A,
+    0x2AFF,
+    0xD002,
+    0x781B,
+    0x4283,
+    0xD001,
+    0xF7FF,
+    0xFFEA,
+    0x7A68,
+    0x002A,
+    0xB2C0,
+    0xB2E1,
+    0xF7FF,
+    0xFCF4,
+    0x2800,
+    0xD012,
+    0x4B0D,
+    0x781A,
+    0x2AFF,
+    0xD00F,
+    0x781B,
+    0x42A3,
+    0xD10C,
+    0x4B0B,
+    0x490B,
+    0x881A,
+    0x2318,
+    0x4363,
+    0x1852,
+    0x189B,
+    0x781A,
+    0x2301,
+    0x4093,
+    0x4A08,
+    0x6413,
+    0xBD70,
+    0x0028,
+    0xF7FF,
+    0xFE5F,
+    0x2800,
+    0xD0F9,
+    0xE7EC,
+    0x0209,
+    0x4203,
+    0x011F,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0xB5F0,
+    0x2518,
+    0x4B48,
+    0xB087,
+    0x781B,
+    0x4E48,
+    0xB2DA,
+    0x9202,
+    0x435D,
+    0x4A47,
+    0x8834,
+    0x7812,
+    0x0007,
+    0x1964,
+    0x429A,
+    0xD001,
+    0xF7FF,
+    0xFA90,
+    0x2301,
+    0x9A02,
+    0x4093,
+    0x4A42,
+    0xB29B,
+    0x8053,
+    0x4B41,
+    0x4A42,
+    0x781B,
+    0x18A2,
+    0xB2D9,
+    0x2B00,
+    0xD058,
+    0x8813,
+    0x3301,
+    0xB29B,
+    0x8013,
+    0x2F00,
+    0xD05D,
+    0x4B3D,
+    0x18E3,
+    0x0018,
+    0x9301,
+    0xF7FF,
+    0xFE27,
+    0x2800,
+    0xD055,
+    0x9801,
+    0xF000,
+    0xFBA4,
+    0x9005,
+    0x8833,
+    0x4A37,
+    0x4F38,
+    0x189B,
+    0x195B,
+    0x781B,
+    0x4A37,
+    0x189B,
+    0x009B,
+    0x681B,
+    0x9303,
+    0x9A03,
+    0x6DBB,
+    0x1AD3,
+    0xD527,
+    0x4B33,
+    0x9901,
+    0x18E3,
+    0x7818,
+    0xB2C0,
+    0xF7FF,
+    0xFC4D,
+    0x2800,
+    0xD11E,
+    0xF7FF,
+    0xFB7D,
+    0x2800,
+    0xD02C,
+    0xAB04,
+    0x1CD9,
+    0x2300,
+    0x9802,
+    0x700B,
+    0xF7FF,
+    0xFBA8,
+    0x4B2A,
+    0x4926,
+    0x18E3,
+    0x881A,
+    0x9B03,
+    0x18D2,
+    0x8833,
+    0x185B,
+    0x195B,
+    0x781B,
+    0x4923,
+    0x185B,
+    0x009B,
+    0x601A,
+    0x2201,
+    0x4B24,
+    0x18E4,
+    0x7823,
+    0x4393,
+    0x7023,
+    0x8833,
+    0x4A1C,
+    0x189B,
+    0x195B,
+    0x781A,
+    0x2301,
+    0x4093,
+    0x643B,
+    0x4B1E,
+    0x781B,
+    0x2B02,
+    0xD001,
+    0xF7FF,
+    0xFF48,
+    0xB007,
+    0xBDF0,
+    0x8011,
+    0xE7A8,
+    0xF7FF,
+    0xFC12,
+    0x0001,
+    0x9805,
+    0xF000,
+    0xFB64,
+    0x2800,
+    0xD1CA,
+    0xE7E4,
+    0xF001,
+    0xF80D,
+    0x4915,
+    0x480D,
+    0x698B,
+    0x8832,
+    0x1812,
+    0x1952,
+    0x7810,
+    0x2201,
+    0x4082,
+    0x4393,
+    0xB29B,
+    0x618B,
+    0xF001,
+    0xF807,
+    0xE7DB,
+    0x0209,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x011F,
+    0x4203,
+    0x4000,
+    0x4201,
+    0x020A,
+    0x4203,
+    0x8002,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x6400,
+    0x1080,
+    0x8009,
+    0x4203,
+    0x800E,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x1000,
+    0x4200,
+    0xB510,
+    0x0004,
+    0x4B05,
+    0x7818,
+    0xB2C0,
+    0xF7FE,
+    0xF9A3,
+    0xF7FF,
+    0xF811,
+    0x0020,
+    0xF7FF,
+    0xFF42,
+    0xBD10,
+    0x46C0,
+    0x02F0,
+    0x4203,
+    0xB5F7,
+    0xF000,
+    0xFFCD,
+    0x4B4E,
+    0x781B,
+    0xB2DA,
+    0x3B15,
+    0xB2DB,
+    0x9201,
+    0x2B0E,
+    0xD80A,
+    0x4A4B,
+    0x411A,
+    0x07D2,
+    0xD406,
+    0xF7FF,
+    0xF89F,
+    0xF7F3,
+    0xFFEF,
+    0xF000,
+    0xFFC3,
+    0xBDF7,
+    0x2101,
+    0x2403,
+    0x4845,
+    0x2580,
+    0x6FC3,
+    0x01AD,
+    0x430B,
+    0x67C3,
+    0x4B43,
+    0x4A44,
+    0x601C,
+    0x2400,
+    0x4B43,
+    0x4E44,
+    0x63DC,
+    0x695F,
+    0x433D,
+    0x2704,
+    0x615D,
+    0x4D42,
+    0x602F,
+    0x6A15,
+    0x4035,
+    0x6215,
+    0x6A15,
+    0x46AC,
+    0x2580,
+    0x4666,
+    0x022D,
+    0x4335,
+    0x6215,
+    0x4D3D,
+    0x62D4,
+    0x77EC,
+    0x61D1,
+    0x6FC4,
+    0x438C,
+    0x67C4,
+    0x483A,
+    0x6804,
+    0x6804,
+    0x6804,
+    0x4839,
+    0x420C,
+    0xD11B,
+    0x6812,
+    0x3106,
+    0x400A,
+    0x2A03,
+    0xD109,
+    0x3905,
+    0x6301,
+    0x4935,
+    0x7809,
+    0x4011,
+    0x3231,
+    0x434A,
+    0x4934,
+    0x1852,
+    0x6257,
+    0x2202,
+    0x4926,
+    0x700A,
+    0x3A01,
+    0x63DA,
+    0x2280,
+    0x6959,
+    0x0192,
+    0x4311,
+    0x6159,
+    0x6959,
+    0x430A,
+    0x615A,
+    0x2308,
+    0x6303,
+    0x3B04,
+    0x6303,
+    0x9B01,
+    0x2B01,
+    0xD026,
+    0x0018,
+    0x3810,
+    0xB2C3,
+    0x2B15,
+    0xD8A7,
+    0x2815,
+    0xD8A5,
+    0xF7F2,
+    0xFCBB,
+    0xA40E,
+    0x12A4,
+    0x1A16,
+    0x2824,
+    0x212B,
+    0xA40B,
+    0xA4A4,
+    0xA4A4,
+    0xA4A4,
+    0xA4A4,
+    0x2EA4,
+    0xF7FB,
+    0xF9AA,
+    0xE795,
+    0x2000,
+    0xF7F2,
+    0xFF6C,
+    0xE791,
+    0x2000,
+    0xF7F4,
+    0xFEAA,
+    0xE78D,
+    0x2000,
+    0xF7F5,
+    0xF97C,
+    0xE789,
+    0x2000,
+    0xF7F3,
+    0xFF28,
+    0xE785,
+    0xF7FF,
+    0xFE6D,
+    0xE782,
+    0xF7FB,
+    0xFCD4,
+    0xE77F,
+    0x2000,
+    0xF7F7,
+    0xF872,
+    0xE77B,
+    0xF7F6,
+    0xF917,
+    0xE778,
+    0xF7F6,
+    0xF860,
+    0xE775,
+    0xF002,
+    0xF94F,
+    0xE772,
+    0x0200,
+    0x4203,
+    0xBF7E,
+    0xFFFF,
+    0x4004,
+    0x4200,
+    0x4094,
+    0x4200,
+    0x4000,
+    0x4200,
+    0x1000,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x408C,
+    0x4200,
+    0x4001,
+    0x4200,
+    0x4090,
+    0x4200,
+    0x6000,
+    0x4200,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0xB5F8,
+    0x2501,
+    0x0004,
+    0x2618,
+    0xF000,
+    0xFF10,
+    0x4F12,
+    0xF000,
+    0xFF0D,
+    0x4912,
+    0x4812,
+    0x698B,
+    0x883A,
+    0x4366,
+    0x1812,
+    0x0028,
+    0x1992,
+    0x7812,
+    0x4090,
+    0x4383,
+    0xB29B,
+    0x618B,
+    0xF000,
+    0xFF06,
+    0x883B,
+    0x480B,
+    0x181B,
+    0x199B,
+    0x781B,
+    0x0020,
+    0x409D,
+    0x4B09,
+    0x645D,
+    0xF7FF,
+    0xFA8F,
+    0x4B08,
+    0x781B,
+    0x429C,
+    0xD101,
+    0xF7FF,
+    0xFF1D,
+    0xF000,
+    0xFEF3,
+    0xBDF8,
+    0x021C,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0209,
+    0x4203,
+    0x0003,
+    0x2000,
+    0xB510,
+    0x4283,
+    0xD004,
+    0x4A03,
+    0x8810,
+    0x1818,
+    0xF7FF,
+    0xFAA4,
+    0xBD10,
+    0x46C0,
+    0x020E,
+    0x4203,
+    0x0003,
+    0xB510,
+    0x2000,
+    0x2B0F,
+    0xD81C,
+    0x4A0F,
+    0x7812,
+    0x4293,
+    0xD113,
+    0x4A0E,
+    0x8811,
+    0x2218,
+    0x4353,
+    0x4A0D,
+    0x1889,
+    0x185B,
+    0x781B,
+    0x2B25,
+    0xD106,
+    0xF002,
+    0xFA2B,
+    0x0001,
+    0x0008,
+    0xF7FF,
+    0xFFD9,
+    0xE007,
+    0xF002,
+    0xFBCC,
+    0xE7F7,
+    0x4A06,
+    0x2001,
+    0x7812,
+    0x4293,
+    0xD1F3,
+    0xBD10,
+    0x46C0,
+    0x0210,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x011F,
+    0x4203,
+    0xB510,
+    0x4B14,
+    0x7819,
+    0xB2CA,
+    0x3921,
+    0x2901,
+    0xD90C,
+    0x0010,
+    0x381C,
+    0xB2C0,
+    0x280A,
+    0xD80B,
+    0x490F,
+    0x40C1,
+    0x07C9,
+    0xD507,
+    0x2A26,
+    0xD109,
+    0x3A01,
+    0xE005,
+    0x2A21,
+    0xD102,
+    0xF7FF,
+    0xFDAC,
+    0xBD10,
+    0x2220,
+    0x701A,
+    0xE7FB,
+    0x2A1C,
+    0xD108,
+    0x4A07,
+    0x7811,
+    0x2900,
+    0xD004,
+    0x2300,
+    0x7013,
+    0xF7F3,
+    0xFEB2,
+    0xE7F0,
+    0x2215,
+    0xE7F0,
+    0x46C0,
+    0x0200,
+    0x4203,
+    0x0481,
+    0x0000,
+    0xC90E,
+    0x4203,
+    0xB5F7,
+    0x4F81,
+    0x0004,
+    0x883B,
+    0x4E80,
+    0xB29B,
+    0x9301,
+    0x2318,
+    0x4343,
+    0x9300,
+    0xF000,
+    0xFE6A,
+    0x4B7D,
+    0x781B,
+    0xB2DA,
+    0x3B15,
+    0xB2DB,
+    0x2B0E,
+    0xD808,
+    0x497B,
+    0x4119,
+    0x07C9,
+    0xD54D,
+    0x2A21,
+    0xD102,
+    0x7833,
+    0x429C,
+    0xD148,
+    0x4B77,
+    0x6F1B,
+    0xB2DB,
+    0x2B00,
+    0xD143,
+    0xF000,
+    0xFE5B,
+    0x4B72,
+    0x2000,
+    0x781D,
+    0x230F,
+    0x222E,
+    0x42A3,
+    0x4140,
+    0x4971,
+    0xB2C0,
+    0x32FF,
+    0xF7FC,
+    0xFE4B,
+    0x7833,
+    0xB2ED,
+    0x429C,
+    0xD058,
+    0x0020,
+    0xF7FF,
+    0xF9DC,
+    0x2D00,
+    0xD15E,
+    0x883B,
+    0x9A00,
+    0x189B,
+    0x4A6A,
+    0x189D,
+    0x4A6A,
+    0x0029,
+    0x189B,
+    0x781E,
+    0xB2F6,
+    0x0030,
+    0xF7FF,
+    0xFA33,
+    0x2800,
+    0xD000,
+    0xE08B,
+    0x2780,
+    0x4B65,
+    0x00FF,
+    0x67DF,
+    0x4B64,
+    0x701C,
+    0x4B64,
+    0x7018,
+    0x0030,
+    0x4B5B,
+    0x3810,
+    0x701E,
+    0x4E62,
+    0x2815,
+    0xD900,
+    0xE07A,
+    0xF7F2,
+    0xFB80,
+    0x7986,
+    0x8A79,
+    0x928E,
+    0x9A96,
+    0x799E,
+    0x797F,
+    0x7979,
+    0x7979,
+    0x79A2,
+    0x7979,
+    0xA679,
+    0x4B51,
+    0x781D,
+    0x7833,
+    0xB2ED,
+    0x429C,
+    0xD115,
+    0x2D1C,
+    0xD00D,
+    0xF7FE,
+    0xFEE7,
+    0x2D21,
+    0xD102,
+    0xF7FF,
+    0xFD21,
+    0xE7AC,
+    0x2D23,
+    0xD101,
+    0xF7FF,
+    0xFF58,
+    0xF7F3,
+    0xFE2E,
+    0xE7A5,
+    0x2201,
+    0x4B4F,
+    0x701A,
+    0xF000,
+    0xFDFE,
+    0xBDF7,
+    0xF7FE,
+    0xFFF7,
+    0xF7FE,
+    0xFED1,
+    0x2D21,
+    0xD0E9,
+    0x2D23,
+    0xD0EC,
+    0x2D1C,
+    0xD0EA,
+    0xE7EB,
+    0xF7F3,
+    0xFCC0,
+    0x2800,
+    0xD0A5,
+    0x4B3F,
+    0x9901,
+    0x469C,
+    0x9B00,
+    0x4461,
+    0x18C9,
+    0xE03D,
+    0x2D01,
+    0xD1F6,
+    0x4B3E,
+    0x781B,
+    0x429C,
+    0xD09A,
+    0x883B,
+    0x4A39,
+    0x189B,
+    0x9A00,
+    0x189B,
+    0x781B,
+    0x2200,
+    0x2B1A,
+    0xD124,
+    0x4B3B,
+    0x493C,
+    0x483C,
+    0x781B,
+    0x8809,
+    0x7800,
+    0x4D31,
+    0x4343,
+    0x483A,
+    0x185B,
+    0x493A,
+    0x195B,
+    0x781B,
+    0x8809,
+    0x7800,
+    0x4343,
+    0x185B,
+    0x1959,
+    0x7809,
+    0x2905,
+    0xD10F,
+    0x4936,
+    0x4836,
+    0x1859,
+    0x8809,
+    0x1809,
+    0x8808,
+    0x4935,
+    0xB280,
+    0x185B,
+    0x7819,
+    0x2303,
+    0x4019,
+    0x3101,
+    0xF7FE,
+    0xFEA8,
+    0x0002,
+    0x0020,
+    0xB291,
+    0xF7FF,
+    0xFED5,
+    0x2800,
+    0xD000,
+    0xE765,
+    0xE7BC,
+    0x6037,
+    0x0029,
+    0x0020,
+    0xF7FF,
+    0xFCD0,
+    0xE7A6,
+    0x0028,
+    0xF7FB,
+    0xF824,
+    0x6037,
+    0x2800,
+    0xD1A0,
+    0xE7F3,
+    0x0028,
+    0xF7F2,
+    0xFE2F,
+    0xE7F7,
+    0x0028,
+    0xF7F4,
+    0xFD45,
+    0xE7F3,
+    0x0028,
+    0xF7F5,
+    0xF8BF,
+    0xE7EF,
+    0x0028,
+    0xF7F3,
+    0xFC77,
+    0xE7EB,
+    0x0028,
+    0xF7F6,
+    0xFD87,
+    0xE7E7,
+    0x0028,
+    0xF7F5,
+    0xFECB,
+    0xE7E3,
+    0x0028,
+    0xF7F5,
+    0xFE5B,
+    0xE7DF,
+    0x0028,
+    0xF003,
+    0xF861,
+    0xE7DB,
+    0x0028,
+    0xF002,
+    0xF84B,
+    0xE7D7,
+    0x021C,
+    0x4203,
+    0x011F,
+    0x4203,
+    0x0200,
+    0x4203,
+    0xBF7E,
+    0xFFFF,
+    0x4000,
+    0x4200,
+    0x1DFC,
+    0x1003,
+    0x8000,
+    0x4203,
+    0x8009,
+    0x4203,
+    0xE104,
+    0xE000,
+    0x0209,
+    0x4203,
+    0x020A,
+    0x4203,
+    0xE100,
+    0xE000,
+    0xC90E,
+    0x4203,
+    0x0137,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x800E,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8002,
+    0x4203,
+    0xB510,
+    0x2800,
+    0xD00A,
+    0xF7F3,
+    0xFC23,
+    0x2800,
+    0xD005,
+    0x2200,
+    0x4B12,
+    0x701A,
+    0x4B12,
+    0x321C,
+    0x701A,
+    0xBD10,
+    0x4C10,
+    0x7823,
+    0xB2D8,
+    0x2B00,
+    0xD107,
+    0x4B0F,
+    0x781B,
+    0x2BFF,
+    0xD003,
+    0x490E,
+    0x4A0E,
+    0xF7FC,
+    0xFD31,
+    0xF7F3,
+    0xFC0B,
+    0x2323,
+    0x2800,
+    0xD103,
+    0x7823,
+    0x2B20,
+    0xD102,
+    0x3302,
+    0x7023,
+    0xE7E6,
+    0x7823,
+    0x2B25,
+    0xD101,
+    0x3301,
+    0xE7F8,
+    0x2321,
+    0xE7F6,
+    0x46C0,
+    0xC90E,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x1DFC,
+    0x1003,
+    0x0456,
+    0x0000,
+    0xB5F8,
+    0x4B1F,
+    0x781B,
+    0xB2DF,
+    0x2BFF,
+    0xD037,
+    0x4B1D,
+    0x781B,
+    0x2B00,
+    0xD133,
+    0x2418,
+    0x4D1C,
+    0x4E1C,
+    0xF000,
+    0xFD01,
+    0x69AB,
+    0x491B,
+    0x8832,
+    0x437C,
+    0x1852,
+    0x2101,
+    0x1912,
+    0x7812,
+    0x4091,
+    0x438B,
+    0xB29B,
+    0x61AB,
+    0xF000,
+    0xFCFB,
+    0x8830,
+    0x4B15,
+    0x18C0,
+    0x1900,
+    0xF7F3,
+    0xFC2D,
+    0x2800,
+    0xD009,
+    0x2101,
+    0x4B12,
+    0x4A13,
+    0x701F,
+    0x7813,
+    0x438B,
+    0x7013,
+    0x2215,
+    0x4B11,
+    0x701A,
+    0xF000,
+    0xFCDF,
+    0x69AB,
+    0x490A,
+    0x8832,
+    0xB29B,
+    0x1852,
+    0x1912,
+    0x7811,
+    0x2201,
+    0x408A,
+    0x4313,
+    0x61AB,
+    0xF000,
+    0xFCDA,
+    0xBDF8,
+    0x46C0,
+    0x011F,
+    0x4203,
+    0x0208,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x0107,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x7802,
+    0x7841,
+    0x2300,
+    0xB082,
+    0xB2D2,
+    0x0789,
+    0xD501,
+    0x8843,
+    0xB29B,
+    0xA901,
+    0x708A,
+    0x8848,
+    0x0400,
+    0x4318,
+    0xB002,
+    0x4770,
+    0xB51F,
+    0x9001,
+    0x2018,
+    0x4B0B,
+    0x4348,
+    0x4A0B,
+    0x881B,
+    0xAC01,
+    0x189B,
+    0x18C0,
+    0xF7FF,
+    0xFFE4,
+    0x8821,
+    0x0C03,
+    0x78A2,
+    0xB280,
+    0xB2DB,
+    0x4288,
+    0x4180,
+    0x429A,
+    0xD001,
+    0x4293,
+    0x4180,
+    0x4240,
+    0xB004,
+    0xBD10,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0xF000,
+    0xFC8D,
+    0x22FF,
+    0x4B06,
+    0x701A,
+    0x2200,
+    0x4B06,
+    0x701A,
+    0x4B06,
+    0x7819,
+    0x2902,
+    0xD000,
+    0x701A,
+    0xF000,
+    0xFC88,
+    0xBD10,
+    0x46C0,
+    0x0209,
+    0x4203,
+    0x020A,
+    0x4203,
+    0x0200,
+    0x4203,
+    0xB570,
+    0x2400,
+    0x0005,
+    0xF000,
+    0xFC73,
+    0x4B07,
+    0x781A,
+    0x42A2,
+    0xD106,
+    0x21FF,
+    0x4A05,
+    0x7011,
+    0x4A05,
+    0x7014,
+    0x701D,
+    0x3401,
+    0xF000,
+    0xFC6E,
+    0x0020,
+    0xBD70,
+    0x0200,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x020A,
+    0x4203,
+    0xB510,
+    0x4A06,
+    0x4B06,
+    0x4907,
+    0x781B,
+    0x7810,
+    0x223A,
+    0x1AC0,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0xF7FC,
+    0xFC55,
+    0xBD10,
+    0x0210,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x1E0D,
+    0x1003,
+    0xB510,
+    0xF000,
+    0xFC47,
+    0x4A08,
+    0x8813,
+    0xB29C,
+    0x2B00,
+    0xD006,
+    0x4B06,
+    0x18E3,
+    0x881B,
+    0xB29B,
+    0x8013,
+    0x4B05,
+    0x18E4,
+    0xF000,
+    0xFC41,
+    0x0020,
+    0xBD10,
+    0x46C0,
+    0x021A,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF000,
+    0xFC2C,
+    0x4A05,
+    0x8813,
+    0xB29B,
+    0x8123,
+    0x4B04,
+    0x18E4,
+    0xB2A4,
+    0x8014,
+    0xF000,
+    0xFC2A,
+    0xBD10,
+    0x46C0,
+    0x021A,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0x4B06,
+    0x4A07,
+    0x1899,
+    0x880A,
+    0xB293,
+    0x2A00,
+    0xD1F9,
+    0x4A05,
+    0x1882,
+    0xB292,
+    0x800A,
+    0x8103,
+    0x4770,
+    0x46C0,
+    0x820C,
+    0xFFFF,
+    0x8008,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0xB510,
+    0xF000,
+    0xFC05,
+    0x4A08,
+    0x8813,
+    0xB29C,
+    0x2B00,
+    0xD006,
+    0x4B06,
+    0x18E3,
+    0x881B,
+    0xB29B,
+    0x8013,
+    0x4B05,
+    0x18E4,
+    0xF000,
+    0xFBFF,
+    0x0020,
+    0xBD10,
+    0x46C0,
+    0x0214,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF000,
+    0xFBEA,
+    0x2C00,
+    0xD007,
+    0x4A05,
+    0x8813,
+    0xB29B,
+    0x8123,
+    0x4B04,
+    0x18E4,
+    0xB2A4,
+    0x8014,
+    0xF000,
+    0xFBE6,
+    0xBD10,
+    0x46C0,
+    0x0214,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0x4B02,
+    0x8818,
+    0x1E43,
+    0x4198,
+    0xB2C0,
+    0x4770,
+    0x0214,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xFF6E,
+    0xF000,
+    0xFBCA,
+    0x2300,
+    0x8123,
+    0x4B03,
+    0x18E4,
+    0x4B03,
+    0xB2A4,
+    0x801C,
+    0xF000,
+    0xFBC9,
+    0xBD10,
+    0x8000,
+    0xFFFF,
+    0x0216,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFF5B,
+    0xF000,
+    0xFBB7,
+    0x4A08,
+    0x8813,
+    0xB29C,
+    0x2B00,
+    0xD006,
+    0x4B06,
+    0x18E3,
+    0x881B,
+    0xB29B,
+    0x8013,
+    0x4B05,
+    0x18E4,
+    0xF000,
+    0xFBB1,
+    0x0020,
+    0xBD10,
+    0x46C0,
+    0x0216,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0003,
+    0xB5F7,
+    0x2818,
+    0xD811,
+    0x2002,
+    0x2B0F,
+    0xD919,
+    0x3B10,
+    0x0018,
+    0x2B08,
+    0xD80F,
+    0xF7F2,
+    0xF90B,
+    0x0010,
+    0x0015,
+    0x0073,
+    0x008F,
+    0x00D7,
+    0x00EB,
+    0x000E,
+    0x00FE,
+    0x0101,
+    0x2850,
+    0xD100,
+    0xE0FC,
+    0x28FE,
+    0xD062,
+    0x2002,
+    0xE003,
+    0xF7FE,
+    0xFA51,
+    0x4243,
+    0x4158,
+    0xBDFE,
+    0x4B7D,
+    0x781D,
+    0x4B7D,
+    0xB2ED,
+    0x681B,
+    0x0028,
+    0x9301,
+    0xF7FE,
+    0xFE65,
+    0x2800,
+    0xD101,
+    0x2001,
+    0xE7F1,
+    0x2618,
+    0x2102,
+    0x436E,
+    0x4F77,
+    0x4B78,
+    0x883C,
+    0x19A4,
+    0x18E2,
+    0x7813,
+    0x438B,
+    0x7013,
+    0x2200,
+    0x4B75,
+    0x18E3,
+    0x801A,
+    0x4B74,
+    0x18E3,
+    0x9300,
+    0x781B,
+    0x2BFF,
+    0xD105,
+    0xF7FE,
+    0xFE38,
+    0x28FF,
+    0xD0E4,
+    0x9B00,
+    0x7018,
+    0x883B,
+    0x4A6E,
+    0x189B,
+    0x2201,
+    0x199B,
+    0x781B,
+    0x409A,
+    0x4B6C,
+    0x645A,
+    0x4B6C,
+    0x18E3,
+    0x781A,
+    0xB2D3,
+    0x2A24,
+    0xD024,
+    0x2B16,
+    0xD022,
+    0x2B1A,
+    0xD116,
+    0x4B68,
+    0x18E0,
+    0xF7FF,
+    0xF8FF,
+    0x4B67,
+    0x701D,
+    0xF000,
+    0xFB3B,
+    0x4966,
+    0x4860,
+    0x698B,
+    0x883A,
+    0xB29B,
+    0x1812,
+    0x2001,
+    0x1992,
+    0x7812,
+    0x4090,
+    0x4303,
+    0x618B,
+    0xF000,
+    0xFB35,
+    0xE009,
+    0x2B15,
+    0xD103,
+    0x4B5E,
+    0x701D,
+    0xF7F3,
+    0xF9F4,
+    0x0028,
+    0x9901,
+    0xF000,
+    0xFA76,
+    0x2000,
+    0xE7A0,
+    0x4B4E,
+    0x781C,
+    0xB2E4,
+    0x0020,
+    0xF7FF,
+    0xFC04,
+    0x0020,
+    0xF7FE,
+    0xFE27,
+    0x4B55,
+    0x781A,
+    0x42A2,
+    0xD101,
+    0x22FF,
+    0x701A,
+    0x4B49,
+    0x4A4D,
+    0x881B,
+    0x189B,
+    0x2218,
+    0x4362,
+    0x189B,
+    0x781B,
+    0x2B1A,
+    0xD1E4,
+    0xF7FA,
+    0xFA75,
+    0xE7E1,
+    0x4B40,
+    0x781D,
+    0xF000,
+    0xFB00,
+    0x2007,
+    0x4A4A,
+    0xB2ED,
+    0x6813,
+    0x4003,
+    0x2B03,
+    0xD12F,
+    0x2101,
+    0x4C47,
+    0x6FE3,
+    0x430B,
+    0x67E3,
+    0x6813,
+    0x4003,
+    0x2B03,
+    0xD122,
+    0x6813,
+    0x0A1B,
+    0x4003,
+    0x4099,
+    0x420D,
+    0xD01C,
+    0x6B11,
+    0x070B,
+    0xD519,
+    0x2504,
+    0x4B3F,
+    0x601D,
+    0x4B36,
+    0x6D9B,
+    0x6293,
+    0x6211,
+    0x4001,
+    0x1E48,
+    0x2300,
+    0x2805,
+    0xD807,
+    0xF7F2,
+    0xF83D,
+    0x1703,
+    0x1919,
+    0x1B19,
+    0x4B38,
+    0x781B,
+    0xB2DB,
+    0x62D3,
+    0x4B37,
+    0xB2C9,
+    0x77D9,
+    0x2301,
+    0x61D3,
+    0x2201,
+    0x6FE3,
+    0x4393,
+    0x67E3,
+    0x2301,
+    0x4933,
+    0x780A,
+    0x439A,
+    0x4313,
+    0x700B,
+    0xE792,
+    0x4B31,
+    0xE7EA,
+    0x4B31,
+    0xE7E8,
+    0x4B31,
+    0xE7E6,
+    0xF000,
+    0xFABA,
+    0x4B21,
+    0x4A30,
+    0x6C9B,
+    0x4C30,
+    0xB29B,
+    0x6013,
+    0x2308,
+    0x2224,
+    0x6163,
+    0x482E,
+    0x492E,
+    0xF003,
+    0xFEB7,
+    0x2304,
+    0x69A2,
+    0x421A,
+    0xD1FC,
+    0xE778,
+    0xF000,
+    0xFAA6,
+    0x2310,
+    0x4C27,
+    0x2224,
+    0x6163,
+    0x4926,
+    0x4827,
+    0xF003,
+    0xFEA8,
+    0x2304,
+    0x69A2,
+    0x421A,
+    0xD1FC,
+    0x4B20,
+    0x681A,
+    0x4B10,
+    0x641A,
+    0xE765,
+    0xF7FE,
+    0xFD59,
+    0xE76F,
+    0xF000,
+    0xFA90,
+    0x4B1F,
+    0x7818,
+    0xB2C0,
+    0xF7FE,
+    0xFCC1,
+    0xE75A,
+    0x4B1D,
+    0x781B,
+    0x2B00,
+    0xD000,
+    0xE762,
+    0xF000,
+    0xFA3F,
+    0xE75F,
+    0x8224,
+    0x4203,
+    0x8228,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x8010,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x8009,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0166,
+    0x4203,
+    0x1000,
+    0x4200,
+    0x011F,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x4004,
+    0x4200,
+    0x408C,
+    0x4200,
+    0x0260,
+    0x4203,
+    0x4001,
+    0x4200,
+    0x021E,
+    0x4203,
+    0x0262,
+    0x4203,
+    0x0261,
+    0x4203,
+    0x0263,
+    0x4203,
+    0xC934,
+    0x4203,
+    0x3000,
+    0x4200,
+    0xC90F,
+    0x4203,
+    0x509C,
+    0x4201,
+    0x021F,
+    0x4203,
+    0x0208,
+    0x4203,
+    0x4B13,
+    0xB570,
+    0x6FDB,
+    0x06DB,
+    0xD51E,
+    0x2310,
+    0x2400,
+    0x4D11,
+    0x626B,
+    0x4B11,
+    0x781E,
+    0x701C,
+    0xB2F6,
+    0x4A10,
+    0x00A3,
+    0x0030,
+    0x58D3,
+    0x4798,
+    0x2800,
+    0xD104,
+    0x4B0D,
+    0x801E,
+    0x2310,
+    0x602B,
+    0xE00A,
+    0x2801,
+    0xD103,
+    0x2200,
+    0x4B09,
+    0x801A,
+    0xE7F6,
+    0x3401,
+    0x2C05,
+    0xD1EA,
+    0x2802,
+    0xD0F6,
+    0x2200,
+    0x4B06,
+    0x609A,
+    0xBD70,
+    0x1008,
+    0x4200,
+    0x4000,
+    0x4201,
+    0x8220,
+    0x4203,
+    0xCA68,
+    0x4203,
+    0x8222,
+    0x4203,
+    0x2000,
+    0x4200,
+    0x4684,
+    0x4820,
+    0xB5F0,
+    0x8804,
+    0xB2A0,
+    0x2C00,
+    0xD022,
+    0x4D1E,
+    0x782C,
+    0x2C00,
+    0xD01E,
+    0x2CFF,
+    0xD001,
+    0x3C01,
+    0x702C,
+    0x4C1B,
+    0x1900,
+    0x7844,
+    0x78C5,
+    0x7806,
+    0x2C00,
+    0xD108,
+    0x2BFC,
+    0xD818,
+    0x2603,
+    0x0034,
+    0x4663,
+    0x701E,
+    0x700C,
+    0x7015,
+    0xE00B,
+    0x27FF,
+    0x1B3F,
+    0x429F,
+    0xDA16,
+    0x2CFF,
+    0xD10D,
+    0x2EFF,
+    0xD004,
+    0x7883,
+    0x3301,
+    0x7083,
+    0x2000,
+    0xBDF0,
+    0x2403,
+    0x3501,
+    0xB2ED,
+    0x1B37,
+    0xE00B,
+    0x70C4,
+    0xE7F3,
+    0x2700,
+    0x5507,
+    0x42B4,
+    0xD1EF,
+    0x2403,
+    0x3501,
+    0xB2ED,
+    0x43E7,
+    0x42B4,
+    0xD3F1,
+    0xB2FF,
+    0x429F,
+    0xD2D9,
+    0xE7E5,
+    0x46C0,
+    0x0130,
+    0x4203,
+    0xCA7C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F7,
+    0x466B,
+    0x2400,
+    0x0006,
+    0x1D9D,
+    0x715C,
+    0x71DC,
+    0x702C,
+    0x5D33,
+    0x2B00,
+    0xD123,
+    0xF000,
+    0xF9C3,
+    0x4669,
+    0x4668,
+    0x1CE3,
+    0x002A,
+    0xB2DB,
+    0x3105,
+    0x3007,
+    0xF7FF,
+    0xFFA2,
+    0x1E05,
+    0xD013,
+    0x2C00,
+    0xD011,
+    0x466B,
+    0x2202,
+    0x795B,
+    0x3401,
+    0x54C2,
+    0x189F,
+    0x3301,
+    0xB2E4,
+    0xB2FF,
+    0xB2DB,
+    0x54C4,
+    0x0022,
+    0x19C0,
+    0x0031,
+    0x193F,
+    0xF003,
+    0xFDAF,
+    0x706F,
+    0xF000,
+    0xF9AA,
+    0xBDF7,
+    0x3401,
+    0xB2E4,
+    0xE7D5,
+    0xB5F0,
+    0x2400,
+    0x000E,
+    0xB085,
+    0xAB02,
+    0x1D9D,
+    0x9001,
+    0x715C,
+    0x71DC,
+    0x702C,
+    0x9B01,
+    0x5D1B,
+    0x2B00,
+    0xD136,
+    0xF000,
+    0xF98E,
+    0x1DE3,
+    0xA902,
+    0xA802,
+    0x002A,
+    0xB2DB,
+    0x3105,
+    0x3007,
+    0xF7FF,
+    0xFF6D,
+    0x1E05,
+    0xD025,
+    0x2C00,
+    0xD023,
+    0x2204,
+    0x1C63,
+    0xB2DB,
+    0x9300,
+    0xAB02,
+    0x795B,
+    0x3405,
+    0x54C2,
+    0x1C9F,
+    0x3301,
+    0xB2DB,
+    0xB2FF,
+    0x54C4,
+    0x9A00,
+    0x9901,
+    0x19C0,
+    0xF003,
+    0xFD79,
+    0x9B00,
+    0x0A31,
+    0x18FB,
+    0xB2DB,
+    0x1C5A,
+    0xB2D2,
+    0x54EE,
+    0x54A9,
+    0x1C9A,
+    0xB2D2,
+    0x0C31,
+    0x54A9,
+    0x1CDA,
+    0xB2D2,
+    0x0E36,
+    0x3304,
+    0x54AE,
+    0x706B,
+    0xF000,
+    0xF963,
+    0xB005,
+    0xBDF0,
+    0x3401,
+    0xB2E4,
+    0xE7C1,
+    0xB5F8,
+    0x000D,
+    0x4B20,
+    0x0004,
+    0x881E,
+    0x4B20,
+    0x18F6,
+    0x4B20,
+    0x7818,
+    0xB2C0,
+    0x2800,
+    0xD12E,
+    0x2219,
+    0x491E,
+    0xF7FC,
+    0xF94A,
+    0x4B1D,
+    0xB2AD,
+    0x18ED,
+    0x0028,
+    0x1E43,
+    0x4198,
+    0x4F19,
+    0x221D,
+    0x0039,
+    0xB2C0,
+    0xF7FC,
+    0xF93E,
+    0x4B17,
+    0xB2AD,
+    0x8035,
+    0x18F5,
+    0x4B16,
+    0xB2AD,
+    0x18E8,
+    0x1E43,
+    0x4198,
+    0x0039,
+    0xB2C0,
+    0x2223,
+    0xF7FC,
+    0xF930,
+    0x8823,
+    0xB29B,
+    0x8073,
+    0xF000,
+    0xF927,
+    0x4B10,
+    0x8025,
+    0x18E4,
+    0x2301,
+    0x0864,
+    0xB2A4,
+    0x40A3,
+    0x4A0D,
+    0x6093,
+    0xF000,
+    0xF924,
+    0xBDF8,
+    0x8833,
+    0x2B00,
+    0xD102,
+    0x8873,
+    0x2B00,
+    0xD0CE,
+    0x3604,
+    0x3801,
+    0xE7C5,
+    0x0226,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0228,
+    0x4203,
+    0x1E22,
+    0x1003,
+    0x8000,
+    0xFFFF,
+    0x0001,
+    0xFFFF,
+    0xFDD6,
+    0xBDFC,
+    0x4000,
+    0x4201,
+    0x0003,
+    0x1A08,
+    0x428B,
+    0xD901,
+    0x3901,
+    0x1AC8,
+    0x4770,
+    0x0000,
+    0x4B08,
+    0xB570,
+    0x000D,
+    0x6D99,
+    0x0004,
+    0x1A43,
+    0xD507,
+    0xF7FF,
+    0xFFEF,
+    0x1964,
+    0x0029,
+    0x1824,
+    0xF7F1,
+    0xFEF4,
+    0x1A64,
+    0x0020,
+    0xBD70,
+    0x46C0,
+    0x9000,
+    0x4201,
+    0xB5F8,
+    0x2418,
+    0x4D0A,
+    0x4344,
+    0x882B,
+    0x4E0A,
+    0x4F0A,
+    0x199B,
+    0x191B,
+    0x781B,
+    0x19DB,
+    0x009B,
+    0x6818,
+    0x6849,
+    0xF7FF,
+    0xFFDC,
+    0x882B,
+    0x199B,
+    0x191B,
+    0x781B,
+    0x19DB,
+    0x009B,
+    0x6018,
+    0xBDF8,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB570,
+    0x2400,
+    0x2518,
+    0x0029,
+    0x4B08,
+    0x4361,
+    0x881B,
+    0x18C9,
+    0x4B07,
+    0x18CB,
+    0x781B,
+    0x2B03,
+    0xD104,
+    0x4B06,
+    0xB2E0,
+    0x18C9,
+    0xF7FF,
+    0xFFD0,
+    0x3401,
+    0x2C10,
+    0xD1ED,
+    0xBD70,
+    0x021C,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xB5F8,
+    0x2418,
+    0x4D29,
+    0x4344,
+    0x882A,
+    0x000B,
+    0x1910,
+    0x4A28,
+    0x4E28,
+    0x1882,
+    0x7811,
+    0x4A28,
+    0x1882,
+    0x2903,
+    0xD114,
+    0x6811,
+    0x0018,
+    0xF7FF,
+    0xFF9F,
+    0x882B,
+    0x4A24,
+    0x4925,
+    0x189B,
+    0x191B,
+    0x781B,
+    0x185B,
+    0x009B,
+    0x6018,
+    0x882B,
+    0x189B,
+    0x191B,
+    0x781A,
+    0x2301,
+    0x4093,
+    0x6573,
+    0xBDF8,
+    0x491E,
+    0x4F1C,
+    0x8809,
+    0x6812,
+    0x1A5B,
+    0x1A9B,
+    0x882A,
+    0x491A,
+    0x19D2,
+    0x1912,
+    0x7812,
+    0x1852,
+    0x0092,
+    0x6013,
+    0x4B18,
+    0x18C0,
+    0xF7FE,
+    0xFE36,
+    0x882B,
+    0x19DB,
+    0x2701,
+    0x003A,
+    0x191B,
+    0x781B,
+    0x409A,
+    0x6572,
+    0xF000,
+    0xF86C,
+    0x4912,
+    0x480E,
+    0x698B,
+    0x882A,
+    0xB29B,
+    0x1812,
+    0x0038,
+    0x1912,
+    0x7812,
+    0x4090,
+    0x4303,
+    0x618B,
+    0xF000,
+    0xF866,
+    0x882B,
+    0x4807,
+    0x181B,
+    0x191B,
+    0x781B,
+    0x409F,
+    0x6437,
+    0xE7CC,
+    0x021C,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x8004,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x1000,
+    0x4200,
+    0xB510,
+    0xF000,
+    0xF841,
+    0x2201,
+    0x4B05,
+    0x701A,
+    0x4B05,
+    0x781B,
+    0x2B00,
+    0xD001,
+    0xF7FE,
+    0xFCC6,
+    0xF000,
+    0xF83E,
+    0xBD10,
+    0x46C0,
+    0x0208,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x2103,
+    0xB530,
+    0x253C,
+    0x4B15,
+    0x6842,
+    0x601A,
+    0x7802,
+    0x619A,
+    0x6902,
+    0x605A,
+    0x6942,
+    0x611A,
+    0x78C2,
+    0x61DA,
+    0x6882,
+    0x60DA,
+    0x6A1C,
+    0x7842,
+    0x438C,
+    0x400A,
+    0x4322,
+    0x621A,
+    0x6982,
+    0x615A,
+    0x68C2,
+    0x609A,
+    0x7882,
+    0x6A1C,
+    0x0052,
+    0x43AC,
+    0x402A,
+    0x4322,
+    0x621A,
+    0x6ADA,
+    0x438A,
+    0x62DA,
+    0x6ADA,
+    0x3101,
+    0x438A,
+    0x62DA,
+    0x2202,
+    0x631A,
+    0x3A01,
+    0x631A,
+    0xBD30,
+    0x46C0,
+    0x0000,
+    0x4201,
+    0xB672,
+    0x4A02,
+    0x8813,
+    0x3301,
+    0x8013,
+    0x4770,
+    0xC938,
+    0x4203,
+    0x4A04,
+    0x8813,
+    0x3B01,
+    0xB29B,
+    0x8013,
+    0x2B00,
+    0xD100,
+    0xB662,
+    0x4770,
+    0x46C0,
+    0xC938,
+    0x4203,
+    0x0003,
+    0x2201,
+    0x4010,
+    0x4213,
+    0xD003,
+    0x2000,
+    0xE005,
+    0x4213,
+    0xD103,
+    0x3001,
+    0x085B,
+    0x2820,
+    0xD1F9,
+    0x4770,
+    0x2304,
+    0x4A08,
+    0xB510,
+    0x6911,
+    0x4807,
+    0x430B,
+    0x6113,
+    0xF7F1,
+    0xFD15,
+    0x2800,
+    0xD100,
+    0xBF30,
+    0x2104,
+    0x4A02,
+    0x6913,
+    0x438B,
+    0x6113,
+    0xBD10,
+    0xED00,
+    0xE000,
+    0xC940,
+    0x4203,
+    0xB5F8,
+    0xF7FC,
+    0xFCC9,
+    0x4B0D,
+    0x4A0D,
+    0x681B,
+    0x4293,
+    0xD123,
+    0x4B0C,
+    0x4A0D,
+    0x609A,
+    0xF7FC,
+    0xFC05,
+    0x2380,
+    0x4A0B,
+    0x021B,
+    0x6A51,
+    0x430B,
+    0x2184,
+    0x6253,
+    0x2301,
+    0x4A09,
+    0x05C9,
+    0x508B,
+    0x4A08,
+    0x6013,
+    0xF7FC,
+    0xF944,
+    0xE7FE,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0xBABE,
+    0xB105,
+    0x8000,
+    0x4200,
+    0xFC00,
+    0x1080,
+    0xB000,
+    0x4200,
+    0x0808,
+    0x0000,
+    0x1000,
+    0x4200,
+    0x2002,
+    0x4BF8,
+    0x2504,
+    0x4AF8,
+    0x2400,
+    0x6058,
+    0x2703,
+    0x609A,
+    0x220C,
+    0x210A,
+    0x615D,
+    0x4BF5,
+    0x4EF5,
+    0x601C,
+    0x605C,
+    0x721C,
+    0x60DC,
+    0x741F,
+    0x745A,
+    0x749F,
+    0x74DA,
+    0x3214,
+    0x751C,
+    0x4694,
+    0x761A,
+    0x3240,
+    0x765A,
+    0x3A57,
+    0x769A,
+    0x4AEE,
+    0x61DC,
+    0x621C,
+    0x625C,
+    0x629C,
+    0x62DC,
+    0x631C,
+    0x635C,
+    0x639C,
+    0x63DC,
+    0x641C,
+    0x7011,
+    0x4AE9,
+    0x211E,
+    0x649A,
+    0x4AE8,
+    0x64DA,
+    0x4AE8,
+    0x651C,
+    0x655C,
+    0x659C,
+    0x4BE7,
+    0x7014,
+    0x8054,
+    0x6054,
+    0x701C,
+    0x705C,
+    0x805C,
+    0x809C,
+    0x88DF,
+    0x80DC,
+    0x8877,
+    0x8074,
+    0x88B7,
+    0x80B4,
+    0x88F7,
+    0x80F4,
+    0x741C,
+    0x4EE0,
+    0x745C,
+    0x825C,
+    0x829C,
+    0x8ADF,
+    0x82DC,
+    0x8877,
+    0x8074,
+    0x88B7,
+    0x80B4,
+    0x88F7,
+    0x80F4,
+    0x4EDB,
+    0x77F4,
+    0x4EDB,
+    0x77F4,
+    0x4EDB,
+    0x845C,
+    0x849C,
+    0x8CDF,
+    0x84DC,
+    0x8877,
+    0x8074,
+    0x88B7,
+    0x80B4,
+    0x88F7,
+    0x2701,
+    0x80F4,
+    0x4ED6,
+    0x7034,
+    0x4ED6,
+    0x631C,
+    0x635C,
+    0x639C,
+    0x7034,
+    0x4ED4,
+    0x7034,
+    0x4ED4,
+    0x7034,
+    0x4ED4,
+    0x7037,
+    0x4ED4,
+    0x7034,
+    0x4ED4,
+    0x7031,
+    0x4ED4,
+    0x19C9,
+    0x7034,
+    0x4ED4,
+    0x370E,
+    0x7034,
+    0x4ED3,
+    0x7031,
+    0x2106,
+    0x4ED3,
+    0x7034,
+    0x4ED3,
+    0x8034,
+    0x4ED3,
+    0x7034,
+    0x4ED3,
+    0x7037,
+    0x4ED3,
+    0x3F0C,
+    0x7037,
+    0x4ED2,
+    0x7031,
+    0x4ED2,
+    0x3109,
+    0x7031,
+    0x4ED2,
+    0x31EC,
+    0x7031,
+    0x4ED1,
+    0x39BC,
+    0x7031,
+    0x4ED1,
+    0x3940,
+    0x7034,
+    0x4ED0,
+    0x8031,
+    0x4ED0,
+    0x310B,
+    0x7034,
+    0x4ED0,
+    0x7034,
+    0x4ED0,
+    0x7034,
+    0x4ED0,
+    0x7034,
+    0x659C,
+    0x65DC,
+    0x4BCF,
+    0x4ECF,
+    0x701C,
+    0x4BCF,
+    0x701C,
+    0x4BCF,
+    0x701C,
+    0x4BCF,
+    0x701C,
+    0x705C,
+    0x709C,
+    0x70DC,
+    0x711C,
+    0x715C,
+    0x719C,
+    0x71DC,
+    0x721C,
+    0x725C,
+    0x815C,
+    0x819C,
+    0x81DC,
+    0x821E,
+    0x749C,
+    0x74DD,
+    0x3D03,
+    0x829C,
+    0x761D,
+    0x7658,
+    0x7699,
+    0x318C,
+    0x76D9,
+    0x30A8,
+    0x3941,
+    0x7719,
+    0x7758,
+    0x386E,
+    0x7798,
+    0x48C1,
+    0x35FE,
+    0x77DD,
+    0x621C,
+    0x625C,
+    0x7004,
+    0x48BF,
+    0x4665,
+    0x7004,
+    0x48BF,
+    0x4EBF,
+    0x7004,
+    0x48BF,
+    0x7004,
+    0x48BF,
+    0x7001,
+    0x48BF,
+    0x7001,
+    0x48BF,
+    0x7001,
+    0x2038,
+    0x49BF,
+    0x700F,
+    0x49BF,
+    0x861C,
+    0x8659,
+    0x49BE,
+    0x377D,
+    0x7008,
+    0x2121,
+    0x48BD,
+    0x7001,
+    0x48BD,
+    0x7004,
+    0x48BD,
+    0x7004,
+    0x48BD,
+    0x7004,
+    0x48BD,
+    0x7004,
+    0x48BD,
+    0x7004,
+    0x48BD,
+    0x7004,
+    0x48BD,
+    0x63D8,
+    0x48BD,
+    0x6418,
+    0x48BD,
+    0x6458,
+    0x48BD,
+    0x6498,
+    0x48BD,
+    0x64D8,
+    0x48BD,
+    0x6518,
+    0x48BD,
+    0x6558,
+    0x48BD,
+    0x6598,
+    0x48BD,
+    0x65D8,
+    0x48BD,
+    0x6618,
+    0x4BBD,
+    0x48BE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x801C,
+    0x4BBE,
+    0x701C,
+    0x4BBE,
+    0x701C,
+    0x705C,
+    0x805C,
+    0x711C,
+    0x715C,
+    0x719C,
+    0x71DC,
+    0x721C,
+    0x725C,
+    0x815C,
+    0x731C,
+    0x735C,
+    0x741C,
+    0x745C,
+    0x749C,
+    0x74DC,
+    0x751C,
+    0x755C,
+    0x759C,
+    0x831C,
+    0x835C,
+    0x771C,
+    0x775C,
+    0x77C4,
+    0x48B2,
+    0x77C4,
+    0x48B2,
+    0x77C4,
+    0x48B2,
+    0x77C4,
+    0x48B2,
+    0x77C4,
+    0x48B2,
+    0x77C4,
+    0x48B2,
+    0x77C4,
+    0x48B2,
+    0x851C,
+    0x7004,
+    0x48B2,
+    0x7004,
+    0x48B2,
+    0x7005,
+    0x48B2,
+    0x3D18,
+    0x7004,
+    0x48B1,
+    0x7007,
+    0x48B1,
+    0x7001,
+    0x48B1,
+    0x7005,
+    0x48B1,
+    0x35B0,
+    0x7005,
+    0x48B1,
+    0x4DB1,
+    0x7001,
+    0x49B1,
+    0x48B2,
+    0x700C,
+    0x21FF,
+    0x871C,
+    0x4BB1,
+    0x701C,
+    0x4BB1,
+    0x701C,
+    0x4BB1,
+    0x701C,
+    0x4BB1,
+    0x701C,
+    0x4BB1,
+    0x701C,
+    0x605C,
+    0x721C,
+    0x7259,
+    0x729C,
+    0x8198,
+    0x20AF,
+    0x0040,
+    0x81D8,
+    0x20E0,
+    0x00C0,
+    0x741C,
+    0x745C,
+    0x749C,
+    0x74DC,
+    0x829C,
+    0x82DC,
+    0x831C,
+    0x835C,
+    0x8398,
+    0x48A7,
+    0x779C,
+    0x77DC,
+    0x77C4,
+    0x48A6,
+    0x77C4,
+    0x48A6,
+    0x77C4,
+    0x48A6,
+    0x77C4,
+    0x77EC,
+    0x48A6,
+    0x4DA6,
+    0x77EC,
+    0x84DC,
+    0x7004,
+    0x48A5,
+    0x855C,
+    0x859C,
+    0x85DC,
+    0x861C,
+    0x865C,
+    0x869C,
+    0x86DC,
+    0x871C,
+    0x875C,
+    0x879C,
+    0x87DC,
+    0x7004,
+    0x489C,
+    0x87C4,
+    0x2023,
+    0x87EC,
+    0x4D9E,
+    0x87F4,
+    0x7028,
+    0x4D9D,
+    0x301D,
+    0x64DD,
+    0x4D9D,
+    0x7028,
+    0x4D9D,
+    0x30DA,
+    0x8028,
+    0x4D9C,
+    0x38BA,
+    0x8028,
+    0x4D9C,
+    0x382D,
+    0x8028,
+    0x4D9B,
+    0x489C,
+    0x8028,
+    0x20F2,
+    0x4D9B,
+    0x30FF,
+    0x8028,
+    0x4D9B,
+    0x38F1,
+    0x38FF,
+    0x7028,
+    0x4D9A,
+    0x30EF,
+    0x7028,
+    0x4D99,
+    0x3864,
+    0x661D,
+    0x4D99,
+    0x7028,
+    0x4D99,
+    0x387C,
+    0x7028,
+    0x4D98,
+    0x3019,
+    0x702C,
+    0x4D98,
+    0x7028,
+    0x257F,
+    0x4897,
+    0x7005,
+    0x4897,
+    0x7007,
+    0x2098,
+    0x4F97,
+    0x703C,
+    0x4F97,
+    0x7038,
+    0x4F97,
+    0x4897,
+    0x8038,
+    0xE12E,
+    0x46C0,
+    0x3000,
+    0x4200,
+    0x1FFF,
+    0x0000,
+    0x0000,
+    0x4203,
+    0x0086,
+    0x4203,
+    0x0044,
+    0x4203,
+    0x0000,
+    0x03FF,
+    0x0974,
+    0x099C,
+    0x8220,
+    0x4203,
+    0x0080,
+    0x4203,
+    0x0096,
+    0x4203,
+    0x0081,
+    0x4203,
+    0x0082,
+    0x4203,
+    0x00A6,
+    0x4203,
+    0x00AE,
+    0x4203,
+    0x00BC,
+    0x4203,
+    0x00BD,
+    0x4203,
+    0x00BE,
+    0x4203,
+    0x00BF,
+    0x4203,
+    0x00C0,
+    0x4203,
+    0x00C1,
+    0x4203,
+    0x00C2,
+    0x4203,
+    0x00C4,
+    0x4203,
+    0x00C5,
+    0x4203,
+    0x00C6,
+    0x4203,
+    0x00C8,
+    0x4203,
+    0x00CA,
+    0x4203,
+    0x00CB,
+    0x4203,
+    0x00CC,
+    0x4203,
+    0x00CD,
+    0x4203,
+    0x00CE,
+    0x4203,
+    0x00CF,
+    0x4203,
+    0x00D0,
+    0x4203,
+    0x00D1,
+    0x4203,
+    0x00D2,
+    0x4203,
+    0x00D4,
+    0x4203,
+    0x00D5,
+    0x4203,
+    0x00D6,
+    0x4203,
+    0x00D7,
+    0x4203,
+    0x00E0,
+    0x4203,
+    0x10F8,
+    0x0000,
+    0x00E1,
+    0x4203,
+    0x00E2,
+    0x4203,
+    0x0100,
+    0x4203,
+    0x0128,
+    0x4203,
+    0x0129,
+    0x4203,
+    0x012A,
+    0x4203,
+    0x0208,
+    0x4203,
+    0x012B,
+    0x4203,
+    0x012C,
+    0x4203,
+    0x012D,
+    0x4203,
+    0x012E,
+    0x4203,
+    0x012F,
+    0x4203,
+    0x060D,
+    0x0000,
+    0x0134,
+    0x4203,
+    0x0135,
+    0x4203,
+    0x0136,
+    0x4203,
+    0x0137,
+    0x4203,
+    0x0138,
+    0x4203,
+    0x0139,
+    0x4203,
+    0x013A,
+    0x4203,
+    0x013B,
+    0x4203,
+    0x1211,
+    0x1413,
+    0x1615,
+    0x1817,
+    0x1A19,
+    0x1D1B,
+    0x1F1E,
+    0x2120,
+    0x2322,
+    0x2524,
+    0x2726,
+    0x2928,
+    0x2B2A,
+    0x2D2C,
+    0x2F2E,
+    0x3130,
+    0x3332,
+    0x3534,
+    0x1036,
+    0x371C,
+    0x0164,
+    0x4203,
+    0x01C1,
+    0x4203,
+    0x0165,
+    0x4203,
+    0x0166,
+    0x4203,
+    0x0168,
+    0x4203,
+    0x016A,
+    0x4203,
+    0x016C,
+    0x4203,
+    0x016E,
+    0x4203,
+    0x0170,
+    0x4203,
+    0x0171,
+    0x4203,
+    0x0172,
+    0x4203,
+    0x0174,
+    0x4203,
+    0x0176,
+    0x4203,
+    0x0178,
+    0x4203,
+    0x017A,
+    0x4203,
+    0x017B,
+    0x4203,
+    0x017C,
+    0x4203,
+    0x017D,
+    0x4203,
+    0x017E,
+    0x4203,
+    0x017F,
+    0x4203,
+    0x0180,
+    0x4203,
+    0x0181,
+    0x4203,
+    0x0182,
+    0x4203,
+    0x0184,
+    0x4203,
+    0x0186,
+    0x4203,
+    0x0188,
+    0x4203,
+    0x018A,
+    0x4203,
+    0x01C0,
+    0x4203,
+    0x01C2,
+    0x4203,
+    0x01C3,
+    0x4203,
+    0x01C4,
+    0x4203,
+    0x01C5,
+    0x4203,
+    0x01C6,
+    0x4203,
+    0x01C7,
+    0x4203,
+    0x01EA,
+    0x4203,
+    0x01EC,
+    0x4203,
+    0x01ED,
+    0x4203,
+    0x01EE,
+    0x4203,
+    0x01F0,
+    0x4203,
+    0x01F1,
+    0x4203,
+    0x01F2,
+    0x4203,
+    0x01F4,
+    0x4203,
+    0x01F5,
+    0x4203,
+    0x0205,
+    0x4203,
+    0x01F6,
+    0x4203,
+    0x0BB8,
+    0x0000,
+    0x01FA,
+    0x4203,
+    0x01FB,
+    0x4203,
+    0x01FC,
+    0x4203,
+    0x01FD,
+    0x4203,
+    0x0200,
+    0x4203,
+    0x0201,
+    0x4203,
+    0x0202,
+    0x4203,
+    0x0203,
+    0x4203,
+    0x0204,
+    0x4203,
+    0x0228,
+    0x4203,
+    0x0206,
+    0x4203,
+    0x0240,
+    0x4203,
+    0x0248,
+    0x4203,
+    0x0104,
+    0x0A02,
+    0x0250,
+    0x4203,
+    0x0252,
+    0x4203,
+    0x0254,
+    0x4203,
+    0x0256,
+    0x4203,
+    0x0258,
+    0x4203,
+    0x02AA,
+    0x0000,
+    0x025A,
+    0x4203,
+    0x025C,
+    0x4203,
+    0x025D,
+    0x4203,
+    0x100C,
+    0x0216,
+    0x0264,
+    0x4203,
+    0x0265,
+    0x4203,
+    0x0266,
+    0x4203,
+    0x0267,
+    0x4203,
+    0x0268,
+    0x4203,
+    0x0269,
+    0x4203,
+    0x026A,
+    0x4203,
+    0x026B,
+    0x4203,
+    0x026C,
+    0x4203,
+    0xB086,
+    0xFFFF,
+    0x4F6B,
+    0x486C,
+    0x8038,
+    0x2050,
+    0x4F6B,
+    0x703C,
+    0x4F6B,
+    0x703C,
+    0x4F6B,
+    0x7038,
+    0x4F6B,
+    0x3843,
+    0x703C,
+    0x4F6B,
+    0x703C,
+    0x4F6B,
+    0x803C,
+    0x4F6B,
+    0x7039,
+    0x67DC,
+    0x4B6A,
+    0x2703,
+    0x67DC,
+    0x4B6A,
+    0x67F4,
+    0x801C,
+    0x4B69,
+    0x261E,
+    0x801C,
+    0x4B69,
+    0x701C,
+    0x4B69,
+    0x701C,
+    0x4B69,
+    0x601C,
+    0x4B69,
+    0x601C,
+    0x4B69,
+    0x7018,
+    0x4B69,
+    0x7019,
+    0x7059,
+    0x4B68,
+    0x4969,
+    0x701C,
+    0x705C,
+    0x805C,
+    0x809C,
+    0x88D8,
+    0x80DC,
+    0x8848,
+    0x804C,
+    0x8888,
+    0x808C,
+    0x88C8,
+    0x80CC,
+    0x4963,
+    0x741C,
+    0x745C,
+    0x825C,
+    0x829C,
+    0x8AD8,
+    0x82DC,
+    0x8848,
+    0x804C,
+    0x8888,
+    0x808C,
+    0x88C8,
+    0x80CC,
+    0x495E,
+    0x77CC,
+    0x495E,
+    0x77CC,
+    0x845C,
+    0x495D,
+    0x849C,
+    0x8CD8,
+    0x84DC,
+    0x8848,
+    0x804C,
+    0x8888,
+    0x808C,
+    0x88C8,
+    0x80CC,
+    0x2001,
+    0x4959,
+    0x700C,
+    0x4959,
+    0x700E,
+    0x4959,
+    0x3601,
+    0x700C,
+    0x4958,
+    0x700C,
+    0x4958,
+    0x700E,
+    0x4958,
+    0x3E10,
+    0x700C,
+    0x4958,
+    0x639C,
+    0x63DC,
+    0x641C,
+    0x700C,
+    0x4956,
+    0x700C,
+    0x4956,
+    0x700C,
+    0x4956,
+    0x700C,
+    0x4956,
+    0x700C,
+    0x4956,
+    0x700E,
+    0x4956,
+    0x700F,
+    0x4956,
+    0x19FF,
+    0x700F,
+    0x4956,
+    0x700E,
+    0x4956,
+    0x7008,
+    0x4956,
+    0x30FA,
+    0x800D,
+    0x4955,
+    0x700C,
+    0x4955,
+    0x7008,
+    0x4955,
+    0x38BC,
+    0x7008,
+    0x4955,
+    0x3840,
+    0x700C,
+    0x4954,
+    0x700C,
+    0x4954,
+    0x700C,
+    0x4954,
+    0x700C,
+    0x4954,
+    0x700C,
+    0x4954,
+    0x700C,
+    0x4954,
+    0x65DC,
+    0x661C,
+    0x700C,
+    0x4953,
+    0x8008,
+    0x4953,
+    0x700C,
+    0x4953,
+    0x700C,
+    0x4953,
+    0x700C,
+    0x66DC,
+    0x671C,
+    0x4B52,
+    0x4953,
+    0x801C,
+    0x4B53,
+    0x701C,
+    0x4B53,
+    0x701C,
+    0x4B53,
+    0x701C,
+    0x4B53,
+    0x801C,
+    0x4B53,
+    0x801C,
+    0x4B53,
+    0x801C,
+    0x4B53,
+    0x701C,
+    0x705C,
+    0x4B52,
+    0x701C,
+    0x8858,
+    0x805C,
+    0x884B,
+    0x4851,
+    0x804C,
+    0x7014,
+    0x4950,
+    0x8054,
+    0x6054,
+    0x4A50,
+    0xF002,
+    0xFFC6,
+    0x4B4F,
+    0x4A50,
+    0x4950,
+    0x609A,
+    0x4850,
+    0x4A51,
+    0xF002,
+    0xFFBE,
+    0x4950,
+    0x4A51,
+    0x4851,
+    0xF002,
+    0xFFB9,
+    0x4A51,
+    0x0021,
+    0x4851,
+    0xF002,
+    0xFF60,
+    0x4B50,
+    0x4A51,
+    0x601A,
+    0xF7FF,
+    0xFBE8,
+    0x46C0,
+    0x026E,
+    0x4203,
+    0x057F,
+    0x0000,
+    0x0270,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x0272,
+    0x4203,
+    0x0273,
+    0x4203,
+    0x0274,
+    0x4203,
+    0x0276,
+    0x4203,
+    0x0278,
+    0x4203,
+    0x0204,
+    0x4203,
+    0x0288,
+    0x4203,
+    0x028A,
+    0x4203,
+    0x028C,
+    0x4203,
+    0x028D,
+    0x4203,
+    0x0290,
+    0x4203,
+    0x0294,
+    0x4203,
+    0x0298,
+    0x4203,
+    0x02F0,
+    0x4203,
+    0x0300,
+    0x4203,
+    0x0306,
+    0x4203,
+    0x0316,
+    0x4203,
+    0x0301,
+    0x4203,
+    0x0302,
+    0x4203,
+    0x0326,
+    0x4203,
+    0x0330,
+    0x4203,
+    0x0331,
+    0x4203,
+    0x0332,
+    0x4203,
+    0x0334,
+    0x4203,
+    0x0335,
+    0x4203,
+    0x0336,
+    0x4203,
+    0x0344,
+    0x4203,
+    0x0345,
+    0x4203,
+    0x0346,
+    0x4203,
+    0x0347,
+    0x4203,
+    0x0348,
+    0x4203,
+    0x0349,
+    0x4203,
+    0x034A,
+    0x4203,
+    0x034B,
+    0x4203,
+    0x034C,
+    0x4203,
+    0x034D,
+    0x4203,
+    0x034E,
+    0x4203,
+    0x0350,
+    0x4203,
+    0x0351,
+    0x4203,
+    0x0352,
+    0x4203,
+    0x0353,
+    0x4203,
+    0x0354,
+    0x4203,
+    0x0355,
+    0x4203,
+    0x0356,
+    0x4203,
+    0x0357,
+    0x4203,
+    0x0358,
+    0x4203,
+    0x0364,
+    0x4203,
+    0x0366,
+    0x4203,
+    0x0368,
+    0x4203,
+    0x0369,
+    0x4203,
+    0x036A,
+    0x4203,
+    0x0374,
+    0x4203,
+    0x8206,
+    0x4203,
+    0x0376,
+    0x4203,
+    0x0377,
+    0x4203,
+    0x0378,
+    0x4203,
+    0x037A,
+    0x4203,
+    0x037C,
+    0x4203,
+    0x037E,
+    0x4203,
+    0x8200,
+    0x4203,
+    0x8204,
+    0x4203,
+    0xF000,
+    0x4203,
+    0x1E28,
+    0x1003,
+    0x0574,
+    0x0000,
+    0x8000,
+    0x4200,
+    0xFC00,
+    0x1080,
+    0x23B8,
+    0x1003,
+    0xCA68,
+    0x4203,
+    0x0018,
+    0x0000,
+    0x23CD,
+    0x1003,
+    0x12E0,
+    0x0000,
+    0x4A80,
+    0x2200,
+    0x0268,
+    0x0000,
+    0xC800,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xBABE,
+    0xB105,
+    0x4770,
+    0x0000,
+    0xB570,
+    0x4B6C,
+    0x2001,
+    0x781B,
+    0x069B,
+    0xD506,
+    0x4B6A,
+    0x2203,
+    0x7819,
+    0x000D,
+    0x4015,
+    0x4211,
+    0xD04F,
+    0x4B68,
+    0x781A,
+    0x2302,
+    0x0752,
+    0xD537,
+    0x4B66,
+    0x4C67,
+    0x7819,
+    0x2300,
+    0xB2C9,
+    0x428B,
+    0xD211,
+    0x4865,
+    0x011A,
+    0x1810,
+    0x6805,
+    0x6820,
+    0x4028,
+    0x4285,
+    0xD107,
+    0x4862,
+    0x1812,
+    0x6812,
+    0x6860,
+    0x4042,
+    0xB292,
+    0x2A00,
+    0xD002,
+    0x3301,
+    0xE7EB,
+    0x23FF,
+    0x485D,
+    0x495E,
+    0x7802,
+    0x880C,
+    0xB2D2,
+    0xB2A4,
+    0x2B01,
+    0xD109,
+    0x7802,
+    0x8809,
+    0x0852,
+    0xB289,
+    0x401A,
+    0x2300,
+    0x20FE,
+    0x4288,
+    0x415B,
+    0xE007,
+    0x2B02,
+    0xD016,
+    0x2301,
+    0x21FE,
+    0x401A,
+    0x2300,
+    0x42A1,
+    0x415B,
+    0x4053,
+    0x2202,
+    0x011B,
+    0x4313,
+    0x4A50,
+    0x4951,
+    0x7812,
+    0x6889,
+    0xB2D2,
+    0x708A,
+    0x4A4E,
+    0x6892,
+    0x8013,
+    0x4A4E,
+    0x6812,
+    0x84D3,
+    0xBD70,
+    0x7802,
+    0x8809,
+    0x0752,
+    0xB289,
+    0x0FD2,
+    0xE7DB,
+    0x781A,
+    0x002B,
+    0x0752,
+    0xD5EE,
+    0x4A3E,
+    0x7811,
+    0x0889,
+    0x4201,
+    0xD070,
+    0x4B3C,
+    0x4C3D,
+    0x7818,
+    0x002B,
+    0xB2C0,
+    0x4283,
+    0xD211,
+    0x4D3B,
+    0x0119,
+    0x194D,
+    0x682E,
+    0x6825,
+    0x4035,
+    0x42AE,
+    0xD107,
+    0x4D38,
+    0x1949,
+    0x6809,
+    0x6865,
+    0x4069,
+    0xB289,
+    0x2900,
+    0xD002,
+    0x3301,
+    0xE7EB,
+    0x23FF,
+    0x4C33,
+    0x4834,
+    0x7821,
+    0x8805,
+    0xB2C9,
+    0xB2AD,
+    0x2B01,
+    0xD109,
+    0x7821,
+    0x8800,
+    0x0849,
+    0xB280,
+    0x4019,
+    0x2300,
+    0x24FE,
+    0x4284,
+    0x415B,
+    0xE007,
+    0x2B02,
+    0xD03C,
+    0x2301,
+    0x20FE,
+    0x4019,
+    0x2300,
+    0x42A8,
+    0x415B,
+    0x482B,
+    0x404B,
+    0x011B,
+    0x4318,
+    0x25C0,
+    0x4C2A,
+    0x012D,
+    0x7AE3,
+    0x78E4,
+    0x029B,
+    0x402B,
+    0x2540,
+    0x01A4,
+    0x402C,
+    0x4323,
+    0x2480,
+    0x7811,
+    0x0064,
+    0x01C9,
+    0x4021,
+    0x430B,
+    0x4303,
+    0x0019,
+    0xB218,
+    0x4B21,
+    0x881B,
+    0x7814,
+    0xB29B,
+    0x0724,
+    0xD509,
+    0x3B01,
+    0x4C1F,
+    0xB29B,
+    0x42A3,
+    0xD804,
+    0x7813,
+    0x2208,
+    0x4013,
+    0x4303,
+    0xB299,
+    0x4B1B,
+    0x4A1C,
+    0x781B,
+    0x481C,
+    0x8812,
+    0x069B,
+    0x1812,
+    0x7812,
+    0x0FDB,
+    0x431A,
+    0x1E53,
+    0x419A,
+    0x0253,
+    0x430B,
+    0xE77E,
+    0x7821,
+    0x8800,
+    0x0749,
+    0xB280,
+    0x0FC9,
+    0xE7B5,
+    0x480D,
+    0xE7C4,
+    0x46C0,
+    0x00C9,
+    0x4203,
+    0x0354,
+    0x4203,
+    0x0356,
+    0x4203,
+    0x00AE,
+    0x4203,
+    0xCA28,
+    0x4203,
+    0x0080,
+    0x4203,
+    0x0084,
+    0x4203,
+    0x00C8,
+    0x4203,
+    0x0360,
+    0x4203,
+    0x0358,
+    0x4203,
+    0xC9E0,
+    0x4203,
+    0x036C,
+    0x4203,
+    0x2002,
+    0x0000,
+    0xCA4C,
+    0x4203,
+    0x037A,
+    0x4203,
+    0xFFFD,
+    0x0000,
+    0x0350,
+    0x4203,
+    0x037E,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x4B6E,
+    0xB5F0,
+    0x689B,
+    0xB08B,
+    0x881A,
+    0x1C9C,
+    0xB292,
+    0x9200,
+    0x4A6B,
+    0x7812,
+    0x0692,
+    0xD503,
+    0x4A6A,
+    0x7811,
+    0x0789,
+    0xD00C,
+    0x4A69,
+    0x7812,
+    0xB2D2,
+    0x709A,
+    0x4B68,
+    0x6819,
+    0x2320,
+    0x7ACA,
+    0x439A,
+    0x4313,
+    0x72CB,
+    0xB00B,
+    0xBDF0,
+    0x7812,
+    0x0752,
+    0xD5F3,
+    0x9A00,
+    0x05D2,
+    0xD404,
+    0x4A60,
+    0x1CDC,
+    0x7812,
+    0xB2D2,
+    0x709A,
+    0x4D5F,
+    0x78EB,
+    0x2B00,
+    0xD10C,
+    0x7B2B,
+    0x495E,
+    0x2B00,
+    0xD103,
+    0x7AAB,
+    0x2B00,
+    0xD005,
+    0x495C,
+    0x0020,
+    0x2202,
+    0xF002,
+    0xFDD4,
+    0x3402,
+    0x7AEA,
+    0x2A00,
+    0xD007,
+    0x2A02,
+    0xD000,
+    0xE094,
+    0x0020,
+    0x4956,
+    0xF002,
+    0xFDC9,
+    0x3402,
+    0x4B55,
+    0x881D,
+    0x4B55,
+    0xB2AD,
+    0x781B,
+    0x071B,
+    0xD51D,
+    0x1E6B,
+    0x4A53,
+    0xB29B,
+    0x4293,
+    0xD818,
+    0x230D,
+    0x7023,
+    0x4B51,
+    0x2204,
+    0x18EB,
+    0x681E,
+    0x1C60,
+    0xBA36,
+    0xA903,
+    0x9603,
+    0xF002,
+    0xFDB0,
+    0x4B4D,
+    0x4A4E,
+    0x881B,
+    0x189B,
+    0x781A,
+    0x4B42,
+    0xB2D2,
+    0x7162,
+    0x681B,
+    0x3406,
+    0x62DE,
+    0x3328,
+    0x701A,
+    0x4B49,
+    0x4F49,
+    0x781A,
+    0x4944,
+    0x883B,
+    0x185B,
+    0x781E,
+    0xB2F6,
+    0x0692,
+    0xD522,
+    0x2304,
+    0x7023,
+    0x3309,
+    0x7063,
+    0x4B44,
+    0x4844,
+    0x7819,
+    0x4B44,
+    0x781A,
+    0x4B44,
+    0x781B,
+    0x6800,
+    0x9301,
+    0x4B2E,
+    0x681B,
+    0x1AC0,
+    0x1A40,
+    0x9B01,
+    0x1A80,
+    0x1AC0,
+    0x21A0,
+    0xF7F0,
+    0xFEFA,
+    0xB2C3,
+    0xB280,
+    0x70A3,
+    0x0A00,
+    0x4B3C,
+    0x70E0,
+    0x881B,
+    0xB2DA,
+    0x0A1B,
+    0x7122,
+    0x7163,
+    0x3406,
+    0x2E00,
+    0xD007,
+    0x8839,
+    0x4B38,
+    0x0020,
+    0x0032,
+    0x18C9,
+    0xF002,
+    0xFD6D,
+    0x19A4,
+    0x9B00,
+    0x071B,
+    0xD400,
+    0xE76F,
+    0x1E6B,
+    0x4A27,
+    0xB29B,
+    0x4293,
+    0xD900,
+    0xE769,
+    0x227F,
+    0x4F19,
+    0xAE03,
+    0x68BB,
+    0x2005,
+    0x1AE3,
+    0x4013,
+    0x7033,
+    0xF001,
+    0xFE78,
+    0x2200,
+    0x68BB,
+    0x70B0,
+    0x9304,
+    0x4B1F,
+    0x9407,
+    0x9408,
+    0x70F2,
+    0x881B,
+    0x4926,
+    0x0030,
+    0x185B,
+    0x9305,
+    0x186B,
+    0x7072,
+    0x9309,
+    0x9406,
+    0xF7FF,
+    0xF90B,
+    0x2304,
+    0x4921,
+    0x6B4A,
+    0x421A,
+    0xD0FC,
+    0x4B14,
+    0x18ED,
+    0x682B,
+    0xBA1B,
+    0x3301,
+    0xBA1B,
+    0x602B,
+    0xE73F,
+    0x2A03,
+    0xD000,
+    0xE76C,
+    0x0020,
+    0x490A,
+    0x3205,
+    0xF002,
+    0xFD30,
+    0x3408,
+    0xE765,
+    0xC9E0,
+    0x4203,
+    0x00C9,
+    0x4203,
+    0x0354,
+    0x4203,
+    0x0358,
+    0x4203,
+    0x036C,
+    0x4203,
+    0xCA4C,
+    0x4203,
+    0xCA1E,
+    0x4203,
+    0xCA2C,
+    0x4203,
+    0xCA20,
+    0x4203,
+    0x037A,
+    0x4203,
+    0x0356,
+    0x4203,
+    0xFFFD,
+    0x0000,
+    0x8008,
+    0x4203,
+    0x037C,
+    0x4203,
+    0x8010,
+    0x4203,
+    0x0350,
+    0x4203,
+    0x037E,
+    0x4203,
+    0x026B,
+    0x4203,
+    0x0370,
+    0x4203,
+    0x0265,
+    0x4203,
+    0x0262,
+    0x4203,
+    0x0374,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0000,
+    0x4201,
+    0xB570,
+    0x4C7A,
+    0x7D63,
+    0x2B00,
+    0xD00E,
+    0x2500,
+    0x2002,
+    0x002A,
+    0x0029,
+    0x7565,
+    0xF7FA,
+    0xFEF4,
+    0x2120,
+    0x4A75,
+    0x0028,
+    0x6FD3,
+    0x438B,
+    0x67D3,
+    0xF7FA,
+    0xFF54,
+    0x7B20,
+    0x2804,
+    0xD900,
+    0xE0C2,
+    0xF7F0,
+    0xFE3E,
+    0x4703,
+    0xC157,
+    0x00A0,
+    0xF7FF,
+    0xF8D5,
+    0x2201,
+    0x4B6C,
+    0x4D6D,
+    0x681B,
+    0x4213,
+    0xD024,
+    0x68AB,
+    0x069B,
+    0x0F5B,
+    0x2B03,
+    0xD11F,
+    0x7523,
+    0x6829,
+    0x4B68,
+    0x4019,
+    0x2380,
+    0x021B,
+    0x430B,
+    0x4967,
+    0x6123,
+    0x780B,
+    0x4393,
+    0x4313,
+    0x700B,
+    0x4B65,
+    0x601A,
+    0xF7FF,
+    0xF8C1,
+    0x6A2B,
+    0x4A63,
+    0x4013,
+    0x2206,
+    0x622B,
+    0x4B62,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B61,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x7323,
+    0xE04E,
+    0x2201,
+    0x4B56,
+    0x6FD9,
+    0x430A,
+    0x2107,
+    0x67DA,
+    0x682A,
+    0x400A,
+    0x7522,
+    0x6B2A,
+    0x6122,
+    0x0712,
+    0xD504,
+    0x6BAA,
+    0x3903,
+    0x6062,
+    0x4A57,
+    0x6011,
+    0x2101,
+    0x6FDA,
+    0x438A,
+    0x67DA,
+    0xE7D7,
+    0x4B55,
+    0x8818,
+    0x4B55,
+    0x7819,
+    0x6823,
+    0x18C9,
+    0x4B54,
+    0x18C0,
+    0xF7FD,
+    0xF821,
+    0xF7FF,
+    0xFD85,
+    0xF7FF,
+    0xFE83,
+    0x2302,
+    0xE7D6,
+    0x2201,
+    0x7D26,
+    0x4B44,
+    0x4949,
+    0x7562,
+    0x2E03,
+    0xD137,
+    0x4D43,
+    0x7828,
+    0x4210,
+    0xD023,
+    0x4A4A,
+    0x6D92,
+    0x629A,
+    0x2207,
+    0x6924,
+    0x621C,
+    0x4014,
+    0x1E60,
+    0x2200,
+    0x2805,
+    0xD807,
+    0xF7F0,
+    0xFDCF,
+    0x1103,
+    0x1313,
+    0x1513,
+    0x4A43,
+    0x7812,
+    0xB2D2,
+    0xB2E4,
+    0x62DA,
+    0x77CC,
+    0x2401,
+    0x61DC,
+    0xF7FE,
+    0xF9B8,
+    0x782B,
+    0x43A3,
+    0x702B,
+    0xBD70,
+    0x4A3D,
+    0xE7F0,
+    0x4A3D,
+    0xE7EE,
+    0x4A33,
+    0xE7EC,
+    0x6A18,
+    0x4D31,
+    0x4028,
+    0x6218,
+    0x6A18,
+    0x4D3A,
+    0x4028,
+    0x6218,
+    0x4837,
+    0x7800,
+    0xB2C0,
+    0x62D8,
+    0x77CE,
+    0x61DA,
+    0x2304,
+    0xE797,
+    0x6A18,
+    0x4D29,
+    0x4028,
+    0x6218,
+    0x2000,
+    0x62D8,
+    0x77C8,
+    0x61DA,
+    0x2303,
+    0xE78D,
+    0x6923,
+    0x071B,
+    0xD5DB,
+    0x2101,
+    0x4B20,
+    0x6860,
+    0x781A,
+    0x420A,
+    0xD004,
+    0x4A27,
+    0x6D90,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x2107,
+    0x6923,
+    0x4A18,
+    0x4019,
+    0x2906,
+    0xD00F,
+    0x2900,
+    0xD113,
+    0x4820,
+    0x6D80,
+    0x6290,
+    0x6213,
+    0x2300,
+    0x62D3,
+    0x4B18,
+    0xB2C9,
+    0x77D9,
+    0x2301,
+    0x61D3,
+    0xF7FE,
+    0xF971,
+    0xE7BA,
+    0x4819,
+    0x6D80,
+    0x6290,
+    0x6213,
+    0x4B11,
+    0xE00A,
+    0x6290,
+    0x1E48,
+    0x6213,
+    0x2805,
+    0xD8EA,
+    0xF7F0,
+    0xFD63,
+    0x0703,
+    0x0909,
+    0xF709,
+    0x4B12,
+    0x781B,
+    0xB2DB,
+    0xE7E2,
+    0x4B11,
+    0xE7FA,
+    0x4B11,
+    0xE7F8,
+    0xC9E0,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x4090,
+    0x4200,
+    0x4000,
+    0x4200,
+    0x7F07,
+    0x01FF,
+    0x021E,
+    0x4203,
+    0x4094,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x0263,
+    0x4203,
+    0x4001,
+    0x4200,
+    0x408C,
+    0x4200,
+    0x0246,
+    0x4203,
+    0x026B,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0260,
+    0x4203,
+    0x0262,
+    0x4203,
+    0x0261,
+    0x4203,
+    0xEFFF,
+    0xFFFF,
+    0xB510,
+    0xF7FF,
+    0xFEE1,
+    0xBD10,
+    0xB570,
+    0x4B22,
+    0x781A,
+    0x2303,
+    0x0018,
+    0x0692,
+    0xD538,
+    0x4A20,
+    0x7811,
+    0x000C,
+    0x401C,
+    0x4219,
+    0xD132,
+    0x7812,
+    0x0020,
+    0x0752,
+    0xD52E,
+    0x2101,
+    0x4C1B,
+    0x7822,
+    0x0852,
+    0x400A,
+    0x491A,
+    0x1A9B,
+    0x78C8,
+    0x2800,
+    0xD105,
+    0x7B08,
+    0x7A8D,
+    0x4328,
+    0xD001,
+    0x2305,
+    0x1A9B,
+    0x7ACA,
+    0x2A02,
+    0xD11C,
+    0x3302,
+    0x4A14,
+    0x8812,
+    0x7821,
+    0xB292,
+    0x0709,
+    0xD509,
+    0x3A01,
+    0x4911,
+    0xB292,
+    0x428A,
+    0xD804,
+    0x2005,
+    0x1D9C,
+    0xF001,
+    0xFCCA,
+    0x1903,
+    0x4A0E,
+    0x7812,
+    0x0692,
+    0xD500,
+    0x3306,
+    0x4A0C,
+    0x490D,
+    0x8812,
+    0x1852,
+    0x7810,
+    0x18C0,
+    0xBD70,
+    0x2A03,
+    0xD1E1,
+    0x3308,
+    0xE7DF,
+    0x46C0,
+    0x00C9,
+    0x4203,
+    0x0354,
+    0x4203,
+    0x0356,
+    0x4203,
+    0xCA4C,
+    0x4203,
+    0x037A,
+    0x4203,
+    0xFFFD,
+    0x0000,
+    0x0350,
+    0x4203,
+    0x037E,
+    0x4203,
+    0x8008,
+    0x4203,
+    0xB5F7,
+    0x0005,
+    0x48A4,
+    0x2101,
+    0x7802,
+    0x0852,
+    0x0013,
+    0x400B,
+    0x420A,
+    0xD102,
+    0x7802,
+    0x420A,
+    0xD003,
+    0x4BA0,
+    0x781B,
+    0x075B,
+    0x0FDB,
+    0x4E9F,
+    0x2101,
+    0x7832,
+    0x0712,
+    0xD40F,
+    0x7832,
+    0x0912,
+    0x0014,
+    0x400C,
+    0x420A,
+    0xD109,
+    0x4A98,
+    0x7811,
+    0x4A99,
+    0x7812,
+    0x4211,
+    0xD100,
+    0xE125,
+    0x2B00,
+    0xD000,
+    0xE122,
+    0x220C,
+    0x4996,
+    0x18A8,
+    0xF002,
+    0xFB5B,
+    0x2207,
+    0x4C94,
+    0x6C63,
+    0x0A1B,
+    0x4013,
+    0x2B05,
+    0xD000,
+    0xE0F8,
+    0x4A92,
+    0x6BE3,
+    0x8811,
+    0x4A91,
+    0x3B08,
+    0x6812,
+    0x1A5B,
+    0x2101,
+    0x400A,
+    0x0092,
+    0x1A9B,
+    0x602B,
+    0x6C23,
+    0x6C23,
+    0x211F,
+    0xB29B,
+    0x812B,
+    0x2303,
+    0x72AB,
+    0x4B8A,
+    0x488B,
+    0x781A,
+    0x7AEB,
+    0xB2D7,
+    0x438B,
+    0x400A,
+    0x4313,
+    0x72EB,
+    0x4B88,
+    0x2220,
+    0x601D,
+    0x23FC,
+    0x84EB,
+    0x7AEB,
+    0x0029,
+    0x4393,
+    0x72EB,
+    0xF7FE,
+    0xFDCC,
+    0x2F00,
+    0xD000,
+    0xE0E2,
+    0x0038,
+    0xF7FA,
+    0xFDE6,
+    0x7833,
+    0x2201,
+    0x06DB,
+    0xD500,
+    0xE0DA,
+    0x4B7E,
+    0x781B,
+    0x4213,
+    0xD100,
+    0xE0D5,
+    0x6CE3,
+    0x497C,
+    0x029B,
+    0x7809,
+    0x0E9B,
+    0x4219,
+    0xD100,
+    0xE0CD,
+    0x4B79,
+    0x781B,
+    0x40D3,
+    0x4213,
+    0xD004,
+    0x4B78,
+    0x881B,
+    0x2BFF,
+    0xD100,
+    0xE0C3,
+    0x4B76,
+    0x781A,
+    0x2301,
+    0x421A,
+    0xD00E,
+    0x4A75,
+    0x6FD2,
+    0x421A,
+    0xD00A,
+    0x4A74,
+    0x7812,
+    0x0912,
+    0x421A,
+    0xD005,
+    0x4A72,
+    0x69D2,
+    0x08D2,
+    0x421A,
+    0xD100,
+    0xE0AF,
+    0x250F,
+    0x2607,
+    0x4B6F,
+    0x4970,
+    0x881A,
+    0x2700,
+    0x1850,
+    0xB293,
+    0x9301,
+    0x6CE3,
+    0x6CE3,
+    0x7801,
+    0x402B,
+    0x43A9,
+    0x430B,
+    0x496B,
+    0x7003,
+    0x6CE3,
+    0x1851,
+    0x6CE3,
+    0x7808,
+    0x0A1B,
+    0x43B0,
+    0x4033,
+    0x4303,
+    0x700B,
+    0x6C63,
+    0x6C63,
+    0x4965,
+    0x3D0E,
+    0x08DB,
+    0x1852,
+    0x402B,
+    0x7013,
+    0xF7FF,
+    0xFEF4,
+    0xF7FF,
+    0xFEF2,
+    0x9B01,
+    0x4A61,
+    0xB280,
+    0x189B,
+    0x8018,
+    0x20F0,
+    0x4B5F,
+    0x4960,
+    0x695A,
+    0x43B2,
+    0x615A,
+    0x4A5F,
+    0x4E5F,
+    0x7812,
+    0xB2D2,
+    0x765A,
+    0x700F,
+    0x3A08,
+    0x495D,
+    0x0152,
+    0x600A,
+    0x6A1A,
+    0x495C,
+    0x400A,
+    0x621A,
+    0x4A5C,
+    0x7811,
+    0x69D9,
+    0x7812,
+    0x4381,
+    0x0112,
+    0x300F,
+    0x4002,
+    0x430A,
+    0x4958,
+    0x20E0,
+    0x468C,
+    0x61DA,
+    0x761F,
+    0x4A57,
+    0x625F,
+    0x9B01,
+    0x00C0,
+    0x189B,
+    0x681A,
+    0x9B01,
+    0x4463,
+    0x881B,
+    0x189B,
+    0x4A53,
+    0x60B3,
+    0x6CE3,
+    0x6A11,
+    0x4B52,
+    0x4019,
+    0x6CE3,
+    0x4003,
+    0x430B,
+    0x2180,
+    0x6213,
+    0x4B4F,
+    0x0189,
+    0x63DD,
+    0x6958,
+    0x4301,
+    0x6159,
+    0x2380,
+    0x6A11,
+    0x021B,
+    0x430B,
+    0x6213,
+    0x4B4B,
+    0x6BE2,
+    0x8819,
+    0x6C23,
+    0x1A52,
+    0xB29B,
+    0x3306,
+    0x015B,
+    0x189B,
+    0x6033,
+    0x4B47,
+    0x4C30,
+    0x781B,
+    0x089B,
+    0x402B,
+    0x7333,
+    0xF7FF,
+    0xFD79,
+    0x0028,
+    0x7577,
+    0xF7FA,
+    0xFCDD,
+    0x7821,
+    0x7822,
+    0x2002,
+    0x0752,
+    0x0F92,
+    0x4029,
+    0xF7FA,
+    0xFC6D,
+    0x7823,
+    0x4A3D,
+    0x422B,
+    0xD01C,
+    0x2020,
+    0x4B26,
+    0x7819,
+    0x6FD1,
+    0x781B,
+    0x4381,
+    0x009B,
+    0x4003,
+    0x430B,
+    0x67D3,
+    0x2401,
+    0x0020,
+    0xBDFE,
+    0x6C63,
+    0x0A1B,
+    0x4013,
+    0x2B06,
+    0xD106,
+    0x4A13,
+    0x6BE3,
+    0x8811,
+    0x4A12,
+    0x3B39,
+    0x6812,
+    0xE700,
+    0x4A2D,
+    0x6BE3,
+    0x8812,
+    0xE700,
+    0x2120,
+    0x6FD3,
+    0x438B,
+    0xE7E7,
+    0x002A,
+    0x2300,
+    0x3228,
+    0x62EB,
+    0x7013,
+    0x84EB,
+    0xF7FD,
+    0xFF8E,
+    0xE7DF,
+    0xF7FD,
+    0xFF8B,
+    0xE7DD,
+    0x0354,
+    0x4203,
+    0x0353,
+    0x4203,
+    0x00C8,
+    0x4203,
+    0x00CF,
+    0x4203,
+    0x6044,
+    0x4200,
+    0x6000,
+    0x4200,
+    0x0256,
+    0x4203,
+    0xD0D4,
+    0x4200,
+    0x0355,
+    0x4203,
+    0x022A,
+    0x4203,
+    0x036C,
+    0x4203,
+    0x0356,
+    0x4203,
+    0x00D0,
+    0x4203,
+    0x00C9,
+    0x4203,
+    0x0360,
+    0x4203,
+    0x0270,
+    0x4203,
+    0x4008,
+    0x4200,
+    0x0271,
+    0x4203,
+    0x3000,
+    0x4201,
+    0x0246,
+    0x4203,
+    0x801E,
+    0x4203,
+    0x801B,
+    0x4203,
+    0x800D,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x5000,
+    0x4200,
+    0x502A,
+    0x4200,
+    0x024C,
+    0x4203,
+    0xC9E0,
+    0x4203,
+    0xC900,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0x800E,
+    0x4203,
+    0x8010,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xF8FF,
+    0xFFFF,
+    0x1000,
+    0x4200,
+    0x0252,
+    0x4203,
+    0x0266,
+    0x4203,
+    0x4004,
+    0x4200,
+    0xB510,
+    0x4B05,
+    0x2001,
+    0x781A,
+    0x781B,
+    0x4A04,
+    0xB2DB,
+    0x8013,
+    0xF7FD,
+    0xFD46,
+    0xBD10,
+    0x46C0,
+    0x026E,
+    0x4203,
+    0x034E,
+    0x4203,
+    0xB510,
+    0x4C22,
+    0x4B22,
+    0x6821,
+    0x7B08,
+    0xB2C2,
+    0x280E,
+    0xD00B,
+    0x2A0F,
+    0xD122,
+    0x2200,
+    0x8122,
+    0x2200,
+    0x491E,
+    0x62DA,
+    0x77CA,
+    0x3201,
+    0x61DA,
+    0x2312,
+    0xE015,
+    0x691A,
+    0x6949,
+    0x1852,
+    0x6062,
+    0x629A,
+    0x2280,
+    0x6A19,
+    0x0112,
+    0x430A,
+    0x621A,
+    0x2200,
+    0x2106,
+    0x8122,
+    0x4A15,
+    0x7812,
+    0xB2D2,
+    0x62DA,
+    0x4A12,
+    0x77D1,
+    0x2201,
+    0x61DA,
+    0x230F,
+    0x6822,
+    0x7313,
+    0xBD10,
+    0x6A19,
+    0x480F,
+    0x4001,
+    0x6219,
+    0x2100,
+    0x8121,
+    0x2A11,
+    0xD0D6,
+    0x2A12,
+    0xD001,
+    0x2300,
+    0xE7F0,
+    0x2201,
+    0x4B0A,
+    0x480B,
+    0x701A,
+    0x6823,
+    0x3209,
+    0x729A,
+    0x6821,
+    0xF7FE,
+    0xFC39,
+    0xF7FF,
+    0xFFAB,
+    0xE7F0,
+    0xC9F8,
+    0x4203,
+    0x4000,
+    0x4200,
+    0x4001,
+    0x4200,
+    0x0263,
+    0x4203,
+    0xF7FF,
+    0xFFFF,
+    0x034D,
+    0x4203,
+    0x0230,
+    0x4203,
+    0xB5F8,
+    0x2418,
+    0x4344,
+    0x4E20,
+    0x4B20,
+    0x4821,
+    0x881A,
+    0x8833,
+    0xB292,
+    0x191B,
+    0x1818,
+    0x8002,
+    0x481E,
+    0x181B,
+    0x2001,
+    0x781F,
+    0x4387,
+    0x0010,
+    0x1E45,
+    0x41A8,
+    0x4338,
+    0x7018,
+    0x4B1A,
+    0x481B,
+    0x881B,
+    0x4F1B,
+    0x189B,
+    0x1AC9,
+    0x4A1A,
+    0x8833,
+    0x0015,
+    0x189B,
+    0x191B,
+    0x781B,
+    0x181B,
+    0x009B,
+    0x6019,
+    0x2101,
+    0x8833,
+    0x189B,
+    0x191B,
+    0x781B,
+    0x4099,
+    0x6579,
+    0xF7FE,
+    0xFD50,
+    0x2001,
+    0x4912,
+    0x698B,
+    0x8832,
+    0xB29B,
+    0x1952,
+    0x1912,
+    0x7812,
+    0x4090,
+    0x4303,
+    0x618B,
+    0xF7FE,
+    0xFD4B,
+    0x8833,
+    0x195B,
+    0x2501,
+    0x191B,
+    0x781B,
+    0x409D,
+    0x643D,
+    0xBDF8,
+    0x46C0,
+    0x021C,
+    0x4203,
+    0x020C,
+    0x4203,
+    0x800E,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x9000,
+    0x4201,
+    0x8008,
+    0x4203,
+    0x1000,
+    0x4200,
+    0xB5F8,
+    0x4A2E,
+    0x8943,
+    0x4C2E,
+    0x189A,
+    0x6022,
+    0x220A,
+    0x72E2,
+    0x4A2C,
+    0x4D2D,
+    0x189B,
+    0x781B,
+    0x228B,
+    0x7323,
+    0x7828,
+    0x492B,
+    0x3801,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0xF7FA,
+    0xFD16,
+    0x2300,
+    0x702B,
+    0x6822,
+    0x4927,
+    0x6910,
+    0x780B,
+    0x2680,
+    0x1AC0,
+    0x4B25,
+    0x01B6,
+    0x6298,
+    0x2080,
+    0x6A1D,
+    0x0100,
+    0x4328,
+    0x6218,
+    0x7AD0,
+    0x4D22,
+    0x6A18,
+    0x7AD2,
+    0x4028,
+    0x25E0,
+    0x0212,
+    0x00ED,
+    0x402A,
+    0x4302,
+    0x621A,
+    0x2280,
+    0x6A18,
+    0x0212,
+    0x4302,
+    0x621A,
+    0x6A1A,
+    0x481B,
+    0x2503,
+    0x4002,
+    0x621A,
+    0x001A,
+    0x2001,
+    0x3294,
+    0x6015,
+    0x4A18,
+    0x63D0,
+    0x6957,
+    0x433E,
+    0x6156,
+    0x4A16,
+    0x7010,
+    0x4A16,
+    0x7816,
+    0x7812,
+    0x4E16,
+    0xB2D2,
+    0x8032,
+    0x6A1A,
+    0x4E15,
+    0x4032,
+    0x4E15,
+    0x621A,
+    0x7832,
+    0x4382,
+    0x7032,
+    0x780A,
+    0xB2D2,
+    0x62DA,
+    0x181A,
+    0x77D5,
+    0x220E,
+    0x61D8,
+    0x6823,
+    0x731A,
+    0xBDF8,
+    0x8000,
+    0x4203,
+    0xC9F8,
+    0x4203,
+    0x800C,
+    0x4203,
+    0x0213,
+    0x4203,
+    0x239C,
+    0x1003,
+    0x0261,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xF8FF,
+    0xFFFF,
+    0xFFFF,
+    0xFF7F,
+    0x1000,
+    0x4200,
+    0x034D,
+    0x4203,
+    0x026E,
+    0x4203,
+    0x034E,
+    0x4203,
+    0xEFFF,
+    0xFFFF,
+    0x021E,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xFED7,
+    0xBD10,
+    0xB510,
+    0x4B06,
+    0x8941,
+    0x7ADA,
+    0x4B05,
+    0x4806,
+    0x18CB,
+    0x701A,
+    0x4B05,
+    0x18C9,
+    0xF7FE,
+    0xFB46,
+    0x2000,
+    0xBD10,
+    0xC9F8,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x0230,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x4B02,
+    0x681B,
+    0x6958,
+    0xB280,
+    0x4770,
+    0x46C0,
+    0xC9F8,
+    0x4203,
+    0x210B,
+    0x4B04,
+    0xB510,
+    0x681A,
+    0x4803,
+    0x7291,
+    0x6819,
+    0xF7FE,
+    0xFB2B,
+    0xBD10,
+    0xC9F8,
+    0x4203,
+    0x0230,
+    0x4203,
+    0xB570,
+    0x4B0C,
+    0x781A,
+    0x781B,
+    0x4A0B,
+    0xB2DB,
+    0x8013,
+    0x4B0B,
+    0x4A0B,
+    0x781B,
+    0x7810,
+    0xB2DC,
+    0xB2C5,
+    0x1AC0,
+    0x4243,
+    0x4158,
+    0xB2C0,
+    0xF7FD,
+    0xFBD7,
+    0x42A5,
+    0xD002,
+    0x2200,
+    0x4B05,
+    0x701A,
+    0xBD70,
+    0x46C0,
+    0x026E,
+    0x4203,
+    0x034E,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x0210,
+    0x4203,
+    0x0212,
+    0x4203,
+    0xB510,
+    0x4A0E,
+    0x4B0E,
+    0x490F,
+    0x781B,
+    0x7810,
+    0xB2DC,
+    0x1AC0,
+    0x4243,
+    0x4158,
+    0x2252,
+    0xB2C0,
+    0xF7FA,
+    0xFC4E,
+    0x4B0A,
+    0x490B,
+    0x881A,
+    0x2318,
+    0x4363,
+    0x1852,
+    0x189B,
+    0x781B,
+    0x4A08,
+    0x189B,
+    0x4A08,
+    0x009B,
+    0x681B,
+    0x8810,
+    0x18C0,
+    0xBD10,
+    0x0209,
+    0x4203,
+    0x0210,
+    0x4203,
+    0x23A9,
+    0x1003,
+    0x021C,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0xB570,
+    0x4A0F,
+    0x4B0F,
+    0x0004,
+    0x781B,
+    0x7810,
+    0x490E,
+    0x1AC0,
+    0x4242,
+    0x4150,
+    0x2259,
+    0xB2C0,
+    0xB2DD,
+    0xF7FA,
+    0xFC21,
+    0x4B0B,
+    0x480B,
+    0x881A,
+    0x4B0B,
+    0x1AA2,
+    0x8819,
+    0x2318,
+    0x436B,
+    0x1809,
+    0x185B,
+    0x781B,
+    0x4908,
+    0x185B,
+    0x009B,
+    0x601A,
+    0xBD70,
+    0x46C0,
+    0x0209,
+    0x4203,
+    0x0210,
+    0x4203,
+    0x23A9,
+    0x1003,
+    0x020E,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x6400,
+    0x1080,
+    0xB530,
+    0x000C,
+    0x2500,
+    0x3422,
+    0x7823,
+    0x4A2C,
+    0xB2DB,
+    0x8115,
+    0x2806,
+    0xD010,
+    0x2813,
+    0xD01C,
+    0x42A8,
+    0xD104,
+    0x7F08,
+    0x07C0,
+    0xD509,
+    0x2332,
+    0x8113,
+    0x8913,
+    0x2B00,
+    0xD003,
+    0x4924,
+    0x8809,
+    0x185B,
+    0x8113,
+    0xBD30,
+    0x000D,
+    0x3520,
+    0x7828,
+    0x09C0,
+    0xD008,
+    0x7828,
+    0x2501,
+    0x0740,
+    0xD504,
+    0x481E,
+    0x7800,
+    0x0880,
+    0x4228,
+    0xD1E7,
+    0x7820,
+    0x07C0,
+    0xD405,
+    0x481B,
+    0x4D1C,
+    0x7800,
+    0x782D,
+    0x1940,
+    0x8110,
+    0x2501,
+    0x8910,
+    0x069B,
+    0xD507,
+    0x6A8B,
+    0x3310,
+    0x18C3,
+    0x8113,
+    0x8913,
+    0x332D,
+    0x33FF,
+    0xE7D3,
+    0x7F0B,
+    0x422B,
+    0xD004,
+    0x4B13,
+    0x781B,
+    0x3320,
+    0x18C0,
+    0x8110,
+    0x890B,
+    0x8911,
+    0x3308,
+    0x015B,
+    0x185B,
+    0xB29B,
+    0x8113,
+    0x7821,
+    0x0789,
+    0xD5E9,
+    0x490C,
+    0x480D,
+    0x7809,
+    0x7800,
+    0x1809,
+    0x185B,
+    0xB29B,
+    0x490B,
+    0x8113,
+    0x7809,
+    0x3108,
+    0x0149,
+    0x185B,
+    0xE7DA,
+    0xCA08,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x0271,
+    0x4203,
+    0x0264,
+    0x4203,
+    0x0261,
+    0x4203,
+    0x0269,
+    0x4203,
+    0x026C,
+    0x4203,
+    0x026D,
+    0x4203,
+    0x026F,
+    0x4203,
+    0xB570,
+    0x4B2A,
+    0x781A,
+    0x0792,
+    0xD503,
+    0x2102,
+    0x781A,
+    0x438A,
+    0x701A,
+    0x4A27,
+    0x6810,
+    0x0001,
+    0x3121,
+    0x780C,
+    0xB2E2,
+    0x2C07,
+    0xD024,
+    0x2A07,
+    0xD804,
+    0x2A01,
+    0xD006,
+    0x2A04,
+    0xD013,
+    0xBD70,
+    0x2A0E,
+    0xD01E,
+    0x2A11,
+    0xD1FA,
+    0x780B,
+    0x2B11,
+    0xD11F,
+    0x7EC3,
+    0x065B,
+    0xD5F4,
+    0x2207,
+    0x7FC3,
+    0x7EC1,
+    0x0918,
+    0x4011,
+    0x2200,
+    0xF7FC,
+    0xF9CC,
+    0xE7EB,
+    0x21F0,
+    0x7E03,
+    0x7E02,
+    0x091B,
+    0x3301,
+    0x011B,
+    0xB2DB,
+    0x438A,
+    0x4313,
+    0x7603,
+    0xE7E0,
+    0xF001,
+    0xFE52,
+    0xE7DD,
+    0x2202,
+    0x7819,
+    0x4391,
+    0x430A,
+    0x701A,
+    0xE7D7,
+    0x0002,
+    0x260F,
+    0x3222,
+    0x7E03,
+    0x7811,
+    0x2207,
+    0x8BC4,
+    0x4033,
+    0x7EC5,
+    0x0989,
+    0x0018,
+    0x4015,
+    0xB2A4,
+    0xF7F0,
+    0xFA32,
+    0x0020,
+    0x0089,
+    0x4108,
+    0x2200,
+    0x0029,
+    0x4030,
+    0xE7D2,
+    0x46C0,
+    0x021E,
+    0x4203,
+    0xCA08,
+    0x4203,
+    0xB510,
+    0x4C06,
+    0x7CE3,
+    0x2B07,
+    0xD102,
+    0x6820,
+    0xF001,
+    0xFEB4,
+    0x6823,
+    0x3321,
+    0x781B,
+    0x74E3,
+    0xBD10,
+    0x46C0,
+    0xCA08,
+    0x4203,
+    0x4A08,
+    0x2300,
+    0x7811,
+    0x29FF,
+    0xD00A,
+    0x4B07,
+    0x7811,
+    0x881A,
+    0x2318,
+    0x434B,
+    0x4905,
+    0x1852,
+    0x189B,
+    0x1A1B,
+    0x425A,
+    0x4153,
+    0xB2D8,
+    0x4770,
+    0x0211,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x0003,
+    0x0002,
+    0xB510,
+    0x3323,
+    0x7281,
+    0x781B,
+    0x4904,
+    0x069B,
+    0x0F9B,
+    0x185B,
+    0x0058,
+    0x0011,
+    0xF7FE,
+    0xF9A8,
+    0xBD10,
+    0x46C0,
+    0x8116,
+    0x2101,
+    0xB510,
+    0x2800,
+    0xD005,
+    0x4B04,
+    0x18C1,
+    0x2000,
+    0xF7FF,
+    0xFEF4,
+    0xBD10,
+    0x4B02,
+    0x8118,
+    0xE7FB,
+    0x8000,
+    0x4203,
+    0xCA08,
+    0x4203,
+    0x4B01,
+    0x8918,
+    0x4770,
+    0x46C0,
+    0xCA08,
+    0x4203,
+    0x4770,
+    0x0000,
+    0xB5F8,
+    0x0001,
+    0x4823,
+    0x4B24,
+    0x7802,
+    0x0792,
+    0xD408,
+    0x4A23,
+    0x7812,
+    0x0752,
+    0xD536,
+    0x4A22,
+    0x7A9C,
+    0x7812,
+    0x4294,
+    0xD131,
+    0x2401,
+    0x2702,
+    0x4A1F,
+    0x741C,
+    0x6C95,
+    0x681E,
+    0x0E2D,
+    0x76B5,
+    0x6C55,
+    0x681D,
+    0x6C52,
+    0x7E6E,
+    0x0892,
+    0x43BE,
+    0x403A,
+    0x4332,
+    0x766A,
+    0x4A19,
+    0x7815,
+    0x7812,
+    0x681D,
+    0x40FA,
+    0x7E6E,
+    0x4022,
+    0x43A6,
+    0x4332,
+    0x766A,
+    0x2508,
+    0x7802,
+    0x7802,
+    0x6818,
+    0x402A,
+    0x302C,
+    0x7804,
+    0x43AC,
+    0x4322,
+    0x7002,
+    0x4A10,
+    0x7810,
+    0x681A,
+    0xB2C0,
+    0x322D,
+    0x7010,
+    0x7C18,
+    0x2800,
+    0xD002,
+    0x0008,
+    0xF7FF,
+    0xFB25,
+    0xBDF8,
+    0x2200,
+    0x2401,
+    0x6818,
+    0x741A,
+    0x7E42,
+    0x43A2,
+    0x7642,
+    0xE7F0,
+    0x0356,
+    0x4203,
+    0xCA08,
+    0x4203,
+    0x0353,
+    0x4203,
+    0x0358,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x00E0,
+    0x4203,
+    0x0354,
+    0x4203,
+    0xB570,
+    0x2601,
+    0xF7FE,
+    0xFA86,
+    0x2007,
+    0x4B23,
+    0x4A23,
+    0x6FD9,
+    0x4C23,
+    0x4331,
+    0x67D9,
+    0x6811,
+    0x4001,
+    0x2902,
+    0xD123,
+    0x2504,
+    0x4920,
+    0x600D,
+    0x6A11,
+    0x4D20,
+    0x4029,
+    0x2506,
+    0x6211,
+    0x491F,
+    0x7809,
+    0xB2C9,
+    0x62D1,
+    0x491E,
+    0x77CD,
+    0x61D6,
+    0x2208,
+    0x6FD9,
+    0x4391,
+    0x67D9,
+    0x2110,
+    0x6FDD,
+    0x438D,
+    0x67DD,
+    0x6FDD,
+    0x43B5,
+    0x67DD,
+    0x6FDD,
+    0x432A,
+    0x67DA,
+    0x6FDA,
+    0x430A,
+    0x67DA,
+    0x6822,
+    0x72E0,
+    0x3221,
+    0x7011,
+    0x2501,
+    0x6FDA,
+    0x43AA,
+    0x67DA,
+    0xF7FE,
+    0xFA59,
+    0x6823,
+    0x332C,
+    0x781A,
+    0x422A,
+    0xD00C,
+    0x781A,
+    0x0892,
+    0x422A,
+    0xD108,
+    0x2204,
+    0x480B,
+    0x6B41,
+    0x4211,
+    0xD0FC,
+    0x7819,
+    0x4391,
+    0x430A,
+    0x701A,
+    0xBD70,
+    0x4004,
+    0x4200,
+    0x4000,
+    0x4200,
+    0xCA08,
+    0x4203,
+    0x408C,
+    0x4200,
+    0xF7FF,
+    0xFFFF,
+    0x0263,
+    0x4203,
+    0x4001,
+    0x4200,
+    0x0000,
+    0x4201,
+    0xB5F7,
+    0x4CC3,
+    0x7C63,
+    0x2B00,
+    0xD00E,
+    0x2500,
+    0x0028,
+    0x7465,
+    0xF7FA,
+    0xF83E,
+    0x002A,
+    0x0029,
+    0x2001,
+    0xF7FA,
+    0xF82B,
+    0x2120,
+    0x4ABC,
+    0x6FD3,
+    0x438B,
+    0x67D3,
+    0x7CA3,
+    0x2B00,
+    0xD016,
+    0x2600,
+    0x2501,
+    0x2703,
+    0x6823,
+    0x74A6,
+    0x3320,
+    0x7819,
+    0x781A,
+    0x0989,
+    0x0912,
+    0x0028,
+    0x403A,
+    0x4029,
+    0xF7FA,
+    0xF814,
+    0x4AB2,
+    0x0030,
+    0x6B13,
+    0x43BB,
+    0x431D,
+    0x6315,
+    0xF7FA,
+    0xF81A,
+    0x6821,
+    0x4DAF,
+    0x000B,
+    0x3321,
+    0x7818,
+    0xB2C2,
+    0x3801,
+    0x2810,
+    0xD874,
+    0xF7EF,
+    0xFF59,
+    0x0973,
+    0x15DF,
+    0x7340,
+    0x7171,
+    0x7773,
+    0x73A1,
+    0xC873,
+    0x73DF,
+    0x0073,
+    0x4BA6,
+    0x6928,
+    0x781B,
+    0x6A89,
+    0x181B,
+    0x185B,
+    0x62AB,
+    0x2380,
+    0x6A29,
+    0x011B,
+    0x430B,
+    0x622B,
+    0x4BA0,
+    0x48A1,
+    0x6929,
+    0x781B,
+    0x7800,
+    0x181B,
+    0x185B,
+    0x62AB,
+    0x2380,
+    0x6A29,
+    0x011B,
+    0x430B,
+    0x622B,
+    0x2300,
+    0x8123,
+    0x2A13,
+    0xD901,
+    0xF000,
+    0xFC68,
+    0x0010,
+    0x3301,
+    0xF7EF,
+    0xFF41,
+    0x00B6,
+    0x01DD,
+    0x023E,
+    0x0249,
+    0x0266,
+    0x001E,
+    0x0151,
+    0x03A3,
+    0x0305,
+    0x03A3,
+    0x0057,
+    0x0088,
+    0x0405,
+    0x03DA,
+    0x00A8,
+    0x0256,
+    0x0256,
+    0x040A,
+    0x0412,
+    0x01BE,
+    0x692B,
+    0x3320,
+    0x62AB,
+    0x2380,
+    0x6A2A,
+    0x011B,
+    0x4313,
+    0x622B,
+    0x2300,
+    0x8123,
+    0x2286,
+    0x2601,
+    0x4987,
+    0x00D2,
+    0x588B,
+    0x6820,
+    0x0A1B,
+    0x4033,
+    0x7583,
+    0x5889,
+    0x4884,
+    0x4A84,
+    0xB2C9,
+    0x7812,
+    0x7807,
+    0xB2D2,
+    0x4883,
+    0x42B7,
+    0xD000,
+    0xE240,
+    0x4291,
+    0xD302,
+    0x2B00,
+    0xD000,
+    0xE239,
+    0x7803,
+    0x07DB,
+    0xD400,
+    0xE23E,
+    0x2301,
+    0x2200,
+    0x7463,
+    0x6823,
+    0x3321,
+    0x701A,
+    0x6928,
+    0xF7FF,
+    0xFD59,
+    0xE756,
+    0x692B,
+    0x604B,
+    0x6A2B,
+    0x4977,
+    0x400B,
+    0xE7A9,
+    0x4B76,
+    0x692A,
+    0x781B,
+    0x189B,
+    0x62AB,
+    0x2380,
+    0x6A2A,
+    0x011B,
+    0x4313,
+    0x622B,
+    0x2300,
+    0x8123,
+    0x2203,
+    0x2100,
+    0x692B,
+    0x60E3,
+    0x4B6F,
+    0x701A,
+    0x701A,
+    0x4B6F,
+    0x7019,
+    0x4B6F,
+    0x7818,
+    0x781B,
+    0x486E,
+    0xB2DB,
+    0x8003,
+    0x7421,
+    0x6A2B,
+    0x496D,
+    0x400B,
+    0x622B,
+    0x4B5F,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B6A,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x330A,
+    0xE091,
+    0x4B5F,
+    0x4A68,
+    0x781B,
+    0x6929,
+    0x079B,
+    0xD51E,
+    0x4B5E,
+    0x781B,
+    0x7812,
+    0x189B,
+    0x185B,
+    0x62AB,
+    0x2380,
+    0x6A2A,
+    0x011B,
+    0x4313,
+    0x622B,
+    0x2300,
+    0x8123,
+    0x6823,
+    0x3322,
+    0x781B,
+    0x079B,
+    0xD501,
+    0x2301,
+    0x7463,
+    0x2206,
+    0x4B5C,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B58,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x330B,
+    0xE06C,
+    0x7813,
+    0xE7E2,
+    0x692B,
+    0x6A8A,
+    0x189B,
+    0x6063,
+    0x62AB,
+    0x2380,
+    0x6A2A,
+    0x011B,
+    0x4313,
+    0x622B,
+    0x2300,
+    0x8123,
+    0x2206,
+    0x4B4F,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B4B,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x330E,
+    0xE053,
+    0x692B,
+    0x3310,
+    0xE739,
+    0x2201,
+    0x6823,
+    0x7F19,
+    0x4211,
+    0xD100,
+    0xE094,
+    0x493C,
+    0x7E1F,
+    0x7809,
+    0x093F,
+    0x4211,
+    0xD001,
+    0x2F00,
+    0xD155,
+    0x7F1A,
+    0x0712,
+    0x0F52,
+    0x4297,
+    0xD850,
+    0x7F1A,
+    0x06D2,
+    0xD502,
+    0x2F00,
+    0xD100,
+    0xE081,
+    0x2101,
+    0x7F5D,
+    0x7F5E,
+    0x4B3C,
+    0xB2ED,
+    0x681A,
+    0xB2F6,
+    0x430A,
+    0x601A,
+    0x68DA,
+    0x9200,
+    0x681A,
+    0x438A,
+    0x601A,
+    0xF7FF,
+    0xFC92,
+    0x9001,
+    0xF7FD,
+    0xFC9D,
+    0x2800,
+    0xD026,
+    0x2320,
+    0x7103,
+    0x3B11,
+    0x401D,
+    0x19ED,
+    0x0936,
+    0x42B5,
+    0xD900,
+    0x0035,
+    0x2301,
+    0x40AB,
+    0x9A00,
+    0x3B01,
+    0x401A,
+    0x23A0,
+    0xB2D2,
+    0x005B,
+    0x4353,
+    0x9A01,
+    0x189B,
+    0x6003,
+    0x6823,
+    0x4A29,
+    0x189B,
+    0xB29B,
+    0x80C3,
+    0xF7FD,
+    0xFCF9,
+    0x2006,
+    0x6821,
+    0xF7FF,
+    0xFCC7,
+    0xF7FF,
+    0xFC47,
+    0x2306,
+    0x6822,
+    0x3221,
+    0x7013,
+    0xE2C2,
+    0x2208,
+    0x6823,
+    0x729A,
+    0x6821,
+    0x000B,
+    0x3323,
+    0x7818,
+    0x4B1E,
+    0x0680,
+    0x0F80,
+    0x18C0,
+    0x0040,
+    0xF7FD,
+    0xFF5A,
+    0xE7E5,
+    0x7F1A,
+    0x3321,
+    0x0692,
+    0x0FD2,
+    0x3204,
+    0x72E2,
+    0x2210,
+    0x701A,
+    0xE678,
+    0xCA08,
+    0x4203,
+    0x4004,
+    0x4200,
+    0x3000,
+    0x4201,
+    0x4000,
+    0x4200,
+    0x0261,
+    0x4203,
+    0x0269,
+    0x4203,
+    0xD000,
+    0x4200,
+    0x026A,
+    0x4203,
+    0x0268,
+    0x4203,
+    0x0266,
+    0x4203,
+    0xF7FF,
+    0xFFFF,
+    0x026C,
+    0x4203,
+    0x00E2,
+    0x4203,
+    0x034D,
+    0x4203,
+    0x026F,
+    0x4203,
+    0x034E,
+    0x4203,
+    0xEFFF,
+    0xFFFF,
+    0x4001,
+    0x4200,
+    0x026D,
+    0x4203,
+    0x0263,
+    0x4203,
+    0x7000,
+    0x4201,
+    0x8000,
+    0xFFFF,
+    0x8116,
+    0x2101,
+    0x6823,
+    0x2601,
+    0x3320,
+    0x7819,
+    0x781A,
+    0x2303,
+    0x0889,
+    0x401A,
+    0x0030,
+    0x4031,
+    0xF7F9,
+    0xFE78,
+    0x6823,
+    0x3320,
+    0x781A,
+    0x09D2,
+    0xD05B,
+    0x781B,
+    0x089B,
+    0x4233,
+    0xD057,
+    0x4BBB,
+    0x781B,
+    0x089B,
+    0x4233,
+    0xD052,
+    0x0030,
+    0xF7F9,
+    0xFE75,
+    0x4AB8,
+    0x69D3,
+    0x08DB,
+    0x4233,
+    0xD015,
+    0x69D3,
+    0x091B,
+    0x4233,
+    0xD011,
+    0x2000,
+    0xF7F9,
+    0xFE69,
+    0x6823,
+    0x3322,
+    0x781A,
+    0x2301,
+    0x421A,
+    0xD15C,
+    0x2106,
+    0x4AAF,
+    0x7812,
+    0xB2D2,
+    0x62EA,
+    0x4AAE,
+    0x77D1,
+    0x61EB,
+    0xE77D,
+    0xF7FD,
+    0xFBF4,
+    0x1E05,
+    0xD01A,
+    0xF7FF,
+    0xFBE2,
+    0x4BAA,
+    0x781A,
+    0x23FA,
+    0x009B,
+    0x4353,
+    0x2220,
+    0x181B,
+    0x712A,
+    0x602B,
+    0x6823,
+    0x4AA6,
+    0x0028,
+    0x189B,
+    0xB29B,
+    0x80EB,
+    0xF7FD,
+    0xFC59,
+    0x2013,
+    0x6821,
+    0xF7FF,
+    0xFC27,
+    0xF7FF,
+    0xFBA7,
+    0x2313,
+    0xE75E,
+    0xF7F9,
+    0xFE39,
+    0x002A,
+    0x0029,
+    0x2001,
+    0xF7F9,
+    0xFE26,
+    0x2208,
+    0x6823,
+    0x729A,
+    0x6821,
+    0x000B,
+    0x3323,
+    0x7818,
+    0x4B99,
+    0x0680,
+    0x0F80,
+    0x18C0,
+    0x0040,
+    0xF7FD,
+    0xFEB6,
+    0xE7E1,
+    0x6823,
+    0x3320,
+    0x781A,
+    0x09D2,
+    0xD0B6,
+    0x781B,
+    0x2601,
+    0x075B,
+    0xD5B2,
+    0x4B8A,
+    0x781B,
+    0x089B,
+    0x4233,
+    0xD0AD,
+    0x2000,
+    0xF7F9,
+    0xFE14,
+    0x4B87,
+    0x69DB,
+    0x08DB,
+    0x0019,
+    0x4031,
+    0x4233,
+    0xD1A3,
+    0x000A,
+    0x0030,
+    0xF7F9,
+    0xFDFB,
+    0x2309,
+    0x72E3,
+    0xE078,
+    0x6823,
+    0x4986,
+    0x0018,
+    0x3020,
+    0x7802,
+    0x09D2,
+    0xD032,
+    0x7802,
+    0x0752,
+    0xD52F,
+    0x2620,
+    0x4A7A,
+    0x7810,
+    0x6FC8,
+    0x7812,
+    0x43B0,
+    0x0152,
+    0x4032,
+    0x4302,
+    0x67CA,
+    0x001A,
+    0x3222,
+    0x7812,
+    0x2101,
+    0x0692,
+    0xD523,
+    0x2680,
+    0x7B5A,
+    0x6A28,
+    0x4A79,
+    0x01B6,
+    0x4010,
+    0x7B5A,
+    0x0352,
+    0x4032,
+    0x4302,
+    0x622A,
+    0x7F1A,
+    0x4875,
+    0x6A2A,
+    0x7F1B,
+    0x4002,
+    0x2080,
+    0x019B,
+    0x0140,
+    0x4003,
+    0x4313,
+    0x2204,
+    0x622B,
+    0x4B71,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B68,
+    0x77DA,
+    0x2302,
+    0x61E9,
+    0xE6EF,
+    0x2020,
+    0x6FCA,
+    0x4382,
+    0xE7D4,
+    0x7F1A,
+    0x420A,
+    0xD05B,
+    0x2680,
+    0x7B5A,
+    0x6A28,
+    0x4A65,
+    0x01B6,
+    0x4010,
+    0x7B5A,
+    0x0352,
+    0x4032,
+    0x4302,
+    0x622A,
+    0x7F1A,
+    0x4862,
+    0x6A2A,
+    0x7F1B,
+    0x4002,
+    0x2080,
+    0x019B,
+    0x0140,
+    0x4003,
+    0x4313,
+    0x2205,
+    0x622B,
+    0x4B5D,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B54,
+    0x77DA,
+    0x2304,
+    0x61E9,
+    0xE6C8,
+    0x2106,
+    0x4A50,
+    0x7463,
+    0x7812,
+    0xB2D2,
+    0x62EA,
+    0x4A4F,
+    0x77D1,
+    0x61EB,
+    0x2303,
+    0xE6BD,
+    0x2386,
+    0x4A54,
+    0x00DB,
+    0x58D1,
+    0x6820,
+    0xB2C9,
+    0x75C1,
+    0x58D1,
+    0x58D3,
+    0x6822,
+    0x05DB,
+    0x0FDB,
+    0x7593,
+    0x6823,
+    0x7EDB,
+    0x065B,
+    0xD400,
+    0xE1AE,
+    0x2206,
+    0x4B42,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B41,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x3310,
+    0xE6A0,
+    0x2206,
+    0x4B3C,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B3B,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x3304,
+    0xE695,
+    0x7803,
+    0xE5C7,
+    0x7803,
+    0x4233,
+    0xD000,
+    0xE5C3,
+    0x4291,
+    0xD300,
+    0xE5C0,
+    0x6820,
+    0x8903,
+    0x2B00,
+    0xD100,
+    0xE15A,
+    0x0003,
+    0x3324,
+    0x781B,
+    0x4E39,
+    0x069B,
+    0x4F39,
+    0x0F9B,
+    0xD130,
+    0x2107,
+    0x6972,
+    0x438A,
+    0x6172,
+    0x4A36,
+    0x4937,
+    0x7812,
+    0xB2D2,
+    0x7672,
+    0x703B,
+    0x27F0,
+    0x3A08,
+    0x0152,
+    0x600A,
+    0x6A32,
+    0x4933,
+    0x400A,
+    0x6232,
+    0x4A32,
+    0x7811,
+    0x69F1,
+    0x7812,
+    0x43B9,
+    0x0112,
+    0x370F,
+    0x403A,
+    0x430A,
+    0x61F2,
+    0x7633,
+    0x6273,
+    0x6A33,
+    0x492B,
+    0x4A2C,
+    0x400B,
+    0x6233,
+    0x6A33,
+    0x4013,
+    0x6233,
+    0x6903,
+    0x89C2,
+    0x3302,
+    0x189B,
+    0x781B,
+    0x72A3,
+    0x6AA9,
+    0xF7FB,
+    0xFEAB,
+    0x2307,
+    0xE64E,
+    0x6AA9,
+    0xF7FB,
+    0xFE62,
+    0x2207,
+    0x6973,
+    0x4393,
+    0x6173,
+    0x2200,
+    0x2305,
+    0x7672,
+    0x6033,
+    0x6971,
+    0x3313,
+    0x430B,
+    0x6173,
+    0x6A33,
+    0x491A,
+    0x400B,
+    0x6233,
+    0x2380,
+    0x703A,
+    0x6872,
+    0x029B,
+    0x4313,
+    0x2202,
+    0x6073,
+    0x4B18,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B06,
+    0x77DA,
+    0x2301,
+    0x61EB,
+    0x3307,
+    0xE62A,
+    0x46C0,
+    0x0271,
+    0x4203,
+    0x3000,
+    0x4201,
+    0x0263,
+    0x4203,
+    0x4001,
+    0x4200,
+    0x0272,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0x8116,
+    0x2101,
+    0x4004,
+    0x4200,
+    0xDFFF,
+    0xFFFF,
+    0xEFFF,
+    0xFFFF,
+    0x0261,
+    0x4203,
+    0xD000,
+    0x4200,
+    0x5000,
+    0x4200,
+    0x502A,
+    0x4200,
+    0x024C,
+    0x4203,
+    0xC900,
+    0x4203,
+    0xFFFF,
+    0xFFFC,
+    0x0250,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x0262,
+    0x4203,
+    0x6A2B,
+    0x4AB9,
+    0x4013,
+    0x622B,
+    0x6A2B,
+    0x4AB8,
+    0x4013,
+    0x2207,
+    0x622B,
+    0x4BB7,
+    0x6959,
+    0x4391,
+    0x3A05,
+    0x430A,
+    0x615A,
+    0x6826,
+    0x0032,
+    0x3225,
+    0x7811,
+    0x7812,
+    0x0030,
+    0xB2D2,
+    0x765A,
+    0x22AA,
+    0x3024,
+    0x761A,
+    0x7802,
+    0x0692,
+    0x0F92,
+    0x1E91,
+    0x9200,
+    0x424A,
+    0x414A,
+    0xB2D7,
+    0x9701,
+    0x69DF,
+    0x46BC,
+    0x4661,
+    0x4FA9,
+    0x4039,
+    0x2780,
+    0x00BF,
+    0x430F,
+    0x61DF,
+    0x69DF,
+    0x46BC,
+    0x4661,
+    0x4FA6,
+    0x4039,
+    0x03D7,
+    0x430F,
+    0x61DF,
+    0x69DF,
+    0x46BC,
+    0x4661,
+    0x4FA3,
+    0x4039,
+    0x2780,
+    0x02FF,
+    0x430F,
+    0x61DF,
+    0x69DF,
+    0x499B,
+    0x400F,
+    0x05D1,
+    0x4339,
+    0x61D9,
+    0x8936,
+    0x9A00,
+    0x3E05,
+    0x499C,
+    0x601E,
+    0x2A02,
+    0xD151,
+    0x4F9B,
+    0x9A00,
+    0x851F,
+    0x2701,
+    0x403E,
+    0x1B92,
+    0x40BA,
+    0xB2D2,
+    0x700A,
+    0x4A98,
+    0x2701,
+    0x841A,
+    0x7806,
+    0x2100,
+    0x0876,
+    0x0032,
+    0x403A,
+    0x423E,
+    0xD005,
+    0x7802,
+    0x0892,
+    0x403A,
+    0x4251,
+    0x4151,
+    0x40B9,
+    0x6A1E,
+    0x4F90,
+    0x0409,
+    0x403E,
+    0x4331,
+    0x6219,
+    0x6A1E,
+    0x498E,
+    0x400E,
+    0x0491,
+    0x4331,
+    0x260F,
+    0x6219,
+    0x69D9,
+    0x43B1,
+    0x9E01,
+    0x4016,
+    0x0032,
+    0x3202,
+    0x0052,
+    0x430A,
+    0x2101,
+    0x61DA,
+    0x4249,
+    0x7802,
+    0x6259,
+    0x6958,
+    0x3119,
+    0x4388,
+    0x3917,
+    0x400A,
+    0x3202,
+    0x00D2,
+    0x4302,
+    0x615A,
+    0x22F0,
+    0x69D8,
+    0x4390,
+    0x3AB0,
+    0x4302,
+    0x61DA,
+    0x2280,
+    0x6858,
+    0x0252,
+    0x4302,
+    0x605A,
+    0x685A,
+    0x487B,
+    0x4002,
+    0x605A,
+    0x2202,
+    0x4B7A,
+    0x62E9,
+    0x77DA,
+    0x2309,
+    0x61E9,
+    0xE565,
+    0x2200,
+    0xE7B3,
+    0x6823,
+    0x3320,
+    0x781A,
+    0x09D2,
+    0xD010,
+    0x781B,
+    0x2201,
+    0x075B,
+    0xD50C,
+    0x4B73,
+    0x781B,
+    0x40D3,
+    0x4213,
+    0xD007,
+    0x4B71,
+    0x69DB,
+    0x08DB,
+    0x4213,
+    0xD015,
+    0x2002,
+    0xF7F9,
+    0xFC2A,
+    0x692B,
+    0x2201,
+    0x60E3,
+    0x6823,
+    0x3322,
+    0x781B,
+    0x079B,
+    0xD517,
+    0x4B6A,
+    0x74A2,
+    0x781B,
+    0x40D3,
+    0x4213,
+    0xD007,
+    0x6A2B,
+    0x4A58,
+    0x4013,
+    0x622B,
+    0xE48A,
+    0xF7FF,
+    0xFB71,
+    0xBDF7,
+    0x2106,
+    0x4B64,
+    0x781B,
+    0xB2DB,
+    0x62EB,
+    0x4B5E,
+    0x77D9,
+    0x230A,
+    0x61EA,
+    0xE52D,
+    0x7462,
+    0x6821,
+    0x2201,
+    0x000B,
+    0x3322,
+    0x7818,
+    0x0740,
+    0xD400,
+    0xE4C5,
+    0x781B,
+    0x08DB,
+    0x4213,
+    0xD003,
+    0x7E4B,
+    0x4213,
+    0xD100,
+    0xE4BD,
+    0x2301,
+    0x4A57,
+    0x7013,
+    0x4A57,
+    0x7811,
+    0x7812,
+    0x4957,
+    0xB2D2,
+    0x800A,
+    0x6A2A,
+    0x4956,
+    0x400A,
+    0x4956,
+    0x622A,
+    0x780A,
+    0x439A,
+    0x700A,
+    0x2103,
+    0x4A54,
+    0x7812,
+    0xB2D2,
+    0x62EA,
+    0x4A48,
+    0x77D1,
+    0x61EB,
+    0x330D,
+    0xE501,
+    0x7C23,
+    0x2B00,
+    0xD1D1,
+    0x3305,
+    0xE5D0,
+    0x2300,
+    0x4A42,
+    0x62EB,
+    0x77D3,
+    0x3301,
+    0x61EB,
+    0x3311,
+    0xE4F4,
+    0x4A44,
+    0x7013,
+    0x7AE3,
+    0x2B05,
+    0xD005,
+    0x6822,
+    0x2B04,
+    0xD14D,
+    0x7F13,
+    0x09DB,
+    0xD04A,
+    0x6822,
+    0x200F,
+    0x0011,
+    0x3123,
+    0x7E13,
+    0x7809,
+    0x4003,
+    0x4001,
+    0x4299,
+    0xD940,
+    0x7E11,
+    0x3301,
+    0x4381,
+    0x430B,
+    0x21F0,
+    0x7613,
+    0x6822,
+    0x7E13,
+    0x438B,
+    0x7613,
+    0x6822,
+    0x68E1,
+    0x8910,
+    0x4B39,
+    0x31C0,
+    0x781E,
+    0x2812,
+    0xD911,
+    0x4B37,
+    0x781B,
+    0x3606,
+    0x011B,
+    0x185B,
+    0x0176,
+    0x18F6,
+    0x4B35,
+    0x6D9B,
+    0x1AF3,
+    0xD508,
+    0x2302,
+    0x72E3,
+    0x2300,
+    0x3221,
+    0x7013,
+    0xF7FF,
+    0xFBF6,
+    0x4B30,
+    0xE7EC,
+    0xF7FD,
+    0xF930,
+    0x2800,
+    0xD014,
+    0x2320,
+    0x7103,
+    0x6006,
+    0x6823,
+    0x4A2C,
+    0x189B,
+    0xB29B,
+    0x80C3,
+    0xF7FD,
+    0xF99E,
+    0x0030,
+    0xF7FF,
+    0xF93F,
+    0x2000,
+    0x6821,
+    0xF7FF,
+    0xF969,
+    0xF7FF,
+    0xF8E9,
+    0x2300,
+    0xE4A0,
+    0x2308,
+    0x72E3,
+    0x6823,
+    0x7AE2,
+    0x729A,
+    0x6821,
+    0x000B,
+    0x3323,
+    0x7818,
+    0x4B20,
+    0x0680,
+    0x0F80,
+    0x18C0,
+    0x0040,
+    0xF7FD,
+    0xFBFD,
+    0x2012,
+    0x6821,
+    0xE7E6,
+    0xF7FF,
+    0xFFFF,
+    0xFFFF,
+    0xFF7F,
+    0x5000,
+    0x4200,
+    0xE0FF,
+    0xFFFF,
+    0x7FFF,
+    0xFFFF,
+    0xFFFF,
+    0xFFE0,
+    0x502A,
+    0x4200,
+    0xD0D0,
+    0xFFFF,
+    0x01FF,
+    0x0000,
+    0xFFFF,
+    0xFFFC,
+    0xFFFF,
+    0xFFFB,
+    0xFFFF,
+    0xFFFD,
+    0x4001,
+    0x4200,
+    0x0271,
+    0x4203,
+    0x3000,
+    0x4201,
+    0x0266,
+    0x4203,
+    0x0263,
+    0x4203,
+    0x034D,
+    0x4203,
+    0x026E,
+    0x4203,
+    0x034E,
+    0x4203,
+    0xEFFF,
+    0xFFFF,
+    0x021E,
+    0x4203,
+    0x0261,
+    0x4203,
+    0x026F,
+    0x4203,
+    0x0267,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0298,
+    0x4203,
+    0x8000,
+    0xFFFF,
+    0x8116,
+    0x2101,
+    0xB5F7,
+    0x0006,
+    0xF7FF,
+    0xF9EE,
+    0x4B5B,
+    0x2800,
+    0xD100,
+    0xE0AE,
+    0x2000,
+    0x781A,
+    0x4282,
+    0xD000,
+    0xE0A8,
+    0x2201,
+    0x701A,
+    0x8973,
+    0x4A56,
+    0x4C57,
+    0x189A,
+    0x6022,
+    0x2202,
+    0x2500,
+    0x72E2,
+    0x4A55,
+    0x7465,
+    0x74A5,
+    0x189B,
+    0x9301,
+    0x781B,
+    0x2118,
+    0x74E3,
+    0x4B52,
+    0x8818,
+    0x881F,
+    0x4B51,
+    0x1A30,
+    0x18C0,
+    0xF7EF,
+    0xFA71,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B4E,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x7803,
+    0x4A4C,
+    0x0030,
+    0x189B,
+    0x4A4C,
+    0x009B,
+    0x681B,
+    0x8817,
+    0x18FF,
+    0xF7FF,
+    0xF9B8,
+    0x42A8,
+    0xD044,
+    0x2601,
+    0x0030,
+    0x9B01,
+    0x701D,
+    0x6823,
+    0x7F1A,
+    0x4B45,
+    0x4390,
+    0x0019,
+    0x4A45,
+    0x9301,
+    0xF7F9,
+    0xFCD1,
+    0x6823,
+    0x4A43,
+    0x3320,
+    0x7818,
+    0x9901,
+    0x09C0,
+    0x4070,
+    0xF7F9,
+    0xFCC8,
+    0x2107,
+    0x4B40,
+    0x4840,
+    0x695A,
+    0x438A,
+    0x615A,
+    0x4A3F,
+    0x4940,
+    0x7812,
+    0xB2D2,
+    0x765A,
+    0x700D,
+    0x3A08,
+    0x493E,
+    0x0152,
+    0x600A,
+    0x6A19,
+    0x4001,
+    0x20F0,
+    0x6219,
+    0x493B,
+    0x780E,
+    0x69DE,
+    0x7809,
+    0x4386,
+    0x0109,
+    0x300F,
+    0x4001,
+    0x4331,
+    0x61D9,
+    0x761D,
+    0x625D,
+    0x6A19,
+    0x4831,
+    0x4001,
+    0x6219,
+    0x6A19,
+    0x4834,
+    0x4001,
+    0x6219,
+    0x4B33,
+    0x4934,
+    0x781B,
+    0x7809,
+    0x185B,
+    0x189B,
+    0x1AFF,
+    0x4D32,
+    0x4932,
+    0x62AF,
+    0x6823,
+    0x2401,
+    0x7EDA,
+    0x6A2A,
+    0x7EDB,
+    0x400A,
+    0x21E0,
+    0x021B,
+    0x00C9,
+    0x400B,
+    0x4313,
+    0x622B,
+    0x2380,
+    0x6A2A,
+    0x021B,
+    0x4313,
+    0x622B,
+    0x6A2B,
+    0x4A29,
+    0x4013,
+    0x2203,
+    0x622B,
+    0x4B28,
+    0x601A,
+    0x2280,
+    0x4B28,
+    0x0192,
+    0x63DC,
+    0x6959,
+    0x430A,
+    0x615A,
+    0xF7FF,
+    0xFA43,
+    0x4B25,
+    0x0020,
+    0x6FDA,
+    0x4322,
+    0x67DA,
+    0x6B2A,
+    0x08D2,
+    0x4222,
+    0xD003,
+    0x2104,
+    0x2000,
+    0x4A20,
+    0x6011,
+    0x2101,
+    0x6FDA,
+    0x438A,
+    0x67DA,
+    0xBDFE,
+    0x2201,
+    0x701A,
+    0x4B1D,
+    0x7018,
+    0xE752,
+    0x0212,
+    0x4203,
+    0x8000,
+    0x4203,
+    0xCA08,
+    0x4203,
+    0x8021,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x020E,
+    0x4203,
+    0x23A9,
+    0x1003,
+    0x0406,
+    0x0000,
+    0x0407,
+    0x0000,
+    0x5000,
+    0x4200,
+    0xFFFF,
+    0xFFFC,
+    0x024C,
+    0x4203,
+    0x502A,
+    0x4200,
+    0xC900,
+    0x4203,
+    0x0250,
+    0x4203,
+    0xFFFF,
+    0xFFFB,
+    0x0262,
+    0x4203,
+    0x0265,
+    0x4203,
+    0x4000,
+    0x4200,
+    0xF8FF,
+    0xFFFF,
+    0xFFFF,
+    0xFF7F,
+    0x4094,
+    0x4200,
+    0x1000,
+    0x4200,
+    0x4004,
+    0x4200,
+    0x408C,
+    0x4200,
+    0x0213,
+    0x4203,
+    0xB510,
+    0xF7FF,
+    0xF88F,
+    0xF7FF,
+    0xF8E7,
+    0xF7FF,
+    0xF9EB,
+    0xBD10,
+    0xB5F8,
+    0x001C,
+    0x0007,
+    0x000E,
+    0x0015,
+    0xF7FC,
+    0xFFC7,
+    0x1E03,
+    0xD007,
+    0x7107,
+    0x6006,
+    0x80C5,
+    0x2C00,
+    0xD004,
+    0xF7FD,
+    0xF81A,
+    0x2301,
+    0x0018,
+    0xBDF8,
+    0xF7FC,
+    0xFFE7,
+    0xE7F9,
+    0xB570,
+    0x0005,
+    0x000E,
+    0x0014,
+    0xF7FD,
+    0xFBFC,
+    0xF7FD,
+    0xF822,
+    0x2800,
+    0xD106,
+    0x4B08,
+    0x781B,
+    0x2B00,
+    0xD102,
+    0x0020,
+    0xF7FF,
+    0xF8F7,
+    0x0022,
+    0x0031,
+    0x2300,
+    0x0028,
+    0xF7FF,
+    0xFFD3,
+    0x0004,
+    0xF7FD,
+    0xFBF0,
+    0x0020,
+    0xBD70,
+    0x0212,
+    0x4203,
+    0xB510,
+    0x2301,
+    0xF7FF,
+    0xFFC8,
+    0xBD10,
+    0x0000,
+    0xB5F8,
+    0x0004,
+    0xF7FF,
+    0xF8B6,
+    0x1E05,
+    0xD010,
+    0x4B19,
+    0x8960,
+    0x2107,
+    0x18C0,
+    0xF7FF,
+    0xF8C6,
+    0x4B17,
+    0x4A18,
+    0x781B,
+    0x7812,
+    0x429A,
+    0xD102,
+    0x2200,
+    0x4B16,
+    0x701A,
+    0x2000,
+    0xBDF8,
+    0x4B15,
+    0x7A66,
+    0x8818,
+    0x881F,
+    0x4B14,
+    0x1A20,
+    0x2118,
+    0x18C0,
+    0xF7EF,
+    0xF93F,
+    0x230F,
+    0x4003,
+    0x2018,
+    0x4358,
+    0x4B10,
+    0xB2BF,
+    0x18FF,
+    0x19C0,
+    0x7803,
+    0x4A0E,
+    0xB2F6,
+    0x189B,
+    0x009B,
+    0x6819,
+    0x8962,
+    0x0030,
+    0xB292,
+    0xF7FF,
+    0xFFC6,
+    0x4B05,
+    0x701D,
+    0x4B09,
+    0x701D,
+    0xE7DB,
+    0x46C0,
+    0x8000,
+    0x4203,
+    0x0209,
+    0x4203,
+    0x0211,
+    0x4203,
+    0x0212,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8000,
+    0xBDFC,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x0213,
+    0x4203,
+    0xB5F8,
+    0x4B1B,
+    0x2000,
+    0x781B,
+    0xB2DC,
+    0x2BFF,
+    0xD00F,
+    0x4819,
+    0x4E19,
+    0x8833,
+    0x6D87,
+    0x4819,
+    0xB29B,
+    0x8805,
+    0x4818,
+    0x19ED,
+    0x1810,
+    0x1B4D,
+    0xD504,
+    0x2107,
+    0xF7FF,
+    0xF870,
+    0x2001,
+    0xBDF8,
+    0x2518,
+    0x4365,
+    0x6807,
+    0x4812,
+    0x195B,
+    0x1818,
+    0x6007,
+    0x2720,
+    0x4810,
+    0x1818,
+    0x7007,
+    0x4810,
+    0x1818,
+    0x8002,
+    0x4A0F,
+    0x0020,
+    0x189B,
+    0x2200,
+    0x601A,
+    0x8833,
+    0x4A0D,
+    0x189B,
+    0x195B,
+    0x781B,
+    0x4A0C,
+    0x189B,
+    0x009B,
+    0x6019,
+    0xF7FD,
+    0xFAB0,
+    0xE7DE,
+    0x46C0,
+    0x0211,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x021C,
+    0x4203,
+    0x020E,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x8008,
+    0x4203,
+    0x6400,
+    0x1080,
+    0x0003,
+    0xB570,
+    0x2831,
+    0xD00F,
+    0x2832,
+    0xD016,
+    0x2002,
+    0x2B30,
+    0xD109,
+    0x4B25,
+    0x301E,
+    0x881A,
+    0x4B24,
+    0xB292,
+    0x6D99,
+    0xF7FF,
+    0xFF33,
+    0x4243,
+    0x4158,
+    0xBD70,
+    0x4B1F,
+    0x2020,
+    0x6819,
+    0x4B20,
+    0x881A,
+    0xB292,
+    0xF7FF,
+    0xFF98,
+    0xE7F3,
+    0x4B1B,
+    0x881C,
+    0xF7FD,
+    0xFB25,
+    0x4B1C,
+    0xB2A4,
+    0x781B,
+    0x2B00,
+    0xD129,
+    0x491A,
+    0x780B,
+    0xB2DA,
+    0x2B00,
+    0xD124,
+    0x4B19,
+    0x781D,
+    0x4B19,
+    0xB2E8,
+    0x881E,
+    0x2318,
+    0x436B,
+    0x2501,
+    0x199B,
+    0x2625,
+    0x700D,
+    0x4915,
+    0x4D16,
+    0x1861,
+    0x195D,
+    0x6809,
+    0x602A,
+    0x4D14,
+    0x195D,
+    0x702E,
+    0x4D14,
+    0x195D,
+    0x802C,
+    0x4C13,
+    0x191B,
+    0x601A,
+    0x22A0,
+    0x4B12,
+    0x701A,
+    0x4B12,
+    0x7018,
+    0xF7FE,
+    0xFD7C,
+    0xF7FD,
+    0xFB00,
+    0x2000,
+    0xE7C2,
+    0xF7FE,
+    0xFE6A,
+    0xE7FA,
+    0x46C0,
+    0x8224,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x8228,
+    0x4203,
+    0x0212,
+    0x4203,
+    0x0213,
+    0x4203,
+    0x0210,
+    0x4203,
+    0x021C,
+    0x4203,
+    0x8010,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8009,
+    0x4203,
+    0x800A,
+    0x4203,
+    0x8004,
+    0x4203,
+    0x0368,
+    0x4203,
+    0x00D4,
+    0x4203,
+    0x0002,
+    0x2000,
+    0x2A07,
+    0xD80E,
+    0x2301,
+    0x4093,
+    0x2288,
+    0x3010,
+    0x4213,
+    0xD108,
+    0x3A44,
+    0x3808,
+    0x4213,
+    0xD104,
+    0x3A22,
+    0x4013,
+    0x1E5A,
+    0x4193,
+    0x0098,
+    0x4770,
+    0xB510,
+    0x0004,
+    0xF7F9,
+    0xF988,
+    0x4A04,
+    0x7813,
+    0x069B,
+    0xD404,
+    0x231F,
+    0x401C,
+    0x3301,
+    0x4323,
+    0x7013,
+    0xBD10,
+    0x00D6,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF7FF,
+    0xFFEC,
+    0x4B0D,
+    0x781A,
+    0x4B0D,
+    0x0712,
+    0xD411,
+    0x2140,
+    0x4A0C,
+    0x6291,
+    0x2202,
+    0x631A,
+    0x4B0B,
+    0x781A,
+    0x2303,
+    0x401A,
+    0x3331,
+    0x4353,
+    0x4A09,
+    0x189B,
+    0x2204,
+    0x625A,
+    0xF7FC,
+    0xFBF2,
+    0xBD10,
+    0x4A07,
+    0x7014,
+    0x2201,
+    0x631A,
+    0xE7F9,
+    0x00C8,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x8000,
+    0x4200,
+    0x0248,
+    0x4203,
+    0x5000,
+    0x4201,
+    0x0355,
+    0x4203,
+    0xB5F0,
+    0x4B7F,
+    0xB085,
+    0x881A,
+    0xB291,
+    0x9101,
+    0x21C0,
+    0x0010,
+    0x00C9,
+    0x4008,
+    0x420A,
+    0xD104,
+    0x2101,
+    0x4A7A,
+    0x7010,
+    0x4A7A,
+    0x6311,
+    0x4A7A,
+    0x497A,
+    0x7814,
+    0x0764,
+    0xD40C,
+    0x7B8D,
+    0x2D03,
+    0xD13E,
+    0x4B78,
+    0x781C,
+    0x781B,
+    0x7814,
+    0x2504,
+    0x009B,
+    0x402B,
+    0x43AC,
+    0x4323,
+    0x7013,
+    0x7ACC,
+    0x2C00,
+    0xD100,
+    0xE0D5,
+    0x2800,
+    0xD107,
+    0x7BCB,
+    0x2B00,
+    0xD100,
+    0xE0CF,
+    0x7813,
+    0x075B,
+    0xD400,
+    0xE0CB,
+    0x4A6D,
+    0x496D,
+    0x7813,
+    0x9100,
+    0xB2DB,
+    0x700B,
+    0x2301,
+    0x704B,
+    0x8893,
+    0xB29B,
+    0x804B,
+    0x2C02,
+    0xD000,
+    0xE06A,
+    0x2400,
+    0x4B67,
+    0x4A68,
+    0x881B,
+    0x189B,
+    0x9303,
+    0x4B67,
+    0x781B,
+    0x1E58,
+    0xB2C0,
+    0x42A3,
+    0xD112,
+    0x9B01,
+    0x055B,
+    0xD44B,
+    0x23FF,
+    0x4A63,
+    0x8013,
+    0x2200,
+    0x4B57,
+    0x701A,
+    0x4B57,
+    0x3201,
+    0x631A,
+    0xE044,
+    0x781C,
+    0x781B,
+    0x7814,
+    0x095B,
+    0x412B,
+    0xE7BE,
+    0x2700,
+    0x1B02,
+    0x0FD3,
+    0x189B,
+    0x105B,
+    0x18E3,
+    0x9903,
+    0xB2DB,
+    0x00DA,
+    0x1852,
+    0x19D1,
+    0x780E,
+    0x25FF,
+    0xB2F1,
+    0x9102,
+    0x9900,
+    0x19C9,
+    0x7809,
+    0xB2C9,
+    0x468C,
+    0xB2F9,
+    0x2900,
+    0xD100,
+    0x9D02,
+    0x4666,
+    0x4035,
+    0x2605,
+    0x3101,
+    0xB2C9,
+    0x3701,
+    0x428E,
+    0xD313,
+    0x9902,
+    0x42A9,
+    0xD0E6,
+    0x4284,
+    0xD0C7,
+    0x9D00,
+    0x1D51,
+    0x1C56,
+    0x1AAA,
+    0x780D,
+    0x46AC,
+    0x1855,
+    0x782F,
+    0x45BC,
+    0xD911,
+    0x3B01,
+    0xB2D8,
+    0x42A0,
+    0xD2CC,
+    0xE7B8,
+    0x9902,
+    0x42A9,
+    0xD1EB,
+    0x9A01,
+    0x0552,
+    0xD5B6,
+    0x2BFF,
+    0xD1B4,
+    0x2005,
+    0xF7FF,
+    0xFF37,
+    0xB005,
+    0xBDF0,
+    0x780F,
+    0x782D,
+    0x42AF,
+    0xD202,
+    0x3301,
+    0xB2DC,
+    0xE7E8,
+    0x3901,
+    0x428E,
+    0xD1DD,
+    0xE7E4,
+    0x2400,
+    0x4B36,
+    0x4A32,
+    0x881B,
+    0x189B,
+    0x9303,
+    0x4B34,
+    0x781B,
+    0x1E58,
+    0xB2C0,
+    0x42A3,
+    0xD100,
+    0xE793,
+    0x1B02,
+    0x0FD3,
+    0x189B,
+    0x220C,
+    0x2700,
+    0x105B,
+    0x18E3,
+    0xB2DB,
+    0x435A,
+    0x9903,
+    0x1852,
+    0x19D1,
+    0x780E,
+    0x25FF,
+    0xB2F1,
+    0x9102,
+    0x9900,
+    0x19C9,
+    0x7809,
+    0xB2C9,
+    0x468C,
+    0xB2F9,
+    0x2900,
+    0xD100,
+    0x9D02,
+    0x4666,
+    0x4035,
+    0x260B,
+    0x3101,
+    0xB2C9,
+    0x3701,
+    0x428E,
+    0xD315,
+    0x9902,
+    0x42A9,
+    0xD0E6,
+    0x42A0,
+    0xD100,
+    0xE76C,
+    0x0011,
+    0x9D00,
+    0x1C56,
+    0x310B,
+    0x1AAA,
+    0x780D,
+    0x46AC,
+    0x1855,
+    0x782F,
+    0x45BC,
+    0xD908,
+    0x3B01,
+    0xB2D8,
+    0x42A0,
+    0xD2C9,
+    0xE75C,
+    0x9902,
+    0x42A9,
+    0xD1E9,
+    0xE7A2,
+    0x780F,
+    0x782D,
+    0x42AF,
+    0xD202,
+    0x3301,
+    0xB2DC,
+    0xE7F1,
+    0x3901,
+    0x428E,
+    0xD1E6,
+    0xE7ED,
+    0x2380,
+    0x005B,
+    0xE74E,
+    0x00C8,
+    0x4203,
+    0x0355,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0356,
+    0x4203,
+    0xCA4C,
+    0x4203,
+    0x00C9,
+    0x4203,
+    0xCA28,
+    0x4203,
+    0xCA1C,
+    0x4203,
+    0x00C0,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x00C2,
+    0x4203,
+    0x0360,
+    0x4203,
+    0x00C4,
+    0x4203,
+    0x00C6,
+    0x4203,
+    0x3801,
+    0xB510,
+    0x2807,
+    0xD866,
+    0x4A4A,
+    0xF7EE,
+    0xFEC7,
+    0x1204,
+    0x3624,
+    0x4C40,
+    0x6756,
+    0x7893,
+    0x2B00,
+    0xD10A,
+    0x2201,
+    0x4B46,
+    0x1889,
+    0x711A,
+    0xB2CB,
+    0x1892,
+    0x4944,
+    0x700A,
+    0x4A44,
+    0x6593,
+    0xBD10,
+    0x7A50,
+    0x2800,
+    0xD00E,
+    0x7A93,
+    0x1E5A,
+    0x4193,
+    0x005B,
+    0x1C9A,
+    0x2803,
+    0xD101,
+    0x3308,
+    0x001A,
+    0x188B,
+    0x493A,
+    0xB2DB,
+    0x710A,
+    0x2203,
+    0xE7E8,
+    0x7AD0,
+    0x2800,
+    0xD00E,
+    0x7B13,
+    0x1E5A,
+    0x4193,
+    0x005B,
+    0x1C9A,
+    0x2803,
+    0xD101,
+    0x3308,
+    0x001A,
+    0x188B,
+    0x4931,
+    0xB2DB,
+    0x710A,
+    0x2204,
+    0xE7D6,
+    0x7813,
+    0x2B00,
+    0xD006,
+    0x2201,
+    0x4B2D,
+    0x1889,
+    0x711A,
+    0xB2CB,
+    0x3204,
+    0xE7CC,
+    0x7813,
+    0x2B00,
+    0xD008,
+    0x4828,
+    0x7C03,
+    0x2B00,
+    0xD004,
+    0x7103,
+    0x185B,
+    0x2206,
+    0xB2DB,
+    0xE7C0,
+    0x7853,
+    0x2B00,
+    0xD006,
+    0x2202,
+    0x4B22,
+    0x1889,
+    0x711A,
+    0xB2CB,
+    0x3205,
+    0xE7B6,
+    0x7853,
+    0x2B00,
+    0xD00D,
+    0x481D,
+    0x88C3,
+    0x2B00,
+    0xD009,
+    0xB2DA,
+    0x1853,
+    0xB2DB,
+    0x7102,
+    0x2208,
+    0x4299,
+    0xD1A8,
+    0xF7FF,
+    0xFE77,
+    0xE7A9,
+    0x7853,
+    0x2B00,
+    0xD015,
+    0x4B17,
+    0x6C18,
+    0x17CB,
+    0xB280,
+    0x3802,
+    0x0FC4,
+    0x4281,
+    0x4163,
+    0x7814,
+    0x4810,
+    0xB2DB,
+    0x2C00,
+    0xD002,
+    0x7C44,
+    0x1B1B,
+    0xB2DB,
+    0x7944,
+    0x2C00,
+    0xD10C,
+    0x7A00,
+    0x287F,
+    0xD10E,
+    0x7993,
+    0x2B08,
+    0xD1E0,
+    0x2201,
+    0x4B08,
+    0x1889,
+    0x711A,
+    0xB2CB,
+    0x3208,
+    0xE782,
+    0x2C01,
+    0xD102,
+    0x7A00,
+    0x280F,
+    0xD0F0,
+    0x2B00,
+    0xD0BD,
+    0xE7ED,
+    0x46C0,
+    0xCA4C,
+    0x4203,
+    0xCA38,
+    0x4203,
+    0x00D5,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xB5F0,
+    0x4BC8,
+    0x0002,
+    0x781B,
+    0x2101,
+    0x091B,
+    0x0018,
+    0x4CC6,
+    0xB085,
+    0x4008,
+    0x420B,
+    0xD006,
+    0x2200,
+    0x4BC4,
+    0x701A,
+    0x6321,
+    0x46C0,
+    0xB005,
+    0xBDF0,
+    0x6853,
+    0x6DE2,
+    0x4DC1,
+    0xB292,
+    0x602B,
+    0x9202,
+    0x2A00,
+    0xD0F4,
+    0x2A02,
+    0xD000,
+    0xE11F,
+    0x4BBD,
+    0x781B,
+    0x2B00,
+    0xD001,
+    0xF7FC,
+    0xFB5C,
+    0x4ABB,
+    0x6C23,
+    0x8812,
+    0xB29B,
+    0x2010,
+    0x4293,
+    0xD900,
+    0xE082,
+    0x2101,
+    0x4BB8,
+    0x2403,
+    0x7019,
+    0x4BB7,
+    0x2004,
+    0x469C,
+    0x4AB7,
+    0x2500,
+    0x7394,
+    0x781B,
+    0x4383,
+    0x4660,
+    0x7003,
+    0x2080,
+    0x4BB4,
+    0x0040,
+    0x6C5B,
+    0x7213,
+    0x4BB3,
+    0x8018,
+    0x4BB3,
+    0x701D,
+    0x4BAA,
+    0x681B,
+    0x8818,
+    0xB2C7,
+    0x003E,
+    0x4FB0,
+    0xB283,
+    0x703E,
+    0x2707,
+    0x4038,
+    0x000F,
+    0x4087,
+    0xB2F8,
+    0x9000,
+    0x7190,
+    0x9E00,
+    0x48AC,
+    0x7006,
+    0x48AC,
+    0x7800,
+    0x0940,
+    0x4208,
+    0xD05F,
+    0x9800,
+    0x0680,
+    0xD55C,
+    0x1118,
+    0x4020,
+    0x7250,
+    0x1198,
+    0x4020,
+    0x2708,
+    0x72D0,
+    0x0018,
+    0x4038,
+    0x423B,
+    0xD049,
+    0x1258,
+    0x4008,
+    0x7010,
+    0x12D8,
+    0x4008,
+    0x7110,
+    0x1398,
+    0x4008,
+    0x73D0,
+    0x1298,
+    0x4008,
+    0x7090,
+    0x0BD8,
+    0x7050,
+    0x1318,
+    0x4020,
+    0x000C,
+    0x413B,
+    0x3002,
+    0x4084,
+    0x400B,
+    0x71D4,
+    0x7293,
+    0x7315,
+    0x7353,
+    0x70D5,
+    0x2004,
+    0x4C92,
+    0x7913,
+    0x7821,
+    0x009B,
+    0x4381,
+    0x4003,
+    0x430B,
+    0x7023,
+    0x79D4,
+    0x4B91,
+    0x2101,
+    0x701C,
+    0x4663,
+    0x7818,
+    0x7BD3,
+    0x4388,
+    0x400B,
+    0x4303,
+    0x4660,
+    0x7003,
+    0x7893,
+    0x7805,
+    0x408B,
+    0x2002,
+    0x4385,
+    0x4003,
+    0x432B,
+    0x4665,
+    0x2608,
+    0x702B,
+    0x7813,
+    0x782D,
+    0x00DB,
+    0x43B5,
+    0x4033,
+    0x432B,
+    0x4665,
+    0x702B,
+    0x4D84,
+    0x7993,
+    0x782D,
+    0x421D,
+    0xD177,
+    0x0008,
+    0xF7FF,
+    0xFD65,
+    0xE75D,
+    0x2304,
+    0x73D0,
+    0x6010,
+    0x7110,
+    0x71D3,
+    0x7290,
+    0x8190,
+    0xE7C7,
+    0x0B98,
+    0x9001,
+    0x4668,
+    0x4972,
+    0x7900,
+    0x2603,
+    0x9003,
+    0x72C8,
+    0x2001,
+    0x0007,
+    0x10DD,
+    0x4005,
+    0x700D,
+    0x111D,
+    0x4005,
+    0x710D,
+    0x115D,
+    0x4005,
+    0x73CD,
+    0x121D,
+    0x4005,
+    0x708D,
+    0x125D,
+    0x4005,
+    0x704D,
+    0x131D,
+    0x4035,
+    0x40AF,
+    0x129C,
+    0x119B,
+    0xB2FD,
+    0x4034,
+    0x4F69,
+    0x4003,
+    0x724C,
+    0x71CD,
+    0x70CB,
+    0x783F,
+    0x097F,
+    0x4207,
+    0xD003,
+    0x002F,
+    0x4037,
+    0x4235,
+    0xD013,
+    0x0020,
+    0x1E45,
+    0x41A8,
+    0x7288,
+    0x9803,
+    0x1E45,
+    0x41A8,
+    0x7308,
+    0x2000,
+    0x7348,
+    0x4284,
+    0xD08E,
+    0x9801,
+    0x2800,
+    0xD08B,
+    0x2001,
+    0x4058,
+    0x7308,
+    0x734B,
+    0xE786,
+    0x076D,
+    0xD584,
+    0x9D00,
+    0x072D,
+    0xD081,
+    0x0025,
+    0x1E6E,
+    0x41B5,
+    0x728D,
+    0x9D03,
+    0x734F,
+    0x1E6E,
+    0x41B5,
+    0x688E,
+    0x730D,
+    0x0037,
+    0x4D54,
+    0x402F,
+    0x422E,
+    0xD101,
+    0x728B,
+    0xE770,
+    0x4058,
+    0x2C00,
+    0xD004,
+    0x9C01,
+    0x2C00,
+    0xD106,
+    0x7288,
+    0xE768,
+    0x9C01,
+    0x2C00,
+    0xD001,
+    0x7308,
+    0xE763,
+    0x4C4B,
+    0x4941,
+    0x42A7,
+    0xD1D5,
+    0x2300,
+    0x7288,
+    0x730B,
+    0xE75B,
+    0x4D48,
+    0x782D,
+    0x422C,
+    0xD084,
+    0x7A50,
+    0x2801,
+    0xD101,
+    0x3009,
+    0xE77F,
+    0x7AD2,
+    0x2009,
+    0x2A01,
+    0xD100,
+    0xE77A,
+    0x2A00,
+    0xD126,
+    0x420B,
+    0xD024,
+    0x4B40,
+    0x781B,
+    0x420B,
+    0xD120,
+    0x2003,
+    0xE770,
+    0x792C,
+    0x9A02,
+    0x4E30,
+    0x4F3D,
+    0x1B14,
+    0x7A32,
+    0x18E4,
+    0x703A,
+    0x2203,
+    0x707A,
+    0x4A2A,
+    0x7810,
+    0x3802,
+    0x2807,
+    0xD900,
+    0xE6C1,
+    0xF7EE,
+    0xFCF0,
+    0x0008,
+    0x0015,
+    0x0163,
+    0x01CF,
+    0x000D,
+    0x01EC,
+    0x000D,
+    0x021A,
+    0x789B,
+    0x4A32,
+    0xB2DB,
+    0x7173,
+    0x7013,
+    0x4B20,
+    0x7818,
+    0x466B,
+    0xB2C0,
+    0x7A19,
+    0xF7FF,
+    0xFDFA,
+    0xE6AA,
+    0x7AB5,
+    0x2D00,
+    0xD067,
+    0x2202,
+    0x0021,
+    0x482A,
+    0xF000,
+    0xFB65,
+    0x4B2A,
+    0x88BA,
+    0x881B,
+    0x429A,
+    0xD057,
+    0x23FF,
+    0x4A24,
+    0x70BB,
+    0x70FB,
+    0x4B26,
+    0x4694,
+    0x7819,
+    0x2300,
+    0xB2C9,
+    0x428B,
+    0xD300,
+    0xE200,
+    0x4823,
+    0x011A,
+    0x1810,
+    0x6806,
+    0x4660,
+    0x6800,
+    0x4030,
+    0x4286,
+    0xD107,
+    0x4820,
+    0x1812,
+    0x6812,
+    0x6878,
+    0x4042,
+    0xB292,
+    0x2A00,
+    0xD03F,
+    0x3301,
+    0xE7E9,
+    0x46C0,
+    0x00C8,
+    0x4203,
+    0x6000,
+    0x4200,
+    0x0355,
+    0x4203,
+    0xCA38,
+    0x4203,
+    0x034D,
+    0x4203,
+    0x034E,
+    0x4203,
+    0x00D5,
+    0x4203,
+    0x0356,
+    0x4203,
+    0xCA4C,
+    0x4203,
+    0x8000,
+    0x4200,
+    0x0362,
+    0x4203,
+    0x00E0,
+    0x4203,
+    0x00D4,
+    0x4203,
+    0x0353,
+    0x4203,
+    0x00C9,
+    0x4203,
+    0x0354,
+    0x4203,
+    0x00CB,
+    0x4203,
+    0xFF00,
+    0xFF00,
+    0x0300,
+    0x0300,
+    0x00CC,
+    0x4203,
+    0x00CD,
+    0x4203,
+    0xCA28,
+    0x4203,
+    0x0358,
+    0x4203,
+    0xCA2C,
+    0x4203,
+    0x00D2,
+    0x4203,
+    0x00AE,
+    0x4203,
+    0x0080,
+    0x4203,
+    0x0084,
+    0x4203,
+    0x4BBF,
+    0x781B,
+    0x075B,
+    0xD400,
+    0xE1B4,
+    0x3402,
+    0x4BBD,
+    0x7A5A,
+    0x2A02,
+    0xD160,
+    0x0021,
+    0x1CB8,
+    0xF000,
+    0xFAFA,
+    0x4ABA,
+    0x78FB,
+    0x78B8,
+    0x8811,
+    0x021B,
+    0x4303,
+    0x428B,
+    0xD04E,
+    0x4BB7,
+    0x2001,
+    0x7819,
+    0x0709,
+    0xD400,
+    0xE776,
+    0x781B,
+    0x49B5,
+    0x089B,
+    0x4203,
+    0xD02B,
+    0x88B8,
+    0x8813,
+    0x4298,
+    0xD027,
+    0x2D00,
+    0xD025,
+    0x2300,
+    0x780C,
+    0xB2E4,
+    0x42A3,
+    0xD305,
+    0x22FF,
+    0x4BAA,
+    0x739A,
+    0xE021,
+    0x3301,
+    0xE7F7,
+    0x4AAB,
+    0x0118,
+    0x1882,
+    0x6815,
+    0x683A,
+    0x0011,
+    0x0C12,
+    0x4029,
+    0xB289,
+    0x0412,
+    0x4311,
+    0x428D,
+    0xD1F0,
+    0x4AA6,
+    0x1880,
+    0x6802,
+    0x6879,
+    0x404A,
+    0xB292,
+    0x2A00,
+    0xD1E8,
+    0x4A9D,
+    0xB2DB,
+    0x7393,
+    0x4AA1,
+    0x8013,
+    0xE745,
+    0x2300,
+    0x7809,
+    0xB2C9,
+    0x428B,
+    0xD301,
+    0x2006,
+    0xE690,
+    0x489A,
+    0x011A,
+    0x1812,
+    0x6810,
+    0x683A,
+    0x0014,
+    0x0C12,
+    0x4004,
+    0xB2A4,
+    0x0412,
+    0x4322,
+    0x4290,
+    0xD001,
+    0x3301,
+    0xE7EC,
+    0xB2DB,
+    0xE7E4,
+    0x4B8D,
+    0x781B,
+    0x079B,
+    0xD500,
+    0xE728,
+    0xE7E6,
+    0x4E8D,
+    0x7833,
+    0x071B,
+    0xD400,
+    0xE722,
+    0x2208,
+    0x0021,
+    0x1DB8,
+    0xF000,
+    0xFA93,
+    0x23FF,
+    0x2101,
+    0x70BB,
+    0x70FB,
+    0x88BB,
+    0x4A86,
+    0xB29B,
+    0x9300,
+    0x7833,
+    0x089B,
+    0x420B,
+    0xD031,
+    0x4B81,
+    0x9900,
+    0x881B,
+    0x4299,
+    0xD02C,
+    0x2D00,
+    0xD02A,
+    0x7813,
+    0x2100,
+    0xB2DB,
+    0x469C,
+    0x260E,
+    0x4561,
+    0xD29C,
+    0x4B7D,
+    0x010C,
+    0x18E4,
+    0x2300,
+    0x18E0,
+    0x18FA,
+    0x6800,
+    0x1AF5,
+    0x6812,
+    0x2D03,
+    0xD80C,
+    0x4D7A,
+    0x4042,
+    0x4215,
+    0xD112,
+    0x3304,
+    0x2B10,
+    0xD1F1,
+    0x4B70,
+    0x7399,
+    0x4B77,
+    0x9A00,
+    0x809A,
+    0xE6EB,
+    0x2B03,
+    0xD804,
+    0x4002,
+    0x4290,
+    0xD104,
+    0x2304,
+    0xE7E4,
+    0x2501,
+    0x426D,
+    0xE7E9,
+    0x3101,
+    0xE7D9,
+    0x2501,
+    0x2000,
+    0x426D,
+    0x80BD,
+    0x7813,
+    0xB2DB,
+    0x9301,
+    0x9B01,
+    0x4298,
+    0xD294,
+    0x4A66,
+    0x0103,
+    0x4694,
+    0x449C,
+    0x2300,
+    0x4662,
+    0x240E,
+    0x189A,
+    0x6812,
+    0x18F9,
+    0x1AE4,
+    0x2C03,
+    0xD808,
+    0x680C,
+    0x4962,
+    0x4062,
+    0x4211,
+    0xD117,
+    0x3304,
+    0x2B10,
+    0xD1EF,
+    0xE7CF,
+    0x680C,
+    0x2B05,
+    0xD80E,
+    0x2106,
+    0x1AC9,
+    0x2903,
+    0xD908,
+    0x0029,
+    0x0026,
+    0x4396,
+    0x4031,
+    0x4061,
+    0x428A,
+    0xD105,
+    0x3304,
+    0xE7DE,
+    0x4956,
+    0xE7F5,
+    0x0029,
+    0xE7E4,
+    0x3001,
+    0xE7D0,
+    0x7B33,
+    0x2B00,
+    0xD005,
+    0x0021,
+    0x2202,
+    0x4852,
+    0xF000,
+    0xFA17,
+    0x3402,
+    0x2301,
+    0x79B2,
+    0x421A,
+    0xD021,
+    0x4A47,
+    0x7812,
+    0x421A,
+    0xD04C,
+    0x33FE,
+    0x70BB,
+    0x4A4A,
+    0x70FB,
+    0x4B44,
+    0x4694,
+    0x7819,
+    0x2300,
+    0xB2C9,
+    0x428B,
+    0xD23C,
+    0x4842,
+    0x011A,
+    0x1810,
+    0x6805,
+    0x4660,
+    0x6800,
+    0x4028,
+    0x4285,
+    0xD107,
+    0x483E,
+    0x1812,
+    0x6812,
+    0x6878,
+    0x4042,
+    0xB292,
+    0x2A00,
+    0xD02C,
+    0x3301,
+    0xE7EA,
+    0x210A,
+    0x420A,
+    0xD02B,
+    0x4A35,
+    0x7812,
+    0x0852,
+    0x421A,
+    0xD026,
+    0x7A73,
+    0x2B00,
+    0xD123,
+    0x22FF,
+    0x70BA,
+    0x70FA,
+    0x3AFD,
+    0x707A,
+    0x4A2F,
+    0x7811,
+    0x4A33,
+    0xB2C9,
+    0x4694,
+    0x428B,
+    0xD212,
+    0x482D,
+    0x011A,
+    0x1810,
+    0x6805,
+    0x4660,
+    0x6800,
+    0x4028,
+    0x4285,
+    0xD107,
+    0x4829,
+    0x1812,
+    0x6812,
+    0x6878,
+    0x4042,
+    0xB292,
+    0x2A00,
+    0xD002,
+    0x3301,
+    0xE7EA,
+    0x23FF,
+    0x73B3,
+    0x2BFF,
+    0xD100,
+    0xE62A,
+    0x7AF2,
+    0x2A02,
+    0xD008,
+    0x2A03,
+    0xD000,
+    0xE645,
+    0x4824,
+    0x3205,
+    0x0021,
+    0xF000,
+    0xF9B6,
+    0xE63F,
+    0x4821,
+    0xE7F9,
+    0x4B21,
+    0x601C,
+    0x2301,
+    0x7822,
+    0x0951,
+    0xB2D0,
+    0x438B,
+    0x06D2,
+    0x009B,
+    0x0F92,
+    0x2A02,
+    0xD00C,
+    0x2A03,
+    0xD00C,
+    0x2A01,
+    0xD006,
+    0x742B,
+    0x2307,
+    0x4018,
+    0xF7FF,
+    0xFABE,
+    0x7468,
+    0xE626,
+    0x3301,
+    0xE7F6,
+    0x3305,
+    0xE7F4,
+    0x3309,
+    0xE7F2,
+    0x7862,
+    0x7823,
+    0x0212,
+    0x189B,
+    0xB29B,
+    0x0BDA,
+    0x716A,
+    0xD11F,
+    0x327F,
+    0x401A,
+    0x80EA,
+    0x09DB,
+    0x722B,
+    0xE612,
+    0x00CD,
+    0x4203,
+    0xCA4C,
+    0x4203,
+    0x00D2,
+    0x4203,
+    0x00CE,
+    0x4203,
+    0x00AE,
+    0x4203,
+    0x0080,
+    0x4203,
+    0x0084,
+    0x4203,
+    0x0362,
+    0x4203,
+    0xFFFF,
+    0x0000,
+    0xCA28,
+    0x4203,
+    0xCA2C,
+    0x4203,
+    0xCA20,
+    0x4203,
+    0x035C,
+    0x4203,
+    0x055A,
+    0x0D52,
+    0x045B,
+    0x80EA,
+    0x0F1B,
+    0xE7DD,
+    0x7823,
+    0xB2DA,
+    0x2B04,
+    0xD104,
+    0x490B,
+    0x780B,
+    0x4393,
+    0x4313,
+    0x700B,
+    0x4B0A,
+    0x781B,
+    0x06DB,
+    0xD400,
+    0xE5E4,
+    0x4B08,
+    0x2007,
+    0x781B,
+    0x429A,
+    0xD100,
+    0xE5DE,
+    0xE52F,
+    0x4B04,
+    0x781B,
+    0x075B,
+    0xD400,
+    0xE64A,
+    0x2004,
+    0xE528,
+    0x0356,
+    0x4203,
+    0x00CE,
+    0x4203,
+    0x00CA,
+    0x4203,
+    0xB510,
+    0x0004,
+    0xF7F8,
+    0xFC02,
+    0x4908,
+    0x780B,
+    0x069B,
+    0xD404,
+    0x221F,
+    0x2320,
+    0x4022,
+    0x4313,
+    0x700B,
+    0x4B05,
+    0x781B,
+    0x071B,
+    0x0FD8,
+    0x2B00,
+    0xDA01,
+    0x4B03,
+    0x701C,
+    0xBD10,
+    0x00D6,
+    0x4203,
+    0x00C8,
+    0x4203,
+    0x0355,
+    0x4203,
+    0xB510,
+    0x4B0B,
+    0x2201,
+    0x781B,
+    0x4C0A,
+    0x099B,
+    0x0018,
+    0x4010,
+    0x4213,
+    0xD107,
+    0x6C63,
+    0x0010,
+    0x091B,
+    0x4213,
+    0xD102,
+    0x3007,
+    0xF7FF,
+    0xFFD2,
+    0x6C63,
+    0x04DB,
+    0x0FDB,
+    0x3B01,
+    0x4018,
+    0xBD10,
+    0x00C9,
+    0x4203,
+    0x6000,
+    0x4200,
+    0xB5F0,
+    0x4B3C,
+    0x6906,
+    0x6FDB,
+    0x0004,
+    0xB089,
+    0x051B,
+    0xD466,
+    0x89C3,
+    0x2B00,
+    0xD11C,
+    0x8833,
+    0x059B,
+    0xD519,
+    0x0003,
+    0x3330,
+    0x781B,
+    0xB2DD,
+    0x2B00,
+    0xD013,
+    0x4B33,
+    0x21A0,
+    0x6818,
+    0x4B33,
+    0x19AD,
+    0x6D9B,
+    0x1AC0,
+    0xF7EE,
+    0xFA69,
+    0xB2C3,
+    0xB280,
+    0x70AB,
+    0x0A00,
+    0x4B2F,
+    0x70E8,
+    0x881B,
+    0xB2DA,
+    0x0A1B,
+    0x712A,
+    0x716B,
+    0x0021,
+    0x2201,
+    0x312C,
+    0x780B,
+    0x4213,
+    0xD040,
+    0x780B,
+    0x089B,
+    0x4213,
+    0xD13C,
+    0x4B27,
+    0xAD01,
+    0x881F,
+    0x4B27,
+    0x18B0,
+    0x18FB,
+    0x61AB,
+    0x4B26,
+    0x18FF,
+    0x683B,
+    0x0023,
+    0x332E,
+    0x781B,
+    0x18C0,
+    0x683B,
+    0x001A,
+    0x4B22,
+    0x601A,
+    0x2301,
+    0x7809,
+    0x0849,
+    0x4219,
+    0xD127,
+    0xBA13,
+    0x4669,
+    0x2204,
+    0x9300,
+    0xF000,
+    0xF8BF,
+    0x89E3,
+    0x8922,
+    0x342F,
+    0x7820,
+    0x2404,
+    0x1999,
+    0xB2D2,
+    0xB2DB,
+    0x70AC,
+    0x1AC4,
+    0x18D3,
+    0x3B04,
+    0x1A1B,
+    0x70EB,
+    0x1852,
+    0x4B15,
+    0x3A04,
+    0x702C,
+    0x881B,
+    0x60EA,
+    0x4A10,
+    0x1986,
+    0x189B,
+    0x60AB,
+    0x2300,
+    0x0028,
+    0x6069,
+    0x612E,
+    0x616E,
+    0x706B,
+    0xF7FC,
+    0xFC65,
+    0xB009,
+    0xBDF0,
+    0x0001,
+    0x2204,
+    0x4668,
+    0xF000,
+    0xF898,
+    0x9B00,
+    0xBA1B,
+    0x603B,
+    0xE7D4,
+    0x8000,
+    0x4200,
+    0x0370,
+    0x4203,
+    0x9000,
+    0x4201,
+    0x0374,
+    0x4203,
+    0x037A,
+    0x4203,
+    0x8000,
+    0x4203,
+    0x8008,
+    0x4203,
+    0xCA64,
+    0x4203,
+    0x037C,
+    0x4203,
+    0x2101,
+    0xB510,
+    0x302C,
+    0x7803,
+    0x420B,
+    0xD01B,
+    0x7803,
+    0x089B,
+    0x420B,
+    0xD117,
+    0x4B0D,
+    0x4C0E,
+    0x881B,
+    0xB29A,
+    0x3B01,
+    0xB29B,
+    0x42A3,
+    0xD80F,
+    0x7803,
+    0x4C0B,
+    0x40CB,
+    0x1912,
+    0x420B,
+    0xD10A,
+    0x6813,
+    0xBA1B,
+    0x185B,
+    0xBA1B,
+    0x6013,
+    0x2304,
+    0x7802,
+    0x439A,
+    0x4313,
+    0x7003,
+    0xBD10,
+    0x4B04,
+    0x681B,
+    0xE7F5,
+    0x037A,
+    0x4203,
+    0xFFFD,
+    0x0000,
+    0x8008,
+    0x4203,
+    0xCA64,
+    0x4203,
+    0xB5F0,
+    0x0005,
+    0x0783,
+    0xD049,
+    0x1E54,
+    0x2A00,
+    0xD045,
+    0x0003,
+    0x2603,
+    0xB2CA,
+    0xE002,
+    0x3501,
+    0x3C01,
+    0xD33E,
+    0x3301,
+    0x702A,
+    0x4233,
+    0xD1F8,
+    0x2C03,
+    0xD930,
+    0x22FF,
+    0x400A,
+    0x0215,
+    0x18AD,
+    0x042A,
+    0x18AD,
+    0x2C0F,
+    0xD934,
+    0x0027,
+    0x3F10,
+    0x093F,
+    0x013E,
+    0x46B4,
+    0x001E,
+    0x001A,
+    0x3610,
+    0x4466,
+    0x6015,
+    0x6055,
+    0x6095,
+    0x60D5,
+    0x3210,
+    0x4296,
+    0xD1F8,
+    0x3701,
+    0x013F,
+    0x19DB,
+    0x270F,
+    0x220C,
+    0x4027,
+    0x4022,
+    0x003C,
+    0x2A00,
+    0xD00E,
+    0x1F3E,
+    0x08B6,
+    0x00B4,
+    0x46A4,
+    0x001A,
+    0x1D1C,
+    0x4464,
+    0xC220,
+    0x42A2,
+    0xD1FC,
+    0x2403,
+    0x3601,
+    0x00B6,
+    0x199B,
+    0x403C,
+    0x2C00,
+    0xD005,
+    0xB2C9,
+    0x191C,
+    0x7019,
+    0x3301,
+    0x429C,
+    0xD1FB,
+    0xBDF0,
+    0x0003,
+    0x0014,
+    0xE7C0,
+    0x0027,
+    0xE7E2,
+    0x46C0,
+    0xB5F0,
+    0x0005,
+    0x2A0F,
+    0xD933,
+    0x2403,
+    0x0003,
+    0x0026,
+    0x430B,
+    0x401E,
+    0x421C,
+    0xD137,
+    0x0015,
+    0x3D10,
+    0x092D,
+    0x0003,
+    0x000C,
+    0x46AC,
+    0x012F,
+    0x183F,
+    0x6865,
+    0x605D,
+    0x68A5,
+    0x609D,
+    0x68E5,
+    0x60DD,
+    0x6825,
+    0x3410,
+    0x601D,
+    0x001D,
+    0x3310,
+    0x42BD,
+    0xD1F2,
+    0x4665,
+    0x230F,
+    0x240C,
+    0x3501,
+    0x012D,
+    0x1949,
+    0x4013,
+    0x1945,
+    0x4214,
+    0xD01A,
+    0x598C,
+    0x51AC,
+    0x3604,
+    0x1B9C,
+    0x2C03,
+    0xD8F9,
+    0x3B04,
+    0x089B,
+    0x3301,
+    0x009B,
+    0x18ED,
+    0x18C9,
+    0x2303,
+    0x401A,
+    0x1E56,
+    0x2A00,
+    0xD006,
+    0x2300,
+    0x5CCC,
+    0x001A,
+    0x54EC,
+    0x3301,
+    0x4296,
+    0xD1F9,
+    0xBDF0,
+    0x1E56,
+    0xE7F5,
+    0x001A,
+    0xE7F0,
+    0x46C0,
+    0xB5F0,
+    0x46CE,
+    0x4699,
+    0x0C03,
+    0x469C,
+    0x0413,
+    0x4647,
+    0x0C1B,
+    0x001D,
+    0x000E,
+    0x4661,
+    0x0404,
+    0x0C24,
+    0xB580,
+    0x0007,
+    0x0C10,
+    0x434B,
+    0x4365,
+    0x4341,
+    0x4360,
+    0x0C2C,
+    0x18C0,
+    0x1824,
+    0x468C,
+    0x42A3,
+    0xD903,
+    0x2380,
+    0x025B,
+    0x4698,
+    0x44C4,
+    0x4649,
+    0x4379,
+    0x4356,
+    0x0C23,
+    0x042D,
+    0x0C2D,
+    0x1989,
+    0x4463,
+    0x0424,
+    0x1960,
+    0x18C9,
+    0xBCC0,
+    0x46B9,
+    0x46B0,
+    0xBDF0,
+    0x46C0,
+    0xB5F0,
+    0x4657,
+    0x464E,
+    0x4645,
+    0x46DE,
+    0xB5E0,
+    0x0004,
+    0x000D,
+    0x4692,
+    0x4699,
+    0xB083,
+    0x428B,
+    0xD830,
+    0xD02D,
+    0x4649,
+    0x4650,
+    0xF7EE,
+    0xFA86,
+    0x0029,
+    0x0006,
+    0x0020,
+    0xF7EE,
+    0xFA81,
+    0x1A33,
+    0x4698,
+    0x3B20,
+    0xD434,
+    0x469B,
+    0x4653,
+    0x465A,
+    0x4093,
+    0x4642,
+    0x001F,
+    0x4653,
+    0x4093,
+    0x001E,
+    0x42AF,
+    0xD83B,
+    0x42AF,
+    0xD100,
+    0xE079,
+    0x465B,
+    0x1BA4,
+    0x41BD,
+    0x2B00,
+    0xDA00,
+    0xE076,
+    0x2200,
+    0x2300,
+    0x9200,
+    0x9301,
+    0x2301,
+    0x465A,
+    0x4093,
+    0x9301,
+    0x2301,
+    0x4642,
+    0x4093,
+    0x9300,
+    0xE029,
+    0x4282,
+    0xD9CF,
+    0x2200,
+    0x2300,
+    0x9200,
+    0x9301,
+    0x9B0C,
+    0x2B00,
+    0xD001,
+    0x601C,
+    0x605D,
+    0x9800,
+    0x9901,
+    0xB003,
+    0xBCF0,
+    0x46BB,
+    0x46B2,
+    0x46A9,
+    0x46A0,
+    0xBDF0,
+    0x4642,
+    0x469B,
+    0x2320,
+    0x1A9B,
+    0x4652,
+    0x40DA,
+    0x4641,
+    0x0013,
+    0x464A,
+    0x408A,
+    0x0017,
+    0x4642,
+    0x431F,
+    0x4653,
+    0x4093,
+    0x001E,
+    0x42AF,
+    0xD9C3,
+    0x2200,
+    0x2300,
+    0x9200,
+    0x9301,
+    0x4643,
+    0x2B00,
+    0xD0D8,
+    0x07FB,
+    0x0872,
+    0x431A,
+    0x4646,
+    0x087B,
+    0xE00E,
+    0x42AB,
+    0xD101,
+    0x42A2,
+    0xD80C,
+    0x1AA4,
+    0x419D,
+    0x2001,
+    0x1924,
+    0x416D,
+    0x2100,
+    0x3E01,
+    0x1824,
+    0x414D,
+    0x2E00,
+    0xD006,
+    0x42AB,
+    0xD9EE,
+    0x3E01,
+    0x1924,
+    0x416D,
+    0x2E00,
+    0xD1F8,
+    0x9800,
+    0x9901,
+    0x465B,
+    0x1900,
+    0x4169,
+    0x2B00,
+    0xDB24,
+    0x002B,
+    0x465A,
+    0x4644,
+    0x40D3,
+    0x002A,
+    0x40E2,
+    0x001C,
+    0x465B,
+    0x0015,
+    0x2B00,
+    0xDB2A,
+    0x0026,
+    0x409E,
+    0x0033,
+    0x0026,
+    0x4647,
+    0x40BE,
+    0x0032,
+    0x1A80,
+    0x4199,
+    0x9000,
+    0x9101,
+    0xE79E,
+    0x42A3,
+    0xD8BC,
+    0xE782,
+    0x4642,
+    0x2320,
+    0x2100,
+    0x1A9B,
+    0x2200,
+    0x9100,
+    0x9201,
+    0x2201,
+    0x40DA,
+    0x9201,
+    0xE785,
+    0x4642,
+    0x2320,
+    0x1A9B,
+    0x002A,
+    0x4646,
+    0x409A,
+    0x0023,
+    0x40F3,
+    0x4644,
+    0x4313,
+    0x002A,
+    0x40E2,
+    0x001C,
+    0x465B,
+    0x0015,
+    0x2B00,
+    0xDAD4,
+    0x4642,
+    0x002F,
+    0x2320,
+    0x0026,
+    0x4097,
+    0x1A9B,
+    0x40DE,
+    0x003B,
+    0x4333,
+    0xE7CD,
+    0xB401,
+    0x4802,
+    0x4684,
+    0xBC01,
+    0x4760,
+    0xBF00,
+    0x57E1,
+    0x2200,
+    0xB401,
+    0x4802,
+    0x4684,
+    0xBC01,
+    0x4760,
+    0xBF00,
+    0x4AD5,
+    0x2200,
+    0xB401,
+    0x4802,
+    0x4684,
+    0xBC01,
+    0x4760,
+    0xBF00,
+    0x4A81,
+    0x2200,
+    0xB401,
+    0x4802,
+    0x4684,
+    0xBC01,
+    0x4760,
+    0xBF00,
+    0x4E3D,
+    0x2200,
+    0xB401,
+    0x4802,
+    0x4684,
+    0xBC01,
+    0x4760,
+    0xBF00,
+    0x4BA1,
+    0x2200,
+    0xB401,
+    0x4802,
+    0x4684,
+    0xBC01,
+    0x4760,
+    0xBF00,
+    0x5A59,
+    0x2200,
+    0x0820,
+    0x4004,
+    0x6210,
+    0x7367,
+    0x5F63,
+    0x7573,
+    0x7070,
+    0x726F,
+    0x2E74,
+    0x0000,
+    0x0408,
+    0x020C,
+    0x060A,
+    0x010E,
+    0x0509,
+    0x030D,
+    0x070B,
+    0x200F,
+    0x0408,
+    0x1040,
+    0x0820,
+    0x0804,
+    0x0808,
+    0x0201,
+    0x0A0A,
+    0x2630,
+    0x2096,
+    0x0408,
+    0x1040,
+    0x2630,
+    0x2096,
+    0x0408,
+    0x0808,
+    0x0108,
+    0x0A02,
+    0x630A,
+    0x7369,
+    0x002E,
+    0x2630,
+    0x2096,
+    0x0408,
+    0x1040,
+    0x0820,
+    0x0804,
+    0x0808,
+    0x0201,
+    0x0A0A,
+    0x0606,
+    0x0201,
+    0x1203,
+    0x0001,
+    0x7872,
+    0x665F,
+    0x6C69,
+    0x6574,
+    0x2E72,
+    0x2000,
+    0x0408,
+    0x1040,
+    0x0820,
+    0x4004,
+    0x2010,
+    0x0408,
+    0x0808,
+    0x0108,
+    0x0A02,
+    0x010A,
+    0x0402,
+    0x3000,
+    0x9626,
+    0x0820,
+    0x0804,
+    0x0808,
+    0x0201,
+    0x0A0A,
+    0x7573,
+    0x6562,
+    0x5F76,
+    0x7573,
+    0x7070,
+    0x726F,
+    0x2E74,
+    0x2000,
+    0x0408,
+    0x0808,
+    0x0108,
+    0x0A02,
+    0x000A,
+    0xD400,
+    0x4200,
+    0x0002,
+    0x0000,
+    0xD400,
+    0x4200,
+    0x0302,
+    0x0000,
+    0xD540,
+    0x4200,
+    0x1006,
+    0x0001,
+    0xD540,
+    0x4200,
+    0x1606,
+    0x0001,
+    0xD398,
+    0x4200,
+    0x1001,
+    0x0000,
+    0xD398,
+    0x4200,
+    0x1101,
+    0x0000,
+    0xD534,
+    0x4200,
+    0x0003,
+    0x0000,
+    0xD534,
+    0x4200,
+    0x0303,
+    0x0000,
+    0xD534,
+    0x4200,
+    0x1801,
+    0x0000,
+    0xD538,
+    0x4200,
+    0x0001,
+    0x0000,
+    0x901C,
+    0x4200,
+    0x1E01,
+    0x0000,
+    0x9020,
+    0x4200,
+    0x0E01,
+    0x0000,
+    0x903C,
+    0x4200,
+    0x1E01,
+    0x0000,
+    0x9040,
+    0x4200,
+    0x0E01,
+    0x0000,
+    0x901C,
+    0x4200,
+    0x1A01,
+    0x0000,
+    0x9020,
+    0x4200,
+    0x0A01,
+    0x0000,
+    0x903C,
+    0x4200,
+    0x1A01,
+    0x0000,
+    0x9040,
+    0x4200,
+    0x0A01,
+    0x0000,
+    0x00D0,
+    0x0103,
+    0x0110,
+    0x0204,
+    0x0000,
+    0x0002,
+    0x00B0,
+    0x0977,
+    0x0090,
+    0x00A0,
+    0x0000,
+    0x0018,
+    0x00D0,
+    0x116F,
+    0x0090,
+    0x0096,
+    0x0000,
+    0x000E,
+    0x00B0,
+    0x198D,
+    0x00D0,
+    0x0188,
+    0x0000,
+    0x0004,
+    0x00B0,
+    0x2183,
+    0x00D0,
+    0x01FE,
+    0x0000,
+    0xFFFA,
+    0x00D0,
+    0x29F7,
+    0x00D0,
+    0x01F4,
+    0x0000,
+    0xFFF0,
+    0x00D0,
+    0x3107,
+    0x00D0,
+    0x0104,
+    0x0000,
+    0x0006,
+    0x00D0,
+    0x39A3,
+    0x00D0,
+    0x017A,
+    0x0000,
+    0xFFFC,
+    0x00B0,
+    0x4171,
+    0x0110,
+    0x0292,
+    0x0000,
+    0x0012,
+    0x00B0,
+    0x4991,
+    0x00D0,
+    0x018C,
+    0x0000,
+    0x0008,
+    0x00B0,
+    0x5187,
+    0x00D0,
+    0x0182,
+    0x0000,
+    0xFFFE,
+    0x00D0,
+    0x59FB,
+    0x00D0,
+    0x01F8,
+    0x0000,
+    0xFFF4,
+    0x00D0,
+    0x61F1,
+    0x00D0,
+    0x01EE,
+    0x0000,
+    0xFFEA,
+    0x00B0,
+    0x69E9,
+    0x00D0,
+    0x01E4,
+    0x0000,
+    0xFFE0,
+    0x00B0,
+    0x7175,
+    0x0090,
+    0x009E,
+    0x0000,
+    0x0016,
+    0x00B0,
+    0x7995,
+    0x00B0,
+    0x0192,
+    0x0000,
+    0x000C,
+    0x0090,
+    0x0005,
+    0x0170,
+    0x0410,
+    0x0000,
+    0x0008,
+    0x00D0,
+    0x0105,
+    0x0090,
+    0x007E,
+    0x0000,
+    0x0004,
+    0x0090,
+    0x007D,
+    0x0090,
+    0x00E8,
+    0x0000,
+    0xFFE0,
+    0x0090,
+    0x08E7,
+    0x00D0,
+    0x017A,
+    0x0000,
+    0xFFFC,
+    0x00D0,
+    0x0979,
+    0x0090,
+    0x0072,
+    0x0000,
+    0xFFF8,
+    0x0090,
+    0x1071,
+    0x00B0,
+    0x0170,
+    0x0000,
+    0xFFF4,
+    0x00D0,
+    0x1171,
+    0x0090,
+    0x006A,
+    0x0000,
+    0xFFF0,
+    0x0090,
+    0x1069,
+    0x00D0,
+    0x016A,
+    0x0000,
+    0xFFEC,
+    0x00D0,
+    0x1969,
+    0x0090,
+    0x0062,
+    0x0000,
+    0xFFE8,
+    0x0090,
+    0x1861,
+    0x00B0,
+    0x0120,
+    0x0000,
+    0xFFE4,
+    0x00D0,
+    0x2121,
+    0x0090,
+    0x001A,
+    0x0000,
+    0xFFE0,
+    0x0090,
+    0x2019,
+    0x00F0,
+    0x021C,
+    0x0000,
+    0x001C,
+    0x00D0,
+    0x2119,
+    0x00D0,
+    0x0116,
+    0x0000,
+    0x0018,
+    0x00D0,
+    0x2915,
+    0x0090,
+    0x000E,
+    0x0000,
+    0x0014,
+    0x0090,
+    0x280D,
+    0x00B0,
+    0x010C,
+    0x0000,
+    0x0010,
+    0x00D0,
+    0x310D,
+    0x0090,
+    0x0006,
+    0x0000,
+    0x000C,
+    0x0090,
+    0x3005,
+    0x0170,
+    0x0410,
+    0x0000,
+    0x0008,
+    0x00D0,
+    0x3105,
+    0x0090,
+    0x007E,
+    0x0000,
+    0x0004,
+    0x0090,
+    0x387D,
+    0x0090,
+    0x00E8,
+    0x0000,
+    0xFFE0,
+    0x0090,
+    0x38E7,
+    0x00D0,
+    0x017A,
+    0x0000,
+    0xFFFC,
+    0x00D0,
+    0x4179,
+    0x0090,
+    0x0072,
+    0x0000,
+    0xFFF8,
+    0x0090,
+    0x4071,
+    0x00B0,
+    0x0170,
+    0x0000,
+    0xFFF4,
+    0x00D0,
+    0x4171,
+    0x0090,
+    0x006A,
+    0x0000,
+    0xFFF0,
+    0x0090,
+    0x4869,
+    0x00D0,
+    0x016A,
+    0x0000,
+    0xFFEC,
+    0x00D0,
+    0x4969,
+    0x0090,
+    0x0062,
+    0x0000,
+    0xFFE8,
+    0x0090,
+    0x5061,
+    0x00B0,
+    0x0120,
+    0x0000,
+    0xFFE4,
+    0x00D0,
+    0x5121,
+    0x0090,
+    0x001A,
+    0x0000,
+    0xFFE0,
+    0x0090,
+    0x5019,
+    0x00F0,
+    0x021C,
+    0x0000,
+    0x001C,
+    0x00D0,
+    0x5919,
+    0x00D0,
+    0x0116,
+    0x0000,
+    0x0018,
+    0x00D0,
+    0x5915,
+    0x0090,
+    0x000E,
+    0x0000,
+    0x0014,
+    0x0090,
+    0x600D,
+    0x00B0,
+    0x010C,
+    0x0000,
+    0x0010,
+    0x00D0,
+    0x610D,
+    0x0090,
+    0x0006,
+    0x0000,
+    0x000C,
+    0x0090,
+    0x6005,
+    0x0170,
+    0x0410,
+    0x0000,
+    0x0008,
+    0x00D0,
+    0x6905,
+    0x0090,
+    0x007E,
+    0x0000,
+    0x0004,
+    0x0090,
+    0x687D,
+    0x0090,
+    0x00E8,
+    0x0000,
+    0xFFE0,
+    0x0090,
+    0x70E7,
+    0x00D0,
+    0x017A,
+    0x0000,
+    0xFFFC,
+    0x00D0,
+    0x7179,
+    0x0090,
+    0x0072,
+    0x0000,
+    0xFFF8,
+    0x0090,
+    0x7071,
+    0x00B0,
+    0x0170,
+    0x0000,
+    0xFFF4,
+    0x00D0,
+    0x7971,
+    0x0090,
+    0x006A,
+    0x0000,
+    0xFFF0,
+    0x0090,
+    0x7869,
+    0x00D0,
+    0x016A,
+    0x0000,
+    0xFFEC,
+    0x2121,
+    0x2021,
+    0x5452,
+    0x6120,
+    0x7373,
+    0x7265,
+    0x2074,
+    0x2121,
+    0x0021,
+    0x5852,
+    0x4F20,
+    0x524F,
+    0x5400,
+    0x2058,
+    0x4F4F,
+    0x0052,
+    0x5854,
+    0x4F20,
+    0x4C4F,
+    0x5000,
+    0x4C4C,
+    0x4C20,
+    0x434F,
+    0x204B,
+    0x4F4C,
+    0x5453,
+    0x5000,
+    0x4C4C,
+    0x4620,
+    0x4520,
+    0x5252,
+    0x524F,
+    0x7200,
+    0x7061,
+    0x002E,
+    0x160C,
+    0x1010,
+    0x0210,
+    0x0001,
+    0x0001,
+    0x0002,
+    0x0004,
+    0x0006,
+    0x000A,
+    0x0010,
+    0x0016,
+    0x001E,
+    0x0027,
+    0x002F,
+    0x0036,
+    0x003B,
+    0x003D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x0002,
+    0x0004,
+    0x0007,
+    0x000C,
+    0x0013,
+    0x001C,
+    0x0027,
+    0x0032,
+    0x003B,
+    0x0041,
+    0x0044,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x0006,
+    0x000E,
+    0x001C,
+    0x0032,
+    0x004A,
+    0x005F,
+    0x0068,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x0003,
+    0x000C,
+    0x0023,
+    0x004D,
+    0x007A,
+    0x008E,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0283,
+    0x0100,
+    0x0202,
+    0x2630,
+    0x5B96,
+    0x5452,
+    0x4520,
+    0x5252,
+    0x524F,
+    0x005D,
+    0x3052,
+    0x5200,
+    0x0031,
+    0x3252,
+    0x5200,
+    0x0033,
+    0x3152,
+    0x0032,
+    0x524C,
+    0x5000,
+    0x0043,
+    0x5350,
+    0x0052,
+    0x7665,
+    0x6E65,
+    0x5F74,
+    0x7266,
+    0x6D61,
+    0x7765,
+    0x726F,
+    0x2E6B,
+    0x6500,
+    0x6576,
+    0x746E,
+    0x745F,
+    0x6D69,
+    0x6465,
+    0x755F,
+    0x746E,
+    0x6D69,
+    0x6465,
+    0x002E,
+    0x6372,
+    0x2E69,
+    0x0000,
+    0xFC18,
+    0x1080,
+    0x0000,
+    0x0000,
+    0xFC1A,
+    0x1080,
+    0x0600,
+    0x0000,
+    0xFC28,
+    0x1080,
+    0x0700,
+    0x0000,
+    0xFC28,
+    0x1080,
+    0x0700,
+    0x0000,
+    0xFC38,
+    0x1080,
+    0x1200,
+    0x0000,
+    0xFC5E,
+    0x1080,
+    0x0F00,
+    0x0000,
+    0xFC7E,
+    0x1080,
+    0x1000,
+    0x0000,
+    0xFCA0,
+    0x1080,
+    0x1400,
+    0x0000,
+    0xFCCA,
+    0x1080,
+    0x1100,
+    0x0000,
+    0xFCEE,
+    0x1080,
+    0x1200,
+    0x0000,
+    0xFD14,
+    0x1080,
+    0x1000,
+    0x0000,
+    0xFD36,
+    0x1080,
+    0x1200,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0000,
+    0xFA00,
+    0xFFFF,
+    0x003F,
+    0xFF64,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x011F,
+    0x0000,
+    0x0008,
+    0x0000,
+    0x010F,
+    0x0000,
+    0x2080,
+    0x0008,
+    0x024F,
+    0x0000,
+    0x8A00,
+    0x0000,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0080,
+    0x0200,
+    0x0000,
+    0x0040,
+    0x0080,
+    0xE200,
+    0xFFFF,
+    0x0007,
+    0xFCA0,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x0201,
+    0x190F,
+    0x0000,
+    0x2080,
+    0x0008,
+    0x024F,
+    0x0000,
+    0x8A00,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x027F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0044,
+    0x1A00,
+    0x0020,
+    0x0001,
+    0x02C4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0516,
+    0x0000,
+    0x0006,
+    0x0000,
+    0x0507,
+    0x000C,
+    0x0000,
+    0x0000,
+    0x0512,
+    0x6000,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x3000,
+    0x010F,
+    0x9813,
+    0x2080,
+    0xC008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0xC503,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x050E,
+    0x0600,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x210F,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0C20,
+    0x1A00,
+    0xFF20,
+    0x0007,
+    0xAAC4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0507,
+    0x000C,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x1000,
+    0x010F,
+    0x0013,
+    0x2080,
+    0x4008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0xC503,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x210F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0420,
+    0xFA00,
+    0x00BF,
+    0x0001,
+    0x56C4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0516,
+    0x0000,
+    0x0006,
+    0x0000,
+    0x0512,
+    0x6000,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x2000,
+    0x010F,
+    0x9800,
+    0x2080,
+    0x8008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0x050E,
+    0x0600,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x010F,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0820,
+    0x1A00,
+    0x0020,
+    0x0001,
+    0x02C4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0516,
+    0x0000,
+    0x0006,
+    0x0000,
+    0x0507,
+    0x000C,
+    0x0000,
+    0x0000,
+    0x0512,
+    0x6000,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x3000,
+    0x010F,
+    0x9813,
+    0x2080,
+    0xC008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0xC503,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x050E,
+    0x0600,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x210F,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0184,
+    0x0000,
+    0x0000,
+    0x0C20,
+    0x013F,
+    0x0000,
+    0x0000,
+    0x0C20,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0020,
+    0x1A00,
+    0xFF20,
+    0x0007,
+    0xAAC4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0507,
+    0x000C,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x1000,
+    0x010F,
+    0x0013,
+    0x2080,
+    0x4008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0xC503,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x210F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0182,
+    0x0000,
+    0x0000,
+    0x0420,
+    0x013F,
+    0x0000,
+    0x0000,
+    0x0420,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0020,
+    0xFA00,
+    0x00BF,
+    0x0001,
+    0x56C4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0516,
+    0x0000,
+    0x0006,
+    0x0000,
+    0x0512,
+    0x6000,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x2000,
+    0x010F,
+    0x9800,
+    0x2080,
+    0x8008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0x050E,
+    0x0600,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x010F,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0182,
+    0x0000,
+    0x0000,
+    0x0820,
+    0x013F,
+    0x0000,
+    0x0000,
+    0x0820,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0020,
+    0x1A00,
+    0x7F20,
+    0x0001,
+    0x0AC4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0516,
+    0x0000,
+    0x0006,
+    0x0000,
+    0x0507,
+    0x000C,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x3000,
+    0x010F,
+    0x8013,
+    0x2080,
+    0xC008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0xC503,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x210F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0420,
+    0x1A00,
+    0x7F20,
+    0x0001,
+    0x0AC4,
+    0x051D,
+    0x0000,
+    0xDF40,
+    0x0010,
+    0x050B,
+    0x00C0,
+    0x0000,
+    0x0000,
+    0x0516,
+    0x0000,
+    0x0006,
+    0x0000,
+    0x0507,
+    0x000C,
+    0x0000,
+    0x0000,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0001,
+    0x011F,
+    0x0000,
+    0x0038,
+    0x3000,
+    0x010F,
+    0x8013,
+    0x2080,
+    0xC008,
+    0x0100,
+    0x0000,
+    0x0000,
+    0x0002,
+    0x024F,
+    0x4088,
+    0x8A04,
+    0x0001,
+    0x052D,
+    0x0000,
+    0x0000,
+    0x0100,
+    0x020F,
+    0x0000,
+    0x0040,
+    0x0000,
+    0xC503,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x011F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x210F,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x8200,
+    0x0400,
+    0x0000,
+    0x0000,
+    0x0182,
+    0x0000,
+    0x0000,
+    0x0420,
+    0x013F,
+    0x0000,
+    0x0000,
+    0x0420,
+    0x0000,
+    0x0000,
+    0x0000,
+    0x0020,
+    0x0000,
+    0x0000,
+    0x627A,
+    0x745F,
+    0x6D69,
+    0x6465,
+    0x725F,
+    0x2E78,
+    0x7A00,
+    0x5F62,
+    0x7874,
+    0x002E,
+    0xF370,
+    0x7FFF,
+    0x0001,
+    0x0000,
+    0xD6E1,
+    0x1002,
+    0x98E1,
+    0x1002,
+    0x0795,
+    0x1003,
+    0x2C35,
+    0x1002,
+    0x9DE9,
+    0x1002,
+    0x02FF,
+    0x1021,
+    0x12B5,
+    0x104A,
+    0x1338,
+    0x8B78,
+    0x1343,
+    0x0C70,
+    0x0A28,
+    0x01D8,
+    0x3DF0,
+    0x07F9,
+    0x0909,
+    0x0D0A,
+    0x1613,
+    0x1A09,
+    0x1009,
+    0x1309,
+    0x0100,
+    0x5CF0,
+    0x10F8,
+    0x01BD,
+    0x81F0,
+    0xFBF8,
+    0x01E7,
+    0xE6F0,
+    0xF8F8,
+    0x00E7,
+    0x41F0,
+    0xF5FF,
+    0x01E7,
+    0xB0F0,
+    0xF2F8,
+    0xFFE7,
+    0x0120,
+    0x6CF0,
+    0xEEF8,
+    0x01E7,
+    0x81F0,
+    0xEBF8,
+    0x07E7,
+    0x0301,
+    0x0742,
+    0x2823,
+    0x704A,
+    0x94B5,
+    0xE068,
+    0xC1B2,
+    0x1908,
+    0x0240,
+    0x0829,
+    0x03D0,
+    0x3F29,
+    0x07D0,
+    0x1C23,
+    0x0340,
+    0x012C,
+    0x22D1,
+    0x1B4B,
+    0x7078,
+    0x21BD,
+    0x234D,
+    0x0240,
+    0x272B,
+    0x01D1,
+    0x2021,
+    0x5B4B,
+    0x9B6B,
+    0x0B08,
+    0x2B40,
+    0x1E70,
+    0x1F4B,
+    0x184D,
+    0x1078,
+    0x1B6A,
+    0x2878,
+    0xDB40,
+    0xDB08,
+    0x1B07,
+    0x030C,
+    0x0043,
+    0x1320,
+    0x1A62,
+    0x1B4B,
+    0xD84D,
+    0x1077,
+    0x286A,
+    0x0640,
+    0x1025,
+    0x1962,
+    0x0048,
+    0xC078,
+    0xD0B2,
+    0x1862,
+    0xC548,
+    0xD177,
+    0x0861,
+    0xD922,
+    0x916F,
+    0xD943,
+    0xD967,
+    0x0A6F,
+    0xDA43,
+    0xCC67,
+    0x2BE7,
+    0x0378,
+    0x0021,
+    0x002B,
+    0x81D1,
+    0x0809,
+    0x184B,
+    0xC078,
+    0x01B2,
+    0xF6F0,
+    0x00F8,
+    0x2B23,
+    0xBF70,
+    0x04E7,
+    0x184B,
+    0xC078,
+    0xFFB2,
+    0x86F7,
+    0xB9FF,
+    0xC0E7,
+    0x0046,
+    0x0040,
+    0x0042,
+    0x0302,
+    0x5C42,
+    0x03C8,
+    0x0042,
+    0x0050,
+    0x0842,
+    0x0301,
+    0xFF42,
+    0xFF7F,
+    0x04FF,
+    0x0040,
+    0xFF42,
+    0xFFF7,
+    0x63FF,
+    0x0302,
+    0x0142,
+    0x0040,
+    0xF042,
+    0x0FB5,
+    0x4527,
+    0x6E68,
+    0x2B4E,
+    0x8B78,
+    0xDAB0,
+    0x1FB2,
+    0x6C40,
+    0x044B,
+    0x0392,
+    0x7790,
+    0x1B77,
+    0xDA78,
+    0x02B2,
+    0xFE92,
+    0x002B,
+    0xC8D1,
+    0x84E0,
+    0x5B23,
+    0x3B42,
+    0x0141,
+    0x1922,
+    0x1100,
+    0x0540,
+    0x1391,
+    0x0942,
+    0x00D0,
+    0x6120,
+    0x1B4B,
+    0x007F,
+    0x022B,
+    0x60D1,
+    0xFF4A,
+    0x1333,
+    0x0B70,
+    0xF0B0,
+    0x32BD,
+    0x0777,
+    0x002F,
+    0x8AD0,
+    0x01E0,
+    0x0DF0,
+    0x01F8,
+    0x3BF0,
+    0xFFF8,
+    0x6BF7,
+    0x04FF,
+    0xF321,
+    0x7068,
+    0x0669,
+    0x0493,
+    0x829B,
+    0xDB7F,
+    0x0B08,
+    0x8A40,
+    0x1343,
+    0x3443,
+    0x8369,
+    0x0777,
+    0x792F,
+    0x6ED1,
+    0xE918,
+    0x0278,
+    0x0A23,
+    0x1A00,
+    0x1940,
+    0x0042,
+    0x86D0,
+    0x11E0,
+    0x0300,
+    0x1800,
+    0x0733,
+    0x8393,
+    0x857F,
+    0xDB7F,
+    0x08B2,
+    0xA393,
+    0x091D,
+    0x0193,
+    0xAD23,
+    0x1007,
+    0x02D5,
+    0xFF98,
+    0x0D28,
+    0x47D0,
+    0x474D,
+    0x2D48,
+    0x2D88,
+    0x0218,
+    0xC098,
+    0x8400,
+    0x6546,
+    0x2D44,
+    0xED78,
+    0x2808,
+    0x1800,
+    0x1D40,
+    0x6A42,
+    0x40D0,
+    0x0821,
+    0x229B,
+    0x9B79,
+    0x8A01,
+    0x0B43,
+    0x1340,
+    0x0643,
+    0x0722,
+    0x2399,
+    0xA071,
+    0x0118,
+    0x10F0,
+    0x00F8,
+    0x8025,
+    0x2021,
+    0x0400,
+    0x229B,
+    0x5B79,
+    0x8A00,
+    0x0B43,
+    0x1340,
+    0x2343,
+    0x0671,
+    0x3122,
+    0x0C00,
+    0x0130,
+    0x01F0,
+    0x02F8,
+    0x1D9B,
+    0x0443,
+    0x5B9B,
+    0x0A06,
+    0x3FD5,
+    0x7322,
+    0x9379,
+    0x4043,
+    0x052B,
+    0x02D1,
+    0xFF9B,
+    0x1A3B,
+    0x5300,
+    0x9A1E,
+    0x0541,
+    0x0592,
+    0x9B9B,
+    0x1D02,
+    0x0643,
+    0x5D9B,
+    0x0783,
+    0x002F,
+    0x83D0,
+    0x28E7,
+    0x284B,
+    0x294A,
+    0x1B49,
+    0x1278,
+    0x0988,
+    0x2878,
+    0x4B48,
+    0x9B43,
+    0x2218,
+    0x9B4A,
+    0x1B18,
+    0x0378,
+    0xDB9A,
+    0x13B2,
+    0x0977,
+    0x1123,
+    0x5300,
+    0x0077,
+    0x3DF0,
+    0x02FF,
+    0x019B,
+    0xFE20,
+    0x002B,
+    0x6BD0,
+    0xFFE7,
+    0x1823,
+    0x134A,
+    0x6770,
+    0x00E7,
+    0xE2F0,
+    0x77FF,
+    0x00E7,
+    0x0C22,
+    0x1123,
+    0xAE00,
+    0x011C,
+    0x882F,
+    0x00D1,
+    0x2922,
+    0xC91F,
+    0x2B18,
+    0xDB78,
+    0x9309,
+    0x0542,
+    0x3FD0,
+    0x4A23,
+    0x9A79,
+    0x4043,
+    0x533A,
+    0x5A42,
+    0xD241,
+    0x79B2,
+    0x0EE7,
+    0xEE23,
+    0x40E7,
+    0x2523,
+    0x9D79,
+    0x2B43,
+    0x8043,
+    0x2325,
+    0x0071,
+    0x0290,
+    0xA09B,
+    0x001D,
+    0xFFF0,
+    0xADFE,
+    0x9500,
+    0x07E7,
+    0xB92F,
+    0x00D0,
+    0xD020,
+    0xC0E7,
+    0x9C46,
+    0x03C8,
+    0xC942,
+    0x0301,
+    0xF042,
+    0x0301,
+    0x0042,
+    0x0380,
+    0x3742,
+    0x0301,
+    0x6842,
+    0x0301,
+    0x7D42,
+    0x0301,
+    0x3642,
+    0x0302,
+    0xF842,
+    0x07B5,
+    0x1400,
+    0x1D00,
+    0x0000,
+    0x3F2A,
+    0xFFD0,
+    0x1F23,
+    0x2322,
+    0x014E,
+    0x3331,
+    0x7370,
+    0x7370,
+    0x2278,
+    0x1348,
+    0x7340,
+    0x7270,
+    0xCB78,
+    0x9BB2,
+    0x1301,
+    0xDB43,
+    0x06B2,
+    0x3922,
+    0x7300,
+    0x0070,
+    0x76F0,
+    0x1CFF,
+    0x1D4B,
+    0x1B4A,
+    0xED88,
+    0x9900,
+    0x9BB2,
+    0xED18,
+    0x0018,
+    0x2F23,
+    0x3268,
+    0x1068,
+    0x1200,
+    0x380C,
+    0x8040,
+    0x12B2,
+    0x1004,
+    0x8743,
+    0x1B42,
+    0x68D1,
+    0x7268,
+    0x9068,
+    0x1742,
+    0x13D1,
+    0xDA48,
+    0x09B2,
+    0xDB18,
+    0x5B00,
+    0x1918,
+    0x3F78,
+    0x1923,
+    0x1040,
+    0x1C4B,
+    0x1078,
+    0x0C4B,
+    0x1B40,
+    0x0B78,
+    0x5840,
+    0x831E,
+    0x6141,
+    0x8C1E,
+    0x5B41,
+    0x1C00,
+    0x0643,
+    0x1A9B,
+    0x2070,
+    0xF800,
+    0x01BD,
+    0x0833,
+    0xA335,
+    0xD542,
+    0xFFD3,
+    0x0022,
+    0xF424,
+    0xC0E7,
+    0x9446,
+    0x03C8,
+    0x9642,
+    0x03C8,
+    0xEC42,
+    0x0301,
+    0x0042,
+    0x0380,
+    0x0142,
+    0x0380,
+    0xFA42,
+    0x0301,
+    0xFC42,
+    0x0301,
+    0xF042,
+    0xBCB5,
+    0x914B,
+    0x04B0,
+    0x1B90,
+    0x0178,
+    0xDB24,
+    0x1A08,
+    0x2200,
+    0x0340,
+    0x2392,
+    0x0242,
+    0xB7D0,
+    0x1C4B,
+    0x4863,
+    0x04E0,
+    0x009B,
+    0x462B,
+    0x5BD0,
+    0x0568,
+    0xB393,
+    0xDB4B,
+    0x9B6D,
+    0x00B2,
+    0x3E2B,
+    0x1AD0,
+    0x091D,
+    0x0292,
+    0x002B,
+    0x81D0,
+    0x03E0,
+    0xAF9B,
+    0x2B4D,
+    0x0370,
+    0xAE9A,
+    0x1A4B,
+    0x0270,
+    0x2B22,
+    0x9378,
+    0x2B43,
+    0x0370,
+    0x0423,
+    0xAB9E,
+    0x234A,
+    0x3336,
+    0x0570,
+    0x5B9B,
+    0x1278,
+    0x9A78,
+    0x0142,
+    0x01D2,
+    0xCF20,
+    0xA3E0,
+    0x1B4B,
+    0x1A68,
+    0x2200,
+    0x2340,
+    0x2042,
+    0x05D0,
+    0x1B9B,
+    0x9B78,
+    0xCD06,
+    0xA2D5,
+    0x1A4B,
+    0x1378,
+    0x022A,
+    0x1BD0,
+    0x1478,
+    0x0B2B,
+    0x02D1,
+    0x2A23,
+    0x9A78,
+    0x1343,
+    0x0443,
+    0x2B22,
+    0x9D70,
+    0x1A4B,
+    0x0370,
+    0x9623,
+    0x934A,
+    0x0665,
+    0x95E0,
+    0x134A,
+    0x136C,
+    0x9B6C,
+    0x01B2,
+    0x933B,
+    0x1462,
+    0xC063,
+    0x1146,
+    0xF0B0,
+    0x04BD,
+    0x959B,
+    0x5A49,
+    0x0F83,
+    0x0522,
+    0x1B9B,
+    0x1378,
+    0x2240,
+    0x9A00,
+    0x6B40,
+    0x0346,
+    0x9F92,
+    0x9189,
+    0x994B,
+    0x1F22,
+    0x9080,
+    0x1B4B,
+    0x9B88,
+    0x06B2,
+    0x8F93,
+    0x1B4B,
+    0x9B88,
+    0x05B2,
+    0x3393,
+    0xDB78,
+    0x18B2,
+    0x0400,
+    0x0093,
+    0x02F0,
+    0x05FF,
+    0x3A9A,
+    0x5340,
+    0x9A1E,
+    0x0641,
+    0x529B,
+    0x3B00,
+    0x5940,
+    0x8B1E,
+    0x1341,
+    0x0443,
+    0x139A,
+    0x3340,
+    0xAB70,
+    0xC0D0,
+    0x0323,
+    0x5B9A,
+    0x1A00,
+    0x1340,
+    0x5000,
+    0x821E,
+    0x2941,
+    0xA178,
+    0x0A43,
+    0x2A43,
+    0x7A70,
+    0x004A,
+    0x082B,
+    0x03D0,
+    0x1323,
+    0x0170,
+    0x7233,
+    0x014A,
+    0x9320,
+    0x0065,
+    0xBEF0,
+    0xBAFE,
+    0x08E7,
+    0x1423,
+    0xF670,
+    0x05E7,
+    0x179A,
+    0x711F,
+    0x104A,
+    0xC478,
+    0x01B2,
+    0x0338,
+    0xAF28,
+    0x00D8,
+    0x98F0,
+    0x6FFE,
+    0x6900,
+    0x0402,
+    0xE400,
+    0x6603,
+    0x584B,
+    0x406C,
+    0x4005,
+    0x000F,
+    0x4EF0,
+    0xFFFE,
+    0x0E28,
+    0x01D0,
+    0x8323,
+    0x6B40,
+    0x114A,
+    0x6B78,
+    0x124A,
+    0x1A78,
+    0x5040,
+    0x821E,
+    0x0B41,
+    0x5940,
+    0x8B1E,
+    0x5241,
+    0x1A00,
+    0x0343,
+    0x0492,
+    0x609D,
+    0x234B,
+    0x2C35,
+    0x1978,
+    0xE400,
+    0x99B2,
+    0x2022,
+    0x0400,
+    0x0093,
+    0xAAF0,
+    0x03FE,
+    0x239B,
+    0x2B40,
+    0x0070,
+    0x5CD1,
+    0x05E7,
+    0x999B,
+    0x9C22,
+    0x5D78,
+    0x044B,
+    0x1B99,
+    0xE778,
+    0xDBB2,
+    0x06B2,
+    0x5B93,
+    0xA44B,
+    0x1B09,
+    0x2E78,
+    0xDB78,
+    0xF6B2,
+    0x30B2,
+    0x0300,
+    0x0093,
+    0x92F0,
+    0x03FE,
+    0x019B,
+    0xE321,
+    0x0640,
+    0x0B9A,
+    0xE240,
+    0x8B40,
+    0x0A40,
+    0x1340,
+    0x3343,
+    0x2B40,
+    0x0070,
+    0x3CD1,
+    0x3FE7,
+    0x3923,
+    0x0500,
+    0x199A,
+    0x5040,
+    0xC078,
+    0x1FB2,
+    0x0942,
+    0x0AD1,
+    0x0000,
+    0xD2F0,
+    0x00FD,
+    0x0028,
+    0x9CD0,
+    0x0EE3,
+    0x0020,
+    0x04F0,
+    0x50FE,
+    0x05E7,
+    0xDC9B,
+    0xE478,
+    0x22B2,
+    0x0000,
+    0xC5F0,
+    0x00FD,
+    0xF328,
+    0x00D0,
+    0x002C,
+    0x8DD1,
+    0x00E3,
+    0x4221,
+    0x1C4B,
+    0x0970,
+    0x0098,
+    0xCAF0,
+    0x3EFD,
+    0x31E7,
+    0x004B,
+    0x5825,
+    0x406C,
+    0x4005,
+    0x000F,
+    0xE2F0,
+    0xFFFD,
+    0x0D28,
+    0x01D0,
+    0x8323,
+    0x3640,
+    0x3549,
+    0x124A,
+    0x0D78,
+    0x1D78,
+    0x6940,
+    0x8D1E,
+    0x1341,
+    0x5A40,
+    0x931E,
+    0x6D41,
+    0x1D00,
+    0x0443,
+    0x999B,
+    0x2322,
+    0x1E33,
+    0x2978,
+    0xF649,
+    0x30B2,
+    0x0A00,
+    0x0093,
+    0x40F0,
+    0x0AFE,
+    0x359B,
+    0x1D40,
+    0x0070,
+    0xF2D1,
+    0x2DE6,
+    0x2D4B,
+    0x1D4E,
+    0x0478,
+    0x0C9B,
+    0x5BAA,
+    0xED8B,
+    0x9BB2,
+    0x07B2,
+    0x3393,
+    0xDB78,
+    0x06B2,
+    0x1793,
+    0x194B,
+    0xCB78,
+    0x9CB2,
+    0x0F46,
+    0x9B23,
+    0xFF18,
+    0x1A22,
+    0x1B70,
+    0x1A4B,
+    0x2488,
+    0x184B,
+    0x2488,
+    0x1B4B,
+    0x1388,
+    0x5940,
+    0x8B1E,
+    0x0241,
+    0x5040,
+    0x821E,
+    0x5B41,
+    0x1300,
+    0x0943,
+    0x019A,
+    0xD220,
+    0x0C19,
+    0x0692,
+    0x083A,
+    0x0592,
+    0x129A,
+    0x9278,
+    0x1709,
+    0x0700,
+    0x0540,
+    0x1A97,
+    0x024F,
+    0x3342,
+    0x03D1,
+    0x5A22,
+    0xD240,
+    0x0BB2,
+    0x0092,
+    0x002B,
+    0xFCD0,
+    0x05E0,
+    0xB99C,
+    0xC0E0,
+    0xEA46,
+    0x0301,
+    0x0042,
+    0x0060,
+    0xC442,
+    0x0301,
+    0xC542,
+    0x0301,
+    0x0942,
+    0x0301,
+    0x0042,
+    0x0302,
+    0xC042,
+    0x0301,
+    0x7E42,
+    0x0319,
+    0xC210,
+    0x0301,
+    0xCA42,
+    0x0301,
+    0xDA42,
+    0x0301,
+    0xFB42,
+    0x0301,
+    0xFD42,
+    0x0301,
+    0xCC42,
+    0x0301,
+    0xDC42,
+    0x0301,
+    0xC742,
+    0x0301,
+    0xC942,
+    0x0301,
+    0xF242,
+    0x0301,
+    0xD842,
+    0x0301,
+    0xE842,
+    0x0301,
+    0xFF42,
+    0x0005,
+    0x6200,
+    0x1146,
+    0x0109,
+    0x3F40,
+    0x0C20,
+    0x0D9A,
+    0x0191,
+    0x113A,
+    0x8178,
+    0x1043,
+    0x0378,
+    0x5A22,
+    0xD240,
+    0x0BB2,
+    0x3F92,
+    0x7928,
+    0x00D8,
+    0x002B,
+    0xC2D0,
+    0x1CE0,
+    0x4000,
+    0x0029,
+    0x38D0,
+    0x06E1,
+    0x009B,
+    0x002B,
+    0x38D1,
+    0x00E1,
+    0xFF24,
+    0x002D,
+    0xBFD0,
+    0xC9E0,
+    0xC94B,
+    0x3249,
+    0x1B78,
+    0x0978,
+    0x1B88,
+    0x0B04,
+    0xC743,
+    0x0149,
+    0x5B3A,
+    0x0018,
+    0xD221,
+    0xC6B2,
+    0xC94E,
+    0x3118,
+    0xC560,
+    0x0848,
+    0x7299,
+    0x0360,
+    0x0022,
+    0x5AF0,
+    0x0CFD,
+    0x0399,
+    0xC222,
+    0x0348,
+    0x0039,
+    0x54F0,
+    0x01FD,
+    0xC122,
+    0x324B,
+    0x1B61,
+    0x5B78,
+    0x1309,
+    0x1542,
+    0x0FD1,
+    0x0C26,
+    0xF6AB,
+    0x2218,
+    0x0000,
+    0x0123,
+    0x0821,
+    0x0098,
+    0xFF96,
+    0xB3F7,
+    0x00FD,
+    0x0B24,
+    0x049B,
+    0x189A,
+    0xC343,
+    0x0BB2,
+    0x3393,
+    0x1378,
+    0x0676,
+    0xA39B,
+    0x0042,
+    0xA5D1,
+    0x00E0,
+    0x3DF0,
+    0x07FD,
+    0x3B9B,
+    0x0740,
+    0xFF93,
+    0x0028,
+    0xF6D1,
+    0xFFE0,
+    0x002D,
+    0x05D1,
+    0x8000,
+    0x0723,
+    0x9B9A,
+    0x1A00,
+    0x0D43,
+    0x079B,
+    0x0092,
+    0x002B,
+    0x97D1,
+    0xAAE0,
+    0xAA4B,
+    0x1A49,
+    0xEB88,
+    0x5200,
+    0x0118,
+    0x9B21,
+    0x1A18,
+    0x1878,
+    0x5278,
+    0x4009,
+    0x0808,
+    0x0540,
+    0x9890,
+    0x081C,
+    0x1090,
+    0x0800,
+    0x0340,
+    0x0A90,
+    0x0242,
+    0x04D0,
+    0x5B00,
+    0x0378,
+    0x8093,
+    0x0722,
+    0x929B,
+    0x3B00,
+    0x1A40,
+    0x0743,
+    0x0392,
+    0x8626,
+    0x00E0,
+    0x5D2B,
+    0x1CD1,
+    0x4000,
+    0x8729,
+    0x07D0,
+    0x059B,
+    0x3B9A,
+    0x0740,
+    0x0193,
+    0x9323,
+    0x0040,
+    0x9627,
+    0xDB4E,
+    0x06B2,
+    0x9622,
+    0x0848,
+    0x3399,
+    0x7770,
+    0x0070,
+    0xEFF0,
+    0x06FC,
+    0xBB9B,
+    0x0042,
+    0xC3D1,
+    0x8EE0,
+    0x194B,
+    0x8E88,
+    0xC94B,
+    0x0D18,
+    0x2B00,
+    0x3268,
+    0x0C68,
+    0x9093,
+    0x84B2,
+    0x1846,
+    0x630C,
+    0x0046,
+    0x1804,
+    0x0C43,
+    0x139B,
+    0x1240,
+    0x9B0C,
+    0x12B2,
+    0x1304,
+    0x9843,
+    0x0442,
+    0x6AD1,
+    0x7368,
+    0x9A68,
+    0x0042,
+    0x99D1,
+    0x06E0,
+    0x019B,
+    0x0837,
+    0xBB35,
+    0xE442,
+    0x82D8,
+    0x824A,
+    0xFF4B,
+    0x1B25,
+    0x1678,
+    0x0178,
+    0xB622,
+    0x1609,
+    0x9640,
+    0x9B40,
+    0x1309,
+    0x1E40,
+    0x4043,
+    0xFFE0,
+    0xBC2D,
+    0x7CD1,
+    0x1C4B,
+    0xE478,
+    0xB8B2,
+    0xFFE7,
+    0x722D,
+    0x05D0,
+    0x409C,
+    0x7429,
+    0x06D1,
+    0x059B,
+    0x009C,
+    0x182B,
+    0x69D0,
+    0x694B,
+    0x1B4A,
+    0x1278,
+    0x1B88,
+    0x1304,
+    0x6843,
+    0x294A,
+    0x9B00,
+    0x0018,
+    0x4022,
+    0xFFE7,
+    0x022D,
+    0x40D0,
+    0xEC29,
+    0xE3D0,
+    0x6EE6,
+    0x1C4B,
+    0xE478,
+    0x40B2,
+    0x9A29,
+    0x06D1,
+    0x009B,
+    0x002B,
+    0x26D0,
+    0x62E7,
+    0x1B4B,
+    0x9B78,
+    0x0006,
+    0x43D4,
+    0x0DE7,
+    0x009B,
+    0x022B,
+    0xFFD0,
+    0x002D,
+    0x67D0,
+    0x62E7,
+    0x624A,
+    0x1B4B,
+    0x1678,
+    0x0178,
+    0x7622,
+    0x1609,
+    0x9640,
+    0x5B40,
+    0x1309,
+    0x1E40,
+    0x0743,
+    0x3B9B,
+    0x0740,
+    0xE093,
+    0x0723,
+    0xDB99,
+    0x1900,
+    0x5C40,
+    0xEA4B,
+    0x1AB2,
+    0x0470,
+    0x0D9B,
+    0xAD43,
+    0x5DB2,
+    0x0F83,
+    0x0C25,
+    0xEDAB,
+    0x2218,
+    0x0300,
+    0x059B,
+    0x0099,
+    0x0895,
+    0xFF98,
+    0xD8F7,
+    0x0BFC,
+    0x049B,
+    0x039A,
+    0xDC43,
+    0x2BB2,
+    0x5278,
+    0x1349,
+    0x0A76,
+    0x999B,
+    0x1D22,
+    0xE878,
+    0x00B2,
+    0xA3F0,
+    0x35FC,
+    0x0A40,
+    0x2C9B,
+    0x0540,
+    0x1C20,
+    0x0070,
+    0x002C,
+    0x24D1,
+    0x01E6,
+    0x4A21,
+    0x1B4B,
+    0x0B78,
+    0x0042,
+    0x2FD0,
+    0x49E6,
+    0x1A4B,
+    0x2A88,
+    0x1A23,
+    0x2542,
+    0x47D0,
+    0x284A,
+    0x133B,
+    0x0C70,
+    0x5E33,
+    0x40E5,
+    0x1C4B,
+    0xE478,
+    0x40B2,
+    0xA329,
+    0x07D0,
+    0x3B9B,
+    0x0740,
+    0x3393,
+    0x06E7,
+    0xA19C,
+    0x05E7,
+    0xAA00,
+    0xBDE7,
+    0xEBB2,
+    0x5B00,
+    0x1A18,
+    0x9378,
+    0x1208,
+    0x1309,
+    0x1E43,
+    0x0100,
+    0x1622,
+    0x1340,
+    0x0042,
+    0x22D0,
+    0x03E7,
+    0xA996,
+    0xFFE7,
+    0x002D,
+    0x58D1,
+    0x06E7,
+    0xEC99,
+    0x35E7,
+    0x194B,
+    0x4463,
+    0x02E5,
+    0x2C21,
+    0x2B4B,
+    0x1B4A,
+    0x1278,
+    0xDB78,
+    0xD206,
+    0x0A08,
+    0xDB40,
+    0x1A0F,
+    0x0843,
+    0x6B92,
+    0x2046,
+    0x0022,
+    0x9B21,
+    0x1B18,
+    0x0B78,
+    0x0493,
+    0x5B9B,
+    0x9B8B,
+    0x06B2,
+    0x2493,
+    0x1A4B,
+    0x2978,
+    0xD24B,
+    0x1BB2,
+    0xDB78,
+    0x9CB2,
+    0x1946,
+    0x1E4B,
+    0x0978,
+    0xF69B,
+    0xDCB2,
+    0xA319,
+    0x0C1F,
+    0x0593,
+    0x0A9B,
+    0x1B91,
+    0xDB78,
+    0x1D09,
+    0x0500,
+    0x0193,
+    0x0E2B,
+    0x67D1,
+    0x3B1E,
+    0x3E78,
+    0xAB35,
+    0x4043,
+    0x183B,
+    0x4300,
+    0x4342,
+    0x0841,
+    0x3F00,
+    0xDB78,
+    0xFFB2,
+    0xBDB2,
+    0x4842,
+    0x0A41,
+    0x0490,
+    0x0B9D,
+    0x2398,
+    0x0735,
+    0x2D95,
+    0x0578,
+    0x2B42,
+    0x03D0,
+    0x7324,
+    0xF6E0,
+    0x0301,
+    0xF442,
+    0x0301,
+    0x0042,
+    0x2038,
+    0x0004,
+    0x0160,
+    0x0C42,
+    0x0160,
+    0x0842,
+    0x0160,
+    0xEA42,
+    0x0301,
+    0xF042,
+    0x0301,
+    0x0042,
+    0x0380,
+    0x9442,
+    0x03C8,
+    0x9642,
+    0x03C8,
+    0xE642,
+    0x0301,
+    0xD642,
+    0x0301,
+    0xEE42,
+    0x0301,
+    0xC942,
+    0x0301,
+    0x7E42,
+    0x0319,
+    0xC410,
+    0x0301,
+    0xC242,
+    0x0301,
+    0xC042,
+    0x0301,
+    0x0042,
+    0x0060,
+    0xF242,
+    0x0301,
+    0x0142,
+    0x3625,
+    0x2E09,
+    0xFF40,
+    0x002A,
+    0xAFD1,
+    0x8FE0,
+    0x9049,
+    0x0F48,
+    0xD188,
+    0x3F00,
+    0xC918,
+    0x0F19,
+    0xFF78,
+    0x3908,
+    0x2900,
+    0x2F40,
+    0x0C42,
+    0x00D0,
+    0xBF2B,
+    0x8AD0,
+    0x1A4B,
+    0x8A78,
+    0x924B,
+    0x1B08,
+    0x2A78,
+    0x9B40,
+    0x2B08,
+    0xAB40,
+    0x1340,
+    0x2843,
+    0x00E0,
+    0x7D2B,
+    0x86D0,
+    0x864B,
+    0x1B48,
+    0x0078,
+    0x1B88,
+    0x0304,
+    0x8543,
+    0x8548,
+    0x124F,
+    0x9A18,
+    0x3A18,
+    0x8460,
+    0x0348,
+    0x7922,
+    0xA160,
+    0x001F,
+    0x80F0,
+    0x03FB,
+    0x8222,
+    0xE148,
+    0x001E,
+    0x7BF0,
+    0x3DFB,
+    0x0061,
+    0x80F0,
+    0x00FB,
+    0x002E,
+    0xB0D1,
+    0xFFE0,
+    0x0028,
+    0xADD1,
+    0x80E0,
+    0x0622,
+    0xD29B,
+    0x9B00,
+    0x9B05,
+    0x1A0D,
+    0x0343,
+    0x0623,
+    0x1C92,
+    0x0300,
+    0x7793,
+    0x064D,
+    0x0C22,
+    0x2899,
+    0x0000,
+    0x62F0,
+    0x6CFB,
+    0x0148,
+    0x0221,
+    0x5278,
+    0x1308,
+    0x0B00,
+    0x0A40,
+    0x1142,
+    0x02D0,
+    0x0A78,
+    0x0540,
+    0x9199,
+    0x0C42,
+    0x6FD1,
+    0x114A,
+    0x2A68,
+    0x9168,
+    0x0742,
+    0x6DD1,
+    0x1B4B,
+    0x6A68,
+    0x5368,
+    0x9B40,
+    0x5AB2,
+    0x931E,
+    0xDB41,
+    0x60B2,
+    0x0A49,
+    0x9278,
+    0x1407,
+    0x0AD5,
+    0x0178,
+    0x0A21,
+    0x0540,
+    0x9199,
+    0x0C42,
+    0x65D1,
+    0x624A,
+    0x1049,
+    0x0A68,
+    0x9068,
+    0x0642,
+    0x63D1,
+    0x124A,
+    0x4968,
+    0x4A68,
+    0x9240,
+    0x00B2,
+    0x012A,
+    0x02D0,
+    0x1322,
+    0xDB43,
+    0x2243,
+    0x0800,
+    0x0399,
+    0xDB9C,
+    0x8AB2,
+    0x1C43,
+    0x1443,
+    0x0B40,
+    0x5B9A,
+    0x1A49,
+    0x1440,
+    0x0443,
+    0x069B,
+    0x5A9A,
+    0x0783,
+    0x999B,
+    0x1D22,
+    0xED78,
+    0x28B2,
+    0x0000,
+    0x61F0,
+    0x07FB,
+    0x2C9B,
+    0x1C40,
+    0x6970,
+    0x06D1,
+    0xE420,
+    0x0AE4,
+    0x009B,
+    0x002B,
+    0x30D0,
+    0x43E7,
+    0x074B,
+    0x199A,
+    0x4278,
+    0xC94B,
+    0x1B08,
+    0x2978,
+    0xDB40,
+    0x2B08,
+    0x5B40,
+    0x1200,
+    0x0B78,
+    0x1343,
+    0x0042,
+    0x21D1,
+    0xFEE7,
+    0x4923,
+    0x134A,
+    0x1D70,
+    0x00E7,
+    0x402E,
+    0x00D0,
+    0x002B,
+    0x18D1,
+    0x63E7,
+    0x0046,
+    0x2F2B,
+    0x44D0,
+    0x384B,
+    0x1A49,
+    0x3678,
+    0x384B,
+    0x1B4E,
+    0x0978,
+    0x1B88,
+    0x0B04,
+    0x3543,
+    0x0149,
+    0x5B3A,
+    0x3318,
+    0xD360,
+    0x73B2,
+    0x0360,
+    0xA122,
+    0x331F,
+    0x0048,
+    0xE0F0,
+    0x03FA,
+    0xE122,
+    0x311E,
+    0x0048,
+    0xDBF0,
+    0x35FA,
+    0x0061,
+    0xE0F0,
+    0x35FA,
+    0x184B,
+    0xE070,
+    0x0623,
+    0xDB9A,
+    0x1A00,
+    0x1340,
+    0x0300,
+    0x0643,
+    0xFF93,
+    0x0828,
+    0x80D0,
+    0x9B22,
+    0x9B05,
+    0xD20D,
+    0x1A00,
+    0x0343,
+    0x0623,
+    0x0392,
+    0xE593,
+    0x01E6,
+    0x1D21,
+    0x1A4B,
+    0x1D78,
+    0x924B,
+    0x1B08,
+    0x0A78,
+    0x9B40,
+    0x0B08,
+    0x8B40,
+    0x2340,
+    0x00E7,
+    0x002B,
+    0xD7D1,
+    0x16E6,
+    0x1A4B,
+    0x1678,
+    0x924B,
+    0x1B08,
+    0x2A78,
+    0x9B40,
+    0x2B08,
+    0x5B40,
+    0x1300,
+    0xE443,
+    0x21E7,
+    0x1A4B,
+    0x0178,
+    0x1A23,
+    0x1442,
+    0x02D0,
+    0x8621,
+    0x1FE4,
+    0x0322,
+    0xDB33,
+    0x1B19,
+    0x1378,
+    0x1C40,
+    0x134A,
+    0x5B70,
+    0x0300,
+    0x1A3B,
+    0x001C,
+    0x002B,
+    0x00DA,
+    0x1922,
+    0x124B,
+    0xDAB2,
+    0x1062,
+    0x1A22,
+    0x0166,
+    0x1723,
+    0x134A,
+    0xFF63,
+    0xB3F7,
+    0xC0FB,
+    0xF046,
+    0x0301,
+    0x0042,
+    0x0380,
+    0xD642,
+    0x0301,
+    0xE642,
+    0x0301,
+    0x3642,
+    0x0301,
+    0x3442,
+    0x0301,
+    0x0042,
+    0x2038,
+    0x0004,
+    0x0160,
+    0x0C42,
+    0x0160,
+    0x0842,
+    0x0160,
+    0x9442,
+    0x03C8,
+    0xD042,
+    0x0301,
+    0xD442,
+    0x0301,
+    0xE042,
+    0x0301,
+    0xE442,
+    0x0301,
+    0x7E42,
+    0x0319,
+    0xC910,
+    0x0301,
+    0xF242,
+    0x0301,
+    0xC442,
+    0x0301,
+    0xC542,
+    0x0301,
+    0xFC42,
+    0x00D0,
+    0x0042,
+    0x0060,
+    0x7042,
+    0x0DB5,
+    0x0D4B,
+    0x1A4C,
+    0x0178,
+    0x9223,
+    0x1009,
+    0x1800,
+    0x1A40,
+    0x0F42,
+    0x62D0,
+    0x126C,
+    0x1509,
+    0x1D00,
+    0x1A40,
+    0x0342,
+    0x08D1,
+    0x0020,
+    0x7DF0,
+    0x28FA,
+    0x6300,
+    0xDB6C,
+    0xDB04,
+    0x010F,
+    0x183B,
+    0x7040,
+    0x18BD,
+    0xF700,
+    0xEAE7,
+    0x0301,
+    0x0042,
+    0x0060,
+    0xF742,
+    0x39B5,
+    0xA34C,
+    0x007D,
+    0x002B,
+    0x6AD1,
+    0x00E0,
+    0xA322,
+    0xA268,
+    0xDE75,
+    0x3589,
+    0x364F,
+    0xF64B,
+    0xFB18,
+    0x786B,
+    0x016C,
+    0x4093,
+    0x4005,
+    0x040F,
+    0x0728,
+    0x00D8,
+    0x62F0,
+    0x03FA,
+    0x2826,
+    0x2C2A,
+    0x3000,
+    0x124A,
+    0x5288,
+    0xE342,
+    0x2F21,
+    0x8948,
+    0x4500,
+    0x7958,
+    0xAB6C,
+    0x010B,
+    0x2B25,
+    0xDB40,
+    0x9C00,
+    0x2B46,
+    0x0148,
+    0x009B,
+    0xC968,
+    0x290A,
+    0x6340,
+    0xC944,
+    0x0000,
+    0x4007,
+    0x5B17,
+    0x1B1A,
+    0x9B1A,
+    0x7A18,
+    0x526C,
+    0x5205,
+    0x500F,
+    0x031E,
+    0x1F28,
+    0x00D8,
+    0x3EF0,
+    0x0AFA,
+    0x1914,
+    0x211C,
+    0xDB4A,
+    0x21E7,
+    0xD94A,
+    0x21E7,
+    0xD74A,
+    0x21E7,
+    0xD54A,
+    0x21E7,
+    0x0949,
+    0xC978,
+    0x2800,
+    0x5B31,
+    0x3918,
+    0x896C,
+    0x1FB2,
+    0x8048,
+    0x0E5C,
+    0x1CE0,
+    0x0949,
+    0xC978,
+    0x1800,
+    0xF431,
+    0x91E7,
+    0xFF33,
+    0xF233,
+    0x7FE7,
+    0xFB33,
+    0x39E7,
+    0x006C,
+    0x8920,
+    0x04B2,
+    0xED2A,
+    0x7AD9,
+    0x166C,
+    0x014A,
+    0x9425,
+    0x1246,
+    0x7F69,
+    0xAA6C,
+    0xFF43,
+    0x2F08,
+    0x3A40,
+    0x6743,
+    0x4146,
+    0x9643,
+    0x3033,
+    0x3A00,
+    0xC961,
+    0x0018,
+    0xADF0,
+    0x65F8,
+    0xF775,
+    0x00BD,
+    0xC5F0,
+    0xFBF9,
+    0xC8E7,
+    0x03C8,
+    0x0042,
+    0x0060,
+    0x0042,
+    0x0380,
+    0x5242,
+    0x0302,
+    0x0042,
+    0x00D0,
+    0xD442,
+    0x00D0,
+    0x5442,
+    0x0302,
+    0x5642,
+    0x0302,
+    0x5842,
+    0x0302,
+    0x5A42,
+    0x0302,
+    0xC542,
+    0x0301,
+    0x8E42,
+    0x0319,
+    0x0010,
+    0x0050,
+    0x1042,
+    0x25B5,
+    0x254B,
+    0x264A,
+    0x1B49,
+    0x1278,
+    0x0988,
+    0x4B78,
+    0x9B43,
+    0x2418,
+    0x9B4A,
+    0x1C18,
+    0xE478,
+    0x20B2,
+    0x0000,
+    0x12F0,
+    0x21F9,
+    0x224A,
+    0x0049,
+    0xE6F0,
+    0x21F9,
+    0x1A4B,
+    0x2188,
+    0x1B4B,
+    0x6378,
+    0x9B43,
+    0x2018,
+    0x9B4A,
+    0x1B18,
+    0x9B78,
+    0x0207,
+    0x00D4,
+    0x89F0,
+    0x10F9,
+    0x1DBD,
+    0x1B4B,
+    0xD878,
+    0x0DB2,
+    0xF92B,
+    0x00D8,
+    0x51F0,
+    0x07F9,
+    0x0AF8,
+    0xF80F,
+    0xF8F8,
+    0xF8F8,
+    0x1411,
+    0x1D18,
+    0x0021,
+    0xA0F0,
+    0xEDF9,
+    0x01E7,
+    0x2021,
+    0xFF00,
+    0x3BF7,
+    0xE8FF,
+    0x00E7,
+    0xF921,
+    0x00E7,
+    0x1EF0,
+    0xE3F9,
+    0x20E7,
+    0x0000,
+    0x02F0,
+    0xDFF9,
+    0x0BE7,
+    0x2021,
+    0x0000,
+    0xADF0,
+    0xDAF9,
+    0x20E7,
+    0x0000,
+    0xB9F0,
+    0xD6F9,
+    0x0DE7,
+    0xF521,
+    0x37E7,
+    0x0301,
+    0x6842,
+    0x0301,
+    0x7D42,
+    0x0301,
+    0x0042,
+    0x0380,
+    0xA542,
+    0x0002,
+    0xAE00,
+    0x0319,
+    0x6A10,
+    0x0301,
+    0x7C42,
+    0x0301,
+    0x1442,
+    0x0380,
+    0x6542,
+    0x0301,
+    0x7042,
+    0x12B5,
+    0x034B,
+    0x1A25,
+    0x3478,
+    0x3C23,
+    0x1224,
+    0x2A09,
+    0x5340,
+    0x0F43,
+    0x0F4A,
+    0x9B4E,
+    0x9A18,
+    0xA269,
+    0x9A43,
+    0x0161,
+    0x3222,
+    0x1863,
+    0x0C60,
+    0x5848,
+    0x0060,
+    0x9920,
+    0x1860,
+    0x9962,
+    0xA969,
+    0x9943,
+    0x0461,
+    0x5921,
+    0x1862,
+    0x5A61,
+    0x5A61,
+    0x9962,
+    0x1769,
+    0xA132,
+    0x0A43,
+    0x9A43,
+    0x7061,
+    0xC0BD,
+    0x4846,
+    0x0302,
+    0x0042,
+    0x0150,
+    0x0042,
+    0x0050,
+    0x2C42,
+    0x0050,
+    0xF742,
+    0x31B5,
+    0x314E,
+    0x334A,
+    0x0578,
+    0x1000,
+    0x3078,
+    0x1B4A,
+    0x1218,
+    0x3068,
+    0x9B4C,
+    0xC918,
+    0x801A,
+    0xA123,
+    0x2262,
+    0x1B6A,
+    0x1301,
+    0x2343,
+    0x2362,
+    0x2C6A,
+    0x2C4A,
+    0x134E,
+    0x2340,
+    0x2B62,
+    0x0189,
+    0x9B27,
+    0x01B2,
+    0x2A93,
+    0xD84B,
+    0x806B,
+    0x8000,
+    0x000E,
+    0xE3F0,
+    0x01F8,
+    0x339B,
+    0xE860,
+    0xC07A,
+    0x00B2,
+    0x75F0,
+    0x2BF8,
+    0x187B,
+    0xDB21,
+    0xB3B2,
+    0xEB60,
+    0x9B89,
+    0xF3B2,
+    0x0360,
+    0x6A23,
+    0x527B,
+    0x3A08,
+    0x5240,
+    0x1342,
+    0x7240,
+    0xDB69,
+    0x8A00,
+    0x1343,
+    0x7343,
+    0x2861,
+    0x0168,
+    0xFF99,
+    0x95F7,
+    0x1AFF,
+    0x1A4B,
+    0x1A49,
+    0x2278,
+    0x1B6A,
+    0x1978,
+    0x9B48,
+    0xDB08,
+    0x0A07,
+    0x1B40,
+    0x0E0C,
+    0x134E,
+    0x2343,
+    0xC762,
+    0x3377,
+    0x0278,
+    0xDB21,
+    0xE3B2,
+    0x8062,
+    0x1323,
+    0x1B4A,
+    0xD102,
+    0xE777,
+    0x2561,
+    0x2B6A,
+    0x2343,
+    0x0062,
+    0xC323,
+    0x2377,
+    0x0F6A,
+    0x0348,
+    0x2340,
+    0x3362,
+    0xDB78,
+    0xE3B2,
+    0xD162,
+    0xE777,
+    0xF761,
+    0xC0BD,
+    0x6246,
+    0x0302,
+    0x6542,
+    0x0302,
+    0x0042,
+    0x03C9,
+    0x0042,
+    0x0040,
+    0xFF42,
+    0x7FFF,
+    0x00FF,
+    0x0050,
+    0x0042,
+    0x0080,
+    0x0842,
+    0x0301,
+    0xFF42,
+    0xFF7F,
+    0x04FF,
+    0x0040,
+    0x0142,
+    0x0040,
+    0xFF42,
+    0xFFF7,
+    0x01FF,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x89BF,
+    0x0210,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x6DBF,
+    0x0203,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xF5BF,
+    0x0211,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x05BF,
+    0x0281,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xB9BF,
+    0x02BC,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x65BF,
+    0x0241,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x1DBF,
+    0x021F,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x01BF,
+    0x027C,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x55BF,
+    0x0230,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x45BF,
+    0x0254,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xC9BF,
+    0x0276,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xEDBF,
+    0x0253,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xFDBF,
+    0x02BD,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x39BF,
+    0x020E,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xD5BF,
+    0x01F8,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xDDBF,
+    0x02C0,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xB9BF,
+    0x0253,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x3DBF,
+    0x02B9,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x31BF,
+    0x02BF,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xA1BF,
+    0x0226,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xCDBF,
+    0x0282,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x35BF,
+    0x0316,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x5DBF,
+    0x0210,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x11BF,
+    0x01F9,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x79BF,
+    0x0229,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x7DBF,
+    0x025E,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x91BF,
+    0x02D3,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xA1BF,
+    0x0253,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xE9BF,
+    0x01F8,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xADBF,
+    0x027B,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x29BF,
+    0x029E,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0xD5BF,
+    0x027B,
+    0x0110,
+    0x02B4,
+    0x8448,
+    0x0146,
+    0x60BC,
+    0x0047,
+    0x49BF,
+    0x0228,
+    0x0010
+};
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "AppEvent.h"
+ *
+ * Application event types for the QPG6200 Thread+BLE Speaker.
+ *
+ * Event sources:
+ *   - Buttons     : digital PB5 press/hold/release (commissioning)
+ *   - BleConn     : BLE stack events (advertising, connect, characteristic writes)
+ *   - Chime       : doorbell ring received over Thread, or a BLE chime request
+ *   - Thread      : OpenThread network events (joined, detached, etc.)
+ */
+
+#ifndef _APPEVENT_H_
+#define _APPEVENT_H_
+
+#include "AppButtons.h"
+#include "BleIf.h"
+
+/* -------------------------------------------------------------------------
+ * Chime event (Thread ring multicast or BLE Chime write)
+ * ------------------------------------------------------------------------- */
+typedef struct
+{
+    uint8_t  ChimeId;      /**< CHIME_* (ChimeSynth.h) */
+    bool     Timed;        /**< SentAtUs / PlayAtUs hold valid mesh time */
+    uint16_t RingCount;    /**< Sender's ring counter (0 for BLE / legacy) */
+    uint32_t SentAtUs;     /**< Mesh time the ring was sent */
+    uint32_t PlayAtUs;     /**< Mesh time the chime must start */
+    uint32_t RxLocalUs;    /**< Local time the message was received */
+} ChimeEvent_t;
+
+/* -------------------------------------------------------------------------
+ * Thread network event
+ * ------------------------------------------------------------------------- */
+typedef enum
+{
+    kThreadEvent_Joined       = 0,  /**< Successfully attached to a Thread network */
+    kThreadEvent_Detached     = 1,  /**< Left / lost the Thread network */
+    kThreadEvent_Error        = 3,  /**< Generic Thread stack error */
+    kThreadEvent_TimeSync     = 4,  /**< Mesh time exchange due (MeshTimeSync timer) */
+    kThreadEvent_Coap         = 5,  /**< MeshCoap send due (timer / response) */
+    kThreadEvent_Diag         = 6,  /**< MeshDiag snapshot due (timer / topology change) */
+    kThreadEvent_Dataset      = 7,  /**< MeshDataset: written dataset ready to apply */
+    kThreadEvent_Groups       = 8,  /**< Groups characteristic written (3 bytes in Value) */
+    kThreadEvent_Channel      = 9,  /**< MeshChannel: survey sweep done / leader survey due (1 = start) */
+    kThreadEvent_Auth         = 10,  /**< MeshAuth: key write ready to apply */
+    kThreadEvent_TxPower      = 11,  /**< MeshTxPower: evaluation window over / topology change */
+    kThreadEvent_Recovery     = 12,  /**< MeshRecovery: attach restart due while detached */
+    kThreadEvent_Joiner       = 13,  /**< MeshJoiner: write / joiner result / retry due */
+} ThreadEventType_t;
+
+typedef struct
+{
+    ThreadEventType_t Event;
+    uint32_t          Value;    /**< Event-specific data (e.g. error code) */
+} ThreadEvent_t;
+
+/* -------------------------------------------------------------------------
+ * Unified AppEvent
+ * ------------------------------------------------------------------------- */
+typedef enum { kActor_App = 0, kActor_Invalid = 255 } Actor_t;
+
+struct AppEvent;
+typedef void (*EventHandler)(AppEvent*);
+
+struct AppEvent
+{
+    enum AppEventTypes
+    {
+        kEventType_Buttons       = 0,
+        kEventType_BleConnection = 1,
+        kEventType_Chime         = 2,   /**< Play a chime (now or at a mesh time) */
+        kEventType_Thread        = 3,   /**< OpenThread mesh event */
+        kEventType_Invalid       = 255
+    };
+
+    AppEventTypes Type;
+
+    union
+    {
+        /* Digital button event (PB5 commissioning button) */
+        ButtonEvent_t ButtonEvent;
+
+        /* BLE connection/advertising/characteristic event */
+        Ble_Event_t BleConnectionEvent;
+
+        /* Chime request */
+        ChimeEvent_t ChimeEvent;
+
+        /* Thread network event */
+        ThreadEvent_t ThreadEvent;
+    };
+
+    EventHandler Handler;
+};
+
+#endif /* _APPEVENT_H_ */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "AppManager.h"
+ *
+ * Application manager for the QPG6200 Thread+BLE Speaker.
+ *
+ * Responsibilities:
+ *   - BLE stack initialisation and event handling
+ *   - Thread network commissioning (credentials stored in NVM)
+ *   - Mesh time base (MeshTimeSync) and time-synchronised chime playback
+ *   - Speaker GATT service (chime, volume, sync status)
+ *   - LED state machine
+ */
+
+#ifndef _APPMANAGER_H_
+#define _APPMANAGER_H_
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "AppEvent.h"
+#include "AppButtons.h"
+
+class AppManager
+{
+public:
+    void Init();
+    void EventHandler(AppEvent* aEvent);
+
+    /* Called by Thread task when a network event occurs */
+    static void NotifyThreadEvent(ThreadEventType_t event, uint32_t value);
+
+private:
+    friend AppManager& GetAppMgr(void);
+
+    void BleEventHandler(AppEvent* aEvent);
+    void ButtonEventHandler(AppEvent* aEvent);
+    void ChimeEventHandler(AppEvent* aEvent);
+    void ThreadEventHandler(AppEvent* aEvent);
+
+    static AppManager sAppMgr;
+};
+
+inline AppManager& GetAppMgr(void)
+{
+    return AppManager::sAppMgr;
+}
+
+#endif /* _APPMANAGER_H_ */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "SpeakerManager.h"
+ *
+ * Chime playback for the QPG6200 Thread+BLE Speaker.
+ *
+ * Hardware:
+ *   DAC6551A on SPIM (GPIO 5/6/7) -> LM48511 amplifier (see Dac6551.h)
+ *
+ * Operation:
+ *   A FreeRTOS mixer task renders ChimeSynth blocks into an AudioRing that
+ *   Dac6551 streams to the DAC at 16 kHz.  The ring is kept short (32 ms)
+ *   so a chime can be scheduled close to its start time.
+ *
+ *   Scheduled starts: SchedulePlay() converts a local start time into a
+ *   ring sample index using the Dac6551 timing anchor.  The mixer starts
+ *   the chime at that exact sample: ChimeSynth only starts notes on
+ *   16-sample control blocks, so the output runs through a 0..15 sample
+ *   delay line that is re-aligned just before each scheduled start.
+ *   A start that is already in the past plays immediately and is counted
+ *   as late.
+ */
+
+#ifndef _SPEAKER_MANAGER_H_
+#define _SPEAKER_MANAGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+
+/* --- Configurable timing ------------------------------------------------- */
+
+/** Start times further ahead than this are treated as bogus and played now. */
+#ifndef SPEAKER_MAX_SCHEDULE_AHEAD_US
+#define SPEAKER_MAX_SCHEDULE_AHEAD_US  2000000
+#endif
+
+/** Interval between playback statistics log lines, in milliseconds (0 = off). */
+#ifndef SPEAKER_STATS_INTERVAL_MS
+#define SPEAKER_STATS_INTERVAL_MS      30000
+#endif
+
+/* --- Public types -------------------------------------------------------- */
+
+typedef struct
+{
+    uint32_t scheduled;      /**< Chimes started at a scheduled time */
+    uint32_t immediate;      /**< Chimes started as soon as possible */
+    uint32_t late;           /**< Scheduled chimes whose start had already passed */
+    int32_t  lastErrorUs;    /**< Start error of the last scheduled chime (>= 0) */
+    uint32_t maxErrorUs;     /**< Largest start error seen */
+    uint32_t underruns;      /**< DAC blocks the ring could not supply */
+} SpeakerStats_t;
+
+/* --- Public class -------------------------------------------------------- */
+
+class SpeakerManager
+{
+public:
+    /**
+     * Initialise the synthesiser, the audio ring and the DAC6551A driver.
+     * Must be called once from AppTask::Init().
+     * @return true on success, false on driver error.
+     */
+    static bool Init(void);
+
+    /**
+     * Start the mixer FreeRTOS task; it primes the ring and starts the DAC.
+     * Call after Init() and after the FreeRTOS scheduler has started.
+     */
+    static void Start(void);
+
+    /** Play a chime as soon as possible (AppTask context). */
+    static void PlayNow(uint8_t chimeId);
+
+    /**
+     * Play a chime so that its first sample reaches the DAC at local time
+     * @p localStartUs (gpSched clock).  Falls back to PlayNow() when the
+     * DAC is not running yet or the time is too far ahead.  AppTask context.
+     */
+    static void SchedulePlay(uint8_t chimeId, uint32_t localStartUs);
+
+    /** Master volume, 0..100 %. */
+    static void    SetVolume(uint8_t percent);
+    static uint8_t GetVolume(void);
+
+    /** Snapshot of the playback statistics. */
+    static void GetStats(SpeakerStats_t* pStats);
+
+private:
+    static void MixerTask(void* pvParameters);
+    static void RenderBlock(void);
+    static void SetDelay(uint8_t delayLen);
+};
+
+#endif /* __cplusplus */
+
+#endif /* _SPEAKER_MANAGER_H_ */
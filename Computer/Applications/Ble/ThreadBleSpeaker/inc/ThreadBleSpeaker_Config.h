@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "ThreadBleSpeaker_Config.h"
+ *
+ * BLE GATT attribute handle definitions for the QPG6200 Thread+BLE Speaker.
+ *
+ * GATT Service layout:
+ *
+ *  [GATT Generic Access Profile]
+ *    0x0001 : Service Declaration
+ *
+ *  [Battery Service - 0x180F]
+ *    0x2000 : Service Declaration
+ *    0x2001 : Battery Level Characteristic Declaration
+ *    0x2002 : Battery Level Value             (Read)
+ *    0x2003 : Battery Level CCC               (Read/Write)
+ *
+ *  [Speaker Service - custom 128-bit UUID]
+ *    0x3000 : Service Declaration
+ *    0x3001 : Chime Characteristic Declaration
+ *    0x3002 : Chime Value                     (Read / Write, 1 byte, write = play now)
+ *    0x3003 : Volume Characteristic Declaration
+ *    0x3004 : Volume Value                    (Read / Write, 1 byte, 0-100 %)
+ *    0x3005 : Sync Status Characteristic Declaration
+ *    0x3006 : Sync Status Value               (Read, 7 bytes)
+ *
+ *  [Thread Config Service - custom 128-bit UUID]
+ *    0x4000 : Service Declaration
+ *    0x4001 : Network Name Characteristic Declaration
+ *    0x4002 : Network Name Value              (Read / Write, 16 bytes max)
+ *    0x4003 : Network Key Characteristic Declaration
+ *    0x4004 : Network Key Value               (Write-only, 16 bytes)
+ *    0x4005 : Channel Characteristic Declaration
+ *    0x4006 : Channel Value                   (Read / Write, 1 byte, 11-26)
+ *    0x4007 : PAN ID Characteristic Declaration
+ *    0x4008 : PAN ID Value                    (Read / Write, 2 bytes LE)
+ *    0x4009 : Join Characteristic Declaration
+ *    0x400A : Join Value                      (Write 0x01 = join Thread network)
+ *    0x400B : Thread Status Characteristic Declaration
+ *    0x400C : Thread Status Value             (Read / Notify, 1 byte)
+ *    0x400D : Thread Status CCC               (Read / Write)
+ *    0x400E : Diagnostics Characteristic Declaration
+ *    0x400F : Diagnostics Value               (Read, MeshDiag snapshot frame)
+ *    0x4010 : Dataset Characteristic Declaration
+ *    0x4011 : Dataset Value                   (Write, long write, MeshCoP TLVs)
+ *    0x4012 : Groups Characteristic Declaration
+ *    0x4013 : Groups Value                    (Read / Write, zone and multicast groups)
+ *    0x4014 : Survey Characteristic Declaration
+ *    0x4015 : Survey Value                    (Read / Write, channel survey; 0x01 = start)
+ *    0x4016 : Auth Characteristic Declaration
+ *    0x4017 : Auth Value                      (Read / Write, event signing keys)
+ *    0x4018 : Joiner Characteristic Declaration
+ *    0x4019 : Joiner Value                    (Read / Write, MeshCoP joiner; 0x01 = start)
+ */
+
+#ifndef _THREADBLESPEAKER_CONFIG_H_
+#define _THREADBLESPEAKER_CONFIG_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+ * BLE advertising constants (required by BleIf.c)
+ * ------------------------------------------------------------------------- */
+#define BLE_ADV_CHANNEL_37         0x01
+#define BLE_ADV_CHANNEL_38         0x02
+#define BLE_ADV_CHANNEL_39         0x04
+
+#define BLE_ADV_INTERVAL_MIN       0x0020   /**< 20 ms */
+#define BLE_ADV_INTERVAL_MAX       0x0060   /**< 60 ms */
+#define BLE_ADV_BROADCAST_DURATION 0xF000   /**< ~60 seconds */
+
+/* -------------------------------------------------------------------------
+ * Number of CCC descriptors (must match BleIf_CccSet[] in Config.c)
+ * ------------------------------------------------------------------------- */
+#define NUM_CCC_IDX                3   /**< GATT SC, Battery, Thread Status */
+#define BLE_CONFIG_SVC_GROUPS      3   /**< Battery, Speaker, Thread Config */
+
+/* -------------------------------------------------------------------------
+ * Battery Service handles
+ * ------------------------------------------------------------------------- */
+#define BATTERY_SVC_HDL            0x2000
+#define BATTERY_LEVEL_CH_HDL       0x2001
+#define BATTERY_LEVEL_HDL          0x2002
+#define BATTERY_LEVEL_CCC_HDL      0x2003
+#define BATTERY_LEVEL_HDL_MAX      (BATTERY_LEVEL_CCC_HDL + 1)
+
+/* -------------------------------------------------------------------------
+ * Speaker Service handles
+ * ------------------------------------------------------------------------- */
+#define SPEAKER_SVC_HDL            0x3000
+#define SPEAKER_CHIME_CH_HDL       0x3001
+#define SPEAKER_CHIME_HDL          0x3002   /**< R/W  - chime id, a write plays it now */
+#define SPEAKER_VOLUME_CH_HDL      0x3003
+#define SPEAKER_VOLUME_HDL         0x3004   /**< R/W  - volume 0-100 % */
+#define SPEAKER_SYNC_CH_HDL        0x3005
+#define SPEAKER_SYNC_HDL           0x3006   /**< R    - mesh time sync status */
+#define SPEAKER_SVC_HDL_MAX        (SPEAKER_SYNC_HDL + 1)
+
+#define SPEAKER_CHIME_LEN          1
+#define SPEAKER_VOLUME_LEN         1
+
+/** Sync Status value layout (little-endian):
+ *    Byte 0   : mesh time state (0 = unsynced, 1 = synced, 2 = master)
+ *    Byte 1-2 : start error of the last scheduled chime, us (saturates at 65535)
+ *    Byte 3-6 : estimated clock drift against the master, signed ppb */
+#define SPEAKER_SYNC_LEN           7
+
+/* -------------------------------------------------------------------------
+ * Thread Config Service handles
+ * ------------------------------------------------------------------------- */
+#define THREAD_CFG_SVC_HDL         0x4000
+
+#define THREAD_NET_NAME_CH_HDL     0x4001
+#define THREAD_NET_NAME_HDL        0x4002   /**< R/W  - UTF-8 network name, max 16 bytes */
+
+#define THREAD_NET_KEY_CH_HDL      0x4003
+#define THREAD_NET_KEY_HDL         0x4004   /**< W    - 16-byte Thread Master Key */
+
+#define THREAD_CHANNEL_CH_HDL      0x4005
+#define THREAD_CHANNEL_HDL         0x4006   /**< R/W  - 1 byte, channel 11-26 */
+
+#define THREAD_PANID_CH_HDL        0x4007
+#define THREAD_PANID_HDL           0x4008   /**< R/W  - 2 bytes little-endian PAN ID */
+
+#define THREAD_JOIN_CH_HDL         0x4009
+#define THREAD_JOIN_HDL            0x400A   /**< W    - write 0x01 to start Thread join */
+
+#define THREAD_STATUS_CH_HDL       0x400B
+#define THREAD_STATUS_HDL          0x400C   /**< R/Notify - 1 byte thread role */
+#define THREAD_STATUS_CCC_HDL      0x400D
+
+#define THREAD_DIAG_CH_HDL         0x400E
+#define THREAD_DIAG_HDL            0x400F   /**< R    - diagnostics snapshot (MeshDiag.h) */
+#define THREAD_DATASET_CH_HDL      0x4010
+#define THREAD_DATASET_HDL         0x4011   /**< W    - Active Operational Dataset TLVs (MeshDataset.h) */
+#define THREAD_GROUPS_CH_HDL       0x4012
+#define THREAD_GROUPS_HDL          0x4013   /**< RW   - zone, target zone, listen flags (MeshGroup.h) */
+#define THREAD_SURVEY_CH_HDL       0x4014
+#define THREAD_SURVEY_HDL          0x4015   /**< RW   - energy survey of channels 11-26 (MeshChannel.h) */
+#define THREAD_AUTH_CH_HDL         0x4016
+#define THREAD_AUTH_HDL            0x4017   /**< RW   - event signing keys (MeshAuth.h) */
+#define THREAD_JOINER_CH_HDL       0x4018
+#define THREAD_JOINER_HDL          0x4019   /**< RW   - MeshCoP joiner start / progress (MeshJoiner.h) */
+#define THREAD_CFG_SVC_HDL_MAX     (THREAD_JOINER_HDL + 1)
+
+/** Thread status values (mirrors otDeviceRole) */
+#define THREAD_STATUS_DISABLED     0x00
+#define THREAD_STATUS_DETACHED     0x01
+#define THREAD_STATUS_CHILD        0x02
+#define THREAD_STATUS_ROUTER       0x03
+#define THREAD_STATUS_LEADER       0x04
+#define THREAD_STATUS_REJECTED     0x05     /**< written dataset refused (MeshDataset.h) */
+#define THREAD_STATUS_JOINING      0x06     /**< MeshCoP joiner running (MeshJoiner.h) */
+#define THREAD_STATUS_JOIN_FAILED  0x07     /**< joiner attempt failed, retry pending */
+
+/* -------------------------------------------------------------------------
+ * GATT SC (Service Changed) handle - required by BleIf
+ * ------------------------------------------------------------------------- */
+#define GATT_SC_CH_CCC_HDL         0x0013
+
+/* -------------------------------------------------------------------------
+ * Thread Config Service UUID (128-bit, custom)
+ * Base: D00RBELL-0002-1000-8000-00805F9B3400
+ * Individual characteristic UUIDs increment the last byte:
+ *   Network Name : ...3401,  Network Key: ...3402,  Channel: ...3403
+ *   PAN ID       : ...3404,  Join:        ...3405,  Status:  ...3406
+ *   Diagnostics  : ...3407,  Dataset:     ...3408,  Groups:  ...3409
+ *   Survey       : ...340A,  Auth:        ...340B,  Joiner:  ...340C
+ * ------------------------------------------------------------------------- */
+
+/* Maximum sizes */
+#define THREAD_NET_NAME_MAX_LEN    16   /**< Thread spec: max 16 bytes UTF-8 */
+#define THREAD_NET_KEY_LEN         16   /**< 128-bit network key */
+#define THREAD_PANID_LEN           2    /**< 16-bit PAN ID */
+#define THREAD_CHANNEL_LEN         1    /**< channel number */
+#define THREAD_JOIN_LEN            1    /**< join command byte */
+#define THREAD_STATUS_LEN          1    /**< device role byte */
+
+/* -------------------------------------------------------------------------
+ * Public config functions (called by BleIf via fixed names)
+ * ------------------------------------------------------------------------- */
+uint8_t Ble_Peripheral_Config_Load_Advertise_Frame(uint8_t* buffer);
+uint8_t Ble_Peripheral_Config_Load_Scan_Response_Frame(uint8_t* buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _THREADBLESPEAKER_CONFIG_H_ */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "qPinCfg.h"
+ *
+ * GPIO / Peripheral pin definitions for the QPG6200 Thread+BLE Speaker.
+ *
+ * Board: QPG6200L Development Kit (QPG6200L DK) + DAC6551A / LM48511 speaker PCB.
+ *
+ * DAC6551A on SPIM 0 (configured by Dac6551_Init()):
+ *   GPIO 5 - SPIM MOSI -> DAC DIN
+ *   GPIO 6 - SPIM SCLK -> DAC SCLK (8 MHz)
+ *   GPIO 7 - SYNC      -> DAC SYNC (frame sync, active low)
+ *   PB2 (GPIO 5) shares the DIN pin and cannot be used.
+ *   PWMXL 0 is the 16 kHz sample clock (no pin output).
+ *
+ * Button (commissioning / factory-reset):
+ *   PB5  (GPIO 0) - Short press (<2 s): restart BLE advertising
+ *                   Long press (>=5 s): factory-reset Thread credentials
+ *
+ * LED assignments:
+ *   WHITE_COOL (GPIO 1)  - BLE status:    blinks=advertising, solid=connected
+ *   GREEN      (GPIO 11) - Thread status: blinks=joining,     solid=joined
+ *   BLUE       (GPIO 12) - Chime:         rapid blinks while a chime plays
+ */
+
+#ifndef _QPINCFG_H_
+#define _QPINCFG_H_
+
+/*****************************************************************************
+ *                    Common Inclusion
+ *****************************************************************************/
+#include "qPinCfg_Common.h"
+
+/*****************************************************************************
+ *                    Pin Definitions
+ *****************************************************************************/
+
+/* Multi-function commissioning button (short: restart adv, long: factory reset) */
+#define APP_MULTI_FUNC_BUTTON   PB5_BUTTON_GPIO_PIN   /* GPIO 0 */
+
+/* DAC6551A sample clock - pins are fixed in Dac6551.h (GPIO 5/6/7) */
+#define APP_SPEAKER_PWMXL_ID    0
+
+/* BLE status LED: blinks=advertising, solid=connected */
+#define APP_BLE_STATE_LED       WHITE_COOL_LED_GPIO_PIN /* GPIO 1 */
+
+/* Thread status LED: blinks=joining, solid=joined network */
+#define APP_THREAD_STATE_LED    GREEN_LED_GPIO_PIN      /* GPIO 11 */
+
+/* Chime LED: rapid blinks while a chime plays */
+#define APP_CHIME_LED           BLUE_LED_GPIO_PIN       /* GPIO 12 */
+
+/*****************************************************************************
+ *                    Module Definitions
+ *****************************************************************************/
+
+/* Buttons registered with ButtonHandler (commissioning button PB5) */
+#define QPINCFG_BUTTONS    QPINCFG_GPIO_LIST(APP_MULTI_FUNC_BUTTON)
+
+/* LEDs managed by StatusLed (BLE state, Thread state, chime indicator) */
+#define QPINCFG_STATUS_LED QPINCFG_GPIO_LIST(APP_BLE_STATE_LED, APP_THREAD_STATE_LED, APP_CHIME_LED)
+
+/* Unused pins pulled low to minimise power.
+ * PB2 (GPIO 5) is excluded - it carries the DAC data line.
+ * GPIO 28 (ANIO0) and GPIO 29 (ANIO1) are excluded - analog pins unused on DK standalone. */
+#define QPINCFG_UNUSED                                                                       \
+    QPINCFG_GPIO_LIST(PB1_BUTTON_GPIO_PIN, PB3_BUTTON_GPIO_PIN, PB4_BUTTON_GPIO_PIN,        \
+                      SW_BUTTON_GPIO_PIN,                                                   \
+                      WHITE_WARM_LED_GPIO_PIN, RED_LED_GPIO_PIN,                             \
+                      EXT_32KXTAL_P, EXT_32KXTAL_N,                                         \
+                      DEBUG_SWJDP_SWDIO_TMS_GPIO, DEBUG_SWJDP_SWCLK_TCK_GPIO,               \
+                      BOARD_UNUSED_GPIO_PINS)
+
+#endif /* _QPINCFG_H_ */
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "SpeakerManager.cpp"
+ *
+ * Mixer task and sample-accurate chime scheduling.
+ *
+ * Data path (all in the mixer task):
+ *
+ *   ChimeSynth_Render (128 samples, 8 ms)
+ *     -> delay line (0..15 samples, aligns the chime start to one sample)
+ *     -> AudioRing (512 samples, 32 ms)
+ *     -> Dac6551 DMA double buffer (2 x 128 samples) -> DAC6551A
+ *
+ * Scheduling: the target ring index is handed over from the AppTask as
+ * (chime, index) plus a request id, as MicManager does for stream requests,
+ * so no lock is needed.  For a target T and write position h the mixer
+ * sets the delay to (T - h) mod 16 and starts the chime after the whole
+ * control blocks that precede it, which puts the first chime sample at T.
+ *
+ * CPU budget at 64 MHz: synthesis ~2.5 % while a chime rings, ~0 % idle.
+ */
+
+#include "SpeakerManager.h"
+#include "gpLog.h"
+#include "qPinCfg.h"
+
+#include "AudioRing.h"
+#include "ChimeSynth.h"
+#include "Dac6551.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <string.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* 512 samples = 32 ms at 16 kHz, refilled when it drops below 256 */
+#define SPEAKER_RING_SAMPLES    512
+#define SPEAKER_LOW_WATER       (SPEAKER_RING_SAMPLES / 2)
+#define SPEAKER_BLOCK_SAMPLES   DAC6551_BLOCK_FRAMES
+#define SPEAKER_DELAY_MAX       CHIME_SYNTH_CONTROL_BLOCK
+#define SPEAKER_VOLUME_DEFAULT  60
+
+/* Sample period is 62.5 us: us = samples * 125 / 2 */
+#define SPEAKER_SAMPLES_TO_US(_n)  (((int32_t)(_n) * 125) / 2)
+
+static_assert((SPEAKER_BLOCK_SAMPLES % CHIME_SYNTH_CONTROL_BLOCK) == 0, "block must be whole control blocks");
+static_assert((SPEAKER_RING_SAMPLES & (SPEAKER_RING_SAMPLES - 1)) == 0, "ring capacity must be a power of two");
+
+/* FreeRTOS task storage */
+#define SPEAKER_TASK_STACK_SIZE (2 * configMINIMAL_STACK_SIZE)
+#define SPEAKER_TASK_PRIORITY   (tskIDLE_PRIORITY + 3)
+
+static StaticTask_t sMixerTask;
+static StackType_t  sMixerStack[SPEAKER_TASK_STACK_SIZE];
+static TaskHandle_t sMixerHandle = nullptr;
+
+static qDrvPWMXL_t sClockDrv = Q_DRV_PWMXL_INSTANCE_DEFINE(APP_SPEAKER_PWMXL_ID);
+
+static int16_t     sRingBuffer[SPEAKER_RING_SAMPLES];
+static AudioRing_t sRing;
+
+/* Delay line between the synthesiser and the ring */
+static int16_t sDelay[SPEAKER_DELAY_MAX];
+static uint8_t sDelayLen = 0;
+static int16_t sLastOut  = 0;
+
+/* Play request: AppTask writes chime / index, then bumps the id */
+static volatile uint32_t sRequestId     = 0;
+static volatile uint8_t  sRequestChime  = 0;
+static volatile uint32_t sRequestIndex  = 0;
+static volatile bool     sRequestTimed  = false;
+static uint32_t          sRequestSeen   = 0;
+
+/* Pending scheduled start, mixer task only */
+static bool     sPending      = false;
+static bool     sPendingTimed = false;
+static uint8_t  sPendingChime = 0;
+static uint32_t sPendingIndex = 0;
+
+static uint8_t                 sVolume = SPEAKER_VOLUME_DEFAULT;
+static volatile SpeakerStats_t sStats;
+
+/* -------------------------------------------------------------------------
+ * Init  - synthesiser, ring and DAC driver
+ * ------------------------------------------------------------------------- */
+bool SpeakerManager::Init(void)
+{
+    ChimeSynth_Init(DAC6551_SAMPLE_RATE_HZ);
+    ChimeSynth_SetVolume(sVolume);
+    AudioRing_Init(&sRing, sRingBuffer, SPEAKER_RING_SAMPLES);
+    memset((void*)&sStats, 0, sizeof(sStats));
+
+    /* The task exists now so Dac6551 can notify it; it waits for Start() */
+    sMixerHandle =
+        xTaskCreateStatic(MixerTask, "Mixer", SPEAKER_TASK_STACK_SIZE,
+                          nullptr, SPEAKER_TASK_PRIORITY, sMixerStack, &sMixerTask);
+    Q_ASSERT(sMixerHandle != nullptr);
+
+    Dac6551_Config_t dacCfg;
+    dacCfg.framing  = Dac6551_FramingDma;
+    dacCfg.pRing    = &sRing;
+    dacCfg.producer = sMixerHandle;
+    dacCfg.lowWater = SPEAKER_LOW_WATER;
+
+    qResult_t res = Dac6551_Init(&sClockDrv, &dacCfg);
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("[SPK] DAC6551 init failed: %d", 0, res);
+        return false;
+    }
+
+    GP_LOG_SYSTEM_PRINTF("[SPK] DAC6551A ready: MOSI GPIO%d, SCLK GPIO%d, SYNC GPIO%d", 0,
+                         DAC6551_MOSI_GPIO, DAC6551_SCLK_GPIO, DAC6551_SYNC_GPIO);
+    GP_LOG_SYSTEM_PRINTF("[SPK] PCM %lu Hz, ring %u samples", 0,
+                         (unsigned long)DAC6551_SAMPLE_RATE_HZ, SPEAKER_RING_SAMPLES);
+    return true;
+}
+
+/* -------------------------------------------------------------------------
+ * Start  - release the mixer task
+ * ------------------------------------------------------------------------- */
+void SpeakerManager::Start(void)
+{
+    xTaskNotifyGive(sMixerHandle);
+}
+
+/* -------------------------------------------------------------------------
+ * PlayNow / SchedulePlay  - AppTask context, picked up by the mixer task
+ * ------------------------------------------------------------------------- */
+void SpeakerManager::PlayNow(uint8_t chimeId)
+{
+    sRequestChime = chimeId;
+    sRequestTimed = false;
+    sRequestId    = sRequestId + 1;
+    xTaskNotifyGive(sMixerHandle);
+}
+
+void SpeakerManager::SchedulePlay(uint8_t chimeId, uint32_t localStartUs)
+{
+    uint32_t anchorIndex;
+    uint32_t anchorUs;
+
+    if(!Dac6551_GetTiming(&anchorIndex, &anchorUs))
+    {
+        PlayNow(chimeId);
+        return;
+    }
+
+    int32_t deltaUs = (int32_t)(localStartUs - anchorUs);
+    if(deltaUs > SPEAKER_MAX_SCHEDULE_AHEAD_US)
+    {
+        GP_LOG_SYSTEM_PRINTF("[SPK] Start %ld us ahead - playing now", 0, (long)deltaUs);
+        PlayNow(chimeId);
+        return;
+    }
+    if(deltaUs < -SPEAKER_MAX_SCHEDULE_AHEAD_US)
+    {
+        deltaUs = -SPEAKER_MAX_SCHEDULE_AHEAD_US;
+    }
+
+    /* us -> samples at 16 kHz, rounded to the nearest sample */
+    int32_t samples = (deltaUs * 2 + ((deltaUs >= 0) ? 62 : -62)) / 125;
+
+    sRequestChime = chimeId;
+    sRequestIndex = anchorIndex + (uint32_t)samples;
+    sRequestTimed = true;
+    sRequestId    = sRequestId + 1;
+    xTaskNotifyGive(sMixerHandle);
+}
+
+/* -------------------------------------------------------------------------
+ * Volume and statistics
+ * ------------------------------------------------------------------------- */
+void SpeakerManager::SetVolume(uint8_t percent)
+{
+    sVolume = (percent > 100) ? 100 : percent;
+    ChimeSynth_SetVolume(sVolume);
+}
+
+uint8_t SpeakerManager::GetVolume(void)
+{
+    return sVolume;
+}
+
+void SpeakerManager::GetStats(SpeakerStats_t* pStats)
+{
+    Dac6551_Stats_t dacStats;
+    Dac6551_GetStats(&dacStats);
+
+    taskENTER_CRITICAL();
+    memcpy(pStats, (const void*)&sStats, sizeof(*pStats));
+    taskEXIT_CRITICAL();
+    pStats->underruns = dacStats.underruns;
+}
+
+/* -------------------------------------------------------------------------
+ * SetDelay  - re-align the delay line (done while a chime is about to start,
+ *             so the inserted / dropped samples are normally silence)
+ * ------------------------------------------------------------------------- */
+void SpeakerManager::SetDelay(uint8_t delayLen)
+{
+    if(delayLen > sDelayLen)
+    {
+        uint8_t grow = delayLen - sDelayLen;
+        memmove(&sDelay[grow], sDelay, sDelayLen * sizeof(int16_t));
+        for(uint8_t i = 0; i < grow; i++)
+        {
+            sDelay[i] = sLastOut;
+        }
+    }
+    else if(delayLen < sDelayLen)
+    {
+        memmove(sDelay, &sDelay[sDelayLen - delayLen], delayLen * sizeof(int16_t));
+    }
+    sDelayLen = delayLen;
+}
+
+/* -------------------------------------------------------------------------
+ * RenderBlock  - one block of synthesis, starting a pending chime on time
+ * ------------------------------------------------------------------------- */
+void SpeakerManager::RenderBlock(void)
+{
+    int16_t  synth[SPEAKER_BLOCK_SAMPLES];
+    uint16_t split = SPEAKER_BLOCK_SAMPLES;
+    uint32_t head  = sRing.head;
+
+    /* Pick up a new request from the AppTask */
+    uint32_t requestId = sRequestId;
+    if(requestId != sRequestSeen)
+    {
+        sRequestSeen  = requestId;
+        sPendingChime = sRequestChime;
+        sPendingTimed = sRequestTimed;
+        /* Untimed: the first sample this block can hold */
+        sPendingIndex = sPendingTimed ? sRequestIndex : head + sDelayLen;
+        sPending      = true;
+    }
+
+    /* Synth sample j of this block lands at ring index head + sDelayLen + j */
+    if(sPending)
+    {
+        int32_t ahead = (int32_t)(sPendingIndex - head);
+        int32_t start = 0;
+
+        if(ahead >= 0)
+        {
+            /* Leaves a whole number of control blocks before the start */
+            SetDelay((uint8_t)(ahead & (SPEAKER_DELAY_MAX - 1)));
+            start = ahead - sDelayLen;
+        }
+        /* else: too late, start with the first sample of this block */
+
+        if(start < SPEAKER_BLOCK_SAMPLES)
+        {
+            split = (uint16_t)start;
+        }
+    }
+
+    if(split > 0)
+    {
+        ChimeSynth_Render(synth, split);
+    }
+    if(split < SPEAKER_BLOCK_SAMPLES)
+    {
+        uint32_t actual = head + sDelayLen + split;
+        int32_t  lateUs = SPEAKER_SAMPLES_TO_US((int32_t)(actual - sPendingIndex));
+
+        ChimeSynth_Play((ChimeSynth_ChimeId_t)sPendingChime);
+        ChimeSynth_Render(&synth[split], SPEAKER_BLOCK_SAMPLES - split);
+        sPending = false;
+
+        if(!sPendingTimed)
+        {
+            sStats.immediate++;
+        }
+        else
+        {
+            sStats.scheduled++;
+            sStats.lastErrorUs = lateUs;
+            if(lateUs > 0)
+            {
+                sStats.late++;
+                if((uint32_t)lateUs > sStats.maxErrorUs)
+                {
+                    sStats.maxErrorUs = (uint32_t)lateUs;
+                }
+            }
+        }
+    }
+
+    /* Delayed output: held samples first, then the new block minus its tail */
+    AudioRing_Write(&sRing, sDelay, sDelayLen);
+    AudioRing_Write(&sRing, synth, SPEAKER_BLOCK_SAMPLES - sDelayLen);
+    memcpy(sDelay, &synth[SPEAKER_BLOCK_SAMPLES - sDelayLen], sDelayLen * sizeof(int16_t));
+    sLastOut = synth[SPEAKER_BLOCK_SAMPLES - sDelayLen - 1];
+}
+
+/* -------------------------------------------------------------------------
+ * MixerTask  - keeps the ring topped up; woken by Dac6551 at the low-water
+ *              mark and by new play requests
+ * ------------------------------------------------------------------------- */
+void SpeakerManager::MixerTask(void* /*pvParameters*/)
+{
+    /* Wait for Start(); Init() may still be configuring the DAC */
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    TickType_t lastStats = xTaskGetTickCount();
+
+    /* Prime the ring so the DAC starts on silence rather than an underrun */
+    while(AudioRing_Free(&sRing) >= SPEAKER_BLOCK_SAMPLES)
+    {
+        RenderBlock();
+    }
+
+    qResult_t res = Dac6551_Start();
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("[SPK] DAC start failed: %d", 0, res);
+        vTaskDelete(nullptr);
+        return;
+    }
+
+    while(true)
+    {
+        while(AudioRing_Free(&sRing) >= SPEAKER_BLOCK_SAMPLES)
+        {
+            RenderBlock();
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+
+#if SPEAKER_STATS_INTERVAL_MS > 0
+        if((xTaskGetTickCount() - lastStats) >= pdMS_TO_TICKS(SPEAKER_STATS_INTERVAL_MS))
+        {
+            SpeakerStats_t stats;
+            GetStats(&stats);
+            GP_LOG_SYSTEM_PRINTF("[SPK] chimes:%lu+%lu late:%lu err:%ld us max:%lu us underruns:%lu", 0,
+                                 (unsigned long)stats.scheduled, (unsigned long)stats.immediate,
+                                 (unsigned long)stats.late, (long)stats.lastErrorUs,
+                                 (unsigned long)stats.maxErrorUs, (unsigned long)stats.underruns);
+            lastStats = xTaskGetTickCount();
+        }
+#endif
+    }
+}
@@ -77,6 +77,7 @@ typedef struct {
         kBleConnectionEvent_Connected = 0x0,
         kBleConnectionEvent_Advertise_Start = 0x1,
         kBleConnectionEvent_Disconnected = 0x2,
+        kBleConnectionEvent_StackReady = 0x3,
 
         kBleLedControlCharUpdate = 0x10,
     } Event;
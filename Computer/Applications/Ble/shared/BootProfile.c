@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BootProfile.c"
+ *
+ * Boot-time profile: first begin and end time of each start-up phase.
+ */
+
+#include "BootProfile.h"
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+static const char* const sNames[BootProfile_Phases] = {"ble-reset", "thread-init", "attach", "first-event"};
+
+static volatile bool sBegun[BootProfile_Phases];
+static volatile bool sEnded[BootProfile_Phases];
+static uint32_t      sBeginMs[BootProfile_Phases];
+static uint32_t      sEndMs[BootProfile_Phases];
+
+static uint32_t BootProfile_NowMs(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+void BootProfile_Begin(BootProfile_Phase_t phase)
+{
+    if(phase >= BootProfile_Phases || sBegun[phase])
+    {
+        return;
+    }
+    sBeginMs[phase] = BootProfile_NowMs();
+    sBegun[phase]   = true;
+}
+
+bool BootProfile_End(BootProfile_Phase_t phase)
+{
+    if(phase >= BootProfile_Phases || sEnded[phase])
+    {
+        return false;
+    }
+    if(!sBegun[phase])
+    {
+        sBeginMs[phase] = 0;
+        sBegun[phase]   = true;
+    }
+    sEndMs[phase] = BootProfile_NowMs();
+    sEnded[phase] = true;
+    return true;
+}
+
+uint32_t BootProfile_Duration(BootProfile_Phase_t phase)
+{
+    if(phase >= BootProfile_Phases || !sEnded[phase])
+    {
+        return 0;
+    }
+    return sEndMs[phase] - sBeginMs[phase];
+}
+
+void BootProfile_Log(void)
+{
+    uint8_t i;
+
+    for(i = 0; i < BootProfile_Phases; i++)
+    {
+        if(sEnded[i])
+        {
+            GP_LOG_SYSTEM_PRINTF("[BOOT] %s: %lu ms (done at %lu ms)", 0, sNames[i],
+                                 (unsigned long)(sEndMs[i] - sBeginMs[i]), (unsigned long)sEndMs[i]);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BootProfile.h"
+ *
+ * Boot-time profile: how long each start-up phase of a node takes.
+ *
+ *   BootProfile_BleReset   : BleIf_Init() to DM_RESET_CMPL_IND
+ *   BootProfile_ThreadInit : Thread_Init() (radio, OpenThread instance, CoAP)
+ *   BootProfile_Attach     : Thread enabled to first attach
+ *   BootProfile_FirstEvent : first local event to its first transmission
+ *                            (doorbell: press to ring on the mesh)
+ *
+ * Each phase is recorded once, on its first Begin/End; later calls are
+ * ignored, so the profile describes the boot only.  Times are taken from
+ * the FreeRTOS tick, so "at" times count from scheduler start, not from
+ * power-on: the ROM bootloader and the C start-up are not included.
+ *
+ * Threading: each phase has its own slots, so phases may be marked from
+ * different tasks (the BLE reset from the BLE stack callback).
+ */
+
+#ifndef _BOOT_PROFILE_H_
+#define _BOOT_PROFILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    BootProfile_BleReset = 0,
+    BootProfile_ThreadInit,
+    BootProfile_Attach,
+    BootProfile_FirstEvent,
+    BootProfile_Phases
+} BootProfile_Phase_t;
+
+/** @brief Start of a phase (first call only). */
+void BootProfile_Begin(BootProfile_Phase_t phase);
+
+/** @brief End of a phase (first call only); a phase never begun starts at 0.
+ *  @return true if this call recorded the end */
+bool BootProfile_End(BootProfile_Phase_t phase);
+
+/** @brief Duration of an ended phase in ms, 0 if it has not ended. */
+uint32_t BootProfile_Duration(BootProfile_Phase_t phase);
+
+/** @brief Log every ended phase: duration and end time. */
+void BootProfile_Log(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BOOT_PROFILE_H_ */
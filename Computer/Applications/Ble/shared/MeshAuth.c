@@ -0,0 +1,757 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshAuth.c"
+ *
+ * Authenticated event frames (AES-CCM tag, no encrypted payload).
+ */
+
+#include "MeshAuth.h"
+
+#include <string.h>
+
+#include "gpLog.h"
+#include "gpSched.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <openthread/platform/crypto.h>
+#include <openthread/platform/settings.h>
+
+#include "MeshTlvNode.h"
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+#define MESH_AUTH_BLOCK             16
+#define MESH_AUTH_NONCE_LEN         13
+
+/* CCM flags (RFC 3610): L = 2, M = MESH_AUTH_TAG_LEN, with associated data */
+#define MESH_AUTH_CCM_L             2
+#define MESH_AUTH_FLAGS_B0          (0x40 | (((MESH_AUTH_TAG_LEN - 2) / 2) << 3) | (MESH_AUTH_CCM_L - 1))
+#define MESH_AUTH_FLAGS_A0          (MESH_AUTH_CCM_L - 1)
+
+/* Storage for the platform AES context (mbedtls_aes_context in the port) */
+#define MESH_AUTH_AES_CONTEXT_WORDS 128
+
+#define MESH_AUTH_BENCHMARK_FRAMES  100
+
+typedef void (*MeshAuth_Block_t)(void* pContext, const uint8_t* pIn, uint8_t* pOut);
+
+typedef struct
+{
+    otCryptoContext context;
+    uint32_t        storage[MESH_AUTH_AES_CONTEXT_WORDS];
+    bool            ready;
+} MeshAuth_Aes_t;
+
+typedef struct
+{
+    uint32_t deviceId;
+    uint8_t  key[MESH_AUTH_KEY_LEN];
+} MeshAuth_Peer_t;
+
+/* Stored as is under MESH_AUTH_SETTINGS_KEY */
+typedef struct
+{
+    uint8_t         hasOwnKey;
+    uint8_t         ownKey[MESH_AUTH_KEY_LEN];
+    uint8_t         peerCount;
+    MeshAuth_Peer_t peers[MESH_AUTH_PEERS];
+    uint8_t         locked;     /* No more writes until a factory reset */
+} MeshAuth_Keys_t;
+
+/* Replay window of a trusted sender (bit n = top - n was seen) */
+typedef struct
+{
+    uint32_t top;
+    uint32_t bitmap;
+    bool     seen;
+} MeshAuth_Window_t;
+
+static otInstance*       sInstance = NULL;
+static MeshAuth_Notify_t sNotify   = NULL;
+
+/* Key table: written by the application task, read by the OpenThread
+ * context; guarded by a critical section */
+static MeshAuth_Keys_t   sKeys;
+static MeshAuth_Window_t sWindows[MESH_AUTH_PEERS];
+
+/* Provisioning write waiting for MeshAuth_Process() */
+static uint8_t           sWrite[MESH_AUTH_WRITE_MAX];
+static uint8_t           sWriteLen     = 0;
+static volatile bool     sWritePending = false;
+
+/* Own frame counter and the end of its NVM reservation (application task) */
+static uint32_t          sCounter    = 0;
+static uint32_t          sCounterEnd = 0;
+
+/* One AES context per task: signing (own key) and checking (sender key) */
+static MeshAuth_Aes_t    sSignAes;
+static MeshAuth_Aes_t    sCheckAes;
+static uint32_t          sCheckKeyId  = 0;
+static bool              sCheckKeySet = false;
+
+static MeshAuth_Stats_t  sStats;
+
+/* -------------------------------------------------------------------------
+ * AES-128 on the crypto accelerator
+ * ------------------------------------------------------------------------- */
+
+static bool MeshAuth_AesSetKey(MeshAuth_Aes_t* pAes, const uint8_t* pKey)
+{
+    otCryptoKey key;
+
+    if(!pAes->ready)
+    {
+        pAes->context.mContext     = pAes->storage;
+        pAes->context.mContextSize = sizeof(pAes->storage);
+        if(otPlatCryptoAesInit(&pAes->context) != OT_ERROR_NONE)
+        {
+            return false;
+        }
+        pAes->ready = true;
+    }
+
+    key.mKey       = pKey;
+    key.mKeyLength = MESH_AUTH_KEY_LEN;
+    key.mKeyRef    = 0;
+    return otPlatCryptoAesSetKey(&pAes->context, &key) == OT_ERROR_NONE;
+}
+
+static void MeshAuth_AesBlock(void* pContext, const uint8_t* pIn, uint8_t* pOut)
+{
+    otPlatCryptoAesEncrypt(&((MeshAuth_Aes_t*)pContext)->context, pIn, pOut);
+}
+
+/* -------------------------------------------------------------------------
+ * CCM tag over @p pAad, no payload (RFC 3610, L = 2)
+ * ------------------------------------------------------------------------- */
+
+static void MeshAuth_Tag(MeshAuth_Block_t block, void* pContext, const uint8_t* pNonce, const uint8_t* pAad,
+                         uint16_t aadLen, uint8_t* pTag)
+{
+    uint8_t  x[MESH_AUTH_BLOCK];
+    uint8_t  b[MESH_AUTH_BLOCK];
+    uint16_t pos;
+    uint8_t  i;
+    uint8_t  fill;
+
+    /* B0: flags, nonce, message length 0 */
+    memset(b, 0, sizeof(b));
+    b[0] = MESH_AUTH_FLAGS_B0;
+    memcpy(&b[1], pNonce, MESH_AUTH_NONCE_LEN);
+    block(pContext, b, x);
+
+    /* Associated data: BE16 length, the data, zero padding; CBC-MAC */
+    b[0] = (uint8_t)(aadLen >> 8);
+    b[1] = (uint8_t)aadLen;
+    fill = 2;
+    pos  = 0;
+    while(pos < aadLen || fill > 0)
+    {
+        for(i = fill; i < MESH_AUTH_BLOCK; i++)
+        {
+            b[i] = (pos < aadLen) ? pAad[pos++] : 0;
+        }
+        fill = 0;
+        for(i = 0; i < MESH_AUTH_BLOCK; i++)
+        {
+            b[i] ^= x[i];
+        }
+        block(pContext, b, x);
+    }
+
+    /* Encrypt the MAC with S0 = E(A0) */
+    memset(b, 0, sizeof(b));
+    b[0] = MESH_AUTH_FLAGS_A0;
+    memcpy(&b[1], pNonce, MESH_AUTH_NONCE_LEN);
+    block(pContext, b, b);
+    for(i = 0; i < MESH_AUTH_TAG_LEN; i++)
+    {
+        pTag[i] = x[i] ^ b[i];
+    }
+}
+
+/* Nonce: device id (BE32), counter (BE32), device type, zeros */
+static void MeshAuth_Nonce(const uint8_t* pFrame, const uint8_t* pCounter, uint8_t* pNonce)
+{
+    memset(pNonce, 0, MESH_AUTH_NONCE_LEN);
+    memcpy(&pNonce[0], &pFrame[3], 4);
+    memcpy(&pNonce[4], pCounter, 4);
+    pNonce[8] = pFrame[2];
+}
+
+/* Tag compare in constant time: no early exit on the first differing byte */
+static bool MeshAuth_TagEqual(const uint8_t* pA, const uint8_t* pB)
+{
+    uint8_t diff = 0;
+    uint8_t i;
+
+    for(i = 0; i < MESH_AUTH_TAG_LEN; i++)
+    {
+        diff |= (uint8_t)(pA[i] ^ pB[i]);
+    }
+    return diff == 0;
+}
+
+static uint16_t MeshAuth_ElapsedUs(uint32_t startUs)
+{
+    uint32_t us = gpSched_GetCurrentTime() - startUs;
+
+    return (us > 0xFFFF) ? 0xFFFF : (uint16_t)us;
+}
+
+/* -------------------------------------------------------------------------
+ * Software AES-128, for the benchmark only
+ * ------------------------------------------------------------------------- */
+#if MESH_AUTH_BENCHMARK
+
+static const uint8_t sSbox[256] = {
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+typedef struct
+{
+    uint8_t roundKeys[176];
+} MeshAuth_SoftAes_t;
+
+static uint8_t MeshAuth_Xtime(uint8_t x)
+{
+    return (uint8_t)((x << 1) ^ ((x & 0x80) ? 0x1B : 0x00));
+}
+
+static void MeshAuth_SoftSetKey(MeshAuth_SoftAes_t* pAes, const uint8_t* pKey)
+{
+    uint8_t* rk   = pAes->roundKeys;
+    uint8_t  rcon = 0x01;
+    uint8_t  t[4];
+    uint8_t  tmp;
+    uint8_t  i;
+    uint8_t  j;
+
+    memcpy(rk, pKey, MESH_AUTH_KEY_LEN);
+    for(i = 16; i < 176; i += 4)
+    {
+        memcpy(t, &rk[i - 4], 4);
+        if(i % 16 == 0)
+        {
+            tmp  = t[0];
+            t[0] = sSbox[t[1]] ^ rcon;
+            t[1] = sSbox[t[2]];
+            t[2] = sSbox[t[3]];
+            t[3] = sSbox[tmp];
+            rcon = MeshAuth_Xtime(rcon);
+        }
+        for(j = 0; j < 4; j++)
+        {
+            rk[i + j] = rk[i - 16 + j] ^ t[j];
+        }
+    }
+}
+
+static void MeshAuth_SoftBlock(void* pContext, const uint8_t* pIn, uint8_t* pOut)
+{
+    const uint8_t* rk = ((MeshAuth_SoftAes_t*)pContext)->roundKeys;
+    uint8_t        s[16];
+    uint8_t        t[16];
+    uint8_t        round;
+    uint8_t        c;
+    uint8_t        r;
+
+    for(c = 0; c < 16; c++)
+    {
+        s[c] = pIn[c] ^ rk[c];
+    }
+    for(round = 1; round <= 10; round++)
+    {
+        /* SubBytes and ShiftRows; byte 4c + r is row r of column c */
+        for(c = 0; c < 4; c++)
+        {
+            for(r = 0; r < 4; r++)
+            {
+                t[4 * c + r] = sSbox[s[4 * ((c + r) % 4) + r]];
+            }
+        }
+        if(round < 10)
+        {
+            for(c = 0; c < 4; c++)
+            {
+                uint8_t* a   = &t[4 * c];
+                uint8_t  a0  = a[0];
+                uint8_t  all = a[0] ^ a[1] ^ a[2] ^ a[3];
+
+                a[0] ^= all ^ MeshAuth_Xtime(a[0] ^ a[1]);
+                a[1] ^= all ^ MeshAuth_Xtime(a[1] ^ a[2]);
+                a[2] ^= all ^ MeshAuth_Xtime(a[2] ^ a[3]);
+                a[3] ^= all ^ MeshAuth_Xtime(a[3] ^ a0);
+            }
+        }
+        for(c = 0; c < 16; c++)
+        {
+            s[c] = t[c] ^ rk[16 * round + c];
+        }
+    }
+    memcpy(pOut, s, sizeof(s));
+}
+
+/* Tag a ring-sized frame MESH_AUTH_BENCHMARK_FRAMES times with each AES */
+static void MeshAuth_Benchmark(void)
+{
+    static const uint8_t key[MESH_AUTH_KEY_LEN] = {0x42};
+    MeshAuth_SoftAes_t   soft;
+    MeshTlv_Writer_t     writer;
+    uint8_t              frame[MESH_TLV_MAX_FRAME];
+    uint8_t              nonce[MESH_AUTH_NONCE_LEN];
+    uint8_t              tag[MESH_AUTH_TAG_LEN];
+    uint16_t             len;
+    uint32_t             start;
+    uint32_t             hwUs;
+    uint32_t             swUs;
+    uint16_t             i;
+
+    MeshTlvNode_Begin(&writer, frame, sizeof(frame), NULL);
+    MeshTlv_Reserve(&writer, MESH_TLV_REC_RING, MESH_TLV_RING_LEN);
+    MeshTlv_PutU32(&writer, MESH_TLV_REC_PLAY_AT, 0);
+    MeshTlv_Reserve(&writer, MESH_AUTH_REC, 4);
+    len = MeshTlv_Finish(&writer);
+    MeshAuth_Nonce(frame, &frame[len - 4], nonce);
+
+    if(!MeshAuth_AesSetKey(&sCheckAes, key))
+    {
+        GP_LOG_SYSTEM_PRINTF("[Auth] Benchmark: no AES accelerator", 0);
+        return;
+    }
+    sCheckKeySet = false;
+    start        = gpSched_GetCurrentTime();
+    for(i = 0; i < MESH_AUTH_BENCHMARK_FRAMES; i++)
+    {
+        MeshAuth_Tag(MeshAuth_AesBlock, &sCheckAes, nonce, frame, len, tag);
+    }
+    hwUs = gpSched_GetCurrentTime() - start;
+
+    MeshAuth_SoftSetKey(&soft, key);
+    start = gpSched_GetCurrentTime();
+    for(i = 0; i < MESH_AUTH_BENCHMARK_FRAMES; i++)
+    {
+        MeshAuth_Tag(MeshAuth_SoftBlock, &soft, nonce, frame, len, tag);
+    }
+    swUs = gpSched_GetCurrentTime() - start;
+
+    GP_LOG_SYSTEM_PRINTF("[Auth] Tag over %u bytes: accelerator %lu.%02lu us, software %lu.%02lu us per frame", 0, len,
+                         (unsigned long)(hwUs / MESH_AUTH_BENCHMARK_FRAMES),
+                         (unsigned long)(hwUs % MESH_AUTH_BENCHMARK_FRAMES),
+                         (unsigned long)(swUs / MESH_AUTH_BENCHMARK_FRAMES),
+                         (unsigned long)(swUs % MESH_AUTH_BENCHMARK_FRAMES));
+}
+
+#endif /* MESH_AUTH_BENCHMARK */
+
+/* -------------------------------------------------------------------------
+ * Keys and counter
+ * ------------------------------------------------------------------------- */
+
+static void MeshAuth_Reserve(uint32_t end)
+{
+    otError err = otPlatSettingsSet(sInstance, MESH_AUTH_COUNTER_KEY, (const uint8_t*)&end, sizeof(end));
+
+    /* Sign on regardless: a reused counter after a reboot only gets frames
+     * dropped as replays until the counter passes the old one again */
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Auth] Counter not stored: %d", 0, (int)err);
+    }
+    sCounterEnd = end;
+}
+
+static void MeshAuth_Log(void)
+{
+    GP_LOG_SYSTEM_PRINTF("[Auth] %s, %u trusted sender(s), counter %lu%s", 0,
+                         sKeys.hasOwnKey ? "Signing" : "Not signing", sKeys.peerCount, (unsigned long)sCounter,
+                         sKeys.locked ? ", locked" : "");
+}
+
+static void MeshAuth_Store(const MeshAuth_Keys_t* pKeys)
+{
+    otError err = otPlatSettingsSet(sInstance, MESH_AUTH_SETTINGS_KEY, (const uint8_t*)pKeys, sizeof(*pKeys));
+
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Auth] Keys not stored: %d", 0, (int)err);
+    }
+}
+
+/* @return Index of the sender in @p pKeys, or pKeys->peerCount if it is not there */
+static uint8_t MeshAuth_FindPeer(const MeshAuth_Keys_t* pKeys, uint32_t deviceId)
+{
+    uint8_t i;
+
+    for(i = 0; i < pKeys->peerCount; i++)
+    {
+        if(pKeys->peers[i].deviceId == deviceId)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/* Apply one provisioning write to @p pKeys; false if it changes nothing */
+static bool MeshAuth_Apply(MeshAuth_Keys_t* pKeys, const uint8_t* pValue, uint8_t len)
+{
+    static const uint8_t zero[MESH_AUTH_KEY_LEN] = {0};
+    uint32_t             deviceId;
+    uint8_t              i;
+
+    if(len == 1)
+    {
+        memset(pKeys, 0, sizeof(*pKeys));
+        return true;
+    }
+    if(len == MESH_AUTH_KEY_LEN)
+    {
+        pKeys->hasOwnKey = 1;
+        memcpy(pKeys->ownKey, pValue, MESH_AUTH_KEY_LEN);
+        return true;
+    }
+
+    deviceId = ((uint32_t)pValue[0] << 24) | ((uint32_t)pValue[1] << 16) | ((uint32_t)pValue[2] << 8) | pValue[3];
+    i        = MeshAuth_FindPeer(pKeys, deviceId);
+
+    if(memcmp(&pValue[4], zero, MESH_AUTH_KEY_LEN) == 0)
+    {
+        if(i == pKeys->peerCount)
+        {
+            return false;
+        }
+        pKeys->peerCount--;
+        memmove(&pKeys->peers[i], &pKeys->peers[i + 1], (pKeys->peerCount - i) * sizeof(MeshAuth_Peer_t));
+        return true;
+    }
+    if(i == MESH_AUTH_PEERS)
+    {
+        return false;
+    }
+    if(i == pKeys->peerCount)
+    {
+        pKeys->peerCount++;
+    }
+    pKeys->peers[i].deviceId = deviceId;
+    memcpy(pKeys->peers[i].key, &pValue[4], MESH_AUTH_KEY_LEN);
+    return true;
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshAuth_Init(otInstance* pInstance, MeshAuth_Notify_t notify)
+{
+    uint32_t stored = 0;
+    uint16_t len    = sizeof(sKeys);
+
+    sInstance = pInstance;
+    sNotify   = notify;
+    memset(&sStats, 0, sizeof(sStats));
+    memset(sWindows, 0, sizeof(sWindows));
+
+    if(otPlatSettingsGet(sInstance, MESH_AUTH_SETTINGS_KEY, 0, (uint8_t*)&sKeys, &len) != OT_ERROR_NONE ||
+       len != sizeof(sKeys) || sKeys.peerCount > MESH_AUTH_PEERS)
+    {
+        memset(&sKeys, 0, sizeof(sKeys));
+    }
+    if(sKeys.hasOwnKey && !MeshAuth_AesSetKey(&sSignAes, sKeys.ownKey))
+    {
+        GP_LOG_SYSTEM_PRINTF("[Auth] AES key not loaded", 0);
+    }
+
+    /* Continue after the last reservation: no counter is ever reused */
+    len = sizeof(stored);
+    if(otPlatSettingsGet(sInstance, MESH_AUTH_COUNTER_KEY, 0, (uint8_t*)&stored, &len) != OT_ERROR_NONE ||
+       len != sizeof(stored))
+    {
+        stored = 0;
+    }
+    sCounter = stored;
+    MeshAuth_Reserve(stored + MESH_AUTH_COUNTER_BLOCK);
+
+    MeshAuth_Log();
+#if MESH_AUTH_BENCHMARK
+    MeshAuth_Benchmark();
+#endif
+}
+
+bool MeshAuth_Sign(MeshTlv_Writer_t* pWriter)
+{
+    uint32_t start = gpSched_GetCurrentTime();
+    uint8_t  nonce[MESH_AUTH_NONCE_LEN];
+    uint8_t* pValue;
+    uint32_t counter;
+    uint16_t us;
+
+    if(!sKeys.hasOwnKey || pWriter->overflow)
+    {
+        return !pWriter->overflow;
+    }
+
+    pValue = MeshTlv_Reserve(pWriter, MESH_AUTH_REC, MESH_AUTH_REC_LEN);
+    if(pValue == NULL)
+    {
+        return false;
+    }
+
+    if(sCounter >= sCounterEnd)
+    {
+        MeshAuth_Reserve(sCounterEnd + MESH_AUTH_COUNTER_BLOCK);
+    }
+    counter   = sCounter++;
+    pValue[0] = (uint8_t)(counter >> 24);
+    pValue[1] = (uint8_t)(counter >> 16);
+    pValue[2] = (uint8_t)(counter >> 8);
+    pValue[3] = (uint8_t)counter;
+
+    MeshAuth_Nonce(pWriter->pBuf, pValue, nonce);
+    MeshAuth_Tag(MeshAuth_AesBlock, &sSignAes, nonce, pWriter->pBuf, pWriter->len - MESH_AUTH_TAG_LEN, &pValue[4]);
+
+    sStats.signedFrames++;
+    us = MeshAuth_ElapsedUs(start);
+    if(us > sStats.signUsMax)
+    {
+        sStats.signUsMax = us;
+    }
+    return true;
+}
+
+MeshAuth_Result_t MeshAuth_Check(const uint8_t* pFrame, uint16_t len)
+{
+    uint32_t          start = gpSched_GetCurrentTime();
+    MeshTlv_Reader_t  reader;
+    MeshTlv_Header_t  header;
+    MeshTlv_Record_t  record;
+    MeshAuth_Window_t window;
+    uint8_t           key[MESH_AUTH_KEY_LEN];
+    uint8_t           nonce[MESH_AUTH_NONCE_LEN];
+    uint8_t           tag[MESH_AUTH_TAG_LEN];
+    uint32_t          counter;
+    uint32_t          age;
+    bool              strict;
+    bool              signedFrame = false;
+    uint8_t           peer;
+    uint16_t          us;
+
+    if(MeshTlv_ReaderInit(&reader, pFrame, len, &header) == MeshTlv_Ok)
+    {
+        /* Signed: the last record is AUTH and ends the frame */
+        while(MeshTlv_Next(&reader, &record))
+        {
+            signedFrame = (record.type == MESH_AUTH_REC && record.len == MESH_AUTH_REC_LEN);
+        }
+        signedFrame = signedFrame && !reader.truncated;
+    }
+
+    taskENTER_CRITICAL();
+    strict = (sKeys.peerCount > 0);
+    peer   = signedFrame ? MeshAuth_FindPeer(&sKeys, header.deviceId) : sKeys.peerCount;
+    if(peer < sKeys.peerCount)
+    {
+        memcpy(key, sKeys.peers[peer].key, sizeof(key));
+        window = sWindows[peer];
+    }
+    else
+    {
+        peer = MESH_AUTH_PEERS;
+    }
+    taskEXIT_CRITICAL();
+
+    if(peer == MESH_AUTH_PEERS)
+    {
+        if(strict)
+        {
+            sStats.rejected++;
+            return MeshAuth_Rejected;
+        }
+        return MeshAuth_Open;
+    }
+
+    if(!sCheckKeySet || sCheckKeyId != header.deviceId)
+    {
+        sCheckKeySet = MeshAuth_AesSetKey(&sCheckAes, key);
+        sCheckKeyId  = header.deviceId;
+    }
+    MeshAuth_Nonce(pFrame, record.pValue, nonce);
+    MeshAuth_Tag(MeshAuth_AesBlock, &sCheckAes, nonce, pFrame, len - MESH_AUTH_TAG_LEN, tag);
+
+    us = MeshAuth_ElapsedUs(start);
+    if(us > sStats.checkUsMax)
+    {
+        sStats.checkUsMax = us;
+    }
+    if(!sCheckKeySet || !MeshAuth_TagEqual(tag, &record.pValue[4]))
+    {
+        sStats.rejected++;
+        return MeshAuth_Rejected;
+    }
+
+    /* Replay window */
+    counter = MeshTlv_GetU32(&record, 0);
+    if(!window.seen || counter > window.top)
+    {
+        age           = window.seen ? counter - window.top : MESH_AUTH_WINDOW;
+        window.bitmap = (age >= MESH_AUTH_WINDOW) ? 1 : ((window.bitmap << age) | 1);
+        window.top    = counter;
+        window.seen   = true;
+    }
+    else
+    {
+        age = window.top - counter;
+        if(age >= MESH_AUTH_WINDOW || (window.bitmap & (1UL << age)) != 0)
+        {
+            sStats.replays++;
+            return MeshAuth_Replay;
+        }
+        window.bitmap |= 1UL << age;
+    }
+
+    taskENTER_CRITICAL();
+    /* The table may have changed meanwhile: store only for the same sender */
+    if(peer < sKeys.peerCount && sKeys.peers[peer].deviceId == header.deviceId)
+    {
+        sWindows[peer] = window;
+    }
+    taskEXIT_CRITICAL();
+
+    sStats.valid++;
+    return MeshAuth_Valid;
+}
+
+bool MeshAuth_Write(const uint8_t* pValue, uint16_t len)
+{
+    if(!(len == 1 && pValue[0] == 0) && len != MESH_AUTH_KEY_LEN && len != MESH_AUTH_WRITE_MAX)
+    {
+        return false;
+    }
+    if(sWritePending || sKeys.locked)
+    {
+        return false;
+    }
+
+    memcpy(sWrite, pValue, len);
+    sWriteLen     = (uint8_t)len;
+    sWritePending = true;
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+    return true;
+}
+
+void MeshAuth_Process(void)
+{
+    MeshAuth_Keys_t keys;
+
+    if(!sWritePending || sInstance == NULL)
+    {
+        return;
+    }
+
+    keys = sKeys;
+    if(keys.locked)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Auth] Key write ignored (locked)", 0);
+    }
+    else if(MeshAuth_Apply(&keys, sWrite, sWriteLen))
+    {
+        if(keys.hasOwnKey && !MeshAuth_AesSetKey(&sSignAes, keys.ownKey))
+        {
+            GP_LOG_SYSTEM_PRINTF("[Auth] AES key not loaded", 0);
+        }
+
+        taskENTER_CRITICAL();
+        sKeys = keys;
+        memset(sWindows, 0, sizeof(sWindows));
+        sCheckKeySet = false;
+        taskEXIT_CRITICAL();
+
+        MeshAuth_Store(&keys);
+        MeshAuth_Log();
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[Auth] Key write ignored (unknown sender or table full)", 0);
+    }
+    memset(&keys, 0, sizeof(keys));
+    memset(sWrite, 0, sizeof(sWrite));
+    sWritePending = false;
+}
+
+void MeshAuth_Lock(void)
+{
+    MeshAuth_Keys_t keys;
+
+    MeshAuth_Process();
+    if(sInstance == NULL || sKeys.locked || (!sKeys.hasOwnKey && sKeys.peerCount == 0))
+    {
+        return;
+    }
+
+    keys        = sKeys;
+    keys.locked = 1;
+    MeshAuth_Store(&keys);
+    memset(&keys, 0, sizeof(keys));
+    sKeys.locked = 1;
+    MeshAuth_Log();
+}
+
+void MeshAuth_GetInfo(uint8_t* pInfo)
+{
+    uint32_t deviceId = MeshTlvNode_GetDeviceId();
+
+    pInfo[0] = (uint8_t)(deviceId >> 24);
+    pInfo[1] = (uint8_t)(deviceId >> 16);
+    pInfo[2] = (uint8_t)(deviceId >> 8);
+    pInfo[3] = (uint8_t)deviceId;
+    pInfo[4] = (sKeys.hasOwnKey ? MESH_AUTH_INFO_OWN_KEY : 0) | (sKeys.locked ? MESH_AUTH_INFO_LOCKED : 0);
+    pInfo[5] = sKeys.peerCount;
+}
+
+void MeshAuth_GetStats(MeshAuth_Stats_t* pStats)
+{
+    *pStats = sStats;
+}
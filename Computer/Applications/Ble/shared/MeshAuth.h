@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshAuth.h"
+ *
+ * Authenticated event frames: an AES-CCM tag over every TLV frame
+ * (MeshTlv.h) a node sends, so that a node holding the Thread network key
+ * still cannot pass off a ring or a motion event as another device's.
+ *
+ * The sender appends an AUTH record as the last record of the frame:
+ *
+ *     counter (u32)   frame counter of the sender, never reused
+ *     tag (8 bytes)   AES-CCM tag, M = 8, L = 2, no encrypted payload
+ *
+ * The tag covers the whole frame up to and including the counter as
+ * additional authenticated data, so the records stay readable by older
+ * receivers and the gateway.  Nonce (13 bytes): device id (BE32), counter
+ * (BE32), device type, then zeros.
+ *
+ * Keys are per device.  A node signs with its own key and checks a frame
+ * with the key of its sender, from a table of trusted senders.  Both are
+ * provisioned over BLE (MeshAuth_Write, at most MESH_AUTH_WRITE_MAX bytes):
+ *
+ *     16 bytes   own key
+ *     20 bytes   trusted sender: device id (BE32), key; an all-zero key
+ *                removes the sender
+ *     1 byte 0   forget all keys, stop signing
+ *
+ * and kept in the OpenThread settings (NVM) under MESH_AUTH_SETTINGS_KEY.
+ * The BLE link is not encrypted, so any central could write them.  The
+ * keys are therefore locked (MeshAuth_Lock) when the BLE connection that
+ * wrote them closes: further writes are refused until a factory reset,
+ * which wipes the settings.  The written value does not stay in the GATT
+ * attribute, which only reads back MeshAuth_GetInfo().
+ * A node with no trusted sender accepts every frame, as before; once it
+ * has one, it only accepts frames it can check.
+ *
+ * Replay protection: the frame counter is 32 bits and survives reboots.
+ * It is reserved in NVM MESH_AUTH_COUNTER_BLOCK frames at a time, and a
+ * reboot continues from the end of the last block.  The 16-bit header
+ * sequence cannot serve, as it restarts at a random value.  A receiver
+ * keeps, per trusted sender, the highest counter seen and a window of the
+ * MESH_AUTH_WINDOW before it; an older or repeated counter is a replay.
+ * The window is in RAM, so right after the receiver reboots an old frame
+ * of a sender is accepted if it is the first one it sees from it.
+ *
+ * AES runs through otPlatCryptoAes*(), which the QPG6200 port backs with
+ * the crypto accelerator.  A tag costs two AES blocks plus one per 16
+ * bytes of frame, five for a ring.  With MESH_AUTH_BENCHMARK set,
+ * MeshAuth_Init() logs the cost per frame of the accelerator and of a
+ * software AES.
+ *
+ * Threading: MeshAuth_Sign(), MeshAuth_Process() and MeshAuth_Lock() run
+ * in the application task, MeshAuth_Check() in the OpenThread context and
+ * MeshAuth_Write() in the BLE stack context.
+ */
+
+#ifndef _MESH_AUTH_H_
+#define _MESH_AUTH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "MeshTlv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** AUTH record */
+#define MESH_AUTH_REC               MESH_TLV_REC_AUTH
+#define MESH_AUTH_KEY_LEN           16
+#define MESH_AUTH_TAG_LEN           8
+#define MESH_AUTH_REC_LEN           MESH_TLV_AUTH_LEN
+
+/** Bytes the AUTH record adds to a frame */
+#define MESH_AUTH_OVERHEAD          (MESH_TLV_RECORD_HDR_LEN + MESH_AUTH_REC_LEN)
+
+/** Trusted senders kept */
+#define MESH_AUTH_PEERS             6
+
+/** Counters accepted behind the highest one seen, per sender */
+#define MESH_AUTH_WINDOW            32
+
+/** Frame counters reserved per NVM write */
+#define MESH_AUTH_COUNTER_BLOCK     1024
+
+/** Keys (own key, then the trusted senders) and the counter reservation */
+#define MESH_AUTH_SETTINGS_KEY      0x8002
+#define MESH_AUTH_COUNTER_KEY       0x8003
+
+/** Largest provisioning write, and the read-back length */
+#define MESH_AUTH_WRITE_MAX         20
+#define MESH_AUTH_INFO_LEN          6
+
+/** Read-back flags */
+#define MESH_AUTH_INFO_OWN_KEY      0x01
+#define MESH_AUTH_INFO_LOCKED       0x02
+
+#ifndef MESH_AUTH_BENCHMARK
+#define MESH_AUTH_BENCHMARK         0
+#endif
+
+typedef enum
+{
+    MeshAuth_Open = 0,      /**< Not checked: unsigned, and no trusted sender configured */
+    MeshAuth_Valid,         /**< Tag and counter good */
+    MeshAuth_Replay,        /**< Tag good, counter already seen or too old */
+    MeshAuth_Rejected       /**< Bad tag, unknown sender, or unsigned while senders are configured */
+} MeshAuth_Result_t;
+
+typedef struct
+{
+    uint32_t signedFrames;
+    uint32_t valid;
+    uint32_t replays;
+    uint32_t rejected;
+    uint16_t signUsMax;     /**< Slowest MeshAuth_Sign(), us */
+    uint16_t checkUsMax;    /**< Slowest MeshAuth_Check() of a signed frame, us */
+} MeshAuth_Stats_t;
+
+/** Called from the BLE stack context when a provisioning write is ready; post to the app task. */
+typedef void (*MeshAuth_Notify_t)(void);
+
+/** @brief Load the keys and reserve the next block of frame counters. */
+void MeshAuth_Init(otInstance* pInstance, MeshAuth_Notify_t notify);
+
+/** @brief Append the AUTH record to a frame, as its last record; does nothing without an own key.
+ *  @return false if the record did not fit (MeshTlv_Finish then returns 0) */
+bool MeshAuth_Sign(MeshTlv_Writer_t* pWriter);
+
+/** @brief Check a received frame, TLV or legacy. */
+MeshAuth_Result_t MeshAuth_Check(const uint8_t* pFrame, uint16_t len);
+
+/** @brief Take a provisioning write (GATT write callback).
+ *  @return false if it is malformed, the previous one is not applied yet,
+ *          or the keys are locked */
+bool MeshAuth_Write(const uint8_t* pValue, uint16_t len);
+
+/** @brief Apply and store the written keys, if any. */
+void MeshAuth_Process(void);
+
+/** @brief Lock the keys, if any, until a factory reset.
+ *  Call from the app task when a BLE connection closes. */
+void MeshAuth_Lock(void);
+
+/** @brief Read-back for the GATT characteristic: device id (BE32), MESH_AUTH_INFO_* flags (u8),
+ *  trusted senders (u8). */
+void MeshAuth_GetInfo(uint8_t* pInfo);
+
+void MeshAuth_GetStats(MeshAuth_Stats_t* pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_AUTH_H_ */
@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshChannel.c"
+ *
+ * Channel survey.  The sweep counters are written in the OpenThread
+ * context while a scan runs and read by the application task once it is
+ * over (sScanDone), so they need no lock.
+ */
+
+#include "MeshChannel.h"
+
+#include <string.h>
+
+#include "MeshCoap.h"
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/dataset.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+#define MESH_CHANNEL_MASK          (((1UL << MESH_CHANNEL_COUNT) - 1) << MESH_CHANNEL_FIRST)
+#define MESH_CHANNEL_SLICE_MASK    ((1UL << MESH_CHANNEL_SLICE) - 1)
+#define MESH_CHANNEL_NOT_MEASURED  127
+#define MESH_CHANNEL_NO_SCORE      INT16_MAX
+
+static otInstance*                 sInstance = NULL;
+static MeshChannel_Notify_t        sNotify   = NULL;
+static MeshChannel_SurveyHandler_t sOnSurvey = NULL;
+
+static uint8_t                     sState = MeshChannel_Idle;
+static uint8_t                     sBest  = 0;
+static uint8_t                     sSweep = 0;
+static uint8_t                     sSlice  = 0;     /* Attached: next slice of the sweep */
+static bool                        sSliced = false; /* Attached when the survey started */
+static volatile bool               sScanDone = false;
+
+/* Per channel, channel 11 first */
+static int16_t                     sSum[MESH_CHANNEL_COUNT];
+static int8_t                      sFloor[MESH_CHANNEL_COUNT];
+static uint8_t                     sSamples[MESH_CHANNEL_COUNT];
+static uint8_t                     sBusy[MESH_CHANNEL_COUNT];
+
+/* Leader survey: due after the timer, done once per boot */
+static volatile bool               sLeaderDue  = false;
+static bool                        sLeaderDone = false;
+static bool                        sMoveCheck  = false;
+
+static StaticTimer_t               sTimerBuffer;
+static TimerHandle_t               sTimer = NULL;
+
+/* Attached: pause on the network channel before the next slice */
+static volatile bool               sResumeDue = false;
+static StaticTimer_t               sPauseTimerBuffer;
+static TimerHandle_t               sPauseTimer = NULL;
+
+static void MeshChannel_Notify(void)
+{
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshChannel_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    sLeaderDue = true;
+    MeshChannel_Notify();
+}
+
+static void MeshChannel_PauseCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    sResumeDue = true;
+    MeshChannel_Notify();
+}
+
+/* OpenThread context: one result per channel, then NULL at the end of the scan */
+static void MeshChannel_ScanResult(otEnergyScanResult* aResult, void* aContext)
+{
+    (void)aContext;
+
+    if(aResult == NULL)
+    {
+        sScanDone = true;
+        MeshChannel_Notify();
+        return;
+    }
+    if(aResult->mChannel < MESH_CHANNEL_FIRST || aResult->mChannel > MESH_CHANNEL_LAST ||
+       aResult->mMaxRssi == MESH_CHANNEL_NOT_MEASURED)
+    {
+        return;
+    }
+
+    uint8_t i = (uint8_t)(aResult->mChannel - MESH_CHANNEL_FIRST);
+
+    sSum[i] += aResult->mMaxRssi;
+    if(sSamples[i] == 0 || aResult->mMaxRssi < sFloor[i])
+    {
+        sFloor[i] = aResult->mMaxRssi;
+    }
+    if(aResult->mMaxRssi >= MESH_CHANNEL_BUSY_DBM)
+    {
+        sBusy[i]++;
+    }
+    sSamples[i]++;
+}
+
+static int8_t MeshChannel_Level(uint8_t i)
+{
+    return (sSamples[i] != 0) ? (int8_t)(sSum[i] / sSamples[i]) : MESH_CHANNEL_NOT_MEASURED;
+}
+
+static uint8_t MeshChannel_BusyPercent(uint8_t i)
+{
+    return (sSamples[i] != 0) ? (uint8_t)(sBusy[i] * 100 / sSamples[i]) : 0;
+}
+
+/* Lower is better */
+static int16_t MeshChannel_Score(uint8_t channel)
+{
+    uint8_t i = (uint8_t)(channel - MESH_CHANNEL_FIRST);
+
+    if(channel < MESH_CHANNEL_FIRST || channel > MESH_CHANNEL_LAST || sSamples[i] == 0)
+    {
+        return MESH_CHANNEL_NO_SCORE;
+    }
+    return (int16_t)(MeshChannel_Level(i) + MeshChannel_BusyPercent(i) * MESH_CHANNEL_BUSY_WEIGHT_DB / 100);
+}
+
+static void MeshChannel_Report(void)
+{
+    uint8_t survey[MESH_CHANNEL_SURVEY_LEN];
+
+    if(sOnSurvey != NULL)
+    {
+        MeshChannel_GetSurvey(survey);
+        sOnSurvey(survey, sizeof(survey));
+    }
+}
+
+static void MeshChannel_MoveResult(otError aResult, void* aContext)
+{
+    (void)aContext;
+
+    GP_LOG_SYSTEM_PRINTF("[Chan] Pending dataset %s: %d", 0, aResult == OT_ERROR_NONE ? "accepted" : "refused",
+                         (int)aResult);
+}
+
+/* Leader: move the network to the best channel if its own is clearly worse */
+static void MeshChannel_MoveIfBetter(void)
+{
+    otOperationalDataset active;
+    otOperationalDataset pending;
+    uint32_t             pendingSeconds = 0;
+    otError              err;
+
+    if(otThreadGetDeviceRole(sInstance) != OT_DEVICE_ROLE_LEADER ||
+       otDatasetGetActive(sInstance, &active) != OT_ERROR_NONE || !active.mComponents.mIsChannelPresent)
+    {
+        return;
+    }
+    if(sBest == active.mChannel ||
+       MeshChannel_Score(active.mChannel) - MeshChannel_Score(sBest) < MESH_CHANNEL_MOVE_MARGIN_DB)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Chan] Channel %u kept (score %d, best %u at %d)", 0, active.mChannel,
+                             MeshChannel_Score(active.mChannel), sBest, MeshChannel_Score(sBest));
+        return;
+    }
+
+    if(otDatasetGetPending(sInstance, &pending) == OT_ERROR_NONE && pending.mComponents.mIsPendingTimestampPresent)
+    {
+        pendingSeconds = (uint32_t)pending.mPendingTimestamp.mSeconds;
+    }
+
+    memset(&pending, 0, sizeof(pending));
+    pending.mActiveTimestamp          = active.mActiveTimestamp;
+    pending.mActiveTimestamp.mSeconds = active.mActiveTimestamp.mSeconds + 1;
+    pending.mPendingTimestamp.mSeconds = pendingSeconds + 1;
+    pending.mDelay                    = MESH_CHANNEL_MOVE_DELAY_MS;
+    pending.mChannel                  = sBest;
+    pending.mComponents.mIsActiveTimestampPresent  = true;
+    pending.mComponents.mIsPendingTimestampPresent = true;
+    pending.mComponents.mIsDelayPresent            = true;
+    pending.mComponents.mIsChannelPresent          = true;
+
+    err = otDatasetSendMgmtPendingSet(sInstance, &pending, NULL, 0, MeshChannel_MoveResult, NULL);
+    GP_LOG_SYSTEM_PRINTF("[Chan] Moving network %u -> %u in %lu s: %d", 0, active.mChannel, sBest,
+                         (unsigned long)(MESH_CHANNEL_MOVE_DELAY_MS / 1000), (int)err);
+}
+
+static bool MeshChannel_IsAttached(void)
+{
+    otDeviceRole role = otThreadGetDeviceRole(sInstance);
+
+    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+}
+
+/* Scan the whole sweep, or while attached its next slice */
+static otError MeshChannel_Scan(void)
+{
+    if(!sSliced)
+    {
+        return otLinkEnergyScan(sInstance, MESH_CHANNEL_MASK, MESH_CHANNEL_SCAN_MS, MeshChannel_ScanResult, NULL);
+    }
+    return otLinkEnergyScan(sInstance, MESH_CHANNEL_SLICE_MASK << (MESH_CHANNEL_FIRST + sSlice * MESH_CHANNEL_SLICE),
+                            MESH_CHANNEL_SLICE_SCAN_MS, MeshChannel_ScanResult, NULL);
+}
+
+/* Attached: next slice after a pause on the network channel */
+static void MeshChannel_Pause(void)
+{
+    if(sPauseTimer != NULL)
+    {
+        xTimerStart(sPauseTimer, 0);
+    }
+}
+
+static void MeshChannel_Finish(MeshChannel_State_t state)
+{
+    uint8_t channel;
+
+    sBest = MESH_CHANNEL_FALLBACK;
+    if(state == MeshChannel_Done)
+    {
+        for(channel = MESH_CHANNEL_FIRST; channel <= MESH_CHANNEL_LAST; channel++)
+        {
+            if(MeshChannel_Score(channel) < MeshChannel_Score(sBest))
+            {
+                sBest = channel;
+            }
+        }
+        GP_LOG_SYSTEM_PRINTF("[Chan] Survey done: best %u (level %d dBm, busy %u%%)", 0, sBest,
+                             MeshChannel_Level((uint8_t)(sBest - MESH_CHANNEL_FIRST)),
+                             MeshChannel_BusyPercent((uint8_t)(sBest - MESH_CHANNEL_FIRST)));
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[Chan] Survey failed, channel %u", 0, sBest);
+    }
+    sState = (uint8_t)state;
+    MeshChannel_Report();
+
+    if(sMoveCheck)
+    {
+        sMoveCheck = false;
+        if(state == MeshChannel_Done)
+        {
+            MeshChannel_MoveIfBetter();
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshChannel_Init(otInstance* pInstance, MeshChannel_Notify_t notify, MeshChannel_SurveyHandler_t onSurvey)
+{
+    sInstance = pInstance;
+    sNotify   = notify;
+    sOnSurvey = onSurvey;
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshChannel", pdMS_TO_TICKS(MESH_CHANNEL_LEADER_DELAY_MS), pdFALSE, NULL,
+                                    MeshChannel_TimerCallback, &sTimerBuffer);
+    }
+    if(sPauseTimer == NULL)
+    {
+        sPauseTimer = xTimerCreateStatic("MeshChanPause", pdMS_TO_TICKS(MESH_CHANNEL_SLICE_PAUSE_MS), pdFALSE, NULL,
+                                         MeshChannel_PauseCallback, &sPauseTimerBuffer);
+    }
+}
+
+otError MeshChannel_StartSurvey(void)
+{
+    otError err;
+
+    if(sInstance == NULL)
+    {
+        return OT_ERROR_INVALID_STATE;
+    }
+    if(sState == MeshChannel_Running)
+    {
+        return OT_ERROR_BUSY;
+    }
+
+    /* The MAC only scans with the interface up */
+    if(!otIp6IsEnabled(sInstance))
+    {
+        otIp6SetEnabled(sInstance, true);
+    }
+
+    memset(sSum, 0, sizeof(sSum));
+    memset(sFloor, 0, sizeof(sFloor));
+    memset(sSamples, 0, sizeof(sSamples));
+    memset(sBusy, 0, sizeof(sBusy));
+    sSweep     = 0;
+    sSlice     = 0;
+    sSliced    = MeshChannel_IsAttached();
+    sScanDone  = false;
+    sResumeDue = false;
+
+    if(sSliced && MeshCoap_CriticalPending())
+    {
+        /* First slice once the critical events are through */
+        MeshChannel_Pause();
+    }
+    else
+    {
+        err = MeshChannel_Scan();
+        if(err != OT_ERROR_NONE)
+        {
+            GP_LOG_SYSTEM_PRINTF("[Chan] Energy scan refused: %d", 0, (int)err);
+            return err;
+        }
+    }
+
+    GP_LOG_SYSTEM_PRINTF("[Chan] Survey started (%u sweeps%s)", 0, MESH_CHANNEL_SWEEPS, sSliced ? ", sliced" : "");
+    sState = MeshChannel_Running;
+    MeshChannel_Report();
+    return OT_ERROR_NONE;
+}
+
+void MeshChannel_Process(void)
+{
+    if(sInstance == NULL)
+    {
+        return;
+    }
+
+    if(sLeaderDue)
+    {
+        sLeaderDue = false;
+        if(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER)
+        {
+            sMoveCheck = (MeshChannel_StartSurvey() == OT_ERROR_NONE);
+        }
+    }
+
+    if(sState != MeshChannel_Running)
+    {
+        return;
+    }
+
+    if(sScanDone)
+    {
+        sScanDone = false;
+        if(sSliced && ++sSlice < MESH_CHANNEL_COUNT / MESH_CHANNEL_SLICE)
+        {
+            MeshChannel_Pause();
+            return;
+        }
+        sSlice = 0;
+        if(++sSweep >= MESH_CHANNEL_SWEEPS)
+        {
+            MeshChannel_Finish(MeshChannel_Done);
+            return;
+        }
+        if(sSliced)
+        {
+            MeshChannel_Pause();
+            return;
+        }
+    }
+    else if(sResumeDue)
+    {
+        sResumeDue = false;
+        if(MeshCoap_CriticalPending())
+        {
+            /* Stay on the network channel until they are delivered */
+            MeshChannel_Pause();
+            return;
+        }
+    }
+    else
+    {
+        return;
+    }
+
+    if(MeshChannel_Scan() != OT_ERROR_NONE)
+    {
+        /* Rank on the sweeps done so far, if any */
+        MeshChannel_Finish(sSweep > 0 ? MeshChannel_Done : MeshChannel_Failed);
+    }
+}
+
+void MeshChannel_RoleChanged(otDeviceRole role)
+{
+    if(role == OT_DEVICE_ROLE_LEADER && !sLeaderDone && sTimer != NULL)
+    {
+        sLeaderDone = true;
+        xTimerStart(sTimer, 0);
+    }
+}
+
+uint8_t MeshChannel_Best(void)
+{
+    return (sState == MeshChannel_Done || sState == MeshChannel_Failed) ? sBest : 0;
+}
+
+void MeshChannel_GetSurvey(uint8_t* pSurvey)
+{
+    uint8_t i;
+
+    pSurvey[0] = sState;
+    pSurvey[1] = MeshChannel_Best();
+    for(i = 0; i < MESH_CHANNEL_COUNT; i++)
+    {
+        pSurvey[2 + 3 * i]     = (uint8_t)MeshChannel_Level(i);
+        pSurvey[2 + 3 * i + 1] = (sSamples[i] != 0) ? (uint8_t)sFloor[i] : MESH_CHANNEL_NOT_MEASURED;
+        pSurvey[2 + 3 * i + 2] = MeshChannel_BusyPercent(i);
+    }
+}
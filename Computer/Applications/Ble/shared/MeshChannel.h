@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshChannel.h"
+ *
+ * Channel survey: energy scans of channels 11..26 to pick the quietest
+ * channel when a network is formed.
+ *
+ * A survey is MESH_CHANNEL_SWEEPS sweeps of otLinkEnergyScan() over all
+ * channels.  Every sweep gives the peak RSSI
+ * per channel; per channel the survey keeps:
+ *
+ *   - level : mean of the peaks, dBm
+ *   - floor : lowest peak, dBm (the noise floor when the channel is idle)
+ *   - busy  : sweeps whose peak reached MESH_CHANNEL_BUSY_DBM, in %
+ *             (occupancy: Wi-Fi, other networks)
+ *
+ * and scores it as level + busy * MESH_CHANNEL_BUSY_WEIGHT_DB / 100; the
+ * lowest score is the best channel.
+ *
+ * The survey is read over GATT as MESH_CHANNEL_SURVEY_LEN bytes:
+ *
+ *   byte 0  : state (MeshChannel_State_t)
+ *   byte 1  : best channel, 0 until a survey is done
+ *   then    : 16 x {level (int8), floor (int8), busy (uint8)}, channel 11 first;
+ *             level and floor are 127 for a channel not measured
+ *
+ * It runs:
+ *   - on request (MeshChannel_StartSurvey(), Survey characteristic), so
+ *     the provisioning tool can choose the channel;
+ *   - before forming a network from BLE values when the channel is
+ *     MESH_CHANNEL_AUTO (the application waits for the result);
+ *   - once after this node becomes leader.  If the network channel scores
+ *     MESH_CHANNEL_MOVE_MARGIN_DB worse than the best one, the leader moves
+ *     the whole network there with a Pending Dataset
+ *     (otDatasetSendMgmtPendingSet, delay MESH_CHANNEL_MOVE_DELAY_MS).
+ *
+ * The radio listens on the scanned channel during a scan and misses the
+ * frames sent to it meanwhile.  So the scan depends on the role when the
+ * survey starts:
+ *   - not attached (before forming): each sweep scans all channels at
+ *     once, MESH_CHANNEL_SCAN_MS each, about 0.8 s per sweep;
+ *   - attached: each sweep is cut into slices of MESH_CHANNEL_SLICE
+ *     channels, MESH_CHANNEL_SLICE_SCAN_MS each (32 ms off the network
+ *     channel at a time).  The radio goes back to the network channel for
+ *     MESH_CHANNEL_SLICE_PAUSE_MS between slices, so a survey takes about
+ *     17 s.  A slice is postponed while this node has a critical event
+ *     queued or in flight (MeshCoap_CriticalPending()).  A frame whose
+ *     MAC retries all fall into a slice is still lost: NON multicasts may
+ *     be missed, confirmable exchanges are retransmitted by CoAP.
+ *
+ * Threading: the energy scan callback (OpenThread context) and the delay
+ * timer only call the application's notify hook; the application calls
+ * MeshChannel_Process() from its own task.
+ */
+
+#ifndef _MESH_CHANNEL_H_
+#define _MESH_CHANNEL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 2.4 GHz O-QPSK channels */
+#define MESH_CHANNEL_FIRST          11
+#define MESH_CHANNEL_LAST           26
+#define MESH_CHANNEL_COUNT          (MESH_CHANNEL_LAST - MESH_CHANNEL_FIRST + 1)
+
+/** Channel characteristic value: survey first, then form on the best channel */
+#define MESH_CHANNEL_AUTO           0
+
+/** Used when the survey fails */
+#define MESH_CHANNEL_FALLBACK       15
+
+/** Sweeps per survey and scan time per channel and sweep */
+#define MESH_CHANNEL_SWEEPS         4
+#define MESH_CHANNEL_SCAN_MS        50
+
+/** Attached: channels per slice (divides MESH_CHANNEL_COUNT), scan time per
+ *  channel, and time back on the network channel between slices */
+#define MESH_CHANNEL_SLICE          2
+#define MESH_CHANNEL_SLICE_SCAN_MS  16
+#define MESH_CHANNEL_SLICE_PAUSE_MS 500
+
+/** A sweep peak at or above this counts the channel as busy (CCA level) */
+#define MESH_CHANNEL_BUSY_DBM       (-75)
+
+/** Score penalty of a channel busy in every sweep */
+#define MESH_CHANNEL_BUSY_WEIGHT_DB 20
+
+/** Leader: survey this long after becoming leader, and move if the
+ *  network channel scores this much worse than the best */
+#define MESH_CHANNEL_LEADER_DELAY_MS 10000
+#define MESH_CHANNEL_MOVE_MARGIN_DB  6
+
+/** Leader: the network switches this long after the Pending Dataset */
+#define MESH_CHANNEL_MOVE_DELAY_MS  30000
+
+/** Survey frame: state, best channel, 3 bytes per channel */
+#define MESH_CHANNEL_SURVEY_LEN     (2 + 3 * MESH_CHANNEL_COUNT)
+
+typedef enum
+{
+    MeshChannel_Idle    = 0,  /**< No survey yet */
+    MeshChannel_Running = 1,
+    MeshChannel_Done    = 2,
+    MeshChannel_Failed  = 3,  /**< Energy scan refused; best is MESH_CHANNEL_FALLBACK */
+} MeshChannel_State_t;
+
+/** Called from the OpenThread context or the timer task; post to the app task. */
+typedef void (*MeshChannel_Notify_t)(void);
+
+/** Called from MeshChannel_Process() when the survey state changes, with the survey frame. */
+typedef void (*MeshChannel_SurveyHandler_t)(const uint8_t* pSurvey, uint16_t len);
+
+/** @brief Create the leader timer. */
+void MeshChannel_Init(otInstance* pInstance, MeshChannel_Notify_t notify, MeshChannel_SurveyHandler_t onSurvey);
+
+/** @brief Start a survey; enables the IPv6 interface if needed.
+ *  @return OT_ERROR_BUSY if one is running, else the error of otLinkEnergyScan(). */
+otError MeshChannel_StartSurvey(void);
+
+/** @brief Run the next sweep or slice, or finish the survey.  Call from the app task on the notify hook. */
+void MeshChannel_Process(void);
+
+/** @brief Schedule the leader survey.  Call on every role change. */
+void MeshChannel_RoleChanged(otDeviceRole role);
+
+/** @brief Best channel of the last survey, 0 if none has finished. */
+uint8_t MeshChannel_Best(void);
+
+/** @brief Current survey frame (MESH_CHANNEL_SURVEY_LEN bytes). */
+void MeshChannel_GetSurvey(uint8_t* pSurvey);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_CHANNEL_H_ */
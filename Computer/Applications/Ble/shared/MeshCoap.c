@@ -0,0 +1,985 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshCoap.c"
+ *
+ * Application events over CoAP.
+ *
+ * The pool and statistics are touched from the application task (publish,
+ * process) and the OpenThread context (responses, gateway announcements).
+ * Every access is short, so a critical section is used rather than a mutex,
+ * as in MeshTimeSync.c.  The rate limiters are only used by the application
+ * task.
+ */
+
+#include "MeshCoap.h"
+
+#include <string.h>
+
+#include "MeshAuth.h"
+#include "MeshDedup.h"
+#include "MeshTlv.h"
+
+#include "gpLog.h"
+#include "gpSched.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/thread.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* Copies of an event still to send; 0 = free slot */
+#define MESH_COAP_PENDING_MCAST    0x01
+#define MESH_COAP_PENDING_GATEWAY  0x02
+
+#define MESH_COAP_NO_SLOT          (-1)
+
+typedef struct
+{
+    uint8_t  payload[MESH_COAP_MAX_PAYLOAD];
+    uint8_t  len;
+    uint8_t  pending;       /**< MESH_COAP_PENDING_* */
+    uint8_t  eventClass;    /**< MeshCoap_Class_t */
+    uint8_t  peers;         /**< Multicast even when the gateway is known */
+    uint32_t order;         /**< Publish order, oldest first */
+    uint32_t queuedMs;
+} MeshCoap_Entry_t;
+
+typedef struct
+{
+    uint32_t periodMs;
+    uint8_t  burst;
+    uint8_t  tokens;
+    uint32_t lastMs;        /**< Time of the last refill */
+} MeshCoap_Bucket_t;
+
+static otInstance*             sInstance = NULL;
+static bool                    sStarted  = false;
+static MeshCoap_EventHandler_t sOnEvent  = NULL;
+static MeshCoap_Notify_t       sNotify   = NULL;
+
+static otCoapResource          sEventResource;
+static otCoapResource          sGatewayResource;
+
+static const otCoapTxParameters sTxParameters = {
+    MESH_COAP_ACK_TIMEOUT_MS, /* mAckTimeout */
+    3,                        /* mAckRandomFactorNumerator */
+    2,                        /* mAckRandomFactorDenominator */
+    MESH_COAP_MAX_RETRANSMIT, /* mMaxRetransmit */
+};
+
+/* Per class: critical events jump the radio queue */
+static const otMessageSettings sMsgSettings[] = {
+    {true, OT_MESSAGE_PRIORITY_NORMAL}, /* MeshCoap_Telemetry */
+    {true, OT_MESSAGE_PRIORITY_HIGH},   /* MeshCoap_Critical */
+};
+
+static const uint8_t sMinFreeBuffers[] = {
+    MESH_COAP_MIN_FREE_TELEMETRY,
+    MESH_COAP_MIN_FREE_CRITICAL,
+};
+
+static MeshCoap_Bucket_t       sBuckets[] = {
+    {MESH_COAP_RATE_TELEMETRY_MS, MESH_COAP_BURST_TELEMETRY, MESH_COAP_BURST_TELEMETRY, 0},
+    {MESH_COAP_RATE_CRITICAL_MS, MESH_COAP_BURST_CRITICAL, MESH_COAP_BURST_CRITICAL, 0},
+};
+
+/* Destinations, parsed once */
+static otMessageInfo           sMcastInfo;
+static otMessageInfo           sPeerInfo;
+static otMessageInfo           sGatewayInfo;
+static bool                    sGatewayKnown    = false;
+static uint8_t                 sGatewaySource   = MeshGateway_None;
+static bool                    sGatewayExpires  = false;
+static uint32_t                sGatewayExpiryMs = 0;
+static uint8_t                 sGatewayFailures = 0;
+static uint32_t                sLookupAtMs      = 0;
+
+/* Transmit pool */
+static MeshCoap_Entry_t        sPool[MESH_COAP_QUEUE_LEN];
+static uint32_t                sNextOrder  = 0;
+static int8_t                  sInFlight   = MESH_COAP_NO_SLOT;
+static uint32_t                sSentUs     = 0;
+static bool                    sBackoff    = false;
+static uint32_t                sRetryAtMs  = 0;
+static otError                 sHeldReason = OT_ERROR_NONE;
+
+/* Received frames, only touched in the OpenThread context */
+static MeshDedup_t             sDedup;
+
+static MeshCoap_Stats_t        sStats;
+static uint32_t                sLoggedFinished = 0;
+
+static StaticTimer_t           sTimerBuffer;
+static TimerHandle_t           sTimer = NULL;
+
+static void MeshCoap_ResponseHandler(void* aContext, otMessage* aMessage, const otMessageInfo* aMessageInfo,
+                                     otError aResult);
+
+static uint32_t MeshCoap_NowMs(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+static void MeshCoap_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshCoap_Arm(uint32_t delayMs)
+{
+    if(sTimer != NULL)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(delayMs != 0 ? delayMs : 1), 0);
+    }
+}
+
+/* Time left until @p deadlineMs, at least 1 ms so an overdue deadline fires at once */
+static uint32_t MeshCoap_Remaining(uint32_t deadlineMs, uint32_t nowMs)
+{
+    int32_t left = (int32_t)(deadlineMs - nowMs);
+
+    return (left > 0) ? (uint32_t)left : 1;
+}
+
+/* Keep the shortest of several requested delays; 0 = none requested */
+static void MeshCoap_Sooner(uint32_t* pDelayMs, uint32_t delayMs)
+{
+    if(delayMs != 0 && (*pDelayMs == 0 || delayMs < *pDelayMs))
+    {
+        *pDelayMs = delayMs;
+    }
+}
+
+static bool MeshCoap_IsAttached(void)
+{
+    otDeviceRole role = otThreadGetDeviceRole(sInstance);
+
+    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+}
+
+static bool MeshCoap_HasBuffers(uint8_t eventClass)
+{
+    otBufferInfo info;
+
+    otMessageGetBufferInfo(sInstance, &info);
+    return info.mFreeBuffers >= sMinFreeBuffers[eventClass];
+}
+
+/* Events without peers go to the gateway only while it answers */
+static bool MeshCoap_UseGateway(void)
+{
+    return sGatewayKnown && sGatewayFailures < MESH_COAP_GATEWAY_MAX_FAILURES;
+}
+
+/* Take a token; returns 0, or the wait in ms until one is available */
+static uint32_t MeshCoap_TakeToken(MeshCoap_Bucket_t* pBucket, uint32_t nowMs)
+{
+    uint32_t elapsed = nowMs - pBucket->lastMs;
+
+    if(pBucket->tokens >= pBucket->burst)
+    {
+        pBucket->lastMs = nowMs;
+    }
+    else if(elapsed >= pBucket->periodMs)
+    {
+        uint32_t refill = elapsed / pBucket->periodMs;
+
+        pBucket->tokens  = (uint8_t)((pBucket->tokens + refill >= pBucket->burst) ? pBucket->burst
+                                                                                  : pBucket->tokens + refill);
+        pBucket->lastMs += refill * pBucket->periodMs;
+    }
+
+    if(pBucket->tokens == 0)
+    {
+        return pBucket->periodMs - (nowMs - pBucket->lastMs);
+    }
+    pBucket->tokens--;
+    return 0;
+}
+
+/* -------------------------------------------------------------------------
+ * Pool, called inside a critical section
+ * ------------------------------------------------------------------------- */
+
+/* Oldest slot with @p flag pending; eventClass < 0 matches any class */
+static int8_t MeshCoap_Oldest(uint8_t flag, int8_t eventClass, bool skipInFlight)
+{
+    int8_t  found = MESH_COAP_NO_SLOT;
+    uint8_t i;
+
+    for(i = 0; i < MESH_COAP_QUEUE_LEN; i++)
+    {
+        if((sPool[i].pending & flag) == 0 || (eventClass >= 0 && sPool[i].eventClass != (uint8_t)eventClass) ||
+           (skipInFlight && (int8_t)i == sInFlight))
+        {
+            continue;
+        }
+        if(found == MESH_COAP_NO_SLOT || (int32_t)(sPool[i].order - sPool[found].order) < 0)
+        {
+            found = (int8_t)i;
+        }
+    }
+    return found;
+}
+
+/* Give up on copies that are too old */
+static void MeshCoap_Expire(uint32_t nowMs)
+{
+    uint8_t i;
+
+    for(i = 0; i < MESH_COAP_QUEUE_LEN; i++)
+    {
+        uint32_t ageMs = nowMs - sPool[i].queuedMs;
+
+        if((sPool[i].pending & MESH_COAP_PENDING_MCAST) && ageMs >= MESH_COAP_HOLD_MS)
+        {
+            sPool[i].pending &= (uint8_t)~MESH_COAP_PENDING_MCAST;
+            sStats.expired++;
+        }
+        if((sPool[i].pending & MESH_COAP_PENDING_GATEWAY) && (int8_t)i != sInFlight &&
+           ageMs >= MESH_COAP_MAX_AGE_MS)
+        {
+            sPool[i].pending &= (uint8_t)~MESH_COAP_PENDING_GATEWAY;
+            sStats.failed++;
+        }
+    }
+}
+
+/* Free slot, or the oldest telemetry / critical event pushed out */
+static uint8_t MeshCoap_Alloc(void)
+{
+    int8_t  slot;
+    uint8_t i;
+
+    for(i = 0; i < MESH_COAP_QUEUE_LEN; i++)
+    {
+        if(sPool[i].pending == 0)
+        {
+            return i;
+        }
+    }
+
+    slot = MeshCoap_Oldest(MESH_COAP_PENDING_MCAST | MESH_COAP_PENDING_GATEWAY, MeshCoap_Telemetry, true);
+    if(slot == MESH_COAP_NO_SLOT)
+    {
+        slot = MeshCoap_Oldest(MESH_COAP_PENDING_MCAST | MESH_COAP_PENDING_GATEWAY, -1, true);
+    }
+    sStats.dropped++;
+    return (uint8_t)slot;
+}
+
+static uint8_t MeshCoap_Depth(void)
+{
+    uint8_t depth = 0;
+    uint8_t i;
+
+    for(i = 0; i < MESH_COAP_QUEUE_LEN; i++)
+    {
+        depth += (sPool[i].pending != 0) ? 1 : 0;
+    }
+    return depth;
+}
+
+/* -------------------------------------------------------------------------
+ * Sending
+ * ------------------------------------------------------------------------- */
+
+static otError MeshCoap_Post(otCoapType type, const otMessageInfo* pInfo, const char* pUri, const uint8_t* pPayload,
+                             uint16_t len, uint8_t eventClass, otCoapResponseHandler handler)
+{
+    otMessage* pMsg;
+    otError    err;
+
+    pMsg = otCoapNewMessage(sInstance, &sMsgSettings[eventClass]);
+    if(pMsg == NULL)
+    {
+        return OT_ERROR_NO_BUFS;
+    }
+
+    otCoapMessageInit(pMsg, type, OT_COAP_CODE_POST);
+    otCoapMessageGenerateToken(pMsg, OT_COAP_DEFAULT_TOKEN_LENGTH);
+    err = otCoapMessageAppendUriPathOptions(pMsg, pUri);
+    if(err == OT_ERROR_NONE)
+    {
+        err = otCoapMessageSetPayloadMarker(pMsg);
+    }
+    if(err == OT_ERROR_NONE)
+    {
+        err = otMessageAppend(pMsg, pPayload, len);
+    }
+
+    if(err == OT_ERROR_NONE)
+    {
+        if(type == OT_COAP_TYPE_CONFIRMABLE)
+        {
+            err = otCoapSendRequestWithParameters(sInstance, pMsg, pInfo, handler, NULL, &sTxParameters);
+        }
+        else
+        {
+            err = otCoapSendRequest(sInstance, pMsg, pInfo, NULL, NULL);
+        }
+    }
+
+    if(err != OT_ERROR_NONE)
+    {
+        otMessageFree(pMsg);
+    }
+    return err;
+}
+
+static otError MeshCoap_Send(otCoapType type, const otMessageInfo* pInfo, const MeshCoap_Entry_t* pEntry,
+                             otCoapResponseHandler handler)
+{
+    return MeshCoap_Post(type, pInfo, MESH_COAP_URI_EVENT, pEntry->payload, pEntry->len, pEntry->eventClass,
+                         handler);
+}
+
+/* NON copies, critical class first, oldest first: multicast, or to the
+ * gateway only for events without peers.  Returns the delay after which
+ * to try again, 0 if nothing is left or the node is detached. */
+static uint32_t MeshCoap_FlushMulticast(uint32_t nowMs)
+{
+    static const uint8_t order[] = {MeshCoap_Critical, MeshCoap_Telemetry};
+    MeshCoap_Entry_t     entry;
+    uint32_t             delayMs = 0;
+    uint8_t              i;
+
+    if(!MeshCoap_IsAttached())
+    {
+        sHeldReason = OT_ERROR_INVALID_STATE;
+        return 0;
+    }
+
+    for(i = 0; i < sizeof(order); i++)
+    {
+        for(;;)
+        {
+            int8_t        slot;
+            uint32_t      waitMs;
+            otError       err;
+            bool          toGateway = false;
+            otMessageInfo gateway;
+
+            taskENTER_CRITICAL();
+            slot = MeshCoap_Oldest(MESH_COAP_PENDING_MCAST, (int8_t)order[i], false);
+            if(slot != MESH_COAP_NO_SLOT)
+            {
+                entry     = sPool[slot];
+                gateway   = sGatewayInfo;
+                toGateway = !entry.peers && MeshCoap_UseGateway();
+                if(toGateway && order[i] == MeshCoap_Critical)
+                {
+                    /* The confirmable copy is all the gateway needs */
+                    sPool[slot].pending &= (uint8_t)~MESH_COAP_PENDING_MCAST;
+                    sStats.unicast++;
+                    slot = MESH_COAP_NO_SLOT;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if(slot == MESH_COAP_NO_SLOT)
+            {
+                if(toGateway)
+                {
+                    continue;
+                }
+                break;
+            }
+
+            if(!MeshCoap_HasBuffers(order[i]))
+            {
+                sHeldReason = OT_ERROR_NO_BUFS;
+                sStats.backpressure++;
+                MeshCoap_Sooner(&delayMs, MESH_COAP_BUFFER_WAIT_MS);
+                break;
+            }
+
+            waitMs = MeshCoap_TakeToken(&sBuckets[order[i]], nowMs);
+            if(waitMs != 0)
+            {
+                sHeldReason = OT_ERROR_BUSY;
+                sStats.rateLimited++;
+                MeshCoap_Sooner(&delayMs, waitMs);
+                break;
+            }
+
+            err = MeshCoap_Send(OT_COAP_TYPE_NON_CONFIRMABLE,
+                                toGateway ? &gateway : (entry.peers ? &sPeerInfo : &sMcastInfo), &entry, NULL);
+            if(err != OT_ERROR_NONE)
+            {
+                sHeldReason = err;
+                sStats.backpressure += (err == OT_ERROR_NO_BUFS) ? 1 : 0;
+                MeshCoap_Sooner(&delayMs, MESH_COAP_BUFFER_WAIT_MS);
+                break;
+            }
+
+            taskENTER_CRITICAL();
+            /* The slot cannot have been reused: only this task allocates */
+            sPool[slot].pending &= (uint8_t)~MESH_COAP_PENDING_MCAST;
+            if(toGateway)
+            {
+                sStats.unicast++;
+            }
+            else
+            {
+                sStats.published++;
+            }
+            taskEXIT_CRITICAL();
+        }
+    }
+    return delayMs;
+}
+
+/* Confirmable copy of the oldest critical event.  Same return as above. */
+static uint32_t MeshCoap_DeliverToGateway(uint32_t nowMs)
+{
+    MeshCoap_Entry_t entry;
+    otMessageInfo    gateway;
+    int8_t           slot   = MESH_COAP_NO_SLOT;
+    bool             ready  = false;
+    int32_t          waitMs = 0;
+    otError          err;
+
+    taskENTER_CRITICAL();
+    if(sInFlight == MESH_COAP_NO_SLOT)
+    {
+        slot = MeshCoap_Oldest(MESH_COAP_PENDING_GATEWAY, -1, false);
+    }
+    if(slot != MESH_COAP_NO_SLOT)
+    {
+        entry   = sPool[slot];
+        gateway = sGatewayInfo;
+        waitMs  = sBackoff ? (int32_t)(sRetryAtMs - nowMs) : 0;
+        ready   = sGatewayKnown && waitMs <= 0;
+    }
+    taskEXIT_CRITICAL();
+
+    if(slot == MESH_COAP_NO_SLOT)
+    {
+        return 0;
+    }
+
+    if(!ready || !MeshCoap_IsAttached())
+    {
+        /* Check again later: the gateway or the link may come back */
+        return waitMs > 0 ? (uint32_t)waitMs : MESH_COAP_RETRY_MS;
+    }
+    if(!MeshCoap_HasBuffers(MeshCoap_Critical))
+    {
+        sStats.backpressure++;
+        return MESH_COAP_BUFFER_WAIT_MS;
+    }
+
+    taskENTER_CRITICAL();
+    sInFlight = slot;
+    sBackoff  = false;
+    sSentUs   = gpSched_GetCurrentTime();
+    taskEXIT_CRITICAL();
+
+    err = MeshCoap_Send(OT_COAP_TYPE_CONFIRMABLE, &gateway, &entry, MeshCoap_ResponseHandler);
+    if(err != OT_ERROR_NONE)
+    {
+        taskENTER_CRITICAL();
+        sInFlight  = MESH_COAP_NO_SLOT;
+        sBackoff   = true;
+        sRetryAtMs = nowMs + MESH_COAP_RETRY_MS;
+        taskEXIT_CRITICAL();
+        return MESH_COAP_RETRY_MS;
+    }
+    return 0;
+}
+
+static void MeshCoap_Log(void)
+{
+    MeshCoap_Stats_t stats;
+    MeshAuth_Stats_t auth;
+    uint32_t         finished;
+
+    MeshCoap_GetStats(&stats);
+    finished = stats.delivered + stats.failed;
+
+    if(MESH_COAP_LOG_EVERY != 0 && finished != sLoggedFinished && (finished % MESH_COAP_LOG_EVERY) == 0)
+    {
+        GP_LOG_SYSTEM_PRINTF("[CoAP] ok:%lu fail:%lu drop:%lu to:%lu q:%u rtt:%ld/%ld/%ld us", 0,
+                             (unsigned long)stats.delivered, (unsigned long)stats.failed,
+                             (unsigned long)stats.dropped, (unsigned long)stats.timeouts, stats.depth,
+                             (long)stats.rtt.minUs, (long)stats.rtt.avgUs, (long)stats.rtt.maxUs);
+        GP_LOG_SYSTEM_PRINTF("[CoAP] mcast:%lu uc:%lu held:%lu exp:%lu rl:%lu bp:%lu dup:%lu ev:%lu gw:%s", 0,
+                             (unsigned long)stats.published, (unsigned long)stats.unicast, (unsigned long)stats.held,
+                             (unsigned long)stats.expired, (unsigned long)stats.rateLimited,
+                             (unsigned long)stats.backpressure, (unsigned long)stats.duplicates,
+                             (unsigned long)stats.evictions,
+                             MeshGateway_SourceName((MeshGateway_Source_t)stats.gatewaySource));
+
+        MeshAuth_GetStats(&auth);
+        if(auth.signedFrames != 0 || auth.valid != 0 || auth.rejected != 0)
+        {
+            GP_LOG_SYSTEM_PRINTF("[Auth] signed:%lu ok:%lu replay:%lu rej:%lu sign:%u us check:%u us", 0,
+                                 (unsigned long)auth.signedFrames, (unsigned long)auth.valid,
+                                 (unsigned long)auth.replays, (unsigned long)auth.rejected, auth.signUsMax,
+                                 auth.checkUsMax);
+        }
+    }
+    sLoggedFinished = finished;
+}
+
+/* -------------------------------------------------------------------------
+ * OpenThread callbacks
+ * ------------------------------------------------------------------------- */
+
+static void MeshCoap_ResponseHandler(void* aContext, otMessage* aMessage, const otMessageInfo* aMessageInfo,
+                                     otError aResult)
+{
+    uint32_t rttUs = gpSched_GetCurrentTime() - sSentUs;
+    uint8_t  codeClass = 0;
+
+    (void)aContext;
+    (void)aMessageInfo;
+
+    if(aResult == OT_ERROR_NONE && aMessage != NULL)
+    {
+        codeClass = (uint8_t)(otCoapMessageGetCode(aMessage) >> 5);
+    }
+
+    taskENTER_CRITICAL();
+    if(codeClass == 2 || codeClass == 4)
+    {
+        /* The gateway answers */
+        sGatewayFailures = 0;
+    }
+    else if(sGatewayFailures < MESH_COAP_GATEWAY_MAX_FAILURES)
+    {
+        sGatewayFailures++;
+    }
+    if(codeClass == 2)
+    {
+        /* 2.xx: delivered */
+        sStats.delivered++;
+        MeshTime_LatencyRecord(&sStats.rtt, (int32_t)rttUs);
+    }
+    else if(codeClass == 4)
+    {
+        /* 4.xx: the gateway will never take it */
+        sStats.failed++;
+    }
+    else
+    {
+        /* Timeout, 5.xx or a local error: try again later */
+        sStats.timeouts++;
+        sBackoff   = true;
+        sRetryAtMs = MeshCoap_NowMs() + MESH_COAP_RETRY_MS;
+    }
+    if((codeClass == 2 || codeClass == 4) && sInFlight != MESH_COAP_NO_SLOT)
+    {
+        sPool[sInFlight].pending &= (uint8_t)~MESH_COAP_PENDING_GATEWAY;
+    }
+    sInFlight = MESH_COAP_NO_SLOT;
+    taskEXIT_CRITICAL();
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshCoap_HandleEvent(void* aContext, otMessage* aMessage, const otMessageInfo* aMessageInfo)
+{
+    uint8_t           payload[MESH_COAP_MAX_PAYLOAD];
+    uint16_t          len = otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+    MeshTlv_Reader_t  reader;
+    MeshTlv_Header_t  header;
+    MeshAuth_Result_t auth;
+
+    (void)aContext;
+
+    if(otCoapMessageGetCode(aMessage) != OT_COAP_CODE_POST || len == 0 || len > sizeof(payload))
+    {
+        return;
+    }
+    otMessageRead(aMessage, otMessageGetOffset(aMessage), payload, len);
+
+    /* Forged or unsigned frames from a node that should sign are dropped
+     * before they can claim a sequence number in the duplicate window */
+    auth = MeshAuth_Check(payload, len);
+    if(auth == MeshAuth_Rejected)
+    {
+        return;
+    }
+
+    /* Repeats are acknowledged again but never reach the application */
+    if(auth == MeshAuth_Replay ||
+       (MeshTlv_ReaderInit(&reader, payload, len, &header) == MeshTlv_Ok &&
+        !MeshDedup_IsNew(&sDedup, header.deviceId, header.seq, MeshCoap_NowMs())))
+    {
+        taskENTER_CRITICAL();
+        sStats.duplicates = sDedup.duplicates;
+        taskEXIT_CRITICAL();
+        MeshCoap_Acknowledge(aMessage, aMessageInfo);
+        return;
+    }
+    taskENTER_CRITICAL();
+    sStats.evictions = sDedup.evictions;
+    taskEXIT_CRITICAL();
+
+    /* Handler first: receivers timestamp on entry */
+    if(sOnEvent != NULL)
+    {
+        sOnEvent(payload, len, aMessageInfo);
+    }
+    MeshCoap_Acknowledge(aMessage, aMessageInfo);
+}
+
+/* Take a gateway found by MeshGateway or an announcement, if its source
+ * ranks at least as high as the current one; pAddr NULL = @p source lost it.
+ * Called in the OpenThread context or the application task. */
+static void MeshCoap_SetGateway(const otIp6Address* pAddr, uint16_t port, MeshGateway_Source_t source,
+                                uint32_t ttlMs)
+{
+    char addr[OT_IP6_ADDRESS_STRING_SIZE];
+    bool changed = false;
+    bool lost    = false;
+    bool pending;
+
+    taskENTER_CRITICAL();
+    if(pAddr == NULL)
+    {
+        if(sGatewayKnown && sGatewaySource == (uint8_t)source)
+        {
+            sGatewayKnown  = false;
+            sGatewaySource = MeshGateway_None;
+            lost           = true;
+        }
+    }
+    else if(!sGatewayKnown || (uint8_t)source >= sGatewaySource)
+    {
+        changed = !sGatewayKnown || sGatewaySource != (uint8_t)source ||
+                  !otIp6IsAddressEqual(&sGatewayInfo.mPeerAddr, pAddr) || sGatewayInfo.mPeerPort != port;
+        if(changed)
+        {
+            memset(&sGatewayInfo, 0, sizeof(sGatewayInfo));
+            sGatewayInfo.mPeerAddr = *pAddr;
+            sGatewayInfo.mPeerPort = port;
+            sGatewaySource         = (uint8_t)source;
+            sGatewayFailures       = 0;
+        }
+        sGatewayExpires  = (ttlMs != 0);
+        sGatewayExpiryMs = MeshCoap_NowMs() + ttlMs;
+        sGatewayKnown    = true;
+    }
+    sStats.gateway       = sGatewayKnown;
+    sStats.gatewaySource = sGatewaySource;
+    pending              = MeshCoap_Oldest(MESH_COAP_PENDING_GATEWAY, -1, false) != MESH_COAP_NO_SLOT;
+    taskEXIT_CRITICAL();
+
+    if(changed)
+    {
+        otIp6AddressToString(pAddr, addr, sizeof(addr));
+        GP_LOG_SYSTEM_PRINTF("[CoAP] Gateway [%s]:%u (%s)", 0, addr, port, MeshGateway_SourceName(source));
+    }
+    else if(lost)
+    {
+        GP_LOG_SYSTEM_PRINTF("[CoAP] Gateway lost (%s)", 0, MeshGateway_SourceName(source));
+    }
+
+    if((changed || pending) && sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshCoap_HandleGateway(void* aContext, otMessage* aMessage, const otMessageInfo* aMessageInfo)
+{
+    (void)aContext;
+
+    if(otCoapMessageGetCode(aMessage) != OT_COAP_CODE_POST)
+    {
+        return;
+    }
+
+    MeshCoap_Acknowledge(aMessage, aMessageInfo);
+    MeshCoap_SetGateway(&aMessageInfo->mPeerAddr, aMessageInfo->mPeerPort, MeshGateway_Announce,
+                        MESH_COAP_GATEWAY_TIMEOUT_MS);
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshCoap_Init(otInstance* pInstance, MeshCoap_EventHandler_t onEvent, MeshCoap_Notify_t notify)
+{
+    otError err;
+    uint8_t i;
+
+    sInstance = pInstance;
+    sOnEvent  = onEvent;
+    sNotify   = notify;
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshCoap", pdMS_TO_TICKS(MESH_COAP_RETRY_MS), pdFALSE, NULL,
+                                    MeshCoap_TimerCallback, &sTimerBuffer);
+    }
+
+    if(sStarted)
+    {
+        return;
+    }
+
+    MeshDedup_Init(&sDedup);
+
+    memset(&sMcastInfo, 0, sizeof(sMcastInfo));
+    otIp6AddressFromString(MESH_COAP_MCAST, &sMcastInfo.mPeerAddr);
+    sMcastInfo.mPeerPort = MESH_COAP_PORT;
+    sPeerInfo            = sMcastInfo;
+
+    for(i = 0; i < sizeof(sBuckets) / sizeof(sBuckets[0]); i++)
+    {
+        sBuckets[i].lastMs = MeshCoap_NowMs();
+    }
+
+    err = otCoapStart(sInstance, MESH_COAP_PORT);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[CoAP] Start failed: %d", 0, (int)err);
+        return;
+    }
+
+    memset(&sEventResource, 0, sizeof(sEventResource));
+    sEventResource.mUriPath = MESH_COAP_URI_EVENT;
+    sEventResource.mHandler = MeshCoap_HandleEvent;
+    otCoapAddResource(sInstance, &sEventResource);
+
+    memset(&sGatewayResource, 0, sizeof(sGatewayResource));
+    sGatewayResource.mUriPath = MESH_COAP_URI_GATEWAY;
+    sGatewayResource.mHandler = MeshCoap_HandleGateway;
+    otCoapAddResource(sInstance, &sGatewayResource);
+
+    MeshGateway_Init(sInstance, MeshCoap_SetGateway);
+
+    sStarted = true;
+    GP_LOG_SYSTEM_PRINTF("[CoAP] Server on port %d", 0, MESH_COAP_PORT);
+}
+
+void MeshCoap_AddResource(otCoapResource* pResource)
+{
+    if(sStarted)
+    {
+        otCoapAddResource(sInstance, pResource);
+    }
+}
+
+otError MeshCoap_Publish(const uint8_t* pPayload, uint16_t len, MeshCoap_Class_t eventClass, bool peers)
+{
+    MeshCoap_Entry_t* pEntry;
+    uint8_t           slot;
+    bool              held;
+
+    if(!sStarted)
+    {
+        return OT_ERROR_INVALID_STATE;
+    }
+    if(len == 0 || len > MESH_COAP_MAX_PAYLOAD)
+    {
+        return OT_ERROR_INVALID_ARGS;
+    }
+
+    taskENTER_CRITICAL();
+    MeshCoap_Expire(MeshCoap_NowMs());
+    slot   = MeshCoap_Alloc();
+    pEntry = &sPool[slot];
+    memcpy(pEntry->payload, pPayload, len);
+    pEntry->len        = (uint8_t)len;
+    pEntry->eventClass = (uint8_t)eventClass;
+    pEntry->peers      = peers ? 1 : 0;
+    pEntry->order      = sNextOrder++;
+    pEntry->queuedMs   = MeshCoap_NowMs();
+    pEntry->pending    = MESH_COAP_PENDING_MCAST;
+    if(eventClass == MeshCoap_Critical)
+    {
+        pEntry->pending |= MESH_COAP_PENDING_GATEWAY;
+        sStats.queued++;
+    }
+    taskEXIT_CRITICAL();
+
+    MeshCoap_Process();
+
+    taskENTER_CRITICAL();
+    held = (sPool[slot].pending & MESH_COAP_PENDING_MCAST) != 0;
+    if(held)
+    {
+        sStats.held++;
+        if(sHeldReason == OT_ERROR_INVALID_STATE)
+        {
+            sStats.deferred++;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return held ? sHeldReason : OT_ERROR_NONE;
+}
+
+void MeshCoap_SetPeerGroup(const otIp6Address* pGroup)
+{
+    if(pGroup != NULL)
+    {
+        sPeerInfo.mPeerAddr = *pGroup;
+    }
+    else
+    {
+        otIp6AddressFromString(MESH_COAP_MCAST, &sPeerInfo.mPeerAddr);
+    }
+}
+
+otError MeshCoap_PostToGateway(const char* pUri, const uint8_t* pPayload, uint16_t len)
+{
+    otMessageInfo gateway;
+    bool          known;
+
+    if(!sStarted)
+    {
+        return OT_ERROR_INVALID_STATE;
+    }
+
+    taskENTER_CRITICAL();
+    gateway = sGatewayInfo;
+    known   = sGatewayKnown;
+    taskEXIT_CRITICAL();
+
+    if(!known || !MeshCoap_IsAttached())
+    {
+        return OT_ERROR_INVALID_STATE;
+    }
+    if(!MeshCoap_HasBuffers(MeshCoap_Telemetry))
+    {
+        sStats.backpressure++;
+        return OT_ERROR_NO_BUFS;
+    }
+    return MeshCoap_Post(OT_COAP_TYPE_NON_CONFIRMABLE, &gateway, pUri, pPayload, len, MeshCoap_Telemetry, NULL);
+}
+
+void MeshCoap_Process(void)
+{
+    uint32_t nowMs   = MeshCoap_NowMs();
+    uint32_t delayMs = 0;
+
+    if(!sStarted)
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    if(sGatewayKnown && sGatewayExpires && (int32_t)(nowMs - sGatewayExpiryMs) >= 0)
+    {
+        /* Announcements stopped or the DNS-SD answer ran out: look again now */
+        sGatewayKnown        = false;
+        sGatewaySource       = MeshGateway_None;
+        sStats.gateway       = false;
+        sStats.gatewaySource = MeshGateway_None;
+        sLookupAtMs          = nowMs;
+    }
+    MeshCoap_Expire(nowMs);
+    taskEXIT_CRITICAL();
+
+    if(sGatewaySource < MeshGateway_DnsSd && MeshCoap_IsAttached())
+    {
+        if((int32_t)(nowMs - sLookupAtMs) >= 0)
+        {
+            sLookupAtMs = nowMs + MESH_COAP_LOOKUP_MS;
+            MeshGateway_Lookup();
+        }
+        MeshCoap_Sooner(&delayMs, MeshCoap_Remaining(sLookupAtMs, nowMs));
+    }
+
+    MeshCoap_Sooner(&delayMs, MeshCoap_FlushMulticast(nowMs));
+    MeshCoap_Sooner(&delayMs, MeshCoap_DeliverToGateway(nowMs));
+
+    MeshCoap_Log();
+
+    if(delayMs != 0)
+    {
+        MeshCoap_Arm(delayMs);
+    }
+}
+
+void MeshCoap_StateChanged(uint32_t flags)
+{
+    if(sStarted && (flags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_NETDATA)) && MeshCoap_IsAttached())
+    {
+        MeshGateway_Lookup();
+    }
+}
+
+void MeshCoap_Acknowledge(otMessage* pRequest, const otMessageInfo* pMessageInfo)
+{
+    otMessage* pRsp;
+
+    if(otCoapMessageGetType(pRequest) != OT_COAP_TYPE_CONFIRMABLE)
+    {
+        return;
+    }
+
+    pRsp = otCoapNewMessage(sInstance, NULL);
+    if(pRsp == NULL)
+    {
+        return;
+    }
+
+    if(otCoapMessageInitResponse(pRsp, pRequest, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED) !=
+           OT_ERROR_NONE ||
+       otCoapSendResponse(sInstance, pRsp, pMessageInfo) != OT_ERROR_NONE)
+    {
+        otMessageFree(pRsp);
+    }
+}
+
+bool MeshCoap_CriticalPending(void)
+{
+    bool pending;
+
+    taskENTER_CRITICAL();
+    pending = MeshCoap_Oldest(MESH_COAP_PENDING_MCAST | MESH_COAP_PENDING_GATEWAY, MeshCoap_Critical, false) !=
+              MESH_COAP_NO_SLOT;
+    taskEXIT_CRITICAL();
+    return pending;
+}
+
+void MeshCoap_GetStats(MeshCoap_Stats_t* pStats)
+{
+    taskENTER_CRITICAL();
+    *pStats       = sStats;
+    pStats->depth = MeshCoap_Depth();
+    taskEXIT_CRITICAL();
+}
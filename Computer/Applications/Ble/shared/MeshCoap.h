@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshCoap.h"
+ *
+ * Application events over CoAP (OpenThread otCoap, port 5683).
+ *
+ *   - Events for peers (rings: speakers and other doorbells act on them)
+ *     are POSTed NON-confirmable to /e on the peer group, so peers get
+ *     them with no added delay: the zone / class group set with
+ *     MeshCoap_SetPeerGroup() (MeshGroup.h), else ff03::1.
+ *   - Other events go to the gateway only, so they are not flooded
+ *     through every router: telemetry as a NON unicast POST.  While no
+ *     gateway is known, or after MESH_COAP_GATEWAY_MAX_FAILURES exchanges
+ *     in a row timed out, they are multicast on ff03::1.
+ *   - Critical events (rings, sound events, motion detected) are POSTed
+ *     confirmable to /e on the gateway.  One exchange is in flight
+ *     at a time; OpenThread retransmits it with a doubling ACK timeout.
+ *     An exchange that times out is retried after MESH_COAP_RETRY_MS until
+ *     the event is MESH_COAP_MAX_AGE_MS old.
+ *   - The gateway is found through the Network Data or DNS-SD
+ *     (MeshGateway.h), looked up again on Network Data changes and every
+ *     MESH_COAP_LOOKUP_MS while not found.  Its NON POSTs to /gw on
+ *     ff03::1 are the fallback; such a gateway is forgotten when they stop.
+ *   - Other reports (MeshDiag.h) are POSTed NON-confirmable to the gateway
+ *     only, outside the pool: a report that cannot go now is skipped.
+ *
+ * Transmit path: a published frame is copied into a fixed pool of
+ * MESH_COAP_QUEUE_LEN slots and sent from there; an OpenThread message is
+ * only allocated for the actual send.  The multicast destination and the
+ * gateway are kept as ready-made otMessageInfo.  A slot stays in use
+ * until both its copies are done:
+ *   - While detached the multicast copy is held, and sent on attach if it
+ *     is less than MESH_COAP_HOLD_MS old.
+ *   - Multicasts are rate limited per class (token bucket); critical
+ *     events go first, oldest first.
+ *   - A send is postponed while OpenThread has fewer free message buffers
+ *     than the class minimum, so telemetry backs off before the stack
+ *     runs dry and critical events keep a reserve.
+ *   - When the pool is full the oldest telemetry event is dropped, else
+ *     the oldest critical one that is not in flight.
+ *
+ * Threading: the retry timer only calls the application's notify hook; the
+ * application calls MeshCoap_Process() from its own task, like
+ * MeshTimeSync_Process(), and also on attach to flush held events.
+ * Received events are passed to the application handler in the
+ * OpenThread context.
+ */
+
+#ifndef _MESH_COAP_H_
+#define _MESH_COAP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/coap.h>
+#include <openthread/instance.h>
+
+#include "MeshGateway.h"
+#include "MeshTime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** CoAP port (OpenThread default) and resources */
+#define MESH_COAP_PORT              OT_DEFAULT_COAP_PORT
+#define MESH_COAP_URI_EVENT         "e"
+#define MESH_COAP_URI_GATEWAY       "gw"
+#define MESH_COAP_MCAST             "ff03::1"
+
+/** Largest event payload (one MeshTlv frame) */
+#define MESH_COAP_MAX_PAYLOAD       64
+
+/** Transmit pool: events waiting for the multicast or the gateway */
+#define MESH_COAP_QUEUE_LEN         12
+
+/** Multicast copies held while detached are given up after this long */
+#define MESH_COAP_HOLD_MS           10000
+
+/** Multicast rate limit per class: one token per period, up to a burst */
+#define MESH_COAP_RATE_CRITICAL_MS  100
+#define MESH_COAP_BURST_CRITICAL    4
+#define MESH_COAP_RATE_TELEMETRY_MS 1000
+#define MESH_COAP_BURST_TELEMETRY   2
+
+/** Backpressure: free OpenThread message buffers needed to start a send,
+ *  and the re-check interval while short */
+#define MESH_COAP_MIN_FREE_CRITICAL  4
+#define MESH_COAP_MIN_FREE_TELEMETRY 12
+#define MESH_COAP_BUFFER_WAIT_MS     50
+
+/** Confirmable exchange: first ACK timeout, random factor 1.5 and
+ *  retransmissions.  The timeout doubles per retransmission, so an
+ *  exchange gives up after at most 1.5 * (1 + 2 + 4 + 8 + 16) s. */
+#define MESH_COAP_ACK_TIMEOUT_MS    1000
+#define MESH_COAP_MAX_RETRANSMIT    4
+
+/** Pause after a failed exchange, and poll interval while the event cannot be sent */
+#define MESH_COAP_RETRY_MS          4000
+
+/** A critical event not delivered by then is given up */
+#define MESH_COAP_MAX_AGE_MS        60000
+
+/** The gateway is forgotten after this long without an announcement */
+#define MESH_COAP_GATEWAY_TIMEOUT_MS 180000
+
+/** Gateway lookup interval while none is found through Network Data or DNS-SD */
+#define MESH_COAP_LOOKUP_MS         30000
+
+/** Exchanges timed out in a row before events are multicast again */
+#define MESH_COAP_GATEWAY_MAX_FAILURES 2
+
+/** Print a statistics line every N finished events (0 = off) */
+#ifndef MESH_COAP_LOG_EVERY
+#define MESH_COAP_LOG_EVERY         8
+#endif
+
+typedef enum
+{
+    MeshCoap_Telemetry = 0,  /**< NON, to the gateway or multicast */
+    MeshCoap_Critical  = 1,  /**< Confirmable to the gateway (and NON multicast while it is unknown) */
+} MeshCoap_Class_t;
+
+typedef struct
+{
+    uint32_t           published;   /**< NON multicast POSTs sent */
+    uint32_t           unicast;     /**< Events sent to the gateway only, without a multicast */
+    uint32_t           held;        /**< Events whose multicast could not go out at once */
+    uint32_t           deferred;    /**< Of those, published while detached */
+    uint32_t           expired;     /**< Held multicasts given up after MESH_COAP_HOLD_MS */
+    uint32_t           rateLimited; /**< Multicasts postponed by the rate limit */
+    uint32_t           backpressure;/**< Sends postponed for lack of message buffers */
+    uint32_t           queued;      /**< Critical events queued for the gateway */
+    uint32_t           delivered;   /**< Acknowledged by the gateway */
+    uint32_t           failed;      /**< Given up: too old, or rejected by the gateway */
+    uint32_t           dropped;     /**< Pushed out of a full pool */
+    uint32_t           timeouts;    /**< Exchanges that ran out of retransmissions */
+    uint32_t           duplicates;  /**< Received frames dropped by MeshDedup */
+    uint32_t           evictions;   /**< MeshDedup senders replaced in a full table */
+    uint8_t            depth;       /**< Pool slots in use now */
+    bool               gateway;     /**< A gateway is known */
+    uint8_t            gatewaySource; /**< MeshGateway_Source_t */
+    MeshTime_Latency_t rtt;         /**< First transmission to ACK, retransmissions included */
+} MeshCoap_Stats_t;
+
+/** Called from the timer task when queued work is due; post to the app task. */
+typedef void (*MeshCoap_Notify_t)(void);
+
+/** Called in the OpenThread context for each event POSTed to /e.  Repeats
+ *  of a TLV frame already seen (MeshDedup.h) are filtered out before. */
+typedef void (*MeshCoap_EventHandler_t)(const uint8_t* pPayload, uint16_t len,
+                                        const otMessageInfo* pMessageInfo);
+
+/** @brief Start CoAP, register /e and /gw and create the retry timer.
+ *  Call once the Thread stack is enabled. */
+void MeshCoap_Init(otInstance* pInstance, MeshCoap_EventHandler_t onEvent, MeshCoap_Notify_t notify);
+
+/** @brief Register an extra application resource on the CoAP server. */
+void MeshCoap_AddResource(otCoapResource* pResource);
+
+/** @brief Publish an event frame; critical events are also queued for the gateway.
+ *  @param peers Multicast the event even when the gateway is known: other
+ *               nodes act on it (rings)
+ *  @return OT_ERROR_NONE if the NON copy was sent now or is not needed.  Otherwise
+ *          the event is held and the reason is returned: OT_ERROR_INVALID_STATE
+ *          (detached), OT_ERROR_BUSY (rate limited) or OT_ERROR_NO_BUFS (buffers low). */
+otError MeshCoap_Publish(const uint8_t* pPayload, uint16_t len, MeshCoap_Class_t eventClass, bool peers);
+
+/** @brief Multicast group of peer events from now on (copied); NULL = ff03::1.
+ *  Call after MeshCoap_Init(). */
+void MeshCoap_SetPeerGroup(const otIp6Address* pGroup);
+
+/** @brief POST a report NON-confirmable to resource @p pUri on the gateway.
+ *  @return OT_ERROR_INVALID_STATE if detached or no gateway is known,
+ *          OT_ERROR_NO_BUFS if message buffers are below the telemetry minimum. */
+otError MeshCoap_PostToGateway(const char* pUri, const uint8_t* pPayload, uint16_t len);
+
+/** @brief Send held multicasts and start the next confirmable exchange if due.
+ *  Call from the app task on the notify hook and on attach. */
+void MeshCoap_Process(void);
+
+/** @brief Look the gateway up again on role and Network Data changes.
+ *  Call from the OpenThread state-changed callback with its flags. */
+void MeshCoap_StateChanged(uint32_t flags);
+
+/** @brief Send an empty 2.04 ACK if @p pRequest is confirmable (resource handlers). */
+void MeshCoap_Acknowledge(otMessage* pRequest, const otMessageInfo* pMessageInfo);
+
+/** @brief A critical event is queued or in flight (the channel survey waits for it). */
+bool MeshCoap_CriticalPending(void);
+
+/** @brief Snapshot of the delivery statistics. */
+void MeshCoap_GetStats(MeshCoap_Stats_t* pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_COAP_H_ */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshDataset.c"
+ *
+ * Thread commissioning from a complete Active Operational Dataset.
+ */
+
+#include "MeshDataset.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/thread.h>
+
+/* MeshCoP TLV types checked before the dataset is applied */
+#define MESH_DATASET_TLV_CHANNEL          0x00
+#define MESH_DATASET_TLV_PANID            0x01
+#define MESH_DATASET_TLV_NETWORK_KEY      0x05
+#define MESH_DATASET_TLV_ACTIVE_TIMESTAMP 0x0E
+
+/* Lengths of those TLVs; the channel TLV is page (1) + channel (BE16) */
+#define MESH_DATASET_CHANNEL_LEN          3
+#define MESH_DATASET_PANID_LEN            2
+#define MESH_DATASET_NETWORK_KEY_LEN      OT_NETWORK_KEY_SIZE
+#define MESH_DATASET_TIMESTAMP_LEN        8
+
+#define MESH_DATASET_REQUIRED                                                            \
+    ((1UL << MESH_DATASET_TLV_CHANNEL) | (1UL << MESH_DATASET_TLV_PANID) |               \
+     (1UL << MESH_DATASET_TLV_NETWORK_KEY) | (1UL << MESH_DATASET_TLV_ACTIVE_TIMESTAMP))
+
+static otInstance*                 sInstance = NULL;
+static MeshDataset_Notify_t        sNotify   = NULL;
+static MeshDataset_ResultHandler_t sOnResult = NULL;
+
+/* Dataset being written; guarded by a critical section */
+static uint8_t                     sTlvs[MESH_DATASET_MAX_LEN];
+static uint16_t                    sLength   = 0;
+static bool                        sOverflow = false;
+static bool                        sPending  = false;
+
+static StaticTimer_t               sTimerBuffer;
+static TimerHandle_t               sTimer = NULL;
+
+static void MeshDataset_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+/* Walk the TLVs; the required ones must be present with their fixed lengths */
+static otError MeshDataset_Check(const uint8_t* pTlvs, uint16_t len)
+{
+    uint32_t seen = 0;
+    uint16_t pos  = 0;
+
+    while(pos < len)
+    {
+        uint8_t type;
+        uint8_t tlvLen;
+
+        if(len - pos < 2)
+        {
+            return OT_ERROR_PARSE;
+        }
+        type   = pTlvs[pos];
+        tlvLen = pTlvs[pos + 1];
+        if(tlvLen > len - pos - 2)
+        {
+            return OT_ERROR_PARSE;
+        }
+
+        switch(type)
+        {
+            case MESH_DATASET_TLV_CHANNEL:
+            {
+                uint16_t channel;
+
+                if(tlvLen != MESH_DATASET_CHANNEL_LEN || pTlvs[pos + 2] != 0)
+                {
+                    return OT_ERROR_INVALID_ARGS;
+                }
+                channel = (uint16_t)((pTlvs[pos + 3] << 8) | pTlvs[pos + 4]);
+                if(channel < 11 || channel > 26)
+                {
+                    return OT_ERROR_INVALID_ARGS;
+                }
+                break;
+            }
+            case MESH_DATASET_TLV_PANID:
+                if(tlvLen != MESH_DATASET_PANID_LEN)
+                {
+                    return OT_ERROR_INVALID_ARGS;
+                }
+                break;
+            case MESH_DATASET_TLV_NETWORK_KEY:
+                if(tlvLen != MESH_DATASET_NETWORK_KEY_LEN)
+                {
+                    return OT_ERROR_INVALID_ARGS;
+                }
+                break;
+            case MESH_DATASET_TLV_ACTIVE_TIMESTAMP:
+                if(tlvLen != MESH_DATASET_TIMESTAMP_LEN)
+                {
+                    return OT_ERROR_INVALID_ARGS;
+                }
+                break;
+            default:
+                break;
+        }
+
+        if(type < 32)
+        {
+            seen |= 1UL << type;
+        }
+        pos = (uint16_t)(pos + 2 + tlvLen);
+    }
+
+    return ((seen & MESH_DATASET_REQUIRED) == MESH_DATASET_REQUIRED) ? OT_ERROR_NONE : OT_ERROR_INVALID_ARGS;
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshDataset_Init(otInstance* pInstance, MeshDataset_Notify_t notify, MeshDataset_ResultHandler_t onResult)
+{
+    sInstance = pInstance;
+    sNotify   = notify;
+    sOnResult = onResult;
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshDataset", pdMS_TO_TICKS(MESH_DATASET_SETTLE_MS), pdFALSE, NULL,
+                                    MeshDataset_TimerCallback, &sTimerBuffer);
+    }
+}
+
+void MeshDataset_Write(uint16_t offset, const uint8_t* pValue, uint16_t len)
+{
+    taskENTER_CRITICAL();
+    if(offset == 0)
+    {
+        sLength   = 0;
+        sOverflow = false;
+    }
+    if(offset > sLength || (uint32_t)offset + len > sizeof(sTlvs))
+    {
+        /* A gap, or longer than any dataset */
+        sOverflow = true;
+    }
+    else
+    {
+        memcpy(&sTlvs[offset], pValue, len);
+        if(offset + len > sLength)
+        {
+            sLength = (uint16_t)(offset + len);
+        }
+    }
+    sPending = true;
+    taskEXIT_CRITICAL();
+
+    /* Restarted by every chunk: checked once the long write is complete */
+    if(sTimer != NULL)
+    {
+        xTimerReset(sTimer, 0);
+    }
+}
+
+void MeshDataset_Process(void)
+{
+    otOperationalDatasetTlvs dataset;
+    bool                     pending;
+    bool                     overflow;
+    otError                  err;
+
+    taskENTER_CRITICAL();
+    pending  = sPending;
+    overflow = sOverflow;
+    memcpy(dataset.mTlvs, sTlvs, sLength);
+    dataset.mLength = (uint8_t)sLength;
+    memset(sTlvs, 0, sizeof(sTlvs));
+    sLength  = 0;
+    sPending = false;
+    taskEXIT_CRITICAL();
+
+    if(!pending || sInstance == NULL)
+    {
+        return;
+    }
+
+    err = overflow ? OT_ERROR_NO_BUFS : MeshDataset_Check(dataset.mTlvs, dataset.mLength);
+    if(err == OT_ERROR_NONE)
+    {
+        /* Replacing the dataset of a running network: stop Thread first */
+        if(otThreadGetDeviceRole(sInstance) != OT_DEVICE_ROLE_DISABLED)
+        {
+            otThreadSetEnabled(sInstance, false);
+        }
+        err = otDatasetSetActiveTlvs(sInstance, &dataset);
+    }
+
+    if(sOnResult != NULL)
+    {
+        sOnResult(err, dataset.mLength);
+    }
+
+    /* Do not leave the network key on the stack */
+    memset(&dataset, 0, sizeof(dataset));
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshDataset.h"
+ *
+ * Thread commissioning from a complete Active Operational Dataset.
+ *
+ * The phone or the gateway writes the dataset as MeshCoP TLVs, exactly as
+ * printed by "ot-ctl dataset active -x", to one GATT characteristic.  A
+ * dataset longer than the ATT MTU arrives as a long (prepared) write, in
+ * chunks at increasing offsets; an offset of 0 starts a new dataset.
+ *
+ * MESH_DATASET_SETTLE_MS after the last chunk the dataset is checked:
+ *
+ *   - the TLVs must fill the write exactly (no truncated TLV);
+ *   - Active Timestamp, Channel, PAN ID and Network Key must be present,
+ *     with their fixed lengths, and the channel must be 11..26;
+ *
+ * and applied with otDatasetSetActiveTlvs(), which also stores it in NVM.
+ * The result goes to the application, which then starts Thread.
+ *
+ * Threading: MeshDataset_Write() runs in the BLE stack context and the
+ * settle timer only calls the application's notify hook; the application
+ * calls MeshDataset_Process() from its own task.
+ */
+
+#ifndef _MESH_DATASET_H_
+#define _MESH_DATASET_H_
+
+#include <stdint.h>
+
+#include <openthread/dataset.h>
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Largest dataset accepted, the size of otOperationalDatasetTlvs */
+#define MESH_DATASET_MAX_LEN        OT_OPERATIONAL_DATASET_MAX_LENGTH
+
+/** Quiet time after the last chunk before the dataset is checked */
+#define MESH_DATASET_SETTLE_MS      100
+
+/** Called from the timer task when a written dataset is ready; post to the app task. */
+typedef void (*MeshDataset_Notify_t)(void);
+
+/** Called from MeshDataset_Process() with the outcome.
+ *  @param error OT_ERROR_NONE (applied), OT_ERROR_NO_BUFS (longer than
+ *               MESH_DATASET_MAX_LEN), OT_ERROR_PARSE (malformed TLVs),
+ *               OT_ERROR_INVALID_ARGS (a required TLV missing or invalid),
+ *               or the error of otDatasetSetActiveTlvs()
+ *  @param len   Dataset length in bytes */
+typedef void (*MeshDataset_ResultHandler_t)(otError error, uint16_t len);
+
+/** @brief Create the settle timer. */
+void MeshDataset_Init(otInstance* pInstance, MeshDataset_Notify_t notify, MeshDataset_ResultHandler_t onResult);
+
+/** @brief Take one chunk of a dataset write (GATT write callback). */
+void MeshDataset_Write(uint16_t offset, const uint8_t* pValue, uint16_t len);
+
+/** @brief Check and apply the written dataset, if any, and report the result. */
+void MeshDataset_Process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_DATASET_H_ */
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshDedup.c"
+ *
+ * Per-sender sliding-window duplicate filter.  A lookup is a linear scan
+ * of MESH_DEDUP_SOURCES entries and a shift of one 32-bit word.
+ */
+
+#include "MeshDedup.h"
+
+#include <string.h>
+
+static void MeshDedup_Start(MeshDedup_Source_t* pSource, uint32_t deviceId, uint16_t seq)
+{
+    pSource->deviceId = deviceId;
+    pSource->top      = seq;
+    pSource->bitmap   = 1;
+    pSource->used     = true;
+}
+
+static void MeshDedup_Restart(MeshDedup_t* pDedup, MeshDedup_Source_t* pSource, uint32_t deviceId,
+                              uint16_t seq)
+{
+    MeshDedup_Start(pSource, deviceId, seq);
+    pDedup->restarts++;
+}
+
+void MeshDedup_Init(MeshDedup_t* pDedup)
+{
+    memset(pDedup, 0, sizeof(*pDedup));
+}
+
+bool MeshDedup_IsNew(MeshDedup_t* pDedup, uint32_t deviceId, uint16_t seq, uint32_t nowMs)
+{
+    MeshDedup_Source_t* pSource = NULL;
+    MeshDedup_Source_t* pOldest = &pDedup->sources[0];
+    int16_t             ahead;
+    uint16_t            i;
+
+    for(i = 0; i < MESH_DEDUP_SOURCES; i++)
+    {
+        MeshDedup_Source_t* pEntry = &pDedup->sources[i];
+
+        if(pEntry->used && pEntry->deviceId == deviceId)
+        {
+            pSource = pEntry;
+            break;
+        }
+        /* Free entries first, then the least recently heard */
+        if(pOldest->used && (!pEntry->used || (int32_t)(pEntry->lastMs - pOldest->lastMs) < 0))
+        {
+            pOldest = pEntry;
+        }
+    }
+
+    if(pSource == NULL)
+    {
+        if(pOldest->used)
+        {
+            pDedup->evictions++;
+        }
+        MeshDedup_Start(pOldest, deviceId, seq);
+        pOldest->lastMs = nowMs;
+        pDedup->accepted++;
+        return true;
+    }
+
+    if(nowMs - pSource->lastMs >= MESH_DEDUP_EXPIRY_MS)
+    {
+        MeshDedup_Restart(pDedup, pSource, deviceId, seq);
+        pSource->lastMs = nowMs;
+        pDedup->accepted++;
+        return true;
+    }
+    pSource->lastMs = nowMs;
+
+    ahead = (int16_t)(uint16_t)(seq - pSource->top);
+    if(ahead > 0)
+    {
+        pSource->bitmap = (ahead < MESH_DEDUP_WINDOW) ? (pSource->bitmap << ahead) | 1u : 1u;
+        pSource->top    = seq;
+    }
+    else if(-ahead >= MESH_DEDUP_WINDOW)
+    {
+        MeshDedup_Restart(pDedup, pSource, deviceId, seq);
+    }
+    else if(pSource->bitmap & (1ul << -ahead))
+    {
+        pDedup->duplicates++;
+        return false;
+    }
+    else
+    {
+        pSource->bitmap |= 1ul << -ahead;
+    }
+
+    pDedup->accepted++;
+    return true;
+}
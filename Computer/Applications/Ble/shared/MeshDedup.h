@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshDedup.h"
+ *
+ * Duplicate suppression for events received over the mesh.
+ *
+ * The same frame can arrive more than once: MPL forwards a realm-local
+ * multicast along several paths, and the sender repeats a held or
+ * unacknowledged event.  Every TLV frame (MeshTlv.h) carries the sender's
+ * device id and a per-sender 16-bit frame sequence, so the pair names one
+ * frame.  The device id comes from the factory EUI-64 and, unlike the
+ * RLOC16, does not change when the sender re-attaches elsewhere.
+ *
+ * Per sender, the last MESH_DEDUP_WINDOW sequence numbers are kept as a
+ * bitmap anchored on the highest one seen (bit n = top - n):
+ *
+ *     ahead of top           new, the window slides forward
+ *     inside the window      new unless its bit is already set
+ *     behind the window      new, the window restarts there: the sender
+ *                            rebooted (its sequence restarts at a random
+ *                            value), a delayed copy this late is unlikely
+ *
+ * Sequence numbers compare in serial-number arithmetic (RFC 1982), so the
+ * counter wraps freely.  A sender not heard for MESH_DEDUP_EXPIRY_MS starts
+ * over; when the table is full the sender heard least recently is replaced
+ * (an eviction).  A repeat from an evicted sender is taken as new, so the
+ * table is sized to hold every sender of the mesh.
+ *
+ * This module has no SDK dependencies so it can be built and checked on a host.
+ */
+
+#ifndef _MESH_DEDUP_H_
+#define _MESH_DEDUP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Senders tracked at once: at least the nodes of the installation (16 bytes each) */
+#ifndef MESH_DEDUP_SOURCES
+#define MESH_DEDUP_SOURCES          32
+#endif
+
+/** Sequence numbers remembered per sender (bits in the bitmap) */
+#define MESH_DEDUP_WINDOW           32
+
+/** A sender silent for this long starts a fresh window */
+#define MESH_DEDUP_EXPIRY_MS        120000
+
+typedef struct
+{
+    uint32_t deviceId;
+    uint32_t bitmap;      /**< Bit n: top - n was seen */
+    uint32_t lastMs;      /**< Last frame from this sender */
+    uint16_t top;         /**< Highest sequence seen */
+    bool     used;
+} MeshDedup_Source_t;
+
+typedef struct
+{
+    MeshDedup_Source_t sources[MESH_DEDUP_SOURCES];
+    uint32_t           accepted;
+    uint32_t           duplicates;
+    uint32_t           restarts;     /**< Windows restarted: sender rebooted or expired */
+    uint32_t           evictions;    /**< Senders replaced in a full table; non-zero = table too small */
+} MeshDedup_t;
+
+/** @brief Clear the table. */
+void MeshDedup_Init(MeshDedup_t* pDedup);
+
+/** @brief Check a received frame and remember it.
+ *  @return true for a new frame, false for a duplicate */
+bool MeshDedup_IsNew(MeshDedup_t* pDedup, uint32_t deviceId, uint16_t seq, uint32_t nowMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_DEDUP_H_ */
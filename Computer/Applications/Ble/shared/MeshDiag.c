@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshDiag.c"
+ *
+ * Thread network diagnostics snapshot: collection, encoding and export.
+ *
+ * Every counter is read from OpenThread as it stands (totals since boot);
+ * the gateway works out rates from successive snapshots.  The snapshot is
+ * built in the application task, so no locking is needed; the state-change
+ * hook only re-arms the timer.
+ */
+
+#include "MeshDiag.h"
+
+#include <string.h>
+
+#include "MeshCoap.h"
+#include "MeshRecovery.h"
+#include "MeshRole.h"
+#include "MeshTlvNode.h"
+#include "MeshTxPower.h"
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/link.h>
+#include <openthread/message.h>
+#include <openthread/thread.h>
+#include <openthread/platform/radio.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* Changes that trigger an early snapshot */
+#define MESH_DIAG_TOPOLOGY_FLAGS                                                                       \
+    (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_PARENT_LINK_QUALITY |       \
+     OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED)
+
+#define MESH_DIAG_NO_PARENT         0xFFFF
+
+static otInstance*                sInstance   = NULL;
+static MeshDiag_Notify_t          sNotify     = NULL;
+static MeshDiag_SnapshotHandler_t sOnSnapshot = NULL;
+
+static uint32_t                   sSnapshots = 0;
+static uint32_t                   sPushed    = 0;
+
+static StaticTimer_t              sTimerBuffer;
+static TimerHandle_t              sTimer = NULL;
+
+static void MeshDiag_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshDiag_Arm(uint32_t delayMs)
+{
+    if(sTimer != NULL)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(delayMs), 0);
+    }
+}
+
+static void MeshDiag_PutBe16(uint8_t* p, uint16_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static void MeshDiag_PutBe32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/* -------------------------------------------------------------------------
+ * Records
+ * ------------------------------------------------------------------------- */
+
+static uint16_t MeshDiag_ParentRloc16(otDeviceRole role)
+{
+    otRouterInfo parent;
+
+    if(role == OT_DEVICE_ROLE_CHILD && otThreadGetParentInfo(sInstance, &parent) == OT_ERROR_NONE)
+    {
+        return parent.mRloc16;
+    }
+    return MESH_DIAG_NO_PARENT;
+}
+
+static void MeshDiag_PutNode(MeshTlv_Writer_t* pWriter, otDeviceRole role, uint16_t parentRloc16)
+{
+    uint8_t* p = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_NODE, MESH_TLV_DIAG_NODE_LEN);
+
+    if(p == NULL)
+    {
+        return;
+    }
+    p[0] = (uint8_t)role;
+    MeshDiag_PutBe16(&p[1], otThreadGetRloc16(sInstance));
+    MeshDiag_PutBe16(&p[3], parentRloc16);
+    MeshDiag_PutBe32(&p[5], otThreadGetPartitionId(sInstance));
+    MeshDiag_PutBe32(&p[9], (uint32_t)(xTaskGetTickCount() / configTICK_RATE_HZ));
+}
+
+static void MeshDiag_PutMle(MeshTlv_Writer_t* pWriter)
+{
+    const otMleCounters* pMle = otThreadGetMleCounters(sInstance);
+    uint8_t*             p    = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_MLE, MESH_TLV_DIAG_MLE_LEN);
+
+    if(p == NULL)
+    {
+        return;
+    }
+    MeshDiag_PutBe16(&p[0], pMle->mAttachAttempts);
+    MeshDiag_PutBe16(&p[2], pMle->mParentChanges);
+    MeshDiag_PutBe16(&p[4], pMle->mPartitionIdChanges);
+    MeshDiag_PutBe16(&p[6], pMle->mDetachedRole);
+}
+
+static void MeshDiag_PutMac(MeshTlv_Writer_t* pWriter)
+{
+    const otMacCounters* pMac = otLinkGetCounters(sInstance);
+    uint8_t*             p    = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_MAC, MESH_TLV_DIAG_MAC_LEN);
+
+    if(p == NULL)
+    {
+        return;
+    }
+    MeshDiag_PutBe32(&p[0], pMac->mTxTotal);
+    MeshDiag_PutBe32(&p[4], pMac->mTxRetry);
+    MeshDiag_PutBe32(&p[8], pMac->mTxErrCca);
+    MeshDiag_PutBe32(&p[12], pMac->mTxDirectMaxRetryExpiry + pMac->mTxIndirectMaxRetryExpiry + pMac->mTxErrAbort);
+    MeshDiag_PutBe32(&p[16], pMac->mRxTotal);
+    MeshDiag_PutBe32(&p[20], pMac->mRxErrNoFrame + pMac->mRxErrUnknownNeighbor + pMac->mRxErrInvalidSrcAddr +
+                                 pMac->mRxErrSec + pMac->mRxErrFcs + pMac->mRxErrOther);
+}
+
+static void MeshDiag_PutBuffers(MeshTlv_Writer_t* pWriter, otBufferInfo* pInfo)
+{
+    uint8_t* p = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_BUF, MESH_TLV_DIAG_BUF_LEN);
+
+    otMessageGetBufferInfo(sInstance, pInfo);
+    if(p == NULL)
+    {
+        return;
+    }
+    MeshDiag_PutBe16(&p[0], pInfo->mTotalBuffers);
+    MeshDiag_PutBe16(&p[2], pInfo->mFreeBuffers);
+    MeshDiag_PutBe16(&p[4], pInfo->mMaxUsedBuffers);
+}
+
+static bool MeshDiag_PutNeighbor(MeshTlv_Writer_t* pWriter, uint16_t rloc16, int8_t avgRssi, uint8_t lqiIn,
+                                 uint8_t flags, uint16_t frameErrorRate)
+{
+    int16_t  margin = 0;
+    uint8_t* p      = MeshTlv_Reserve(pWriter, MESH_TLV_REC_NEIGHBOR, MESH_TLV_NEIGHBOR_LEN);
+
+    if(p == NULL)
+    {
+        return false;
+    }
+    if(avgRssi != OT_RADIO_RSSI_INVALID)
+    {
+        margin = (int16_t)avgRssi - otPlatRadioGetReceiveSensitivity(sInstance);
+        margin = (margin < 0) ? 0 : (margin > 0xFF) ? 0xFF : margin;
+    }
+
+    MeshDiag_PutBe16(&p[0], rloc16);
+    p[2] = (uint8_t)avgRssi;
+    p[3] = (uint8_t)margin;
+    p[4] = lqiIn;
+    p[5] = flags;
+    /* OpenThread scales the rate to 0xFFFF = 100 % */
+    p[6] = (uint8_t)(((uint32_t)frameErrorRate * 100 + 0x7FFF) / 0xFFFF);
+    return true;
+}
+
+static void MeshDiag_PutTxPower(MeshTlv_Writer_t* pWriter)
+{
+    MeshTxPower_Status_t status;
+    uint8_t*             p = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_TXPOWER, MESH_TLV_DIAG_TXPOWER_LEN);
+
+    if(p == NULL)
+    {
+        return;
+    }
+    MeshTxPower_GetStatus(&status);
+    p[0] = (uint8_t)status.dbm;
+    p[1] = (uint8_t)status.maxDbm;
+    p[2] = status.marginDb;
+    p[3] = status.retryPct;
+    MeshDiag_PutBe16(&p[4], status.limitRloc16);
+    MeshDiag_PutBe16(&p[6], status.changes);
+    p[8] = status.reason;
+}
+
+static void MeshDiag_PutRole(MeshTlv_Writer_t* pWriter)
+{
+    MeshRole_Stats_t stats;
+    uint8_t*         p = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_ROLE, MESH_TLV_DIAG_ROLE_LEN);
+
+    if(p == NULL)
+    {
+        return;
+    }
+    MeshRole_GetStats(&stats);
+    p[0] = stats.policy;
+    p[1] = stats.leaderWeight;
+    MeshDiag_PutBe16(&p[2], stats.roleChanges);
+    MeshDiag_PutBe16(&p[4], stats.routerUpgrades);
+    MeshDiag_PutBe16(&p[6], stats.routerDowngrades);
+    MeshDiag_PutBe16(&p[8], stats.leaderTerms);
+    MeshDiag_PutBe16(&p[10], stats.detaches);
+    MeshDiag_PutBe32(&p[12], stats.roleAgeS);
+}
+
+static void MeshDiag_PutRecovery(MeshTlv_Writer_t* pWriter)
+{
+    MeshRecovery_Stats_t stats;
+    uint8_t*             p = MeshTlv_Reserve(pWriter, MESH_TLV_REC_DIAG_RECOVERY, MESH_TLV_DIAG_RECOVERY_LEN);
+    uint8_t              i;
+
+    if(p == NULL)
+    {
+        return;
+    }
+    MeshRecovery_GetStats(&stats);
+    p[0] = stats.lastReason;
+    for(i = 0; i < MESH_RECOVERY_BUCKETS; i++)
+    {
+        MeshDiag_PutBe16(&p[1 + 2 * i], stats.outages[i]);
+    }
+    MeshDiag_PutBe32(&p[13], stats.lastMs);
+    MeshDiag_PutBe32(&p[17], stats.longestMs);
+    MeshDiag_PutBe32(&p[21], stats.currentMs);
+    MeshDiag_PutBe16(&p[25], stats.reasons[MeshRecovery_ParentLost]);
+    MeshDiag_PutBe16(&p[27], stats.reasons[MeshRecovery_RouterLost]);
+    MeshDiag_PutBe16(&p[29], stats.reasons[MeshRecovery_Dataset]);
+    MeshDiag_PutBe16(&p[31], stats.deferred);
+    MeshDiag_PutBe16(&p[33], stats.expired);
+    MeshDiag_PutBe16(&p[35], stats.attachRestarts);
+}
+
+/* The parent on a child (its only neighbor), else the neighbor table.
+ * Returns the number of records written. */
+static uint8_t MeshDiag_PutNeighbors(MeshTlv_Writer_t* pWriter, otDeviceRole role)
+{
+    otNeighborInfoIterator iterator = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighbor;
+    otRouterInfo           parent;
+    int8_t                 rssi  = OT_RADIO_RSSI_INVALID;
+    uint8_t                count = 0;
+    uint8_t                flags;
+
+    if(role == OT_DEVICE_ROLE_CHILD)
+    {
+        if(otThreadGetParentInfo(sInstance, &parent) != OT_ERROR_NONE)
+        {
+            return 0;
+        }
+        (void)otThreadGetParentAverageRssi(sInstance, &rssi);
+        return MeshDiag_PutNeighbor(pWriter, parent.mRloc16, rssi, parent.mLinkQualityIn,
+                                    MESH_TLV_NEIGHBOR_PARENT | MESH_TLV_NEIGHBOR_RX_ON, 0)
+                   ? 1
+                   : 0;
+    }
+
+    while(count < MESH_DIAG_MAX_NEIGHBORS &&
+          otThreadGetNextNeighborInfo(sInstance, &iterator, &neighbor) == OT_ERROR_NONE)
+    {
+        flags = (neighbor.mIsChild ? MESH_TLV_NEIGHBOR_CHILD : 0) |
+                (neighbor.mRxOnWhenIdle ? MESH_TLV_NEIGHBOR_RX_ON : 0);
+        if(!MeshDiag_PutNeighbor(pWriter, neighbor.mRloc16, neighbor.mAverageRssi, neighbor.mLinkQualityIn, flags,
+                                 neighbor.mFrameErrorRate))
+        {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
+static void MeshDiag_Log(otDeviceRole role, uint16_t parentRloc16, uint8_t neighbors, const otBufferInfo* pBuffers)
+{
+    const otMacCounters* pMac = otLinkGetCounters(sInstance);
+
+    GP_LOG_SYSTEM_PRINTF("[Diag] role:%d rloc:%04x parent:%04x nbrs:%u tx:%lu retry:%lu cca:%lu rx:%lu "
+                         "bufs:%u/%u free (max used %u) pushed:%lu/%lu",
+                         0, (int)role, otThreadGetRloc16(sInstance), parentRloc16, neighbors,
+                         (unsigned long)pMac->mTxTotal, (unsigned long)pMac->mTxRetry,
+                         (unsigned long)pMac->mTxErrCca, (unsigned long)pMac->mRxTotal, pBuffers->mFreeBuffers,
+                         pBuffers->mTotalBuffers, pBuffers->mMaxUsedBuffers, (unsigned long)sPushed,
+                         (unsigned long)sSnapshots);
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshDiag_Init(otInstance* pInstance, MeshDiag_Notify_t notify, MeshDiag_SnapshotHandler_t onSnapshot)
+{
+    sInstance   = pInstance;
+    sNotify     = notify;
+    sOnSnapshot = onSnapshot;
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshDiag", pdMS_TO_TICKS(MESH_DIAG_INTERVAL_MS), pdFALSE, NULL,
+                                    MeshDiag_TimerCallback, &sTimerBuffer);
+    }
+    MeshDiag_Arm(MESH_DIAG_INTERVAL_MS);
+}
+
+void MeshDiag_StateChanged(uint32_t flags)
+{
+    if(flags & MESH_DIAG_TOPOLOGY_FLAGS)
+    {
+        MeshDiag_Arm(MESH_DIAG_CHANGE_DELAY_MS);
+    }
+}
+
+void MeshDiag_Request(void)
+{
+    MeshDiag_Arm(MESH_DIAG_CHANGE_DELAY_MS);
+}
+
+void MeshDiag_Process(void)
+{
+    uint8_t          frame[MESH_DIAG_MAX_FRAME];
+    MeshTlv_Writer_t writer;
+    otBufferInfo     buffers;
+    otDeviceRole     role;
+    uint16_t         parentRloc16;
+    uint8_t          neighbors;
+    uint16_t         len;
+
+    if(sInstance == NULL)
+    {
+        return;
+    }
+
+    role         = otThreadGetDeviceRole(sInstance);
+    parentRloc16 = MeshDiag_ParentRloc16(role);
+
+    MeshTlvNode_Begin(&writer, frame, sizeof(frame), NULL);
+    MeshDiag_PutNode(&writer, role, parentRloc16);
+    MeshDiag_PutMle(&writer);
+    MeshDiag_PutMac(&writer);
+    MeshDiag_PutBuffers(&writer, &buffers);
+    MeshDiag_PutTxPower(&writer);
+    MeshDiag_PutRole(&writer);
+    MeshDiag_PutRecovery(&writer);
+    neighbors = MeshDiag_PutNeighbors(&writer, role);
+    len       = MeshTlvNode_Finish(&writer);
+
+    if(len != 0)
+    {
+        sSnapshots++;
+        if(sOnSnapshot != NULL)
+        {
+            sOnSnapshot(frame, len);
+        }
+        if(MeshCoap_PostToGateway(MESH_DIAG_URI, frame, len) == OT_ERROR_NONE)
+        {
+            sPushed++;
+        }
+        if(MESH_DIAG_LOG_EVERY != 0 && sSnapshots % MESH_DIAG_LOG_EVERY == 0)
+        {
+            MeshDiag_Log(role, parentRloc16, neighbors, &buffers);
+        }
+    }
+
+    MeshDiag_Arm(MESH_DIAG_INTERVAL_MS);
+}
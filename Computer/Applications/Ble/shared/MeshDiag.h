@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshDiag.h"
+ *
+ * Thread network diagnostics snapshot.
+ *
+ * Every MESH_DIAG_INTERVAL_MS, and MESH_DIAG_CHANGE_DELAY_MS after a role,
+ * partition or parent link change, the node collects a snapshot and
+ * encodes it as a MeshTlv frame (MeshTlv.h, records 0x05..0x09):
+ *
+ *   DIAG_NODE  role, RLOC16, parent RLOC16, partition id, uptime
+ *   DIAG_MLE   attach attempts, parent and partition changes, detaches
+ *   DIAG_MAC   tx / retry / CCA failure / tx failure / rx / rx error counters
+ *   DIAG_BUF   OpenThread message buffers: total, free, most used
+ *   NEIGHBOR   per neighbor (the parent on a child): RLOC16, average RSSI,
+ *              link margin, link quality in, flags, frame error rate
+ *   DIAG_TXPOWER  adaptive transmit power state (MeshTxPower.h), record 0x0B
+ *   DIAG_ROLE  role policy and role churn counters (MeshRole.h), record 0x0C
+ *   DIAG_RECOVERY  detach / reattach outage metrics (MeshRecovery.h), record 0x0D
+ *
+ * The frame is signed like every other frame the node sends (MeshAuth.h),
+ * handed to the application (e.g. for a GATT characteristic) and POSTed
+ * NON-confirmable to /d on the gateway (MeshCoap_PostToGateway).
+ * A snapshot that cannot be sent is not retried: the next one replaces it.
+ *
+ * Threading: the timer and MeshDiag_StateChanged() only call the
+ * application's notify hook; the application calls MeshDiag_Process() from
+ * its own task, like MeshCoap_Process().
+ */
+
+#ifndef _MESH_DIAG_H_
+#define _MESH_DIAG_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "MeshTlv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** CoAP resource on the gateway */
+#define MESH_DIAG_URI               "d"
+
+/** Neighbors reported per snapshot */
+#define MESH_DIAG_MAX_NEIGHBORS     8
+
+/** Largest snapshot frame, AUTH record included.  Larger than
+ *  MESH_TLV_MAX_FRAME: a report with many neighbors is sent in 6LoWPAN
+ *  fragments. */
+#define MESH_DIAG_MAX_FRAME                                                                               \
+    (MESH_TLV_HEADER_LEN + 8 * MESH_TLV_RECORD_HDR_LEN + MESH_TLV_DIAG_NODE_LEN + MESH_TLV_DIAG_MLE_LEN + \
+     MESH_TLV_DIAG_MAC_LEN + MESH_TLV_DIAG_BUF_LEN + MESH_TLV_DIAG_TXPOWER_LEN + MESH_TLV_DIAG_ROLE_LEN + \
+     MESH_TLV_DIAG_RECOVERY_LEN + MESH_TLV_AUTH_LEN +                                                     \
+     MESH_DIAG_MAX_NEIGHBORS * (MESH_TLV_RECORD_HDR_LEN + MESH_TLV_NEIGHBOR_LEN))
+
+/** Snapshot period */
+#ifndef MESH_DIAG_INTERVAL_MS
+#define MESH_DIAG_INTERVAL_MS       60000
+#endif
+
+/** Delay from a topology change to its snapshot, so the change can settle */
+#define MESH_DIAG_CHANGE_DELAY_MS   2000
+
+/** Print a summary line every N snapshots (0 = off) */
+#ifndef MESH_DIAG_LOG_EVERY
+#define MESH_DIAG_LOG_EVERY         5
+#endif
+
+/** Called from the timer task or the OpenThread context when a snapshot is due; post to the app task. */
+typedef void (*MeshDiag_Notify_t)(void);
+
+/** Called from MeshDiag_Process() with each new snapshot frame. */
+typedef void (*MeshDiag_SnapshotHandler_t)(const uint8_t* pFrame, uint16_t len);
+
+/** @brief Create the snapshot timer.  Call after MeshCoap_Init() and
+ *  MeshTlvNode_Init(). */
+void MeshDiag_Init(otInstance* pInstance, MeshDiag_Notify_t notify, MeshDiag_SnapshotHandler_t onSnapshot);
+
+/** @brief Schedule an early snapshot on topology changes.
+ *  Call from the OpenThread state-changed callback with its flags. */
+void MeshDiag_StateChanged(uint32_t flags);
+
+/** @brief Schedule an early snapshot, e.g. after a transmit power change. */
+void MeshDiag_Request(void);
+
+/** @brief Take a snapshot, hand it to the application and push it to the gateway. */
+void MeshDiag_Process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_DIAG_H_ */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshGateway.c"
+ *
+ * Gateway discovery through the Thread Network Data and DNS-SD.
+ */
+
+#include "MeshGateway.h"
+
+#include <string.h>
+
+#include "MeshCoap.h"
+
+#include "gpLog.h"
+
+#include <openthread/netdata.h>
+#include <openthread/thread.h>
+#if MESH_GATEWAY_DNSSD
+#include <openthread/dns_client.h>
+#endif
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+static otInstance*           sInstance = NULL;
+static MeshGateway_Handler_t sOnResult = NULL;
+
+#if MESH_GATEWAY_DNSSD
+static bool                  sBrowsing = false;
+#endif
+
+/* RLOC address of a server: mesh-local prefix + 0000:00ff:fe00:<rloc16> */
+static void MeshGateway_RlocAddress(uint16_t rloc16, otIp6Address* pAddr)
+{
+    const otMeshLocalPrefix* pPrefix = otThreadGetMeshLocalPrefix(sInstance);
+
+    memset(pAddr, 0, sizeof(*pAddr));
+    memcpy(pAddr->mFields.m8, pPrefix->m8, OT_MESH_LOCAL_PREFIX_SIZE);
+    pAddr->mFields.m8[11] = 0xFF;
+    pAddr->mFields.m8[12] = 0xFE;
+    pAddr->mFields.m8[14] = (uint8_t)(rloc16 >> 8);
+    pAddr->mFields.m8[15] = (uint8_t)rloc16;
+}
+
+/* First matching service entry; returns false if there is none */
+static bool MeshGateway_FindService(otIp6Address* pAddr, uint16_t* pPort)
+{
+    otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
+    otServiceConfig       config;
+    const uint8_t         serviceLen = (uint8_t)(sizeof(MESH_GATEWAY_SERVICE_DATA) - 1);
+
+    while(otNetDataGetNextService(sInstance, &iterator, &config) == OT_ERROR_NONE)
+    {
+        const otServerConfig* pServer = &config.mServerConfig;
+
+        if(config.mEnterpriseNumber != MESH_GATEWAY_ENTERPRISE || config.mServiceDataLength != serviceLen ||
+           memcmp(config.mServiceData, MESH_GATEWAY_SERVICE_DATA, serviceLen) != 0)
+        {
+            continue;
+        }
+
+        if(pServer->mServerDataLength >= MESH_GATEWAY_SERVER_DATA_LEN)
+        {
+            memcpy(pAddr->mFields.m8, pServer->mServerData, OT_IP6_ADDRESS_SIZE);
+            *pPort = (uint16_t)((pServer->mServerData[OT_IP6_ADDRESS_SIZE] << 8) |
+                                pServer->mServerData[OT_IP6_ADDRESS_SIZE + 1]);
+        }
+        else
+        {
+            MeshGateway_RlocAddress(pServer->mRloc16, pAddr);
+            *pPort = MESH_COAP_PORT;
+        }
+        return true;
+    }
+    return false;
+}
+
+#if MESH_GATEWAY_DNSSD
+static void MeshGateway_BrowseCallback(otError aError, const otDnsBrowseResponse* aResponse, void* aContext)
+{
+    char             label[OT_DNS_MAX_LABEL_SIZE];
+    char             hostName[OT_DNS_MAX_NAME_SIZE];
+    otDnsServiceInfo info;
+    uint16_t         i;
+
+    (void)aContext;
+    sBrowsing = false;
+
+    for(i = 0; aError == OT_ERROR_NONE &&
+               otDnsBrowseResponseGetServiceInstance(aResponse, i, label, sizeof(label)) == OT_ERROR_NONE;
+        i++)
+    {
+        memset(&info, 0, sizeof(info));
+        info.mHostNameBuffer     = hostName;
+        info.mHostNameBufferSize = sizeof(hostName);
+
+        /* Only answers that carry the host address: no second query */
+        if(otDnsBrowseResponseGetServiceInfo(aResponse, label, &info) == OT_ERROR_NONE &&
+           !otIp6IsAddressUnspecified(&info.mHostAddress))
+        {
+            if(sOnResult != NULL)
+            {
+                sOnResult(&info.mHostAddress, info.mPort, MeshGateway_DnsSd, info.mTtl * 1000UL);
+            }
+            return;
+        }
+    }
+
+    if(sOnResult != NULL)
+    {
+        sOnResult(NULL, 0, MeshGateway_DnsSd, 0);
+    }
+}
+#endif
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshGateway_Init(otInstance* pInstance, MeshGateway_Handler_t onResult)
+{
+    sInstance = pInstance;
+    sOnResult = onResult;
+}
+
+void MeshGateway_Lookup(void)
+{
+    otIp6Address addr;
+    uint16_t     port;
+
+    if(sInstance == NULL || sOnResult == NULL)
+    {
+        return;
+    }
+
+    if(MeshGateway_FindService(&addr, &port))
+    {
+        sOnResult(&addr, port, MeshGateway_NetData, 0);
+        return;
+    }
+    sOnResult(NULL, 0, MeshGateway_NetData, 0);
+
+#if MESH_GATEWAY_DNSSD
+    if(!sBrowsing)
+    {
+        otError err = otDnsClientBrowse(sInstance, MESH_GATEWAY_DNSSD_SERVICE, MeshGateway_BrowseCallback, NULL,
+                                        NULL);
+
+        sBrowsing = (err == OT_ERROR_NONE);
+        if(err != OT_ERROR_NONE)
+        {
+            GP_LOG_SYSTEM_PRINTF("[GW] DNS-SD browse failed: %d", 0, (int)err);
+        }
+    }
+#endif
+}
+
+const char* MeshGateway_SourceName(MeshGateway_Source_t source)
+{
+    switch(source)
+    {
+        case MeshGateway_Announce:
+            return "announce";
+        case MeshGateway_DnsSd:
+            return "dns-sd";
+        case MeshGateway_NetData:
+            return "netdata";
+        default:
+            return "none";
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshGateway.h"
+ *
+ * Gateway discovery: find the border router's event sink so events can be
+ * sent to it by unicast instead of flooding the mesh.
+ *
+ *   - Thread Network Data: the gateway registers a service entry with
+ *     enterprise number MESH_GATEWAY_ENTERPRISE and service data
+ *     MESH_GATEWAY_SERVICE_DATA (mesh_listener.py does this with ot-ctl).
+ *     The server data is the sink's IPv6 address (16 bytes) and CoAP port
+ *     (BE16); if it is empty, the server's RLOC address and MESH_COAP_PORT
+ *     are used.  Every router and full-network-data node has the entry
+ *     locally, so the lookup costs no airtime, and the entry disappears
+ *     when the border router leaves.
+ *   - DNS-SD (MESH_GATEWAY_DNSSD=1): a browse for MESH_GATEWAY_DNSSD_SERVICE
+ *     through the border router's discovery proxy, for when no service
+ *     entry is found.  Needs an OpenThread library built with the DNS
+ *     client (OPENTHREAD_CONFIG_DNS_CLIENT_ENABLE).
+ *
+ * Sleepy and minimal end devices keep only stable Network Data, so the
+ * service entry is registered as stable.
+ *
+ * Results go to the handler given to MeshGateway_Init(): in the calling
+ * context for the Network Data lookup, in the OpenThread context for a
+ * DNS-SD response.
+ */
+
+#ifndef _MESH_GATEWAY_H_
+#define _MESH_GATEWAY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Network Data service entry */
+#define MESH_GATEWAY_ENTERPRISE        44970
+#define MESH_GATEWAY_SERVICE_DATA      "qmev"
+#define MESH_GATEWAY_SERVER_DATA_LEN   (OT_IP6_ADDRESS_SIZE + 2)
+
+/** DNS-SD browse, 1 = enabled (needs the OpenThread DNS client) */
+#ifndef MESH_GATEWAY_DNSSD
+#define MESH_GATEWAY_DNSSD             0
+#endif
+#define MESH_GATEWAY_DNSSD_SERVICE     "_meshevt._udp.default.service.arpa."
+
+/** How the gateway was found, lowest precedence first */
+typedef enum
+{
+    MeshGateway_None     = 0,
+    MeshGateway_Announce = 1,  /**< POST /gw multicast from the gateway (MeshCoap.h) */
+    MeshGateway_DnsSd    = 2,  /**< DNS-SD browse */
+    MeshGateway_NetData  = 3,  /**< Thread Network Data service entry */
+} MeshGateway_Source_t;
+
+/** Lookup result.  @p pAddr is NULL if @p source found no gateway; @p ttlMs
+ *  is how long the answer holds, 0 = until the next lookup says otherwise. */
+typedef void (*MeshGateway_Handler_t)(const otIp6Address* pAddr, uint16_t port, MeshGateway_Source_t source,
+                                      uint32_t ttlMs);
+
+/** @brief Set the result handler. */
+void MeshGateway_Init(otInstance* pInstance, MeshGateway_Handler_t onResult);
+
+/** @brief Look the gateway up in the Network Data now, and start a DNS-SD
+ *  browse if there is no entry (MESH_GATEWAY_DNSSD).  Call on attach, on
+ *  Network Data changes and while no gateway is known. */
+void MeshGateway_Lookup(void);
+
+/** @return Printable name of a source, for logs */
+const char* MeshGateway_SourceName(MeshGateway_Source_t source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_GATEWAY_H_ */
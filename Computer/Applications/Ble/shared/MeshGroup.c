@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshGroup.c"
+ *
+ * Zone and device-class multicast groups.
+ */
+
+#include "MeshGroup.h"
+
+#include <string.h>
+
+#include "gpLog.h"
+
+#include <openthread/platform/settings.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* House group and zone group */
+#define MESH_GROUP_MAX_SUBSCRIBED  2
+
+static otInstance*        sInstance    = NULL;
+static uint8_t            sOwnClass    = MeshGroup_None;
+static uint8_t            sTargetClass = MeshGroup_None;
+static MeshGroup_Config_t sConfig;
+
+static otIp6Address       sSubscribed[MESH_GROUP_MAX_SUBSCRIBED];
+static uint8_t            sSubscribedCount = 0;
+static otIp6Address       sTarget;
+
+static bool MeshGroup_IsValid(const uint8_t* pValue, uint16_t len)
+{
+    return len == MESH_GROUP_CONFIG_LEN && (pValue[2] & (uint8_t)~MESH_GROUP_LISTEN_ALL) == 0;
+}
+
+static void MeshGroup_Subscribe(uint8_t zone)
+{
+    char    addr[OT_IP6_ADDRESS_STRING_SIZE];
+    otError err;
+
+    MeshGroup_Address((MeshGroup_Class_t)sOwnClass, zone, &sSubscribed[sSubscribedCount]);
+    otIp6AddressToString(&sSubscribed[sSubscribedCount], addr, sizeof(addr));
+
+    err = otIp6SubscribeMulticastAddress(sInstance, &sSubscribed[sSubscribedCount]);
+    if(err != OT_ERROR_NONE && err != OT_ERROR_ALREADY)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Group] Subscribe %s failed: %d", 0, addr, (int)err);
+        return;
+    }
+    GP_LOG_SYSTEM_PRINTF("[Group] Listening on %s", 0, addr);
+    sSubscribedCount++;
+}
+
+/* Leave the old groups, join the new ones and set the target */
+static void MeshGroup_Apply(void)
+{
+    char    addr[OT_IP6_ADDRESS_STRING_SIZE];
+    uint8_t i;
+
+    for(i = 0; i < sSubscribedCount; i++)
+    {
+        otIp6UnsubscribeMulticastAddress(sInstance, &sSubscribed[i]);
+    }
+    sSubscribedCount = 0;
+
+    if(sOwnClass != MeshGroup_None)
+    {
+        if(sConfig.listen & MESH_GROUP_LISTEN_HOUSE)
+        {
+            MeshGroup_Subscribe(MESH_GROUP_ZONE_HOUSE);
+        }
+        if((sConfig.listen & MESH_GROUP_LISTEN_ZONE) && sConfig.zone != MESH_GROUP_ZONE_HOUSE)
+        {
+            MeshGroup_Subscribe(sConfig.zone);
+        }
+    }
+
+    if(sTargetClass != MeshGroup_None)
+    {
+        MeshGroup_Address((MeshGroup_Class_t)sTargetClass, sConfig.targetZone, &sTarget);
+        otIp6AddressToString(&sTarget, addr, sizeof(addr));
+        GP_LOG_SYSTEM_PRINTF("[Group] Zone %u, events to %s", 0, sConfig.zone, addr);
+    }
+}
+
+void MeshGroup_Init(otInstance* pInstance, MeshGroup_Class_t ownClass, MeshGroup_Class_t targetClass,
+                    uint8_t defaultListen)
+{
+    uint8_t  stored[MESH_GROUP_CONFIG_LEN];
+    uint16_t len = sizeof(stored);
+
+    sInstance    = pInstance;
+    sOwnClass    = (uint8_t)ownClass;
+    sTargetClass = (uint8_t)targetClass;
+
+    memset(&sConfig, 0, sizeof(sConfig));
+    sConfig.listen = defaultListen & MESH_GROUP_LISTEN_ALL;
+
+    if(otPlatSettingsGet(sInstance, MESH_GROUP_SETTINGS_KEY, 0, stored, &len) == OT_ERROR_NONE &&
+       MeshGroup_IsValid(stored, len))
+    {
+        sConfig.zone       = stored[0];
+        sConfig.targetZone = stored[1];
+        sConfig.listen     = stored[2];
+    }
+
+    MeshGroup_Apply();
+}
+
+otError MeshGroup_Set(const uint8_t* pValue, uint16_t len)
+{
+    otError err;
+
+    if(sInstance == NULL)
+    {
+        return OT_ERROR_INVALID_STATE;
+    }
+    if(!MeshGroup_IsValid(pValue, len))
+    {
+        return OT_ERROR_INVALID_ARGS;
+    }
+
+    sConfig.zone       = pValue[0];
+    sConfig.targetZone = pValue[1];
+    sConfig.listen     = pValue[2];
+    MeshGroup_Apply();
+
+    err = otPlatSettingsSet(sInstance, MESH_GROUP_SETTINGS_KEY, pValue, MESH_GROUP_CONFIG_LEN);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Group] Not stored: %d", 0, (int)err);
+    }
+    return err;
+}
+
+void MeshGroup_Get(uint8_t* pValue)
+{
+    pValue[0] = sConfig.zone;
+    pValue[1] = sConfig.targetZone;
+    pValue[2] = sConfig.listen;
+}
+
+const otIp6Address* MeshGroup_Target(void)
+{
+    return (sTargetClass != MeshGroup_None) ? &sTarget : NULL;
+}
+
+void MeshGroup_Address(MeshGroup_Class_t groupClass, uint8_t zone, otIp6Address* pAddr)
+{
+    memset(pAddr, 0, sizeof(*pAddr));
+    pAddr->mFields.m8[0]  = 0xFF;
+    pAddr->mFields.m8[1]  = 0x03;
+    pAddr->mFields.m8[11] = MESH_GROUP_PREFIX;
+    pAddr->mFields.m8[13] = (uint8_t)groupClass;
+    pAddr->mFields.m8[15] = zone;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshGroup.h"
+ *
+ * Zone and device-class multicast groups, so that events reach only the
+ * nodes that act on them instead of every node on ff03::1.
+ *
+ * A group is a realm-local address ff03::dc:<class>:<zone>:
+ *   class : what its members do with events (MeshGroup_Class_t)
+ *   zone  : 1..255 for a room or zone, 0 for the whole house
+ *
+ * A node subscribes (otIp6SubscribeMulticastAddress) to the house group of
+ * its own class and to the group of its class in its zone.  It sends its
+ * peer events (MeshCoap_Publish with peers) to one target group only: the
+ * target class in the target zone.  A doorbell in the hall with target
+ * zone 0 rings every chime listening house-wide; with target zone 3 only
+ * the chimes listening on zone 3.  The house group does not get the zoned
+ * events, so a chime that must hear every doorbell is given their zone,
+ * or the doorbells target zone 0.
+ *
+ * A sleepy child only receives the multicast groups it has registered
+ * with its parent, so a battery node that subscribes to no group is never
+ * woken for traffic it would drop.  ff03::1 (all nodes) is left to
+ * gateway traffic.
+ *
+ * Membership is provisioned over BLE as MESH_GROUP_CONFIG_LEN bytes:
+ *   byte 0 : zone of this node, 0 = none
+ *   byte 1 : target zone of its peer events, 0 = whole house
+ *   byte 2 : listen flags, MESH_GROUP_LISTEN_*
+ * and stored in the OpenThread settings (NVM) under
+ * MESH_GROUP_SETTINGS_KEY; a factory reset clears it with the Thread
+ * credentials.
+ *
+ * The pre-built OpenThread library allows two external multicast
+ * subscriptions (OPENTHREAD_CONFIG_IP6_MAX_EXT_MCAST_ADDRS), hence one
+ * zone per node.
+ *
+ * Threading: call everything from the application task.
+ */
+
+#ifndef _MESH_GROUP_H_
+#define _MESH_GROUP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Group address: ff03::dc:<class>:<zone> */
+#define MESH_GROUP_PREFIX           0xDC
+
+/** Whole-house zone */
+#define MESH_GROUP_ZONE_HOUSE       0
+
+/** Listen flags (byte 2): groups of the node's own class it subscribes to */
+#define MESH_GROUP_LISTEN_HOUSE     0x01  /**< ff03::dc:<class>:0, events sent to zone 0 only */
+#define MESH_GROUP_LISTEN_ZONE      0x02  /**< ff03::dc:<class>:<zone>, if the node has a zone */
+#define MESH_GROUP_LISTEN_ALL       (MESH_GROUP_LISTEN_HOUSE | MESH_GROUP_LISTEN_ZONE)
+
+/** Provisioned configuration: zone, target zone, listen flags */
+#define MESH_GROUP_CONFIG_LEN       3
+
+/** OpenThread settings key (vendor range, 0x8000 and up) */
+#define MESH_GROUP_SETTINGS_KEY     0x8001
+
+typedef enum
+{
+    MeshGroup_None   = 0,  /**< No group: sends no peer events */
+    MeshGroup_Chime  = 1,  /**< Sound or show rings: speakers, doorbells */
+    MeshGroup_Motion = 2,  /**< Act on motion events: motion detectors */
+} MeshGroup_Class_t;
+
+typedef struct
+{
+    uint8_t zone;         /**< Zone of this node, 0 = none */
+    uint8_t targetZone;   /**< Zone of the target group, 0 = whole house */
+    uint8_t listen;       /**< MESH_GROUP_LISTEN_* */
+} MeshGroup_Config_t;
+
+/** @brief Load the stored configuration (else zone 0, @p defaultListen) and
+ *  subscribe.  Call once the OpenThread instance exists.
+ *  @param ownClass    Class whose groups this node subscribes to
+ *  @param targetClass Class its peer events are sent to, MeshGroup_None if it sends none */
+void MeshGroup_Init(otInstance* pInstance, MeshGroup_Class_t ownClass, MeshGroup_Class_t targetClass,
+                    uint8_t defaultListen);
+
+/** @brief Apply and store a configuration written over BLE.
+ *  @return OT_ERROR_INVALID_ARGS if it is not MESH_GROUP_CONFIG_LEN bytes
+ *          or has unknown listen flags; else the result of storing it. */
+otError MeshGroup_Set(const uint8_t* pValue, uint16_t len);
+
+/** @brief Current configuration as MESH_GROUP_CONFIG_LEN bytes. */
+void MeshGroup_Get(uint8_t* pValue);
+
+/** @brief Destination of peer events, NULL if the node has no target class. */
+const otIp6Address* MeshGroup_Target(void);
+
+/** @brief Address of the group of @p groupClass in @p zone. */
+void MeshGroup_Address(MeshGroup_Class_t groupClass, uint8_t zone, otIp6Address* pAddr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_GROUP_H_ */
@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshJoiner.c"
+ *
+ * MeshCoP joiner: PSKd, attempts and retries.  The state only changes in
+ * the application task.
+ */
+
+#include "MeshJoiner.h"
+
+#include <string.h>
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/crypto.h>
+#include <openthread/dataset.h>
+#include <openthread/ip6.h>
+#include <openthread/joiner.h>
+#include <openthread/link.h>
+#include <openthread/platform/settings.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* PSKd symbols: 0-9, A-Z without I, O, Q, Z; one per 5 bits */
+static const char sAlphabet[] = "0123456789ABCDEFGHJKLMNPRSTUVWXY";
+
+static otInstance*               sInstance = NULL;
+static const char*               sModel    = NULL;
+static MeshJoiner_Notify_t       sNotify   = NULL;
+static MeshJoiner_StateHandler_t sOnState  = NULL;
+
+static char                      sPskd[MESH_JOINER_PSKD_MAX_LEN + 1];
+static uint8_t                   sPskdSource = MESH_JOINER_PSKD_NONE;
+
+static MeshJoiner_State_t        sState    = MeshJoiner_Idle;
+static otError                   sError    = OT_ERROR_NONE;
+static uint16_t                  sAttempts = 0;
+static bool                      sActive   = false;   /* Retry until joined or stopped */
+static uint32_t                  sRetryMs  = MESH_JOINER_RETRY_MS;
+
+/* Characteristic write waiting for MeshJoiner_Process() */
+static uint8_t                   sWrite[MESH_JOINER_WRITE_MAX];
+static uint8_t                   sWriteLen     = 0;
+static volatile bool             sWritePending = false;
+
+/* Joiner callback result and retry timer, for MeshJoiner_Process() */
+static volatile bool             sResultPending = false;
+static volatile otError          sResult        = OT_ERROR_NONE;
+static volatile bool             sRetryDue      = false;
+
+static StaticTimer_t             sTimerBuffer;
+static TimerHandle_t             sTimer = NULL;
+
+static void MeshJoiner_Notify(void)
+{
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshJoiner_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    sRetryDue = true;
+    MeshJoiner_Notify();
+}
+
+/* Joiner done (OpenThread context) */
+static void MeshJoiner_Callback(otError error, void* pContext)
+{
+    (void)pContext;
+
+    sResult        = error;
+    sResultPending = true;
+    MeshJoiner_Notify();
+}
+
+static bool MeshJoiner_IsValid(const uint8_t* pPskd, uint16_t len)
+{
+    uint16_t i;
+
+    if(len < MESH_JOINER_PSKD_MIN_LEN || len > MESH_JOINER_PSKD_MAX_LEN)
+    {
+        return false;
+    }
+    for(i = 0; i < len; i++)
+    {
+        if(pPskd[i] == '\0' || strchr(sAlphabet, pPskd[i]) == NULL)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* PSKd of this device from the installation secret, if the build has one */
+static bool MeshJoiner_Derive(void)
+{
+#ifdef MESH_JOINER_SECRET
+    static const char  secret[] = MESH_JOINER_SECRET;
+    otCryptoKey        key;
+    otCryptoSha256Hash hash;
+    otExtAddress       eui64;
+    uint8_t            i;
+
+    if(sizeof(secret) <= 1)
+    {
+        return false;
+    }
+
+    otLinkGetFactoryAssignedIeeeEui64(sInstance, &eui64);
+    key.mKey       = (const uint8_t*)secret;
+    key.mKeyLength = (uint16_t)(sizeof(secret) - 1);
+    key.mKeyRef    = 0;
+    otCryptoHmacSha256(&key, eui64.m8, sizeof(eui64.m8), &hash);
+
+    /* Symbol i is bits 5i..5i+4 of the hash, most significant bit first */
+    for(i = 0; i < MESH_JOINER_DERIVED_LEN; i++)
+    {
+        uint16_t bit  = (uint16_t)(i * 5);
+        uint16_t pair = (uint16_t)((hash.m8[bit / 8] << 8) | hash.m8[bit / 8 + 1]);
+
+        sPskd[i] = sAlphabet[(pair >> (11 - bit % 8)) & 0x1F];
+    }
+    sPskd[MESH_JOINER_DERIVED_LEN] = '\0';
+    return true;
+#else
+    return false;
+#endif
+}
+
+static void MeshJoiner_SetState(MeshJoiner_State_t state, otError error)
+{
+    sState = state;
+    sError = error;
+    if(sOnState != NULL)
+    {
+        sOnState(state, error);
+    }
+}
+
+/* Report a failed attempt and schedule the next one, unless stopped */
+static void MeshJoiner_Retry(otError error)
+{
+    MeshJoiner_SetState(MeshJoiner_Failed, error);
+    if(!sActive)
+    {
+        return;
+    }
+
+    GP_LOG_SYSTEM_PRINTF("[Joiner] Attempt %u failed: %d, retry in %lu s", 0, sAttempts, (int)error,
+                         (unsigned long)(sRetryMs / 1000));
+    if(sTimer != NULL)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(sRetryMs), 0);
+    }
+    sRetryMs = (sRetryMs >= MESH_JOINER_RETRY_MAX_MS / 2) ? MESH_JOINER_RETRY_MAX_MS : sRetryMs * 2;
+}
+
+static otError MeshJoiner_Attempt(void)
+{
+    otError err = otIp6SetEnabled(sInstance, true);
+
+    if(err == OT_ERROR_NONE)
+    {
+        err = otJoinerStart(sInstance, sPskd, NULL, MESH_JOINER_VENDOR_NAME, sModel, MESH_JOINER_SW_VERSION, NULL,
+                            MeshJoiner_Callback, NULL);
+    }
+    if(err != OT_ERROR_NONE)
+    {
+        MeshJoiner_Retry(err);
+        return err;
+    }
+
+    sAttempts++;
+    GP_LOG_SYSTEM_PRINTF("[Joiner] Attempt %u (%s PSKd)", 0, sAttempts,
+                         (sPskdSource == MESH_JOINER_PSKD_STORED) ? "stored" : "derived");
+    MeshJoiner_SetState(MeshJoiner_Joining, OT_ERROR_NONE);
+    return OT_ERROR_NONE;
+}
+
+static void MeshJoiner_Stop(void)
+{
+    sActive = false;
+    if(sTimer != NULL)
+    {
+        xTimerStop(sTimer, 0);
+    }
+    if(sState == MeshJoiner_Joining)
+    {
+        otJoinerStop(sInstance);
+    }
+    GP_LOG_SYSTEM_PRINTF("[Joiner] Stopped after %u attempts", 0, sAttempts);
+    MeshJoiner_SetState(MeshJoiner_Idle, OT_ERROR_NONE);
+}
+
+static void MeshJoiner_Store(const uint8_t* pPskd, uint8_t len)
+{
+    otError err;
+
+    memcpy(sPskd, pPskd, len);
+    sPskd[len]  = '\0';
+    sPskdSource = MESH_JOINER_PSKD_STORED;
+
+    err = otPlatSettingsSet(sInstance, MESH_JOINER_SETTINGS_KEY, pPskd, len);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Joiner] PSKd not stored: %d", 0, (int)err);
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshJoiner_Init(otInstance* pInstance, const char* pModel, MeshJoiner_Notify_t notify,
+                     MeshJoiner_StateHandler_t onState)
+{
+    uint16_t len = MESH_JOINER_PSKD_MAX_LEN;
+
+    sInstance = pInstance;
+    sModel    = pModel;
+    sNotify   = notify;
+    sOnState  = onState;
+
+    memset(sPskd, 0, sizeof(sPskd));
+    if(otPlatSettingsGet(pInstance, MESH_JOINER_SETTINGS_KEY, 0, (uint8_t*)sPskd, &len) == OT_ERROR_NONE &&
+       MeshJoiner_IsValid((const uint8_t*)sPskd, len))
+    {
+        sPskd[len]  = '\0';
+        sPskdSource = MESH_JOINER_PSKD_STORED;
+    }
+    else if(MeshJoiner_Derive())
+    {
+        sPskdSource = MESH_JOINER_PSKD_DERIVED;
+    }
+    else
+    {
+        sPskd[0]    = '\0';
+        sPskdSource = MESH_JOINER_PSKD_NONE;
+    }
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshJoiner", pdMS_TO_TICKS(MESH_JOINER_RETRY_MS), pdFALSE, NULL,
+                                    MeshJoiner_TimerCallback, &sTimerBuffer);
+    }
+}
+
+bool MeshJoiner_HasPskd(void)
+{
+    return sPskdSource != MESH_JOINER_PSKD_NONE;
+}
+
+otError MeshJoiner_Start(void)
+{
+    if(otDatasetIsCommissioned(sInstance))
+    {
+        GP_LOG_SYSTEM_PRINTF("[Joiner] Not started: credentials already present", 0);
+        return OT_ERROR_ALREADY;
+    }
+    if(!MeshJoiner_HasPskd())
+    {
+        GP_LOG_SYSTEM_PRINTF("[Joiner] Not started: no PSKd", 0);
+        return OT_ERROR_NOT_FOUND;
+    }
+    if(sState == MeshJoiner_Joining)
+    {
+        return OT_ERROR_NONE;
+    }
+
+    sActive  = true;
+    sRetryMs = MESH_JOINER_RETRY_MS;
+    return MeshJoiner_Attempt();
+}
+
+bool MeshJoiner_Write(const uint8_t* pValue, uint16_t len)
+{
+    if(len == 0 || len > MESH_JOINER_WRITE_MAX || pValue[0] > 0x01 || (pValue[0] == 0x00 && len != 1) ||
+       (len > 1 && !MeshJoiner_IsValid(&pValue[1], (uint16_t)(len - 1))))
+    {
+        return false;
+    }
+    if(sWritePending)
+    {
+        return false;
+    }
+
+    memcpy(sWrite, pValue, len);
+    sWriteLen     = (uint8_t)len;
+    sWritePending = true;
+    MeshJoiner_Notify();
+    return true;
+}
+
+void MeshJoiner_Process(void)
+{
+    if(sInstance == NULL)
+    {
+        return;
+    }
+
+    if(sWritePending)
+    {
+        if(sWrite[0] == 0x00)
+        {
+            MeshJoiner_Stop();
+        }
+        else
+        {
+            if(sWriteLen > 1)
+            {
+                MeshJoiner_Store(&sWrite[1], (uint8_t)(sWriteLen - 1));
+            }
+            (void)MeshJoiner_Start();
+        }
+        sWritePending = false;
+    }
+
+    if(sResultPending)
+    {
+        sResultPending = false;
+        if(sState == MeshJoiner_Joining)
+        {
+            if(sResult == OT_ERROR_NONE)
+            {
+                sActive = false;
+                GP_LOG_SYSTEM_PRINTF("[Joiner] Joined after %u attempts", 0, sAttempts);
+                MeshJoiner_SetState(MeshJoiner_Joined, OT_ERROR_NONE);
+            }
+            else
+            {
+                MeshJoiner_Retry(sResult);
+            }
+        }
+    }
+
+    if(sRetryDue)
+    {
+        sRetryDue = false;
+        if(sActive && sState == MeshJoiner_Failed)
+        {
+            (void)MeshJoiner_Attempt();
+        }
+    }
+}
+
+void MeshJoiner_GetInfo(uint8_t* pInfo)
+{
+    otExtAddress eui64;
+
+    otLinkGetFactoryAssignedIeeeEui64(sInstance, &eui64);
+    pInfo[0] = (uint8_t)sState;
+    pInfo[1] = (uint8_t)sError;
+    pInfo[2] = (uint8_t)(sAttempts >> 8);
+    pInfo[3] = (uint8_t)sAttempts;
+    pInfo[4] = sPskdSource;
+    memcpy(&pInfo[5], eui64.m8, sizeof(eui64.m8));
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshJoiner.h"
+ *
+ * Thread commissioning through the MeshCoP joiner (otJoinerStart).
+ *
+ * The Network Key and Dataset characteristics hand the credentials over
+ * BLE, one phone session per device.  With the joiner the node gets them
+ * from a commissioner on the Thread network instead (the border router:
+ * "ot-ctl commissioner joiner add <eui64> <pskd>"), over 802.15.4 and
+ * protected by DTLS with a per-device PSKd.  The commissioner admits many
+ * joiners at once, so a site of sensors is installed without a BLE
+ * session per device; BLE only starts the joiner and reports progress.
+ *
+ * The PSKd, 6..32 characters of 0-9 and A-Y without I, O and Q:
+ *
+ *   - written over BLE with the start command (e.g. from the device
+ *     label), kept in the OpenThread settings under MESH_JOINER_SETTINGS_KEY;
+ *   - else derived from the factory EUI-64 and the installation secret
+ *     (make ... MESH_JOINER_SECRET=...): the first MESH_JOINER_DERIVED_LEN
+ *     5-bit symbols of HMAC-SHA256(secret, EUI-64), in the PSKd alphabet.
+ *     The gateway tool (shared/gateway/mesh_joiner.py) computes the same
+ *     PSKd for every EUI-64 on the delivery list and registers them.
+ *
+ * A node without credentials that has a PSKd starts the joiner on its own
+ * at boot (MESH_JOINER_AUTOSTART).  A failed attempt (no commissioner yet,
+ * wrong PSKd) is retried after MESH_JOINER_RETRY_MS, doubling up to
+ * MESH_JOINER_RETRY_MAX_MS, until the node joins or is stopped.  On
+ * success the joiner has stored the Active Dataset; the application starts
+ * Thread from it, as after a Dataset write.
+ *
+ * Joiner characteristic (MeshJoiner_Write, at most MESH_JOINER_WRITE_MAX
+ * bytes):
+ *
+ *     0x01            start with the stored or derived PSKd
+ *     0x01 + PSKd     store the PSKd, then start
+ *     0x00            stop, no more retries
+ *
+ * Read-back (MESH_JOINER_INFO_LEN bytes): state, last error (otError),
+ * attempts (BE16), PSKd source (MESH_JOINER_PSKD_*), factory EUI-64, which
+ * is the joiner id to register on the commissioner.
+ *
+ * The OpenThread library must be built with the joiner
+ * (OPENTHREAD_CONFIG_JOINER_ENABLE).
+ *
+ * Threading: MeshJoiner_Write() runs in the BLE stack context, the joiner
+ * callback in the OpenThread context and the retry timer in the timer
+ * task; they only record the event and call the application's notify
+ * hook.  The application calls MeshJoiner_Start() and MeshJoiner_Process()
+ * from its own task.
+ */
+
+#ifndef _MESH_JOINER_H_
+#define _MESH_JOINER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** PSKd length limits (Thread specification), and the length of a derived PSKd */
+#define MESH_JOINER_PSKD_MIN_LEN    6
+#define MESH_JOINER_PSKD_MAX_LEN    32
+#define MESH_JOINER_DERIVED_LEN     8
+
+/** Stored PSKd */
+#define MESH_JOINER_SETTINGS_KEY    0x8004
+
+/** Largest write (command + PSKd), and the read-back length */
+#define MESH_JOINER_WRITE_MAX       (1 + MESH_JOINER_PSKD_MAX_LEN)
+#define MESH_JOINER_INFO_LEN        13
+
+/** Retry after a failed attempt, doubling up to the maximum */
+#define MESH_JOINER_RETRY_MS        30000
+#define MESH_JOINER_RETRY_MAX_MS    300000
+
+/** Start the joiner at boot when there are no credentials but a PSKd */
+#ifndef MESH_JOINER_AUTOSTART
+#define MESH_JOINER_AUTOSTART       1
+#endif
+
+/** Vendor information sent to the commissioner */
+#define MESH_JOINER_VENDOR_NAME     "Qorvo"
+#define MESH_JOINER_SW_VERSION      "1.0"
+
+/** PSKd source (read-back) */
+#define MESH_JOINER_PSKD_NONE       0
+#define MESH_JOINER_PSKD_STORED     1
+#define MESH_JOINER_PSKD_DERIVED    2
+
+typedef enum
+{
+    MeshJoiner_Idle    = 0,  /**< Not started, or stopped */
+    MeshJoiner_Joining = 1,  /**< Discovery and DTLS handshake with the commissioner */
+    MeshJoiner_Joined  = 2,  /**< Credentials received and stored */
+    MeshJoiner_Failed  = 3,  /**< Last attempt failed; a retry is pending unless stopped */
+} MeshJoiner_State_t;
+
+/** Called from the BLE stack, OpenThread or timer context; post to the app task. */
+typedef void (*MeshJoiner_Notify_t)(void);
+
+/** Called in the application task on every state change.
+ *  @param error OT_ERROR_NONE, or why the attempt failed: OT_ERROR_NOT_FOUND
+ *               (no joiner router heard), OT_ERROR_SECURITY (PSKd refused),
+ *               OT_ERROR_RESPONSE_TIMEOUT, or the error of otJoinerStart() */
+typedef void (*MeshJoiner_StateHandler_t)(MeshJoiner_State_t state, otError error);
+
+/** @brief Load the PSKd and create the retry timer.
+ *  @param pModel Vendor model string sent to the commissioner */
+void MeshJoiner_Init(otInstance* pInstance, const char* pModel, MeshJoiner_Notify_t notify,
+                     MeshJoiner_StateHandler_t onState);
+
+/** @return true if a PSKd is stored or can be derived */
+bool MeshJoiner_HasPskd(void);
+
+/** @brief Enable IPv6 and start the joiner (automatic retries on failure).
+ *  @return OT_ERROR_ALREADY if the node has credentials, OT_ERROR_NOT_FOUND
+ *          without a PSKd, else the error of otJoinerStart() */
+otError MeshJoiner_Start(void);
+
+/** @brief Take a Joiner characteristic write (GATT write callback).
+ *  @return false if malformed or a write is still being applied */
+bool MeshJoiner_Write(const uint8_t* pValue, uint16_t len);
+
+/** @brief Apply a write, report a joiner result, run a due retry.
+ *  Call from the app task on the notify hook. */
+void MeshJoiner_Process(void);
+
+/** @brief Read-back for the Joiner characteristic (MESH_JOINER_INFO_LEN bytes). */
+void MeshJoiner_GetInfo(uint8_t* pInfo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_JOINER_H_ */
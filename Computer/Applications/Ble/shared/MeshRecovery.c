@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshRecovery.c"
+ *
+ * Outage metrics and attach restarts.  Everything but sDatasetMs runs in
+ * the application task; the OpenThread context only stamps dataset
+ * changes.
+ */
+
+#include "MeshRecovery.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "MeshCoap.h"
+#include "MeshDiag.h"
+#include "MeshRole.h"
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/random_noncrypto.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* Changes that take the node off its network on purpose */
+#define MESH_RECOVERY_DATASET_FLAGS \
+    (OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_NETWORK_KEY | OT_CHANGED_THREAD_CHANNEL | OT_CHANGED_THREAD_PANID)
+
+/* Upper bounds of the histogram buckets but the last, s */
+static const uint16_t sBucketS[MESH_RECOVERY_BUCKETS - 1] = {2, 5, 15, 60, 300};
+
+static otInstance*           sInstance = NULL;
+static MeshRecovery_Notify_t sNotify   = NULL;
+
+static MeshRecovery_Stats_t  sStats;
+static otDeviceRole          sRole      = OT_DEVICE_ROLE_DISABLED;
+static bool                  sDetached  = false;
+static uint32_t              sStartMs   = 0;
+static uint32_t              sBackoffMs = MESH_RECOVERY_ATTACH_MIN_MS;
+static uint16_t              sRestarts  = 0;
+static uint32_t              sRestartMs = 0;
+/* MLE attach attempts when the timer was armed: unchanged = OpenThread idle in its backoff */
+static uint16_t              sAttempts0 = 0;
+
+/* MeshCoap counters at the start of the outage */
+static uint32_t              sDeferred0 = 0;
+static uint32_t              sExpired0  = 0;
+
+static volatile bool         sDatasetChanged = false;
+static volatile uint32_t     sDatasetMs      = 0;
+
+static StaticTimer_t         sTimerBuffer;
+static TimerHandle_t         sTimer = NULL;
+
+static uint32_t MeshRecovery_NowMs(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+static bool MeshRecovery_IsAttached(otDeviceRole role)
+{
+    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+}
+
+static void MeshRecovery_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+/* Wait sBackoffMs +-MESH_RECOVERY_JITTER_PCT */
+static void MeshRecovery_Arm(void)
+{
+    uint32_t spreadMs = sBackoffMs * MESH_RECOVERY_JITTER_PCT / 100;
+    uint32_t waitMs   = sBackoffMs - spreadMs + otRandomNonCryptoGetUint32() % (2 * spreadMs + 1);
+
+    sAttempts0 = otThreadGetMleCounters(sInstance)->mAttachAttempts;
+    if(sTimer != NULL)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(waitMs), 0);
+    }
+}
+
+static MeshRecovery_Reason_t MeshRecovery_Reason(uint32_t nowMs)
+{
+    if(sDatasetChanged && (nowMs - sDatasetMs) < MESH_RECOVERY_CAUSE_MS)
+    {
+        return MeshRecovery_Dataset;
+    }
+    return (sRole == OT_DEVICE_ROLE_CHILD) ? MeshRecovery_ParentLost : MeshRecovery_RouterLost;
+}
+
+static void MeshRecovery_Start(uint32_t nowMs)
+{
+    MeshCoap_Stats_t coap;
+
+    MeshCoap_GetStats(&coap);
+    sDeferred0 = coap.deferred;
+    sExpired0  = coap.expired;
+
+    sDetached         = true;
+    sStartMs          = nowMs;
+    sRestarts         = 0;
+    sStats.lastReason = (uint8_t)MeshRecovery_Reason(nowMs);
+    sStats.reasons[sStats.lastReason]++;
+
+    GP_LOG_SYSTEM_PRINTF("[Recovery] Detached from role %d (reason %u)", 0, (int)sRole, sStats.lastReason);
+
+    sBackoffMs = MESH_RECOVERY_ATTACH_MIN_MS;
+    MeshRecovery_Arm();
+}
+
+static void MeshRecovery_End(uint32_t nowMs, otDeviceRole role)
+{
+    MeshCoap_Stats_t coap;
+    uint32_t         outageMs = nowMs - sStartMs;
+    uint16_t         deferred;
+    uint16_t         expired;
+    uint8_t          bucket;
+
+    if(sTimer != NULL)
+    {
+        xTimerStop(sTimer, 0);
+    }
+    sDetached = false;
+
+    for(bucket = 0; bucket < MESH_RECOVERY_BUCKETS - 1; bucket++)
+    {
+        if(outageMs < (uint32_t)sBucketS[bucket] * 1000)
+        {
+            break;
+        }
+    }
+    sStats.outages[bucket]++;
+    sStats.lastMs = outageMs;
+    if(outageMs > sStats.longestMs)
+    {
+        sStats.longestMs = outageMs;
+    }
+
+    MeshCoap_GetStats(&coap);
+    deferred = (uint16_t)(coap.deferred - sDeferred0);
+    expired  = (uint16_t)(coap.expired - sExpired0);
+    sStats.deferred += deferred;
+    sStats.expired += expired;
+
+    GP_LOG_SYSTEM_PRINTF("[Recovery] Reattached as %d after %lu ms (reason %u): restarts:%u deferred:%u expired:%u",
+                         0, (int)role, (unsigned long)outageMs, sStats.lastReason, sRestarts, deferred, expired);
+    if(sRestarts > 0)
+    {
+        /* Attach time after the last restart: a few seconds when it took effect */
+        GP_LOG_SYSTEM_PRINTF("[Recovery] Last restart %lu ms before the reattach", 0,
+                             (unsigned long)(nowMs - sRestartMs));
+    }
+    MeshDiag_Request();
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshRecovery_Init(otInstance* pInstance, MeshRecovery_Notify_t notify)
+{
+    sInstance = pInstance;
+    sNotify   = notify;
+    memset(&sStats, 0, sizeof(sStats));
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshRecov", pdMS_TO_TICKS(MESH_RECOVERY_ATTACH_MIN_MS), pdFALSE, NULL,
+                                    MeshRecovery_TimerCallback, &sTimerBuffer);
+    }
+}
+
+void MeshRecovery_StateChanged(uint32_t flags)
+{
+    if(flags & MESH_RECOVERY_DATASET_FLAGS)
+    {
+        sDatasetMs      = MeshRecovery_NowMs();
+        sDatasetChanged = true;
+    }
+}
+
+void MeshRecovery_RoleChanged(otDeviceRole role)
+{
+    uint32_t nowMs = MeshRecovery_NowMs();
+
+    if(role == sRole)
+    {
+        return;
+    }
+
+    if(!sDetached && role == OT_DEVICE_ROLE_DETACHED && MeshRecovery_IsAttached(sRole))
+    {
+        MeshRecovery_Start(nowMs);
+    }
+    else if(sDetached && MeshRecovery_IsAttached(role))
+    {
+        MeshRecovery_End(nowMs, role);
+    }
+    sRole = role;
+}
+
+void MeshRecovery_Process(void)
+{
+    otError err;
+
+    if(!sDetached || otThreadGetDeviceRole(sInstance) != OT_DEVICE_ROLE_DETACHED)
+    {
+        return;
+    }
+
+    /* A router-eligible node forms its own partition instead; leave it be */
+    if(MeshRole_IsRouterEligible())
+    {
+        return;
+    }
+
+    /* OpenThread tried to attach since the timer was armed: it may be mid-attach, leave it another round */
+    if(otThreadGetMleCounters(sInstance)->mAttachAttempts != sAttempts0)
+    {
+        MeshRecovery_Arm();
+        return;
+    }
+
+    /* otThreadBecomeChild() is refused (busy) during the MLE attach backoff,
+     * so stop and start MLE: the start attaches at once, with the backoff reset */
+    err = otThreadSetEnabled(sInstance, false);
+    if(err == OT_ERROR_NONE)
+    {
+        err = otThreadSetEnabled(sInstance, true);
+    }
+    if(err == OT_ERROR_NONE && otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_DETACHED)
+    {
+        sRestarts++;
+        sRestartMs = MeshRecovery_NowMs();
+        sStats.attachRestarts++;
+        GP_LOG_SYSTEM_PRINTF("[Recovery] Attach restart %u, %lu ms detached", 0, sRestarts,
+                             (unsigned long)(sRestartMs - sStartMs));
+        sBackoffMs = (sBackoffMs >= MESH_RECOVERY_ATTACH_MAX_MS / 2) ? MESH_RECOVERY_ATTACH_MAX_MS : sBackoffMs * 2;
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[Recovery] Attach restart failed: %d, role %d", 0, (int)err,
+                             (int)otThreadGetDeviceRole(sInstance));
+    }
+    MeshRecovery_Arm();
+}
+
+void MeshRecovery_GetStats(MeshRecovery_Stats_t* pStats)
+{
+    *pStats           = sStats;
+    pStats->currentMs = sDetached ? (MeshRecovery_NowMs() - sStartMs) : 0;
+}
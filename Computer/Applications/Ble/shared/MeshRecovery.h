@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshRecovery.h"
+ *
+ * Detach / reattach recovery: outage metrics and a bounded attach backoff.
+ *
+ * When a node loses its parent or its partition (a gateway or border
+ * router reboot takes out every child of it at once), OpenThread retries
+ * the attach with an exponential backoff that grows up to its build-time
+ * maximum (OPENTHREAD_CONFIG_MLE_ATTACH_BACKOFF_MAXIMUM_INTERVAL, minutes
+ * in the default configuration).  The OpenThread library is pre-built, so
+ * this module bounds the wait from the outside: while the node is
+ * detached, it checks every MESH_RECOVERY_ATTACH_MIN_MS, doubling up to
+ * MESH_RECOVERY_ATTACH_MAX_MS.  If OpenThread made no attach attempt since
+ * the last check (MLE counter mAttachAttempts unchanged), it is idle in its
+ * backoff and MLE is restarted (otThreadSetEnabled false, then true): the
+ * start attaches at once with the backoff reset; otThreadBecomeChild()
+ * would be refused as busy during the backoff.  Otherwise an attach is
+ * under way or just failed on its own schedule, and is left alone.  Each wait is jittered by
+ * +-MESH_RECOVERY_JITTER_PCT so the children of a rebooted router do not
+ * all send their parent requests at the same moment.
+ *
+ * Only nodes that are not router eligible (MeshRole.h) are restarted.  A
+ * router-eligible node that finds no parent forms its own partition within
+ * seconds, which ends the outage here; OpenThread merges the partitions
+ * once the network is back.
+ *
+ * Every outage, from leaving an attached role to the next attach, is
+ * measured and counted:
+ *
+ *   - its duration, in a histogram: below 2 s, 5 s, 15 s, 1 min, 5 min,
+ *     and longer; plus the last and the longest outage
+ *   - its reason: the parent was lost (a child), the partition was lost
+ *     (a router or leader), or the dataset changed with the detach
+ *     (new credentials, channel or PAN ID)
+ *   - the events published while detached (MeshCoap.h holds them) and
+ *     the held multicasts given up before the reattach
+ *   - the attach restarts made by this module; the reattach log gives the
+ *     time from the last restart, which shows whether it took effect
+ *
+ * Each reattach is logged and requests an early diagnostics snapshot,
+ * which carries the metrics in its DIAG_RECOVERY record (MeshDiag.h), so
+ * the gateway sees the outage and its cost as soon as the node is back.
+ * The restarts next to the histogram show what the backoff settings buy.
+ *
+ * Threading: the timer and MeshRecovery_StateChanged() only record flags
+ * and call the application's notify hook; the application calls
+ * MeshRecovery_RoleChanged() and MeshRecovery_Process() from its own task.
+ */
+
+#ifndef _MESH_RECOVERY_H_
+#define _MESH_RECOVERY_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Attach restart backoff while detached: first wait, and the cap of the doubling */
+#ifndef MESH_RECOVERY_ATTACH_MIN_MS
+#define MESH_RECOVERY_ATTACH_MIN_MS 5000
+#endif
+#ifndef MESH_RECOVERY_ATTACH_MAX_MS
+#define MESH_RECOVERY_ATTACH_MAX_MS 30000
+#endif
+#define MESH_RECOVERY_JITTER_PCT    25
+
+/** A dataset change this close before the detach is taken as its reason */
+#define MESH_RECOVERY_CAUSE_MS      2000
+
+/** Outage histogram buckets */
+#define MESH_RECOVERY_BUCKETS       6
+
+typedef enum
+{
+    MeshRecovery_None       = 0,  /**< No outage yet */
+    MeshRecovery_ParentLost = 1,  /**< A child lost its parent */
+    MeshRecovery_RouterLost = 2,  /**< A router or leader lost its partition */
+    MeshRecovery_Dataset    = 3,  /**< Credentials, channel or PAN ID changed */
+} MeshRecovery_Reason_t;
+
+typedef struct
+{
+    uint8_t  lastReason;                        /**< MeshRecovery_Reason_t of the last detach */
+    uint16_t outages[MESH_RECOVERY_BUCKETS];    /**< Finished outages per duration bucket */
+    uint32_t lastMs;                            /**< Last finished outage */
+    uint32_t longestMs;                         /**< Longest finished outage */
+    uint32_t currentMs;                         /**< Outage running now, 0 = attached */
+    uint16_t reasons[4];                        /**< Detaches per MeshRecovery_Reason_t */
+    uint16_t deferred;                          /**< Events published while detached */
+    uint16_t expired;                           /**< Held multicasts given up during outages */
+    uint16_t attachRestarts;                    /**< MLE restarts by this module */
+} MeshRecovery_Stats_t;
+
+/** Called from the timer task or the OpenThread context; post to the app task. */
+typedef void (*MeshRecovery_Notify_t)(void);
+
+/** @brief Create the backoff timer.  Call once, after MeshCoap_Init(). */
+void MeshRecovery_Init(otInstance* pInstance, MeshRecovery_Notify_t notify);
+
+/** @brief Note dataset changes (detach reason).
+ *  Call from the OpenThread state-changed callback with its flags. */
+void MeshRecovery_StateChanged(uint32_t flags);
+
+/** @brief Start or end an outage (call on every role change). */
+void MeshRecovery_RoleChanged(otDeviceRole role);
+
+/** @brief Restart the attach if still detached and not router eligible.
+ *  Call from the app task on the notify hook. */
+void MeshRecovery_Process(void);
+
+/** @brief Outage metrics up to now. */
+void MeshRecovery_GetStats(MeshRecovery_Stats_t* pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_RECOVERY_H_ */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshRole.c"
+ *
+ * Role policy and role churn counters.
+ */
+
+#include "MeshRole.h"
+
+#include <string.h>
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include <openthread/thread_ftd.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+static otInstance*      sInstance = NULL;
+static MeshRole_Stats_t sStats;
+static otDeviceRole     sRole     = OT_DEVICE_ROLE_DISABLED;
+static uint32_t         sSinceS   = 0;
+
+static const char* const sPolicyNames[] = {"router", "end device", "sleepy end device"};
+
+static uint32_t MeshRole_NowS(void)
+{
+    return (uint32_t)(xTaskGetTickCount() / configTICK_RATE_HZ);
+}
+
+static bool MeshRole_IsRouter(otDeviceRole role)
+{
+    return role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshRole_Init(otInstance* pInstance, MeshRole_Policy_t policy)
+{
+    otLinkModeConfig mode;
+    otError          err = OT_ERROR_NONE;
+
+    sInstance = pInstance;
+    memset(&sStats, 0, sizeof(sStats));
+    sStats.policy       = (uint8_t)policy;
+    sStats.leaderWeight = MESH_ROLE_LEADER_WEIGHT;
+    sSinceS             = MeshRole_NowS();
+
+    /* A sleepy end device gets its link mode from MeshSleepy_Init() */
+    if(policy != MeshRole_Sleepy)
+    {
+        memset(&mode, 0, sizeof(mode));
+        mode.mRxOnWhenIdle = true;
+        mode.mDeviceType   = (policy == MeshRole_Router);
+        mode.mNetworkData  = true;
+        err = otThreadSetLinkMode(pInstance, mode);
+    }
+    if(err == OT_ERROR_NONE)
+    {
+        err = otThreadSetRouterEligible(pInstance, policy == MeshRole_Router);
+    }
+    if(err == OT_ERROR_NONE && policy == MeshRole_Router)
+    {
+        otThreadSetLocalLeaderWeight(pInstance, MESH_ROLE_LEADER_WEIGHT);
+    }
+
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Role] Policy not applied: %d", 0, (int)err);
+        return;
+    }
+    GP_LOG_SYSTEM_PRINTF("[Role] Policy: %s, leader weight %u", 0, sPolicyNames[policy],
+                         (policy == MeshRole_Router) ? MESH_ROLE_LEADER_WEIGHT : 0);
+}
+
+void MeshRole_RoleChanged(otDeviceRole role)
+{
+    uint32_t nowS = MeshRole_NowS();
+    uint32_t ageS = nowS - sSinceS;
+
+    if(role == sRole)
+    {
+        return;
+    }
+
+    sStats.roleChanges++;
+    if(role == OT_DEVICE_ROLE_DETACHED && sRole != OT_DEVICE_ROLE_DISABLED)
+    {
+        sStats.detaches++;
+    }
+    if(sRole == OT_DEVICE_ROLE_CHILD && MeshRole_IsRouter(role))
+    {
+        sStats.routerUpgrades++;
+    }
+    if(MeshRole_IsRouter(sRole) && role == OT_DEVICE_ROLE_CHILD)
+    {
+        sStats.routerDowngrades++;
+    }
+    if(role == OT_DEVICE_ROLE_LEADER)
+    {
+        sStats.leaderTerms++;
+    }
+
+    GP_LOG_SYSTEM_PRINTF("[Role] %d -> %d after %lu s: changes:%u up:%u down:%u leader:%u detached:%u", 0,
+                         (int)sRole, (int)role, (unsigned long)ageS, sStats.roleChanges, sStats.routerUpgrades,
+                         sStats.routerDowngrades, sStats.leaderTerms, sStats.detaches);
+    if(sStats.policy != MeshRole_Router && MeshRole_IsRouter(role))
+    {
+        GP_LOG_SYSTEM_PRINTF("[Role] Policy violated: role %d", 0, (int)role);
+    }
+
+    sRole   = role;
+    sSinceS = nowS;
+}
+
+bool MeshRole_IsRouterEligible(void)
+{
+    return sStats.policy == MeshRole_Router;
+}
+
+void MeshRole_GetStats(MeshRole_Stats_t* pStats)
+{
+    *pStats          = sStats;
+    pStats->roleAgeS = MeshRole_NowS() - sSinceS;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshRole.h"
+ *
+ * Thread role policy per device class.
+ *
+ * All applications link the same FTD OpenThread library, so without a
+ * policy any node may become router or leader, battery sensors included.
+ * The policy is chosen at build time (MESH_ROLE_POLICY, MESH_SLEEPY):
+ *
+ *   MeshRole_Router     mains-powered nodes (doorbells, speaker): full
+ *                       Thread device, router eligible, receiver on
+ *   MeshRole_EndDevice  minimal end device with the receiver on (MED):
+ *                       never a router, reachable at once (microphone,
+ *                       motion sensors on USB power)
+ *   MeshRole_Sleepy     sleepy end device (SED), link mode and polling in
+ *                       MeshSleepy.h; used when built with MESH_SLEEPY=1
+ *
+ * A router-eligible node also gets a leader weight (MESH_ROLE_LEADER_WEIGHT,
+ * OpenThread default 64).  When partitions merge, the one with the
+ * highest leader weight wins, so the node next to the border router can
+ * be built with a higher weight to keep leadership, and the mesh time
+ * master (MeshTime.h), close to the gateway.
+ *
+ * Role churn is counted: role changes, child to router upgrades, router
+ * to child downgrades, terms as leader and detaches, and the time since
+ * the last change.  Each change is logged and the counters are reported
+ * in the DIAG_ROLE diagnostics record (MeshDiag.h).
+ *
+ * Threading: everything runs in the application task.
+ */
+
+#ifndef _MESH_ROLE_H_
+#define _MESH_ROLE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    MeshRole_Router    = 0,
+    MeshRole_EndDevice = 1,
+    MeshRole_Sleepy    = 2,
+} MeshRole_Policy_t;
+
+/** Build profile of the application (make ... MESH_ROLE_POLICY=1); MESH_SLEEPY=1 overrides it */
+#ifndef MESH_ROLE_POLICY
+#define MESH_ROLE_POLICY            MeshRole_Router
+#endif
+
+/** Leader weight of a router-eligible node (make ... MESH_ROLE_LEADER_WEIGHT=96) */
+#ifndef MESH_ROLE_LEADER_WEIGHT
+#define MESH_ROLE_LEADER_WEIGHT     64
+#endif
+
+typedef struct
+{
+    uint8_t  policy;            /**< MeshRole_Policy_t */
+    uint8_t  leaderWeight;
+    uint16_t roleChanges;       /**< Any role change while Thread runs */
+    uint16_t routerUpgrades;    /**< Child to router or leader */
+    uint16_t routerDowngrades;  /**< Router or leader to child */
+    uint16_t leaderTerms;       /**< Times this node became leader */
+    uint16_t detaches;          /**< Times this node lost its network */
+    uint32_t roleAgeS;          /**< Seconds in the current role */
+} MeshRole_Stats_t;
+
+/** @brief Apply the policy: link mode, router eligibility, leader weight.
+ *  Call before the Thread stack is enabled, and before MeshSleepy_Init(). */
+void MeshRole_Init(otInstance* pInstance, MeshRole_Policy_t policy);
+
+/** @brief Count a role change (call on every role change). */
+void MeshRole_RoleChanged(otDeviceRole role);
+
+/** @return true if the policy lets this node become a router */
+bool MeshRole_IsRouterEligible(void);
+
+/** @brief Churn counters up to now. */
+void MeshRole_GetStats(MeshRole_Stats_t* pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_ROLE_H_ */
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshSleepy.c"
+ *
+ * Sleepy End Device profile: link mode, poll periods and power accounting.
+ *
+ * OpenThread does the actual polling; this module only chooses the poll
+ * period and keeps track of which power state the node is in.  Every
+ * function is called from the application task, so no locking is needed.
+ *
+ * The duty cycle is an estimate: the receiver is counted as on for the
+ * whole time spent in MeshSleepy_PowerRxOn, and for a fixed window per
+ * data poll, transmitted frame and CSL sample in the sleepy states.
+ */
+
+#include "MeshSleepy.h"
+
+#include <string.h>
+
+#include "MeshRole.h"
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/link.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+static otInstance*         sInstance = NULL;
+static MeshSleepy_Notify_t sNotify   = NULL;
+
+static bool                sSleepy       = MESH_SLEEPY;
+static otDeviceRole        sRole         = OT_DEVICE_ROLE_DISABLED;
+static uint32_t            sPollPeriodMs = MESH_SLEEPY_POLL_PERIOD_MS;
+static bool                sFast         = false;
+static uint32_t            sFastUntilMs  = 0;
+static uint32_t            sLogAtMs      = 0;
+
+/* Power accounting */
+static MeshSleepy_Power_t  sState        = MeshSleepy_PowerOff;
+static uint32_t            sStateSinceMs = 0;
+static uint32_t            sStateMs[MeshSleepy_PowerStates];
+static uint32_t            sWakes        = 0;
+static otMacCounters       sBaseCounters;
+
+static StaticTimer_t       sTimerBuffer;
+static TimerHandle_t       sTimer = NULL;
+
+static uint32_t MeshSleepy_NowMs(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+static void MeshSleepy_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+/* Time left until @p deadlineMs, at least 1 ms so an overdue deadline fires at once */
+static uint32_t MeshSleepy_Remaining(uint32_t deadlineMs, uint32_t nowMs)
+{
+    int32_t left = (int32_t)(deadlineMs - nowMs);
+
+    return (left > 0) ? (uint32_t)left : 1;
+}
+
+/* Re-arm the timer for the end of the fast-poll window or the next log */
+static void MeshSleepy_Arm(uint32_t nowMs)
+{
+    uint32_t delayMs = 0;
+
+    if(sTimer == NULL)
+    {
+        return;
+    }
+    if(sFast)
+    {
+        delayMs = MeshSleepy_Remaining(sFastUntilMs, nowMs);
+    }
+    if(MESH_SLEEPY_LOG_MS != 0)
+    {
+        uint32_t logMs = MeshSleepy_Remaining(sLogAtMs, nowMs);
+
+        if(delayMs == 0 || logMs < delayMs)
+        {
+            delayMs = logMs;
+        }
+    }
+
+    if(delayMs != 0)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(delayMs), 0);
+    }
+}
+
+/* Close the running state's time and continue in the one the node is in now */
+static void MeshSleepy_Update(uint32_t nowMs)
+{
+    MeshSleepy_Power_t state;
+
+    if(sRole == OT_DEVICE_ROLE_DISABLED)
+    {
+        state = MeshSleepy_PowerOff;
+    }
+    else if(!sSleepy || sRole != OT_DEVICE_ROLE_CHILD)
+    {
+        state = MeshSleepy_PowerRxOn;
+    }
+    else
+    {
+        state = sFast ? MeshSleepy_PowerFastPoll : MeshSleepy_PowerIdle;
+    }
+
+    sStateMs[sState] += nowMs - sStateSinceMs;
+    sStateSinceMs = nowMs;
+    sState        = state;
+}
+
+static void MeshSleepy_ApplyPollPeriod(void)
+{
+    otError err = otLinkSetPollPeriod(sInstance, sFast ? MESH_SLEEPY_FAST_POLL_MS : sPollPeriodMs);
+
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Sleepy] Poll period failed: %d", 0, (int)err);
+    }
+}
+
+static void MeshSleepy_ApplyMode(void)
+{
+    otLinkModeConfig mode;
+    otError          err;
+
+    memset(&mode, 0, sizeof(mode));
+    mode.mRxOnWhenIdle = !sSleepy;
+    mode.mDeviceType   = !sSleepy && MeshRole_IsRouterEligible();
+    mode.mNetworkData  = !sSleepy;
+
+    err = otThreadSetLinkMode(sInstance, mode);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Sleepy] Link mode failed: %d", 0, (int)err);
+        return;
+    }
+
+    if(sSleepy)
+    {
+        MeshSleepy_ApplyPollPeriod();
+    }
+#if MESH_SLEEPY_CSL_PERIOD_MS
+    err = otLinkSetCslPeriod(sInstance, sSleepy ? MESH_SLEEPY_CSL_PERIOD_MS * 1000UL : 0);
+    if(err != OT_ERROR_NONE)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Sleepy] CSL period failed: %d", 0, (int)err);
+    }
+#endif
+
+    if(sSleepy)
+    {
+        GP_LOG_SYSTEM_PRINTF("[Sleepy] Sleepy end device, poll %lu ms, CSL %lu ms", 0,
+                             (unsigned long)sPollPeriodMs, (unsigned long)MESH_SLEEPY_CSL_PERIOD_MS);
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[Sleepy] Receiver always on", 0);
+    }
+}
+
+static void MeshSleepy_Log(void)
+{
+    MeshSleepy_Stats_t stats;
+
+    MeshSleepy_GetStats(&stats);
+    GP_LOG_SYSTEM_PRINTF("[Sleepy] rx-on:%lus fast:%lus idle:%lus polls:%lu tx:%lu rx:%lu wakes:%lu duty:%lu ppm", 0,
+                         (unsigned long)(stats.stateMs[MeshSleepy_PowerRxOn] / 1000),
+                         (unsigned long)(stats.stateMs[MeshSleepy_PowerFastPoll] / 1000),
+                         (unsigned long)(stats.stateMs[MeshSleepy_PowerIdle] / 1000),
+                         (unsigned long)stats.dataPolls, (unsigned long)stats.txFrames,
+                         (unsigned long)stats.rxFrames, (unsigned long)stats.wakes,
+                         (unsigned long)stats.rxOnPpm);
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshSleepy_Init(otInstance* pInstance, MeshSleepy_Notify_t notify)
+{
+    uint32_t nowMs = MeshSleepy_NowMs();
+
+    sInstance = pInstance;
+    sNotify   = notify;
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshSleepy", pdMS_TO_TICKS(MESH_SLEEPY_FAST_WINDOW_MS), pdFALSE, NULL,
+                                    MeshSleepy_TimerCallback, &sTimerBuffer);
+    }
+
+    sBaseCounters = *otLinkGetCounters(sInstance);
+    memset(sStateMs, 0, sizeof(sStateMs));
+    sStateSinceMs = nowMs;
+    sLogAtMs      = nowMs + MESH_SLEEPY_LOG_MS;
+
+    MeshSleepy_ApplyMode();
+    MeshSleepy_Arm(nowMs);
+}
+
+void MeshSleepy_RoleChanged(otDeviceRole role)
+{
+    uint32_t nowMs = MeshSleepy_NowMs();
+
+    sRole = role;
+    if(sFast && role != OT_DEVICE_ROLE_CHILD)
+    {
+        /* The next attach starts from the idle poll period */
+        sFast = false;
+        if(sSleepy)
+        {
+            MeshSleepy_ApplyPollPeriod();
+        }
+    }
+
+    MeshSleepy_Update(nowMs);
+    MeshSleepy_Arm(nowMs);
+}
+
+void MeshSleepy_Wake(void)
+{
+    uint32_t nowMs = MeshSleepy_NowMs();
+
+    if(!sSleepy || sRole != OT_DEVICE_ROLE_CHILD)
+    {
+        return;
+    }
+
+    sWakes++;
+    sFastUntilMs = nowMs + MESH_SLEEPY_FAST_WINDOW_MS;
+    if(!sFast)
+    {
+        sFast = true;
+        MeshSleepy_ApplyPollPeriod();
+    }
+
+    MeshSleepy_Update(nowMs);
+    MeshSleepy_Arm(nowMs);
+}
+
+void MeshSleepy_Process(void)
+{
+    uint32_t nowMs = MeshSleepy_NowMs();
+
+    if(sFast && (int32_t)(nowMs - sFastUntilMs) >= 0)
+    {
+        sFast = false;
+        MeshSleepy_ApplyPollPeriod();
+        MeshSleepy_Update(nowMs);
+    }
+
+    if(MESH_SLEEPY_LOG_MS != 0 && (int32_t)(nowMs - sLogAtMs) >= 0)
+    {
+        MeshSleepy_Update(nowMs);
+        MeshSleepy_Log();
+        sLogAtMs = nowMs + MESH_SLEEPY_LOG_MS;
+    }
+
+    MeshSleepy_Arm(nowMs);
+}
+
+void MeshSleepy_SetEnabled(bool sleepy)
+{
+    uint32_t nowMs = MeshSleepy_NowMs();
+
+    if(sleepy == sSleepy || sInstance == NULL)
+    {
+        return;
+    }
+
+    sSleepy = sleepy;
+    sFast   = false;
+    MeshSleepy_ApplyMode();
+    MeshSleepy_Update(nowMs);
+    MeshSleepy_Arm(nowMs);
+}
+
+otError MeshSleepy_SetPollPeriod(uint32_t pollPeriodMs)
+{
+    otError err = OT_ERROR_NONE;
+
+    if(pollPeriodMs < MESH_SLEEPY_FAST_POLL_MS)
+    {
+        return OT_ERROR_INVALID_ARGS;
+    }
+
+    sPollPeriodMs = pollPeriodMs;
+    if(sSleepy && !sFast && sInstance != NULL)
+    {
+        err = otLinkSetPollPeriod(sInstance, sPollPeriodMs);
+    }
+    return err;
+}
+
+bool MeshSleepy_IsSleepy(void)
+{
+    return sSleepy;
+}
+
+MeshSleepy_Power_t MeshSleepy_GetPowerState(void)
+{
+    return sState;
+}
+
+void MeshSleepy_GetStats(MeshSleepy_Stats_t* pStats)
+{
+    const otMacCounters* pCounters;
+    uint64_t             activeUs;
+    uint64_t             rxUs;
+    uint8_t              i;
+
+    memset(pStats, 0, sizeof(*pStats));
+    for(i = 0; i < MeshSleepy_PowerStates; i++)
+    {
+        pStats->stateMs[i] = sStateMs[i];
+    }
+    pStats->stateMs[sState] += MeshSleepy_NowMs() - sStateSinceMs;
+    pStats->wakes = sWakes;
+
+    if(sInstance == NULL)
+    {
+        return;
+    }
+    pCounters         = otLinkGetCounters(sInstance);
+    pStats->dataPolls = pCounters->mTxDataPoll - sBaseCounters.mTxDataPoll;
+    pStats->txFrames  = pCounters->mTxTotal - sBaseCounters.mTxTotal;
+    pStats->rxFrames  = pCounters->mRxTotal - sBaseCounters.mRxTotal;
+
+    activeUs = 1000ULL * ((uint64_t)pStats->stateMs[MeshSleepy_PowerRxOn] +
+                          pStats->stateMs[MeshSleepy_PowerFastPoll] + pStats->stateMs[MeshSleepy_PowerIdle]);
+    rxUs     = 1000ULL * pStats->stateMs[MeshSleepy_PowerRxOn] +
+               (uint64_t)pStats->dataPolls * MESH_SLEEPY_POLL_RX_US + (uint64_t)pStats->txFrames * MESH_SLEEPY_TX_US;
+#if MESH_SLEEPY_CSL_PERIOD_MS
+    rxUs += ((uint64_t)pStats->stateMs[MeshSleepy_PowerFastPoll] + pStats->stateMs[MeshSleepy_PowerIdle]) /
+            MESH_SLEEPY_CSL_PERIOD_MS * MESH_SLEEPY_CSL_SAMPLE_US;
+#endif
+
+    if(activeUs != 0)
+    {
+        pStats->rxOnPpm = (rxUs >= activeUs) ? 1000000UL : (uint32_t)(rxUs * 1000000ULL / activeUs);
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshSleepy.h"
+ *
+ * Sleepy End Device profile for battery-powered sensor nodes.
+ *
+ *   - With MESH_SLEEPY=1 the node attaches as a minimal end device with
+ *     its receiver off when idle, and polls its parent for queued frames
+ *     every MESH_SLEEPY_POLL_PERIOD_MS.  Without it the node keeps its
+ *     receiver always on, in the link mode of its role policy (MeshRole.h).
+ *   - A local event (MeshSleepy_Wake) switches to fast polling for
+ *     MESH_SLEEPY_FAST_WINDOW_MS, so the gateway's ACK and any reply come
+ *     in within MESH_SLEEPY_FAST_POLL_MS instead of a poll period.  The
+ *     event itself goes out at once: a transmission wakes the radio.
+ *   - With MESH_SLEEPY_CSL_PERIOD_MS set the node is a synchronized
+ *     sleepy end device (CSL): it also samples the channel once per
+ *     period, so the parent can reach it without waiting for a poll.
+ *     This needs an OpenThread library built with CSL receiver support.
+ *   - Power accounting: the time spent in each power state and the MAC
+ *     counters give an estimated receiver duty cycle, logged every
+ *     MESH_SLEEPY_LOG_MS.
+ *
+ * The profile can also be switched at run time (MeshSleepy_SetEnabled),
+ * e.g. when a node goes from USB to battery power.
+ *
+ * Threading: the timer only calls the application's notify hook; the
+ * application calls MeshSleepy_Process() from its own task, like
+ * MeshCoap_Process().
+ */
+
+#ifndef _MESH_SLEEPY_H_
+#define _MESH_SLEEPY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Build profile: 1 = attach as a sleepy end device (make ... MESH_SLEEPY=1) */
+#ifndef MESH_SLEEPY
+#define MESH_SLEEPY                 0
+#endif
+
+/** Parent poll period while idle */
+#ifndef MESH_SLEEPY_POLL_PERIOD_MS
+#define MESH_SLEEPY_POLL_PERIOD_MS  15000
+#endif
+
+/** Poll period after a local event, and for how long */
+#ifndef MESH_SLEEPY_FAST_POLL_MS
+#define MESH_SLEEPY_FAST_POLL_MS    250
+#endif
+#ifndef MESH_SLEEPY_FAST_WINDOW_MS
+#define MESH_SLEEPY_FAST_WINDOW_MS  5000
+#endif
+
+/** CSL sample period, 0 = plain polling (the pre-built library has no CSL) */
+#ifndef MESH_SLEEPY_CSL_PERIOD_MS
+#define MESH_SLEEPY_CSL_PERIOD_MS   0
+#endif
+
+/** Receiver-on time assumed per data poll, per transmitted frame and per
+ *  CSL sample, for the duty cycle estimate (us) */
+#define MESH_SLEEPY_POLL_RX_US      6000
+#define MESH_SLEEPY_TX_US           4000
+#define MESH_SLEEPY_CSL_SAMPLE_US   2000
+
+/** Print the power accounting line every N ms (0 = off) */
+#ifndef MESH_SLEEPY_LOG_MS
+#define MESH_SLEEPY_LOG_MS          300000
+#endif
+
+typedef enum
+{
+    MeshSleepy_PowerOff      = 0,  /**< Thread disabled */
+    MeshSleepy_PowerRxOn     = 1,  /**< Receiver always on: not sleepy, or attaching */
+    MeshSleepy_PowerFastPoll = 2,  /**< Sleepy, fast polling after a local event */
+    MeshSleepy_PowerIdle     = 3,  /**< Sleepy, polling every poll period */
+    MeshSleepy_PowerStates
+} MeshSleepy_Power_t;
+
+typedef struct
+{
+    uint32_t stateMs[MeshSleepy_PowerStates]; /**< Time spent in each power state */
+    uint32_t wakes;        /**< Local events that started a fast-poll window */
+    uint32_t dataPolls;    /**< MAC data requests sent */
+    uint32_t txFrames;     /**< MAC frames sent, data polls included */
+    uint32_t rxFrames;     /**< MAC frames received */
+    uint32_t rxOnPpm;      /**< Estimated receiver duty cycle, parts per million */
+} MeshSleepy_Stats_t;
+
+/** Called from the timer task when a fast-poll window ends or a log is due; post to the app task. */
+typedef void (*MeshSleepy_Notify_t)(void);
+
+/** @brief Apply the link mode of the build profile.
+ *  Call before the Thread stack is enabled. */
+void MeshSleepy_Init(otInstance* pInstance, MeshSleepy_Notify_t notify);
+
+/** @brief Track the device role (call on every role change). */
+void MeshSleepy_RoleChanged(otDeviceRole role);
+
+/** @brief A local event is about to be sent: poll fast for a while.
+ *  No effect unless the node is an attached sleepy child. */
+void MeshSleepy_Wake(void);
+
+/** @brief End a fast-poll window that is over, and log when due. */
+void MeshSleepy_Process(void);
+
+/** @brief Switch between the sleepy and the always-on profile at run time. */
+void MeshSleepy_SetEnabled(bool sleepy);
+
+/** @brief Change the idle poll period (ms) at run time. */
+otError MeshSleepy_SetPollPeriod(uint32_t pollPeriodMs);
+
+/** @return true if the node runs the sleepy profile */
+bool MeshSleepy_IsSleepy(void);
+
+/** @return Current power state */
+MeshSleepy_Power_t MeshSleepy_GetPowerState(void);
+
+/** @brief Power accounting up to now. */
+void MeshSleepy_GetStats(MeshSleepy_Stats_t* pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_SLEEPY_H_ */
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTime.c"
+ *
+ * Mesh time estimator.
+ *
+ * Offsets are kept modulo 2^32 and only ever compared through signed
+ * differences, so two clocks may be any distance apart.  The exchange
+ * offset is computed as (t2 - t1) + ((t3 - t4) - (t2 - t1)) / 2 for the
+ * same reason: the inner difference is minus the round trip, which is
+ * small, while (t2 - t1) + (t3 - t4) could overflow.
+ *
+ * The anchor is the window sample with the lowest error bound: half its
+ * round trip plus MESH_TIME_DRIFT_ERROR_PPM of its age, so a short round
+ * trip is not extrapolated from for the whole 64 s window.  Drift is
+ * measured between anchors at least MESH_TIME_DRIFT_MIN_SPAN_US apart,
+ * the first one taken from a full window, and smoothed with weight 1/4.
+ * Once drift is known, a new anchor only pulls the model halfway towards
+ * its offset, which averages out some of the per-exchange path asymmetry.
+ *
+ * Computer/Software/MeshTimeSim checks this on the host: up to 80 ppm
+ * between the crystals, 3-4 ms per direction and 10 % of messages delayed
+ * up to 40 ms.  Mean error is ~115 us and worst under 1 ms; two clients
+ * stay within 1 ms of each other ("make check" fails otherwise).
+ */
+
+#include "MeshTime.h"
+
+#include <string.h>
+
+#define MESH_TIME_PPB_SCALE  1000000000LL
+
+static int32_t MeshTime_DriftTerm(const MeshTime_t* pClock, uint32_t localUs)
+{
+    int32_t elapsed = (int32_t)(localUs - pClock->anchorLocalUs);
+    return (int32_t)(((int64_t)pClock->driftPpb * elapsed) / MESH_TIME_PPB_SCALE);
+}
+
+static int32_t MeshTime_PredictOffset(const MeshTime_t* pClock, uint32_t localUs)
+{
+    return (int32_t)((uint32_t)pClock->anchorOffsetUs + (uint32_t)MeshTime_DriftTerm(pClock, localUs));
+}
+
+static void MeshTime_ResetFilter(MeshTime_t* pClock)
+{
+    pClock->count     = 0;
+    pClock->next      = 0;
+    pClock->good      = 0;
+    pClock->driftPpb  = 0;
+    pClock->haveDrift = false;
+    pClock->haveRef   = false;
+}
+
+void MeshTime_Init(MeshTime_t* pClock)
+{
+    memset(pClock, 0, sizeof(*pClock));
+    pClock->state = MeshTime_StateUnsynced;
+}
+
+void MeshTime_SetMaster(MeshTime_t* pClock, bool master, uint32_t nowLocalUs)
+{
+    if(master && pClock->state != MeshTime_StateMaster)
+    {
+        /* Freeze the current estimate: mesh time continues from here on the local crystal */
+        pClock->anchorOffsetUs = MeshTime_PredictOffset(pClock, nowLocalUs);
+        pClock->anchorLocalUs  = nowLocalUs;
+        MeshTime_ResetFilter(pClock);
+        pClock->pending = false;
+        pClock->state   = MeshTime_StateMaster;
+    }
+    else if(!master && pClock->state == MeshTime_StateMaster)
+    {
+        MeshTime_ResetFilter(pClock);
+        pClock->state = MeshTime_StateUnsynced;
+    }
+}
+
+MeshTime_State_t MeshTime_GetState(const MeshTime_t* pClock, uint32_t nowLocalUs)
+{
+    if(pClock->state == MeshTime_StateSynced &&
+       (uint32_t)(nowLocalUs - pClock->lastGoodUs) > MESH_TIME_HOLDOVER_US)
+    {
+        return MeshTime_StateUnsynced;
+    }
+    return pClock->state;
+}
+
+uint32_t MeshTime_ToMesh(const MeshTime_t* pClock, uint32_t localUs)
+{
+    return localUs + (uint32_t)MeshTime_PredictOffset(pClock, localUs);
+}
+
+uint32_t MeshTime_ToLocal(const MeshTime_t* pClock, uint32_t meshUs)
+{
+    /* One fixed-point step: the drift term changes by ppb * offset, i.e. nothing */
+    uint32_t guess = meshUs - (uint32_t)pClock->anchorOffsetUs;
+    return meshUs - (uint32_t)MeshTime_PredictOffset(pClock, guess);
+}
+
+uint32_t MeshTime_NextIntervalMs(const MeshTime_t* pClock)
+{
+    if(pClock->good < MESH_TIME_WINDOW || !pClock->haveDrift)
+    {
+        return MESH_TIME_FAST_INTERVAL_MS;
+    }
+    return MESH_TIME_SLOW_INTERVAL_MS;
+}
+
+uint8_t MeshTime_BuildRequest(MeshTime_t* pClock, uint32_t nowLocalUs, uint8_t* pOut)
+{
+    /* Holdover expired: start acquiring again at the fast rate */
+    if(MeshTime_GetState(pClock, nowLocalUs) == MeshTime_StateUnsynced && pClock->state == MeshTime_StateSynced)
+    {
+        MeshTime_ResetFilter(pClock);
+        pClock->state = MeshTime_StateUnsynced;
+    }
+
+    pClock->seq++;
+    pClock->pendingT1 = nowLocalUs;
+    pClock->pending   = true;
+    pClock->stats.requests++;
+
+    memset(pOut, 0, MESH_TIME_MSG_LEN);
+    pOut[0] = MESH_TIME_MSG_REQUEST;
+    pOut[1] = pClock->seq;
+    MeshTime_PutBe32(&pOut[2], nowLocalUs);
+    return MESH_TIME_MSG_LEN;
+}
+
+uint8_t MeshTime_BuildResponse(const MeshTime_t* pClock, const uint8_t* pRequest, uint16_t len,
+                               uint32_t rxLocalUs, uint32_t txLocalUs, uint8_t* pOut)
+{
+    if(pClock->state != MeshTime_StateMaster || len != MESH_TIME_MSG_LEN || pRequest[0] != MESH_TIME_MSG_REQUEST)
+    {
+        return 0;
+    }
+
+    pOut[0] = MESH_TIME_MSG_RESPONSE;
+    pOut[1] = pRequest[1];
+    memcpy(&pOut[2], &pRequest[2], 4);
+    MeshTime_PutBe32(&pOut[6], MeshTime_ToMesh(pClock, rxLocalUs));
+    MeshTime_PutBe32(&pOut[10], MeshTime_ToMesh(pClock, txLocalUs));
+    return MESH_TIME_MSG_LEN;
+}
+
+/* Error bound of a sample once it is @p ageUs old: half its round trip,
+ * plus what the drift estimate can be off by over that time */
+static uint32_t MeshTime_SampleCost(const MeshTime_Sample_t* pSample, uint32_t ageUs)
+{
+    return pSample->rttUs / 2 + ageUs / (1000000UL / MESH_TIME_DRIFT_ERROR_PPM);
+}
+
+/* Adopt the best sample of the window (MeshTime_SampleCost) as the new anchor */
+static void MeshTime_UpdateAnchor(MeshTime_t* pClock, uint32_t nowLocalUs)
+{
+    const MeshTime_Sample_t* pBest    = &pClock->window[0];
+    uint32_t                 bestCost = MeshTime_SampleCost(pBest, nowLocalUs - pBest->localUs);
+
+    for(uint8_t i = 1; i < pClock->count; i++)
+    {
+        uint32_t cost = MeshTime_SampleCost(&pClock->window[i], nowLocalUs - pClock->window[i].localUs);
+
+        if(cost < bestCost)
+        {
+            pBest    = &pClock->window[i];
+            bestCost = cost;
+        }
+    }
+
+    if(pClock->good > 1 && pBest->localUs == pClock->anchorLocalUs)
+    {
+        return;
+    }
+
+    if(pClock->good > 1)
+    {
+        pClock->stats.lastErrorUs = (int32_t)((uint32_t)pBest->offsetUs -
+                                              (uint32_t)MeshTime_PredictOffset(pClock, pBest->localUs));
+    }
+
+    if(!pClock->haveRef)
+    {
+        /* Only a min-RTT pick from a full window is good enough to measure drift from */
+        if(pClock->count < MESH_TIME_WINDOW)
+        {
+            pClock->anchorOffsetUs = pBest->offsetUs;
+            pClock->anchorLocalUs  = pBest->localUs;
+            return;
+        }
+        pClock->refLocalUs  = pBest->localUs;
+        pClock->refOffsetUs = pBest->offsetUs;
+        pClock->haveRef     = true;
+    }
+    else
+    {
+        uint32_t span = pBest->localUs - pClock->refLocalUs;
+
+        if(span >= MESH_TIME_DRIFT_MIN_SPAN_US && span < 0x80000000UL)
+        {
+            int32_t change = (int32_t)((uint32_t)pBest->offsetUs - (uint32_t)pClock->refOffsetUs);
+            int64_t rate   = ((int64_t)change * MESH_TIME_PPB_SCALE) / (int64_t)span;
+
+            if(rate > MESH_TIME_DRIFT_MAX_PPB)
+            {
+                rate = MESH_TIME_DRIFT_MAX_PPB;
+            }
+            else if(rate < -MESH_TIME_DRIFT_MAX_PPB)
+            {
+                rate = -MESH_TIME_DRIFT_MAX_PPB;
+            }
+
+            if(pClock->haveDrift)
+            {
+                pClock->driftPpb += ((int32_t)rate - pClock->driftPpb) / 4;
+            }
+            else
+            {
+                pClock->driftPpb  = (int32_t)rate;
+                pClock->haveDrift = true;
+            }
+
+            pClock->refLocalUs  = pBest->localUs;
+            pClock->refOffsetUs = pBest->offsetUs;
+        }
+    }
+
+    if(pClock->haveDrift)
+    {
+        int32_t predicted = MeshTime_PredictOffset(pClock, pBest->localUs);
+        pClock->anchorOffsetUs = (int32_t)((uint32_t)predicted + (uint32_t)(pClock->stats.lastErrorUs / 2));
+    }
+    else
+    {
+        pClock->anchorOffsetUs = pBest->offsetUs;
+    }
+    pClock->anchorLocalUs  = pBest->localUs;
+    pClock->stats.driftPpb = pClock->driftPpb;
+}
+
+bool MeshTime_HandleResponse(MeshTime_t* pClock, const uint8_t* pResponse, uint16_t len,
+                             uint32_t rxLocalUs)
+{
+    MeshTime_Sample_t sample;
+    uint32_t t1, t2, t3, t4;
+    int32_t rtt, forward, asym;
+
+    if(len != MESH_TIME_MSG_LEN || pResponse[0] != MESH_TIME_MSG_RESPONSE || pClock->state == MeshTime_StateMaster)
+    {
+        return false;
+    }
+
+    if(!pClock->pending || pResponse[1] != pClock->seq || MeshTime_GetBe32(&pResponse[2]) != pClock->pendingT1)
+    {
+        /* Late answer to an earlier request, or not ours */
+        pClock->stats.rejected++;
+        return false;
+    }
+    pClock->pending = false;
+
+    t1 = pClock->pendingT1;
+    t2 = MeshTime_GetBe32(&pResponse[6]);
+    t3 = MeshTime_GetBe32(&pResponse[10]);
+    t4 = rxLocalUs;
+
+    rtt = (int32_t)(t4 - t1) - (int32_t)(t3 - t2);
+    if(rtt < 0)
+    {
+        rtt = 0;
+    }
+    if(rtt > MESH_TIME_MAX_RTT_US)
+    {
+        pClock->stats.rejected++;
+        return false;
+    }
+
+    forward = (int32_t)(t2 - t1);
+    asym    = (int32_t)((t3 - t4) - (t2 - t1));
+
+    sample.localUs  = t1 + (t4 - t1) / 2;
+    sample.offsetUs = (int32_t)((uint32_t)forward + (uint32_t)(asym / 2));
+    sample.rttUs    = (uint32_t)rtt;
+
+    pClock->stats.accepted++;
+    MeshTime_LatencyRecord(&pClock->stats.rtt, rtt);
+
+    /* A jump no round trip can explain: the master changed */
+    if(pClock->good > 0)
+    {
+        int32_t error = (int32_t)((uint32_t)sample.offsetUs -
+                                  (uint32_t)MeshTime_PredictOffset(pClock, sample.localUs));
+        if(error > MESH_TIME_STEP_US + rtt / 2 || error < -(MESH_TIME_STEP_US + rtt / 2))
+        {
+            pClock->stats.steps++;
+            MeshTime_ResetFilter(pClock);
+            pClock->state = MeshTime_StateUnsynced;
+        }
+    }
+
+    pClock->window[pClock->next] = sample;
+    pClock->next = (uint8_t)((pClock->next + 1) % MESH_TIME_WINDOW);
+    if(pClock->count < MESH_TIME_WINDOW)
+    {
+        pClock->count++;
+    }
+    if(pClock->good < UINT8_MAX)
+    {
+        pClock->good++;
+    }
+
+    MeshTime_UpdateAnchor(pClock, rxLocalUs);
+
+    pClock->lastGoodUs = rxLocalUs;
+    if(pClock->good >= MESH_TIME_SYNCED_SAMPLES)
+    {
+        pClock->state = MeshTime_StateSynced;
+    }
+    return true;
+}
+
+void MeshTime_LatencyRecord(MeshTime_Latency_t* pLatency, int32_t valueUs)
+{
+    if(pLatency->count == 0)
+    {
+        pLatency->minUs = valueUs;
+        pLatency->maxUs = valueUs;
+        pLatency->avgUs = valueUs;
+    }
+    else
+    {
+        if(valueUs < pLatency->minUs)
+        {
+            pLatency->minUs = valueUs;
+        }
+        if(valueUs > pLatency->maxUs)
+        {
+            pLatency->maxUs = valueUs;
+        }
+        pLatency->avgUs += (valueUs - pLatency->avgUs) / 8;
+    }
+    pLatency->count++;
+}
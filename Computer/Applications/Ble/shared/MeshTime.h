@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTime.h"
+ *
+ * Mesh time base: clock-offset estimator, drift tracker and latency
+ * statistics shared by the Thread applications.
+ *
+ * Mesh time is the local microsecond clock of the time master (the Thread
+ * leader).  Every other node estimates
+ *
+ *     mesh = local + offset + drift * (local - anchor)
+ *
+ * from two-way timestamp exchanges (NTP style):
+ *
+ *     client                 master
+ *       t1  ── request ──►     t2
+ *       t4  ◄── response ──    t3
+ *
+ *     rtt    = (t4 - t1) - (t3 - t2)
+ *     offset = ((t2 - t1) + (t3 - t4)) / 2
+ *
+ * The offset error of one exchange is at most rtt / 2, so the estimator
+ * keeps the last MESH_TIME_WINDOW exchanges and anchors on the one with the
+ * smallest round trip.  Successive anchors give the frequency error between
+ * the two crystals (drift, ppb), which carries the estimate between
+ * exchanges.
+ *
+ * All times are 32-bit microseconds and wrap after ~71 minutes; only
+ * differences are ever used.  Request and response are the same length so
+ * both directions spend the same time on air.
+ *
+ * This module has no SDK dependencies so it can be built and checked on a host.
+ */
+
+#ifndef _MESH_TIME_H_
+#define _MESH_TIME_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Message types, shared with the other Thread payload types (0x01..0x05) */
+#define MESH_TIME_MSG_REQUEST       0x06
+#define MESH_TIME_MSG_RESPONSE      0x07
+
+/** Request:  type, seq, t1 (BE32), 8 bytes padding
+ *  Response: type, seq, t1 (BE32, echoed), t2 (BE32), t3 (BE32) */
+#define MESH_TIME_MSG_LEN           14
+
+/** Exchanges kept for the minimum round-trip filter */
+#define MESH_TIME_WINDOW            8
+
+/** Exchanges slower than this are discarded (queued behind other traffic) */
+#define MESH_TIME_MAX_RTT_US        100000
+
+/** Good exchanges needed before the time base is reported as synced */
+#define MESH_TIME_SYNCED_SAMPLES    3
+
+/** Minimum span between two anchors used for a drift measurement.  The
+ *  anchors are only good to a few hundred us, so this must be long. */
+#define MESH_TIME_DRIFT_MIN_SPAN_US 30000000
+
+/** Residual drift error assumed when choosing an anchor: an older sample
+ *  only wins over a newer one if its round trip is shorter by more than
+ *  what this error adds up to in between */
+#define MESH_TIME_DRIFT_ERROR_PPM   20
+
+/** Crystal tolerance clamp (2 x 40 ppm plus margin) */
+#define MESH_TIME_DRIFT_MAX_PPB     100000
+
+/** An offset jump larger than this (beyond rtt / 2) means a new master:
+ *  the window and drift are reset instead of filtered. */
+#define MESH_TIME_STEP_US           20000
+
+/** Without a good exchange for this long the estimate is no longer trusted */
+#define MESH_TIME_HOLDOVER_US       120000000
+
+/** Exchange interval while acquiring (window not full or no drift yet),
+ *  and once the estimate is complete */
+#define MESH_TIME_FAST_INTERVAL_MS  1000
+#define MESH_TIME_SLOW_INTERVAL_MS  8000
+
+typedef enum
+{
+    MeshTime_StateUnsynced = 0,
+    MeshTime_StateSynced   = 1,
+    MeshTime_StateMaster   = 2,
+} MeshTime_State_t;
+
+typedef struct
+{
+    uint32_t localUs;    /**< Local time at the exchange midpoint */
+    int32_t  offsetUs;   /**< mesh - local (modulo 2^32) */
+    uint32_t rttUs;
+} MeshTime_Sample_t;
+
+/** Running min / max / mean of a signed microsecond quantity */
+typedef struct
+{
+    uint32_t count;
+    int32_t  minUs;
+    int32_t  maxUs;
+    int32_t  avgUs;      /**< Exponential average, weight 1/8 */
+} MeshTime_Latency_t;
+
+typedef struct
+{
+    uint32_t           requests;      /**< Requests sent */
+    uint32_t           accepted;      /**< Responses used by the estimator */
+    uint32_t           rejected;      /**< Stale, mismatched or too slow */
+    uint32_t           steps;         /**< Master changes (offset jumps) */
+    int32_t            driftPpb;      /**< Local clock rate error vs mesh, ppb */
+    int32_t            lastErrorUs;   /**< Prediction error at the last new anchor */
+    MeshTime_Latency_t rtt;           /**< Round trip to the master */
+} MeshTime_Stats_t;
+
+typedef struct
+{
+    MeshTime_State_t  state;
+
+    /* Min-RTT filter */
+    MeshTime_Sample_t window[MESH_TIME_WINDOW];
+    uint8_t           count;
+    uint8_t           next;
+    uint8_t           good;           /**< Accepted exchanges since (re)start, saturating */
+
+    /* Model: mesh = local + anchorOffset + drift * (local - anchorLocal) */
+    uint32_t          anchorLocalUs;
+    int32_t           anchorOffsetUs;
+    int32_t           driftPpb;
+    bool              haveDrift;
+
+    /* Drift reference: anchor at least MESH_TIME_DRIFT_MIN_SPAN_US older */
+    uint32_t          refLocalUs;
+    int32_t           refOffsetUs;
+    bool              haveRef;
+
+    uint32_t          lastGoodUs;     /**< Local time of the last accepted exchange */
+
+    /* Outstanding request */
+    uint8_t           seq;
+    uint32_t          pendingT1;
+    bool              pending;
+
+    MeshTime_Stats_t  stats;
+} MeshTime_t;
+
+/** @brief Reset to unsynced, offset 0 (mesh time = local time). */
+void MeshTime_Init(MeshTime_t* pClock);
+
+/** @brief Become (or stop being) the time master.
+ *
+ *  A new master keeps the mesh time it currently estimates, so the time
+ *  base stays continuous across a leader change.  A former master keeps its
+ *  offset and continues as an unsynced client until the next exchange. */
+void MeshTime_SetMaster(MeshTime_t* pClock, bool master, uint32_t nowLocalUs);
+
+/** @return Current state; Synced falls back to Unsynced after the holdover. */
+MeshTime_State_t MeshTime_GetState(const MeshTime_t* pClock, uint32_t nowLocalUs);
+
+/** @return Mesh time corresponding to local time @p localUs. */
+uint32_t MeshTime_ToMesh(const MeshTime_t* pClock, uint32_t localUs);
+
+/** @return Local time corresponding to mesh time @p meshUs. */
+uint32_t MeshTime_ToLocal(const MeshTime_t* pClock, uint32_t meshUs);
+
+/** @return Delay before the next exchange, in milliseconds. */
+uint32_t MeshTime_NextIntervalMs(const MeshTime_t* pClock);
+
+/** @brief Client: fill a request for the master and remember t1.
+ *  @return Message length (MESH_TIME_MSG_LEN). */
+uint8_t MeshTime_BuildRequest(MeshTime_t* pClock, uint32_t nowLocalUs, uint8_t* pOut);
+
+/** @brief Master: answer a request.
+ *  @param rxLocalUs Local time the request was received (t2 before conversion)
+ *  @param txLocalUs Local time just before the response is sent (t3)
+ *  @return Response length, or 0 if this node is not the master or the
+ *          request is malformed. */
+uint8_t MeshTime_BuildResponse(const MeshTime_t* pClock, const uint8_t* pRequest, uint16_t len,
+                               uint32_t rxLocalUs, uint32_t txLocalUs, uint8_t* pOut);
+
+/** @brief Client: feed a response received at local time @p rxLocalUs (t4).
+ *  @return true if the exchange was accepted. */
+bool MeshTime_HandleResponse(MeshTime_t* pClock, const uint8_t* pResponse, uint16_t len,
+                             uint32_t rxLocalUs);
+
+/** @brief Add one value to a latency accumulator. */
+void MeshTime_LatencyRecord(MeshTime_Latency_t* pLatency, int32_t valueUs);
+
+/** Big-endian helpers for the payloads that carry mesh time */
+static inline void MeshTime_PutBe32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint32_t MeshTime_GetBe32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_TIME_H_ */
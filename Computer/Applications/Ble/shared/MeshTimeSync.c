@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTimeSync.c"
+ *
+ * Mesh time service over Thread UDP.
+ *
+ * The estimator is touched from two contexts: the application task
+ * (requests, conversions) and the OpenThread receive callback (responses,
+ * answering as master).  Every access is a few dozen instructions, so a
+ * short critical section is used rather than a mutex.
+ *
+ * Timestamps are taken as close to the radio as the UDP API allows: t2/t4
+ * on entry to the receive callback, t1/t3 just before otUdpSend().  Queueing
+ * inside the stack shows up as a longer round trip, which the min-RTT filter
+ * discards.
+ */
+
+#include "MeshTimeSync.h"
+
+#include <string.h>
+
+#include "gpLog.h"
+#include "gpSched.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/udp.h>
+#include <openthread/message.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+static otInstance*           sInstance = NULL;
+static otUdpSocket           sSocket;
+static bool                  sSocketOpen = false;
+static MeshTimeSync_Notify_t sNotify     = NULL;
+
+static MeshTime_t            sClock;
+static MeshTime_State_t      sLoggedState = MeshTime_StateUnsynced;
+
+static StaticTimer_t         sTimerBuffer;
+static TimerHandle_t         sTimer = NULL;
+
+static void MeshTimeSync_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshTimeSync_Arm(uint32_t delayMs)
+{
+    if(sTimer != NULL)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(delayMs), 0);
+    }
+}
+
+static void MeshTimeSync_Send(const uint8_t* pData, uint8_t len, const otIp6Address* pAddr, uint16_t port)
+{
+    otMessageInfo info;
+    otMessage*    pMsg;
+
+    pMsg = otUdpNewMessage(sInstance, NULL);
+    if(pMsg == NULL)
+    {
+        return;
+    }
+
+    if(otMessageAppend(pMsg, pData, len) != OT_ERROR_NONE)
+    {
+        otMessageFree(pMsg);
+        return;
+    }
+
+    memset(&info, 0, sizeof(info));
+    info.mPeerAddr = *pAddr;
+    info.mPeerPort = port;
+
+    if(otUdpSend(sInstance, &sSocket, pMsg, &info) != OT_ERROR_NONE)
+    {
+        otMessageFree(pMsg);
+    }
+}
+
+static void MeshTimeSync_Log(void)
+{
+    MeshTime_Stats_t stats;
+    MeshTime_State_t state = MeshTimeSync_GetState();
+
+    MeshTimeSync_GetStats(&stats);
+
+    if(state != sLoggedState)
+    {
+        static const char* const names[] = {"unsynced", "synced", "master"};
+        GP_LOG_SYSTEM_PRINTF("[MeshTime] %s", 0, names[state]);
+        sLoggedState = state;
+    }
+
+    if(MESH_TIME_LOG_EVERY != 0 && state == MeshTime_StateSynced && stats.accepted != 0 &&
+       (stats.accepted % MESH_TIME_LOG_EVERY) == 0)
+    {
+        GP_LOG_SYSTEM_PRINTF("[MeshTime] drift:%ld ppb err:%ld us rtt:%ld/%ld/%ld us req:%lu ok:%lu rej:%lu", 0,
+                             (long)stats.driftPpb, (long)stats.lastErrorUs, (long)stats.rtt.minUs,
+                             (long)stats.rtt.avgUs, (long)stats.rtt.maxUs, (unsigned long)stats.requests,
+                             (unsigned long)stats.accepted, (unsigned long)stats.rejected);
+    }
+}
+
+static void MeshTimeSync_Receive(void* aContext, otMessage* aMessage, const otMessageInfo* aMessageInfo)
+{
+    uint32_t rxLocal = gpSched_GetCurrentTime();
+    uint8_t  msg[MESH_TIME_MSG_LEN];
+    uint8_t  rsp[MESH_TIME_MSG_LEN];
+    uint16_t len = otMessageGetLength(aMessage) - otMessageGetOffset(aMessage);
+    uint8_t  rspLen;
+
+    (void)aContext;
+
+    if(len != MESH_TIME_MSG_LEN)
+    {
+        return;
+    }
+    otMessageRead(aMessage, otMessageGetOffset(aMessage), msg, len);
+
+    if(msg[0] == MESH_TIME_MSG_REQUEST)
+    {
+        taskENTER_CRITICAL();
+        rspLen = MeshTime_BuildResponse(&sClock, msg, len, rxLocal, gpSched_GetCurrentTime(), rsp);
+        taskEXIT_CRITICAL();
+
+        if(rspLen != 0)
+        {
+            MeshTimeSync_Send(rsp, rspLen, &aMessageInfo->mPeerAddr, aMessageInfo->mPeerPort);
+        }
+    }
+    else if(msg[0] == MESH_TIME_MSG_RESPONSE)
+    {
+        taskENTER_CRITICAL();
+        MeshTime_HandleResponse(&sClock, msg, len, rxLocal);
+        taskEXIT_CRITICAL();
+    }
+}
+
+void MeshTimeSync_Init(otInstance* pInstance, MeshTimeSync_Notify_t notify)
+{
+    otSockAddr sockAddr;
+    otError    err;
+
+    sInstance = pInstance;
+    sNotify   = notify;
+    MeshTime_Init(&sClock);
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshTime", pdMS_TO_TICKS(MESH_TIME_FAST_INTERVAL_MS), pdFALSE, NULL,
+                                    MeshTimeSync_TimerCallback, &sTimerBuffer);
+    }
+
+    if(sSocketOpen)
+    {
+        return;
+    }
+
+    memset(&sockAddr, 0, sizeof(sockAddr));
+    sockAddr.mPort = MESH_TIME_UDP_PORT;
+
+    err = otUdpOpen(sInstance, &sSocket, MeshTimeSync_Receive, NULL);
+    if(err == OT_ERROR_NONE)
+    {
+        err = otUdpBind(sInstance, &sSocket, &sockAddr, OT_NETIF_THREAD_INTERNAL);
+    }
+
+    if(err == OT_ERROR_NONE)
+    {
+        sSocketOpen = true;
+        GP_LOG_SYSTEM_PRINTF("[MeshTime] UDP socket open on port %d", 0, MESH_TIME_UDP_PORT);
+    }
+    else
+    {
+        GP_LOG_SYSTEM_PRINTF("[MeshTime] UDP open/bind failed: %d", 0, (int)err);
+    }
+}
+
+void MeshTimeSync_RoleChanged(otDeviceRole role)
+{
+    uint32_t now = gpSched_GetCurrentTime();
+
+    taskENTER_CRITICAL();
+    MeshTime_SetMaster(&sClock, role == OT_DEVICE_ROLE_LEADER, now);
+    taskEXIT_CRITICAL();
+
+    if(role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER)
+    {
+        /* (Re)start exchanging with the current leader */
+        MeshTimeSync_Arm(MESH_TIME_FAST_INTERVAL_MS);
+    }
+    else if(sTimer != NULL)
+    {
+        xTimerStop(sTimer, 0);
+    }
+
+    MeshTimeSync_Log();
+}
+
+void MeshTimeSync_Process(void)
+{
+    otIp6Address leader;
+    uint8_t      msg[MESH_TIME_MSG_LEN];
+    uint8_t      len;
+    otDeviceRole role;
+
+    if(!sSocketOpen)
+    {
+        return;
+    }
+
+    role = otThreadGetDeviceRole(sInstance);
+    if(role != OT_DEVICE_ROLE_CHILD && role != OT_DEVICE_ROLE_ROUTER)
+    {
+        return;
+    }
+
+    if(otThreadGetLeaderRloc(sInstance, &leader) == OT_ERROR_NONE)
+    {
+        taskENTER_CRITICAL();
+        len = MeshTime_BuildRequest(&sClock, gpSched_GetCurrentTime(), msg);
+        taskEXIT_CRITICAL();
+
+        MeshTimeSync_Send(msg, len, &leader, MESH_TIME_UDP_PORT);
+    }
+
+    MeshTimeSync_Log();
+    MeshTimeSync_Arm(MeshTime_NextIntervalMs(&sClock));
+}
+
+uint32_t MeshTimeSync_LocalNow(void)
+{
+    return gpSched_GetCurrentTime();
+}
+
+uint32_t MeshTimeSync_Now(void)
+{
+    uint32_t mesh;
+
+    taskENTER_CRITICAL();
+    mesh = MeshTime_ToMesh(&sClock, gpSched_GetCurrentTime());
+    taskEXIT_CRITICAL();
+    return mesh;
+}
+
+uint32_t MeshTimeSync_ToLocal(uint32_t meshUs)
+{
+    uint32_t local;
+
+    taskENTER_CRITICAL();
+    local = MeshTime_ToLocal(&sClock, meshUs);
+    taskEXIT_CRITICAL();
+    return local;
+}
+
+MeshTime_State_t MeshTimeSync_GetState(void)
+{
+    MeshTime_State_t state;
+
+    taskENTER_CRITICAL();
+    state = MeshTime_GetState(&sClock, gpSched_GetCurrentTime());
+    taskEXIT_CRITICAL();
+    return state;
+}
+
+bool MeshTimeSync_IsSynced(void)
+{
+    return MeshTimeSync_GetState() != MeshTime_StateUnsynced;
+}
+
+void MeshTimeSync_GetStats(MeshTime_Stats_t* pStats)
+{
+    taskENTER_CRITICAL();
+    *pStats = sClock.stats;
+    taskEXIT_CRITICAL();
+}
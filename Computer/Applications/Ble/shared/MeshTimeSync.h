@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTimeSync.h"
+ *
+ * Mesh time service: runs the MeshTime estimator over Thread UDP.
+ *
+ *   - The Thread leader is the time master and answers requests.
+ *   - Children and routers query the leader (its RLOC) every 1 s while
+ *     acquiring and every 8 s once locked (MeshTime_NextIntervalMs()).
+ *   - A leader change is handled as a step: the new leader keeps the mesh
+ *     time it had estimated, so the time base stays continuous.
+ *
+ * Exchanges use their own UDP port so the border router can answer them
+ * with a host-side responder when it is the leader.
+ *
+ * Threading: the exchange timer only calls the application's notify hook;
+ * the application calls MeshTimeSync_Process() from its own task so all
+ * OpenThread sends happen in the same context as its other sends.
+ */
+
+#ifndef _MESH_TIME_SYNC_H_
+#define _MESH_TIME_SYNC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/thread.h>
+
+#include "MeshTime.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** UDP port for time requests and responses */
+#define MESH_TIME_UDP_PORT          5687
+
+/** Print an estimator line every N accepted exchanges (0 = off) */
+#ifndef MESH_TIME_LOG_EVERY
+#define MESH_TIME_LOG_EVERY         8
+#endif
+
+/** Called from the timer task when an exchange is due; post to the app task. */
+typedef void (*MeshTimeSync_Notify_t)(void);
+
+/** @brief Open the time socket and create the exchange timer.
+ *  Call once the Thread stack is enabled. */
+void MeshTimeSync_Init(otInstance* pInstance, MeshTimeSync_Notify_t notify);
+
+/** @brief Track the device role (call on every role change). */
+void MeshTimeSync_RoleChanged(otDeviceRole role);
+
+/** @brief Send the next request to the leader and re-arm the timer. */
+void MeshTimeSync_Process(void);
+
+/** @return Local microsecond clock (gpSched time) */
+uint32_t MeshTimeSync_LocalNow(void);
+
+/** @return Current mesh time in microseconds */
+uint32_t MeshTimeSync_Now(void);
+
+/** @return Local time at which the mesh clock reads @p meshUs */
+uint32_t MeshTimeSync_ToLocal(uint32_t meshUs);
+
+/** @return Current estimator state */
+MeshTime_State_t MeshTimeSync_GetState(void);
+
+/** @return true if mesh time can be used for scheduling (synced or master) */
+bool MeshTimeSync_IsSynced(void);
+
+/** @brief Snapshot of the exchange statistics. */
+void MeshTimeSync_GetStats(MeshTime_Stats_t* pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_TIME_SYNC_H_ */
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTlv.c"
+ *
+ * TLV frame writer and reader.
+ *
+ * The reader never trusts a length: a record whose value runs past the end
+ * of the frame stops the walk and sets the truncated flag, and the field
+ * accessors bound every access by the record length.
+ */
+
+#include "MeshTlv.h"
+
+#include <string.h>
+
+static void MeshTlv_PutBe16(uint8_t* p, uint16_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static void MeshTlv_PutBe32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static uint16_t MeshTlv_GetBe16(const uint8_t* p)
+{
+    return (uint16_t)(((uint16_t)p[0] << 8) | p[1]);
+}
+
+static uint32_t MeshTlv_GetBe32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/* -------------------------------------------------------------------------
+ * Writer
+ * ------------------------------------------------------------------------- */
+
+void MeshTlv_WriterInit(MeshTlv_Writer_t* pWriter, uint8_t* pBuf, uint16_t size,
+                        const MeshTlv_Header_t* pHeader)
+{
+    pWriter->pBuf     = pBuf;
+    pWriter->size     = size;
+    pWriter->len      = 0;
+    pWriter->overflow = (size < MESH_TLV_HEADER_LEN);
+    if(pWriter->overflow)
+    {
+        return;
+    }
+
+    pBuf[0] = MESH_TLV_MARKER | MESH_TLV_VERSION;
+    pBuf[1] = pHeader->flags;
+    pBuf[2] = pHeader->deviceType;
+    MeshTlv_PutBe32(&pBuf[3], pHeader->deviceId);
+    MeshTlv_PutBe16(&pBuf[7], pHeader->seq);
+    MeshTlv_PutBe32(&pBuf[9], pHeader->timestampUs);
+    pWriter->len = MESH_TLV_HEADER_LEN;
+}
+
+uint8_t* MeshTlv_Reserve(MeshTlv_Writer_t* pWriter, uint8_t type, uint8_t len)
+{
+    if(pWriter->overflow || pWriter->len + MESH_TLV_RECORD_HDR_LEN + len > pWriter->size)
+    {
+        pWriter->overflow = true;
+        return NULL;
+    }
+
+    uint8_t* p = &pWriter->pBuf[pWriter->len];
+    p[0] = type;
+    p[1] = len;
+    pWriter->len += (uint16_t)(MESH_TLV_RECORD_HDR_LEN + len);
+    return &p[MESH_TLV_RECORD_HDR_LEN];
+}
+
+bool MeshTlv_Put(MeshTlv_Writer_t* pWriter, uint8_t type, const void* pValue, uint8_t len)
+{
+    uint8_t* p = MeshTlv_Reserve(pWriter, type, len);
+    if(p == NULL)
+    {
+        return false;
+    }
+    memcpy(p, pValue, len);
+    return true;
+}
+
+bool MeshTlv_PutU8(MeshTlv_Writer_t* pWriter, uint8_t type, uint8_t value)
+{
+    return MeshTlv_Put(pWriter, type, &value, 1);
+}
+
+bool MeshTlv_PutU16(MeshTlv_Writer_t* pWriter, uint8_t type, uint16_t value)
+{
+    uint8_t* p = MeshTlv_Reserve(pWriter, type, 2);
+    if(p == NULL)
+    {
+        return false;
+    }
+    MeshTlv_PutBe16(p, value);
+    return true;
+}
+
+bool MeshTlv_PutU32(MeshTlv_Writer_t* pWriter, uint8_t type, uint32_t value)
+{
+    uint8_t* p = MeshTlv_Reserve(pWriter, type, 4);
+    if(p == NULL)
+    {
+        return false;
+    }
+    MeshTlv_PutBe32(p, value);
+    return true;
+}
+
+uint16_t MeshTlv_Finish(const MeshTlv_Writer_t* pWriter)
+{
+    return pWriter->overflow ? 0 : pWriter->len;
+}
+
+/* -------------------------------------------------------------------------
+ * Reader
+ * ------------------------------------------------------------------------- */
+
+MeshTlv_Result_t MeshTlv_ReaderInit(MeshTlv_Reader_t* pReader, const uint8_t* pBuf, uint16_t len,
+                                    MeshTlv_Header_t* pHeader)
+{
+    pReader->pBuf      = pBuf;
+    pReader->len       = len;
+    pReader->pos       = len;
+    pReader->truncated = false;
+
+    if(!MeshTlv_IsFrame(pBuf, len))
+    {
+        return MeshTlv_NotTlv;
+    }
+    if((pBuf[0] & ~MESH_TLV_MARKER_MASK) != MESH_TLV_VERSION)
+    {
+        return MeshTlv_BadVersion;
+    }
+    if(len < MESH_TLV_HEADER_LEN)
+    {
+        return MeshTlv_Truncated;
+    }
+
+    if(pHeader != NULL)
+    {
+        pHeader->version     = MESH_TLV_VERSION;
+        pHeader->flags       = pBuf[1];
+        pHeader->deviceType  = pBuf[2];
+        pHeader->deviceId    = MeshTlv_GetBe32(&pBuf[3]);
+        pHeader->seq         = MeshTlv_GetBe16(&pBuf[7]);
+        pHeader->timestampUs = MeshTlv_GetBe32(&pBuf[9]);
+    }
+    pReader->pos = MESH_TLV_HEADER_LEN;
+    return MeshTlv_Ok;
+}
+
+bool MeshTlv_Next(MeshTlv_Reader_t* pReader, MeshTlv_Record_t* pRecord)
+{
+    if(pReader->pos + MESH_TLV_RECORD_HDR_LEN > pReader->len)
+    {
+        pReader->truncated = (pReader->pos != pReader->len);
+        pReader->pos       = pReader->len;
+        return false;
+    }
+
+    const uint8_t* p = &pReader->pBuf[pReader->pos];
+    if(pReader->pos + MESH_TLV_RECORD_HDR_LEN + p[1] > pReader->len)
+    {
+        pReader->truncated = true;
+        pReader->pos       = pReader->len;
+        return false;
+    }
+
+    pRecord->type   = p[0];
+    pRecord->len    = p[1];
+    pRecord->pValue = &p[MESH_TLV_RECORD_HDR_LEN];
+    pReader->pos   += (uint16_t)(MESH_TLV_RECORD_HDR_LEN + p[1]);
+    return true;
+}
+
+bool MeshTlv_Find(MeshTlv_Reader_t* pReader, uint8_t type, MeshTlv_Record_t* pRecord)
+{
+    while(MeshTlv_Next(pReader, pRecord))
+    {
+        if(pRecord->type == type)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t MeshTlv_GetU8(const MeshTlv_Record_t* pRecord, uint8_t offset)
+{
+    return (offset + 1 <= pRecord->len) ? pRecord->pValue[offset] : 0;
+}
+
+uint16_t MeshTlv_GetU16(const MeshTlv_Record_t* pRecord, uint8_t offset)
+{
+    return (offset + 2 <= pRecord->len) ? MeshTlv_GetBe16(&pRecord->pValue[offset]) : 0;
+}
+
+uint32_t MeshTlv_GetU32(const MeshTlv_Record_t* pRecord, uint8_t offset)
+{
+    return (offset + 4 <= pRecord->len) ? MeshTlv_GetBe32(&pRecord->pValue[offset]) : 0;
+}
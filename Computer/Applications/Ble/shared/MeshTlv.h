@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTlv.h"
+ *
+ * Versioned TLV application protocol shared by every Thread node and the
+ * gateway (shared/gateway/mesh_tlv.py is the Python twin of this module).
+ *
+ * Frame layout (all multi-byte values big-endian):
+ *
+ *     0      marker | version    0xA0 | MESH_TLV_VERSION
+ *     1      flags               MESH_TLV_FLAG_*
+ *     2      device type         MESH_TLV_DEVICE_*
+ *     3-6    device id           low 32 bits of the factory EUI-64
+ *     7-8    sequence            per-sender frame counter
+ *     9-12   timestamp           us, mesh time if MESH_TLV_FLAG_MESH_TIME
+ *     13..   records             type (1), length (1), value (length)
+ *
+ * One frame carries any number of records.  The marker keeps TLV frames
+ * apart from the fixed-format payloads still on the same port (first byte
+ * 0x01..0x07), which receivers continue to accept.
+ *
+ * Compatibility rules:
+ *  - Readers skip record types they do not know.
+ *  - A record only ever grows: new fields are appended to its value, and
+ *    the MeshTlv_Get* accessors read missing trailing fields as 0.  An old
+ *    reader never sees the new fields, a new reader gets 0 from an old
+ *    sender.
+ *  - The version only changes if the header changes; readers reject a
+ *    version they do not know.
+ *
+ * The writer encodes in place into the caller's buffer and the reader
+ * returns records that point into the received buffer: nothing is copied
+ * or allocated.
+ *
+ * This module has no SDK dependencies so it can be built and checked on a host.
+ */
+
+#ifndef _MESH_TLV_H_
+#define _MESH_TLV_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MESH_TLV_MARKER             0xA0
+#define MESH_TLV_MARKER_MASK        0xF0
+#define MESH_TLV_VERSION            1
+
+#define MESH_TLV_HEADER_LEN         13
+#define MESH_TLV_RECORD_HDR_LEN     2
+
+/** Frame buffer size for senders: fits one 802.15.4 frame without 6LoWPAN fragmentation */
+#define MESH_TLV_MAX_FRAME          64
+
+/** Header flags */
+#define MESH_TLV_FLAG_MESH_TIME     0x01    /**< Timestamp is mesh time (sender synced) */
+
+/* -------------------------------------------------------------------------
+ * Device type registry
+ * ------------------------------------------------------------------------- */
+#define MESH_TLV_DEVICE_UNKNOWN     0x00
+#define MESH_TLV_DEVICE_DOORBELL    0x01
+#define MESH_TLV_DEVICE_MOTION      0x02
+#define MESH_TLV_DEVICE_MICROPHONE  0x03
+#define MESH_TLV_DEVICE_SPEAKER     0x04
+#define MESH_TLV_DEVICE_GATEWAY     0x05
+
+/* -------------------------------------------------------------------------
+ * Record type registry (0x00 reserved, 0xF0..0xFF experimental)
+ *
+ *  Type  Name      Value
+ *  0x01  RING      state (u8), ring count (u16), chime id (u8)
+ *  0x02  PLAY_AT   mesh time to act on the frame, us (u32)
+ *  0x03  MOTION    detected (u8), distance cm (u16)
+ *  0x04  SOUND     class (u8), level dBFS (s8), onset age ms (u16)
+ *
+ *  Diagnostics snapshot records (MeshDiag.h):
+ *  0x05  DIAG_NODE role (u8), RLOC16 (u16), parent RLOC16 (u16, 0xFFFF =
+ *                  none), partition id (u32), uptime s (u32)
+ *  0x06  DIAG_MLE  attach attempts, parent changes, partition changes,
+ *                  times detached (u16 each)
+ *  0x07  DIAG_MAC  tx frames, tx retries, CCA failures, tx failures, rx
+ *                  frames, rx errors (u32 each, since boot)
+ *  0x08  DIAG_BUF  message buffers total, free, most used (u16 each)
+ *  0x09  NEIGHBOR  RLOC16 (u16), average RSSI dBm (s8), link margin dB
+ *                  (u8), link quality in (u8), MESH_TLV_NEIGHBOR_* flags
+ *                  (u8), frame error rate % (u8); one record per neighbor
+ *  0x0B  DIAG_TXPOWER  tx power dBm (s8), full power dBm (s8), worst link
+ *                  margin dB (u8), retry % (u8), limiting neighbor RLOC16
+ *                  (u16), power changes (u16), last reason (u8); 0xFF =
+ *                  not known (MeshTxPower.h)
+ *  0x0C  DIAG_ROLE role policy (u8), leader weight (u8), role changes,
+ *                  router upgrades, router downgrades, leader terms,
+ *                  detaches (u16 each), seconds in the role (u32)
+ *                  (MeshRole.h)
+ *  0x0D  DIAG_RECOVERY  last detach reason (u8), outages lasting < 2 s,
+ *                  < 5 s, < 15 s, < 60 s, < 300 s, longer (u16 each), last,
+ *                  longest and current outage ms (u32 each), detaches per
+ *                  reason: parent lost, partition lost, dataset changed,
+ *                  events deferred, held events expired, attach restarts
+ *                  (u16 each) (MeshRecovery.h)
+ *
+ *  0x0A  AUTH      frame counter (u32), AES-CCM tag (8 bytes); last record
+ *                  of the frame, covers all bytes before the tag (MeshAuth.h)
+ * ------------------------------------------------------------------------- */
+#define MESH_TLV_REC_RING           0x01
+#define MESH_TLV_REC_PLAY_AT        0x02
+#define MESH_TLV_REC_MOTION         0x03
+#define MESH_TLV_REC_SOUND          0x04
+#define MESH_TLV_REC_DIAG_NODE      0x05
+#define MESH_TLV_REC_DIAG_MLE       0x06
+#define MESH_TLV_REC_DIAG_MAC       0x07
+#define MESH_TLV_REC_DIAG_BUF       0x08
+#define MESH_TLV_REC_NEIGHBOR       0x09
+#define MESH_TLV_REC_AUTH           0x0A
+#define MESH_TLV_REC_DIAG_TXPOWER   0x0B
+#define MESH_TLV_REC_DIAG_ROLE      0x0C
+#define MESH_TLV_REC_DIAG_RECOVERY  0x0D
+
+#define MESH_TLV_RING_LEN           4
+#define MESH_TLV_PLAY_AT_LEN        4
+#define MESH_TLV_MOTION_LEN         3
+#define MESH_TLV_SOUND_LEN          4
+#define MESH_TLV_DIAG_NODE_LEN      13
+#define MESH_TLV_DIAG_MLE_LEN       8
+#define MESH_TLV_DIAG_MAC_LEN       24
+#define MESH_TLV_DIAG_BUF_LEN       6
+#define MESH_TLV_NEIGHBOR_LEN       7
+#define MESH_TLV_AUTH_LEN           12
+#define MESH_TLV_DIAG_TXPOWER_LEN   9
+#define MESH_TLV_DIAG_ROLE_LEN      16
+#define MESH_TLV_DIAG_RECOVERY_LEN  37
+
+/** NEIGHBOR record flags */
+#define MESH_TLV_NEIGHBOR_CHILD     0x01    /**< The neighbor is our child */
+#define MESH_TLV_NEIGHBOR_PARENT    0x02    /**< The neighbor is our parent */
+#define MESH_TLV_NEIGHBOR_RX_ON     0x04    /**< Receiver on when idle (not sleepy) */
+
+typedef struct
+{
+    uint8_t  version;
+    uint8_t  flags;
+    uint8_t  deviceType;
+    uint32_t deviceId;
+    uint16_t seq;
+    uint32_t timestampUs;
+} MeshTlv_Header_t;
+
+typedef struct
+{
+    uint8_t* pBuf;
+    uint16_t size;
+    uint16_t len;
+    bool     overflow;      /**< A record did not fit; MeshTlv_Finish returns 0 */
+} MeshTlv_Writer_t;
+
+typedef struct
+{
+    uint8_t        type;
+    uint8_t        len;
+    const uint8_t* pValue;  /**< Points into the received frame */
+} MeshTlv_Record_t;
+
+typedef struct
+{
+    const uint8_t* pBuf;
+    uint16_t       len;
+    uint16_t       pos;
+    bool           truncated;   /**< The last record ran past the end of the frame */
+} MeshTlv_Reader_t;
+
+typedef enum
+{
+    MeshTlv_Ok = 0,
+    MeshTlv_NotTlv,         /**< Not a TLV frame (legacy payload) */
+    MeshTlv_BadVersion,     /**< TLV frame of an unknown version */
+    MeshTlv_Truncated       /**< Shorter than the header */
+} MeshTlv_Result_t;
+
+/** @brief True if @p pBuf starts a TLV frame (of any version). */
+static inline bool MeshTlv_IsFrame(const uint8_t* pBuf, uint16_t len)
+{
+    return len >= 1 && (pBuf[0] & MESH_TLV_MARKER_MASK) == MESH_TLV_MARKER;
+}
+
+/* -------------------------------------------------------------------------
+ * Writer
+ * ------------------------------------------------------------------------- */
+
+/** @brief Start a frame in @p pBuf and write its header. */
+void MeshTlv_WriterInit(MeshTlv_Writer_t* pWriter, uint8_t* pBuf, uint16_t size,
+                        const MeshTlv_Header_t* pHeader);
+
+/** @brief Append a record header and return its value area for the caller to fill.
+ *  @return NULL if the record does not fit (the frame is then marked overflowed). */
+uint8_t* MeshTlv_Reserve(MeshTlv_Writer_t* pWriter, uint8_t type, uint8_t len);
+
+/** @brief Append a record with value @p pValue. */
+bool MeshTlv_Put(MeshTlv_Writer_t* pWriter, uint8_t type, const void* pValue, uint8_t len);
+
+bool MeshTlv_PutU8(MeshTlv_Writer_t* pWriter, uint8_t type, uint8_t value);
+bool MeshTlv_PutU16(MeshTlv_Writer_t* pWriter, uint8_t type, uint16_t value);
+bool MeshTlv_PutU32(MeshTlv_Writer_t* pWriter, uint8_t type, uint32_t value);
+
+/** @return Frame length, or 0 if any record overflowed the buffer */
+uint16_t MeshTlv_Finish(const MeshTlv_Writer_t* pWriter);
+
+/* -------------------------------------------------------------------------
+ * Reader
+ * ------------------------------------------------------------------------- */
+
+/** @brief Parse the header of a received frame and position the reader on its first record. */
+MeshTlv_Result_t MeshTlv_ReaderInit(MeshTlv_Reader_t* pReader, const uint8_t* pBuf, uint16_t len,
+                                    MeshTlv_Header_t* pHeader);
+
+/** @brief Next record, unknown types included.
+ *  @return false at the end of the frame or on a truncated record */
+bool MeshTlv_Next(MeshTlv_Reader_t* pReader, MeshTlv_Record_t* pRecord);
+
+/** @brief First record of @p type after the reader's position. */
+bool MeshTlv_Find(MeshTlv_Reader_t* pReader, uint8_t type, MeshTlv_Record_t* pRecord);
+
+/** Field accessors: @p offset is the field's byte offset in the value; fields
+ *  past the end of the record (older sender) read as 0. */
+uint8_t  MeshTlv_GetU8(const MeshTlv_Record_t* pRecord, uint8_t offset);
+uint16_t MeshTlv_GetU16(const MeshTlv_Record_t* pRecord, uint8_t offset);
+uint32_t MeshTlv_GetU32(const MeshTlv_Record_t* pRecord, uint8_t offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_TLV_H_ */
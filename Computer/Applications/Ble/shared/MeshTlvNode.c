@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTlvNode.c"
+ *
+ * TLV frame header for this node.
+ */
+
+#include "MeshTlvNode.h"
+
+#include "MeshAuth.h"
+#include "MeshTimeSync.h"
+
+#include <openthread/link.h>
+#include <openthread/random_noncrypto.h>
+
+static uint8_t  sDeviceType = MESH_TLV_DEVICE_UNKNOWN;
+static uint32_t sDeviceId   = 0;
+static uint16_t sSeq        = 0;
+
+void MeshTlvNode_Init(otInstance* pInstance, uint8_t deviceType)
+{
+    otExtAddress eui64;
+
+    otLinkGetFactoryAssignedIeeeEui64(pInstance, &eui64);
+    sDeviceType = deviceType;
+    sDeviceId   = ((uint32_t)eui64.m8[4] << 24) | ((uint32_t)eui64.m8[5] << 16) |
+                  ((uint32_t)eui64.m8[6] << 8) | eui64.m8[7];
+    sSeq        = otRandomNonCryptoGetUint16();
+}
+
+void MeshTlvNode_Begin(MeshTlv_Writer_t* pWriter, uint8_t* pBuf, uint16_t size,
+                       MeshTlv_Header_t* pHeader)
+{
+    MeshTlv_Header_t header;
+
+    header.version     = MESH_TLV_VERSION;
+    header.flags       = MeshTimeSync_IsSynced() ? MESH_TLV_FLAG_MESH_TIME : 0;
+    header.deviceType  = sDeviceType;
+    header.deviceId    = sDeviceId;
+    header.seq         = ++sSeq;
+    header.timestampUs = MeshTimeSync_Now();
+    MeshTlv_WriterInit(pWriter, pBuf, size, &header);
+
+    if(pHeader != NULL)
+    {
+        *pHeader = header;
+    }
+}
+
+uint16_t MeshTlvNode_Finish(MeshTlv_Writer_t* pWriter)
+{
+    MeshAuth_Sign(pWriter);
+    return MeshTlv_Finish(pWriter);
+}
+
+uint32_t MeshTlvNode_GetDeviceId(void)
+{
+    return sDeviceId;
+}
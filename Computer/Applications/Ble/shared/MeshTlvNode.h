@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTlvNode.h"
+ *
+ * Node side of the TLV protocol (MeshTlv.h): fills in the frame header of
+ * this device.
+ *
+ *   - Device id: low 32 bits of the factory-assigned EUI-64, so it stays
+ *     the same across factory resets and re-commissioning.
+ *   - Sequence: incremented for every frame; restarts at a random value
+ *     after a reboot so receivers do not mistake new frames for repeats.
+ *   - Timestamp: MeshTimeSync_Now(), flagged as mesh time once synced.
+ *   - Authentication: event frames end with an AUTH record once the node
+ *     has a key (MeshAuth.h).
+ */
+
+#ifndef _MESH_TLV_NODE_H_
+#define _MESH_TLV_NODE_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "MeshTlv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Read the device id; call once after the OpenThread instance exists. */
+void MeshTlvNode_Init(otInstance* pInstance, uint8_t deviceType);
+
+/** @brief Start a frame from this node in @p pBuf (header only, add records next).
+ *  @param pHeader If not NULL, receives the header that was written */
+void MeshTlvNode_Begin(MeshTlv_Writer_t* pWriter, uint8_t* pBuf, uint16_t size,
+                       MeshTlv_Header_t* pHeader);
+
+/** @brief Close a frame from this node: adds the AUTH record if the node has a key (MeshAuth.h).
+ *  @return Frame length, or 0 if a record did not fit */
+uint16_t MeshTlvNode_Finish(MeshTlv_Writer_t* pWriter);
+
+/** @return This node's device id (header field) */
+uint32_t MeshTlvNode_GetDeviceId(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_TLV_NODE_H_ */
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTxPower.c"
+ *
+ * Adaptive transmit power.  The window counters and the power are only
+ * touched in the application task; the OpenThread context only raises
+ * sResetDue.
+ */
+
+#include "MeshTxPower.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "MeshDiag.h"
+
+#include "gpLog.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+#include <openthread/platform/radio.h>
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+/* Changes after which the power goes back to full */
+#define MESH_TXPOWER_RESET_FLAGS    (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID)
+
+/* MLE link quality out: 3 = margin above 20 dB, 2 = above 10 dB, 1 = above 2 dB, 0 = not known */
+#define MESH_TXPOWER_LQ_GOOD        3
+#define MESH_TXPOWER_LQ_WEAK        1
+
+#define MESH_TXPOWER_NO_NEIGHBOR    0xFFFF
+
+static otInstance*          sInstance = NULL;
+static MeshTxPower_Notify_t sNotify   = NULL;
+static bool                 sEnabled  = false;
+static volatile bool        sResetDue = false;
+
+static MeshTxPower_Status_t sStatus;
+
+/* Window counters: MAC totals at the start of the window */
+static uint32_t             sAcked;
+static uint32_t             sRetries;
+static uint32_t             sFailed;
+
+static uint8_t              sDownWindows = 0;
+static uint8_t              sHoldWindows = 0;
+
+static StaticTimer_t        sTimerBuffer;
+static TimerHandle_t        sTimer = NULL;
+
+static void MeshTxPower_Notify(void)
+{
+    if(sNotify != NULL)
+    {
+        sNotify();
+    }
+}
+
+static void MeshTxPower_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+
+    MeshTxPower_Notify();
+}
+
+static void MeshTxPower_Arm(void)
+{
+    if(sTimer != NULL)
+    {
+        xTimerChangePeriod(sTimer, pdMS_TO_TICKS(MESH_TXPOWER_INTERVAL_MS), 0);
+    }
+}
+
+static uint32_t MeshTxPower_FailedTotal(const otMacCounters* pMac)
+{
+    /* Indirect frames to a sleepy child are left out: a child that left fails them too */
+    return pMac->mTxDirectMaxRetryExpiry;
+}
+
+/* Start a new window */
+static void MeshTxPower_Sample(void)
+{
+    const otMacCounters* pMac = otLinkGetCounters(sInstance);
+
+    sAcked   = pMac->mTxAckRequested;
+    sRetries = pMac->mTxRetry;
+    sFailed  = MeshTxPower_FailedTotal(pMac);
+}
+
+/* Margin of one link as the neighbor sees us, from the RSSI of its frames here */
+static int16_t MeshTxPower_MarginOut(int8_t avgRssi)
+{
+    if(avgRssi == OT_RADIO_RSSI_INVALID)
+    {
+        return INT16_MAX;
+    }
+    return (int16_t)avgRssi - otPlatRadioGetReceiveSensitivity(sInstance) - (sStatus.maxDbm - sStatus.dbm);
+}
+
+static void MeshTxPower_Worse(int16_t margin, uint16_t rloc16, int16_t* pWorst, uint16_t* pLimit)
+{
+    if(margin < *pWorst)
+    {
+        *pWorst = margin;
+        *pLimit = rloc16;
+    }
+}
+
+/* Worst estimated margin over the links this node depends on, and the
+ * worst link quality out reported by a router neighbor */
+static int16_t MeshTxPower_WorstLink(otDeviceRole role, uint16_t* pLimit, uint8_t* pLqOut)
+{
+    otNeighborInfoIterator iterator = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighbor;
+    otRouterInfo           router;
+    int8_t                 rssi  = OT_RADIO_RSSI_INVALID;
+    int16_t                worst = INT16_MAX;
+
+    *pLimit = MESH_TXPOWER_NO_NEIGHBOR;
+    *pLqOut = MESH_TXPOWER_LQ_GOOD;
+
+    if(role == OT_DEVICE_ROLE_CHILD)
+    {
+        if(otThreadGetParentInfo(sInstance, &router) == OT_ERROR_NONE &&
+           otThreadGetParentAverageRssi(sInstance, &rssi) == OT_ERROR_NONE)
+        {
+            MeshTxPower_Worse(MeshTxPower_MarginOut(rssi), router.mRloc16, &worst, pLimit);
+        }
+        return worst;
+    }
+
+    while(otThreadGetNextNeighborInfo(sInstance, &iterator, &neighbor) == OT_ERROR_NONE)
+    {
+        MeshTxPower_Worse(MeshTxPower_MarginOut(neighbor.mAverageRssi), neighbor.mRloc16, &worst, pLimit);
+
+        if(!neighbor.mIsChild &&
+           otThreadGetRouterInfo(sInstance, (uint16_t)(neighbor.mRloc16 >> 10), &router) == OT_ERROR_NONE &&
+           router.mLinkEstablished && router.mLinkQualityOut != 0 && router.mLinkQualityOut < *pLqOut)
+        {
+            *pLqOut = router.mLinkQualityOut;
+        }
+    }
+    return worst;
+}
+
+static uint8_t MeshTxPower_MarginByte(int16_t margin)
+{
+    if(margin == INT16_MAX)
+    {
+        return MESH_TXPOWER_UNKNOWN;
+    }
+    if(margin < 0)
+    {
+        return 0;
+    }
+    return (margin >= MESH_TXPOWER_UNKNOWN) ? (MESH_TXPOWER_UNKNOWN - 1) : (uint8_t)margin;
+}
+
+/* Set the power; false if the radio kept the old one (it only has discrete levels) */
+static bool MeshTxPower_Set(int8_t dbm, MeshTxPower_Reason_t reason)
+{
+    int8_t actual = dbm;
+    int8_t old    = sStatus.dbm;
+
+    if(otPlatRadioSetTransmitPower(sInstance, dbm) != OT_ERROR_NONE)
+    {
+        return false;
+    }
+    (void)otPlatRadioGetTransmitPower(sInstance, &actual);
+    if(actual == old)
+    {
+        return false;
+    }
+
+    sStatus.dbm    = actual;
+    sStatus.reason = (uint8_t)reason;
+    sStatus.changes++;
+
+    GP_LOG_SYSTEM_PRINTF("[TxPwr] %d -> %d dBm (reason %u): margin %d dB at %04x, retry %d%%", 0, old, actual,
+                         (unsigned)reason, (sStatus.marginDb == MESH_TXPOWER_UNKNOWN) ? -1 : (int)sStatus.marginDb,
+                         sStatus.limitRloc16,
+                         (sStatus.retryPct == MESH_TXPOWER_UNKNOWN) ? -1 : (int)sStatus.retryPct);
+    MeshDiag_Request();
+    return true;
+}
+
+static void MeshTxPower_StepUp(MeshTxPower_Reason_t reason)
+{
+    int16_t dbm = sStatus.dbm + MESH_TXPOWER_UP_STEP_DB;
+
+    for(dbm = (dbm > sStatus.maxDbm) ? sStatus.maxDbm : dbm; dbm <= sStatus.maxDbm; dbm++)
+    {
+        if(MeshTxPower_Set((int8_t)dbm, reason))
+        {
+            break;
+        }
+    }
+    sDownWindows = 0;
+    sHoldWindows = MESH_TXPOWER_HOLD_WINDOWS;
+}
+
+static void MeshTxPower_StepDown(int8_t floorDbm)
+{
+    int16_t dbm;
+
+    for(dbm = sStatus.dbm - MESH_TXPOWER_DOWN_STEP_DB; dbm >= floorDbm; dbm--)
+    {
+        if(MeshTxPower_Set((int8_t)dbm, MeshTxPower_Down))
+        {
+            break;
+        }
+    }
+    sDownWindows = 0;
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+
+void MeshTxPower_Init(otInstance* pInstance, MeshTxPower_Notify_t notify)
+{
+    int8_t dbm;
+
+    sInstance = pInstance;
+    sNotify   = notify;
+    memset(&sStatus, 0, sizeof(sStatus));
+    sStatus.marginDb    = MESH_TXPOWER_UNKNOWN;
+    sStatus.retryPct    = MESH_TXPOWER_UNKNOWN;
+    sStatus.limitRloc16 = MESH_TXPOWER_NO_NEIGHBOR;
+
+    sEnabled = MESH_TXPOWER_ADAPTIVE && otPlatRadioGetTransmitPower(pInstance, &dbm) == OT_ERROR_NONE;
+    if(!sEnabled)
+    {
+        GP_LOG_SYSTEM_PRINTF("[TxPwr] Fixed power", 0);
+        return;
+    }
+    sStatus.dbm    = dbm;
+    sStatus.maxDbm = dbm;
+    MeshTxPower_Sample();
+
+    if(sTimer == NULL)
+    {
+        sTimer = xTimerCreateStatic("MeshTxPwr", pdMS_TO_TICKS(MESH_TXPOWER_INTERVAL_MS), pdFALSE, NULL,
+                                    MeshTxPower_TimerCallback, &sTimerBuffer);
+    }
+    MeshTxPower_Arm();
+}
+
+void MeshTxPower_StateChanged(uint32_t flags)
+{
+    if(sEnabled && (flags & MESH_TXPOWER_RESET_FLAGS))
+    {
+        sResetDue = true;
+        MeshTxPower_Notify();
+    }
+}
+
+void MeshTxPower_Process(void)
+{
+    const otMacCounters* pMac;
+    otDeviceRole         role;
+    uint32_t             acked;
+    uint32_t             retries;
+    uint32_t             failed;
+    int16_t              worst;
+    uint8_t              lqOut;
+    int8_t               floorDbm;
+
+    if(!sEnabled)
+    {
+        return;
+    }
+
+    role = otThreadGetDeviceRole(sInstance);
+    if(sResetDue || role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED)
+    {
+        sResetDue    = false;
+        sDownWindows = 0;
+        sHoldWindows = MESH_TXPOWER_HOLD_WINDOWS;
+        if(sStatus.dbm != sStatus.maxDbm)
+        {
+            (void)MeshTxPower_Set(sStatus.maxDbm, MeshTxPower_Reset);
+        }
+        MeshTxPower_Sample();
+        MeshTxPower_Arm();
+        return;
+    }
+
+    pMac    = otLinkGetCounters(sInstance);
+    acked   = pMac->mTxAckRequested - sAcked;
+    retries = pMac->mTxRetry - sRetries;
+    failed  = MeshTxPower_FailedTotal(pMac) - sFailed;
+    MeshTxPower_Sample();
+
+    worst            = MeshTxPower_WorstLink(role, &sStatus.limitRloc16, &lqOut);
+    sStatus.marginDb = MeshTxPower_MarginByte(worst);
+    sStatus.retryPct = (acked < MESH_TXPOWER_MIN_FRAMES) ? MESH_TXPOWER_UNKNOWN
+                       : (retries >= acked)              ? 100
+                                                         : (uint8_t)(retries * 100 / acked);
+    floorDbm         = (role == OT_DEVICE_ROLE_CHILD) ? MESH_TXPOWER_MIN_DBM : MESH_TXPOWER_ROUTER_MIN_DBM;
+
+    if(sHoldWindows > 0)
+    {
+        sHoldWindows--;
+    }
+
+    if(failed > 0 || (sStatus.retryPct != MESH_TXPOWER_UNKNOWN && sStatus.retryPct > MESH_TXPOWER_RETRY_HIGH_PCT))
+    {
+        if(sStatus.dbm < sStatus.maxDbm)
+        {
+            MeshTxPower_StepUp(MeshTxPower_UpRetry);
+        }
+    }
+    else if(worst < MESH_TXPOWER_MARGIN_LOW_DB || lqOut <= MESH_TXPOWER_LQ_WEAK)
+    {
+        if(sStatus.dbm < sStatus.maxDbm)
+        {
+            MeshTxPower_StepUp(MeshTxPower_UpMargin);
+        }
+    }
+    else if(worst != INT16_MAX && worst >= MESH_TXPOWER_MARGIN_HIGH_DB && lqOut >= MESH_TXPOWER_LQ_GOOD &&
+            (sStatus.retryPct == MESH_TXPOWER_UNKNOWN || sStatus.retryPct <= MESH_TXPOWER_RETRY_LOW_PCT) &&
+            sStatus.dbm > floorDbm)
+    {
+        if(++sDownWindows >= MESH_TXPOWER_DOWN_WINDOWS && sHoldWindows == 0)
+        {
+            MeshTxPower_StepDown(floorDbm);
+        }
+    }
+    else
+    {
+        sDownWindows = 0;
+    }
+
+    MeshTxPower_Arm();
+}
+
+void MeshTxPower_GetStatus(MeshTxPower_Status_t* pStatus)
+{
+    *pStatus = sStatus;
+}
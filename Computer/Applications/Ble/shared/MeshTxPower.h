@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "MeshTxPower.h"
+ *
+ * Link-quality adaptive 802.15.4 transmit power.
+ *
+ * The BSP starts every node at its full power (10 dBm on the DK), also
+ * when its parent is a metre away.  Every MESH_TXPOWER_INTERVAL_MS this
+ * module checks the links the node depends on and moves the radio power
+ * between MESH_TXPOWER_MIN_DBM and the BSP power:
+ *
+ *   - a child: its parent;
+ *   - a router or leader: every neighbor, routers and children.
+ *
+ * For each link it estimates the margin the neighbor has on our frames.
+ * Links are taken as reciprocal and the neighbor as sending at full
+ * power, so
+ *
+ *     margin out = RSSI margin of its frames here - (full power - our power)
+ *
+ * This is never more than the real margin, when the neighbor also runs
+ * at reduced power it is less.  Router neighbors also report how they
+ * hear us (MLE link quality out, 1..3), which is used as is.
+ * The MAC retry rate of the window (retries per acknowledged frame) and
+ * frames that failed after all retries check the result.
+ *
+ *   - Up MESH_TXPOWER_UP_STEP_DB, at once: the worst margin below
+ *     MESH_TXPOWER_MARGIN_LOW_DB, a router neighbor at link quality out 1,
+ *     retries above MESH_TXPOWER_RETRY_HIGH_PCT, or a failed frame.
+ *   - Down MESH_TXPOWER_DOWN_STEP_DB: the worst margin at or above
+ *     MESH_TXPOWER_MARGIN_HIGH_DB, no router neighbor below link quality
+ *     out 3, retries at most MESH_TXPOWER_RETRY_LOW_PCT, and that for
+ *     MESH_TXPOWER_DOWN_WINDOWS windows in a row, not sooner than
+ *     MESH_TXPOWER_HOLD_WINDOWS windows after a step up.
+ *
+ * In between the power holds.  The retry rate only counts with
+ * MESH_TXPOWER_MIN_FRAMES acknowledged frames in the window, which a
+ * sleepy child seldom reaches; it then goes on margin alone.
+ *
+ * A detached node, a new role or a new partition goes back to full power
+ * at once, so attaching never runs at reduced power.  Routers stay at or
+ * above MESH_TXPOWER_ROUTER_MIN_DBM: their advertisements must still reach
+ * nodes that are not neighbors yet.
+ *
+ * OpenThread has one transmit power for all frames, not one per
+ * destination: the weakest link sets it.  On a child, the usual battery
+ * node, that is the only link.
+ *
+ * Every change is logged and requests an early diagnostics snapshot,
+ * which carries the state in its DIAG_TXPOWER record (MeshDiag.h).
+ *
+ * Threading: the timer and MeshTxPower_StateChanged() only call the
+ * application's notify hook; the application calls MeshTxPower_Process()
+ * from its own task.
+ */
+
+#ifndef _MESH_TXPOWER_H_
+#define _MESH_TXPOWER_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Evaluation window */
+#ifndef MESH_TXPOWER_INTERVAL_MS
+#define MESH_TXPOWER_INTERVAL_MS    20000
+#endif
+
+/** Lowest power of an end device, and of a router */
+#ifndef MESH_TXPOWER_MIN_DBM
+#define MESH_TXPOWER_MIN_DBM        (-10)
+#endif
+#define MESH_TXPOWER_ROUTER_MIN_DBM 0
+
+/** Hysteresis band of the worst estimated link margin */
+#define MESH_TXPOWER_MARGIN_LOW_DB  15
+#define MESH_TXPOWER_MARGIN_HIGH_DB 25
+
+/** MAC retries per acknowledged frame, %, and the frames needed to count */
+#define MESH_TXPOWER_RETRY_LOW_PCT  5
+#define MESH_TXPOWER_RETRY_HIGH_PCT 15
+#define MESH_TXPOWER_MIN_FRAMES     10
+
+/** Steps: up fast, down slowly */
+#define MESH_TXPOWER_UP_STEP_DB     4
+#define MESH_TXPOWER_DOWN_STEP_DB   2
+#define MESH_TXPOWER_DOWN_WINDOWS   2
+#define MESH_TXPOWER_HOLD_WINDOWS   6
+
+/** Margin / retry rate not known */
+#define MESH_TXPOWER_UNKNOWN        0xFF
+
+/** Set this to 0 to keep the BSP power */
+#ifndef MESH_TXPOWER_ADAPTIVE
+#define MESH_TXPOWER_ADAPTIVE       1
+#endif
+
+typedef enum
+{
+    MeshTxPower_None     = 0,  /**< No change yet */
+    MeshTxPower_Down     = 1,  /**< Margin to spare */
+    MeshTxPower_UpMargin = 2,  /**< Weak link */
+    MeshTxPower_UpRetry  = 3,  /**< Retries or failed frames */
+    MeshTxPower_Reset    = 4,  /**< Detached, new role or partition: full power */
+} MeshTxPower_Reason_t;
+
+typedef struct
+{
+    int8_t   dbm;           /**< Current power */
+    int8_t   maxDbm;        /**< BSP power */
+    uint8_t  marginDb;      /**< Worst estimated margin of the last window, or MESH_TXPOWER_UNKNOWN */
+    uint8_t  retryPct;      /**< Retry rate of the last window, or MESH_TXPOWER_UNKNOWN */
+    uint16_t limitRloc16;   /**< Neighbor with the worst margin */
+    uint16_t changes;       /**< Power changes since boot */
+    uint8_t  reason;        /**< MeshTxPower_Reason_t of the last change */
+} MeshTxPower_Status_t;
+
+/** Called from the timer task or the OpenThread context; post to the app task. */
+typedef void (*MeshTxPower_Notify_t)(void);
+
+/** @brief Read the BSP power and start the evaluation timer. */
+void MeshTxPower_Init(otInstance* pInstance, MeshTxPower_Notify_t notify);
+
+/** @brief Call from the OpenThread state-changed callback with its flags. */
+void MeshTxPower_StateChanged(uint32_t flags);
+
+/** @brief Evaluate the window and adjust the power.  Call from the app task on the notify hook. */
+void MeshTxPower_Process(void);
+
+/** @brief Current state, for diagnostics. */
+void MeshTxPower_GetStatus(MeshTxPower_Status_t* pStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MESH_TXPOWER_H_ */
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Lock-free SPSC PCM ring.  On the single-core Cortex-M4 aligned 32-bit
+ * loads/stores are atomic, so only a compiler barrier is needed to keep the
+ * sample copy ordered before the index that publishes it.
+ */
+
+#include "AudioRing.h"
+
+#define AUDIO_RING_BARRIER()  __asm volatile("" ::: "memory")
+
+void AudioRing_Init(AudioRing_t* pRing, int16_t* pBuffer, uint32_t capacity)
+{
+    pRing->pBuffer = pBuffer;
+    pRing->mask    = capacity - 1;
+    pRing->head    = 0;
+    pRing->tail    = 0;
+}
+
+uint32_t AudioRing_Level(const AudioRing_t* pRing)
+{
+    return pRing->head - pRing->tail;
+}
+
+uint32_t AudioRing_Free(const AudioRing_t* pRing)
+{
+    return (pRing->mask + 1) - (pRing->head - pRing->tail);
+}
+
+uint32_t AudioRing_Write(AudioRing_t* pRing, const int16_t* pPcm, uint32_t n)
+{
+    uint32_t head  = pRing->head;
+    uint32_t space = (pRing->mask + 1) - (head - pRing->tail);
+
+    if(n > space)
+    {
+        n = space;
+    }
+    for(uint32_t i = 0; i < n; i++)
+    {
+        pRing->pBuffer[(head + i) & pRing->mask] = pPcm[i];
+    }
+
+    AUDIO_RING_BARRIER();
+    pRing->head = head + n;
+    return n;
+}
+
+uint32_t AudioRing_Read(AudioRing_t* pRing, int16_t* pPcm, uint32_t n)
+{
+    uint32_t tail  = pRing->tail;
+    uint32_t level = pRing->head - tail;
+
+    if(n > level)
+    {
+        n = level;
+    }
+    AUDIO_RING_BARRIER();
+    for(uint32_t i = 0; i < n; i++)
+    {
+        pPcm[i] = pRing->pBuffer[(tail + i) & pRing->mask];
+    }
+
+    AUDIO_RING_BARRIER();
+    pRing->tail = tail + n;
+    return n;
+}
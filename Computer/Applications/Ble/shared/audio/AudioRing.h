@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Lock-free single-producer / single-consumer ring of 16-bit PCM samples.
+ *
+ * The producer (mixer / chime task) only moves head, the consumer (DAC
+ * interrupt) only moves tail, so neither side needs a critical section.
+ * Indices run freely and wrap at 2^32; capacity must be a power of two.
+ *
+ * No SDK dependencies (host-buildable).
+ */
+
+#ifndef _AUDIORING_H_
+#define _AUDIORING_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int16_t*          pBuffer;
+    uint32_t          mask;     /* capacity - 1 */
+    volatile uint32_t head;     /* Total samples written, producer only */
+    volatile uint32_t tail;     /* Total samples read, consumer only */
+} AudioRing_t;
+
+/** @brief Attach a buffer; @p capacity must be a power of two. */
+void AudioRing_Init(AudioRing_t* pRing, int16_t* pBuffer, uint32_t capacity);
+
+/** @brief Samples available to the consumer. */
+uint32_t AudioRing_Level(const AudioRing_t* pRing);
+
+/** @brief Space available to the producer. */
+uint32_t AudioRing_Free(const AudioRing_t* pRing);
+
+/** @brief Producer: copy up to @p n samples in. @return samples written */
+uint32_t AudioRing_Write(AudioRing_t* pRing, const int16_t* pPcm, uint32_t n);
+
+/** @brief Consumer: copy up to @p n samples out. @return samples read */
+uint32_t AudioRing_Read(AudioRing_t* pRing, int16_t* pPcm, uint32_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _AUDIORING_H_
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Wavetable chime synthesiser.
+ *
+ * Cost per output sample and active voice: two interpolated table reads,
+ * two multiplies and an add (~25 cycles on the Cortex-M4), so four voices
+ * at 15.6 kHz take about 1.5 M cycles/s, ~2.5 % of the 64 MHz CPU.
+ */
+
+#include "ChimeSynth.h"
+
+#include <string.h>
+
+/* 2.76 in Q8: second mode of a free-free bar (tubular chime) */
+#define PARTIAL_RATIO_Q8      707
+/* Partial starts at 35 % of the fundamental and decays 2.5x faster */
+#define PARTIAL_LEVEL_Q15     11469
+#define PARTIAL_DECAY_DIV     5
+#define PARTIAL_DECAY_MUL     2
+
+#define ATTACK_BLOCKS         2       /* ~2 ms at 15.6 kHz */
+#define RELEASE_BLOCKS        8       /* Fade used by ChimeSynth_Stop() */
+#define ENV_SILENT_Q15        100     /* ~ -50 dB: voice is freed */
+
+#define VOLUME_DEFAULT_PCT    60
+
+/* One period of sin(), Q15, plus a guard point for interpolation */
+static const int16_t sineTable[257] = {
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+      6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+     18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+     27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+     32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+     32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+     27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+     18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+      6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+     -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+    -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+    -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+    -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+    -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+     -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+         0
+};
+
+/* -------------------------------------------------------------------------
+ * Chime library (flash)
+ * ------------------------------------------------------------------------- */
+static const ChimeSynth_Note_t dingDongNotes[] = {
+    {659, 0, 700, 120},    /* E5 */
+    {523, 550, 1100, 120}, /* C5 */
+};
+
+static const ChimeSynth_Note_t westminsterNotes[] = {
+    {659, 0, 900, 100},    /* E5 */
+    {523, 450, 900, 100},  /* C5 */
+    {587, 900, 900, 100},  /* D5 */
+    {392, 1350, 1400, 110}, /* G4 */
+};
+
+static const ChimeSynth_Note_t tripleNotes[] = {
+    {1047, 0, 450, 100},   /* C6 */
+    {1319, 150, 450, 100}, /* E6 */
+    {1568, 300, 700, 100}, /* G6 */
+};
+
+static const ChimeSynth_Note_t alertNotes[] = {
+    {880, 0, 90, 150},     /* A5 */
+    {880, 250, 90, 150},
+    {880, 500, 90, 150},
+};
+
+#define NOTES(_n) _n, (uint8_t)(sizeof(_n) / sizeof(_n[0]))
+
+const ChimeSynth_Chime_t ChimeSynth_Library[CHIME_COUNT] = {
+    [CHIME_DING_DONG]   = {"ding-dong", NOTES(dingDongNotes), 3500},
+    [CHIME_WESTMINSTER] = {"westminster", NOTES(westminsterNotes), 5000},
+    [CHIME_TRIPLE]      = {"triple", NOTES(tripleNotes), 1800},
+    [CHIME_ALERT]       = {"alert", NOTES(alertNotes), 1000},
+};
+
+/* -------------------------------------------------------------------------
+ * Voices
+ * ------------------------------------------------------------------------- */
+typedef struct {
+    uint32_t phase[2];      /* Fundamental, partial: 8.24 table index */
+    uint32_t step[2];
+    int32_t  env[2];        /* Current envelope, Q15 */
+    int32_t  peak;          /* Attack target of the fundamental, Q15 */
+    int32_t  decay[2];      /* Per-control-block multiplier, Q15 */
+    uint8_t  attack;        /* Attack blocks left */
+    bool     active;
+} Voice_t;
+
+static Voice_t  voices[CHIME_SYNTH_NUM_VOICES];
+static uint32_t sampleRate;
+
+/* Sequencer, owned by the audio task */
+static const ChimeSynth_Chime_t* current;
+static uint8_t  nextNote;
+static uint32_t elapsedSamples;
+static uint32_t lengthSamples;
+
+/* Requests from other tasks, consumed at the start of Render() */
+#define REQUEST_NONE  0xFF
+#define REQUEST_STOP  0xFE
+static volatile uint8_t requestedChime = REQUEST_NONE;
+static volatile int32_t targetVolume;
+static int32_t          volume;     /* Smoothed master gain, Q15 */
+
+static inline int16_t sineLookup(uint32_t phase)
+{
+    uint32_t index = phase >> 24;
+    int32_t  frac  = (int32_t)((phase >> 9) & 0x7FFF);
+    int32_t  a     = sineTable[index];
+    int32_t  b     = sineTable[index + 1];
+
+    return (int16_t)(a + (((b - a) * frac) >> 15));
+}
+
+/* 1 - block / tau, a first-order approximation of exp(-block / tau) */
+static int32_t decayFactor(uint32_t decayMs)
+{
+    uint32_t tauSamples = (decayMs * sampleRate) / 1000;
+
+    if(tauSamples <= CHIME_SYNTH_CONTROL_BLOCK)
+    {
+        return 0;
+    }
+    return 32768 - (int32_t)((32768UL * CHIME_SYNTH_CONTROL_BLOCK) / tauSamples);
+}
+
+static void noteOn(const ChimeSynth_Note_t* pNote)
+{
+    Voice_t* pVoice = &voices[0];
+
+    /* Free voice, otherwise steal the quietest one */
+    for(uint8_t i = 0; i < CHIME_SYNTH_NUM_VOICES; i++)
+    {
+        if(!voices[i].active)
+        {
+            pVoice = &voices[i];
+            break;
+        }
+        if(voices[i].env[0] < pVoice->env[0])
+        {
+            pVoice = &voices[i];
+        }
+    }
+
+    uint32_t partialHz256 = (uint32_t)pNote->freqHz * PARTIAL_RATIO_Q8;
+
+    memset(pVoice, 0, sizeof(*pVoice));
+    pVoice->step[0]  = (uint32_t)(((uint64_t)pNote->freqHz << 32) / sampleRate);
+    pVoice->step[1]  = (uint32_t)(((uint64_t)partialHz256 << 24) / sampleRate);
+    pVoice->peak     = ((int32_t)pNote->level * 32767) / 255;
+    pVoice->decay[0] = decayFactor(pNote->decayMs);
+    pVoice->decay[1] = decayFactor((pNote->decayMs * PARTIAL_DECAY_MUL) / PARTIAL_DECAY_DIV);
+    pVoice->attack   = ATTACK_BLOCKS;
+    pVoice->active   = true;
+}
+
+static void startChime(uint8_t chime)
+{
+    current        = &ChimeSynth_Library[chime];
+    nextNote       = 0;
+    elapsedSamples = 0;
+    lengthSamples  = ((uint32_t)current->lengthMs * sampleRate) / 1000;
+}
+
+static void releaseAll(void)
+{
+    current = NULL;
+    for(uint8_t i = 0; i < CHIME_SYNTH_NUM_VOICES; i++)
+    {
+        voices[i].attack   = 0;
+        voices[i].decay[0] = 32768 - (32768 / RELEASE_BLOCKS);
+        voices[i].decay[1] = voices[i].decay[0];
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Public API
+ * ------------------------------------------------------------------------- */
+void ChimeSynth_Init(uint32_t sampleRateHz)
+{
+    memset(voices, 0, sizeof(voices));
+    sampleRate     = sampleRateHz;
+    current        = NULL;
+    requestedChime = REQUEST_NONE;
+    ChimeSynth_SetVolume(VOLUME_DEFAULT_PCT);
+    volume = targetVolume;
+}
+
+void ChimeSynth_Play(ChimeSynth_ChimeId_t chime)
+{
+    if(chime < CHIME_COUNT)
+    {
+        requestedChime = (uint8_t)chime;
+    }
+}
+
+void ChimeSynth_Stop(void)
+{
+    requestedChime = REQUEST_STOP;
+}
+
+void ChimeSynth_SetVolume(uint8_t percent)
+{
+    if(percent > 100)
+    {
+        percent = 100;
+    }
+    /* Square law: roughly even loudness steps, 50 % = -12 dB */
+    targetVolume = ((int32_t)percent * percent * 32767) / 10000;
+}
+
+bool ChimeSynth_IsPlaying(void)
+{
+    if(current != NULL || requestedChime < CHIME_COUNT)
+    {
+        return true;
+    }
+    for(uint8_t i = 0; i < CHIME_SYNTH_NUM_VOICES; i++)
+    {
+        if(voices[i].active)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ChimeSynth_Render(int16_t* pOut, uint16_t numSamples)
+{
+    uint8_t request = requestedChime;
+
+    if(request != REQUEST_NONE)
+    {
+        requestedChime = REQUEST_NONE;
+        if(request == REQUEST_STOP)
+        {
+            releaseAll();
+        }
+        else
+        {
+            startChime(request);
+        }
+    }
+
+    for(uint16_t block = 0; block + CHIME_SYNTH_CONTROL_BLOCK <= numSamples; block += CHIME_SYNTH_CONTROL_BLOCK)
+    {
+        int32_t mix[CHIME_SYNTH_CONTROL_BLOCK] = {0};
+
+        /* Sequencer: trigger notes that are due in this block */
+        if(current != NULL)
+        {
+            while(nextNote < current->numNotes &&
+                  ((uint32_t)current->notes[nextNote].startMs * sampleRate) / 1000 <= elapsedSamples)
+            {
+                noteOn(&current->notes[nextNote++]);
+            }
+            elapsedSamples += CHIME_SYNTH_CONTROL_BLOCK;
+            if(elapsedSamples >= lengthSamples)
+            {
+                current = NULL;
+            }
+        }
+
+        for(uint8_t v = 0; v < CHIME_SYNTH_NUM_VOICES; v++)
+        {
+            Voice_t* pVoice = &voices[v];
+            int32_t  target[2];
+
+            if(!pVoice->active)
+            {
+                continue;
+            }
+
+            /* Control rate: envelope targets for the end of this block */
+            if(pVoice->attack > 0)
+            {
+                pVoice->attack--;
+                target[0] = pVoice->peak - (pVoice->peak * pVoice->attack) / ATTACK_BLOCKS;
+                target[1] = (target[0] * PARTIAL_LEVEL_Q15) >> 15;
+            }
+            else
+            {
+                target[0] = (pVoice->env[0] * pVoice->decay[0]) >> 15;
+                target[1] = (pVoice->env[1] * pVoice->decay[1]) >> 15;
+            }
+
+            int32_t env0  = pVoice->env[0] << 4;
+            int32_t env1  = pVoice->env[1] << 4;
+            int32_t step0 = target[0] - pVoice->env[0];
+            int32_t step1 = target[1] - pVoice->env[1];
+
+            for(uint8_t n = 0; n < CHIME_SYNTH_CONTROL_BLOCK; n++)
+            {
+                /* Per-sample linear envelope ramp, Q15 << 4 */
+                env0 += step0;
+                env1 += step1;
+                mix[n] += (sineLookup(pVoice->phase[0]) * (env0 >> 4)) >> 15;
+                mix[n] += (sineLookup(pVoice->phase[1]) * (env1 >> 4)) >> 15;
+                pVoice->phase[0] += pVoice->step[0];
+                pVoice->phase[1] += pVoice->step[1];
+            }
+
+            pVoice->env[0] = target[0];
+            pVoice->env[1] = target[1];
+            if(pVoice->attack == 0 && target[0] < ENV_SILENT_Q15)
+            {
+                pVoice->active = false;
+            }
+        }
+
+        /* Master volume, ramped over the block to avoid zipper noise */
+        int32_t gainEnd  = targetVolume;
+        int32_t gainStep = (gainEnd - volume) / CHIME_SYNTH_CONTROL_BLOCK;
+
+        for(uint8_t n = 0; n < CHIME_SYNTH_CONTROL_BLOCK; n++)
+        {
+            volume += gainStep;
+            int32_t sample = (mix[n] * volume) >> 15;
+
+            if(sample > INT16_MAX)
+            {
+                sample = INT16_MAX;
+            }
+            else if(sample < INT16_MIN)
+            {
+                sample = INT16_MIN;
+            }
+            pOut[block + n] = (int16_t)sample;
+        }
+        volume = gainEnd;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Wavetable chime synthesiser for the SpeakerTest application.
+ *
+ * Each note is a struck-bar tone: a fundamental plus one inharmonic partial
+ * (2.76x, as on a tubular chime), both read from a 256-entry sine table in
+ * flash with linear interpolation, under a short attack and an exponential
+ * decay.  Envelopes and the master volume are Q15 and updated at control
+ * rate (every CHIME_SYNTH_CONTROL_BLOCK samples), interpolated per sample.
+ *
+ * Chimes are note lists stored in flash (ChimeSynth_Library).  Play/stop and
+ * volume changes may come from any task; they are picked up by the audio
+ * task at the start of the next render call, so no locking is needed.
+ *
+ * No SDK dependencies (host-buildable).
+ */
+
+#ifndef _CHIMESYNTH_H_
+#define _CHIMESYNTH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CHIME_SYNTH_NUM_VOICES     4
+
+/** Samples per envelope / volume update; render length must be a multiple */
+#define CHIME_SYNTH_CONTROL_BLOCK  16
+
+typedef enum {
+    CHIME_DING_DONG = 0,   /* Classic two-tone doorbell */
+    CHIME_WESTMINSTER,     /* Four-note Westminster phrase */
+    CHIME_TRIPLE,          /* Rising C-E-G arpeggio */
+    CHIME_ALERT,           /* Three short A5 beeps */
+    CHIME_COUNT
+} ChimeSynth_ChimeId_t;
+
+typedef struct {
+    uint16_t freqHz;    /* Fundamental */
+    uint16_t startMs;   /* Offset from the start of the chime */
+    uint16_t decayMs;   /* Time constant of the exponential decay */
+    uint8_t  level;     /* Peak level, 255 = full scale for one voice */
+} ChimeSynth_Note_t;
+
+typedef struct {
+    const char*              name;
+    const ChimeSynth_Note_t* notes;    /* Sorted by startMs */
+    uint8_t                  numNotes;
+    uint16_t                 lengthMs; /* Including the ring-out of the last note */
+} ChimeSynth_Chime_t;
+
+extern const ChimeSynth_Chime_t ChimeSynth_Library[CHIME_COUNT];
+
+/** @brief Reset all voices. @p sampleRateHz is the rate Render() is called at. */
+void ChimeSynth_Init(uint32_t sampleRateHz);
+
+/** @brief Start a chime from the library (restarts if one is playing). Any task. */
+void ChimeSynth_Play(ChimeSynth_ChimeId_t chime);
+
+/** @brief Fade out whatever is playing. Any task. */
+void ChimeSynth_Stop(void);
+
+/** @brief Master volume 0..100 %, mapped to a square-law gain. Any task. */
+void ChimeSynth_SetVolume(uint8_t percent);
+
+/** @brief true while a chime is sequencing or any voice is still ringing. */
+bool ChimeSynth_IsPlaying(void);
+
+/** @brief Render signed 16-bit mono PCM. Audio task only.
+ *  @param numSamples Multiple of CHIME_SYNTH_CONTROL_BLOCK
+ */
+void ChimeSynth_Render(int16_t* pOut, uint16_t numSamples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _CHIMESYNTH_H_
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * DAC6551A streaming driver.
+ *
+ * DMA framing, buffer ownership:
+ *   The DMA sends frameBuffer[0] then frameBuffer[1] and wraps, one frame
+ *   per PWMXL period.  When it leaves half h the IRQ refills h from the ring
+ *   right away, so h is ready a full half (8 ms) before it is needed again.
+ *   "late" counts refills that found the other half already consumed, i.e.
+ *   an interrupt latency above 8 ms.
+ *
+ * ISR framing:
+ *   The period IRQ raises SYNC (ending the previous frame, whose 16th SCLK
+ *   edge has long passed at 8 MHz), drops it again and writes one frame.
+ *
+ * Timing anchor (DAC6551_TIMING):
+ *   DMA: when the IRQ refills half h the other half has just started, so
+ *   the first sample written into h plays one half (8 ms) later.
+ *   ISR: the sample read in the IRQ plays right away; the anchor is taken
+ *   once per DAC6551_BLOCK_FRAMES samples to keep the IRQ short.
+ */
+
+#include "Dac6551.h"
+
+#include "gpLog.h"
+#include "gpAssert.h"
+#if DAC6551_TIMING
+#include "gpSched.h"
+#endif
+
+#include "qDrvDMA.h"
+#include "qDrvGPIO.h"
+#include "qDrvIOB.h"
+#include "qDrvSPIM.h"
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+#define DAC6551_SPIM_ID        0
+#define DAC6551_DMA_CHANNEL    1
+#define DAC6551_MIDSCALE       DAC6551_FRAME(0)
+#define DAC6551_BLOCK_US       ((DAC6551_BLOCK_FRAMES * 1000000UL) / DAC6551_SAMPLE_RATE_HZ)
+
+static qDrvSPIM_t spimDrv = Q_DRV_SPIM_INSTANCE_DEFINE(DAC6551_SPIM_ID);
+static qDrvDMA_t  dmaDrv  = Q_DRV_DMA_INSTANCE_DEFINE(DAC6551_DMA_CHANNEL);
+
+static qDrvPWMXL_t*     pClockDrv;
+static Dac6551_Config_t config;
+
+static UInt16 frameBuffer[2][DAC6551_BLOCK_FRAMES] __attribute__((aligned(4)));
+static volatile UInt8 pendingHalf;   /* DMA: half the next IRQ expects to refill */
+static Int16 lastSample;
+
+static volatile Dac6551_Stats_t stats;
+
+#if DAC6551_TIMING
+/* Ring index anchorIndex reaches the DAC at local time anchorLocalUs */
+static volatile UInt32 anchorIndex;
+static volatile UInt32 anchorLocalUs;
+static volatile Bool   anchorValid;
+#endif
+
+/* The sample at the ring's read position reaches the DAC in @p delayUs */
+static inline void Dac6551_SetAnchor(UInt32 delayUs)
+{
+#if DAC6551_TIMING
+    anchorIndex   = config.pRing->tail;
+    anchorLocalUs = gpSched_GetCurrentTime() + delayUs;
+    anchorValid   = true;
+#else
+    (void)delayUs;
+#endif
+}
+
+static inline void Dac6551_ClearAnchor(void)
+{
+#if DAC6551_TIMING
+    anchorValid = false;
+#endif
+}
+
+static void Dac6551_NotifyProducer(BaseType_t* pWoken)
+{
+    if(config.producer != NULL && AudioRing_Level(config.pRing) < config.lowWater)
+    {
+        vTaskNotifyGiveFromISR(config.producer, pWoken);
+    }
+}
+
+/* Fill one half from the ring, holding the last sample if it runs dry */
+static void Dac6551_FillHalf(UInt8 half)
+{
+    Int16 pcm[DAC6551_BLOCK_FRAMES];
+    UInt32 got = AudioRing_Read(config.pRing, pcm, DAC6551_BLOCK_FRAMES);
+
+    if(got < DAC6551_BLOCK_FRAMES)
+    {
+        stats.underruns++;
+        for(UInt32 i = got; i < DAC6551_BLOCK_FRAMES; i++)
+        {
+            pcm[i] = (got > 0) ? pcm[got - 1] : lastSample;
+        }
+    }
+    lastSample = pcm[DAC6551_BLOCK_FRAMES - 1];
+
+    for(UInt16 i = 0; i < DAC6551_BLOCK_FRAMES; i++)
+    {
+        frameBuffer[half][i] = DAC6551_FRAME(pcm[i]);
+    }
+}
+
+/* DMA framing: runs in interrupt context when the DMA leaves a half */
+static void Dac6551_DmaCallback(void* pCallbackCtx, qDrvDMA_Event_t event)
+{
+    BaseType_t woken = pdFALSE;
+    UInt8 done = (event == qDrvDMA_EventHalfDone) ? 0 : 1;
+
+    (void)pCallbackCtx;
+
+    if(done != pendingHalf)
+    {
+        /* An IRQ was missed: the half being played now was never refilled */
+        stats.late++;
+    }
+    Dac6551_SetAnchor(DAC6551_BLOCK_US);
+    Dac6551_FillHalf(done);
+    pendingHalf = done ^ 1;
+    stats.frames += DAC6551_BLOCK_FRAMES;
+
+    Dac6551_NotifyProducer(&woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/* ISR framing: runs in interrupt context once per sample period */
+static void Dac6551_SampleCallback(void* pCallbackCtx)
+{
+    BaseType_t woken = pdFALSE;
+    Int16 sample;
+
+    (void)pCallbackCtx;
+
+    if((stats.frames % DAC6551_BLOCK_FRAMES) == 0)
+    {
+        Dac6551_SetAnchor(0);
+    }
+
+    if(AudioRing_Read(config.pRing, &sample, 1) == 0)
+    {
+        stats.underruns++;
+        sample = lastSample;
+    }
+    lastSample = sample;
+
+    qDrvGPIO_Write(DAC6551_SYNC_GPIO, 1);
+    qDrvGPIO_Write(DAC6551_SYNC_GPIO, 0);
+    qDrvSPIM_WordWrite(&spimDrv, DAC6551_FRAME(sample));
+    stats.frames++;
+
+    Dac6551_NotifyProducer(&woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+qResult_t Dac6551_Init(qDrvPWMXL_t* pClock, const Dac6551_Config_t* pConfig)
+{
+    qResult_t res;
+    UInt16 ticks;
+    UInt8 prescaler;
+    Bool dma;
+
+    GP_ASSERT_SYSTEM(pConfig != NULL && pConfig->pRing != NULL);
+
+    pClockDrv = pClock;
+    config = *pConfig;
+    dma = (config.framing == Dac6551_FramingDma);
+
+    /* SPI mode 1: SCLK idles low, DAC samples DIN on the falling edge.
+     * In DMA framing the SPIM drives SYNC as a chip select around every word. */
+    qDrvSPIM_PinConfig_t pinCfg = Q_DRV_SPIM_PIN_CONFIG(DAC6551_SPIM_ID, DAC6551_SCLK_GPIO, DAC6551_MOSI_GPIO,
+                                                        dma ? DAC6551_SYNC_GPIO : Q_DRV_SPIM_PIN_UNUSED);
+    res = qDrvSPIM_PinConfigSet(&pinCfg);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    qDrvSPIM_Config_t spiCfg = {
+        .clockFrequency = DAC6551_SPI_CLOCK_HZ,
+        .clockPhase     = QDRVSPIM_CPHA_1,
+        .clockPolarity  = QDRVSPIM_CPOL_0,
+        .bitOrder       = QDRVSPIM_MSB_FIRST,
+        .wordSize       = 16,
+        .csPerWord      = dma,
+    };
+    res = qDrvSPIM_Init(&spimDrv, &spiCfg);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    if(!dma)
+    {
+        /* SYNC idles high; fast slew so the frame edge is clean at 8 MHz */
+        qDrvIOB_ConfigOutputSet(DAC6551_SYNC_GPIO, qDrvIOB_Drive4mA, qDrvIOB_SlewRateFast);
+        qDrvGPIO_Write(DAC6551_SYNC_GPIO, 1);
+    }
+
+    /* Sample clock: PWMXL period only, no channel is routed to a pin */
+    if(!qDrvPWMXL_FrequencyCalculate(DAC6551_SAMPLE_RATE_HZ, &ticks, &prescaler))
+    {
+        GP_LOG_SYSTEM_PRINTF("FrequencyCalculate failed for %lu Hz", 0, (unsigned long)DAC6551_SAMPLE_RATE_HZ);
+        return Q_INVALID_PARAMETER;
+    }
+
+    qDrvPWMXL_Config_t clkCfg = {
+        .countMode   = qDrvPWMXL_CountModePrescaled,
+        .prescaler   = prescaler,
+        .periodTicks = ticks,
+    };
+    res = qDrvPWMXL_Init(pClockDrv, &clkCfg, dma ? NULL : Dac6551_SampleCallback, NULL);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    if(dma)
+    {
+        qDrvDMA_Config_t dmaCfg = {
+            .trigger      = qDrvDMA_TriggerPWMXL,
+            .pSrc         = frameBuffer,
+            .pDst         = qDrvSPIM_TxDataRegisterGet(&spimDrv),
+            .wordSize     = qDrvDMA_WordSize16,
+            .numWords     = 2 * DAC6551_BLOCK_FRAMES,
+            .srcIncrement = true,
+            .dstIncrement = false,
+            .circular     = true,
+        };
+        res = qDrvDMA_Init(&dmaDrv, &dmaCfg, Dac6551_DmaCallback, NULL, Q_DRV_IRQ_PRIO_DEFAULT);
+        if(res != Q_OK)
+        {
+            return res;
+        }
+    }
+
+    return Q_OK;
+}
+
+qResult_t Dac6551_Start(void)
+{
+    qResult_t res;
+
+    lastSample  = 0;
+    pendingHalf = 0;
+    Dac6551_ClearAnchor();
+    stats.frames = 0;
+    stats.underruns = 0;
+    stats.late = 0;
+
+    if(config.framing == Dac6551_FramingDma)
+    {
+        /* Prime both halves: whatever the producer has queued, padded with silence */
+        Dac6551_FillHalf(0);
+        Dac6551_FillHalf(1);
+        stats.underruns = 0;
+
+        res = qDrvDMA_Start(&dmaDrv);
+        if(res != Q_OK)
+        {
+            return res;
+        }
+    }
+    else
+    {
+        qDrvGPIO_Write(DAC6551_SYNC_GPIO, 0);
+        qDrvSPIM_WordWrite(&spimDrv, DAC6551_MIDSCALE);
+    }
+
+    return qDrvPWMXL_Enable(pClockDrv, true);
+}
+
+void Dac6551_Stop(void)
+{
+    qDrvPWMXL_Enable(pClockDrv, false);
+    Dac6551_ClearAnchor();
+
+    if(config.framing == Dac6551_FramingDma)
+    {
+        qDrvDMA_Stop(&dmaDrv);
+    }
+    else
+    {
+        qDrvGPIO_Write(DAC6551_SYNC_GPIO, 1);
+        qDrvGPIO_Write(DAC6551_SYNC_GPIO, 0);
+    }
+    qDrvSPIM_WordWrite(&spimDrv, DAC6551_MIDSCALE);
+}
+
+void Dac6551_GetStats(Dac6551_Stats_t* pStats)
+{
+    GP_ASSERT_SYSTEM(pStats != NULL);
+
+    taskENTER_CRITICAL();
+    pStats->frames    = stats.frames;
+    pStats->underruns = stats.underruns;
+    pStats->late      = stats.late;
+    taskEXIT_CRITICAL();
+}
+
+#if DAC6551_TIMING
+Bool Dac6551_GetTiming(UInt32* pRingIndex, UInt32* pLocalUs)
+{
+    Bool valid;
+
+    GP_ASSERT_SYSTEM(pRingIndex != NULL && pLocalUs != NULL);
+
+    taskENTER_CRITICAL();
+    valid       = anchorValid;
+    *pRingIndex = anchorIndex;
+    *pLocalUs   = anchorLocalUs;
+    taskEXIT_CRITICAL();
+
+    return valid;
+}
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Sample-clocked SPI streaming driver for the DAC6551A on the speaker PCB.
+ *
+ * Wiring (speaker board):
+ *   GPIO5 (SPIM MOSI) -> DAC6551A DIN
+ *   GPIO6 (SPIM SCLK) -> DAC6551A SCLK
+ *   GPIO7 (SYNC)      -> DAC6551A SYNC (active low frame sync)
+ *   DAC6551A VOUT     -> LM48511 amplifier input
+ *
+ * Each sample is one 16-bit frame, MSB first, clocked in on SCLK falling
+ * edges; the DAC output updates on the 16th edge.  A PWMXL period (no pin
+ * output) is the sample clock, so frame timing does not depend on CPU load.
+ *
+ * Framing modes:
+ *   Dac6551_FramingDma : each PWMXL period triggers a DMA transfer of one
+ *                        frame from a double buffer into the SPIM; the SPIM
+ *                        drives SYNC as a per-word chip select.  The CPU is
+ *                        only involved once per half-buffer.
+ *   Dac6551_FramingIsr : the PWMXL period interrupt toggles SYNC on GPIO7
+ *                        and writes the frame itself (bring-up / scope mode,
+ *                        or when per-word chip select is not available).
+ *
+ * Samples come from an AudioRing filled by the mixer task.  The driver
+ * refills the free half straight from the ring in interrupt context and
+ * notifies the producer task when the ring drops below the low-water mark.
+ * A starved ring repeats the last sample (no click) and counts an underrun.
+ *
+ * For scheduled playback (DAC6551_TIMING) the driver keeps a timing
+ * anchor: the ring index of a sample and the local time (gpSched, us) at
+ * which it reaches the DAC.  The anchor is refreshed every block, so a
+ * producer can place a sound at an exact local time by writing it at the
+ * matching ring index.
+ *
+ * Shared by SpeakerTest and ThreadBleSpeaker.
+ */
+
+#ifndef _DAC6551_H_
+#define _DAC6551_H_
+
+#include "global.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "qDrvPWMXL.h"
+#include "AudioRing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DAC6551_MOSI_GPIO          5
+#define DAC6551_SCLK_GPIO          6
+#define DAC6551_SYNC_GPIO          7
+
+#define DAC6551_SAMPLE_RATE_HZ     16000
+#define DAC6551_SPI_CLOCK_HZ       8000000  /* 2 us per frame, 1/31 of a sample period */
+
+/* 12-bit code in bits 11..0 of the frame, upper 4 bits don't care */
+#define DAC6551_RESOLUTION_BITS    12
+#define DAC6551_FRAME(_pcm)        ((UInt16)(((UInt16)((_pcm) + 32768)) >> (16 - DAC6551_RESOLUTION_BITS)))
+
+/* Frames per DMA half: 128 = 8 ms at 16 kHz */
+#define DAC6551_BLOCK_FRAMES       128
+
+/* Timing anchor for scheduled playback (Dac6551_GetTiming), needs gpSched */
+#ifndef DAC6551_TIMING
+#define DAC6551_TIMING             0
+#endif
+
+typedef enum {
+    Dac6551_FramingDma = 0,
+    Dac6551_FramingIsr = 1,
+} Dac6551_Framing_t;
+
+typedef struct {
+    Dac6551_Framing_t framing;
+    AudioRing_t*      pRing;      /* Sample source, written by the producer */
+    TaskHandle_t      producer;   /* Notified below lowWater, may be NULL */
+    UInt32            lowWater;   /* Samples left in the ring that trigger a refill */
+} Dac6551_Config_t;
+
+typedef struct {
+    UInt32 frames;      /* Frames sent to the DAC */
+    UInt32 underruns;   /* Blocks (DMA) or samples (ISR) the ring could not supply */
+    UInt32 late;        /* DMA: refill started after the other half had already run out */
+} Dac6551_Stats_t;
+
+/** @brief Configure SPIM, the SYNC pin, the PWMXL sample clock and (DMA mode) the DMA.
+ *  @param pClock  PWMXL instance used only as the sample clock
+ */
+qResult_t Dac6551_Init(qDrvPWMXL_t* pClock, const Dac6551_Config_t* pConfig);
+
+/** @brief Start streaming; the DAC is set to mid-scale first. */
+qResult_t Dac6551_Start(void);
+
+/** @brief Stop the sample clock and park the output at mid-scale. */
+void Dac6551_Stop(void);
+
+/** @brief Snapshot of the streaming counters. */
+void Dac6551_GetStats(Dac6551_Stats_t* pStats);
+
+#if DAC6551_TIMING
+/** @brief Latest timing anchor: ring sample @p pRingIndex reaches the DAC at
+ *  local time @p pLocalUs.  @return false until streaming has started. */
+Bool Dac6551_GetTiming(UInt32* pRingIndex, UInt32* pLocalUs);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _DAC6551_H_
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Continuous PDM capture: I2S_0 Master RX feeding one circular DMA transfer.
+ *
+ * The DMA writes dmaBuffer[0] then dmaBuffer[1] and wraps on its own, so the
+ * bitstream has no gap: nothing is re-armed per half. The half-done and done
+ * events hand the half just filled to the consumer task.
+ *
+ * Ownership of each half:
+ *   readyMask  -> full, signalled, not yet taken by PdmCapture_WaitBlock()
+ *   ownedMask  -> taken by the consumer, until PdmCapture_ReleaseBlock()
+ *   neither    -> belongs to the DMA
+ *
+ * Overrun: when the DMA enters a half the consumer has not given back, that
+ * half is dropped. If it was not taken yet it is never handed out; if the
+ * consumer is reading it, PdmCapture_ReleaseBlock() returns false so the
+ * results computed from it are discarded too. Both count as overruns.
+ *
+ * To change the PDM clock, PdmCapture_Restart() stops I2S and the DMA,
+ * re-initialises I2S at the new rate and starts both again.
+ */
+
+#include "PdmCapture.h"
+
+#include "gpLog.h"
+#include "gpAssert.h"
+
+#include "qDrvDMA.h"
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+#define PDM_CAPTURE_DMA_CHANNEL  0
+#define PDM_CAPTURE_BLOCK_WORDS  (PDM_CAPTURE_BLOCK_SIZE / 2)
+
+static qDrvDMA_t dmaDrv = Q_DRV_DMA_INSTANCE_DEFINE(PDM_CAPTURE_DMA_CHANNEL);
+
+static qDrvI2S_t* pI2sDrv;
+static TaskHandle_t consumerTask;
+
+static UInt8 dmaBuffer[PDM_CAPTURE_NUM_BLOCKS][PDM_CAPTURE_BLOCK_SIZE] __attribute__((aligned(4)));
+
+/* Half currently being filled by the DMA */
+static volatile UInt8 activeBlock;
+/* Next half the consumer expects, keeps blocks in capture order */
+static UInt8 nextReadBlock;
+static volatile UInt32 readyMask;
+static volatile UInt32 ownedMask;
+/* Owned halves the DMA wrote into before they were released */
+static volatile UInt32 tornMask;
+static UInt16 currentPrescaler;
+
+static volatile PdmCapture_Stats_t stats;
+
+/* Runs in interrupt context when the DMA leaves a half */
+static void PdmCapture_DmaCallback(void* pCallbackCtx, qDrvDMA_Event_t event)
+{
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    UInt8 done = (event == qDrvDMA_EventHalfDone) ? 0 : 1;
+    UInt32 nextBit = 1UL << (done ^ 1);
+
+    (void)pCallbackCtx;
+
+    if(done != activeBlock)
+    {
+        /* An event was missed: the interrupt latency exceeded one half */
+        stats.late++;
+    }
+
+    /* The DMA is now writing the other half: drop it if it was not given back */
+    if(readyMask & nextBit)
+    {
+        readyMask &= ~nextBit;
+        stats.overruns++;
+    }
+    else if(ownedMask & nextBit)
+    {
+        tornMask |= nextBit;
+        stats.overruns++;
+    }
+
+    readyMask |= (1UL << done);
+    activeBlock = (UInt8)(done ^ 1);
+    stats.blocks++;
+
+    xTaskNotifyFromISR(consumerTask, (1UL << done), eSetBits, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+static qResult_t PdmCapture_ConfigureI2S(UInt16 prescaler)
+{
+    currentPrescaler = prescaler;
+
+    qDrvI2S_Config_t cfg = {
+        .mode         = qDrvI2S_ModeMasterRx,
+        .transferMode = qDrvI2S_TransferModeDma,
+        .clkSrc       = qDrvI2S_ClkSrcMain,
+        .prescaler    = prescaler,
+        .wordLen      = 16,
+        .wsOffset     = 1,
+        .txBytes      = {.left = 0, .right = 0},
+        .rxBytes      = {.left = 2, .right = 2},
+    };
+
+    /* The DMA channel below moves the data; I2S only raises the requests */
+    return qDrvI2S_Init(pI2sDrv, &cfg, NULL, NULL, Q_DRV_IRQ_PRIO_DEFAULT);
+}
+
+qResult_t PdmCapture_Init(qDrvI2S_t* pDrv, UInt16 prescaler)
+{
+    qResult_t res;
+
+    pI2sDrv = pDrv;
+
+    res = PdmCapture_ConfigureI2S(prescaler);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    qDrvDMA_Config_t dmaCfg = {
+        .trigger      = qDrvDMA_TriggerI2S0Rx,
+        .pSrc         = qDrvI2S_RxDataRegisterGet(pI2sDrv),
+        .pDst         = dmaBuffer,
+        .wordSize     = qDrvDMA_WordSize16,
+        .numWords     = PDM_CAPTURE_NUM_BLOCKS * PDM_CAPTURE_BLOCK_WORDS,
+        .srcIncrement = false,
+        .dstIncrement = true,
+        .circular     = true,
+    };
+
+    return qDrvDMA_Init(&dmaDrv, &dmaCfg, PdmCapture_DmaCallback, NULL, Q_DRV_IRQ_PRIO_DEFAULT);
+}
+
+qResult_t PdmCapture_Start(TaskHandle_t consumer)
+{
+    qResult_t res;
+
+    consumerTask = consumer;
+    activeBlock = 0;
+    nextReadBlock = 0;
+    readyMask = 0;
+    ownedMask = 0;
+    tornMask = 0;
+
+    /* DMA first, so the first I2S request finds it armed */
+    res = qDrvDMA_Start(&dmaDrv);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    return qDrvI2S_Start(pI2sDrv);
+}
+
+const UInt8* PdmCapture_WaitBlock(TickType_t timeout)
+{
+    while(1)
+    {
+        UInt8 block = nextReadBlock;
+        Bool taken = false;
+
+        taskENTER_CRITICAL();
+        if((readyMask & (1UL << block)) == 0)
+        {
+            /* The expected half was dropped: resynchronise on the other one */
+            block ^= 1;
+        }
+        if(readyMask & (1UL << block))
+        {
+            readyMask &= ~(1UL << block);
+            ownedMask |= (1UL << block);
+            taken = true;
+        }
+        taskEXIT_CRITICAL();
+
+        if(taken)
+        {
+            nextReadBlock = (UInt8)(block ^ 1);
+            return dmaBuffer[block];
+        }
+
+        if(xTaskNotifyWait(0, 0xFFFFFFFFUL, NULL, timeout) != pdTRUE)
+        {
+            return NULL;
+        }
+    }
+}
+
+qResult_t PdmCapture_Restart(UInt16 prescaler)
+{
+    /* Whatever is in flight or not yet taken is dropped with the old clock */
+    qDrvI2S_Stop(pI2sDrv);
+    qDrvDMA_Stop(&dmaDrv);
+    xTaskNotifyStateClear(NULL);
+
+    qResult_t res = PdmCapture_ConfigureI2S(prescaler);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    stats.restarts++;
+    return PdmCapture_Start(consumerTask);
+}
+
+UInt16 PdmCapture_GetPrescaler(void)
+{
+    return currentPrescaler;
+}
+
+Bool PdmCapture_ReleaseBlock(const UInt8* pBlock)
+{
+    UInt32 bit = (pBlock == dmaBuffer[0]) ? 1UL : 2UL;
+    Bool intact;
+
+    taskENTER_CRITICAL();
+    intact = (tornMask & bit) == 0;
+    ownedMask &= ~bit;
+    tornMask &= ~bit;
+    taskEXIT_CRITICAL();
+
+    return intact;
+}
+
+void PdmCapture_GetStats(PdmCapture_Stats_t* pStats)
+{
+    GP_ASSERT_SYSTEM(pStats != NULL);
+
+    taskENTER_CRITICAL();
+    pStats->blocks   = stats.blocks;
+    pStats->overruns = stats.overruns;
+    pStats->late     = stats.late;
+    pStats->restarts = stats.restarts;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * Continuous PDM capture for the PDM microphone (I2S_0 Master RX), shared by
+ * ThreadBleMicrophone and MicTest.
+ * I2S_0 Master RX feeds a circular DMA transfer over a ping-pong buffer:
+ * while one half is being filled, the other half is owned by the processing
+ * task. The DMA wraps on its own, so there is no gap between halves; its
+ * half-done / done interrupts hand the full half to the consumer task
+ * through a task notification.
+ * The PDM clock can be changed on the fly with PdmCapture_Restart().
+ */
+
+#ifndef _PDMCAPTURE_H_
+#define _PDMCAPTURE_H_
+
+#include "global.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "qDrvI2S.h"
+
+/* 512 bytes = 256 x 16-bit words = 4096 PDM bits = ~4 ms at 1 MHz SCK */
+#define PDM_CAPTURE_BLOCK_SIZE   512
+#define PDM_CAPTURE_NUM_BLOCKS   2
+
+typedef struct {
+    UInt32 blocks;      /* Half-buffers completed by the DMA */
+    UInt32 overruns;    /* Halves dropped: the DMA wrapped into them before they were released */
+    UInt32 late;        /* DMA events missed (interrupt latency above one half) */
+    UInt32 restarts;    /* PdmCapture_Restart() calls (clock changes, recoveries) */
+} PdmCapture_Stats_t;
+
+/** @brief Initialize I2S in DMA mode with the capture completion callback.
+ *  @param pDrv      I2S driver instance (pins must already be configured)
+ *  @param prescaler I2S clock prescaler (F_SCK = F_CLK / (2 * (prescaler + 1)))
+ */
+qResult_t PdmCapture_Init(qDrvI2S_t* pDrv, UInt16 prescaler);
+
+/** @brief Start continuous capture; full halves are signalled to @p consumer. */
+qResult_t PdmCapture_Start(TaskHandle_t consumer);
+
+/** @brief Block the calling (consumer) task until the next half is full.
+ *  @return Pointer to PDM_CAPTURE_BLOCK_SIZE bytes, or NULL on timeout.
+ *          The block stays owned by the caller until PdmCapture_ReleaseBlock().
+ */
+const UInt8* PdmCapture_WaitBlock(TickType_t timeout);
+
+/** @brief Give a block obtained from PdmCapture_WaitBlock() back to the DMA.
+ *  @return false if the DMA overwrote the block while it was held (overrun):
+ *          anything computed from it should be discarded.
+ */
+Bool PdmCapture_ReleaseBlock(const UInt8* pBlock);
+
+/** @brief Stop I2S and the DMA, re-initialise I2S at @p prescaler and start again.
+ *
+ *  Consumer task context, with no block held.  The half in flight is
+ *  dropped; the caller should reset its decimator.  Also recovers capture
+ *  that stopped delivering blocks.
+ */
+qResult_t PdmCapture_Restart(UInt16 prescaler);
+
+/** @return Prescaler the capture currently runs at. */
+UInt16 PdmCapture_GetPrescaler(void);
+
+/** @brief Snapshot of the capture counters. */
+void PdmCapture_GetStats(PdmCapture_Stats_t* pStats);
+
+#endif // _PDMCAPTURE_H_
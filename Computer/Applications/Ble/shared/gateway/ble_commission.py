@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""
+ble_commission.py  –  Commission QPG6200 Thread nodes over BLE in one write
+==========================================================================
+
+Runs on the Raspberry Pi gateway (OpenThread Border Router).
+
+Writes the border router's Active Operational Dataset, as MeshCoP TLVs
+("ot-ctl dataset active -x"), to the Dataset characteristic of the Thread
+Config service (shared/MeshDataset.h) of every node found, and waits for
+the node's answer on the Thread Status characteristic:
+
+  5           dataset rejected (malformed, or a required TLV missing)
+  2, 3 or 4   attached as child, router or leader
+
+A dataset longer than the ATT MTU goes out as a long write; the node
+applies it MESH_DATASET_SETTLE_MS after the last chunk.  Nodes are done
+one after the other, each in one connection.
+
+With --auth-keys, each node first gets event signing keys on its Auth
+characteristic (shared/MeshAuth.h): a key of its own, generated the first
+time the node is seen, and the keys of every other node in the file as
+trusted senders.  The file (JSON, device id -> key hex) is updated as
+nodes are added.  A node locks its keys when the connection that wrote
+them closes, so the device ids of all nodes are read first and every node
+is written once with the complete set.  A node added later needs a
+factory reset of the earlier ones to become a trusted sender there; a
+locked node is skipped.
+
+Dependencies
+------------
+  pip install bleak
+
+Usage
+-----
+  python3 ble_commission.py [--name "QPG "] [--address ADDR ...]
+                            [--dataset HEX] [--auth-keys FILE]
+                            [--timeout SEC] [--debug]
+
+  Without --address, all devices whose name starts with --name are done.
+  Without --dataset, the dataset is read with ot-ctl (usually needs root).
+
+  Example:
+    sudo python3 ble_commission.py --name "QPG Thread"
+"""
+
+import argparse
+import asyncio
+import json
+import logging
+import os
+import subprocess
+import sys
+
+from bleak import BleakClient, BleakScanner
+
+logging.basicConfig(
+    level=logging.INFO,
+    format="%(asctime)s [%(levelname)s] %(name)s: %(message)s",
+    datefmt="%Y-%m-%d %H:%M:%S",
+    stream=sys.stderr,
+)
+log = logging.getLogger("ble_commission")
+
+# ---------------------------------------------------------------------------
+#  BLE UUIDs – must match the Thread Config service in the node firmware
+#  (D00RBELL-0002-1000-8000-00805F9B34xx)
+# ---------------------------------------------------------------------------
+
+THREAD_STATUS_UUID  = "d000be11-0000-1002-8000-00805f9b3406"
+THREAD_DATASET_UUID = "d000be11-0000-1002-8000-00805f9b3408"
+THREAD_AUTH_UUID    = "d000be11-0000-1002-8000-00805f9b340b"
+
+STATUS_NAMES = {0: "disabled", 1: "detached", 2: "child", 3: "router",
+                4: "leader", 5: "rejected"}
+STATUS_ATTACHED = (2, 3, 4)
+STATUS_REJECTED = 5
+
+SCAN_TIMEOUT_SEC = 10
+DATASET_MAX_LEN  = 254        # MESH_DATASET_MAX_LEN
+AUTH_KEY_LEN     = 16         # MESH_AUTH_KEY_LEN
+AUTH_APPLY_SEC   = 0.3        # the node applies one key write at a time
+AUTH_INFO_LOCKED = 0x02       # MESH_AUTH_INFO_LOCKED
+
+
+def _active_dataset() -> bytes:
+    """The border router's active dataset as TLV bytes."""
+    out = subprocess.run(["ot-ctl", "dataset", "active", "-x"], capture_output=True,
+                         text=True, timeout=10, check=True).stdout.split()
+    if len(out) != 2 or out[1] != "Done":
+        raise RuntimeError(" ".join(out) or "no answer")
+    return bytes.fromhex(out[0])
+
+
+def _load_keys(path: str) -> dict:
+    try:
+        with open(path) as f:
+            return {int(dev, 16): bytes.fromhex(key) for dev, key in json.load(f).items()}
+    except FileNotFoundError:
+        return {}
+
+
+def _save_keys(path: str, keys: dict) -> None:
+    with open(path, "w") as f:
+        json.dump({f"{dev:08x}": key.hex() for dev, key in sorted(keys.items())}, f, indent=2)
+
+
+async def _read_device_id(address: str, keys: dict) -> None:
+    """Read a node's device id and give it a key, without writing to it."""
+    async with BleakClient(address) as client:
+        info = await client.read_gatt_char(THREAD_AUTH_UUID)
+    keys.setdefault(int.from_bytes(info[:4], "big"), os.urandom(AUTH_KEY_LEN))
+
+
+async def _provision_keys(client: BleakClient, keys: dict) -> int:
+    """Give the node its own key and every other key as a trusted sender."""
+    info = await client.read_gatt_char(THREAD_AUTH_UUID)
+    device_id = int.from_bytes(info[:4], "big")
+    if info[4] & AUTH_INFO_LOCKED:
+        log.warning("%08x: keys locked, factory reset the node to change them", device_id)
+        return device_id
+    keys.setdefault(device_id, os.urandom(AUTH_KEY_LEN))
+
+    writes = [keys[device_id]]
+    writes += [dev.to_bytes(4, "big") + key for dev, key in keys.items() if dev != device_id]
+    for value in writes:
+        await client.write_gatt_char(THREAD_AUTH_UUID, value, response=True)
+        await asyncio.sleep(AUTH_APPLY_SEC)
+    log.debug("%08x: own key and %d trusted senders written", device_id, len(writes) - 1)
+    return device_id
+
+
+async def _commission(address: str, dataset: bytes, timeout: float,
+                      keys: dict = None) -> str:
+    """Write the dataset to one node; returns the final Thread Status name."""
+    result = asyncio.get_running_loop().create_future()
+
+    def _on_status(_char, data: bytearray) -> None:
+        if data and (data[0] in STATUS_ATTACHED or data[0] == STATUS_REJECTED) \
+                and not result.done():
+            result.set_result(data[0])
+
+    async with BleakClient(address) as client:
+        if keys is not None:
+            await _provision_keys(client, keys)
+        await client.start_notify(THREAD_STATUS_UUID, _on_status)
+        await client.write_gatt_char(THREAD_DATASET_UUID, dataset, response=True)
+        log.debug("%s: %d bytes written (MTU %d)", address, len(dataset), client.mtu_size)
+        try:
+            status = await asyncio.wait_for(result, timeout)
+        except asyncio.TimeoutError:
+            status = (await client.read_gatt_char(THREAD_STATUS_UUID))[0]
+        return STATUS_NAMES.get(status, str(status))
+
+
+async def _run(args) -> int:
+    dataset = bytes.fromhex(args.dataset) if args.dataset else _active_dataset()
+    if not dataset or len(dataset) > DATASET_MAX_LEN:
+        log.error("Dataset of %d bytes, expected 1..%d", len(dataset), DATASET_MAX_LEN)
+        return 1
+
+    addresses = args.address
+    if not addresses:
+        log.info("Scanning for '%s*' (timeout=%ds) …", args.name, SCAN_TIMEOUT_SEC)
+        devices = await BleakScanner.discover(timeout=SCAN_TIMEOUT_SEC)
+        addresses = [d.address for d in devices if d.name and d.name.startswith(args.name)]
+    if not addresses:
+        log.error("No device found")
+        return 1
+
+    keys = _load_keys(args.auth_keys) if args.auth_keys else None
+    if keys is not None:
+        # All device ids first: each node takes its trusted senders only once
+        for address in addresses:
+            try:
+                await _read_device_id(address, keys)
+            except Exception as exc:
+                log.warning("%s: device id not read: %s", address, exc)
+        _save_keys(args.auth_keys, keys)
+    failed = 0
+    for address in addresses:
+        try:
+            status = await _commission(address, dataset, args.timeout, keys)
+        except Exception as exc:  # one bad node must not stop the batch
+            status = "error: %s" % exc
+        if keys is not None:
+            _save_keys(args.auth_keys, keys)
+        if status not in ("child", "router", "leader"):
+            failed += 1
+        print("%s %s" % (address, status))
+    log.info("%d of %d nodes attached", len(addresses) - failed, len(addresses))
+    return 1 if failed else 0
+
+
+def _parse_args():
+    parser = argparse.ArgumentParser(
+        description="Commission QPG6200 Thread nodes with one BLE write of the active dataset"
+    )
+    parser.add_argument("--name", default="QPG ",
+                        help="Device name prefix to scan for (default: 'QPG ')")
+    parser.add_argument("--address", nargs="+",
+                        help="BLE addresses to commission instead of scanning")
+    parser.add_argument("--dataset",
+                        help="Dataset TLVs as hex (default: ot-ctl dataset active -x)")
+    parser.add_argument("--auth-keys", metavar="FILE",
+                        help="Provision event signing keys, kept in this JSON file")
+    parser.add_argument("--timeout", type=float, default=30.0,
+                        help="Seconds to wait for a node to attach (default: 30)")
+    parser.add_argument("--debug", action="store_true",
+                        help="Enable verbose DEBUG logging")
+    return parser.parse_args()
+
+
+def main() -> None:
+    args = _parse_args()
+
+    if args.debug:
+        logging.getLogger().setLevel(logging.DEBUG)
+
+    sys.exit(asyncio.run(_run(args)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,185 @@
+"""
+mesh_auth.py  –  AUTH record check for the gateway
+==================================================
+
+Mirrors MeshAuth_Check() of shared/MeshAuth.c so the gateway checks
+signed event frames like the nodes do.  A signed frame (mesh_tlv.py) ends
+with an AUTH record 0x0A of 12 bytes:
+
+  counter (BE32)   frame counter of the sender, never reused
+  tag (8 bytes)    AES-CCM tag, M = 8, L = 2, no encrypted payload
+
+The tag covers the frame up to and including the counter as additional
+authenticated data.  Nonce (13 bytes): device id (BE32), counter (BE32),
+device type, then zeros.
+
+The keys are the JSON file of ble_commission.py --auth-keys (device id
+hex -> key hex).  As on a node, a checker without keys passes every frame
+("open"); with keys it rejects frames that are unsigned, from an unknown
+sender or with a bad tag, and reports a counter already seen or more than
+WINDOW behind the newest one of its sender as a replay.
+
+AES-128 is implemented here (encryption only, a few frames per second),
+so this stays Python 3.8+ standard library only.
+"""
+
+import json
+from typing import Dict, Tuple
+
+import mesh_tlv
+
+KEY_LEN = 16                 # MESH_AUTH_KEY_LEN
+TAG_LEN = 8                  # MESH_AUTH_TAG_LEN
+REC_LEN = 12                 # MESH_AUTH_REC_LEN
+WINDOW = 32                  # MESH_AUTH_WINDOW
+NONCE_LEN = 13
+CCM_L = 2
+FLAGS_B0 = 0x40 | (((TAG_LEN - 2) // 2) << 3) | (CCM_L - 1)
+FLAGS_A0 = CCM_L - 1
+
+OPEN = "open"
+VALID = "valid"
+REPLAY = "replay"
+REJECTED = "rejected"
+
+# ---------------------------------------------------------------------------
+#  AES-128 (FIPS-197), encryption only
+# ---------------------------------------------------------------------------
+
+
+def _xtime(x: int) -> int:
+    return ((x << 1) ^ (0x1B if x & 0x80 else 0)) & 0xFF
+
+
+def _sbox() -> bytes:
+    """Inverse in GF(2^8) (powers of the generator 3), then the affine map."""
+    exp = []
+    x = 1
+    for _ in range(255):
+        exp.append(x)
+        x ^= _xtime(x)
+    log = {v: i for i, v in enumerate(exp)}
+    box = bytearray(256)
+    for x in range(256):
+        s = r = exp[(255 - log[x]) % 255] if x else 0
+        for _ in range(4):
+            r = ((r << 1) | (r >> 7)) & 0xFF
+            s ^= r
+        box[x] = s ^ 0x63
+    return bytes(box)
+
+
+SBOX = _sbox()
+
+
+def _expand_key(key: bytes) -> list:
+    words = [list(key[i:i + 4]) for i in range(0, KEY_LEN, 4)]
+    rcon = 1
+    for i in range(4, 44):
+        w = list(words[i - 1])
+        if i % 4 == 0:
+            w = [SBOX[w[1]] ^ rcon, SBOX[w[2]], SBOX[w[3]], SBOX[w[0]]]
+            rcon = _xtime(rcon)
+        words.append([a ^ b for a, b in zip(words[i - 4], w)])
+    return [sum(words[r * 4:r * 4 + 4], []) for r in range(11)]
+
+
+def _encrypt_block(round_keys: list, block: bytes) -> bytes:
+    s = [b ^ k for b, k in zip(block, round_keys[0])]
+    for rnd in range(1, 11):
+        s = [SBOX[b] for b in s]
+        # ShiftRows: byte (row r, column c) is at index 4 * c + r
+        s = [s[(i + 4 * (i % 4)) % 16] for i in range(16)]
+        if rnd < 10:
+            out = []
+            for c in range(4):
+                a = s[4 * c:4 * c + 4]
+                t = a[0] ^ a[1] ^ a[2] ^ a[3]
+                out += [a[r] ^ t ^ _xtime(a[r] ^ a[(r + 1) % 4]) for r in range(4)]
+            s = out
+        s = [b ^ k for b, k in zip(s, round_keys[rnd])]
+    return bytes(s)
+
+
+# ---------------------------------------------------------------------------
+#  CCM tag, as MeshAuth_Tag()
+# ---------------------------------------------------------------------------
+
+
+def nonce(frame: bytes, counter: bytes) -> bytes:
+    """Device id, counter, device type, zeros."""
+    return bytes(frame[3:7]) + bytes(counter) + bytes((frame[2],)) + bytes(NONCE_LEN - 9)
+
+
+def tag(key: bytes, nonce_: bytes, aad: bytes) -> bytes:
+    round_keys = _expand_key(key)
+    x = _encrypt_block(round_keys, bytes((FLAGS_B0,)) + nonce_ + bytes(CCM_L))
+    data = len(aad).to_bytes(2, "big") + bytes(aad)
+    data += bytes(-len(data) % 16)
+    for pos in range(0, len(data), 16):
+        x = _encrypt_block(round_keys, bytes(a ^ b for a, b in zip(x, data[pos:pos + 16])))
+    s0 = _encrypt_block(round_keys, bytes((FLAGS_A0,)) + nonce_ + bytes(CCM_L))
+    return bytes(a ^ b for a, b in zip(x[:TAG_LEN], s0))
+
+
+def _equal(a: bytes, b: bytes) -> bool:
+    diff = 0
+    for x, y in zip(a, b):
+        diff |= x ^ y
+    return diff == 0 and len(a) == len(b)
+
+
+# ---------------------------------------------------------------------------
+#  Checker
+# ---------------------------------------------------------------------------
+
+
+def load_keys(path: str) -> Dict[int, bytes]:
+    with open(path) as f:
+        return {int(dev, 16): bytes.fromhex(key) for dev, key in json.load(f).items()}
+
+
+class AuthChecker:
+    """Tag and replay check of received frames, per trusted sender."""
+
+    def __init__(self, keys: Dict[int, bytes]) -> None:
+        self.keys = dict(keys)
+        self.windows: Dict[int, Tuple[int, int]] = {}   # device id -> (top, bitmap)
+        self.stats = {OPEN: 0, VALID: 0, REPLAY: 0, REJECTED: 0}
+
+    def check(self, data: bytes) -> str:
+        result = self._check(data)
+        self.stats[result] += 1
+        return result
+
+    def _check(self, data: bytes) -> str:
+        frame = None
+        if mesh_tlv.is_frame(data):
+            try:
+                frame = mesh_tlv.decode(data)
+            except ValueError:
+                frame = None
+        last = frame.records[-1] if frame is not None and frame.records else None
+        signed = (last is not None and last.type == mesh_tlv.REC_AUTH
+                  and len(last.value) == REC_LEN and not frame.truncated)
+        key = self.keys.get(frame.device_id) if signed else None
+        if key is None:
+            return REJECTED if self.keys else OPEN
+
+        expected = tag(key, nonce(data, last.value[:4]), data[:-TAG_LEN])
+        if not _equal(expected, last.value[4:]):
+            return REJECTED
+
+        counter = int.from_bytes(last.value[:4], "big")
+        top, bitmap = self.windows.get(frame.device_id, (None, 0))
+        if top is None or counter > top:
+            age = counter - top if top is not None else WINDOW
+            bitmap = 1 if age >= WINDOW else ((bitmap << age) | 1) & 0xFFFFFFFF
+            top = counter
+        else:
+            age = top - counter
+            if age >= WINDOW or bitmap & (1 << age):
+                return REPLAY
+            bitmap |= 1 << age
+        self.windows[frame.device_id] = (top, bitmap)
+        return VALID
@@ -0,0 +1,157 @@
+"""
+mesh_coap.py  –  Minimal CoAP (RFC 7252) message codec
+======================================================
+
+Just enough CoAP for the gateway side of shared/MeshCoap.c: POST requests
+with Uri-Path options and a payload, and the empty-payload piggybacked
+responses the nodes and the gateway send back for confirmable requests.
+
+  Byte 0     : version (1) << 6 | type << 4 | token length
+  Byte 1     : code, class << 5 | detail (POST = 0.02, 2.04 = 0x44)
+  Byte 2-3   : message id (BE16)
+  Byte 4..   : token (0-8 bytes)
+  then       : options, 4-bit delta | 4-bit length, extended as RFC 7252
+  then       : 0xFF and the payload, if any
+
+Resources used by the Thread nodes (MeshCoap.h):
+
+  POST /e    one TLV event frame (mesh_tlv.py): NON to the chime group
+             ff03::dc:1:<zone> for rings (MeshGroup.h), else NON to the
+             gateway, or to ff03::1 while there is none; also CON to the
+             gateway for critical events
+  POST /gw   empty, NON to ff03::1 from the gateway: "send your events here"
+  POST /d    one TLV diagnostics frame (MeshDiag.h), NON to the gateway
+  POST /listen  1 byte, listen-in seconds (ThreadBleMicrophone only)
+"""
+
+import os
+import struct
+from dataclasses import dataclass, field
+from typing import List, Optional, Tuple
+
+VERSION = 1
+
+TYPE_CON = 0
+TYPE_NON = 1
+TYPE_ACK = 2
+TYPE_RST = 3
+
+CODE_EMPTY = 0x00
+CODE_POST = 0x02
+CODE_CHANGED = 0x44       # 2.04
+CODE_BAD_REQUEST = 0x80   # 4.00
+CODE_NOT_FOUND = 0x84     # 4.04
+
+OPT_URI_PATH = 11
+PAYLOAD_MARKER = 0xFF
+
+PORT = 5683               # MESH_COAP_PORT
+MCAST_GROUP = "ff03::1"   # MESH_COAP_MCAST
+URI_EVENT = "e"           # MESH_COAP_URI_EVENT
+URI_GATEWAY = "gw"        # MESH_COAP_URI_GATEWAY
+URI_DIAG = "d"            # MESH_DIAG_URI
+
+
+@dataclass
+class Message:
+    mtype: int
+    code: int
+    message_id: int
+    token: bytes = b""
+    options: List[Tuple[int, bytes]] = field(default_factory=list)
+    payload: bytes = b""
+
+    @property
+    def uri_path(self) -> str:
+        return "/".join(value.decode("utf-8", "replace")
+                        for number, value in self.options if number == OPT_URI_PATH)
+
+    @property
+    def confirmable(self) -> bool:
+        return self.mtype == TYPE_CON
+
+
+def _ext_nibble(value: int) -> Tuple[int, bytes]:
+    if value < 13:
+        return value, b""
+    if value < 269:
+        return 13, bytes([value - 13])
+    return 14, struct.pack(">H", value - 269)
+
+
+def _read_ext(nibble: int, data: bytes, pos: int) -> Tuple[Optional[int], int]:
+    if nibble < 13:
+        return nibble, pos
+    if nibble == 13 and pos + 1 <= len(data):
+        return data[pos] + 13, pos + 1
+    if nibble == 14 and pos + 2 <= len(data):
+        return struct.unpack_from(">H", data, pos)[0] + 269, pos + 2
+    return None, pos
+
+
+def encode(msg: Message) -> bytes:
+    """Serialise a message."""
+    if len(msg.token) > 8:
+        raise ValueError("token longer than 8 bytes")
+    out = bytearray([(VERSION << 6) | (msg.mtype << 4) | len(msg.token), msg.code])
+    out += struct.pack(">H", msg.message_id & 0xFFFF) + msg.token
+    last = 0
+    for number, value in sorted(msg.options, key=lambda opt: opt[0]):
+        delta, delta_ext = _ext_nibble(number - last)
+        length, length_ext = _ext_nibble(len(value))
+        out.append((delta << 4) | length)
+        out += delta_ext + length_ext + value
+        last = number
+    if msg.payload:
+        out.append(PAYLOAD_MARKER)
+        out += msg.payload
+    return bytes(out)
+
+
+def decode(data: bytes) -> Optional[Message]:
+    """Parse a datagram; None if it is not a well-formed CoAP message.
+
+    TLV frames (first byte 0xA1) and the raw payloads of pre-CoAP firmware
+    (first byte 0x01..0x07) all have a version field other than 1, so they
+    are never mistaken for CoAP.
+    """
+    if len(data) < 4 or data[0] >> 6 != VERSION:
+        return None
+    tkl = data[0] & 0x0F
+    if tkl > 8 or len(data) < 4 + tkl:
+        return None
+    msg = Message((data[0] >> 4) & 0x03, data[1], struct.unpack_from(">H", data, 2)[0],
+                  bytes(data[4:4 + tkl]))
+    pos = 4 + tkl
+    number = 0
+    while pos < len(data):
+        byte = data[pos]
+        pos += 1
+        if byte == PAYLOAD_MARKER:
+            if pos == len(data):
+                return None
+            msg.payload = bytes(data[pos:])
+            break
+        delta, pos = _read_ext(byte >> 4, data, pos)
+        length, pos = _read_ext(byte & 0x0F, data, pos)
+        if delta is None or length is None or pos + length > len(data):
+            return None
+        number += delta
+        msg.options.append((number, bytes(data[pos:pos + length])))
+        pos += length
+    return msg
+
+
+def post(path: str, payload: bytes = b"", confirmable: bool = False,
+         message_id: Optional[int] = None) -> Message:
+    """Build a POST request to @path with a fresh 2-byte token."""
+    if message_id is None:
+        message_id = struct.unpack(">H", os.urandom(2))[0]
+    options = [(OPT_URI_PATH, seg.encode()) for seg in path.strip("/").split("/") if seg]
+    return Message(TYPE_CON if confirmable else TYPE_NON, CODE_POST, message_id,
+                   os.urandom(2), options, payload)
+
+
+def ack(request: Message, code: int = CODE_CHANGED) -> Message:
+    """Piggybacked response to a confirmable request."""
+    return Message(TYPE_ACK, code, request.message_id, request.token)
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+mesh_joiner.py  –  Admit QPG6200 Thread nodes through the MeshCoP commissioner
+==============================================================================
+
+Runs on the Raspberry Pi gateway (OpenThread Border Router).
+
+Bulk installation without a BLE session per device: the nodes run the
+Thread joiner (shared/MeshJoiner.h) and the border router's commissioner
+hands them the network credentials over 802.15.4.  This tool starts the
+commissioner and registers every node by its factory EUI-64 and PSKd:
+
+  ot-ctl commissioner start
+  ot-ctl commissioner joiner add <eui64> <pskd> <timeout>
+
+With --secret, the PSKd of each node is derived from its EUI-64 and the
+installation secret the firmware was built with (MESH_JOINER_SECRET), as
+the node does itself: the first 8 symbols of HMAC-SHA256(secret, EUI-64)
+in the PSKd alphabet.  Otherwise each line of the node list gives the
+PSKd after the EUI-64 (e.g. from the device labels).
+
+A node without credentials starts the joiner on its own at boot, and
+retries while no commissioner answers.  --trigger starts it over BLE
+instead (one short write to the Joiner characteristic per node) and reads
+back the joiner state.
+
+Dependencies
+------------
+  pip install bleak          (only for --trigger)
+
+Usage
+-----
+  python3 mesh_joiner.py NODES [--secret SECRET] [--timeout SEC]
+                               [--print] [--trigger NAME] [--debug]
+
+  NODES: a file with one node per line, "EUI64 [PSKD]", '#' comments.
+  --print only lists the EUI-64 / PSKd pairs (e.g. for labels).
+
+  Example:
+    sudo python3 mesh_joiner.py site-a.txt --secret "$SITE_SECRET"
+"""
+
+import argparse
+import asyncio
+import hashlib
+import hmac
+import logging
+import subprocess
+import sys
+
+logging.basicConfig(
+    level=logging.INFO,
+    format="%(asctime)s [%(levelname)s] %(name)s: %(message)s",
+    datefmt="%Y-%m-%d %H:%M:%S",
+    stream=sys.stderr,
+)
+log = logging.getLogger("mesh_joiner")
+
+# ---------------------------------------------------------------------------
+#  Must match shared/MeshJoiner.h and the Thread Config service
+# ---------------------------------------------------------------------------
+
+THREAD_STATUS_UUID = "d000be11-0000-1002-8000-00805f9b3406"
+THREAD_JOINER_UUID = "d000be11-0000-1002-8000-00805f9b340c"
+
+PSKD_ALPHABET    = "0123456789ABCDEFGHJKLMNPRSTUVWXY"
+PSKD_MIN_LEN     = 6          # MESH_JOINER_PSKD_MIN_LEN
+PSKD_MAX_LEN     = 32         # MESH_JOINER_PSKD_MAX_LEN
+PSKD_DERIVED_LEN = 8          # MESH_JOINER_DERIVED_LEN
+
+JOINER_STATES = {0: "idle", 1: "joining", 2: "joined", 3: "failed"}
+PSKD_SOURCES  = {0: "none", 1: "stored", 2: "derived"}
+
+SCAN_TIMEOUT_SEC = 10
+
+
+def derive_pskd(secret: str, eui64: bytes) -> str:
+    """PSKd of a node, as MeshJoiner_Derive() computes it."""
+    bits = int.from_bytes(hmac.new(secret.encode(), eui64, hashlib.sha256).digest(), "big")
+    return "".join(PSKD_ALPHABET[(bits >> (256 - 5 * (i + 1))) & 0x1F] for i in range(PSKD_DERIVED_LEN))
+
+
+def _valid_pskd(pskd: str) -> bool:
+    return PSKD_MIN_LEN <= len(pskd) <= PSKD_MAX_LEN and all(c in PSKD_ALPHABET for c in pskd)
+
+
+def _load_nodes(path: str, secret: str) -> list:
+    """[(eui64 hex, pskd)] from the node list."""
+    nodes = []
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            fields = line.split("#", 1)[0].split()
+            if not fields:
+                continue
+            eui64 = bytes.fromhex(fields[0].replace(":", "").replace("-", ""))
+            if len(eui64) != 8:
+                raise ValueError("line %d: EUI-64 must be 8 bytes" % number)
+            pskd = fields[1].upper() if len(fields) > 1 else None
+            if pskd is None and secret:
+                pskd = derive_pskd(secret, eui64)
+            if pskd is None or not _valid_pskd(pskd):
+                raise ValueError("line %d: no valid PSKd (give one, or --secret)" % number)
+            nodes.append((eui64.hex(), pskd))
+    return nodes
+
+
+def _ot_ctl(*args) -> None:
+    out = subprocess.run(["ot-ctl", *args], capture_output=True, text=True,
+                         timeout=10, check=True).stdout.split()
+    if not out or out[-1] != "Done":
+        raise RuntimeError("ot-ctl %s: %s" % (" ".join(args), " ".join(out) or "no answer"))
+
+
+def _register(nodes: list, timeout: int) -> None:
+    try:
+        _ot_ctl("commissioner", "start")
+    except RuntimeError as exc:
+        if "Already" not in str(exc):
+            raise
+    for eui64, pskd in nodes:
+        _ot_ctl("commissioner", "joiner", "add", eui64, pskd, str(timeout))
+        log.debug("joiner %s added", eui64)
+    log.info("%d joiners registered for %d s", len(nodes), timeout)
+
+
+async def _trigger(name: str) -> int:
+    """Start the joiner over BLE on every node whose name starts with @name."""
+    from bleak import BleakClient, BleakScanner
+
+    log.info("Scanning for '%s*' (timeout=%ds) …", name, SCAN_TIMEOUT_SEC)
+    devices = await BleakScanner.discover(timeout=SCAN_TIMEOUT_SEC)
+    addresses = [d.address for d in devices if d.name and d.name.startswith(name)]
+    failed = 0
+    for address in addresses:
+        try:
+            async with BleakClient(address) as client:
+                await client.write_gatt_char(THREAD_JOINER_UUID, b"\x01", response=True)
+                info = await client.read_gatt_char(THREAD_JOINER_UUID)
+            state = "%s, PSKd %s, EUI-64 %s" % (JOINER_STATES.get(info[0], str(info[0])),
+                                                PSKD_SOURCES.get(info[4], str(info[4])), info[5:13].hex())
+        except Exception as exc:  # one bad node must not stop the batch
+            failed += 1
+            state = "error: %s" % exc
+        print("%s %s" % (address, state))
+    log.info("Joiner started on %d of %d nodes", len(addresses) - failed, len(addresses))
+    return 1 if failed or not addresses else 0
+
+
+def _parse_args():
+    parser = argparse.ArgumentParser(
+        description="Register QPG6200 Thread nodes with the border router's commissioner"
+    )
+    parser.add_argument("nodes", help="Node list: one 'EUI64 [PSKD]' per line")
+    parser.add_argument("--secret", help="Installation secret (MESH_JOINER_SECRET of the firmware)")
+    parser.add_argument("--timeout", type=int, default=3600,
+                        help="Seconds the commissioner accepts the joiners (default: 3600)")
+    parser.add_argument("--print", action="store_true",
+                        help="Only print the EUI-64 and PSKd of every node")
+    parser.add_argument("--trigger", metavar="NAME",
+                        help="Also start the joiner over BLE on nodes whose name starts with NAME")
+    parser.add_argument("--debug", action="store_true",
+                        help="Enable verbose DEBUG logging")
+    return parser.parse_args()
+
+
+def main() -> None:
+    args = _parse_args()
+
+    if args.debug:
+        logging.getLogger().setLevel(logging.DEBUG)
+
+    try:
+        nodes = _load_nodes(args.nodes, args.secret)
+    except (OSError, ValueError) as exc:
+        log.error("%s", exc)
+        sys.exit(1)
+
+    if args.print:
+        for eui64, pskd in nodes:
+            print("%s %s" % (eui64, pskd))
+        sys.exit(0)
+
+    _register(nodes, args.timeout)
+    if args.trigger:
+        sys.exit(asyncio.run(_trigger(args.trigger)))
+
+
+if __name__ == "__main__":
+    main()
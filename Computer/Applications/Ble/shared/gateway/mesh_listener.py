@@ -0,0 +1,391 @@
+#!/usr/bin/env python3
+"""
+mesh_listener.py  –  QPG6200 Thread Events: CoAP Gateway Endpoint
+==================================================================
+
+Runs on the Raspberry Pi gateway (OpenThread Border Router).
+
+Purpose
+-------
+Prints every event sent by the Thread nodes (doorbell rings, motion,
+sound events) as one JSON line on stdout, so it can be piped into MQTT,
+Node-RED (exec node) or a log file.
+
+It is also the gateway the nodes deliver their events to
+(shared/MeshCoap.c).  On start it adds a Thread Network Data service entry
+(enterprise NETDATA_ENTERPRISE, service data "qmev", server data = this
+host's mesh-local EID and port) with ot-ctl, and removes it on exit; the
+nodes find the gateway there (shared/MeshGateway.c).  As a fallback it
+also multicasts an empty POST /gw every ANNOUNCE_SEC; nodes forget such a
+gateway after 180 s.  The nodes send rings, motion and sound events to
+this address as confirmable POST /e requests, acknowledged with 2.04
+Changed, and other telemetry as NON POST /e.  The nodes
+also send it a diagnostics snapshot (shared/MeshDiag.h) every minute as
+a NON POST /d, printed like an event with "via": "diag".
+
+Data flow
+---------
+  this script  ── ot-ctl service add ──►  Network Data  ──►  nodes
+  this script  ── NON POST /gw ──►  ff03::1, CoAP 5683  ──►  nodes
+  nodes  ── NON POST /e (TLV frame) ──►  ff03::1 or this script
+  nodes  ── CON POST /e (TLV frame) ──►  this script   ──►  stdout (JSON)
+  nodes  ◄── ACK 2.04 ──  this script
+  nodes  ── NON POST /d (TLV diagnostics) ──►  this script  ──►  stdout (JSON)
+
+Frame format: see mesh_tlv.py / shared/MeshTlv.h.  Raw UDP payloads from
+pre-CoAP firmware are still decoded ("format": "legacy"), but those nodes
+get no delivery guarantee.  Anything else is skipped.
+
+Event timestamps
+----------------
+Nodes stamp each frame when the event happens, in mesh time (the Thread
+leader's clock, flag "mesh_time") once synced.  This script tracks mesh
+time too (mesh_time.py: exchanges with the leader on UDP 5687, found with
+ot-ctl; none when this border router is the leader itself, where
+mesh_time_server.py must run).  Events with a mesh timestamp then get
+"event_time" (Unix time the event happened, on this host's clock) and
+"latency_ms" (event to arrival here, including mesh hops, retries and
+queueing on the node), next to "rx_time".
+
+A critical event sent while the node has no gateway arrives twice, as
+the ff03::1 multicast and as the confirmable copy, and again if the
+acknowledgement is lost.  Rings are multicast to the chime groups
+(shared/MeshGroup.h), which this script does not join.  Duplicates (same device
+id and sequence number within DEDUP_WINDOW_SEC) are acknowledged but
+printed only once.  The "via" field tells how the first copy came in
+("con", "non", "udp", or "diag" for a diagnostics snapshot).
+
+Signed frames
+-------------
+With --auth-keys (the key file of ble_commission.py), every frame is
+checked like a node does (mesh_auth.py, shared/MeshAuth.h): the AES-CCM
+tag of its AUTH record with the key of its sender, and its frame counter
+against the sender's replay window.  Frames that are unsigned, from an
+unknown sender or with a bad tag are dropped without an acknowledgement;
+a replay is acknowledged but not printed, like a duplicate.  Printed
+events then carry "auth": "valid".  Without the option frames are not
+checked, and a forged frame is printed like any other.
+
+Dependencies
+------------
+  Python 3.8+ standard library only (mesh_tlv.py, mesh_coap.py,
+  mesh_time.py and mesh_auth.py in this directory).
+
+Usage
+-----
+  python3 mesh_listener.py [--iface wpan0] [--port PORT] [--no-announce]
+                           [--no-netdata] [--no-timesync]
+                           [--auth-keys FILE] [--debug]
+
+  The Network Data entry and the time sync need ot-ctl (OTBR) and usually
+  root; without it the nodes still find this host through the /gw
+  announcement, and events carry "rx_time" only.
+
+  Example:
+    python3 mesh_listener.py | mosquitto_pub -l -t home/thread/events
+"""
+
+import argparse
+import json
+import logging
+import select
+import signal
+import socket
+import struct
+import subprocess
+import sys
+import time
+
+import mesh_auth
+import mesh_coap
+import mesh_time
+import mesh_tlv
+
+# ---------------------------------------------------------------------------
+#  Logging (stderr, so stdout only carries events)
+# ---------------------------------------------------------------------------
+
+logging.basicConfig(
+    level=logging.INFO,
+    format="%(asctime)s [%(levelname)s] %(name)s: %(message)s",
+    datefmt="%Y-%m-%d %H:%M:%S",
+    stream=sys.stderr,
+)
+log = logging.getLogger("mesh_listener")
+
+# ---------------------------------------------------------------------------
+#  Configuration defaults
+# ---------------------------------------------------------------------------
+
+EVENT_PORT       = mesh_coap.PORT         # MESH_COAP_PORT
+EVENT_GROUP      = mesh_coap.MCAST_GROUP  # MESH_COAP_MCAST, realm-local all-nodes
+DEFAULT_IFACE    = "wpan0"
+DEDUP_WINDOW_SEC = 10
+ANNOUNCE_SEC     = 30         # well inside MESH_COAP_GATEWAY_TIMEOUT_MS
+ANNOUNCE_HOPS    = 16         # so the announcement crosses multi-hop meshes
+STATS_INTERVAL_SEC = 300
+NETDATA_ENTERPRISE = 44970    # MESH_GATEWAY_ENTERPRISE
+NETDATA_SERVICE  = b"qmev"    # MESH_GATEWAY_SERVICE_DATA
+LEADER_REFRESH_SEC = 60       # ot-ctl lookup of the time master
+
+
+def _join_group(sock: socket.socket, iface: str) -> None:
+    index = socket.if_nametoindex(iface)
+    mreq = socket.inet_pton(socket.AF_INET6, EVENT_GROUP) + struct.pack("@I", index)
+    sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_JOIN_GROUP, mreq)
+    sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_MULTICAST_IF, index)
+    sock.setsockopt(socket.IPPROTO_IPV6, socket.IPV6_MULTICAST_HOPS, ANNOUNCE_HOPS)
+
+
+def _announce(sock: socket.socket, port: int) -> None:
+    msg = mesh_coap.post(mesh_coap.URI_GATEWAY)
+    try:
+        sock.sendto(mesh_coap.encode(msg), (EVENT_GROUP, port))
+    except OSError as exc:
+        log.warning("Gateway announcement failed: %s", exc)
+
+
+def _ot_ctl(*cmd: str) -> list:
+    """Run one ot-ctl command; returns its output lines without "Done"."""
+    out = subprocess.run(["ot-ctl"] + list(cmd), capture_output=True, text=True,
+                         timeout=10, check=True).stdout.splitlines()
+    out = [line.strip() for line in out if line.strip()]
+    if "Done" not in out:
+        raise RuntimeError(" ".join(out) or "no answer")
+    return [line for line in out if line != "Done"]
+
+
+def _netdata_add(port: int) -> bool:
+    """Publish this host as the gateway in the Thread Network Data."""
+    try:
+        mleid = _ot_ctl("ipaddr", "mleid")[0]
+        server = socket.inet_pton(socket.AF_INET6, mleid) + struct.pack(">H", port)
+        _ot_ctl("service", "add", str(NETDATA_ENTERPRISE), NETDATA_SERVICE.hex(), server.hex())
+        _ot_ctl("netdata", "register")
+    except (OSError, IndexError, RuntimeError, subprocess.SubprocessError) as exc:
+        log.warning("Network Data service not added (%s); nodes rely on /gw", exc)
+        return False
+    log.info("Network Data service %d/%s -> [%s]:%d", NETDATA_ENTERPRISE,
+             NETDATA_SERVICE.decode(), mleid, port)
+    return True
+
+
+def _netdata_remove() -> None:
+    try:
+        _ot_ctl("service", "remove", str(NETDATA_ENTERPRISE), NETDATA_SERVICE.hex())
+        _ot_ctl("netdata", "register")
+    except (OSError, RuntimeError, subprocess.SubprocessError) as exc:
+        log.warning("Network Data service not removed: %s", exc)
+
+
+def _leader_address():
+    """Return (leader RLOC, this host is leader), or (None, False) without ot-ctl."""
+    try:
+        if _ot_ctl("state")[0] == "leader":
+            return None, True
+        router_id = next(int(line.split(":")[1]) for line in _ot_ctl("leaderdata")
+                         if line.startswith("Leader Router ID"))
+        rloc = bytearray(socket.inet_pton(socket.AF_INET6, _ot_ctl("ipaddr", "rloc")[0]))
+    except (OSError, IndexError, ValueError, StopIteration, RuntimeError,
+            subprocess.SubprocessError) as exc:
+        log.debug("Time master not found: %s", exc)
+        return None, False
+    rloc[14:16] = struct.pack(">H", router_id << 10)
+    return socket.inet_ntop(socket.AF_INET6, bytes(rloc)), False
+
+
+def _stamp(event: dict, clock: mesh_time.MeshClock, rx_us: int) -> None:
+    """Add event_time and latency_ms to an event with a mesh timestamp."""
+    if not event.get("mesh_time") or "timestamp_us" not in event or not clock.synced(rx_us):
+        return
+    latency_us = rx_us - clock.to_host(event["timestamp_us"], rx_us)
+    event["event_time"] = round(time.time() - latency_us / 1e6, 6)
+    event["latency_ms"] = round(latency_us / 1000, 1)
+
+
+def _unpack(data: bytes, addr, sock: socket.socket, auth):
+    """Return (TLV payload, via, auth result) for an event datagram, or (None, reason, None).
+
+    Confirmable requests are acknowledged here, before decoding, so a node
+    retransmitting an event it already delivered gets its ACK again.  With
+    an AuthChecker, a frame it rejects is not acknowledged.
+    """
+    msg = mesh_coap.decode(data)
+    if msg is None:
+        payload, via = data, "udp"
+    elif msg.code != mesh_coap.CODE_POST:
+        return None, "coap code 0x%02x" % msg.code, None
+    elif msg.uri_path == mesh_coap.URI_DIAG:
+        payload, via = msg.payload, "diag"
+    elif msg.uri_path == mesh_coap.URI_EVENT:
+        payload, via = msg.payload, "con" if msg.confirmable else "non"
+    else:
+        if msg.confirmable:
+            sock.sendto(mesh_coap.encode(mesh_coap.ack(msg, mesh_coap.CODE_NOT_FOUND)), addr)
+        return None, "coap /" + msg.uri_path, None
+
+    result = auth.check(payload) if auth is not None else None
+    if result == mesh_auth.REJECTED:
+        return None, via + ", auth rejected", result
+    if msg is not None and msg.confirmable:
+        sock.sendto(mesh_coap.encode(mesh_coap.ack(msg)), addr)
+    return payload, via, result
+
+
+# ---------------------------------------------------------------------------
+#  Main loop
+# ---------------------------------------------------------------------------
+
+def _run(args) -> None:
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("::", args.port))
+    _join_group(sock, args.iface)
+    tsock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    tsock.bind(("::", 0))
+    clock = mesh_time.MeshClock()
+    leader = None
+
+    running = True
+
+    def _shutdown(sig, frame):
+        nonlocal running
+        running = False
+
+    signal.signal(signal.SIGINT, _shutdown)
+    signal.signal(signal.SIGTERM, _shutdown)
+
+    registered = args.netdata and _netdata_add(args.port)
+    auth = mesh_auth.AuthChecker(mesh_auth.load_keys(args.auth_keys)) if args.auth_keys else None
+
+    seen = {}
+    printed = 0
+    skipped = 0
+    duplicates = 0
+    replays = 0
+    via_count = {"con": 0, "non": 0, "udp": 0, "diag": 0}
+    next_announce = time.monotonic()
+    next_stats = time.monotonic() + STATS_INTERVAL_SEC
+    next_leader = time.monotonic() if args.timesync else float("inf")
+    next_sync = next_leader
+    latency = []
+
+    try:
+        while running:
+            if time.monotonic() >= next_leader:
+                found, master = _leader_address()
+                if (found, master) != (leader, clock.master):
+                    log.info("Mesh time master: %s", "this host" if master else found or "none")
+                leader = found
+                clock.set_master(master)
+                next_leader = time.monotonic() + LEADER_REFRESH_SEC
+            if leader is not None and time.monotonic() >= next_sync:
+                try:
+                    tsock.sendto(clock.build_request(mesh_time.host_now_us()),
+                                 (leader, mesh_time.PORT))
+                except OSError as exc:
+                    log.debug("Time request failed: %s", exc)
+                next_sync = time.monotonic() + clock.interval()
+            if args.announce and time.monotonic() >= next_announce:
+                _announce(sock, args.port)
+                next_announce = time.monotonic() + ANNOUNCE_SEC
+            if time.monotonic() >= next_stats:
+                log.info("events %d (con %d non %d udp %d diag %d) duplicates %d other %d",
+                         printed, via_count["con"], via_count["non"], via_count["udp"],
+                         via_count["diag"], duplicates, skipped)
+                if auth is not None:
+                    log.info("auth valid %d open %d replay %d rejected %d",
+                             auth.stats[mesh_auth.VALID], auth.stats[mesh_auth.OPEN],
+                             auth.stats[mesh_auth.REPLAY], auth.stats[mesh_auth.REJECTED])
+                if latency:
+                    log.info("latency ms avg %.1f max %.1f (%d events), mesh time rtt %d us drift %d ppb",
+                             sum(latency) / len(latency), max(latency), len(latency),
+                             clock.rtt_us, clock.drift_ppb)
+                    latency = []
+                next_stats = time.monotonic() + STATS_INTERVAL_SEC
+
+            ready, _, _ = select.select([sock, tsock], [], [], 1.0)
+            if tsock in ready:
+                data, _ = tsock.recvfrom(64)
+                clock.handle_response(data, mesh_time.host_now_us())
+            if sock not in ready:
+                continue
+            data, addr = sock.recvfrom(256)
+            rx_us = mesh_time.host_now_us()
+
+            payload, via, result = _unpack(data, addr, sock, auth)
+            event = mesh_tlv.decode_any(payload) if payload is not None else None
+            if event is None:
+                skipped += 1
+                log.debug("Skipping %d-byte datagram (%s) from %s", len(data), via, addr[0])
+                continue
+            if result == mesh_auth.REPLAY:
+                replays += 1
+                log.debug("Replayed frame from %s (%s)", event.get("device_id"), via)
+                continue
+
+            now = time.monotonic()
+            if "device_id" in event:
+                key = (event["device_id"], event["seq"])
+                if now - seen.get(key, -DEDUP_WINDOW_SEC) < DEDUP_WINDOW_SEC:
+                    duplicates += 1
+                    log.debug("Duplicate seq %d from %s (%s)", event["seq"], event["device_id"], via)
+                    continue
+                seen[key] = now
+                if len(seen) > 1024:
+                    seen = {k: t for k, t in seen.items() if now - t < DEDUP_WINDOW_SEC}
+
+            event["src"] = addr[0]
+            event["via"] = via
+            if result is not None:
+                event["auth"] = result
+            event["rx_time"] = time.time()
+            _stamp(event, clock, rx_us)
+            if "latency_ms" in event and via != "diag":
+                latency.append(event["latency_ms"])
+            via_count[via] += 1
+            print(json.dumps(event), flush=True)
+            printed += 1
+    finally:
+        if registered:
+            _netdata_remove()
+        sock.close()
+        tsock.close()
+        log.info("Stopped: %d events, %d duplicates, %d replays, %d other datagrams",
+                 printed, duplicates, replays, skipped)
+
+
+def _parse_args():
+    parser = argparse.ArgumentParser(
+        description="Gateway endpoint for QPG6200 Thread node events: acknowledge and print as JSON lines"
+    )
+    parser.add_argument("--iface", default=DEFAULT_IFACE,
+                        help=f"Thread network interface (default: {DEFAULT_IFACE})")
+    parser.add_argument("--port", type=int, default=EVENT_PORT,
+                        help=f"CoAP port (default: {EVENT_PORT})")
+    parser.add_argument("--no-announce", dest="announce", action="store_false",
+                        help="Do not announce this host as the gateway (listen to multicast only)")
+    parser.add_argument("--no-netdata", dest="netdata", action="store_false",
+                        help="Do not add the gateway service to the Thread Network Data")
+    parser.add_argument("--no-timesync", dest="timesync", action="store_false",
+                        help="Do not track mesh time (no event_time / latency_ms)")
+    parser.add_argument("--auth-keys", metavar="FILE",
+                        help="Check signed frames with the keys of this JSON file (ble_commission.py)")
+    parser.add_argument("--debug", action="store_true",
+                        help="Enable verbose DEBUG logging")
+    return parser.parse_args()
+
+
+def main() -> None:
+    args = _parse_args()
+
+    if args.debug:
+        logging.getLogger().setLevel(logging.DEBUG)
+
+    log.info("Listening for events on [%s]:%d via %s%s", EVENT_GROUP, args.port, args.iface,
+             ", announcing /gw every %d s" % ANNOUNCE_SEC if args.announce else "")
+    _run(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,187 @@
+"""
+mesh_time.py  –  Mesh time client for the gateway
+=================================================
+
+Mirrors the estimator of shared/MeshTime.c so the gateway can read the
+mesh timestamps in event frames (flag 0x01, mesh_tlv.py).  Mesh time is
+the microsecond clock of the Thread leader, wrapped to 32 bits; the
+gateway tracks it against its own CLOCK_MONOTONIC with the same exchange
+the nodes use (UDP port 5687, see ThreadBleSpeaker/gateway/mesh_time_server.py):
+
+  Request   : 0x06, seq, t1 (BE32, host clock), 8 bytes padding
+  Response  : 0x07, seq, t1 (echoed), t2 (BE32, mesh), t3 (BE32, mesh)
+
+  - Offset: min-RTT sample of the last WINDOW exchanges.
+  - Drift: from min-RTT anchors at least DRIFT_MIN_SPAN_US apart, weight 1/4.
+  - A jump of more than STEP_US (new leader) restarts the estimate.
+
+When the border router itself is leader, mesh time is its own monotonic
+clock (mesh_time_server.py answers the nodes) and no exchange is needed:
+see MeshClock.set_master().
+
+Python 3.8+ standard library only.
+"""
+
+import struct
+import time
+from typing import Optional
+
+PORT = 5687                  # MESH_TIME_UDP_PORT
+MSG_REQUEST = 0x06
+MSG_RESPONSE = 0x07
+MSG_LEN = 14
+
+WINDOW = 8                   # MESH_TIME_WINDOW
+MAX_RTT_US = 100000          # MESH_TIME_MAX_RTT_US
+SYNCED_SAMPLES = 3           # MESH_TIME_SYNCED_SAMPLES
+DRIFT_MIN_SPAN_US = 30000000 # MESH_TIME_DRIFT_MIN_SPAN_US
+DRIFT_MAX_PPB = 100000       # MESH_TIME_DRIFT_MAX_PPB
+STEP_US = 20000              # MESH_TIME_STEP_US
+HOLDOVER_US = 120000000      # MESH_TIME_HOLDOVER_US
+FAST_INTERVAL_SEC = 1.0      # MESH_TIME_FAST_INTERVAL_MS
+SLOW_INTERVAL_SEC = 8.0      # MESH_TIME_SLOW_INTERVAL_MS
+
+
+def host_now_us() -> int:
+    """Host clock: CLOCK_MONOTONIC in microseconds, not wrapped."""
+    return time.monotonic_ns() // 1000
+
+
+def _s32(value: int) -> int:
+    """Signed 32-bit view of a difference of wrapped timestamps."""
+    value &= 0xFFFFFFFF
+    return value - 0x100000000 if value >= 0x80000000 else value
+
+
+class MeshClock:
+    """mesh = host + offset + drift * (host - anchor), offsets modulo 2^32."""
+
+    def __init__(self) -> None:
+        self.master = False
+        self.requests = 0
+        self.accepted = 0
+        self.rejected = 0
+        self.steps = 0
+        self.rtt_us = 0          # round trip of the current anchor
+        self._seq = 0
+        self._pending_t1: Optional[int] = None
+        self._pending_host_us = 0
+        self._last_good_us: Optional[int] = None
+        self._anchor_host_us = 0
+        self._anchor_offset_us = 0
+        self._reset()
+
+    def _reset(self) -> None:
+        self._window = []        # (host_us, offset_us, rtt_us)
+        self._good = 0
+        self.drift_ppb = 0.0
+        self._have_drift = False
+        self._ref = None         # (host_us, offset_us)
+
+    def _offset(self, host_us: int) -> int:
+        drift = self.drift_ppb * (host_us - self._anchor_host_us) / 1e9
+        return (self._anchor_offset_us + int(drift)) & 0xFFFFFFFF
+
+    # -- State -------------------------------------------------------------
+
+    def set_master(self, master: bool) -> None:
+        """This host is the leader: mesh time is host_now_us(), wrapped."""
+        if master != self.master:
+            self.master = master
+            self._anchor_offset_us = 0
+            self._anchor_host_us = 0
+            self._last_good_us = None
+            self._pending_t1 = None
+            self._reset()
+
+    def synced(self, now_us: Optional[int] = None) -> bool:
+        if self.master:
+            return True
+        if self._last_good_us is None or self._good < SYNCED_SAMPLES:
+            return False
+        return (now_us if now_us is not None else host_now_us()) - self._last_good_us <= HOLDOVER_US
+
+    def interval(self) -> float:
+        """Seconds until the next exchange."""
+        if self._good < WINDOW or not self._have_drift:
+            return FAST_INTERVAL_SEC
+        return SLOW_INTERVAL_SEC
+
+    # -- Conversion --------------------------------------------------------
+
+    def to_mesh(self, host_us: int) -> int:
+        if self.master:
+            return host_us & 0xFFFFFFFF
+        return (host_us + self._offset(host_us)) & 0xFFFFFFFF
+
+    def to_host(self, mesh_us: int, near_us: int) -> int:
+        """Host time of a 32-bit mesh timestamp, the occurrence closest to near_us."""
+        return near_us + _s32(mesh_us - self.to_mesh(near_us))
+
+    # -- Exchange ----------------------------------------------------------
+
+    def build_request(self, now_us: int) -> bytes:
+        if self._last_good_us is not None and now_us - self._last_good_us > HOLDOVER_US:
+            self._reset()
+            self._last_good_us = None
+        self._seq = (self._seq + 1) & 0xFF
+        self._pending_t1 = now_us & 0xFFFFFFFF
+        self._pending_host_us = now_us
+        self.requests += 1
+        return struct.pack(">BBI8x", MSG_REQUEST, self._seq, self._pending_t1)
+
+    def handle_response(self, data: bytes, rx_us: int) -> bool:
+        """Feed a response; True if it was used."""
+        if self.master or len(data) != MSG_LEN or data[0] != MSG_RESPONSE:
+            return False
+        _, seq, t1, t2, t3 = struct.unpack(">BBIII", data)
+        if self._pending_t1 is None or seq != self._seq or t1 != self._pending_t1:
+            self.rejected += 1
+            return False
+        self._pending_t1 = None
+
+        t4 = rx_us & 0xFFFFFFFF
+        forward = _s32(t2 - t1)
+        rtt = max(0, _s32(t4 - t1) - _s32(t3 - t2))
+        if rtt > MAX_RTT_US:
+            self.rejected += 1
+            return False
+        # Same form as MeshTime.c: (t2 - t1) + ((t3 - t4) - (t2 - t1)) / 2
+        offset = (forward + (_s32(t3 - t4) - forward) // 2) & 0xFFFFFFFF
+        host_mid = (self._pending_host_us + rx_us) // 2
+
+        if self._good > 0 and abs(_s32(offset - self._offset(host_mid))) > STEP_US + rtt // 2:
+            self.steps += 1
+            self._reset()
+
+        self._window = (self._window + [(host_mid, offset, rtt)])[-WINDOW:]
+        self._good = min(self._good + 1, 255)
+        self._last_good_us = rx_us
+        self.accepted += 1
+        self._update_anchor()
+        return True
+
+    def _update_anchor(self) -> None:
+        host_us, offset, rtt = min(self._window, key=lambda s: s[2])
+        if self._good > 1 and host_us == self._anchor_host_us:
+            return
+        error = _s32(offset - self._offset(host_us)) if self._good > 1 else 0
+
+        if self._ref is None:
+            self._ref = (host_us, offset)
+        elif host_us - self._ref[0] >= DRIFT_MIN_SPAN_US:
+            rate = _s32(offset - self._ref[1]) * 1e9 / (host_us - self._ref[0])
+            rate = max(-DRIFT_MAX_PPB, min(DRIFT_MAX_PPB, rate))
+            if self._have_drift:
+                self.drift_ppb += (rate - self.drift_ppb) / 4
+            else:
+                self.drift_ppb = rate
+                self._have_drift = True
+            self._ref = (host_us, offset)
+
+        if self._have_drift:
+            self._anchor_offset_us = (self._offset(host_us) + error // 2) & 0xFFFFFFFF
+        else:
+            self._anchor_offset_us = offset
+        self._anchor_host_us = host_us
+        self.rtt_us = rtt
@@ -0,0 +1,229 @@
+"""
+mesh_tlv.py  –  Thread application protocol: TLV frame encoder / decoder
+=======================================================================
+
+Mirrors shared/MeshTlv.h in the firmware.  Every Thread node sends each
+event as one frame, the payload of a CoAP POST /e on port 5683
+(mesh_coap.py):
+
+  Byte 0     : 0xA0 | version (0xA1)
+  Byte 1     : flags (0x01 = timestamp is mesh time)
+  Byte 2     : device type
+  Byte 3-6   : device id, low 32 bits of the factory EUI-64 (BE32)
+  Byte 7-8   : sequence number (BE16)
+  Byte 9-12  : timestamp, us (BE32)
+  Byte 13..  : records: type (1), length (1), value (length)
+
+Unknown record types are kept as raw bytes, missing trailing fields of a
+known record decode as 0 and extra trailing bytes are ignored, so old and
+new senders and parsers can be mixed.
+
+decode_any() also understands the fixed-format raw UDP payloads sent by
+older firmware (first byte 0x01..0x03).
+"""
+
+import struct
+from dataclasses import dataclass, field
+from typing import Dict, List, Optional, Tuple
+
+MARKER = 0xA0
+MARKER_MASK = 0xF0
+VERSION = 1
+HEADER_LEN = 13
+MAX_FRAME = 64
+
+FLAG_MESH_TIME = 0x01
+
+DEVICE_TYPES = {
+    0x00: "unknown",
+    0x01: "doorbell",
+    0x02: "motion",
+    0x03: "microphone",
+    0x04: "speaker",
+    0x05: "gateway",
+}
+
+# Record registry: type -> (name, [(field, struct format), ...])
+RECORDS: Dict[int, Tuple[str, List[Tuple[str, str]]]] = {
+    0x01: ("ring",    [("state", "B"), ("count", "H"), ("chime", "B")]),
+    0x02: ("play_at", [("mesh_us", "I")]),
+    0x03: ("motion",  [("detected", "B"), ("distance_cm", "H")]),
+    0x04: ("sound",   [("class", "B"), ("level_db", "b"), ("age_ms", "H")]),
+    # Diagnostics snapshot (POST /d to the gateway, shared/MeshDiag.h)
+    0x05: ("diag_node", [("role", "B"), ("rloc16", "H"), ("parent_rloc16", "H"),
+                         ("partition_id", "I"), ("uptime_s", "I")]),
+    0x06: ("diag_mle",  [("attach_attempts", "H"), ("parent_changes", "H"),
+                         ("partition_changes", "H"), ("detached", "H")]),
+    0x07: ("diag_mac",  [("tx", "I"), ("tx_retry", "I"), ("tx_err_cca", "I"),
+                         ("tx_failed", "I"), ("rx", "I"), ("rx_err", "I")]),
+    0x08: ("diag_buf",  [("total", "H"), ("free", "H"), ("max_used", "H")]),
+    0x09: ("neighbor",  [("rloc16", "H"), ("rssi_dbm", "b"), ("margin_db", "B"),
+                         ("lqi_in", "B"), ("flags", "B"), ("frame_err_pct", "B")]),
+    0x0A: ("auth",      [("counter", "I"), ("tag", "8s")]),
+    0x0B: ("diag_txpower", [("dbm", "b"), ("max_dbm", "b"), ("margin_db", "B"), ("retry_pct", "B"),
+                            ("limit_rloc16", "H"), ("changes", "H"), ("reason", "B")]),
+    0x0C: ("diag_role", [("policy", "B"), ("leader_weight", "B"), ("role_changes", "H"),
+                         ("router_upgrades", "H"), ("router_downgrades", "H"), ("leader_terms", "H"),
+                         ("detaches", "H"), ("role_age_s", "I")]),
+    0x0D: ("diag_recovery", [("last_reason", "B"), ("outages_lt2s", "H"), ("outages_lt5s", "H"),
+                             ("outages_lt15s", "H"), ("outages_lt60s", "H"), ("outages_lt300s", "H"),
+                             ("outages_longer", "H"), ("last_ms", "I"), ("longest_ms", "I"),
+                             ("current_ms", "I"), ("parent_lost", "H"), ("partition_lost", "H"),
+                             ("dataset_changed", "H"), ("deferred", "H"), ("expired", "H"),
+                             ("attach_restarts", "H")]),
+}
+
+REC_RING = 0x01
+REC_PLAY_AT = 0x02
+REC_MOTION = 0x03
+REC_SOUND = 0x04
+REC_DIAG_NODE = 0x05
+REC_DIAG_MLE = 0x06
+REC_DIAG_MAC = 0x07
+REC_DIAG_BUF = 0x08
+REC_NEIGHBOR = 0x09
+REC_AUTH = 0x0A
+REC_DIAG_TXPOWER = 0x0B
+REC_DIAG_ROLE = 0x0C
+REC_DIAG_RECOVERY = 0x0D
+
+
+@dataclass
+class Record:
+    type: int
+    value: bytes
+
+    @property
+    def name(self) -> str:
+        entry = RECORDS.get(self.type)
+        return entry[0] if entry else f"0x{self.type:02x}"
+
+    def fields(self) -> dict:
+        """Known fields of the record; fields past the end of the value read as 0."""
+        entry = RECORDS.get(self.type)
+        if entry is None:
+            return {"raw": self.value.hex()}
+        out = {}
+        pos = 0
+        for name, fmt in entry[1]:
+            size = struct.calcsize(fmt)
+            chunk = self.value[pos:pos + size]
+            value = struct.unpack(">" + fmt, chunk)[0] if len(chunk) == size else 0
+            out[name] = value.hex() if isinstance(value, bytes) else value
+            pos += size
+        return out
+
+
+@dataclass
+class Frame:
+    device_type: int
+    device_id: int
+    seq: int
+    timestamp_us: int
+    flags: int = 0
+    records: List[Record] = field(default_factory=list)
+    truncated: bool = False
+
+    @property
+    def mesh_time(self) -> bool:
+        return bool(self.flags & FLAG_MESH_TIME)
+
+    def find(self, rec_type: int) -> Optional[Record]:
+        return next((r for r in self.records if r.type == rec_type), None)
+
+    def to_dict(self) -> dict:
+        return {
+            "format": "tlv",
+            "device": DEVICE_TYPES.get(self.device_type, f"0x{self.device_type:02x}"),
+            "device_id": f"{self.device_id:08x}",
+            "seq": self.seq,
+            "timestamp_us": self.timestamp_us,
+            "mesh_time": self.mesh_time,
+            "records": [dict(type=r.name, **r.fields()) for r in self.records],
+            **({"truncated": True} if self.truncated else {}),
+        }
+
+
+def is_frame(data: bytes) -> bool:
+    return len(data) >= 1 and (data[0] & MARKER_MASK) == MARKER
+
+
+def encode(frame: Frame) -> bytes:
+    """Encode a frame; record values are taken as-is."""
+    out = bytearray(struct.pack(">BBBIHI", MARKER | VERSION, frame.flags,
+                                frame.device_type, frame.device_id,
+                                frame.seq & 0xFFFF, frame.timestamp_us & 0xFFFFFFFF))
+    for rec in frame.records:
+        if len(rec.value) > 255:
+            raise ValueError(f"record 0x{rec.type:02x} longer than 255 bytes")
+        out += bytes((rec.type, len(rec.value))) + rec.value
+    return bytes(out)
+
+
+def record(rec_type: int, **values) -> Record:
+    """Build a known record from its field values (missing fields are 0, or zero bytes)."""
+    _, fields = RECORDS[rec_type]
+    fmt = ">" + "".join(f for _, f in fields)
+    return Record(rec_type, struct.pack(fmt, *(values.get(n, b"" if f.endswith("s") else 0)
+                                               for n, f in fields)))
+
+
+def decode(data: bytes) -> Frame:
+    """Decode a TLV frame.  Raises ValueError if data is not one this module understands."""
+    if not is_frame(data):
+        raise ValueError("not a TLV frame")
+    if data[0] & ~MARKER_MASK & 0xFF != VERSION:
+        raise ValueError(f"unsupported TLV version {data[0] & 0x0F}")
+    if len(data) < HEADER_LEN:
+        raise ValueError("truncated TLV header")
+
+    _, flags, dev_type, dev_id, seq, ts = struct.unpack(">BBBIHI", data[:HEADER_LEN])
+    frame = Frame(dev_type, dev_id, seq, ts, flags)
+    pos = HEADER_LEN
+    while pos < len(data):
+        if pos + 2 > len(data) or pos + 2 + data[pos + 1] > len(data):
+            frame.truncated = True
+            break
+        length = data[pos + 1]
+        frame.records.append(Record(data[pos], bytes(data[pos + 2:pos + 2 + length])))
+        pos += 2 + length
+    return frame
+
+
+def decode_legacy(data: bytes) -> Optional[dict]:
+    """Decode the fixed-format event payloads of older firmware, or None."""
+    if len(data) == 1 and data[0] == 0x01:
+        return {"format": "legacy", "device": "doorbell",
+                "records": [{"type": "ring", "state": 1, "count": 0, "chime": 0}]}
+    if len(data) == 4 and data[0] == 0x01:
+        return {"format": "legacy", "device": "motion",
+                "records": [{"type": "motion", "detected": data[1],
+                             "distance_cm": (data[2] << 8) | data[3]}]}
+    if len(data) in (4, 14) and data[0] == 0x02:
+        out = {"format": "legacy", "device": "doorbell",
+               "records": [{"type": "ring", "state": data[1],
+                            "count": (data[2] << 8) | data[3],
+                            "chime": data[5] if len(data) == 14 else 0}]}
+        if len(data) == 14:
+            sent_at, play_at = struct.unpack(">II", data[6:14])
+            out["timestamp_us"] = sent_at
+            out["mesh_time"] = bool(data[4] & 0x01)
+            if out["mesh_time"]:
+                out["records"].append({"type": "play_at", "mesh_us": play_at})
+        return out
+    if len(data) == 7 and data[0] == 0x03:
+        level = data[2] - 256 if data[2] >= 128 else data[2]
+        return {"format": "legacy", "device": "microphone",
+                "records": [{"type": "sound", "class": data[1], "level_db": level,
+                             "onset_ms": struct.unpack(">I", data[3:7])[0]}]}
+    return None
+
+
+def decode_any(data: bytes) -> Optional[dict]:
+    """Decode a TLV frame or a legacy payload to a JSON-ready dict, or None."""
+    if is_frame(data):
+        try:
+            return decode(data).to_dict()
+        except ValueError:
+            return None
+    return decode_legacy(data)
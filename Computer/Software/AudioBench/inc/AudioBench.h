@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "AudioBench.h"
+ *
+ * On-target entry point of the audio kernel benchmark.
+ *
+ * Link libaudiobench_m4.a (make m4) into any QPG6200 application and call
+ * AudioBench_Run() once, e.g. from the application task before the radio
+ * stacks start.  Each kernel prints one line:
+ *
+ *     CAL <kernel> <cycles per block> <hash> <OK|FAIL|NEW>
+ *
+ * Capture the UART log and feed it to the host tool
+ * (audiobench --calibrate <log>) to refresh calibration/m4_calibration.txt.
+ * Interrupts still run during the measurement; run it on an idle system and
+ * keep the fastest of the passes, which the core already does.
+ */
+
+#ifndef _AUDIO_BENCH_H_
+#define _AUDIO_BENCH_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Line output, e.g. a wrapper around GP_LOG_SYSTEM_PRINTF("%s", 0, pLine) */
+typedef void (*AudioBench_Print_t)(const char* pLine);
+
+/** @brief Run every kernel on the target and print one CAL line each.
+ *  @return Number of kernels whose output did not match the golden hash
+ */
+uint8_t AudioBench_Run(AudioBench_Print_t print);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AUDIO_BENCH_H_ */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "Bench.h"
+ *
+ * Audio kernel benchmark core, shared by the host and Cortex-M4 builds.
+ *
+ * A kernel processes a fixed number of blocks of deterministic input.  One
+ * verification pass hashes every output block (FNV-1a); that hash is the
+ * golden output.  Timed passes then run the same blocks without hashing and
+ * the fastest pass is kept.  A second verification pass after timing must
+ * give the same hash, which catches state that leaks between passes.
+ *
+ * Time is counted in platform ticks: nanoseconds on the host, core cycles
+ * on the M4 (DWT cycle counter).  Only <stdint.h> arithmetic is used here
+ * so the core runs unchanged on the target.
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** FNV-1a 32-bit offset basis: hash of an empty output */
+#define BENCH_HASH_INIT        0x811C9DC5UL
+
+/** Timed passes: at least this many, and at least BenchPlatform min ticks */
+#define BENCH_MIN_PASSES       5
+#define BENCH_MAX_PASSES       2000
+
+typedef struct
+{
+    const char* name;
+    const char* source;             /**< Module(s) exercised */
+    uint16_t    samplesPerBlock;    /**< Audio samples produced per block */
+    uint16_t    numBlocks;          /**< Blocks per pass (fixed: part of the golden output) */
+    uint32_t    blockRateMilliHz;   /**< Real-time block rate on the node, 0 = not run on the node */
+    void      (*prepare)(void);     /**< Build the input (untimed, once) */
+    void      (*reset)(void);       /**< Reset kernel state before a pass (untimed) */
+    void      (*run)(uint16_t block, uint32_t* pHash);  /**< pHash is NULL in timed passes */
+} Bench_Kernel_t;
+
+typedef struct
+{
+    uint32_t hash;            /**< Verification pass output hash */
+    bool     stable;          /**< Second verification pass gave the same hash */
+    uint32_t passes;          /**< Timed passes run */
+    uint64_t bestPassTicks;   /**< Fastest timed pass */
+} Bench_Result_t;
+
+/** Kernel table (BenchKernels.c); entry 0 is the reference workload */
+extern const Bench_Kernel_t Bench_Kernels[];
+extern const uint8_t        Bench_NumKernels;
+
+/** @brief FNV-1a over @p len bytes, continuing from @p hash. */
+uint32_t Bench_Hash(uint32_t hash, const void* pData, uint32_t len);
+
+/** @brief Verify and time one kernel.
+ *  @param minTicks Keep running timed passes until this much time has been measured
+ */
+void Bench_Run(const Bench_Kernel_t* pKernel, uint64_t minTicks, Bench_Result_t* pResult);
+
+/** @brief Ticks per block of the fastest pass, times 1000 (integer). */
+uint64_t Bench_MilliTicksPerBlock(const Bench_Kernel_t* pKernel, const Bench_Result_t* pResult);
+
+/* -------------------------------------------------------------------------
+ * Platform hooks (BenchPlatform_host.c / BenchPlatform_m4.c)
+ * ------------------------------------------------------------------------- */
+
+/** @return Free-running tick counter, 64-bit */
+uint64_t BenchPlatform_Ticks(void);
+
+/** @return Ticks per second */
+uint64_t BenchPlatform_TicksPerSecond(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BENCH_H_ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BenchSignals.h"
+ *
+ * Deterministic integer test signals for the audio kernel benchmarks.
+ *
+ * Everything is generated from fixed seeds with integer arithmetic, so the
+ * input (and therefore the golden output) is bit-identical on every
+ * platform and every run.
+ */
+
+#ifndef _BENCH_SIGNALS_H_
+#define _BENCH_SIGNALS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Phase increment for @p freqHz at @p sampleRateHz (32-bit phase accumulator) */
+#define BENCH_PHASE_INC(freqHz, sampleRateHz) \
+    ((uint32_t)(((uint64_t)(freqHz) << 32) / (sampleRateHz)))
+
+typedef struct
+{
+    uint32_t phase;
+    uint32_t inc;
+} BenchTone_t;
+
+/** @brief Next sample of a Q15 sine, scaled by @p amp. */
+int16_t BenchSignal_Tone(BenchTone_t* pTone, int16_t amp);
+
+/** @brief Next value of a 32-bit LCG, as a full-scale signed sample. */
+int16_t BenchSignal_Noise(uint32_t* pSeed);
+
+/** @brief Saturate to 16 bits. */
+int16_t BenchSignal_Sat16(int32_t v);
+
+typedef struct
+{
+    int32_t     integrator;
+    BenchTone_t toneA;
+    BenchTone_t toneB;
+} BenchPdm_t;
+
+/** @brief First-order sigma-delta PDM of two tones, 16 bits per word,
+ *  words stored little-endian as the I2S DMA delivers them.
+ *  @param pState  Modulator state; set the tone increments, zero the rest
+ */
+void BenchSignal_Pdm(BenchPdm_t* pState, uint8_t* pOut, uint16_t numBytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BENCH_SIGNALS_H_ */
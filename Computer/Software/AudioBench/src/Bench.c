@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "Bench.c"
+ *
+ * Benchmark core: verification passes, timed passes, result arithmetic.
+ */
+
+#include "Bench.h"
+
+#include <stddef.h>
+
+/* -------------------------------------------------------------------------
+ * Hashing
+ * ------------------------------------------------------------------------- */
+
+uint32_t Bench_Hash(uint32_t hash, const void* pData, uint32_t len)
+{
+    const uint8_t* p = (const uint8_t*)pData;
+
+    /* Bytes are hashed in memory order; all supported targets are
+     * little-endian, so host and M4 golden values agree. */
+    for(uint32_t i = 0; i < len; i++)
+    {
+        hash ^= p[i];
+        hash *= 0x01000193UL;
+    }
+    return hash;
+}
+
+/* -------------------------------------------------------------------------
+ * Passes
+ * ------------------------------------------------------------------------- */
+
+static uint32_t Bench_VerifyPass(const Bench_Kernel_t* pKernel)
+{
+    uint32_t hash = BENCH_HASH_INIT;
+
+    pKernel->reset();
+    for(uint16_t b = 0; b < pKernel->numBlocks; b++)
+    {
+        pKernel->run(b, &hash);
+    }
+    return hash;
+}
+
+static uint64_t Bench_TimedPass(const Bench_Kernel_t* pKernel)
+{
+    pKernel->reset();
+
+    uint64_t start = BenchPlatform_Ticks();
+    for(uint16_t b = 0; b < pKernel->numBlocks; b++)
+    {
+        pKernel->run(b, NULL);
+    }
+    return BenchPlatform_Ticks() - start;
+}
+
+void Bench_Run(const Bench_Kernel_t* pKernel, uint64_t minTicks, Bench_Result_t* pResult)
+{
+    uint64_t total = 0;
+
+    pKernel->prepare();
+
+    pResult->hash          = Bench_VerifyPass(pKernel);
+    pResult->passes        = 0;
+    pResult->bestPassTicks = UINT64_MAX;
+
+    while(pResult->passes < BENCH_MAX_PASSES &&
+          (pResult->passes < BENCH_MIN_PASSES || total < minTicks))
+    {
+        uint64_t ticks = Bench_TimedPass(pKernel);
+
+        total += ticks;
+        if(ticks < pResult->bestPassTicks)
+        {
+            pResult->bestPassTicks = ticks;
+        }
+        pResult->passes++;
+    }
+
+    pResult->stable = (Bench_VerifyPass(pKernel) == pResult->hash);
+}
+
+uint64_t Bench_MilliTicksPerBlock(const Bench_Kernel_t* pKernel, const Bench_Result_t* pResult)
+{
+    return (pResult->bestPassTicks * 1000U) / pKernel->numBlocks;
+}
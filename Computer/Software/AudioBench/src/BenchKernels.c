@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BenchKernels.c"
+ *
+ * The audio kernels under test, built straight from the application sources:
+ *
+ *   reference       fixed integer MAC loop, the unit for the M4 budget
+ *   pdm_decimator   PdmDecimator_Process, one 512-byte I2S DMA half
+ *   voice_activity  VoiceActivity_Process, one DMA half at the idle clock
+ *   fft_128         FixedFft_Forward, 128 points
+ *   sound_detector  SoundDetector_ProcessFrame (window, FFT, bands, classes)
+ *   adpcm_encode    ImaAdpcm_Encode, one 96-sample stream packet
+ *   adpcm_decode    ImaAdpcm_Decode, one packet (gateway side, not on the node)
+ *   chime_dac       ChimeSynth -> AudioRing -> DAC6551A frames, 128 samples
+ *   chime_pwm       ChimeSynth -> PWMXL duty words (4x hold), 128 samples
+ *
+ * The DAC frame and PWM duty conversions live inside SDK-dependent drivers
+ * (Dac6551.c, PwmAudio.c), so the same expressions are repeated here.  Keep
+ * BENCH_DAC_FRAME / BENCH_PWM_DUTY in step with those files.
+ *
+ * Inputs are generated into one shared arena in prepare(), so the timed
+ * loop only touches the kernel and its output buffer.
+ */
+
+#include "Bench.h"
+#include "BenchSignals.h"
+
+#include "PdmDecimator.h"
+#include "VoiceActivity.h"
+#include "FixedFft.h"
+#include "SoundDetector.h"
+#include "ImaAdpcm.h"
+#include "ChimeSynth.h"
+#include "AudioRing.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* -------------------------------------------------------------------------
+ * Geometry
+ * ------------------------------------------------------------------------- */
+#define BENCH_REF_ITERATIONS     256
+
+#define BENCH_PDM_BLOCK_BYTES    512        /**< One I2S DMA half (PdmCapture.h) */
+#define BENCH_PDM_BLOCKS         32         /**< 131 ms */
+#define BENCH_PDM_PCM_PER_BLOCK  (BENCH_PDM_BLOCK_BYTES / (2 * PDM_DECIMATOR_WORDS_PER_PCM))
+#define BENCH_VAD_PDM_CLOCK_HZ   500000     /**< MIC_IDLE_PDM_CLOCK_HZ */
+#define BENCH_VAD_PER_BLOCK      (BENCH_PDM_BLOCK_BYTES / (2 * VOICE_ACTIVITY_WORDS_PER_SAMPLE))
+
+#define BENCH_FRAME_BLOCKS       128        /**< 2.1 s of detector frames */
+
+#define BENCH_ADPCM_SAMPLES      96         /**< AUDIO_STREAM_SAMPLES_PER_PACKET */
+#define BENCH_ADPCM_BLOCKS       64
+
+#define BENCH_CHIME_SAMPLES      128        /**< DAC6551_BLOCK_FRAMES / PWM_AUDIO_BLOCK_SAMPLES */
+#define BENCH_CHIME_BLOCKS       256        /**< ~2 s: all four Westminster notes sound */
+#define BENCH_CHIME_RING_LEN     512
+
+#define BENCH_DAC_RATE_HZ        16000      /**< DAC6551_SAMPLE_RATE_HZ */
+#define BENCH_PWM_RATE_HZ        15625      /**< PWM_AUDIO_SAMPLE_RATE_HZ */
+#define BENCH_PWM_OVERSAMPLE     4          /**< PWM_AUDIO_OVERSAMPLE */
+#define BENCH_PWM_PERIOD_TICKS   1024       /**< 62.5 kHz carrier at 64 MHz */
+
+/** DAC6551_FRAME() in Dac6551.h: 12-bit offset binary */
+#define BENCH_DAC_FRAME(_pcm)    ((uint16_t)(((uint16_t)((_pcm) + 32768)) >> 4))
+
+/** PwmAudio_Convert() in PwmAudio.c: 0 maps to 50 % duty */
+#define BENCH_PWM_DUTY(_pcm)     ((uint16_t)((((uint32_t)((int32_t)(_pcm) + 32768)) * BENCH_PWM_PERIOD_TICKS) >> 16))
+
+/* Real-time block rates on the node, in mHz */
+#define BENCH_RATE_PDM           244141     /**< 1 Mbit/s / 4096 bits */
+#define BENCH_RATE_VAD           122070     /**< 500 kbit/s / 4096 bits */
+#define BENCH_RATE_FRAME         61035      /**< 7812.5 Hz / 128 */
+#define BENCH_RATE_ADPCM         81380      /**< 7812.5 Hz / 96 */
+#define BENCH_RATE_DAC           125000     /**< 16 kHz / 128 */
+#define BENCH_RATE_PWM           122070     /**< 15.625 kHz / 128 */
+
+/* -------------------------------------------------------------------------
+ * Shared input arena and output buffers
+ * ------------------------------------------------------------------------- */
+static union
+{
+    uint8_t pdm[BENCH_PDM_BLOCKS][BENCH_PDM_BLOCK_BYTES];
+    int16_t frames[BENCH_FRAME_BLOCKS][SOUND_DETECTOR_FRAME_LEN];
+    struct
+    {
+        int16_t pcm[BENCH_ADPCM_BLOCKS][BENCH_ADPCM_SAMPLES];
+        uint8_t codes[BENCH_ADPCM_BLOCKS][BENCH_ADPCM_SAMPLES / 2];
+    } adpcm;
+} sIn;
+
+static int16_t  sPcmOut[SOUND_DETECTOR_FRAME_LEN];
+static int16_t  sImOut[SOUND_DETECTOR_FRAME_LEN];
+static uint8_t  sCodesOut[BENCH_ADPCM_SAMPLES / 2];
+static uint16_t sWordsOut[BENCH_CHIME_SAMPLES * BENCH_PWM_OVERSAMPLE];
+
+static void Bench_Nothing(void)
+{
+}
+
+/* -------------------------------------------------------------------------
+ * reference
+ *
+ * A fixed mix of 32-bit multiply-accumulate, shifts and table loads, close
+ * to what the audio kernels do.  Host timings are expressed in multiples of
+ * this kernel, which cancels most of the host CPU speed out of the budget.
+ * ------------------------------------------------------------------------- */
+static const int16_t kRefCoef[16] = {
+    1203, -2671, 3977, -5102, 6049, -6813, 7388, -7771,
+    7963, -7963, 7771, -7388, 6813, -6049, 5102, -3977,
+};
+static uint32_t sRefState;
+static int32_t  sRefAcc;
+
+static void Ref_Reset(void)
+{
+    sRefState = 12345;
+    sRefAcc   = 0;
+}
+
+static void Ref_Run(uint16_t block, uint32_t* pHash)
+{
+    uint32_t x   = sRefState ^ block;
+    int32_t  acc = sRefAcc;
+
+    for(uint16_t i = 0; i < BENCH_REF_ITERATIONS; i++)
+    {
+        x    = x * 1103515245UL + 12345UL;
+        acc += ((int32_t)(int16_t)(x >> 16) * kRefCoef[i & 15]) >> 4;
+    }
+    sRefState = x;
+    sRefAcc   = acc;
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, &acc, sizeof(acc));
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * pdm_decimator : 1 kHz + 3.1 kHz through a first-order sigma-delta
+ * ------------------------------------------------------------------------- */
+static PdmDecimator_t sDecimator;
+
+static void Pdm_Prepare(void)
+{
+    BenchPdm_t mod;
+
+    memset(&mod, 0, sizeof(mod));
+    mod.toneA.inc = BENCH_PHASE_INC(1000, PDM_DECIMATOR_PDM_CLOCK_HZ);
+    mod.toneB.inc = BENCH_PHASE_INC(3100, PDM_DECIMATOR_PDM_CLOCK_HZ);
+    for(uint16_t b = 0; b < BENCH_PDM_BLOCKS; b++)
+    {
+        BenchSignal_Pdm(&mod, sIn.pdm[b], BENCH_PDM_BLOCK_BYTES);
+    }
+}
+
+static void Pdm_Reset(void)
+{
+    PdmDecimator_Init(&sDecimator);
+}
+
+static void Pdm_Run(uint16_t block, uint32_t* pHash)
+{
+    uint16_t n = PdmDecimator_Process(&sDecimator, sIn.pdm[block], BENCH_PDM_BLOCK_BYTES, sPcmOut);
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, sPcmOut, n * sizeof(int16_t));
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * voice_activity : the same bit stream, read as the 500 kHz idle clock
+ * ------------------------------------------------------------------------- */
+static VoiceActivity_t sVad;
+
+static void Vad_Reset(void)
+{
+    VoiceActivity_Init(&sVad, BENCH_VAD_PDM_CLOCK_HZ);
+}
+
+static void Vad_Run(uint16_t block, uint32_t* pHash)
+{
+    bool active = VoiceActivity_Process(&sVad, sIn.pdm[block], BENCH_PDM_BLOCK_BYTES);
+
+    if(pHash != NULL)
+    {
+        uint32_t out[3] = {sVad.energy, sVad.zeroCrossHz, active ? 1U : 0U};
+        *pHash = Bench_Hash(*pHash, out, sizeof(out));
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Detector input: quiet room noise with a double knock, a glass break and
+ * a loud noise, at 7812.5 Hz.  Shared by fft_128 and sound_detector.
+ * ------------------------------------------------------------------------- */
+#define BENCH_FRAME_RATE_HZ  7812
+
+static void Frames_Prepare(void)
+{
+    uint32_t    seed  = 0x5EED0001UL;
+    BenchTone_t knock = {0, BENCH_PHASE_INC(180, BENCH_FRAME_RATE_HZ)};
+    BenchTone_t glass = {0, BENCH_PHASE_INC(3500, BENCH_FRAME_RATE_HZ)};
+    int16_t*    pOut  = &sIn.frames[0][0];
+    int32_t     knockAmp = 0;
+    int32_t     glassAmp = 0;
+    int32_t     loudAmp  = 0;
+    int16_t     prevNoise = 0;
+
+    for(uint32_t n = 0; n < (uint32_t)BENCH_FRAME_BLOCKS * SOUND_DETECTOR_FRAME_LEN; n++)
+    {
+        uint32_t frame = n / SOUND_DETECTOR_FRAME_LEN;
+        uint32_t pos   = n % SOUND_DETECTOR_FRAME_LEN;
+        int16_t  noise = BenchSignal_Noise(&seed);
+
+        if(pos == 0 && (frame == 40 || frame == 48))
+        {
+            knockAmp = 14000;
+        }
+        if(pos == 0 && frame == 80)
+        {
+            glassAmp = 9000;
+        }
+        if(pos == 0 && frame == 110)
+        {
+            loudAmp = 30000;
+        }
+        if(pos == 0 && frame == 125)
+        {
+            loudAmp = 0;
+        }
+
+        int32_t x = noise >> 10;
+        x += BenchSignal_Tone(&knock, (int16_t)knockAmp);
+        /* First difference of white noise: energy in the upper bands */
+        x += (((int32_t)noise - prevNoise) * glassAmp) >> 16;
+        x += BenchSignal_Tone(&glass, (int16_t)(glassAmp / 3));
+        x += ((int32_t)noise * loudAmp) >> 15;
+        prevNoise = noise;
+
+        pOut[n] = BenchSignal_Sat16(x);
+
+        knockAmp = (knockAmp * 32500) >> 15;   /* ~25 ms decay */
+        glassAmp = (glassAmp * 32700) >> 15;   /* ~75 ms decay */
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * fft_128
+ * ------------------------------------------------------------------------- */
+static void Fft_Run(uint16_t block, uint32_t* pHash)
+{
+    memcpy(sPcmOut, sIn.frames[block], sizeof(sPcmOut));
+    memset(sImOut, 0, sizeof(sImOut));
+    FixedFft_Forward(sPcmOut, sImOut, SOUND_DETECTOR_FFT_LOG2);
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, sPcmOut, sizeof(sPcmOut));
+        *pHash = Bench_Hash(*pHash, sImOut, sizeof(sImOut));
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * sound_detector
+ * ------------------------------------------------------------------------- */
+static void Detector_Reset(void)
+{
+    SoundDetector_Init(SoundDetector_DefaultRules, SoundDetector_NumDefaultRules);
+}
+
+static void Detector_Run(uint16_t block, uint32_t* pHash)
+{
+    SoundDetector_Event_t event;
+    bool                  found = SoundDetector_ProcessFrame(sIn.frames[block], &event);
+
+    if(pHash != NULL)
+    {
+        const SoundDetector_Features_t* pFeatures = SoundDetector_GetFeatures();
+
+        *pHash = Bench_Hash(*pHash, &pFeatures->rmsDbQ8, sizeof(pFeatures->rmsDbQ8));
+        *pHash = Bench_Hash(*pHash, pFeatures->bandDbQ8, sizeof(pFeatures->bandDbQ8));
+        *pHash = Bench_Hash(*pHash, &pFeatures->backgroundDbQ8, sizeof(pFeatures->backgroundDbQ8));
+        if(found)
+        {
+            uint8_t e[6] = {event.classId, (uint8_t)event.levelDb, event.riseDb,
+                            event.dominantBand, event.durationFrames, event.latencyFrames};
+            *pHash = Bench_Hash(*pHash, e, sizeof(e));
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * adpcm_encode / adpcm_decode : two tones under a slow tremolo plus noise
+ * ------------------------------------------------------------------------- */
+static ImaAdpcm_State_t sAdpcm;
+
+static void AdpcmPcm_Prepare(void)
+{
+    uint32_t    seed  = 0x5EED0002UL;
+    BenchTone_t toneA = {0, BENCH_PHASE_INC(440, BENCH_FRAME_RATE_HZ)};
+    BenchTone_t toneB = {0, BENCH_PHASE_INC(1250, BENCH_FRAME_RATE_HZ)};
+    BenchTone_t lfo   = {0, BENCH_PHASE_INC(3, BENCH_FRAME_RATE_HZ)};
+    int16_t*    pOut  = &sIn.adpcm.pcm[0][0];
+
+    for(uint32_t n = 0; n < (uint32_t)BENCH_ADPCM_BLOCKS * BENCH_ADPCM_SAMPLES; n++)
+    {
+        int32_t amp = 12000 + BenchSignal_Tone(&lfo, 10000);
+        int32_t x   = BenchSignal_Tone(&toneA, (int16_t)amp) + BenchSignal_Tone(&toneB, 3000) +
+                      (BenchSignal_Noise(&seed) >> 6);
+
+        pOut[n] = BenchSignal_Sat16(x);
+    }
+}
+
+static void AdpcmCodes_Prepare(void)
+{
+    AdpcmPcm_Prepare();
+    ImaAdpcm_Init(&sAdpcm);
+    for(uint16_t b = 0; b < BENCH_ADPCM_BLOCKS; b++)
+    {
+        ImaAdpcm_Encode(&sAdpcm, sIn.adpcm.pcm[b], BENCH_ADPCM_SAMPLES, sIn.adpcm.codes[b]);
+    }
+}
+
+static void Adpcm_Reset(void)
+{
+    ImaAdpcm_Init(&sAdpcm);
+}
+
+static void AdpcmEncode_Run(uint16_t block, uint32_t* pHash)
+{
+    ImaAdpcm_Encode(&sAdpcm, sIn.adpcm.pcm[block], BENCH_ADPCM_SAMPLES, sCodesOut);
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, sCodesOut, sizeof(sCodesOut));
+    }
+}
+
+static void AdpcmDecode_Run(uint16_t block, uint32_t* pHash)
+{
+    ImaAdpcm_Decode(&sAdpcm, sIn.adpcm.codes[block], BENCH_ADPCM_SAMPLES, sPcmOut);
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, sPcmOut, BENCH_ADPCM_SAMPLES * sizeof(int16_t));
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * chime_dac / chime_pwm
+ * ------------------------------------------------------------------------- */
+static int16_t     sRingBuffer[BENCH_CHIME_RING_LEN];
+static AudioRing_t sRing;
+
+static void ChimeDac_Reset(void)
+{
+    ChimeSynth_Init(BENCH_DAC_RATE_HZ);
+    ChimeSynth_SetVolume(80);
+    ChimeSynth_Play(CHIME_WESTMINSTER);
+    AudioRing_Init(&sRing, sRingBuffer, BENCH_CHIME_RING_LEN);
+}
+
+static void ChimeDac_Run(uint16_t block, uint32_t* pHash)
+{
+    (void)block;
+
+    /* Mixer task: render into the ring; DMA IRQ: ring to DAC frames */
+    ChimeSynth_Render(sPcmOut, BENCH_CHIME_SAMPLES);
+    AudioRing_Write(&sRing, sPcmOut, BENCH_CHIME_SAMPLES);
+    AudioRing_Read(&sRing, sImOut, BENCH_CHIME_SAMPLES);
+    for(uint16_t i = 0; i < BENCH_CHIME_SAMPLES; i++)
+    {
+        sWordsOut[i] = BENCH_DAC_FRAME(sImOut[i]);
+    }
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, sWordsOut, BENCH_CHIME_SAMPLES * sizeof(uint16_t));
+    }
+}
+
+static void ChimePwm_Reset(void)
+{
+    ChimeSynth_Init(BENCH_PWM_RATE_HZ);
+    ChimeSynth_SetVolume(80);
+    ChimeSynth_Play(CHIME_WESTMINSTER);
+}
+
+static void ChimePwm_Run(uint16_t block, uint32_t* pHash)
+{
+    uint16_t* pDuty = sWordsOut;
+
+    (void)block;
+
+    ChimeSynth_Render(sPcmOut, BENCH_CHIME_SAMPLES);
+    for(uint16_t i = 0; i < BENCH_CHIME_SAMPLES; i++)
+    {
+        uint16_t duty = BENCH_PWM_DUTY(sPcmOut[i]);
+
+        for(uint8_t k = 0; k < BENCH_PWM_OVERSAMPLE; k++)
+        {
+            *pDuty++ = duty;
+        }
+    }
+
+    if(pHash != NULL)
+    {
+        *pHash = Bench_Hash(*pHash, sWordsOut, sizeof(sWordsOut));
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * Kernel table
+ * ------------------------------------------------------------------------- */
+const Bench_Kernel_t Bench_Kernels[] = {
+    {"reference",      "BenchKernels.c",
+     1,                        1024,                  0,
+     Bench_Nothing,      Ref_Reset,      Ref_Run},
+    {"pdm_decimator",  "PdmDecimator.c",
+     BENCH_PDM_PCM_PER_BLOCK,  BENCH_PDM_BLOCKS,      BENCH_RATE_PDM,
+     Pdm_Prepare,        Pdm_Reset,      Pdm_Run},
+    {"voice_activity", "VoiceActivity.c",
+     BENCH_VAD_PER_BLOCK,      BENCH_PDM_BLOCKS,      BENCH_RATE_VAD,
+     Pdm_Prepare,        Vad_Reset,      Vad_Run},
+    {"fft_128",        "FixedFft.c",
+     SOUND_DETECTOR_FRAME_LEN, BENCH_FRAME_BLOCKS,    BENCH_RATE_FRAME,
+     Frames_Prepare,     Bench_Nothing,  Fft_Run},
+    {"sound_detector", "SoundDetector.c, FixedFft.c",
+     SOUND_DETECTOR_FRAME_LEN, BENCH_FRAME_BLOCKS,    BENCH_RATE_FRAME,
+     Frames_Prepare,     Detector_Reset, Detector_Run},
+    {"adpcm_encode",   "ImaAdpcm.c",
+     BENCH_ADPCM_SAMPLES,      BENCH_ADPCM_BLOCKS,    BENCH_RATE_ADPCM,
+     AdpcmPcm_Prepare,   Adpcm_Reset,    AdpcmEncode_Run},
+    {"adpcm_decode",   "ImaAdpcm.c",
+     BENCH_ADPCM_SAMPLES,      BENCH_ADPCM_BLOCKS,    0,
+     AdpcmCodes_Prepare, Adpcm_Reset,    AdpcmDecode_Run},
+    {"chime_dac",      "ChimeSynth.c, AudioRing.c",
+     BENCH_CHIME_SAMPLES,      BENCH_CHIME_BLOCKS,    BENCH_RATE_DAC,
+     Bench_Nothing,      ChimeDac_Reset, ChimeDac_Run},
+    {"chime_pwm",      "ChimeSynth.c",
+     BENCH_CHIME_SAMPLES,      BENCH_CHIME_BLOCKS,    BENCH_RATE_PWM,
+     Bench_Nothing,      ChimePwm_Reset, ChimePwm_Run},
+};
+
+const uint8_t Bench_NumKernels = (uint8_t)(sizeof(Bench_Kernels) / sizeof(Bench_Kernels[0]));
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BenchPlatform_m4.c"
+ *
+ * Cortex-M4 tick source: the DWT cycle counter, so one tick is one core
+ * cycle.  CYCCNT is 32 bits (67 s at 64 MHz); it is extended to 64 bits on
+ * every read, which is plenty as passes are read at least once per pass.
+ */
+
+#include "Bench.h"
+
+#define BENCH_DEMCR        (*(volatile uint32_t*)0xE000EDFCUL)
+#define BENCH_DEMCR_TRCENA (1UL << 24)
+#define BENCH_DWT_CTRL     (*(volatile uint32_t*)0xE0001000UL)
+#define BENCH_DWT_CYCCNT   (*(volatile uint32_t*)0xE0001004UL)
+
+#ifndef BENCH_CPU_HZ
+#define BENCH_CPU_HZ       64000000ULL
+#endif
+
+static uint32_t sLast;
+static uint64_t sHigh;
+static bool     sEnabled;
+
+uint64_t BenchPlatform_Ticks(void)
+{
+    if(!sEnabled)
+    {
+        BENCH_DEMCR     |= BENCH_DEMCR_TRCENA;
+        BENCH_DWT_CYCCNT = 0;
+        BENCH_DWT_CTRL  |= 1UL;
+        sEnabled         = true;
+    }
+
+    uint32_t now = BENCH_DWT_CYCCNT;
+    if(now < sLast)
+    {
+        sHigh += 1ULL << 32;
+    }
+    sLast = now;
+    return sHigh | now;
+}
+
+uint64_t BenchPlatform_TicksPerSecond(void)
+{
+    return BENCH_CPU_HZ;
+}
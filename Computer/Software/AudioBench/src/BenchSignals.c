@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BenchSignals.c"
+ *
+ * Deterministic integer test signals.  The sine comes from the FixedFft
+ * table so no floating point (and no libm) is needed on either platform.
+ */
+
+#include "BenchSignals.h"
+#include "FixedFft.h"
+
+int16_t BenchSignal_Tone(BenchTone_t* pTone, int16_t amp)
+{
+    int32_t s = FixedFft_SinQ15((uint8_t)(pTone->phase >> 24));
+
+    pTone->phase += pTone->inc;
+    return (int16_t)((s * amp) >> 15);
+}
+
+int16_t BenchSignal_Noise(uint32_t* pSeed)
+{
+    *pSeed = *pSeed * 1664525UL + 1013904223UL;
+    return (int16_t)(*pSeed >> 16);
+}
+
+int16_t BenchSignal_Sat16(int32_t v)
+{
+    if(v > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if(v < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+void BenchSignal_Pdm(BenchPdm_t* pState, uint8_t* pOut, uint16_t numBytes)
+{
+    for(uint16_t w = 0; w < numBytes; w += 2)
+    {
+        uint16_t word = 0;
+
+        for(uint8_t bit = 0; bit < 16; bit++)
+        {
+            int32_t x = BenchSignal_Tone(&pState->toneA, 12000) + BenchSignal_Tone(&pState->toneB, 4000);
+            bool    one = (pState->integrator >= 0);
+
+            pState->integrator += x - (one ? 32767 : -32768);
+            word = (uint16_t)(word | ((one ? 1U : 0U) << bit));
+        }
+        pOut[w]     = (uint8_t)(word & 0xFF);
+        pOut[w + 1] = (uint8_t)(word >> 8);
+    }
+}
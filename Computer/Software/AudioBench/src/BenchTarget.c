@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "BenchTarget.c"
+ *
+ * On-target benchmark runner (Cortex-M4 build only).
+ *
+ * BenchGolden.h is generated from golden/golden.txt by the Makefile, so the
+ * target checks its output against the same hashes as the host.
+ */
+
+#include "AudioBench.h"
+#include "Bench.h"
+#include "BenchGolden.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/** Measure at least 50 ms of each kernel */
+#define BENCH_TARGET_MIN_MS  50
+
+typedef struct
+{
+    const char* name;
+    uint32_t    hash;
+} BenchGolden_t;
+
+static const BenchGolden_t kGolden[] = {BENCH_GOLDEN_TABLE};
+
+static const BenchGolden_t* Bench_FindGolden(const char* pName)
+{
+    for(uint8_t i = 0; i < sizeof(kGolden) / sizeof(kGolden[0]); i++)
+    {
+        if(strcmp(kGolden[i].name, pName) == 0)
+        {
+            return &kGolden[i];
+        }
+    }
+    return NULL;
+}
+
+uint8_t AudioBench_Run(AudioBench_Print_t print)
+{
+    uint64_t minTicks = BenchPlatform_TicksPerSecond() * BENCH_TARGET_MIN_MS / 1000U;
+    uint8_t  failures = 0;
+    char     line[96];
+
+    for(uint8_t k = 0; k < Bench_NumKernels; k++)
+    {
+        const Bench_Kernel_t* pKernel = &Bench_Kernels[k];
+        const BenchGolden_t*  pGolden = Bench_FindGolden(pKernel->name);
+        Bench_Result_t        result;
+        const char*           pStatus;
+
+        Bench_Run(pKernel, minTicks, &result);
+
+        if(pGolden == NULL)
+        {
+            pStatus = "NEW";
+        }
+        else if(pGolden->hash == result.hash && result.stable)
+        {
+            pStatus = "OK";
+        }
+        else
+        {
+            pStatus = "FAIL";
+            failures++;
+        }
+
+        /* Cycles per block, rounded; nano printf has no 64-bit support */
+        uint32_t cycles = (uint32_t)((Bench_MilliTicksPerBlock(pKernel, &result) + 500U) / 1000U);
+        snprintf(line, sizeof(line), "CAL %s %lu 0x%08lx %s", pKernel->name, (unsigned long)cycles,
+                 (unsigned long)result.hash, pStatus);
+        print(line);
+    }
+    return failures;
+}
@@ -0,0 +1,518 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "main.c"
+ *
+ * Host front end of the audio kernel benchmark.
+ *
+ *   audiobench [--kernel NAME] [--min-ms MS]
+ *              [--golden FILE | --write-golden FILE]
+ *              [--budget FILE [--strict]] [--calibrate LOG]
+ *
+ * Reports, per kernel: ns per block, throughput in samples/s, speed against
+ * real time, cost in reference units and the golden output check.
+ *
+ * Budget: the calibration file records, per kernel, the M4 cycles per
+ * block measured on the board and the host cost in reference units at the
+ * time of that measurement.  Their ratio (M4 cycles per reference unit)
+ * converts today's host cost into an M4 estimate, so a kernel change shows
+ * up in the budget without flashing.  Kernels without a calibration line
+ * use the median ratio and are marked '~'.
+ *
+ * Exit status: 0 ok, 1 golden mismatch or unstable output, 2 over budget
+ * with --strict, 3 usage or file error.
+ */
+
+#include "Bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_MIN_MS   200
+#define BENCH_M4_HZ            64000000.0
+#define BENCH_MAX_KERNELS      32
+#define BENCH_NAME_LEN         32
+
+typedef struct
+{
+    char     name[BENCH_NAME_LEN];
+    uint32_t hash;
+    bool     present;
+} Golden_t;
+
+typedef struct
+{
+    char   name[BENCH_NAME_LEN];
+    double m4Cycles;      /**< M4 cycles per block, <= 0 if not measured */
+    double refUnits;      /**< Host reference units per block at calibration */
+    double budgetPct;     /**< CPU budget at the real-time rate, <= 0 = none */
+    char   source[16];
+} Calib_t;
+
+typedef struct
+{
+    Bench_Result_t result;
+    double         nsPerBlock;
+    double         refUnits;
+} Measured_t;
+
+static Golden_t   sGolden[BENCH_MAX_KERNELS];
+static uint8_t    sNumGolden;
+static Calib_t    sCalib[BENCH_MAX_KERNELS];
+static uint8_t    sNumCalib;
+static Measured_t sMeasured[BENCH_MAX_KERNELS];
+
+/* -------------------------------------------------------------------------
+ * Files
+ * ------------------------------------------------------------------------- */
+
+static bool Bench_IsComment(const char* pLine)
+{
+    while(*pLine == ' ' || *pLine == '\t')
+    {
+        pLine++;
+    }
+    return (*pLine == '#' || *pLine == '\n' || *pLine == '\0');
+}
+
+static bool Bench_LoadGolden(const char* pPath)
+{
+    FILE* f = fopen(pPath, "r");
+    char  line[256];
+
+    if(f == NULL)
+    {
+        fprintf(stderr, "audiobench: cannot open %s\n", pPath);
+        return false;
+    }
+    while(fgets(line, sizeof(line), f) != NULL && sNumGolden < BENCH_MAX_KERNELS)
+    {
+        Golden_t*    pG = &sGolden[sNumGolden];
+        unsigned int blocks;
+        unsigned int hash;
+
+        if(Bench_IsComment(line))
+        {
+            continue;
+        }
+        if(sscanf(line, "%31s %u %x", pG->name, &blocks, &hash) == 3)
+        {
+            pG->hash    = hash;
+            pG->present = true;
+            sNumGolden++;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+static bool Bench_LoadCalibration(const char* pPath)
+{
+    FILE* f = fopen(pPath, "r");
+    char  line[256];
+
+    if(f == NULL)
+    {
+        fprintf(stderr, "audiobench: cannot open %s\n", pPath);
+        return false;
+    }
+    while(fgets(line, sizeof(line), f) != NULL && sNumCalib < BENCH_MAX_KERNELS)
+    {
+        Calib_t* pC = &sCalib[sNumCalib];
+        char     cycles[24];
+
+        if(Bench_IsComment(line))
+        {
+            continue;
+        }
+        if(sscanf(line, "%31s %23s %lf %lf %15s", pC->name, cycles, &pC->refUnits, &pC->budgetPct,
+                  pC->source) == 5)
+        {
+            pC->m4Cycles = (strcmp(cycles, "-") == 0) ? 0.0 : atof(cycles);
+            sNumCalib++;
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+static const Golden_t* Bench_FindGolden(const char* pName)
+{
+    for(uint8_t i = 0; i < sNumGolden; i++)
+    {
+        if(strcmp(sGolden[i].name, pName) == 0)
+        {
+            return &sGolden[i];
+        }
+    }
+    return NULL;
+}
+
+static Calib_t* Bench_FindCalib(const char* pName)
+{
+    for(uint8_t i = 0; i < sNumCalib; i++)
+    {
+        if(strcmp(sCalib[i].name, pName) == 0)
+        {
+            return &sCalib[i];
+        }
+    }
+    return NULL;
+}
+
+/* -------------------------------------------------------------------------
+ * Budget
+ * ------------------------------------------------------------------------- */
+
+static int Bench_CompareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/** Median M4 cycles per reference unit over the calibrated kernels */
+static double Bench_DefaultRatio(void)
+{
+    double  ratios[BENCH_MAX_KERNELS];
+    uint8_t n = 0;
+
+    for(uint8_t i = 0; i < sNumCalib; i++)
+    {
+        if(sCalib[i].m4Cycles > 0.0 && sCalib[i].refUnits > 0.0)
+        {
+            ratios[n++] = sCalib[i].m4Cycles / sCalib[i].refUnits;
+        }
+    }
+    if(n == 0)
+    {
+        return 0.0;
+    }
+    qsort(ratios, n, sizeof(ratios[0]), Bench_CompareDouble);
+    return (n & 1) ? ratios[n / 2] : (ratios[n / 2 - 1] + ratios[n / 2]) / 2.0;
+}
+
+static bool Bench_PrintBudget(const bool* pSelected, const char* pPath)
+{
+    double defaultRatio = Bench_DefaultRatio();
+    bool   over         = false;
+
+    printf("\nM4 budget at %.0f MHz (calibration: %s)\n", BENCH_M4_HZ / 1e6, pPath);
+    printf("%-16s %12s %10s %8s %8s  %s\n", "kernel", "cycles/blk", "blocks/s", "cpu %", "budget", "status");
+
+    for(uint8_t k = 1; k < Bench_NumKernels; k++)
+    {
+        const Bench_Kernel_t* pKernel = &Bench_Kernels[k];
+        const Calib_t*        pCalib  = Bench_FindCalib(pKernel->name);
+        double                ratio   = defaultRatio;
+        char                  mark    = '~';
+
+        if(!pSelected[k])
+        {
+            continue;
+        }
+        if(pCalib != NULL && pCalib->m4Cycles > 0.0 && pCalib->refUnits > 0.0)
+        {
+            ratio = pCalib->m4Cycles / pCalib->refUnits;
+            mark  = ' ';
+        }
+        if(ratio <= 0.0)
+        {
+            printf("%-16s %12s\n", pKernel->name, "uncalibrated");
+            continue;
+        }
+
+        double cycles = sMeasured[k].refUnits * ratio;
+        if(pKernel->blockRateMilliHz == 0)
+        {
+            printf("%-16s %11.0f%c %10s %8s %8s  %s\n", pKernel->name, cycles, mark, "-", "-", "-",
+                   "not on node");
+            continue;
+        }
+
+        double      rate   = pKernel->blockRateMilliHz / 1000.0;
+        double      cpu    = cycles * rate * 100.0 / BENCH_M4_HZ;
+        double      budget = (pCalib != NULL) ? pCalib->budgetPct : 0.0;
+        const char* status = "ok";
+        char        budgetText[16] = "-";
+
+        if(budget > 0.0)
+        {
+            snprintf(budgetText, sizeof(budgetText), "%.2f", budget);
+            if(cpu > budget)
+            {
+                status = "OVER";
+                over   = true;
+            }
+        }
+        printf("%-16s %11.0f%c %10.2f %8.2f %8s  %s\n", pKernel->name, cycles, mark, rate, cpu,
+               budgetText, status);
+    }
+    return over;
+}
+
+/** Print a calibration file: kernels in the board log (CAL lines) get the
+ *  measured cycles and today's host units, the others keep their old line */
+static bool Bench_WriteCalibration(const char* pLogPath, const bool* pSelected)
+{
+    FILE*    f = fopen(pLogPath, "r");
+    char     line[256];
+    uint32_t boardCycles[BENCH_MAX_KERNELS] = {0};
+
+    if(f == NULL)
+    {
+        fprintf(stderr, "audiobench: cannot open %s\n", pLogPath);
+        return false;
+    }
+    while(fgets(line, sizeof(line), f) != NULL)
+    {
+        const char*  pCal = strstr(line, "CAL ");
+        char         name[BENCH_NAME_LEN];
+        unsigned int cycles;
+
+        if(pCal == NULL || sscanf(pCal, "CAL %31s %u", name, &cycles) != 2)
+        {
+            continue;
+        }
+        for(uint8_t k = 1; k < Bench_NumKernels; k++)
+        {
+            if(strcmp(Bench_Kernels[k].name, name) == 0)
+            {
+                boardCycles[k] = cycles;
+            }
+        }
+    }
+    fclose(f);
+
+    printf("# M4 calibration for the audio kernel budget (see README.md)\n");
+    printf("# kernel          m4_cycles  ref_units  budget_pct  source\n");
+
+    for(uint8_t k = 1; k < Bench_NumKernels; k++)
+    {
+        const char*    pName = Bench_Kernels[k].name;
+        const Calib_t* pOld  = Bench_FindCalib(pName);
+        double         budget = (pOld != NULL) ? pOld->budgetPct : 0.0;
+
+        if(pSelected[k] && boardCycles[k] != 0)
+        {
+            printf("%-17s %10lu %10.3f %11.2f  board\n", pName, (unsigned long)boardCycles[k],
+                   sMeasured[k].refUnits, budget);
+        }
+        else if(pOld != NULL && pOld->m4Cycles > 0.0)
+        {
+            printf("%-17s %10.0f %10.3f %11.2f  %s\n", pName, pOld->m4Cycles, pOld->refUnits, budget,
+                   pOld->source);
+        }
+        else if(pOld != NULL)
+        {
+            printf("%-17s %10s %10.3f %11.2f  %s\n", pName, "-", pOld->refUnits, budget, pOld->source);
+        }
+    }
+    return true;
+}
+
+/* -------------------------------------------------------------------------
+ * main
+ * ------------------------------------------------------------------------- */
+
+static void Bench_Usage(void)
+{
+    fprintf(stderr,
+            "usage: audiobench [--kernel NAME] [--min-ms MS]\n"
+            "                  [--golden FILE | --write-golden FILE]\n"
+            "                  [--budget FILE [--strict]] [--calibrate LOG]\n");
+}
+
+int main(int argc, char** argv)
+{
+    const char* pKernelName = NULL;
+    const char* pGoldenPath = NULL;
+    const char* pWritePath  = NULL;
+    const char* pBudgetPath = NULL;
+    const char* pCalLogPath = NULL;
+    bool        strict      = false;
+    long        minMs       = BENCH_DEFAULT_MIN_MS;
+    bool        selected[BENCH_MAX_KERNELS];
+    int         status      = 0;
+
+    for(int i = 1; i < argc; i++)
+    {
+        const char* pArg   = argv[i];
+        const char* pValue = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if(strcmp(pArg, "--strict") == 0)
+        {
+            strict = true;
+            continue;
+        }
+        if(pValue == NULL)
+        {
+            Bench_Usage();
+            return 3;
+        }
+        if(strcmp(pArg, "--kernel") == 0)
+        {
+            pKernelName = pValue;
+        }
+        else if(strcmp(pArg, "--min-ms") == 0)
+        {
+            minMs = strtol(pValue, NULL, 10);
+        }
+        else if(strcmp(pArg, "--golden") == 0)
+        {
+            pGoldenPath = pValue;
+        }
+        else if(strcmp(pArg, "--write-golden") == 0)
+        {
+            pWritePath = pValue;
+        }
+        else if(strcmp(pArg, "--budget") == 0)
+        {
+            pBudgetPath = pValue;
+        }
+        else if(strcmp(pArg, "--calibrate") == 0)
+        {
+            pCalLogPath = pValue;
+        }
+        else
+        {
+            Bench_Usage();
+            return 3;
+        }
+        i++;
+    }
+
+    if((pGoldenPath != NULL && !Bench_LoadGolden(pGoldenPath)) ||
+       (pBudgetPath != NULL && !Bench_LoadCalibration(pBudgetPath)))
+    {
+        return 3;
+    }
+
+    /* The reference kernel always runs: every other result is expressed in it */
+    for(uint8_t k = 0; k < Bench_NumKernels; k++)
+    {
+        selected[k] = (k == 0) || (pKernelName == NULL) || (strcmp(Bench_Kernels[k].name, pKernelName) == 0);
+    }
+
+    uint64_t minTicks = BenchPlatform_TicksPerSecond() * (uint64_t)minMs / 1000U;
+
+    /* Progress goes to stderr in calibration mode so stdout is the file */
+    FILE* out = (pCalLogPath != NULL) ? stderr : stdout;
+
+    fprintf(out, "%-16s %5s %6s %11s %11s %9s %9s  %s\n", "kernel", "block", "blocks", "ns/block",
+            "Msamples/s", "xRT", "ref units", "golden");
+
+    for(uint8_t k = 0; k < Bench_NumKernels; k++)
+    {
+        const Bench_Kernel_t* pKernel = &Bench_Kernels[k];
+        Measured_t*           pM      = &sMeasured[k];
+        const char*           pCheck  = "-";
+        char                  rt[16]  = "-";
+
+        if(!selected[k])
+        {
+            continue;
+        }
+
+        Bench_Run(pKernel, minTicks, &pM->result);
+        pM->nsPerBlock = (double)Bench_MilliTicksPerBlock(pKernel, &pM->result) / 1000.0 * 1e9 /
+                         (double)BenchPlatform_TicksPerSecond();
+        pM->refUnits   = pM->nsPerBlock / sMeasured[0].nsPerBlock;
+
+        double samplesPerSec = pKernel->samplesPerBlock * 1e9 / pM->nsPerBlock;
+        if(pKernel->blockRateMilliHz != 0)
+        {
+            snprintf(rt, sizeof(rt), "%.0f", 1e12 / (pM->nsPerBlock * pKernel->blockRateMilliHz));
+        }
+
+        if(!pM->result.stable)
+        {
+            pCheck = "UNSTABLE";
+            status = 1;
+        }
+        else if(pGoldenPath != NULL)
+        {
+            const Golden_t* pG = Bench_FindGolden(pKernel->name);
+            if(pG == NULL)
+            {
+                pCheck = "missing";
+                status = 1;
+            }
+            else if(pG->hash != pM->result.hash)
+            {
+                pCheck = "FAIL";
+                status = 1;
+            }
+            else
+            {
+                pCheck = "ok";
+            }
+        }
+
+        fprintf(out, "%-16s %5u %6u %11.1f %11.2f %9s %9.3f  %s (0x%08lx)\n", pKernel->name,
+                pKernel->samplesPerBlock, pKernel->numBlocks, pM->nsPerBlock, samplesPerSec / 1e6, rt,
+                pM->refUnits, pCheck, (unsigned long)pM->result.hash);
+    }
+
+    if(pWritePath != NULL)
+    {
+        FILE* f = fopen(pWritePath, "w");
+        if(f == NULL)
+        {
+            fprintf(stderr, "audiobench: cannot write %s\n", pWritePath);
+            return 3;
+        }
+        fprintf(f, "# Golden output hashes (FNV-1a over every output block), see README.md\n");
+        fprintf(f, "# kernel          blocks  hash\n");
+        for(uint8_t k = 0; k < Bench_NumKernels; k++)
+        {
+            if(selected[k])
+            {
+                fprintf(f, "%-17s %6u  0x%08lx\n", Bench_Kernels[k].name, Bench_Kernels[k].numBlocks,
+                        (unsigned long)sMeasured[k].result.hash);
+            }
+        }
+        fclose(f);
+        fprintf(out, "Golden hashes written to %s\n", pWritePath);
+    }
+
+    if(pCalLogPath != NULL)
+    {
+        if(!Bench_WriteCalibration(pCalLogPath, selected))
+        {
+            return 3;
+        }
+    }
+    else if(pBudgetPath != NULL)
+    {
+        if(Bench_PrintBudget(selected, pBudgetPath) && strict && status == 0)
+        {
+            status = 2;
+        }
+    }
+
+    return status;
+}
@@ -14,7 +14,10 @@
  * Each 16-bit I2S word contains 16 consecutive PDM bits.
  * The ratio of '1' bits in the bitstream approximates the sound pressure level.
  * A density near 50% = silence; higher/lower = sound present.
- * Level is reported over UART1 every ~50ms.
+ *
+ * Capture is continuous: I2S runs in DMA mode into a ping-pong buffer
+ * (see PdmCapture.c), so no PDM bits are lost while a block is processed.
+ * Level is reported over UART1 every ~50ms together with the overrun count.
  */
 
 #include "hal.h"
@@ -28,6 +31,7 @@
 #include "task.h"
 
 #include "qDrvI2S.h"
+#include "PdmCapture.h"
 
 #include "app_common.h"
 
@@ -41,8 +45,8 @@
 /* prescaler = (F_CLK / (2 * F_SCK)) - 1 = (64MHz / 2MHz) - 1 = 31 => F_SCK = 1 MHz */
 #define I2S_PRESCALER      31
 
-/* 128 bytes = 64 x 16-bit words = 1024 PDM bits per poll */
-#define RX_BUF_SIZE        128
+/* 12 blocks of 4096 PDM bits = ~49 ms between reports */
+#define BLOCKS_PER_REPORT  12
 
 #define STACK_SIZE         1024
 #define MIC_TASK_PRIORITY  (tskIDLE_PRIORITY + 2)
@@ -53,8 +57,6 @@ static TaskHandle_t micTaskHandle;
 static StaticTask_t micTaskData;
 static StackType_t  micTaskStack[STACK_SIZE];
 
-static UInt8 rxBuffer[RX_BUF_SIZE];
-
 static UInt32 countOnes(const UInt8* buf, UInt16 len)
 {
     UInt32 count = 0;
@@ -70,34 +72,54 @@ static void micTask(void* pvParameters)
 {
     (void)pvParameters;
 
+    UInt32 ones = 0;
+    UInt32 blocks = 0;
+
+    qResult_t res = PdmCapture_Start(xTaskGetCurrentTaskHandle());
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("PdmCapture_Start failed: %d", 0, res);
+        Q_ASSERT(false);
+    }
+
     while(1)
     {
-        qResult_t res = qDrvI2S_RxBufferSet(&i2sDrv, rxBuffer, RX_BUF_SIZE);
-        if(res != Q_OK)
+        const UInt8* pBlock = PdmCapture_WaitBlock(pdMS_TO_TICKS(500));
+        if(pBlock == NULL)
         {
-            GP_LOG_SYSTEM_PRINTF("RxBufferSet failed: %d", 0, res);
-            vTaskDelay(pdMS_TO_TICKS(500));
+            GP_LOG_SYSTEM_PRINTF("PDM capture timeout", 0);
             continue;
         }
 
-        res = qDrvI2S_Start(&i2sDrv);
-        if(res != Q_OK)
+        /* Count 1-bits: density near 50% = silence, deviation = sound */
+        UInt32 blockOnes = countOnes(pBlock, PDM_CAPTURE_BLOCK_SIZE);
+        if(!PdmCapture_ReleaseBlock(pBlock))
         {
-            GP_LOG_SYSTEM_PRINTF("I2S Start failed: %d", 0, res);
-            vTaskDelay(pdMS_TO_TICKS(500));
+            /* Overwritten while counted (overrun): leave it out */
             continue;
         }
+        ones += blockOnes;
 
-        /* Count 1-bits: density near 50% = silence, deviation = sound */
-        UInt32 ones = countOnes(rxBuffer, RX_BUF_SIZE);
-        UInt32 totalBits = RX_BUF_SIZE * 8;
-        UInt32 percent = (ones * 100) / totalBits;
+        if(++blocks < BLOCKS_PER_REPORT)
+        {
+            continue;
+        }
+
+        UInt32 totalBits = BLOCKS_PER_REPORT * PDM_CAPTURE_BLOCK_SIZE * 8;
+        UInt32 percent = (UInt32)(((UInt64)ones * 100) / totalBits);
 
         /* Distance from 50% baseline as a simple level indicator */
         UInt32 level = (percent >= 50) ? (percent - 50) : (50 - percent);
 
-        GP_LOG_SYSTEM_PRINTF("PDM density:%u%% level:%u ones:%u/%u", 0,
-                             (UInt32)percent, (UInt32)level, (UInt32)ones, (UInt32)totalBits);
+        PdmCapture_Stats_t stats;
+        PdmCapture_GetStats(&stats);
+
+        GP_LOG_SYSTEM_PRINTF("PDM density:%u%% level:%u ones:%u/%u ovr:%u", 0,
+                             (UInt32)percent, (UInt32)level, (UInt32)ones, (UInt32)totalBits,
+                             (UInt32)stats.overruns);
+
+        ones = 0;
+        blocks = 0;
     }
 }
 
@@ -113,7 +135,7 @@ void Application_Init(void)
     gpCom_Init();
     gpLog_Init();
 
-    GP_LOG_SYSTEM_PRINTF("Microphone test: PDM via I2S_0 Master RX", 0);
+    GP_LOG_SYSTEM_PRINTF("Microphone test: PDM via I2S_0 Master RX (DMA)", 0);
 
     res = qPinCfg_Init(NULL);
     if(res != Q_OK)
@@ -130,18 +152,7 @@ void Application_Init(void)
     res = qDrvI2S_PinConfigSet(&pinCfg, qDrvI2S_ModeMasterRx);
     GP_ASSERT_SYSTEM(res == Q_OK);
 
-    qDrvI2S_Config_t cfg = {
-        .mode         = qDrvI2S_ModeMasterRx,
-        .transferMode = qDrvI2S_TransferModePolling,
-        .clkSrc       = qDrvI2S_ClkSrcMain,
-        .prescaler    = I2S_PRESCALER,
-        .wordLen      = 16,
-        .wsOffset     = 1,
-        .txBytes      = {.left = 0, .right = 0},
-        .rxBytes      = {.left = 2, .right = 2},
-    };
-
-    res = qDrvI2S_Init(&i2sDrv, &cfg, NULL, NULL, Q_DRV_IRQ_PRIO_DEFAULT);
+    res = PdmCapture_Init(&i2sDrv, I2S_PRESCALER);
     GP_ASSERT_SYSTEM(res == Q_OK);
 
     micTaskHandle = xTaskCreateStatic(micTask,
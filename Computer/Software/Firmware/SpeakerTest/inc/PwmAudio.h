@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * PCM playback through the PWMXL duty register for the SpeakerTest application.
+ *
+ * PWMXL_4 runs a 62.5 kHz carrier (1024 ticks at 64 MHz, 10-bit duty).  A
+ * circular DMA transfer writes one duty value per carrier period from a
+ * ping-pong buffer; each PCM sample is held for PWM_AUDIO_OVERSAMPLE
+ * periods, giving a 15.625 kHz sample rate with the carrier well above the
+ * audio band.
+ *
+ * When the DMA finishes a half, the interrupt wakes the playback task,
+ * which renders the next block through the registered callback and
+ * converts it to duty values.  Rendering therefore runs in task context
+ * with a full half (8.2 ms) of slack, so BLE/Thread interrupts cannot make
+ * it glitch unless they hold the CPU for longer than that.
+ */
+
+#ifndef _PWMAUDIO_H_
+#define _PWMAUDIO_H_
+
+#include "global.h"
+
+#include "qDrvPWMXL.h"
+
+#define PWM_AUDIO_CARRIER_HZ      62500
+#define PWM_AUDIO_OVERSAMPLE      4
+#define PWM_AUDIO_SAMPLE_RATE_HZ  (PWM_AUDIO_CARRIER_HZ / PWM_AUDIO_OVERSAMPLE)
+
+/* PCM samples rendered per half-buffer: 128 = 8.2 ms at 15.625 kHz */
+#define PWM_AUDIO_BLOCK_SAMPLES   128
+
+/** Fill @p pPcm with @p numSamples signed 16-bit samples (playback task context) */
+typedef void (*PwmAudio_RenderCallback_t)(Int16* pPcm, UInt16 numSamples);
+
+typedef struct {
+    UInt32 blocks;      /* Half-buffers rendered */
+    UInt32 underruns;   /* DMA reached a half the task had not refilled yet */
+} PwmAudio_Stats_t;
+
+/** @brief Configure PWMXL, the DMA channel and the playback task.
+ *  @param pDrv      PWMXL driver instance (pin must already be configured)
+ *  @param channel   PWMXL channel driving the amplifier
+ *  @param render    Source of PCM samples
+ */
+qResult_t PwmAudio_Init(qDrvPWMXL_t* pDrv, UInt8 channel, PwmAudio_RenderCallback_t render);
+
+/** @brief Start the carrier and the DMA; output is mid-scale (silence) until
+ *  the render callback produces sound. */
+qResult_t PwmAudio_Start(void);
+
+/** @brief Snapshot of the playback counters. */
+void PwmAudio_GetStats(PwmAudio_Stats_t* pStats);
+
+#endif // _PWMAUDIO_H_
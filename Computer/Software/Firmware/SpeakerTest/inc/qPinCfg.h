@@ -10,11 +10,20 @@
 
 #include "qPinCfg_Common.h"
 
+#if defined(SPEAKER_OUTPUT_DAC6551) && SPEAKER_OUTPUT_DAC6551
+/* GPIO5/6/7 (DAC6551A DIN/SCLK/SYNC) are configured by Dac6551_Init(), so
+ * PB2 (GPIO5) is left out of the unused list. */
+#define QPINCFG_UNUSED                                                                       \
+    QPINCFG_GPIO_LIST(PB1_BUTTON_GPIO_PIN, PB3_BUTTON_GPIO_PIN, PB4_BUTTON_GPIO_PIN,        \
+                      WHITE_WARM_LED_GPIO_PIN, ANIO0_GPIO_PIN, ANIO1_GPIO_PIN,               \
+                      EXT_32KXTAL_P, EXT_32KXTAL_N, BOARD_UNUSED_GPIO_PINS)
+#else
 /* GPIO10 is configured as PWMXL alternate function by qDrvPWMXL_PinConfigSet().
  * Pull all other free GPIOs low to reduce noise. */
 #define QPINCFG_UNUSED                                                                       \
     QPINCFG_GPIO_LIST(PB1_BUTTON_GPIO_PIN, PB2_BUTTON_GPIO_PIN, PB3_BUTTON_GPIO_PIN,        \
                       PB4_BUTTON_GPIO_PIN, WHITE_WARM_LED_GPIO_PIN, ANIO0_GPIO_PIN,          \
                       ANIO1_GPIO_PIN, EXT_32KXTAL_P, EXT_32KXTAL_N, BOARD_UNUSED_GPIO_PINS)
+#endif
 
 #endif // _QPINCFG_H_
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025, Qorvo Inc
+ *
+ * PCM playback through the PWMXL duty register, fed by a circular DMA.
+ *
+ * Buffer ownership:
+ *   The DMA plays dutyBuffer[0] then dutyBuffer[1] and wraps.  The half-done
+ *   interrupt for half h hands h to the playback task; filled[h] is set by
+ *   the task once h holds new audio.  If the DMA wraps into a half that was
+ *   never refilled it replays stale data: that is counted as an underrun.
+ *
+ * Sample to duty: ((sample + 32768) * periodTicks) >> 16, so 0 maps to 50 %
+ * duty (silence) and full scale spans the whole period.
+ */
+
+#include "PwmAudio.h"
+
+#include "gpLog.h"
+#include "gpAssert.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "qDrvDMA.h"
+
+#define GP_COMPONENT_ID GP_COMPONENT_ID_APP
+
+#define PWM_AUDIO_DMA_CHANNEL     0
+#define PWM_AUDIO_HALF_WORDS      (PWM_AUDIO_BLOCK_SAMPLES * PWM_AUDIO_OVERSAMPLE)
+
+#define PWM_AUDIO_TASK_STACK      (2 * configMINIMAL_STACK_SIZE)
+/* Above the application tasks: a late render is an audible glitch */
+#define PWM_AUDIO_TASK_PRIORITY   (tskIDLE_PRIORITY + 3)
+
+static qDrvPWMXL_t* pPwmDrv;
+static UInt8 pwmChannel;
+static UInt16 periodTicks;
+static PwmAudio_RenderCallback_t renderCallback;
+
+static qDrvDMA_t dmaDrv = Q_DRV_DMA_INSTANCE_DEFINE(PWM_AUDIO_DMA_CHANNEL);
+
+static UInt16 dutyBuffer[2][PWM_AUDIO_HALF_WORDS] __attribute__((aligned(4)));
+static volatile UInt8 filled[2];
+
+static TaskHandle_t audioTaskHandle;
+static StaticTask_t audioTaskData;
+static StackType_t  audioTaskStack[PWM_AUDIO_TASK_STACK];
+
+static volatile PwmAudio_Stats_t stats;
+
+static void PwmAudio_Convert(const Int16* pPcm, UInt16* pDuty)
+{
+    for(UInt16 i = 0; i < PWM_AUDIO_BLOCK_SAMPLES; i++)
+    {
+        UInt16 duty = (UInt16)((((UInt32)((Int32)pPcm[i] + 32768)) * periodTicks) >> 16);
+
+        for(UInt8 k = 0; k < PWM_AUDIO_OVERSAMPLE; k++)
+        {
+            *pDuty++ = duty;
+        }
+    }
+}
+
+static void PwmAudio_FillSilence(UInt8 half)
+{
+    for(UInt16 i = 0; i < PWM_AUDIO_HALF_WORDS; i++)
+    {
+        dutyBuffer[half][i] = (UInt16)(periodTicks / 2);
+    }
+    filled[half] = 1;
+}
+
+/* Runs in DMA interrupt context when the DMA leaves a half */
+static void PwmAudio_DmaCallback(void* pCallbackCtx, qDrvDMA_Event_t event)
+{
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    UInt8 done = (event == qDrvDMA_EventHalfDone) ? 0 : 1;
+
+    (void)pCallbackCtx;
+
+    /* The DMA is now playing the other half: it must hold fresh audio */
+    if(!filled[done ^ 1])
+    {
+        stats.underruns++;
+    }
+    filled[done] = 0;
+
+    xTaskNotifyFromISR(audioTaskHandle, (1UL << done), eSetBits, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+static void PwmAudio_Task(void* pParams)
+{
+    static Int16 pcm[PWM_AUDIO_BLOCK_SAMPLES];
+    UInt32 pending;
+
+    (void)pParams;
+
+    for(;;)
+    {
+        xTaskNotifyWait(0, 0xFFFFFFFFUL, &pending, portMAX_DELAY);
+
+        for(UInt8 half = 0; half < 2; half++)
+        {
+            if(pending & (1UL << half))
+            {
+                renderCallback(pcm, PWM_AUDIO_BLOCK_SAMPLES);
+                PwmAudio_Convert(pcm, dutyBuffer[half]);
+                filled[half] = 1;
+                stats.blocks++;
+            }
+        }
+    }
+}
+
+qResult_t PwmAudio_Init(qDrvPWMXL_t* pDrv, UInt8 channel, PwmAudio_RenderCallback_t render)
+{
+    qResult_t res;
+    UInt8 prescaler;
+
+    GP_ASSERT_SYSTEM(render != NULL);
+
+    pPwmDrv = pDrv;
+    pwmChannel = channel;
+    renderCallback = render;
+
+    if(!qDrvPWMXL_FrequencyCalculate(PWM_AUDIO_CARRIER_HZ, &periodTicks, &prescaler))
+    {
+        GP_LOG_SYSTEM_PRINTF("FrequencyCalculate failed for %lu Hz", 0, (unsigned long)PWM_AUDIO_CARRIER_HZ);
+        return Q_INVALID_PARAMETER;
+    }
+
+    qDrvPWMXL_Config_t cfg = {
+        .countMode   = qDrvPWMXL_CountModePrescaled,
+        .prescaler   = prescaler,
+        .periodTicks = periodTicks,
+    };
+
+    res = qDrvPWMXL_Init(pPwmDrv, &cfg, NULL, NULL);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    res = qDrvPWMXL_ChannelInit(pPwmDrv, pwmChannel);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    PwmAudio_FillSilence(0);
+    PwmAudio_FillSilence(1);
+
+    /* One 16-bit duty word per PWMXL period, wrapping over both halves */
+    qDrvDMA_Config_t dmaCfg = {
+        .trigger     = qDrvDMA_TriggerPWMXL,
+        .pSrc        = dutyBuffer,
+        .pDst        = qDrvPWMXL_ChannelDutyRegisterGet(pPwmDrv, pwmChannel),
+        .wordSize    = qDrvDMA_WordSize16,
+        .numWords    = 2 * PWM_AUDIO_HALF_WORDS,
+        .srcIncrement = true,
+        .dstIncrement = false,
+        .circular    = true,
+    };
+
+    res = qDrvDMA_Init(&dmaDrv, &dmaCfg, PwmAudio_DmaCallback, NULL, Q_DRV_IRQ_PRIO_DEFAULT);
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    audioTaskHandle = xTaskCreateStatic(PwmAudio_Task, "PwmAudio", PWM_AUDIO_TASK_STACK, NULL,
+                                        PWM_AUDIO_TASK_PRIORITY, audioTaskStack, &audioTaskData);
+    GP_ASSERT_SYSTEM(audioTaskHandle != NULL);
+
+    return Q_OK;
+}
+
+qResult_t PwmAudio_Start(void)
+{
+    qResult_t res = qDrvDMA_Start(&dmaDrv);
+
+    if(res != Q_OK)
+    {
+        return res;
+    }
+
+    return qDrvPWMXL_Enable(pPwmDrv, true);
+}
+
+void PwmAudio_GetStats(PwmAudio_Stats_t* pStats)
+{
+    GP_ASSERT_SYSTEM(pStats != NULL);
+
+    taskENTER_CRITICAL();
+    pStats->blocks    = stats.blocks;
+    pStats->underruns = stats.underruns;
+    taskEXIT_CRITICAL();
+}
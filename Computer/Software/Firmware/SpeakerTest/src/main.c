@@ -2,9 +2,17 @@
  * Copyright (c) 2025, Qorvo Inc
  *
  * Speaker test application.
- * Generates a 500 Hz square wave on GPIO10 via PWMXL_4.
+ * Plays the chime library on GPIO10 via PWMXL_4, one chime every few seconds.
  * Connect GPIO10 -> 1kOhm resistor -> TPA2034D1 IN+ pin.
  * TPA2034D1 IN- to GND. Speaker (CSS-66668N 8 Ohm) to amplifier output.
+ *
+ * Audio path: ChimeSynth (wavetable, fixed-point volume) renders 15.625 kHz
+ * PCM in the PwmAudio task; a circular DMA writes it into the PWMXL duty
+ * register at the 62.5 kHz carrier (see PwmAudio.c).
+ *
+ * Build with SPEAKER_OUTPUT_DAC6551=1 for the speaker PCB instead: a mixer
+ * task renders 16 kHz PCM into an AudioRing and Dac6551 streams it to the
+ * DAC6551A over SPI (GPIO5 MOSI, GPIO6 SCLK, GPIO7 SYNC) -> LM48511.
  */
 
 #include "hal.h"
@@ -18,25 +26,92 @@
 #include "task.h"
 
 #include "qDrvPWMXL.h"
+#include "PwmAudio.h"
+#include "ChimeSynth.h"
+#include "AudioRing.h"
+#include "Dac6551.h"
 
 #include "app_common.h"
 
 #define GP_COMPONENT_ID GP_COMPONENT_ID_APP
 
+/* 0: PWM on GPIO10 (DK + TPA2034D1), 1: DAC6551A over SPI (speaker PCB) */
+#ifndef SPEAKER_OUTPUT_DAC6551
+#define SPEAKER_OUTPUT_DAC6551 0
+#endif
+
 /* Single PWMXL instance (ID=0). GPIO10 = channel 4 (PWMXL_4). */
 #define SPEAKER_PWMXL_ID      0
 #define SPEAKER_PWMXL_CHANNEL 4
 #define SPEAKER_GPIO_PIN      10
 
-#define TONE_FREQ_HZ          500
+/* Pause between the end of one chime and the start of the next */
+#define CHIME_INTERVAL_US     2000000UL
+#define CHIME_VOLUME_PCT      60
 
 static qDrvPWMXL_t pwmxlDrv = Q_DRV_PWMXL_INSTANCE_DEFINE(SPEAKER_PWMXL_ID);
 
+static UInt8 nextChime = 0;
+
+#if SPEAKER_OUTPUT_DAC6551
+/* 1024 samples = 64 ms at 16 kHz; refilled when it drops below 512 */
+#define MIXER_RING_SAMPLES    1024
+#define MIXER_LOW_WATER       (MIXER_RING_SAMPLES / 2)
+#define MIXER_BLOCK_SAMPLES   128
+#define MIXER_TASK_STACK_SIZE 256
+#define MIXER_TASK_PRIORITY   (tskIDLE_PRIORITY + 3)
+
+static Int16 mixerRingBuffer[MIXER_RING_SAMPLES];
+static AudioRing_t mixerRing;
+
+static StaticTask_t mixerTaskBuffer;
+static StackType_t mixerTaskStack[MIXER_TASK_STACK_SIZE];
+static TaskHandle_t mixerTaskHandle;
+
+/* Keeps the ring topped up; woken by Dac6551 at the low-water mark */
+static void Mixer_Task(void* pvParameters)
+{
+    Int16 block[MIXER_BLOCK_SAMPLES];
+
+    (void)pvParameters;
+
+    for(;;)
+    {
+        while(AudioRing_Free(&mixerRing) >= MIXER_BLOCK_SAMPLES)
+        {
+            ChimeSynth_Render(block, MIXER_BLOCK_SAMPLES);
+            AudioRing_Write(&mixerRing, block, MIXER_BLOCK_SAMPLES);
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+#endif
+
+static void PlayNextChime(void)
+{
+#if SPEAKER_OUTPUT_DAC6551
+    Dac6551_Stats_t stats;
+
+    Dac6551_GetStats(&stats);
+    GP_LOG_SYSTEM_PRINTF("Chime: %s  frames:%lu underruns:%lu late:%lu", 0, ChimeSynth_Library[nextChime].name,
+                         (unsigned long)stats.frames, (unsigned long)stats.underruns, (unsigned long)stats.late);
+#else
+    PwmAudio_Stats_t stats;
+
+    PwmAudio_GetStats(&stats);
+    GP_LOG_SYSTEM_PRINTF("Chime: %s  blocks:%lu underruns:%lu", 0, ChimeSynth_Library[nextChime].name,
+                         (unsigned long)stats.blocks, (unsigned long)stats.underruns);
+#endif
+
+    ChimeSynth_Play((ChimeSynth_ChimeId_t)nextChime);
+    gpSched_ScheduleEvent(ChimeSynth_Library[nextChime].lengthMs * 1000UL + CHIME_INTERVAL_US, PlayNextChime);
+
+    nextChime = (UInt8)((nextChime + 1) % CHIME_COUNT);
+}
+
 void Application_Init(void)
 {
     qResult_t res;
-    UInt16 ticks;
-    UInt8 prescaler;
 
 #ifndef GP_BASECOMPS_DIVERSITY_NO_GPCOM_INIT
 #error GP_BASECOMPS_DIVERSITY_NO_GPCOM_INIT must be defined
@@ -46,7 +121,11 @@ void Application_Init(void)
     gpCom_Init();
     gpLog_Init();
 
-    GP_LOG_SYSTEM_PRINTF("Speaker test: 500Hz tone on GPIO10 via PWMXL_4", 0);
+#if SPEAKER_OUTPUT_DAC6551
+    GP_LOG_SYSTEM_PRINTF("Speaker test: chimes on DAC6551A via SPI + DMA", 0);
+#else
+    GP_LOG_SYSTEM_PRINTF("Speaker test: chimes on GPIO10 via PWMXL_4 + DMA", 0);
+#endif
 
     res = qPinCfg_Init(NULL);
     if(res != Q_OK)
@@ -55,39 +134,59 @@ void Application_Init(void)
         Q_ASSERT(false);
     }
 
+#if SPEAKER_OUTPUT_DAC6551
+    ChimeSynth_Init(DAC6551_SAMPLE_RATE_HZ);
+    ChimeSynth_SetVolume(CHIME_VOLUME_PCT);
+
+    AudioRing_Init(&mixerRing, mixerRingBuffer, MIXER_RING_SAMPLES);
+    mixerTaskHandle = xTaskCreateStatic(Mixer_Task, "Mixer", MIXER_TASK_STACK_SIZE, NULL, MIXER_TASK_PRIORITY,
+                                        mixerTaskStack, &mixerTaskBuffer);
+    GP_ASSERT_SYSTEM(mixerTaskHandle != NULL);
+
+    /* PWMXL runs without a pin here: its period is the DAC sample clock */
+    Dac6551_Config_t dacCfg = {
+        .framing  = Dac6551_FramingDma,
+        .pRing    = &mixerRing,
+        .producer = mixerTaskHandle,
+        .lowWater = MIXER_LOW_WATER,
+    };
+    res = Dac6551_Init(&pwmxlDrv, &dacCfg);
+    if(res != Q_OK)
+    {
+        GP_LOG_SYSTEM_PRINTF("Dac6551_Init failed: %d", 0, res);
+        GP_ASSERT_SYSTEM(false);
+    }
+
+    res = Dac6551_Start();
+    GP_ASSERT_SYSTEM(res == Q_OK);
+
+    GP_LOG_SYSTEM_PRINTF("Playback running: %lu Hz to DAC6551A, volume %u%%", 0,
+                         (unsigned long)DAC6551_SAMPLE_RATE_HZ, CHIME_VOLUME_PCT);
+#else
     /* Configure GPIO10 as PWMXL output */
     qDrvPWMXL_PinConfig_t pinCfg = Q_DRV_PWMXL_PIN_CONFIG(SPEAKER_PWMXL_CHANNEL, SPEAKER_GPIO_PIN);
     res = qDrvPWMXL_PinConfigSet(&pinCfg);
     GP_ASSERT_SYSTEM(res == Q_OK);
 
-    /* Calculate period ticks for 500 Hz */
-    Bool ok = qDrvPWMXL_FrequencyCalculate(TONE_FREQ_HZ, &ticks, &prescaler);
-    if(!ok)
+    ChimeSynth_Init(PWM_AUDIO_SAMPLE_RATE_HZ);
+    ChimeSynth_SetVolume(CHIME_VOLUME_PCT);
+
+    res = PwmAudio_Init(&pwmxlDrv, SPEAKER_PWMXL_CHANNEL, ChimeSynth_Render);
+    if(res != Q_OK)
     {
-        GP_LOG_SYSTEM_PRINTF("FrequencyCalculate failed for %u Hz", 0, TONE_FREQ_HZ);
+        GP_LOG_SYSTEM_PRINTF("PwmAudio_Init failed: %d", 0, res);
         GP_ASSERT_SYSTEM(false);
     }
 
-    qDrvPWMXL_Config_t cfg = {
-        .countMode   = qDrvPWMXL_CountModePrescaled,
-        .prescaler   = prescaler,
-        .periodTicks = ticks,
-    };
-
-    res = qDrvPWMXL_Init(&pwmxlDrv, &cfg, NULL, NULL);
-    GP_ASSERT_SYSTEM(res == Q_OK);
-
-    res = qDrvPWMXL_ChannelInit(&pwmxlDrv, SPEAKER_PWMXL_CHANNEL);
-    GP_ASSERT_SYSTEM(res == Q_OK);
-
-    /* 50% duty cycle */
-    res = qDrvPWMXL_ChannelDutySet(&pwmxlDrv, SPEAKER_PWMXL_CHANNEL, 5000);
+    res = PwmAudio_Start();
     GP_ASSERT_SYSTEM(res == Q_OK);
 
-    res = qDrvPWMXL_Enable(&pwmxlDrv, true);
-    GP_ASSERT_SYSTEM(res == Q_OK);
+    GP_LOG_SYSTEM_PRINTF("Playback running: %lu Hz PCM, %lu Hz carrier, volume %u%%", 0,
+                         (unsigned long)PWM_AUDIO_SAMPLE_RATE_HZ, (unsigned long)PWM_AUDIO_CARRIER_HZ,
+                         CHIME_VOLUME_PCT);
+#endif
 
-    GP_LOG_SYSTEM_PRINTF("Tone running. Prescaler=%u Ticks=%u", 0, prescaler, ticks);
+    PlayNextChime();
 }
 
 int main(void)
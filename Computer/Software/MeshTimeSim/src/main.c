@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "main.c"
+ *
+ * Host check of the mesh time estimator (shared/MeshTime.c).
+ *
+ *   meshtimesim [--hours H] [--seed N] [--check]
+ *
+ * A master and two clients run MeshTime exchanges over a simulated
+ * 802.15.4 path: each crystal has its own rate error (up to +-40 ppm),
+ * each direction takes 3-4 ms, and 10 % of the messages are queued for up
+ * to 40 more ms.  Exchanges follow MeshTime_NextIntervalMs(), so the run
+ * covers acquisition, drift tracking and the 32-bit wrap.
+ *
+ * Once a client is synced and has a drift estimate, its error (estimated
+ * mesh time minus the master's clock) is sampled every 100 ms of true
+ * time, together with the difference between the two clients: the
+ * playback skew of two speakers given the same play-at time.
+ *
+ * Every scenario prints mean |error|, worst |error| and worst skew.
+ * --check exits with status 1 if a scenario exceeds SIM_LIMIT_*.
+ */
+
+#include "MeshTime.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Limits for --check: the figures quoted in MeshTime.c, with margin */
+#define SIM_LIMIT_MEAN_US       250
+#define SIM_LIMIT_WORST_US      1000
+#define SIM_LIMIT_SKEW_US       1000
+
+#define SIM_PATH_MIN_US         3000
+#define SIM_PATH_SPREAD_US      1000
+#define SIM_QUEUED_PERCENT      10
+#define SIM_QUEUED_MAX_US       40000
+#define SIM_TURNAROUND_US       500
+#define SIM_SAMPLE_US           100000LL
+#define SIM_CLIENTS             2
+
+typedef struct
+{
+    double  ppm;        /**< Crystal rate error */
+    int64_t startUs;    /**< Local clock at true time 0 */
+} Sim_Crystal_t;
+
+typedef struct
+{
+    Sim_Crystal_t crystal;
+    MeshTime_t    clock;
+    int64_t       nextExchangeUs;   /**< True time of the next request */
+} Sim_Client_t;
+
+typedef struct
+{
+    const char* name;
+    double      masterPpm;
+    double      clientPpm[SIM_CLIENTS];
+} Sim_Scenario_t;
+
+typedef struct
+{
+    uint64_t samples;
+    double   sumAbsUs;
+    int32_t  worstUs;
+    int32_t  worstSkewUs;
+} Sim_Result_t;
+
+static const Sim_Scenario_t Sim_Scenarios[] = {
+    {"fast clients",  -20.0, {+20.0, +18.0}},
+    {"slow clients",  +20.0, {-20.0, -15.0}},
+    {"split",           0.0, {+40.0, -40.0}},
+    {"matched",         5.0, {  5.0,   4.0}},
+};
+
+static uint32_t sRandom;
+
+static uint32_t Sim_Random(void)
+{
+    /* xorshift32: the same run on every host */
+    sRandom ^= sRandom << 13;
+    sRandom ^= sRandom >> 17;
+    sRandom ^= sRandom << 5;
+    return sRandom;
+}
+
+static uint32_t Sim_Local(const Sim_Crystal_t* pCrystal, int64_t trueUs)
+{
+    return (uint32_t)(pCrystal->startUs + trueUs + (int64_t)((double)trueUs * pCrystal->ppm / 1e6));
+}
+
+static int64_t Sim_PathUs(void)
+{
+    int64_t us = SIM_PATH_MIN_US + (int64_t)(Sim_Random() % SIM_PATH_SPREAD_US);
+
+    if(Sim_Random() % 100 < SIM_QUEUED_PERCENT)
+    {
+        us += (int64_t)(Sim_Random() % SIM_QUEUED_MAX_US);
+    }
+    return us;
+}
+
+static void Sim_Exchange(Sim_Client_t* pClient, const MeshTime_t* pMaster, const Sim_Crystal_t* pMasterCrystal,
+                         int64_t t1True)
+{
+    uint8_t request[MESH_TIME_MSG_LEN];
+    uint8_t response[MESH_TIME_MSG_LEN];
+    uint8_t len;
+    int64_t t2True = t1True + Sim_PathUs();
+    int64_t t3True = t2True + SIM_TURNAROUND_US;
+    int64_t t4True = t3True + Sim_PathUs();
+
+    len = MeshTime_BuildRequest(&pClient->clock, Sim_Local(&pClient->crystal, t1True), request);
+    len = MeshTime_BuildResponse(pMaster, request, len, Sim_Local(pMasterCrystal, t2True),
+                                 Sim_Local(pMasterCrystal, t3True), response);
+    (void)MeshTime_HandleResponse(&pClient->clock, response, len, Sim_Local(&pClient->crystal, t4True));
+
+    pClient->nextExchangeUs = t1True + (int64_t)MeshTime_NextIntervalMs(&pClient->clock) * 1000;
+}
+
+static bool Sim_Ready(const Sim_Client_t* pClient, uint32_t localUs)
+{
+    return pClient->clock.haveDrift && MeshTime_GetState(&pClient->clock, localUs) == MeshTime_StateSynced;
+}
+
+static void Sim_Run(const Sim_Scenario_t* pScenario, int64_t durationUs, uint32_t seed, Sim_Result_t* pResult)
+{
+    Sim_Crystal_t master = {pScenario->masterPpm, 0};
+    MeshTime_t    masterClock;
+    Sim_Client_t  clients[SIM_CLIENTS];
+    int64_t       now;
+    uint8_t       c;
+
+    sRandom = seed;
+    memset(pResult, 0, sizeof(*pResult));
+
+    master.startUs = Sim_Random();
+    MeshTime_Init(&masterClock);
+    MeshTime_SetMaster(&masterClock, true, Sim_Local(&master, 0));
+
+    for(c = 0; c < SIM_CLIENTS; c++)
+    {
+        clients[c].crystal.ppm     = pScenario->clientPpm[c];
+        clients[c].crystal.startUs = Sim_Random();
+        MeshTime_Init(&clients[c].clock);
+        clients[c].nextExchangeUs  = (int64_t)(Sim_Random() % 1000000);
+    }
+
+    for(now = 0; now < durationUs; now += SIM_SAMPLE_US)
+    {
+        uint32_t meshUs = Sim_Local(&master, now);
+        int32_t  errorUs[SIM_CLIENTS];
+        bool     ready = true;
+
+        for(c = 0; c < SIM_CLIENTS; c++)
+        {
+            uint32_t localUs;
+
+            while(clients[c].nextExchangeUs <= now)
+            {
+                Sim_Exchange(&clients[c], &masterClock, &master, clients[c].nextExchangeUs);
+            }
+
+            localUs    = Sim_Local(&clients[c].crystal, now);
+            errorUs[c] = (int32_t)(MeshTime_ToMesh(&clients[c].clock, localUs) - meshUs);
+            ready      = ready && Sim_Ready(&clients[c], localUs);
+        }
+        if(!ready)
+        {
+            continue;
+        }
+
+        for(c = 0; c < SIM_CLIENTS; c++)
+        {
+            int32_t absUs = abs(errorUs[c]);
+
+            pResult->samples++;
+            pResult->sumAbsUs += absUs;
+            if(absUs > pResult->worstUs)
+            {
+                pResult->worstUs = absUs;
+            }
+        }
+        if(abs(errorUs[0] - errorUs[1]) > pResult->worstSkewUs)
+        {
+            pResult->worstSkewUs = abs(errorUs[0] - errorUs[1]);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double   hours = 3.0;
+    uint32_t seed  = 0x4D54u;
+    bool     check = false;
+    bool     fail  = false;
+    int      i;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--check") == 0)
+        {
+            check = true;
+        }
+        else if(strcmp(argv[i], "--hours") == 0 && i + 1 < argc)
+        {
+            hours = atof(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--hours H] [--seed N] [--check]\n", argv[0]);
+            return 3;
+        }
+    }
+    if(hours <= 0.0 || seed == 0)
+    {
+        fprintf(stderr, "hours must be > 0 and seed non-zero\n");
+        return 3;
+    }
+
+    printf("scenario         master ppm  client ppm     samples  mean us  worst us  skew us  status\n");
+    for(i = 0; i < (int)(sizeof(Sim_Scenarios) / sizeof(Sim_Scenarios[0])); i++)
+    {
+        const Sim_Scenario_t* pScenario = &Sim_Scenarios[i];
+        Sim_Result_t          result;
+        double                meanUs;
+        bool                  ok;
+
+        Sim_Run(pScenario, (int64_t)(hours * 3600e6), seed + (uint32_t)i, &result);
+        meanUs = result.samples ? result.sumAbsUs / (double)result.samples : 0.0;
+        ok     = result.samples != 0 && meanUs <= SIM_LIMIT_MEAN_US && result.worstUs <= SIM_LIMIT_WORST_US &&
+             result.worstSkewUs <= SIM_LIMIT_SKEW_US;
+        fail = fail || !ok;
+
+        printf("%-16s %10.1f  %+5.1f/%+5.1f  %10llu  %7.0f  %8ld  %7ld  %s\n", pScenario->name,
+               pScenario->masterPpm, pScenario->clientPpm[0], pScenario->clientPpm[1],
+               (unsigned long long)result.samples, meanUs, (long)result.worstUs, (long)result.worstSkewUs,
+               ok ? "ok" : "OVER");
+    }
+
+    return (check && fail) ? 1 : 0;
+}
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2024-2025, Qorvo Inc
+ *
+ * This software is owned by Qorvo Inc
+ * and protected under applicable copyright laws.
+ * It is delivered under the terms of the license
+ * and is intended and supplied for use solely and
+ * exclusively with products manufactured by
+ * Qorvo Inc.
+ *
+ *
+ * THIS SOFTWARE IS PROVIDED IN AN "AS IS"
+ * CONDITION. NO WARRANTIES, WHETHER EXPRESS,
+ * IMPLIED OR STATUTORY, INCLUDING, BUT NOT
+ * LIMITED TO, IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE APPLY TO THIS SOFTWARE.
+ * QORVO INC. SHALL NOT, IN ANY
+ * CIRCUMSTANCES, BE LIABLE FOR SPECIAL,
+ * INCIDENTAL OR CONSEQUENTIAL DAMAGES,
+ * FOR ANY REASON WHATSOEVER.
+ *
+ *
+ */
+
+/** @file "main.c"
+ *
+ * Host check of the adaptive transmit power (shared/MeshTxPower.c).
+ *
+ *   meshtxpowersim [--windows N] [--verbose] [--check]
+ *
+ * The OpenThread calls MeshTxPower makes are answered by a simulated node
+ * with one link: its parent (a child) or one router neighbor (a router).
+ * The neighbor sends at the BSP power over a fixed path loss, so the RSSI
+ * here is SIM_MAX_DBM - loss; it hears us with a margin of our power -
+ * loss - SIM_SENSITIVITY_DBM.  That margin sets the MAC retry rate of the
+ * window, the failed frames and the MLE link quality out a router
+ * neighbor reports.  The radio has the even levels from SIM_MIN_LEVEL_DBM
+ * to SIM_MAX_DBM and rounds a request down, so the step loops are covered.
+ *
+ * Every scenario runs MeshTxPower_Process() once per window after an
+ * attach (role change), and changes the link at window changeAt: a higher
+ * path loss, interference (retries), a failed frame, a weak link quality
+ * out or a detach.  --check exits with status 1 if the power leaves its
+ * bounds or a scenario misses its expectation: the final power, the
+ * reason of the change at changeAt, no step before notBefore, and no
+ * change from quietFrom on (hysteresis holds).
+ */
+
+#include "MeshTxPower.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MeshDiag.h"
+
+#include "FreeRTOS.h"
+#include "timers.h"
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+#include <openthread/platform/radio.h>
+
+#define SIM_MAX_DBM             10
+#define SIM_MIN_LEVEL_DBM       (-20)
+#define SIM_SENSITIVITY_DBM     (-100)
+#define SIM_FRAMES              50      /* Acknowledged frames per window */
+#define SIM_NEIGHBOR_RLOC16     0x4400
+#define SIM_ANY                 127
+
+/* Retries per acknowledged frame, %, by the margin the neighbor has on our frames */
+#define SIM_RETRY_GOOD_PCT      2       /* margin >= 10 dB */
+#define SIM_RETRY_FAIR_PCT      10      /* 5..9 dB */
+#define SIM_RETRY_POOR_PCT      30      /* below 5 dB, and one frame failed */
+
+typedef struct
+{
+    const char*  name;
+    otDeviceRole role;
+    int16_t      lossDb;        /**< Path loss to the neighbor */
+    uint16_t     changeAt;      /**< Window of the change, 0 = none */
+    int16_t      lossAfterDb;   /**< Path loss from changeAt on */
+    uint8_t      retryPct;      /**< Interference: extra retries from changeAt on */
+    uint8_t      failed;        /**< Frames failed in window changeAt */
+    uint8_t      lqOut;         /**< Link quality out reported from changeAt on, 0 = from the margin */
+    bool         detach;        /**< Detached from changeAt on */
+    int8_t       finalDbm;      /**< Expected power at the end, or SIM_ANY */
+    uint8_t      reasonAt;      /**< Expected reason of the change at changeAt */
+    uint16_t     notBefore;     /**< No change before this window */
+    uint16_t     quietFrom;     /**< No change from this window on, 0 = not checked */
+} Sim_Scenario_t;
+
+typedef struct
+{
+    uint16_t changes;
+    uint16_t ups;
+    uint16_t downs;
+    uint16_t firstChange;       /**< Window of the first change, 0xFFFF = none */
+    uint16_t lastChange;
+    uint8_t  reasonAt;          /**< Reason of a change at changeAt, MeshTxPower_None = none */
+    bool     inBounds;
+} Sim_Result_t;
+
+static const Sim_Scenario_t Sim_Scenarios[] = {
+    /* name               role                    loss  at  after retry fail lq  detach final    reason at            notBefore quietFrom */
+    {"step down",        OT_DEVICE_ROLE_CHILD,   50,   0,  50,  0,    0,   0,  false,  -10,     MeshTxPower_None,     6,        40},
+    {"hold in band",     OT_DEVICE_ROLE_CHILD,   80,   0,  80,  0,    0,   0,  false,  4,       MeshTxPower_None,     6,        20},
+    {"weak margin",      OT_DEVICE_ROLE_CHILD,   80,   40, 90,  0,    0,   0,  false,  8,       MeshTxPower_UpMargin, 6,        41},
+    {"retries",          OT_DEVICE_ROLE_CHILD,   50,   40, 50,  20,   0,   0,  false,  SIM_MAX_DBM, MeshTxPower_UpRetry, 6,     45},
+    {"failed frame",     OT_DEVICE_ROLE_CHILD,   50,   40, 50,  0,    1,   0,  false,  -10,     MeshTxPower_UpRetry,  6,        0},
+    {"router floor",     OT_DEVICE_ROLE_ROUTER,  50,   0,  50,  0,    0,   0,  false,  0,       MeshTxPower_None,     6,        30},
+    {"router lq out 1",  OT_DEVICE_ROLE_ROUTER,  50,   40, 50,  0,    0,   1,  false,  SIM_MAX_DBM, MeshTxPower_UpMargin, 6,    45},
+    {"detach",           OT_DEVICE_ROLE_CHILD,   50,   40, 50,  0,    0,   0,  true,   SIM_MAX_DBM, MeshTxPower_Reset,   6,     41},
+};
+
+int      Sim_Verbose = 0;
+unsigned Sim_Window  = 0;   /* For the log lines */
+
+/* Simulated node */
+static otDeviceRole  sRole;
+static int16_t       sLossDb;
+static uint8_t       sLqOut;
+static int8_t        sDbm;
+static otMacCounters sMac;
+
+/* -------------------------------------------------------------------------
+ * OpenThread, FreeRTOS and MeshDiag, as MeshTxPower sees them
+ * ------------------------------------------------------------------------- */
+
+TimerHandle_t xTimerCreateStatic(const char* pName, TickType_t period, BaseType_t autoReload, void* pId,
+                                 TimerCallbackFunction_t callback, StaticTimer_t* pBuffer)
+{
+    (void)pName;
+    (void)period;
+    (void)autoReload;
+    (void)pId;
+    (void)callback;
+    return pBuffer;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait)
+{
+    (void)timer;
+    (void)period;
+    (void)wait;
+    return pdTRUE;
+}
+
+void MeshDiag_Request(void)
+{
+}
+
+static int16_t Sim_MarginOut(void)
+{
+    return (int16_t)(sDbm - sLossDb - SIM_SENSITIVITY_DBM);
+}
+
+const otMacCounters* otLinkGetCounters(otInstance* aInstance)
+{
+    (void)aInstance;
+    return &sMac;
+}
+
+otDeviceRole otThreadGetDeviceRole(otInstance* aInstance)
+{
+    (void)aInstance;
+    return sRole;
+}
+
+otError otThreadGetParentInfo(otInstance* aInstance, otRouterInfo* aParentInfo)
+{
+    (void)aInstance;
+    memset(aParentInfo, 0, sizeof(*aParentInfo));
+    aParentInfo->mRloc16 = SIM_NEIGHBOR_RLOC16;
+    return (sRole == OT_DEVICE_ROLE_CHILD) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+}
+
+otError otThreadGetParentAverageRssi(otInstance* aInstance, int8_t* aParentRssi)
+{
+    (void)aInstance;
+    *aParentRssi = (int8_t)(SIM_MAX_DBM - sLossDb);
+    return OT_ERROR_NONE;
+}
+
+otError otThreadGetNextNeighborInfo(otInstance* aInstance, otNeighborInfoIterator* aIterator, otNeighborInfo* aInfo)
+{
+    (void)aInstance;
+    if(*aIterator != OT_NEIGHBOR_INFO_ITERATOR_INIT)
+    {
+        return OT_ERROR_NOT_FOUND;
+    }
+    (*aIterator)++;
+    memset(aInfo, 0, sizeof(*aInfo));
+    aInfo->mRloc16      = SIM_NEIGHBOR_RLOC16;
+    aInfo->mAverageRssi = (int8_t)(SIM_MAX_DBM - sLossDb);
+    aInfo->mIsChild     = false;
+    return OT_ERROR_NONE;
+}
+
+otError otThreadGetRouterInfo(otInstance* aInstance, uint16_t aRouterId, otRouterInfo* aRouterInfo)
+{
+    int16_t margin = Sim_MarginOut();
+
+    (void)aInstance;
+    memset(aRouterInfo, 0, sizeof(*aRouterInfo));
+    aRouterInfo->mRloc16          = (uint16_t)(aRouterId << 10);
+    aRouterInfo->mLinkEstablished = true;
+    /* MLE link quality: 3 above 20 dB, 2 above 10 dB, 1 above 2 dB */
+    aRouterInfo->mLinkQualityOut = (sLqOut != 0) ? sLqOut : (margin > 20) ? 3 : (margin > 10) ? 2 : (margin > 2) ? 1 : 0;
+    return OT_ERROR_NONE;
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance* aInstance)
+{
+    (void)aInstance;
+    return SIM_SENSITIVITY_DBM;
+}
+
+otError otPlatRadioGetTransmitPower(otInstance* aInstance, int8_t* aPower)
+{
+    (void)aInstance;
+    *aPower = sDbm;
+    return OT_ERROR_NONE;
+}
+
+/* Even levels only; a request between two levels gets the lower one */
+otError otPlatRadioSetTransmitPower(otInstance* aInstance, int8_t aPower)
+{
+    int16_t dbm = (aPower > SIM_MAX_DBM) ? SIM_MAX_DBM : (aPower < SIM_MIN_LEVEL_DBM) ? SIM_MIN_LEVEL_DBM : aPower;
+
+    (void)aInstance;
+    if(dbm & 1)
+    {
+        dbm--;
+    }
+    sDbm = (int8_t)dbm;
+    return OT_ERROR_NONE;
+}
+
+/* -------------------------------------------------------------------------
+ * Simulation
+ * ------------------------------------------------------------------------- */
+
+/* One window of traffic at the current power */
+static void Sim_Traffic(uint8_t interferencePct, uint8_t failed)
+{
+    int16_t margin   = Sim_MarginOut();
+    uint8_t retryPct = (margin >= 10) ? SIM_RETRY_GOOD_PCT : (margin >= 5) ? SIM_RETRY_FAIR_PCT : SIM_RETRY_POOR_PCT;
+
+    sMac.mTxAckRequested += SIM_FRAMES;
+    sMac.mTxRetry += (uint32_t)SIM_FRAMES * (retryPct + interferencePct) / 100;
+    sMac.mTxDirectMaxRetryExpiry += failed + ((margin < 5) ? 1 : 0);
+}
+
+static void Sim_Run(const Sim_Scenario_t* pScenario, uint16_t windows, Sim_Result_t* pResult)
+{
+    MeshTxPower_Status_t status;
+    uint16_t             changes = 0;
+    uint16_t             w;
+    int8_t               floorDbm;
+
+    memset(pResult, 0, sizeof(*pResult));
+    memset(&sMac, 0, sizeof(sMac));
+    pResult->firstChange = 0xFFFF;
+    pResult->reasonAt    = MeshTxPower_None;
+    pResult->inBounds    = true;
+
+    sRole    = pScenario->role;
+    sLossDb  = pScenario->lossDb;
+    sLqOut   = 0;
+    sDbm     = SIM_MAX_DBM;
+    floorDbm = (pScenario->role == OT_DEVICE_ROLE_CHILD) ? MESH_TXPOWER_MIN_DBM : MESH_TXPOWER_ROUTER_MIN_DBM;
+
+    MeshTxPower_Init(NULL, NULL);
+    /* Window 0: the attach */
+    MeshTxPower_StateChanged(OT_CHANGED_THREAD_ROLE);
+
+    for(w = 0; w < windows; w++)
+    {
+        bool    changeNow = (pScenario->changeAt != 0 && w == pScenario->changeAt);
+        int8_t  before    = sDbm;
+
+        if(changeNow)
+        {
+            sLossDb = pScenario->lossAfterDb;
+            sLqOut  = pScenario->lqOut;
+            sRole   = pScenario->detach ? OT_DEVICE_ROLE_DETACHED : sRole;
+        }
+        if(w > 0)
+        {
+            bool changed = (pScenario->changeAt != 0 && w >= pScenario->changeAt);
+
+            Sim_Traffic(changed ? pScenario->retryPct : 0, changeNow ? pScenario->failed : 0);
+        }
+
+        Sim_Window = w;
+        MeshTxPower_Process();
+        MeshTxPower_GetStatus(&status);
+
+        if(status.changes != changes)
+        {
+            changes = status.changes;
+            pResult->changes++;
+            pResult->ups += (sDbm > before) ? 1 : 0;
+            pResult->downs += (sDbm < before) ? 1 : 0;
+            pResult->lastChange = w;
+            if(pResult->firstChange == 0xFFFF)
+            {
+                pResult->firstChange = w;
+            }
+            if(changeNow)
+            {
+                pResult->reasonAt = status.reason;
+            }
+        }
+        if(sDbm > SIM_MAX_DBM || (sRole != OT_DEVICE_ROLE_DETACHED && sDbm < floorDbm))
+        {
+            pResult->inBounds = false;
+        }
+    }
+}
+
+static bool Sim_Ok(const Sim_Scenario_t* pScenario, const Sim_Result_t* pResult)
+{
+    if(!pResult->inBounds)
+    {
+        return false;
+    }
+    if(pScenario->finalDbm != SIM_ANY && sDbm != pScenario->finalDbm)
+    {
+        return false;
+    }
+    if(pScenario->changeAt != 0 && pResult->reasonAt != pScenario->reasonAt)
+    {
+        return false;
+    }
+    if(pResult->firstChange != 0xFFFF && pResult->firstChange < pScenario->notBefore &&
+       pResult->firstChange != pScenario->changeAt)
+    {
+        return false;
+    }
+    if(pScenario->quietFrom != 0 && pResult->changes != 0 && pResult->lastChange >= pScenario->quietFrom)
+    {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    uint16_t windows = 90;
+    bool     check   = false;
+    bool     fail    = false;
+    int      i;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--check") == 0)
+        {
+            check = true;
+        }
+        else if(strcmp(argv[i], "--verbose") == 0)
+        {
+            Sim_Verbose = 1;
+        }
+        else if(strcmp(argv[i], "--windows") == 0 && i + 1 < argc)
+        {
+            windows = (uint16_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--windows N] [--verbose] [--check]\n", argv[0]);
+            return 3;
+        }
+    }
+    if(windows < 60)
+    {
+        fprintf(stderr, "windows must be at least 60 (changes happen at window 40)\n");
+        return 3;
+    }
+
+    printf("scenario          loss dB  changes  up  down  first  last  final dBm  reason  status\n");
+    for(i = 0; i < (int)(sizeof(Sim_Scenarios) / sizeof(Sim_Scenarios[0])); i++)
+    {
+        const Sim_Scenario_t* pScenario = &Sim_Scenarios[i];
+        Sim_Result_t          result;
+        bool                  ok;
+
+        if(Sim_Verbose)
+        {
+            printf("%s\n", pScenario->name);
+        }
+        Sim_Run(pScenario, windows, &result);
+        ok   = Sim_Ok(pScenario, &result);
+        fail = fail || !ok;
+
+        printf("%-16s %4d/%-3d  %7u  %2u  %4u  %5d  %4u  %9d  %6u  %s\n", pScenario->name, pScenario->lossDb,
+               pScenario->lossAfterDb, result.changes, result.ups, result.downs,
+               (result.firstChange == 0xFFFF) ? -1 : (int)result.firstChange, result.lastChange, sDbm,
+               result.reasonAt, ok ? "ok" : "FAIL");
+    }
+
+    return (check && fail) ? 1 : 0;
+}
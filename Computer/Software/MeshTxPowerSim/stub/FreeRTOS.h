@@ -0,0 +1,14 @@
+/* Host stub: only what shared/MeshTxPower.c uses (MeshTxPowerSim) */
+#ifndef _FREERTOS_H_
+#define _FREERTOS_H_
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long     BaseType_t;
+
+#define pdFALSE           0
+#define pdTRUE            1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#endif /* _FREERTOS_H_ */
@@ -0,0 +1,19 @@
+/* Host stub (MeshTxPowerSim): log lines are printed with --verbose only, after the window number */
+#ifndef _GPLOG_H_
+#define _GPLOG_H_
+
+#include <stdio.h>
+
+extern int      Sim_Verbose;
+extern unsigned Sim_Window;
+
+#define GP_LOG_SYSTEM_PRINTF(fmt, n, ...)                                      \
+    do                                                                         \
+    {                                                                          \
+        if(Sim_Verbose)                                                        \
+        {                                                                      \
+            printf("  window %3u: " fmt "\n", Sim_Window, ##__VA_ARGS__);      \
+        }                                                                      \
+    } while(0)
+
+#endif /* _GPLOG_H_ */
@@ -0,0 +1,19 @@
+/* Host stub (MeshTxPowerSim) */
+#ifndef OPENTHREAD_INSTANCE_H_
+#define OPENTHREAD_INSTANCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct otInstance otInstance;
+
+typedef enum
+{
+    OT_ERROR_NONE      = 0,
+    OT_ERROR_NOT_FOUND = 23,
+} otError;
+
+#define OT_CHANGED_THREAD_ROLE         (1U << 2)
+#define OT_CHANGED_THREAD_PARTITION_ID (1U << 7)
+
+#endif /* OPENTHREAD_INSTANCE_H_ */
@@ -0,0 +1,16 @@
+/* Host stub (MeshTxPowerSim): the MAC counters MeshTxPower reads */
+#ifndef OPENTHREAD_LINK_H_
+#define OPENTHREAD_LINK_H_
+
+#include <openthread/instance.h>
+
+typedef struct
+{
+    uint32_t mTxAckRequested;
+    uint32_t mTxRetry;
+    uint32_t mTxDirectMaxRetryExpiry;
+} otMacCounters;
+
+const otMacCounters* otLinkGetCounters(otInstance* aInstance);
+
+#endif /* OPENTHREAD_LINK_H_ */
@@ -0,0 +1,13 @@
+/* Host stub (MeshTxPowerSim) */
+#ifndef OPENTHREAD_PLATFORM_RADIO_H_
+#define OPENTHREAD_PLATFORM_RADIO_H_
+
+#include <openthread/instance.h>
+
+#define OT_RADIO_RSSI_INVALID 127
+
+int8_t  otPlatRadioGetReceiveSensitivity(otInstance* aInstance);
+otError otPlatRadioGetTransmitPower(otInstance* aInstance, int8_t* aPower);
+otError otPlatRadioSetTransmitPower(otInstance* aInstance, int8_t aPower);
+
+#endif /* OPENTHREAD_PLATFORM_RADIO_H_ */
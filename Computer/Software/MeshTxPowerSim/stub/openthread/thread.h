@@ -0,0 +1,41 @@
+/* Host stub (MeshTxPowerSim): roles and neighbor tables */
+#ifndef OPENTHREAD_THREAD_H_
+#define OPENTHREAD_THREAD_H_
+
+#include <openthread/instance.h>
+
+typedef enum
+{
+    OT_DEVICE_ROLE_DISABLED = 0,
+    OT_DEVICE_ROLE_DETACHED = 1,
+    OT_DEVICE_ROLE_CHILD    = 2,
+    OT_DEVICE_ROLE_ROUTER   = 3,
+    OT_DEVICE_ROLE_LEADER   = 4,
+} otDeviceRole;
+
+typedef struct
+{
+    uint16_t mRloc16;
+    uint8_t  mLinkQualityOut;
+    bool     mLinkEstablished;
+} otRouterInfo;
+
+typedef struct
+{
+    uint16_t mRloc16;
+    int8_t   mAverageRssi;
+    bool     mIsChild;
+} otNeighborInfo;
+
+typedef int16_t otNeighborInfoIterator;
+
+#define OT_NEIGHBOR_INFO_ITERATOR_INIT 0
+
+otDeviceRole otThreadGetDeviceRole(otInstance* aInstance);
+otError      otThreadGetParentInfo(otInstance* aInstance, otRouterInfo* aParentInfo);
+otError      otThreadGetParentAverageRssi(otInstance* aInstance, int8_t* aParentRssi);
+otError      otThreadGetNextNeighborInfo(otInstance* aInstance, otNeighborInfoIterator* aIterator,
+                                         otNeighborInfo* aInfo);
+otError      otThreadGetRouterInfo(otInstance* aInstance, uint16_t aRouterId, otRouterInfo* aRouterInfo);
+
+#endif /* OPENTHREAD_THREAD_H_ */
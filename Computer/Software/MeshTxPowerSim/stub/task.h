@@ -0,0 +1,7 @@
+/* Host stub (MeshTxPowerSim) */
+#ifndef _TASK_H_
+#define _TASK_H_
+
+#include "FreeRTOS.h"
+
+#endif /* _TASK_H_ */
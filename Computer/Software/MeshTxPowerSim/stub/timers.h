@@ -0,0 +1,18 @@
+/* Host stub (MeshTxPowerSim): the simulator calls MeshTxPower_Process() once per window itself */
+#ifndef _TIMERS_H_
+#define _TIMERS_H_
+
+#include "FreeRTOS.h"
+
+typedef void* TimerHandle_t;
+typedef struct
+{
+    int unused;
+} StaticTimer_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t xTimer);
+
+TimerHandle_t xTimerCreateStatic(const char* pName, TickType_t period, BaseType_t autoReload, void* pId,
+                                 TimerCallbackFunction_t callback, StaticTimer_t* pBuffer);
+BaseType_t    xTimerChangePeriod(TimerHandle_t timer, TickType_t period, TickType_t wait);
+
+#endif /* _TIMERS_H_ */